@@ -0,0 +1,648 @@
+/*
+ * bench - microbenchmarks for the hot paths of the library
+ *
+ * Each benchmark runs a kernel on a fixture that is generated from a fixed
+ * seed, so that results of different builds or revisions are comparable. A
+ * kernel returns the number of items it processed, e.g. symbols, messages, or
+ * integration steps. The harness calls the kernel often enough for a single
+ * repetition to take at least --min-time ms, and reports the median and the
+ * minimum of the time per item over all repetitions.
+ *
+ * Results are written to stdout as CSV (default) or JSON (--json). Instead,
+ * the results of a single run can be written to files with --csv-out and
+ * --json-out, in one or both formats. The benchmarks can be restricted to
+ * those whose name/param contains the string given by --filter. See also the
+ * bench and run-bench targets in the Makefile.
+ */
+
+// only warnings and errors, and no debug output in the kernels
+#define NCR_ENABLE_LOG_LEVEL_WARNING
+
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <string>
+#include <cstring>
+#include <chrono>
+#include <algorithm>
+#include <functional>
+#include <span>
+
+#include <ncr/ncr_log.hpp>
+#include <ncr/ncr_random.hpp>
+#include <ncr/ncr_memory.hpp>
+#include <ncr/ncr_bitset.hpp>
+#include <ncr/ncr_algorithm.hpp>
+#include <ncr/ncr_automata.hpp>
+#include <ncr/ncr_chrono.hpp>
+#include <ncr/ncr_transport2.hpp>
+#include <ncr/ncr_neuron.hpp>
+
+namespace ncr {
+	NCR_LOG_DECLARATION(new logger_policy_stdcout());
+}
+
+using namespace ncr;
+
+
+/*
+ * __bench_keep - prevent the compiler from optimizing away a value
+ */
+template <typename T>
+inline void
+__bench_keep(const T &value)
+{
+	asm volatile("" : : "r"(&value) : "memory");
+}
+
+
+struct bench_options {
+	size_t      reps        = 7;
+	double      min_time_ms = 50.0;
+	std::string filter      = "";
+	bool        json        = false;
+
+	// output files, stdout is used when both are empty
+	std::string csv_out     = "";
+	std::string json_out    = "";
+};
+
+
+struct bench_result {
+	std::string name;
+	std::string param;
+
+	// items per repetition, and number of repetitions
+	size_t      items;
+	size_t      reps;
+
+	// time per item over all repetitions
+	double      median_ns;
+	double      min_ns;
+};
+
+
+struct bench_context {
+	bench_options             opts;
+	std::vector<bench_result> results;
+};
+
+
+/*
+ * bench_run - measure a kernel, and record the result in the context
+ */
+template <typename Kernel>
+void
+bench_run(bench_context &ctx, const std::string &name, const std::string &param, Kernel &&kernel)
+{
+	using clock = std::chrono::steady_clock;
+
+	if (!ctx.opts.filter.empty() && (name + "/" + param).find(ctx.opts.filter) == std::string::npos)
+		return;
+
+	// warm-up, and calibration of the number of calls per repetition
+	size_t n_calls = 1;
+	for (;;) {
+		const auto t0 = clock::now();
+		for (size_t i = 0; i < n_calls; i++)
+			kernel();
+		const std::chrono::duration<double, std::milli> elapsed = clock::now() - t0;
+		if (elapsed.count() >= ctx.opts.min_time_ms || n_calls >= (size_t(1) << 30))
+			break;
+		n_calls *= 2;
+	}
+
+	std::vector<double> ns_per_item(ctx.opts.reps);
+	size_t items = 0;
+	for (size_t r = 0; r < ctx.opts.reps; r++) {
+		items = 0;
+		const auto t0 = clock::now();
+		for (size_t i = 0; i < n_calls; i++)
+			items += kernel();
+		const std::chrono::duration<double, std::nano> elapsed = clock::now() - t0;
+		ns_per_item[r] = elapsed.count() / double(std::max<size_t>(items, 1));
+	}
+	std::sort(ns_per_item.begin(), ns_per_item.end());
+
+	ctx.results.push_back({
+		.name      = name,
+		.param     = param,
+		.items     = items,
+		.reps      = ctx.opts.reps,
+		.median_ns = ns_per_item[ns_per_item.size() / 2],
+		.min_ns    = ns_per_item.front(),
+	});
+	std::cerr << name << "/" << param << ": " << ctx.results.back().median_ns << " ns/item\n";
+}
+
+
+void
+bench_write_csv(std::ostream &out, const bench_context &ctx)
+{
+	out << "name,param,items,reps,median_ns_per_item,min_ns_per_item,items_per_second\n";
+	for (const auto &r : ctx.results)
+		out << r.name << "," << r.param << "," << r.items << "," << r.reps << ","
+		    << r.median_ns << "," << r.min_ns << "," << 1e9 / r.median_ns << "\n";
+}
+
+
+void
+bench_write_json(std::ostream &out, const bench_context &ctx)
+{
+	out << "{\n\t\"compiler\": \"" << __VERSION__ << "\",\n\t\"benchmarks\": [\n";
+	for (size_t i = 0; i < ctx.results.size(); i++) {
+		const auto &r = ctx.results[i];
+		out << "\t\t{\"name\": \"" << r.name << "\", \"param\": \"" << r.param << "\""
+		    << ", \"items\": " << r.items << ", \"reps\": " << r.reps
+		    << ", \"median_ns_per_item\": " << r.median_ns
+		    << ", \"min_ns_per_item\": " << r.min_ns
+		    << ", \"items_per_second\": " << 1e9 / r.median_ns << "}"
+		    << (i + 1 < ctx.results.size() ? ",\n" : "\n");
+	}
+	out << "\t]\n}\n";
+}
+
+
+/*
+ * __bench_random_dfa - a random complete DFA over the binary alphabet
+ *
+ * random_genome yields sparse automata, in which most states are unreachable
+ * and random words get rejected after a few symbols. Here, every state has a
+ * transition for every symbol to a uniformly chosen state.
+ */
+void
+__bench_random_dfa(finite_state_machine &fsm, size_t n_states, std::mt19937_64 *rng)
+{
+	fsm.alphabet = &binary_alphabet;
+	fsm.genome   = random_genome(&binary_alphabet, n_states, true, rng);
+	fsm.genome.transitions.clear();
+	for (size_t i = 0; i < n_states; i++)
+		for (size_t j = 0; j < binary_alphabet.n_input_symbols; j++)
+			fsm.genome.transitions.push_back({
+				.state_from   = i,
+				.symbol_read  = binary_alphabet.symbols[j].id,
+				.state_to     = choice<size_t>(0, n_states - 1, rng),
+				.symbol_write = binary_alphabet.symbols[j].id,
+			});
+	sort(fsm.genome);
+	fsm_init(fsm);
+}
+
+
+/*
+ * fsm_run and fsm_run_batch, on words and on packed words, on random
+ * complete DFAs, items are symbols
+ */
+void
+bench_fsm_run(bench_context &ctx)
+{
+	const size_t n_words = 256, length = 64;
+
+	for (size_t n_states : {8, 32}) {
+		std::mt19937_64 *rng = mkrng(1000 + n_states);
+		finite_state_machine fsm;
+		__bench_random_dfa(fsm, n_states, rng);
+
+		std::vector<basic_string_t> words;
+		fsm_word_batch batch;
+		for (size_t i = 0; i < n_words; i++) {
+			words.push_back(random_string(rng, &binary_alphabet, length));
+			fsm_word_batch_push(batch, words.back());
+		}
+
+		const std::string param = "states=" + std::to_string(n_states);
+		fsm_run_log log;
+		bench_run(ctx, "fsm_run", param, [&]() {
+			size_t n = 0;
+			for (auto &word : words) {
+				fsm_reset(fsm);
+				auto flags = fsm_run(fsm, word, log);
+				__bench_keep(flags);
+				n += word.size();
+			}
+			return n;
+		});
+
+		std::vector<fsm_run_flags> flags;
+		bench_run(ctx, "fsm_run_batch", param, [&]() {
+			fsm_run_batch(fsm, batch, flags);
+			__bench_keep(flags.data());
+			return n_words * length;
+		});
+
+		fsm_packed_batch<symbol_bits(binary_alphabet.n_symbols)> packed;
+		for (auto &word : words)
+			fsm_packed_batch_push(packed, word);
+		bench_run(ctx, "fsm_run_batch_packed", param, [&]() {
+			fsm_run_batch(fsm, packed, flags);
+			__bench_keep(flags.data());
+			return n_words * length;
+		});
+
+		fsm_free(fsm);
+		delete rng;
+	}
+}
+
+
+/*
+ * dfa_minimize with both algorithms on random complete DFAs, items
+ * are minimizations
+ */
+void
+bench_dfa_minimize(bench_context &ctx)
+{
+	const std::pair<dfa_minimize_algorithm, const char*> algorithms[] = {
+		{dfa_minimize_algorithm::Moore,    "moore"},
+		{dfa_minimize_algorithm::Hopcroft, "hopcroft"},
+	};
+
+	for (size_t n_states : {8, 32, 128}) {
+		std::mt19937_64 *rng = mkrng(2000 + n_states);
+		finite_state_machine fsm;
+		__bench_random_dfa(fsm, n_states, rng);
+
+		for (auto [algorithm, algorithm_name] : algorithms) {
+			const std::string param = std::string(algorithm_name) + ",states=" + std::to_string(n_states);
+			bench_run(ctx, "dfa_minimize", param, [&]() {
+				auto [ss_min, ts_min] = fsm_minimize(fsm, algorithm);
+				__bench_keep(ss_min.size());
+				return size_t(1);
+			});
+		}
+
+		fsm_free(fsm);
+		delete rng;
+	}
+}
+
+
+struct bench_payload {
+	double value;
+};
+
+struct bench_options_t {
+	ncr::time_point<ClockType::Ticks> delivery_time;
+};
+
+struct bench_inline_traits {
+	using payload_type = bench_payload;
+	using options_type = bench_options_t;
+
+	static bool compare(const auto &left, const auto &right) {
+		return left.options.delivery_time <= right.options.delivery_time;
+	}
+	static bool deliverable(const auto &env, const size_t &ticks) {
+		return env.options.delivery_time <= ticks;
+	}
+};
+
+struct bench_bucket_traits {
+	using payload_type = bench_payload;
+	using options_type = bench_options_t;
+
+	static constexpr size_t calendar_size = 1024;
+	static size_t delivery_bucket(const options_type &opts) { return opts.delivery_time.value; }
+	static bool deliverable(const auto &env, const size_t &ticks) {
+		return env.options.delivery_time <= ticks;
+	}
+};
+
+
+/*
+ * __bench_transport - broadcast with random delays, process and drain the
+ * sinks, items are delivered messages. Each delay spread uses a transport
+ * which is constructed from args
+ */
+template <typename Traits, typename... Args>
+void
+__bench_transport(bench_context &ctx, const std::string &name, Args&&... args)
+{
+	using port_type = typename ncr::transport<Traits>::port_type;
+	const size_t n_sinks = 4, n_sends = 16, n_ticks = 64;
+
+	for (size_t spread : {1, 16, 256}) {
+		transport<Traits> tr(args...);
+		port_type source;
+		std::vector<port_type> sinks(n_sinks);
+		register_ports(tr, &source);
+		for (auto &sink : sinks) {
+			register_ports(tr, &sink);
+			connect(tr, &source, &sink);
+		}
+
+		size_t ticks = 0;
+		std::uint64_t state = 3000 + spread;
+		bench_run(ctx, name, "spread=" + std::to_string(spread), [&]() {
+			size_t n = 0;
+			for (size_t i = 0; i < n_ticks; i++, ticks++) {
+				for (size_t s = 0; s < n_sends; s++) {
+					state = state * 6364136223846793005ull + 1442695040888963407ull;
+					const size_t delay = 1 + (state >> 33) % spread;
+					broadcast(tr, &source, bench_payload{.value = double(s)},
+					          bench_options_t{.delivery_time = ticks + delay});
+				}
+				process_messages(tr, ticks);
+				for (auto &sink : sinks)
+					n += port_drain(sink, [](const bench_payload &p) { __bench_keep(p.value); });
+			}
+			return n;
+		});
+	}
+}
+
+
+void
+bench_transport(bench_context &ctx)
+{
+	auto comp = [](auto &left, auto &right) -> bool {
+		return left.options.delivery_time <= right.options.delivery_time;
+	};
+	__bench_transport<bench_inline_traits>(ctx, "transport_inline");
+	__bench_transport<bench_bucket_traits>(ctx, "transport_bucket", comp);
+}
+
+
+/*
+ * slab_memory alloc/free churn in random order, items are alloc/free pairs
+ */
+void
+bench_slab(bench_context &ctx)
+{
+	struct item { double values[4]; };
+	const size_t n = 4096;
+
+	std::mt19937_64 *rng = mkrng(4000);
+	std::vector<size_t> order(n);
+	for (size_t i = 0; i < n; i++)
+		order[i] = i;
+	std::shuffle(order.begin(), order.end(), *rng);
+
+	slab_memory<item> slab;
+	std::vector<slab_memory_index_t> ids(n), shuffled(n);
+	bench_run(ctx, "slab_memory", "alloc_free", [&]() {
+		for (size_t i = 0; i < n; i++)
+			ids[i] = slab.alloc().value();
+		for (size_t i = 0; i < n; i++)
+			slab.free(ids[order[i]]);
+		return n;
+	});
+	bench_run(ctx, "slab_memory", "alloc_bulk_free", [&]() {
+		for (size_t i = 0; i < n; i++)
+			ids[i] = slab.alloc().value();
+		for (size_t i = 0; i < n; i++)
+			shuffled[i] = ids[order[i]];
+		slab.free(shuffled.begin(), shuffled.end());
+		return n;
+	});
+	delete rng;
+}
+
+
+/*
+ * dynamic_bitset counting and bitwise operations, items are bits
+ */
+void
+bench_bitset(bench_context &ctx)
+{
+	const size_t n_words = 64;
+	const size_t n_bits  = n_words * 64;
+
+	std::mt19937_64 *rng = mkrng(5000);
+	dynamic_bitset<std::uint64_t> a(n_words), b(n_words);
+	for (size_t i = 0; i < n_bits; i++) {
+		a.set(i, coinflip(rng));
+		b.set(i, coinflip(rng));
+	}
+	delete rng;
+
+	const std::string param = "bits=" + std::to_string(n_bits);
+	bench_run(ctx, "bitset_count",     param, [&]() { __bench_keep(a.count());       return n_bits; });
+	bench_run(ctx, "bitset_count_and", param, [&]() { __bench_keep(count_and(a, b)); return n_bits; });
+	bench_run(ctx, "bitset_hamming",   param, [&]() { __bench_keep(hamming(a, b));   return n_bits; });
+	bench_run(ctx, "bitset_xor",       param, [&]() { a ^= b; __bench_keep(a);       return n_bits; });
+	bench_run(ctx, "bitset_and",       param, [&]() {
+		auto c = a & b;
+		__bench_keep(c);
+		return n_bits;
+	});
+}
+
+
+/*
+ * Levensthein and Hamming distances on random strings over four letters,
+ * items are pairs of strings
+ */
+void
+bench_strings(bench_context &ctx)
+{
+	const size_t n_pairs = 64;
+
+	for (size_t length : {16, 64, 256}) {
+		std::mt19937_64 *rng = mkrng(6000 + length);
+		std::vector<std::string> as(n_pairs), bs(n_pairs);
+		for (size_t i = 0; i < n_pairs; i++) {
+			for (size_t j = 0; j < length; j++) {
+				as[i].push_back("ACGT"[choice<size_t>(0, 3, rng)]);
+				bs[i].push_back("ACGT"[choice<size_t>(0, 3, rng)]);
+			}
+		}
+		delete rng;
+
+		const std::string param = "length=" + std::to_string(length);
+		bench_run(ctx, "levensthein", param, [&]() {
+			for (size_t i = 0; i < n_pairs; i++)
+				__bench_keep(levensthein(as[i], bs[i]));
+			return n_pairs;
+		});
+		bench_run(ctx, "levensthein_dynamic", param, [&]() {
+			for (size_t i = 0; i < n_pairs; i++)
+				__bench_keep(levensthein_dynamic(as[i].begin(), as[i].end(), bs[i].begin(), bs[i].end(),
+							[](char l, char r) { return l == r; }));
+			return n_pairs;
+		});
+		bench_run(ctx, "hamming", param, [&]() {
+			for (size_t i = 0; i < n_pairs; i++)
+				__bench_keep(hamming(as[i], bs[i]));
+			return n_pairs;
+		});
+	}
+}
+
+
+/*
+ * __bench_samplers - the bulk samplers for one random number generator,
+ * items are samples
+ */
+template <typename RngT>
+void
+__bench_samplers(bench_context &ctx, const std::string &rng_name)
+{
+	const size_t n = 4096;
+
+	RngT *rng = mkrng<RngT>(7000);
+	std::vector<double> out(n);
+	std::vector<std::uint64_t> mask((n + 63) / 64);
+	std::span<double> span(out);
+
+	bench_run(ctx, "unif_random_fill", rng_name, [&]() { unif_random_fill(span, rng);         __bench_keep(out.data()); return n; });
+	bench_run(ctx, "normal_fill",      rng_name, [&]() { normal_fill(span, 0.0, 1.0, rng);     __bench_keep(out.data()); return n; });
+	bench_run(ctx, "exponential_fill", rng_name, [&]() { exponential_fill(span, 2.0, rng);     __bench_keep(out.data()); return n; });
+	bench_run(ctx, "bernoulli_fill",   rng_name + ",p=0.5", [&]() {
+		bernoulli_fill(std::span(mask), n, 0.5, rng);
+		__bench_keep(mask.data());
+		return n;
+	});
+	bench_run(ctx, "bernoulli_fill",   rng_name + ",p=0.1", [&]() {
+		bernoulli_fill(std::span(mask), n, 0.1, rng);
+		__bench_keep(mask.data());
+		return n;
+	});
+	bench_run(ctx, "poisson_spike_mask", rng_name, [&]() {
+		poisson_spike_mask(std::span(mask), n, 10.0, 0.001, rng);
+		__bench_keep(mask.data());
+		return n;
+	});
+	delete rng;
+}
+
+
+void
+bench_samplers(bench_context &ctx)
+{
+	__bench_samplers<std::mt19937_64>(ctx, "mt19937_64");
+	__bench_samplers<philox4x32>(ctx, "philox4x32");
+}
+
+
+/*
+ * __bench_neuron - integration steps of a single neuron with its demo input,
+ * items are steps
+ */
+template <typename Neuron, typename StepFn>
+void
+__bench_neuron(bench_context &ctx, const std::string &model, Neuron n, StepFn &&step_fn)
+{
+	const size_t n_steps = 1000;
+	const Neuron n0 = n;
+
+	bench_run(ctx, "neuron_step", model, [&]() {
+		n = n0;
+		double t = 0.0;
+		for (size_t i = 0; i < n_steps; i++) {
+			double dt = 0.1_ms;
+			step_fn(n, t, dt);
+		}
+		__bench_keep(n.state);
+		return n_steps;
+	});
+}
+
+
+void
+bench_neurons(bench_context &ctx)
+{
+	{
+		auto input = Izhikevich::get_demo_input("tonic_spiking");
+		__bench_neuron(ctx, "izhikevich", Izhikevich::make("tonic_spiking"),
+				[&](auto &n, double &t, double &dt) { Izhikevich::step(n, t, dt, input); });
+	}
+	{
+		auto input = FitzhughNagumo::get_demo_input();
+		__bench_neuron(ctx, "fitzhughnagumo", FitzhughNagumo::make(),
+				[&](auto &n, double &t, double &dt) { FitzhughNagumo::step(n, t, dt, input); });
+	}
+	{
+		auto input = AdEx::get_demo_input();
+		__bench_neuron(ctx, "adex", AdEx::make(),
+				[&](auto &n, double &t, double &dt) { AdEx::step(n, t, dt, input); });
+	}
+	{
+		auto input = AdExQuadratic::get_demo_input();
+		__bench_neuron(ctx, "adexquadratic", AdExQuadratic::make(),
+				[&](auto &n, double &t, double &dt) { AdExQuadratic::step(n, t, dt, input); });
+	}
+	{
+		auto input = LeakyIF::get_demo_input();
+		__bench_neuron(ctx, "leakyif", LeakyIF::make(),
+				[&](auto &n, double &t, double &dt) { LeakyIF::step(n, t, dt, input); });
+	}
+	{
+		auto input = QuadraticIF::get_demo_input();
+		__bench_neuron(ctx, "quadraticif", QuadraticIF::make(),
+				[&](auto &n, double &t, double &dt) { QuadraticIF::step(n, t, dt, input); });
+	}
+	{
+		auto input = GeneralizedIF::get_demo_input<double>("tonic_spiking");
+		__bench_neuron(ctx, "generalizedif", GeneralizedIF::make<2, double>("tonic_spiking"),
+				[&](auto &n, double &t, double &dt) { GeneralizedIF::step(n, t, dt, input); });
+	}
+	{
+		auto input = HodgkinHuxley::get_demo_input("classical");
+		__bench_neuron(ctx, "hodgkinhuxley", HodgkinHuxley::make("classical"),
+				[&](auto &n, double &t, double &dt) { HodgkinHuxley::step(n, t, dt, input); });
+	}
+}
+
+
+int
+main(int argc, char *argv[])
+{
+	bench_context ctx;
+	for (int i = 1; i < argc; i++) {
+		if (!std::strcmp(argv[i], "--json"))
+			ctx.opts.json = true;
+		else if (!std::strcmp(argv[i], "--csv"))
+			ctx.opts.json = false;
+		else if (!std::strcmp(argv[i], "--csv-out") && i + 1 < argc)
+			ctx.opts.csv_out = argv[++i];
+		else if (!std::strcmp(argv[i], "--json-out") && i + 1 < argc)
+			ctx.opts.json_out = argv[++i];
+		else if (!std::strcmp(argv[i], "--filter") && i + 1 < argc)
+			ctx.opts.filter = argv[++i];
+		else if (!std::strcmp(argv[i], "--reps") && i + 1 < argc)
+			ctx.opts.reps = std::max(1ul, std::stoul(argv[++i]));
+		else if (!std::strcmp(argv[i], "--min-time") && i + 1 < argc)
+			ctx.opts.min_time_ms = std::stod(argv[++i]);
+		else {
+			std::cerr << "usage: " << argv[0]
+			          << " [--csv|--json] [--csv-out file] [--json-out file]"
+			          << " [--filter substring] [--reps N] [--min-time ms]\n";
+			return 1;
+		}
+	}
+
+	bench_fsm_run(ctx);
+	bench_dfa_minimize(ctx);
+	bench_transport(ctx);
+	bench_slab(ctx);
+	bench_bitset(ctx);
+	bench_strings(ctx);
+	bench_samplers(ctx);
+	bench_neurons(ctx);
+
+	if (ctx.opts.csv_out.empty() && ctx.opts.json_out.empty()) {
+		if (ctx.opts.json)
+			bench_write_json(std::cout, ctx);
+		else
+			bench_write_csv(std::cout, ctx);
+		return 0;
+	}
+
+	bool ok = true;
+	if (!ctx.opts.csv_out.empty()) {
+		std::ofstream out(ctx.opts.csv_out);
+		bench_write_csv(out, ctx);
+		ok = ok && bool(out);
+	}
+	if (!ctx.opts.json_out.empty()) {
+		std::ofstream out(ctx.opts.json_out);
+		bench_write_json(out, ctx);
+		ok = ok && bool(out);
+	}
+	if (!ok) {
+		std::cerr << "error: could not write the results\n";
+		return 1;
+	}
+	return 0;
+}
@@ -3,6 +3,9 @@
 
 
 #include <cmath>
+#include <set>
+#include <sstream>
+#include <string>
 
 #define NCR_ENABLE_LOG_LEVEL_VERBOSE
 
@@ -52,5 +55,94 @@ int main()
 		}
 	}
 
+	// unique random strings from a space which is too large to enumerate
+	std::cout << "---\n";
+	{
+		static constexpr symbol dna_symbols[] = {
+			{.id = 0, .glyph = 'A', .is_blank = false},
+			{.id = 1, .glyph = 'C', .is_blank = false},
+			{.id = 2, .glyph = 'G', .is_blank = false},
+			{.id = 3, .glyph = 'T', .is_blank = false},
+		};
+		static constexpr basic_alphabet dna_alphabet = {
+			.n_symbols       = 4,
+			.n_input_symbols = 4,
+			.n_blank_symbols = 0,
+			.symbols         = dna_symbols,
+		};
+
+		static std::mt19937_64 *rng = ncr::mkrng(1234);
+		auto gen = ncr::alphabet::generators::UniqueRandom(rng, dna_alphabet, 16);
+		std::set<std::string> seen;
+		for (size_t i = 0; i < 100000; i++) {
+			std::ostringstream os;
+			os << gen();
+			seen.insert(os.str());
+		}
+		std::cout << "dna strings of length 16: " << seen.size() << " unique out of 100000\n";
+		if (seen.size() != 100000)
+			return 1;
+	}
+
+	// static alphabets and packed words, with the generators emitting the
+	// same strings in packed form
+	{
+		static constexpr auto dna = make_static_alphabet<4>("ACGT");
+		static constexpr basic_alphabet dna_alphabet = dna.basic();
+		static_assert(dna.n_symbols == 4 && dna.bits_per_symbol == 2);
+		static_assert(dna_alphabet.symbols[2].glyph == 'G' && dna_alphabet.symbols[2].id == 2);
+		static_assert(symbol_bits(2) == 1 && symbol_bits(3) == 2 && symbol_bits(16) == 4 && symbol_bits(17) == 8);
+
+		packed_word<dna.bits_per_symbol> packed;
+		for (size_t i = 0; i < 1000; i++) {
+			const std::uint64_t n = i * 0x9e3779b97f4a7c15ull;
+			nth_string(&dna_alphabet, 32, n, packed);
+			if (unpack_str(packed, &dna_alphabet) != nth_string(&dna_alphabet, 32, n))
+				return 1;
+		}
+
+		// an alphabet whose size is not a power of two
+		static constexpr auto abc = make_static_alphabet<2, 1>("ab.");
+		static constexpr basic_alphabet abc_alphabet = abc.basic();
+		packed_word<abc.bits_per_symbol> packed_abc;
+		for (size_t n = 0; n < 243; n++) {
+			nth_string(&abc_alphabet, 5, n, packed_abc);
+			if (unpack_str(packed_abc, &abc_alphabet) != nth_string(&abc_alphabet, 5, n))
+				return 1;
+		}
+
+		std::mt19937_64 *rng0 = ncr::mkrng(42), *rng1 = ncr::mkrng(42);
+		auto gen0 = ncr::alphabet::generators::UniqueRandom(rng0, dna_alphabet, 32);
+		auto gen1 = ncr::alphabet::generators::UniqueRandom(rng1, dna_alphabet, 32);
+		auto succ0 = ncr::alphabet::generators::Successive(dna_alphabet, 5);
+		auto succ1 = ncr::alphabet::generators::Successive(dna_alphabet, 5);
+		for (size_t i = 0; i < 1000; i++) {
+			gen1(packed);
+			if (unpack_str(packed, &dna_alphabet) != gen0())
+				return 1;
+			succ1(packed);
+			if (unpack_str(packed, &dna_alphabet) != succ0())
+				return 1;
+		}
+		delete rng0;
+		delete rng1;
+		std::cout << "packed words: ok\n";
+	}
+
+	// the permutation visits each index exactly once
+	{
+		for (std::uint64_t n : {1, 2, 3, 5, 64, 1000, 4097}) {
+			ncr::feistel_permutation perm(n, n);
+			std::vector<bool> visited(n, false);
+			for (std::uint64_t i = 0; i < n; i++) {
+				auto j = perm(i);
+				if (j >= n || visited[j])
+					return 1;
+				visited[j] = true;
+			}
+		}
+		std::cout << "feistel permutation: ok\n";
+	}
+
 	return 0;
 }
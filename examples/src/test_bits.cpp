@@ -3,6 +3,9 @@
 #include <ncr/ncr_bitset.hpp>
 
 #include <ranges>
+#include <sstream>
+#include <cstring>
+#include <vector>
 #include <stdexcept>
 
 // compile time fixed size bitset
@@ -390,10 +393,307 @@ test_dynamic_bitset()
 
 }
 
+// bulk and fused operations on large bitsets, compared to bit-by-bit results
+bool
+test_bulk_operations()
+{
+	using std::cout;
+
+	cout << "ncr::dynamic_bitset - bulk operations\n";
+	const size_t N = 100003;
+	ncr::dynamic_bitset<uint64_t> a, b;
+	a.resize(N);
+	b.resize(N);
+
+	size_t state = 1;
+	for (size_t i = 0; i < N; i++) {
+		state = state * 6364136223846793005ull + 1442695040888963407ull;
+		a.set(i, (state >> 40) % 3 == 0);
+		b.set(i, (state >> 50) % 5 == 0);
+	}
+
+	size_t n_a = 0, n_and = 0, n_xor = 0, n_andnot = 0;
+	for (size_t i = 0; i < N; i++) {
+		n_a      += a.test(i);
+		n_and    += a.test(i) && b.test(i);
+		n_xor    += a.test(i) != b.test(i);
+		n_andnot += a.test(i) && !b.test(i);
+	}
+
+	ncr::dynamic_bitset<uint64_t> c(a);
+	c.andnot(b);
+	ncr::dynamic_bitset<uint64_t> empty;
+	empty.resize(N);
+
+	bool ok = a.count() == n_a
+	       && ncr::count_and(a, b) == n_and
+	       && (a & b).count() == n_and
+	       && ncr::hamming(a, b) == n_xor
+	       && c.count() == n_andnot
+	       && ncr::any_and(a, b)
+	       && !ncr::any_and(a, empty)
+	       && !ncr::any_and(c, b)
+	       && empty.none() && a.any();
+
+	// fixed size bitsets use the same kernels
+	ncr::bitset<200, uint8_t> x, y;
+	for (size_t i = 0; i < 200; i += 3) x.set(i);
+	for (size_t i = 0; i < 200; i += 5) y.set(i);
+	ok = ok && ncr::count_and(x, y) == 14 && ncr::hamming(x, y) == 67 + 40 - 28;
+
+	cout << "count " << a.count() << ", count_and " << ncr::count_and(a, b)
+	     << ", hamming " << ncr::hamming(a, b) << (ok ? ", ok" : ", FAILED") << "\n";
+	return ok;
+}
+
+// iterate set bits of a sparse bitset
+bool
+test_set_bit_iteration()
+{
+	using std::cout;
+
+	cout << "ncr::dynamic_bitset - set bit iteration\n";
+	const size_t N = 1000000;
+	ncr::dynamic_bitset<uint64_t> mask;
+	mask.resize(N);
+
+	// roughly 1% of bits set, including the first and last bit
+	std::vector<size_t> expected;
+	size_t state = 7;
+	for (size_t i = 0; i < N; i++) {
+		state = state * 6364136223846793005ull + 1442695040888963407ull;
+		if (i == 0 || i == N - 1 || (state >> 33) % 100 == 0) {
+			mask.set(i);
+			expected.push_back(i);
+		}
+	}
+
+	std::vector<size_t> found, visited;
+	for (size_t i = mask.find_first(); i < mask.size(); i = mask.find_next(i))
+		found.push_back(i);
+	mask.for_each_set([&visited](size_t i) { visited.push_back(i); });
+
+	// padding bits must be ignored
+	ncr::dynamic_bitset<uint8_t> small;
+	small.resize(11);
+	small.set();
+	size_t n_small = 0;
+	small.for_each_set([&n_small](size_t) { n_small++; });
+
+	ncr::dynamic_bitset<uint8_t> none;
+	none.resize(20);
+
+	const bool ok = found == expected && visited == expected
+	             && n_small == 11 && small.find_next(10) == 11
+	             && none.find_first() == none.size();
+	cout << expected.size() << " of " << N << " bits set" << (ok ? ", ok" : ", FAILED") << "\n";
+	return ok;
+}
+
+// write and read bitsets in binary form, also with foreign byte order
+bool
+test_serialization()
+{
+	using std::cout;
+
+	cout << "ncr::dynamic_bitset - binary serialization\n";
+	ncr::dynamic_bitset<uint32_t> bits;
+	bits.resize(1000);
+	for (size_t i = 0; i < 1000; i += 7)
+		bits.set(i);
+
+	std::stringstream ss;
+	bool ok = ncr::bitset_write(ss, bits);
+	std::string data = ss.str();
+	ok = ok && data.size() == ncr::bitset_serialized_size(bits);
+
+	ncr::dynamic_bitset<uint32_t> read;
+	ok = ok && ncr::bitset_read(ss, read) && read.size() == 1000 && ncr::hamming(bits, read) == 0;
+
+	// the storage type must match
+	std::stringstream ss8(data);
+	ncr::dynamic_bitset<uint8_t> read8;
+	ok = ok && !ncr::bitset_read(ss8, read8);
+
+	// zero-copy view of the serialized data
+	std::vector<uint32_t> buffer((data.size() + 3) / 4);
+	std::memcpy(buffer.data(), data.data(), data.size());
+	auto view = ncr::bitset_map<uint32_t>(buffer.data(), data.size());
+	ok = ok && view && view->nbits == 1000 && view->test(994) && !view->test(995);
+
+	// emulate a file written on a machine with the other byte order
+	ncr::bitset_header header;
+	std::memcpy(&header, buffer.data(), sizeof(header));
+	header.byte_order = 1 - header.byte_order;
+	header.nbits = ncr::bswap<u64>(header.nbits);
+	std::memcpy(buffer.data(), &header, sizeof(header));
+	for (size_t i = sizeof(header) / 4; i < buffer.size(); i++)
+		buffer[i] = ncr::bswap<u32>(buffer[i]);
+
+	std::string foreign(reinterpret_cast<const char*>(buffer.data()), data.size());
+	std::stringstream ssf(foreign);
+	ncr::dynamic_bitset<uint32_t> readf;
+	ok = ok && ncr::bitset_read(ssf, readf) && ncr::hamming(bits, readf) == 0;
+	ok = ok && !ncr::bitset_map<uint32_t>(buffer.data(), data.size());
+	view = ncr::bitset_map_inplace<uint32_t>(buffer.data(), data.size());
+	ok = ok && view && view->nbits == 1000 && view->test(994) && !view->test(995);
+
+	// fixed size bitsets read into their own storage
+	ncr::bitset<1000, uint32_t> fixed;
+	std::stringstream ss2(data);
+	ok = ok && ncr::bitset_read(ss2, fixed) && fixed.count() == bits.count();
+
+	// headers whose size exceeds the data, or whose word count overflows, are
+	// rejected before anything is allocated or mapped
+	auto damage = [&](u64 nbits) {
+		std::string damaged = data;
+		std::memcpy(damaged.data() + offsetof(ncr::bitset_header, nbits), &nbits, sizeof(nbits));
+		return damaged;
+	};
+	for (u64 nbits : {u64(1001 + 32), u64(1) << 40, ~u64(0)}) {
+		std::string damaged = damage(nbits);
+		std::stringstream ssd(damaged);
+		ncr::dynamic_bitset<uint32_t> readd;
+		readd.resize(10);
+		ok = ok && !ncr::bitset_read(ssd, readd) && readd.size() == 10;
+
+		std::stringstream ssd2(damaged);
+		ok = ok && !ncr::bitset_read(ssd2, fixed);
+
+		std::vector<uint32_t> dbuf((damaged.size() + 3) / 4);
+		std::memcpy(dbuf.data(), damaged.data(), damaged.size());
+		ok = ok && !ncr::bitset_map<uint32_t>(dbuf.data(), damaged.size());
+		ok = ok && !ncr::bitset_map_inplace<uint32_t>(dbuf.data(), damaged.size());
+	}
+
+	cout << data.size() << " bytes" << (ok ? ", ok" : ", FAILED") << "\n";
+	return ok;
+}
+
+// bit-parallel, bounded and banded Levensthein distances against the DP
+bool
+test_levensthein()
+{
+	using namespace std;
+	cout << "levensthein - bit-parallel, bounded and banded variants\n";
+
+	std::uint64_t state = 12345;
+	auto next = [&state]() {
+		state = state * 6364136223846793005ull + 1442695040888963407ull;
+		return unsigned(state >> 33);
+	};
+
+	ncr::levensthein_scratch<char> scratch;
+	ncr::levensthein_scratch<int>  scratch_int;
+	auto eq = [](char l, char r) { return l == r; };
+
+	bool ok = true;
+	size_t npairs = 0;
+	for (size_t m = 0; m < 200; m += 7) {
+		for (size_t n = 0; n < 200; n += 11) {
+			std::string a, b;
+			for (size_t i = 0; i < m; i++) a += char('a' + next() % 4);
+			for (size_t i = 0; i < n; i++) b += char('a' + next() % 4);
+			// make some pairs similar
+			if (m == n && m > 0)
+				b = a, b[next() % m] = 'x';
+			std::vector<int> ai(a.begin(), a.end()), bi(b.begin(), b.end());
+
+			const size_t ref = (m && n) ? ncr::levensthein_dynamic(a.begin(), a.end(), b.begin(), b.end(), eq) : std::max(m, n);
+			const size_t k   = next() % 40;
+			const size_t exp = std::min(ref, k + 1);
+
+			ok &= ncr::levensthein_myers(a.begin(), a.end(), b.begin(), b.end(), &scratch) == ref;
+			ok &= ncr::levensthein_myers(ai.begin(), ai.end(), bi.begin(), bi.end(), &scratch_int) == ref;
+			ok &= ncr::levensthein_bounded(a.begin(), a.end(), b.begin(), b.end(), k, &scratch) == exp;
+			ok &= ncr::levensthein_banded(a.begin(), a.end(), b.begin(), b.end(), k, eq, scratch) == exp;
+			ok &= ncr::levensthein(a, b) == ref;
+			npairs++;
+		}
+	}
+	ok &= ncr::levensthein("kitten", "sitting") == 3;
+
+	cout << npairs << " pairs" << (ok ? ", ok" : ", FAILED") << "\n";
+	return ok;
+}
+
+// pairwise distance matrix of a population against a serial double loop
+bool
+test_pairwise_distances()
+{
+	using namespace std;
+	cout << "pairwise_distances - condensed distance matrix of populations\n";
+
+	std::uint64_t state = 4242;
+	auto next = [&state]() {
+		state = state * 6364136223846793005ull + 1442695040888963407ull;
+		return unsigned(state >> 33);
+	};
+
+	const size_t n = 101;
+	std::vector<ncr::dynamic_bitset<>> bits;
+	std::vector<std::string> strs;
+	for (size_t i = 0; i < n; i++) {
+		ncr::dynamic_bitset<> b(5);
+		for (size_t k = 0; k < b.size(); k++)
+			if (next() % 3 == 0)
+				b.set(k);
+		bits.push_back(b);
+
+		std::string s;
+		const size_t len = 20 + next() % 50;
+		for (size_t k = 0; k < len; k++)
+			s += char('a' + next() % 4);
+		strs.push_back(s);
+	}
+
+	ncr::thread_pool pool(4);
+	ncr::levensthein_metric<char> lev(&pool);
+	ncr::levensthein_metric<char> lev_bounded(&pool, 30);
+
+	auto d_bits    = ncr::pairwise_distances(&pool, bits, ncr::hamming_metric{}, 16);
+	auto d_serial  = ncr::pairwise_distances(nullptr, bits, ncr::hamming_metric{}, 7);
+	auto d_strs    = ncr::pairwise_distances(&pool, strs, lev, 8);
+	auto d_bounded = ncr::pairwise_distances(&pool, strs, lev_bounded);
+
+	bool ok = d_bits.size() == ncr::condensed_size(n) && d_bits == d_serial;
+	for (size_t i = 0; i < n; i++) {
+		for (size_t j = i + 1; j < n; j++) {
+			const size_t idx = ncr::condensed_index(n, i, j);
+			const size_t ref = ncr::levensthein(strs[i], strs[j]);
+			ok &= d_bits[idx] == ncr::hamming(bits[i], bits[j]);
+			ok &= d_strs[idx] == ref;
+			ok &= d_bounded[idx] == std::min<size_t>(ref, 31);
+		}
+	}
+
+	// output of the wrong size is rejected
+	std::vector<float> small(3);
+	ok &= !ncr::pairwise_distances(&pool, strs, lev, std::span<float>(small));
+
+	cout << ncr::condensed_size(n) << " pairs" << (ok ? ", ok" : ", FAILED") << "\n";
+	return ok;
+}
+
 int
 main(int, char*[])
 {
 	test_bitset();
 	std::cout << "\n";
 	test_dynamic_bitset();
+	std::cout << "\n";
+	if (!test_bulk_operations())
+		return 1;
+	std::cout << "\n";
+	if (!test_set_bit_iteration())
+		return 1;
+	std::cout << "\n";
+	if (!test_serialization())
+		return 1;
+	std::cout << "\n";
+	if (!test_levensthein())
+		return 1;
+	std::cout << "\n";
+	if (!test_pairwise_distances())
+		return 1;
 }
@@ -232,6 +232,27 @@ test_cvar()
 }
 
 
+void
+test_handles()
+{
+	// handles are resolved once and follow later changes of the value
+	auto h_double = cvars.handle<double>("t_double");
+	auto h_string = cvars.handle<std::string>("t_string");
+	std::cout << "Handle t_double: " << *h_double << ", t_string: " << *h_string << "\n";
+
+	cvars.get(std::string_view("t_double"))->set(42.0);
+	std::cout << "Handle t_double after set: " << h_double.get() << "\n";
+	cvars.get("t_double")->set(10.0);
+
+	// type mismatches and unknown names yield empty handles
+	const bool wrong_type = static_cast<bool>(cvars.handle<int>("t_double"));
+	const bool unknown    = static_cast<bool>(cvars.handle<int>("t_unknown"));
+	std::cout << std::boolalpha
+	          << "Handle of wrong type valid: " << wrong_type << "\n"
+	          << "Handle of unknown cvar valid: " << unknown << "\n";
+}
+
+
 void
 test_vector()
 {
@@ -457,6 +478,9 @@ main()
 		std::cout << "Standard CVAR test\n\n";
 		test_cvar();
 		std::cout << "------------------------------------\n";
+		std::cout << "Handle test\n\n";
+		test_handles();
+		std::cout << "------------------------------------\n";
 		std::cout << "Vector test\n\n";
 		test_vector();
 		std::cout << "------------------------------------\n";
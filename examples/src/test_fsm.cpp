@@ -0,0 +1,350 @@
+/*
+ * test_fsm - run finite state machines translated from genomes
+ *
+ * This compares the results of the batched runner with the results of
+ * fsm_run for all words up to a certain length.
+ */
+
+#include <iostream>
+#include <cmath>
+#include <vector>
+#include <map>
+
+#include "shared.hpp"
+
+#include <ncr/ncr_log.hpp>
+#include <ncr/ncr_random.hpp>
+#include <ncr/ncr_automata.hpp>
+#include <ncr/ncr_parallel.hpp>
+
+namespace ncr {
+	NCR_LOG_DECLARATION(new logger_policy_stdcout());
+}
+
+using namespace ncr;
+
+int
+main()
+{
+	std::mt19937_64 *rng = mkrng(1234);
+
+	size_t n_mismatches = 0;
+	size_t n_accepted   = 0;
+	size_t n_words      = 0;
+
+	for (size_t g = 0; g < 100; g++) {
+		finite_state_machine fsm;
+		fsm.alphabet = &binary_alphabet;
+		fsm.genome = random_genome(&binary_alphabet, 4, true, rng);
+		fsm_init(fsm);
+
+		// collect all words of length up to 6
+		std::vector<basic_string_t> words;
+		fsm_word_batch batch;
+		for (size_t len = 0; len <= 6; len++) {
+			for (size_t n = 0; n < std::pow(binary_alphabet.n_symbols, len); n++) {
+				words.push_back(nth_string(&binary_alphabet, len, n));
+				fsm_word_batch_push(batch, words.back());
+			}
+		}
+
+		// words with a nullptr symbol keep their slot in the batch, and yield
+		// the same result as in fsm_run
+		for (size_t n = 0; n < 64; n += 5) {
+			words.push_back(nth_string(&binary_alphabet, 6, n));
+			words.back()[n % 6] = nullptr;
+			if (fsm_word_batch_push(batch, words.back()) != fsm_run_flags::ERROR_INVALID_WORD)
+				n_mismatches++;
+		}
+		if (fsm_word_batch_size(batch) != words.size())
+			n_mismatches++;
+
+		std::vector<fsm_run_flags> flags;
+		std::vector<unsigned> lengths;
+		fsm_run_batch(fsm, batch, flags, &lengths);
+
+		fsm_run_log log;
+		for (size_t i = 0; i < words.size(); i++) {
+			fsm_reset(fsm);
+			auto result = fsm_run(fsm, words[i], log);
+			if ((result != flags[i]) || (log.accepted_length != lengths[i]))
+				n_mismatches++;
+			if (result == fsm_run_flags::OK)
+				n_accepted++;
+			n_words++;
+		}
+
+		fsm_free(fsm);
+	}
+
+	std::cout << "words: " << n_words
+		<< ", accepted: " << n_accepted
+		<< ", mismatches: " << n_mismatches << "\n";
+
+	// translate a few generations of FSMs into a shared arena, which gets
+	// released in one go at the end of each generation
+	fsm_arena arena;
+	fsm_word_batch batch;
+	for (size_t len = 0; len <= 6; len++)
+		for (size_t n = 0; n < std::pow(binary_alphabet.n_symbols, len); n++)
+			fsm_word_batch_push(batch, nth_string(&binary_alphabet, len, n));
+
+	std::vector<fsm_run_flags> flags, flags_arena;
+	for (size_t gen = 0; gen < 10; gen++) {
+		std::vector<finite_state_machine> population(50);
+		for (auto &fsm: population) {
+			fsm.alphabet = &binary_alphabet;
+			fsm.arena    = &arena;
+			fsm.genome   = random_genome(&binary_alphabet, 4, true, rng);
+			fsm_init(fsm);
+		}
+		for (auto &fsm: population) {
+			finite_state_machine ref;
+			ref.alphabet = &binary_alphabet;
+			ref.genome   = fsm.genome;
+			fsm_init(ref);
+
+			fsm_run_batch(ref, batch, flags);
+			fsm_run_batch(fsm, batch, flags_arena);
+			if (flags != flags_arena)
+				n_mismatches++;
+
+			fsm_free(ref);
+			fsm_free(fsm);
+		}
+		fsm_arena_reset(arena);
+	}
+	std::cout << "arena pages: " << arena.states.page_count()
+		<< ", mismatches: " << n_mismatches << "\n";
+
+	// evolve a population with different numbers of threads. The results must
+	// not depend on the number of threads
+	fsm_population_config config;
+	config.alphabet = &binary_alphabet;
+	config.seed     = 4321;
+
+	auto fitness_fn = [&batch](finite_state_machine &fsm, size_t) {
+		std::vector<fsm_run_flags> flags;
+		fsm_run_batch(fsm, batch, flags);
+		size_t n = 0;
+		for (auto f: flags)
+			n += (f == fsm_run_flags::OK);
+		return static_cast<double>(n) / static_cast<double>(flags.size());
+	};
+
+	std::vector<fsm_genome> initial;
+	for (size_t i = 0; i < 200; i++)
+		initial.push_back(random_genome(&binary_alphabet, 3, true, rng));
+
+	std::vector<std::vector<double>> fitnesses;
+	for (unsigned nthreads: {1u, 4u}) {
+		thread_pool pool(nthreads);
+		fsm_population_workspace workspace;
+		std::vector<fsm_genome> parents = initial, offspring;
+		std::vector<double> fitness;
+		for (size_t gen = 0; gen < 20; gen++) {
+			fsm_population_step(&pool, config, gen, parents, offspring, fitness, fitness_fn, &workspace);
+			std::swap(parents, offspring);
+		}
+		fitnesses.push_back(fitness);
+	}
+	if (fitnesses[0] != fitnesses[1])
+		n_mismatches++;
+	std::cout << "population fitness reproducible: " << std::boolalpha
+		<< (fitnesses[0] == fitnesses[1]) << "\n";
+
+	// minimize with both algorithms, and make sure that they compute the same
+	// equivalence relation
+	size_t n_minimized_states = 0;
+	size_t n_reachable_states = 0;
+	for (size_t g = 0; g < 500; g++) {
+		finite_state_machine fsm;
+		fsm.alphabet = &binary_alphabet;
+		fsm.genome   = random_genome(&binary_alphabet, 2 + g % 8, true, rng);
+		fsm_init(fsm);
+
+		auto [ss_reachable, ts_reachable] = dfa_remove_unreachable(fsm.states, fsm.transitions);
+		auto p_moore    = dfa_compute_equivalence_sets(fsm.alphabet, ss_reachable, ts_reachable);
+		auto p_hopcroft = dfa_compute_equivalence_sets_hopcroft(fsm.alphabet, ss_reachable, ts_reachable);
+		bool same = p_moore.subsets.size() == p_hopcroft.subsets.size();
+		for (size_t i = 0; same && i < ss_reachable.size(); i++)
+			for (size_t j = 0; same && j < ss_reachable.size(); j++)
+				same = (p_moore.subset_map[i] == p_moore.subset_map[j])
+					== (p_hopcroft.subset_map[i] == p_hopcroft.subset_map[j]);
+		if (!same)
+			n_mismatches++;
+
+		auto [ss_min, ts_min] = fsm_minimize(fsm, dfa_minimize_algorithm::Hopcroft);
+		n_minimized_states += ss_min.size();
+		n_reachable_states += ss_reachable.size();
+		fsm_free(fsm);
+	}
+	std::cout << "reachable states: " << n_reachable_states
+		<< ", minimized states: " << n_minimized_states
+		<< ", mismatches: " << n_mismatches << "\n";
+
+	// the cached evaluation must yield the same fitness values as the regular
+	// one, and automata with identical hashes must accept the same words
+	{
+		thread_pool pool(4);
+		fsm_population_workspace workspace;
+		fsm_fitness_cache cache;
+		std::vector<fsm_genome> parents = initial, offspring;
+		std::vector<double> fitness, fitness_cached;
+		for (size_t gen = 0; gen < 10; gen++) {
+			fsm_population_mutate(&pool, config, gen, parents, offspring);
+			fsm_population_evaluate(&pool, config, offspring, fitness, fitness_fn);
+			fsm_population_evaluate_cached(&pool, config, offspring, fitness_cached, cache, fitness_fn, &workspace);
+			if (fitness != fitness_cached)
+				n_mismatches++;
+			std::swap(parents, offspring);
+		}
+		std::cout << "fitness cache hits: " << cache.hits
+			<< ", misses: " << cache.misses
+			<< ", mismatches: " << n_mismatches << "\n";
+
+		std::map<std::uint64_t, std::vector<fsm_run_flags>> languages;
+		for (auto &genome: parents) {
+			finite_state_machine fsm;
+			fsm.alphabet = &binary_alphabet;
+			fsm.genome   = genome;
+			fsm_init(fsm);
+
+			compiled_transition_table canonical;
+			fsm_canonicalize(fsm, canonical);
+			std::vector<fsm_run_flags> flags, flags_canonical(fsm_word_batch_size(batch));
+			fsm_run_batch(fsm, batch, flags);
+			for (size_t i = 0; i < flags_canonical.size(); i++)
+				flags_canonical[i] = fsm_run_word(canonical,
+						batch.symbols.data() + batch.offsets[i],
+						batch.offsets[i + 1] - batch.offsets[i]);
+			if (flags != flags_canonical)
+				n_mismatches++;
+
+			auto h = fsm_canonical_hash(canonical);
+			if (languages.count(h) && languages[h] != flags)
+				n_mismatches++;
+			languages[h] = flags;
+			fsm_free(fsm);
+		}
+		std::cout << "distinct automata: " << languages.size()
+			<< ", mismatches: " << n_mismatches << "\n";
+	}
+
+	// complete DFAs of the same language have the same canonical form. The
+	// language 1* as partial DFA and completed with an explicit sink has two
+	// distinct canonical forms, as the runs fail differently
+	{
+		auto canonical_hash = [](std::vector<state_gene> states, std::vector<transition_gene> transitions) {
+			finite_state_machine fsm;
+			fsm.alphabet = &binary_alphabet;
+			fsm.genome   = {.states = states, .transitions = transitions};
+			fsm_init(fsm);
+			auto h = fsm_hash(fsm);
+			fsm_free(fsm);
+			return h;
+		};
+		const auto start = automaton_state_flags::IS_START;
+		const auto final = automaton_state_flags::IS_FINAL;
+		const auto none  = automaton_state_flags::DEFAULT;
+
+		// words that end in 1, with and without a duplicated final state
+		auto h_ends_in_1 = canonical_hash(
+			{{.id = 0, .label = '0', .flag = start}, {.id = 1, .label = '1', .flag = final}},
+			{{0, 0, 0, 0}, {0, 1, 1, 1}, {1, 0, 0, 0}, {1, 1, 1, 1}});
+		auto h_ends_in_1_dup = canonical_hash(
+			{{.id = 0, .label = '0', .flag = start}, {.id = 1, .label = '1', .flag = final}, {.id = 2, .label = '2', .flag = final}},
+			{{0, 0, 0, 0}, {0, 1, 2, 1}, {1, 0, 0, 0}, {1, 1, 2, 1}, {2, 0, 0, 0}, {2, 1, 1, 1}});
+		if (h_ends_in_1 != h_ends_in_1_dup)
+			n_mismatches++;
+
+		auto h_partial = canonical_hash(
+			{{.id = 0, .label = '0', .flag = start | final}},
+			{{0, 1, 0, 1}});
+		auto h_sink = canonical_hash(
+			{{.id = 0, .label = '0', .flag = start | final}, {.id = 1, .label = '1', .flag = none}},
+			{{0, 0, 1, 0}, {0, 1, 0, 1}, {1, 0, 1, 0}, {1, 1, 1, 1}});
+		if (h_partial == h_sink)
+			n_mismatches++;
+		std::cout << "canonical forms of complete and partial DFAs, mismatches: " << n_mismatches << "\n";
+	}
+
+	// packed words must yield the same results as words of symbols. Complete
+	// automata run over entire words, which cross 64 bit boundaries
+	{
+		constexpr unsigned B = symbol_bits(binary_alphabet.n_symbols);
+		fsm_packed_batch<B> packed;
+		fsm_packed_batch<4> packed4;
+		fsm_word_batch words;
+		for (size_t i = 0; i < 200; i++) {
+			auto word = random_string(rng, &binary_alphabet, i);
+			fsm_word_batch_push(words, word);
+			fsm_packed_batch_push(packed, word);
+			fsm_packed_batch_push(packed4, word);
+		}
+
+		// words with a nullptr symbol are appended as invalid placeholders,
+		// which must give the same results in all batches
+		for (size_t i = 0; i < 20; i++) {
+			auto invalid = random_string(rng, &binary_alphabet, 10);
+			invalid[i % 10] = nullptr;
+			if (fsm_word_batch_push(words, invalid) != fsm_run_flags::ERROR_INVALID_WORD
+			    || fsm_packed_batch_push(packed, invalid) != fsm_run_flags::ERROR_INVALID_WORD
+			    || fsm_packed_batch_push(packed4, invalid) != fsm_run_flags::ERROR_INVALID_WORD)
+				n_mismatches++;
+		}
+		if (fsm_word_batch_size(words) != 220 || fsm_packed_batch_size(packed) != 220)
+			n_mismatches++;
+
+		size_t n_packed_words = 0;
+		for (size_t g = 0; g < 50; g++) {
+			finite_state_machine fsm;
+			fsm.alphabet = &binary_alphabet;
+			fsm.genome   = random_genome(&binary_alphabet, 2 + g % 6, true, rng);
+			if (g % 2) {
+				fsm.genome.transitions.clear();
+				for (size_t k = 0; k < fsm.genome.states.size(); k++)
+					for (size_t j = 0; j < binary_alphabet.n_symbols; j++)
+						fsm.genome.transitions.push_back({
+							.state_from   = k,
+							.symbol_read  = binary_alphabet.symbols[j].id,
+							.state_to     = choice<size_t>(0, fsm.genome.states.size() - 1, rng),
+							.symbol_write = binary_alphabet.symbols[j].id,
+						});
+				sort(fsm.genome);
+			}
+			fsm_init(fsm);
+
+			std::vector<fsm_run_flags> flags, flags_packed, flags_packed4;
+			std::vector<unsigned> lengths, lengths_packed, lengths_packed4;
+			fsm_run_batch(fsm, words, flags, &lengths);
+			fsm_run_batch(fsm, packed, flags_packed, &lengths_packed);
+			fsm_run_batch(fsm, packed4, flags_packed4, &lengths_packed4);
+			if (flags != flags_packed || lengths != lengths_packed
+			    || flags != flags_packed4 || lengths != lengths_packed4)
+				n_mismatches++;
+
+			packed_word<B> word;
+			for (size_t i = 0; i < 200; i += 17) {
+				nth_string(&binary_alphabet, 64, i * 0x9e3779b97f4a7c15ull, word);
+				unsigned length;
+				auto result = fsm_run(fsm, word, &length);
+				fsm_word_batch single;
+				fsm_word_batch_push(single, unpack_str(word, &binary_alphabet));
+				unsigned expected_length;
+				auto expected = fsm_run_word(fsm.compiled_table, single.symbols.data(), 64, &expected_length);
+				if (result != expected || length != expected_length)
+					n_mismatches++;
+				n_packed_words++;
+			}
+			fsm_free(fsm);
+		}
+		std::cout << "packed words: " << n_packed_words + 220 * 50
+			<< ", bytes per 220 words: " << words.symbols.size() * sizeof(symbol_id_t)
+			<< " vs " << packed.symbols.data.size() * sizeof(std::uint64_t)
+			<< ", mismatches: " << n_mismatches << "\n";
+	}
+
+	delete rng;
+	return n_mismatches == 0 ? 0 : 1;
+}
@@ -0,0 +1,198 @@
+#include <iostream>
+#include <vector>
+#include <random>
+#include <cmath>
+#include <cassert>
+#include <algorithm>
+
+#include <ncr/ncr_geometry.hpp>
+
+namespace ncr {
+	NCR_LOG_DECLARATION(new logger_policy_stdcout());
+}
+
+using namespace ncr;
+
+
+// brute force reference of bvh_closest_hit
+static bool
+closest_hit_reference(const std::vector<triangle> &tris, const ray &r, ray_hit &hit)
+{
+	hit = ray_hit();
+	for (size_t i = 0; i < tris.size(); i++) {
+		float t, u, v;
+		if (intersect(r, tris[i], hit.t, t, u, v)) {
+			hit.t = t;
+			hit.prim = std::uint32_t(i);
+			hit.id = tris[i].id;
+		}
+	}
+	return hit.prim != ~std::uint32_t(0);
+}
+
+
+// random walls in a 100 x 100 arena, surrounded by a box
+static std::vector<triangle>
+make_scene(std::mt19937 &rng, size_t n_walls)
+{
+	std::uniform_real_distribution<float> pos(0.0f, 100.0f);
+	std::uniform_real_distribution<float> len(-3.0f, 3.0f);
+	std::vector<triangle> tris;
+	for (size_t i = 0; i < n_walls; i++) {
+		const Vec3f x0 = {pos(rng), pos(rng), 0.0f};
+		const Vec3f x1 = {x0.x + len(rng), x0.y + len(rng), 0.0f};
+		add_wall(tris, x0, x1, 0.5f, std::uint32_t(i));
+	}
+	add_box(tris, {-1.0f, -1.0f, 0.0f}, {101.0f, 101.0f, 0.0f}, 0.5f, std::uint32_t(n_walls));
+	return tris;
+}
+
+
+static std::vector<ray>
+make_rays(std::mt19937 &rng, size_t n)
+{
+	std::uniform_real_distribution<float> pos(0.0f, 100.0f);
+	std::uniform_real_distribution<float> angle(0.0f, 2.0f * float(M_PI));
+	std::vector<ray> rays;
+	for (size_t i = 0; i < n; i++) {
+		const float a = angle(rng);
+		rays.push_back(ray{{pos(rng), pos(rng), 0.25f}, {std::cos(a), std::sin(a), 0.0f}});
+	}
+	// axis aligned rays exercise the degenerate slabs of walls
+	rays.push_back(ray{{50.0f, 50.0f, 0.25f}, {1.0f, 0.0f, 0.0f}});
+	rays.push_back(ray{{50.0f, 50.0f, 0.25f}, {0.0f, -1.0f, 0.0f}});
+	return rays;
+}
+
+
+static void
+check_scene(const bvh &tree, const std::vector<triangle> &tris, const std::vector<ray> &rays)
+{
+	for (const auto &r: rays) {
+		ray_hit hit, ref;
+		const bool found = bvh_closest_hit(tree, r, hit);
+		[[maybe_unused]] const bool found_ref = closest_hit_reference(tris, r, ref);
+		assert(found == found_ref);
+		assert(!found || std::abs(hit.t - ref.t) <= 1e-5f * ref.t);
+		assert(!found || tris[hit.prim].id == hit.id);
+
+		// nothing is hit before the closest hit, but just after
+		ray shorter = r;
+		shorter.tmax = found ? 0.999f * hit.t : 1e30f;
+		[[maybe_unused]] const bool hit_shorter = bvh_any_hit(tree, shorter);
+		assert(!hit_shorter);
+		ray longer = r;
+		longer.tmax = found ? 1.001f * hit.t : 1e30f;
+		[[maybe_unused]] const bool hit_longer = bvh_any_hit(tree, longer);
+		assert(hit_longer == found);
+	}
+}
+
+
+void
+test_bvh()
+{
+	std::mt19937 rng(1234);
+	auto tris = make_scene(rng, 2000);
+	auto rays = make_rays(rng, 2000);
+
+	bvh tree;
+	[[maybe_unused]] bool ok = bvh_build(tree, tris);
+	assert(ok);
+	assert(tree.size() == tris.size());
+	[[maybe_unused]] const auto n_oversized = std::count_if(tree.nodes.begin(), tree.nodes.end(), [&](const auto &node) {
+		return node.is_leaf() && node.count > tree.max_leaf_size;
+	});
+	assert(n_oversized == 0);
+	check_scene(tree, tris, rays);
+
+	// move all walls and refit
+	for (auto &t: tris)
+		for (Vec3f *p: {&t.a, &t.b, &t.c})
+			*p = *p + Vec3f{0.1f * std::sin(p->y), 0.1f * std::cos(p->x), 0.0f};
+	ok = bvh_refit(tree, tris);
+	assert(ok);
+	check_scene(tree, tris, rays);
+	ok = bvh_refit(tree, std::span<const triangle>(tris).first(3));
+	assert(!ok);
+
+	// empty scene
+	bvh empty;
+	ray_hit hit;
+	ok = bvh_build(empty, std::vector<triangle>{});
+	assert(ok);
+	ok = bvh_closest_hit(empty, rays[0], hit);
+	assert(!ok && !bvh_any_hit(empty, rays[0]));
+
+	std::cout << "bvh: " << tree.nodes.size() << " nodes over " << tree.size() << " triangles, "
+	          << rays.size() << " rays match brute force" << std::endl;
+}
+
+
+void
+test_packets()
+{
+	std::mt19937 rng(4321);
+	auto tris = make_scene(rng, 2000);
+	bvh tree;
+	bvh_build(tree, tris);
+
+	std::uniform_real_distribution<float> pos(0.0f, 100.0f);
+	size_t n_rays = 0;
+	for (unsigned k = 0; k < 50; k++) {
+		// full sweeps and narrow fans, with sizes that are not a multiple of
+		// the packet width
+		const Vec3f origin = {pos(rng), pos(rng), 0.25f};
+		ray_packet packet = k % 2 ? ray_packet_fan(origin, pos(rng), 2.0f * float(M_PI), 96)
+		                          : ray_packet_fan(origin, pos(rng), 0.5f, 37, 20.0f);
+		n_rays += packet.size();
+
+		ray_packet_hits hits, brute;
+		bvh_closest_hit(tree, packet, hits);
+		intersect(packet, tris, brute);
+		std::vector<std::uint8_t> occluded(packet.size());
+		[[maybe_unused]] const bool any_occluded = bvh_any_hit(tree, packet, occluded);
+		assert(any_occluded);
+
+		for (size_t i = 0; i < packet.size(); i++) {
+			const ray r = packet.get(i);
+			ray_hit ref;
+			const bool found = bvh_closest_hit(tree, r, ref);
+			assert(found == (hits.prim[i] != ~std::uint32_t(0)));
+			assert(found == (brute.prim[i] != ~std::uint32_t(0)));
+			assert(found == bool(occluded[i]));
+			if (!found)
+				continue;
+			assert(std::abs(hits.t[i] - ref.t) <= 1e-5f * ref.t);
+			assert(std::abs(brute.t[i] - ref.t) <= 1e-5f * ref.t);
+			assert(tris[hits.prim[i]].id == hits.id[i] && tris[brute.prim[i]].id == brute.id[i]);
+		}
+	}
+
+	// boxes, one of which contains the origin of the packet
+	std::vector<aabb> boxes = {
+		{{  2.0f,  -1.0f, -1.0f}, { 3.0f,  1.0f, 1.0f}},
+		{{ -1.0f,   5.0f, -1.0f}, { 1.0f,  6.0f, 1.0f}},
+		{{-10.0f, -10.0f, -1.0f}, {10.0f, 10.0f, 1.0f}},
+	};
+	ray_packet packet = ray_packet_fan({0.0f, 0.0f, 0.0f}, 0.0f, 2.0f * float(M_PI), 4);
+	ray_packet_hits hits;
+	intersect(packet, boxes, hits);
+	assert(hits.id[0] == 0 && std::abs(hits.t[0] - 2.0f) < 1e-5f);
+	assert(hits.id[1] == 1 && std::abs(hits.t[1] - 5.0f) < 1e-5f);
+	assert(hits.id[2] == 2 && std::abs(hits.t[2] - 10.0f) < 1e-5f);
+	assert(hits.id[3] == 2 && std::abs(hits.t[3] - 10.0f) < 1e-5f);
+	packet.tmax = 8.0f;
+	intersect(packet, boxes, hits);
+	assert(hits.id[0] == 0 && hits.id[1] == 1 && hits.prim[2] == ~std::uint32_t(0));
+
+	std::cout << "ray packets: " << n_rays << " rays match single ray queries" << std::endl;
+}
+
+
+int main()
+{
+	test_bvh();
+	test_packets();
+	return 0;
+}
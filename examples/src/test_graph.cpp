@@ -0,0 +1,198 @@
+/*
+ * test_graph - CSR graphs and graph edit distance
+ *
+ * This compares the exact GED against a brute force enumeration of all vertex
+ * mappings on small random graphs, checks that the beam search yields an upper
+ * bound, and that the parallel all-pairs mode matches the sequential one.
+ */
+
+#include <iostream>
+#include <vector>
+#include <cmath>
+
+#include "shared.hpp"
+
+#include <ncr/ncr_log.hpp>
+#include <ncr/ncr_random.hpp>
+#include <ncr/ncr_automata.hpp>
+#include <ncr/ncr_parallel.hpp>
+#include <ncr/ncr_graph.hpp>
+
+namespace ncr {
+	NCR_LOG_DECLARATION(new logger_policy_stdcout());
+}
+
+using namespace ncr;
+
+
+graph
+random_graph(size_t n, double p, std::mt19937_64 *rng)
+{
+	std::uniform_real_distribution<double> uniform(0.0, 1.0);
+	std::vector<std::uint32_t> labels(n);
+	for (auto &l : labels)
+		l = uniform(*rng) < 0.5 ? 0 : 1;
+	std::vector<graph_edge> edges;
+	for (std::uint32_t u = 0; u < n; u++)
+		for (std::uint32_t v = 0; v < n; v++)
+			if (uniform(*rng) < p)
+				edges.push_back({.from = u, .to = v, .label = uniform(*rng) < 0.5 ? 0u : 1u});
+	return make_graph(n, edges, labels);
+}
+
+
+/*
+ * total cost of a complete mapping of g1 to g2, evaluated edge by edge
+ */
+double
+mapping_cost(const graph &g1, const graph &g2, const std::vector<size_t> &image, const ged_costs &c)
+{
+	const size_t npos = ged_result::npos;
+	const size_t n1 = graph_num_vertices(g1), n2 = graph_num_vertices(g2);
+
+	std::vector<bool> used(n2, false);
+	double cost = 0.0;
+	for (size_t u = 0; u < n1; u++) {
+		if (image[u] == npos)
+			cost += c.vertex_deletion;
+		else {
+			used[image[u]] = true;
+			if (g1.vertex_labels[u] != g2.vertex_labels[image[u]])
+				cost += c.vertex_substitution;
+		}
+	}
+	for (size_t v = 0; v < n2; v++)
+		if (!used[v])
+			cost += c.vertex_insertion;
+
+	// edges of g1, compared to the edges between the images
+	for (size_t a = 0; a < n1; a++) {
+		for (size_t b = 0; b < n1; b++) {
+			auto l1 = graph_edge_labels(g1, a, b);
+			if (image[a] == npos || image[b] == npos)
+				cost += double(l1.size()) * c.edge_deletion;
+			else
+				cost += __ged_multiset_cost(l1, graph_edge_labels(g2, image[a], image[b]), c);
+		}
+	}
+
+	// edges of g2 with at least one inserted vertex
+	for (size_t a = 0; a < n2; a++)
+		for (size_t b = 0; b < n2; b++)
+			if (!used[a] || !used[b])
+				cost += double(graph_edge_labels(g2, a, b).size()) * c.edge_insertion;
+	return cost;
+}
+
+
+double
+brute_force_ged(const graph &g1, const graph &g2, const ged_costs &c)
+{
+	const size_t npos = ged_result::npos;
+	const size_t n1 = graph_num_vertices(g1), n2 = graph_num_vertices(g2);
+
+	double best = INFINITY;
+	std::vector<size_t> image(n1, npos);
+	std::vector<bool> used(n2, false);
+	auto recurse = [&](auto &self, size_t u) -> void {
+		if (u == n1) {
+			best = std::min(best, mapping_cost(g1, g2, image, c));
+			return;
+		}
+		image[u] = npos;
+		self(self, u + 1);
+		for (size_t v = 0; v < n2; v++) {
+			if (used[v])
+				continue;
+			used[v] = true;
+			image[u] = v;
+			self(self, u + 1);
+			used[v] = false;
+		}
+		image[u] = npos;
+	};
+	recurse(recurse, 0);
+	return best;
+}
+
+
+bool
+test_exact_ged()
+{
+	std::mt19937_64 *rng = mkrng(1234);
+	const ged_costs costs = {.vertex_substitution = 1.0, .vertex_insertion = 2.0, .vertex_deletion = 1.5,
+	                         .edge_substitution = 0.5, .edge_insertion = 1.0, .edge_deletion = 1.0};
+
+	size_t n_pairs = 0, n_mismatches = 0, n_beam_violations = 0;
+	for (size_t i = 0; i < 200; i++) {
+		std::uniform_int_distribution<size_t> size(0, 5);
+		graph g1 = random_graph(size(*rng), 0.3, rng);
+		graph g2 = random_graph(size(*rng), 0.3, rng);
+
+		const double expected = brute_force_ged(g1, g2, costs);
+		auto exact = graph_edit_distance(g1, g2, {.costs = costs});
+		auto beam  = graph_edit_distance(g1, g2, {.costs = costs, .beam_width = 2});
+
+		// the returned mapping must realize the returned distance
+		if (!exact.exact
+		    || std::abs(exact.distance - expected) > 1e-9
+		    || std::abs(mapping_cost(g1, g2, exact.mapping, costs) - exact.distance) > 1e-9)
+			n_mismatches++;
+		if (beam.distance < expected - 1e-9
+		    || std::abs(mapping_cost(g1, g2, beam.mapping, costs) - beam.distance) > 1e-9)
+			n_beam_violations++;
+		n_pairs++;
+	}
+	std::cout << "ged: " << n_pairs << " pairs, " << n_mismatches << " mismatches, "
+	          << n_beam_violations << " beam violations\n";
+	delete rng;
+	return n_mismatches == 0 && n_beam_violations == 0;
+}
+
+
+bool
+test_fsm_all_pairs()
+{
+	std::mt19937_64 *rng = mkrng(4321);
+
+	std::vector<finite_state_machine> fsms(12);
+	std::vector<graph> graphs;
+	for (auto &fsm : fsms) {
+		fsm.alphabet = &binary_alphabet;
+		fsm.genome = random_genome(&binary_alphabet, 5, true, rng);
+		fsm_init(fsm);
+		graphs.push_back(make_graph(fsm));
+	}
+
+	ged_options opts;
+	opts.max_expansions = 200000;
+	auto D_seq = ged_all_pairs(graphs, opts);
+	thread_pool pool(4);
+	auto D_par = ged_all_pairs(graphs, opts, &pool);
+
+	double sum = 0.0;
+	bool ok = D_seq == D_par;
+	for (size_t i = 0; i < graphs.size(); i++) {
+		ok = ok && D_seq[i * graphs.size() + i] == 0.0;
+		for (size_t j = 0; j < graphs.size(); j++)
+			sum += D_seq[i * graphs.size() + j];
+	}
+	std::cout << "fsm all pairs: " << graphs.size() << " automata, mean distance "
+	          << sum / double(graphs.size() * (graphs.size() - 1)) << ", "
+	          << (ok ? "identical" : "DIFFERENT") << " in parallel\n";
+
+	for (auto &fsm : fsms)
+		fsm_free(fsm);
+	delete rng;
+	return ok;
+}
+
+
+int
+main()
+{
+	bool ok = true;
+	ok = test_exact_ged()     && ok;
+	ok = test_fsm_all_pairs() && ok;
+	return ok ? 0 : 1;
+}
@@ -1,5 +1,11 @@
 #include <iostream>
 #include <type_traits>
+#include <vector>
+#include <string>
+#include <thread>
+#include <atomic>
+#include <cassert>
+#include <cstdio>
 
 // #include "shared.hpp"
 
@@ -11,6 +17,109 @@ namespace ncr {
 }
 
 
+/*
+ * recording_policy - policy that stores all messages it receives
+ *
+ * If gated is set, the policy blocks in the first message until open is set.
+ */
+struct recording_policy : ncr::logger_policy
+{
+	std::vector<std::string> *messages;
+	bool                      gated = false;
+	std::atomic<bool>         entered = false;
+	std::atomic<bool>         open = false;
+
+	recording_policy(std::vector<std::string> *_messages, bool _gated = false)
+	: messages(_messages), gated(_gated) {}
+
+	void
+	record(const std::string &msg)
+	{
+		if (gated && messages->empty()) {
+			entered.store(true);
+			entered.notify_all();
+			open.wait(false);
+		}
+		messages->push_back(msg);
+	}
+
+	void init()     override {}
+	void finalize() override {}
+
+	void log_error(const std::string &msg)   override { record("E:" + msg); }
+	void log_warning(const std::string &msg) override { record("W:" + msg); }
+	void log_debug(const std::string &msg)   override { record("D:" + msg); }
+	void log_verbose(const std::string &msg) override { record("V:" + msg); }
+};
+
+
+void
+test_async_policy()
+{
+	const unsigned n_threads = 4;
+	const unsigned n_msgs    = 5000;
+
+	std::vector<std::string> messages;
+	{
+		// small buffer to exercise blocking producers
+		ncr::logger log(new ncr::logger_policy_async(new recording_policy(&messages), 64));
+
+		std::vector<std::thread> threads;
+		for (unsigned t = 0; t < n_threads; t++)
+			threads.emplace_back([&log, t]{
+				for (unsigned i = 0; i < n_msgs; i++)
+					log.log<ncr::log_level::Debug>(t, ' ', i);
+			});
+		for (auto &t: threads)
+			t.join();
+
+		// a message longer than the inline capacity
+		log.log<ncr::log_level::Error>(std::string(1000, 'x'));
+	}
+
+	// all messages arrived, and those of each thread in order
+	assert(messages.size() == n_threads * n_msgs + 1);
+	std::vector<unsigned> next(n_threads, 0);
+	for (size_t i = 0; i + 1 < messages.size(); i++) {
+		unsigned t = 0, k = 0;
+		[[maybe_unused]] const int n_parsed = std::sscanf(messages[i].c_str(), "D:%u %u", &t, &k);
+		assert(n_parsed == 2);
+		assert(t < n_threads && next[t] == k);
+		next[t] += 1;
+	}
+	assert(messages.back() == "E:" + std::string(1000, 'x'));
+	std::cout << "async policy: " << messages.size() << " messages\n";
+}
+
+
+void
+test_async_drop()
+{
+	std::vector<std::string> messages;
+	auto *sink = new recording_policy(&messages, true);
+	ncr::logger_policy_async policy(sink, 8, ncr::log_overflow::Drop);
+	policy.init();
+
+	// the background thread holds the first message in the sink, so that
+	// exactly capacity messages fit into the buffer
+	policy.push(ncr::log_level::Warning, "first");
+	sink->entered.wait(false);
+	unsigned accepted = 0;
+	for (unsigned i = 0; i < policy.capacity() + 5; i++)
+		accepted += policy.push(ncr::log_level::Verbose, std::to_string(i));
+	assert(accepted == policy.capacity());
+	assert(policy.dropped() == 5);
+
+	sink->open.store(true);
+	sink->open.notify_all();
+	policy.flush();
+	assert(messages.size() == policy.capacity() + 1);
+	assert(messages.front() == "W:first" && messages.back() == "V:7");
+	policy.finalize();
+	std::cout << "async drop: " << policy.dropped() << " dropped\n";
+}
+
+
 int main()
 {
 
@@ -19,7 +128,8 @@ int main()
 	ncr::log_debug("log_debug\n");
 	ncr::log_verbose("log_verbose\n");
 
+	test_async_policy();
+	test_async_drop();
 
 	return 0;
 }
-
@@ -0,0 +1,286 @@
+/*
+ * test_matrix - round trips of the aligned matrix file format
+ */
+
+#include <iostream>
+#include <fstream>
+#include <filesystem>
+#include <vector>
+#include <cstring>
+#include <type_traits>
+
+#include <ncr/ncr_matrix.hpp>
+
+using namespace ncr::matrix::io;
+
+using rowmajor_t = Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+using colmajor_t = Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::ColMajor>;
+
+
+/*
+ * __tmpfile - path of a temporary file for the tests
+ */
+std::string
+__tmpfile(const std::string &name)
+{
+	return (std::filesystem::temp_directory_path() / ("ncr_test_matrix_" + name)).string();
+}
+
+
+/*
+ * __read_file, __write_file - raw access to manipulate files
+ */
+std::vector<char>
+__read_file(const std::string &filename)
+{
+	std::ifstream in(filename, std::ios::binary);
+	return {std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>()};
+}
+
+void
+__write_file(const std::string &filename, const std::vector<char> &bytes)
+{
+	std::ofstream out(filename, std::ios::binary | std::ios::trunc);
+	out.write(bytes.data(), std::streamsize(bytes.size()));
+}
+
+
+/*
+ * matrices written in one storage order must be read back into either order,
+ * and mapped in the order of the file
+ */
+bool
+test_matrix_roundtrip()
+{
+	const std::string fname = __tmpfile("roundtrip.bin");
+	colmajor_t A = colmajor_t::Random(17, 5);
+	rowmajor_t B = A;
+	bool ok = true;
+
+	// column-major file into row-major and column-major matrices
+	ok = ok && write_dense_aligned(fname, A) == status::Success;
+	rowmajor_t R;
+	colmajor_t C;
+	ok = ok && read_dense_aligned(fname, R) == status::Success && R == A;
+	ok = ok && read_dense_aligned(fname, C) == status::Success && C == A;
+	{
+		mapped_dense<double> m;
+		ok = ok && m.open(fname) == status::Success;
+		ok = ok && m.order() == storage_order::ColMajor && m.map<Eigen::ColMajor>() == A;
+		ok = ok && *m.ptr(3, 2) == A(3, 2) && m.data() + m.col_stride() == m.ptr(0, 1);
+	}
+
+	// row-major file, written with a different alignment
+	ok = ok && write_dense_aligned(fname, B, 4096) == status::Success;
+	ok = ok && read_dense_aligned(fname, C) == status::Success && C == A;
+	ok = ok && read_dense_aligned(fname, R) == status::Success && R == A;
+	{
+		mapped_dense<double> m;
+		ok = ok && m.open(fname) == status::Success;
+		ok = ok && m.order() == storage_order::RowMajor && m.map<Eigen::RowMajor>() == A;
+		ok = ok && reinterpret_cast<std::uintptr_t>(m.data()) % 4096 == 0;
+		ok = ok && m.data() + m.row_stride() == m.ptr(1, 0);
+	}
+
+	// the element type must match
+	{
+		mapped_dense<float> m;
+		Eigen::MatrixXf F;
+		ok = ok && m.open(fname) == status::ErrorType && !m.is_open();
+		ok = ok && read_dense_aligned(fname, F) == status::ErrorType;
+	}
+
+	std::filesystem::remove(fname);
+	std::cout << "matrix round trip: " << (ok ? "ok" : "FAILED") << "\n";
+	return ok;
+}
+
+
+/*
+ * dense_writer appends blocks of rows or columns, possibly with a different
+ * storage order than the file, and rejects incomplete or excess data
+ */
+bool
+test_matrix_append()
+{
+	const std::string fname = __tmpfile("append.bin");
+	rowmajor_t A = rowmajor_t::Random(12, 7);
+	bool ok = true;
+
+	// row-major file from blocks of rows of a column-major matrix
+	{
+		colmajor_t Ac = A;
+		dense_writer<double> writer;
+		ok = ok && writer.open(fname, 12, 7, storage_order::RowMajor) == status::Success;
+		for (Eigen::Index r = 0; r < 12; r += 4)
+			ok = ok && writer.append(Ac.middleRows(r, 4)) == status::Success;
+		ok = ok && writer.append(Ac.middleRows(0, 1)) == status::WriteError;
+		ok = ok && writer.written() == writer.size() && writer.close() == status::Success;
+
+		colmajor_t C;
+		ok = ok && read_dense_aligned(fname, C) == status::Success && C == A;
+	}
+
+	// column-major file from single columns and raw elements
+	{
+		dense_writer<double> writer;
+		ok = ok && writer.open(fname, 12, 7, storage_order::ColMajor) == status::Success;
+		for (Eigen::Index c = 0; c < 6; c++)
+			ok = ok && writer.append(A.col(c)) == status::Success;
+		// rows of the wrong length are rejected
+		ok = ok && writer.append(A.row(0)) == status::WriteError;
+		colmajor_t last = A.col(6);
+		ok = ok && writer.append(last.data(), 12) == status::Success;
+		ok = ok && writer.close() == status::Success;
+
+		mapped_dense<double> m;
+		ok = ok && m.open(fname) == status::Success && m.map<Eigen::ColMajor>() == A;
+	}
+
+	// closing early reports the incomplete file
+	{
+		dense_writer<double> writer;
+		ok = ok && writer.open(fname, 12, 7, storage_order::RowMajor) == status::Success;
+		ok = ok && writer.append(A.topRows(3)) == status::Success;
+		ok = ok && writer.close() == status::WriteError;
+
+		rowmajor_t R;
+		mapped_dense<double> m;
+		ok = ok && read_dense_aligned(fname, R) == status::ErrorHeader;
+		ok = ok && m.open(fname) == status::ErrorHeader;
+	}
+
+	std::filesystem::remove(fname);
+	std::cout << "matrix append: " << (ok ? "ok" : "FAILED") << "\n";
+	return ok;
+}
+
+
+/*
+ * damaged files must be rejected before any data is touched
+ */
+bool
+test_matrix_corrupt()
+{
+	const std::string fname = __tmpfile("corrupt.bin");
+	colmajor_t A = colmajor_t::Random(9, 9);
+	bool ok = write_dense_aligned(fname, A) == status::Success;
+	const std::vector<char> bytes = __read_file(fname);
+
+	auto rejects = [&](const std::vector<char> &damaged, status expected) {
+		__write_file(fname, damaged);
+		colmajor_t C;
+		mapped_dense<double> m;
+		return read_dense_aligned(fname, C) == expected && m.open(fname) == expected && !m.is_open();
+	};
+
+	// truncated header, and truncated data
+	ok = ok && rejects(std::vector<char>(bytes.begin(), bytes.begin() + 40), status::ErrorHeader);
+	ok = ok && rejects(std::vector<char>(bytes.begin(), bytes.end() - 8), status::ErrorHeader);
+
+	// wrong magic, unknown version, and a data offset within the header
+	std::vector<char> damaged = bytes;
+	damaged[0] = 'X';
+	ok = ok && rejects(damaged, status::ErrorHeader);
+
+	damaged = bytes;
+	damaged[offsetof(dense_header, version)] = 7;
+	ok = ok && rejects(damaged, status::ErrorHeader);
+
+	damaged = bytes;
+	std::uint64_t offset = 8;
+	std::memcpy(damaged.data() + offsetof(dense_header, data_offset), &offset, sizeof(offset));
+	ok = ok && rejects(damaged, status::ErrorHeader);
+
+	// rows * cols * elem_size overflows
+	damaged = bytes;
+	std::uint64_t huge = std::uint64_t(1) << 62;
+	std::memcpy(damaged.data() + offsetof(dense_header, rows), &huge, sizeof(huge));
+	std::memcpy(damaged.data() + offsetof(dense_header, cols), &huge, sizeof(huge));
+	ok = ok && rejects(damaged, status::ErrorHeader);
+
+	// garbage in the byte order field
+	damaged = bytes;
+	damaged[offsetof(dense_header, byte_order)] = 0x55;
+	ok = ok && rejects(damaged, status::ErrorHeader);
+
+	// a file of the other byte order is converted by read_dense_aligned, but
+	// cannot be mapped
+	damaged = bytes;
+	auto swap_field = [&](size_t offset, size_t size) {
+		std::reverse(damaged.begin() + offset, damaged.begin() + offset + size);
+	};
+	swap_field(offsetof(dense_header, byte_order),  sizeof(std::uint32_t));
+	swap_field(offsetof(dense_header, version),     sizeof(std::uint16_t));
+	swap_field(offsetof(dense_header, elem_size),   sizeof(std::uint32_t));
+	swap_field(offsetof(dense_header, alignment),   sizeof(std::uint32_t));
+	swap_field(offsetof(dense_header, rows),        sizeof(std::uint64_t));
+	swap_field(offsetof(dense_header, cols),        sizeof(std::uint64_t));
+	swap_field(offsetof(dense_header, data_offset), sizeof(std::uint64_t));
+	for (size_t i = __dense_data_offset(64); i < damaged.size(); i += sizeof(double))
+		swap_field(i, sizeof(double));
+	__write_file(fname, damaged);
+	{
+		colmajor_t C;
+		mapped_dense<double> m;
+		ok = ok && read_dense_aligned(fname, C) == status::Success && C == A;
+		ok = ok && m.open(fname) == status::ErrorByteOrder;
+	}
+
+	std::filesystem::remove(fname);
+	std::cout << "matrix corrupt files: " << (ok ? "ok" : "FAILED") << "\n";
+	return ok;
+}
+
+
+/*
+ * read-only mappings expose only const data, writable mappings change either
+ * the file (Shared) or only the process' copy (Private)
+ */
+bool
+test_matrix_mmap_modes()
+{
+	const std::string fname = __tmpfile("modes.bin");
+	colmajor_t A = colmajor_t::Random(6, 4);
+	bool ok = write_dense_aligned(fname, A) == status::Success;
+
+	static_assert(std::is_same_v<decltype(std::declval<const mapped_dense<double>&>().data()), const double*>);
+	static_assert(std::is_same_v<decltype(std::declval<mapped_dense<double>&>().ptr(0, 0)), const double*>);
+
+	{
+		mapped_dense<double> m;
+		ok = ok && m.open(fname, mmap_mode::ReadOnly) == status::Success;
+		ok = ok && !m.writable() && m.data() && !m.data_mutable() && !m.ptr_mutable(1, 1);
+	}
+	{
+		mapped_dense<double> m;
+		ok = ok && m.open(fname, mmap_mode::Private) == status::Success && m.writable();
+		*m.ptr_mutable(1, 2) = -1.0;
+		ok = ok && m.map()(1, 2) == -1.0;
+	}
+	colmajor_t C;
+	ok = ok && read_dense_aligned(fname, C) == status::Success && C == A;
+	{
+		mapped_dense<double> m;
+		ok = ok && m.open(fname, mmap_mode::Shared) == status::Success && m.writable();
+		m.map_mutable()(1, 2) = -1.0;
+	}
+	A(1, 2) = -1.0;
+	ok = ok && read_dense_aligned(fname, C) == status::Success && C == A;
+
+	std::filesystem::remove(fname);
+	std::cout << "matrix mmap modes: " << (ok ? "ok" : "FAILED") << "\n";
+	return ok;
+}
+
+
+int
+main()
+{
+	bool ok = true;
+	ok = test_matrix_roundtrip() && ok;
+	ok = test_matrix_append() && ok;
+	ok = test_matrix_corrupt() && ok;
+	ok = test_matrix_mmap_modes() && ok;
+	return ok ? 0 : 1;
+}
@@ -0,0 +1,303 @@
+/*
+ * test_memory - slab and concurrent slab memory
+ */
+
+#include <iostream>
+#include <vector>
+#include <thread>
+#include <algorithm>
+#include <cstring>
+
+#include <ncr/ncr_memory.hpp>
+
+using namespace ncr;
+
+
+/*
+ * __run_workers - run fn(worker) on n_workers threads and wait for them
+ */
+template <typename Fn>
+void
+__run_workers(unsigned n_workers, Fn &&fn)
+{
+	std::vector<std::thread> threads;
+	for (unsigned w = 0; w < n_workers; w++)
+		threads.emplace_back(fn, w);
+	for (auto &t : threads)
+		t.join();
+}
+
+
+/*
+ * several workers allocate, release their own and each other's items, and
+ * allocate again. Slots released by other workers must be reclaimed by their
+ * owner, so that no additional pages are required
+ */
+bool
+test_concurrent_slab()
+{
+	const unsigned n_workers = 4;
+	const size_t   n_items   = 10000;
+
+	concurrent_slab_memory<size_t> mem(n_workers, 256);
+	std::vector<std::vector<slab_memory_index_t>> ids(n_workers);
+
+	__run_workers(n_workers, [&](unsigned w) {
+		for (size_t i = 0; i < n_items; i++) {
+			auto id = mem.alloc(w).value();
+			*mem.get(id).value() = w * n_items + i;
+			ids[w].push_back(id);
+		}
+	});
+	const size_t n_pages = mem.page_count();
+
+	// values must not have been overwritten by other workers
+	bool ok = true;
+	for (unsigned w = 0; w < n_workers; w++)
+		for (size_t i = 0; i < n_items; i++)
+			ok = ok && *mem.get(ids[w][i]).value() == w * n_items + i;
+
+	// every worker takes an additional reference to the items of its
+	// neighbour, and then releases the first half of its own items locally,
+	// and the second half of its neighbour's items remotely
+	__run_workers(n_workers, [&](unsigned w) {
+		const unsigned next = (w + 1) % n_workers;
+		for (size_t i = n_items / 2; i < n_items; i++)
+			mem.incref(w, ids[next][i]);
+	});
+	__run_workers(n_workers, [&](unsigned w) {
+		const unsigned next = (w + 1) % n_workers;
+		for (size_t i = 0; i < n_items / 2; i++)
+			mem.free(w, ids[w][i]);
+		for (size_t i = n_items / 2; i < n_items; i++) {
+			mem.free(w, ids[next][i]);
+			mem.decref(w, ids[next][i]);
+		}
+	});
+	auto stats = mem.stats();
+	ok = ok && stats.size == 0
+	   && stats.real_released == n_workers * n_items
+	   && stats.total_incref == n_workers * n_items / 2
+	   && stats.total_decref == n_workers * n_items / 2;
+
+	// allocating again must re-use all slots, including the remotely freed
+	std::vector<slab_memory_index_t> all;
+	std::vector<std::vector<slab_memory_index_t>> again(n_workers);
+	__run_workers(n_workers, [&](unsigned w) {
+		for (size_t i = 0; i < n_items; i++)
+			again[w].push_back(mem.alloc(w).value());
+	});
+	for (auto &v : again)
+		all.insert(all.end(), v.begin(), v.end());
+	std::sort(all.begin(), all.end());
+	ok = ok && std::adjacent_find(all.begin(), all.end()) == all.end();
+
+	stats = mem.stats();
+	ok = ok && mem.page_count() == n_pages
+	   && stats.total_reused == n_workers * n_items
+	   && stats.size == n_workers * n_items;
+
+	// invalid indexes are counted, but not applied
+	ok = ok && !mem.incref(0, {}) && !mem.decref(0, {}) && !mem.free(0, {});
+	stats = mem.stats();
+	ok = ok && stats.invalid_incref == 1 && stats.invalid_decref == 1 && stats.invalid_freed == 1;
+
+	for (unsigned w = 0; w < n_workers; w++)
+		for (auto id : again[w])
+			mem.free((w + 3) % n_workers, id);
+	ok = ok && mem.size() == 0;
+
+	std::cout << "concurrent slab memory: " << n_workers << " workers, " << mem.page_count()
+	          << " pages " << (ok ? "ok" : "FAILED") << "\n";
+	return ok;
+}
+
+
+/*
+ * bulk free releases items whose reference count drops to zero, counts
+ * invalid indexes, and the released slots are re-used by later allocations
+ */
+bool
+test_slab_bulk_free()
+{
+	slab_memory<int> mem(16);
+	auto ids = mem.calloc(100);
+	const size_t n_pages = mem.page_count();
+
+	// every tenth item of the batch has an additional reference, and survives
+	for (size_t i = 0; i < 50; i += 10)
+		mem.incref(ids[i]);
+
+	std::vector<slab_memory_index_t> batch;
+	for (size_t i = 0; i < 50; i++)
+		batch.push_back(ids[i].value());
+	bool ok = mem.free(batch.begin(), batch.end()) == 45;
+
+	auto stats = mem.stats();
+	ok = ok && stats.size == 55 && stats.real_released == 45
+	   && stats.total_freed == 50 && stats.invalid_freed == 0;
+	for (size_t i = 0; i < 50; i += 10)
+		ok = ok && mem.get(ids[i]).has_value();
+
+	// the overload for optionals skips and counts invalid indexes
+	std::vector<std::optional<slab_memory_index_t>> more = {ids[50], {}, ids[51]};
+	ok = ok && mem.free(more) == 2;
+	stats = mem.stats();
+	ok = ok && stats.size == 53 && stats.invalid_freed == 1 && stats.total_freed == 52;
+
+	// allocating the released number of items re-uses exactly the released
+	// slots, and requires no new page
+	std::vector<slab_memory_index_t> released;
+	for (size_t i = 0; i < 52; i++)
+		if (i >= 50 || i % 10 != 0)
+			released.push_back(ids[i].value());
+	std::vector<slab_memory_index_t> reused;
+	for (size_t i = 0; i < released.size(); i++)
+		reused.push_back(mem.alloc().value());
+	std::sort(released.begin(), released.end());
+	std::sort(reused.begin(), reused.end());
+	stats = mem.stats();
+	ok = ok && reused == released && stats.total_reused == 47
+	   && mem.page_count() == n_pages && mem.size() == 100;
+
+	std::cout << "slab memory bulk free: " << (ok ? "ok" : "FAILED") << "\n";
+	return ok;
+}
+
+
+/*
+ * iterators visit exactly the live items in order of their index, also across
+ * pages without live items, and compact moves them to the front and releases
+ * the pages that are no longer needed
+ */
+bool
+test_slab_iterate_compact()
+{
+	slab_memory<int> mem(16);
+	bool ok = mem.begin() == mem.end();
+
+	std::vector<slab_memory_index_t> ids;
+	for (int i = 0; i < 100; i++) {
+		ids.push_back(mem.alloc().value());
+		*mem.get(ids[i]).value() = i;
+	}
+	ok = ok && mem.page_count() == 7;
+
+	// keep every seventh item, except those on the pages 2 to 4, and item 99
+	// with an additional reference
+	std::vector<int> live;
+	for (int i = 0; i < 100; i++) {
+		if ((i % 7 == 0 && (i < 32 || i >= 80)) || i == 99)
+			live.push_back(i);
+		else
+			mem.free(ids[i]);
+	}
+	mem.incref(ids[99]);
+
+	std::vector<int> visited;
+	for (auto it = mem.begin(); it != mem.end(); ++it) {
+		ok = ok && it.index() == ids[*it] && it.ref_count() == (*it == 99 ? 2u : 1u);
+		visited.push_back(*it);
+	}
+	ok = ok && visited == live;
+
+	const slab_memory<int> &cmem = mem;
+	ok = ok && std::equal(cmem.begin(), cmem.end(), live.begin(), live.end());
+
+	// compaction keeps the order, and the remap translates old indexes
+	auto remap = mem.compact();
+	ok = ok && remap.size() == 100 && mem.size() == live.size();
+	for (size_t j = 0; j < live.size(); j++)
+		ok = ok && remap[ids[live[j]]] == j && mem[j] == live[j];
+	for (int i = 0; i < 100; i++)
+		ok = ok && (remap[ids[i]].has_value() == std::binary_search(live.begin(), live.end(), i));
+
+	const size_t n_pages = (live.size() + 15) / 16;
+	ok = ok && mem.page_count() == n_pages && mem.capacity() == n_pages * 16;
+	ok = ok && std::equal(mem.begin(), mem.end(), live.begin(), live.end());
+	ok = ok && mem.begin().ref_count() == 1;
+
+	// new items are appended after the compacted ones
+	ok = ok && mem.alloc().value() == live.size();
+
+	// the reference count moved with the item
+	auto last = remap[ids[99]];
+	ok = ok && mem.free(last) == 1 && mem.free(last) == 0;
+
+	// a memory without live items keeps one page
+	for (auto it = mem.begin(); it != mem.end(); )
+		mem.free((it++).index());
+	mem.compact();
+	ok = ok && mem.size() == 0 && mem.page_count() == 1 && mem.begin() == mem.end();
+
+	std::cout << "slab memory iterators and compaction: " << (ok ? "ok" : "FAILED") << "\n";
+	return ok;
+}
+
+
+/*
+ * slab checkpoints round trip, and malformed snapshots are rejected without
+ * touching the memory
+ */
+bool
+test_slab_checkpoint()
+{
+	slab_memory<int> mem(16);
+	std::vector<slab_memory_index_t> ids;
+	for (int i = 0; i < 40; i++)
+		ids.push_back(mem.alloc().value());
+	for (int i = 0; i < 40; i++)
+		*mem.get(ids[i]).value() = i;
+	for (int i = 0; i < 40; i += 3)
+		mem.free(ids[i]);
+
+	std::vector<std::byte> snapshot(mem.checkpoint_size());
+	mem.checkpoint_save(snapshot.data());
+
+	slab_memory<int> restored(8);
+	bool ok = restored.checkpoint_load(snapshot.data(), snapshot.size());
+	ok = ok && restored.size() == mem.size() && restored.page_size() == 16;
+	for (int i = 0; i < 40; i++)
+		ok = ok && (i % 3 == 0 || *restored.get(ids[i]).value() == i);
+	// released slots are re-used first
+	ok = ok && restored.alloc().value() == mem.alloc().value();
+
+	auto rejects = [&](std::vector<std::byte> damaged) {
+		slab_memory<int> target(16);
+		target.alloc();
+		return !target.checkpoint_load(damaged.data(), damaged.size())
+		    && target.size() == 1 && target.page_count() == 1;
+	};
+	auto set_word = [](std::vector<std::byte> bytes, size_t offset, std::uint64_t value) {
+		std::memcpy(bytes.data() + offset, &value, sizeof(value));
+		return bytes;
+	};
+
+	// truncated snapshots, and headers with page sizes or page counts whose
+	// byte sizes overflow
+	ok = ok && rejects(std::vector<std::byte>(snapshot.begin(), snapshot.begin() + 16));
+	ok = ok && rejects(std::vector<std::byte>(snapshot.begin(), snapshot.end() - 1));
+	ok = ok && rejects(set_word(snapshot, 0, 0));
+	ok = ok && rejects(set_word(snapshot, 0, std::uint64_t(1) << 62));
+	ok = ok && rejects(set_word(snapshot, 8, std::uint64_t(1) << 61));
+	ok = ok && rejects(set_word(snapshot, 24, std::uint64_t(1) << 61));
+
+	// a released index beyond the capacity
+	const size_t n_free = 14;
+	ok = ok && rejects(set_word(snapshot, snapshot.size() - n_free * sizeof(slab_memory_index_t), 3 * 16));
+
+	std::cout << "slab memory checkpoints: " << (ok ? "ok" : "FAILED") << "\n";
+	return ok;
+}
+
+
+int
+main()
+{
+	bool ok = true;
+	ok = test_concurrent_slab() && ok;
+	ok = test_slab_bulk_free() && ok;
+	ok = test_slab_iterate_compact() && ok;
+	ok = test_slab_checkpoint() && ok;
+	return ok ? 0 : 1;
+}
@@ -373,54 +373,50 @@ test_quadraticif_neuron()
 
 
 void
-test_hodgkin_huxley_neuron()
+test_generalizedif_neuron(std::string type = "tonic_bursting")
 {
-	HodgkinHuxley::Neuron n = HodgkinHuxley::make("classical");
-	auto input = HodgkinHuxley::get_demo_input("classical");
+	auto n = GeneralizedIF::make<2, double>(type);
+	auto input = GeneralizedIF::get_demo_input<double>(type);
 
 	double t    =   0.0_ms;
-	// NOTE: the HH model requires a really small stepsize for the numerical integration
-	double dt   =   0.01_ms;
+	double dt   =   0.1_ms;
 	double tmax = 500.0_ms;
 
 	std::ofstream outputfile;
-	outputfile.open("visualize_hodgkinhuxley.py");
+	outputfile.open("visualize_generalizedif.py");
 
 	outputfile << "#!/usr/bin/env python\n\n";
 
 	outputfile << "import numpy as np\n";
 	outputfile << "import matplotlib.pyplot as plt\n\n";
 
-	outputfile << "data = np.array([[" << t << ", " << n.state.v[0] << ", " << n.state.v[1]  << ", " << n.state.v[2] << ", " <<  n.state.v[3]<< "]\n";
+	outputfile << "data = np.array([[" << t << ", " << n.state.v[0] << ", " << n.state.v[1] << "]";
 
 	while (t < tmax) {
-		// this updates both t and dt, but we always want to integrate dt time
-		// forward. We thus need to pass in a "locally fixed" dt (tmp_dt).
-		double tmp_dt = dt;
-		t = HodgkinHuxley::integrate(n, t, tmp_dt, input);
-
+		// this updates both t and dt
+		GeneralizedIF::step(n, t, dt, input);
 		// print data
-		outputfile << "    , [" << t << ", " << n.state.v[0] << ", " << n.state.v[1]  << ", " << n.state.v[2] << ", " <<  n.state.v[3]<< "]\n";
+		outputfile << ", [" << t << ", " << n.state.v[0] << ", " << n.state.v[1] << "]";
 	}
 	outputfile << "])\n\n";
 
 	outputfile << "plt.figure()\n";
 	outputfile << "plt.plot(data.T[0,:], data.T[1,:])\n";
+	outputfile << "plt.plot(data.T[0,:], data.T[2,:], '--')\n";
 	outputfile << "plt.xlabel('ms')\n";
 	outputfile << "plt.ylabel('mV')\n";
-	outputfile << "plt.title('Hodgkin Huxley Neuron')\n";
+	outputfile << "plt.title('Generalized Integrate and Fire Neuron type \"" << type << "\"')\n";
 	outputfile << "plt.show()\n";
 
 	outputfile.close();
 }
 
 
-#if 0
 void
-test_generalizedif_neuron()
+test_hodgkin_huxley_neuron()
 {
-	GeneralizedIFNeuron neuron;
-	neuron.set_input(generalizedif_demo_input, nullptr);
+	HodgkinHuxley::Neuron n = HodgkinHuxley::make("classical");
+	auto input = HodgkinHuxley::get_demo_input("classical");
 
 	double t    =   0.0_ms;
 	// NOTE: the HH model requires a really small stepsize for the numerical integration
@@ -428,24 +424,23 @@ test_generalizedif_neuron()
 	double tmax = 500.0_ms;
 
 	std::ofstream outputfile;
-	outputfile.open("visualize_generalizedif.py");
+	outputfile.open("visualize_hodgkinhuxley.py");
 
 	outputfile << "#!/usr/bin/env python\n\n";
 
 	outputfile << "import numpy as np\n";
 	outputfile << "import matplotlib.pyplot as plt\n\n";
 
-	outputfile << "data = np.array([[" << t << ", " << neuron.state.v[0] << ", " << neuron.state.v[1]  << ", " << neuron.state.v[2] << ", " <<  neuron.state.v[3]<< "]\n";
+	outputfile << "data = np.array([[" << t << ", " << n.state.v[0] << ", " << n.state.v[1]  << ", " << n.state.v[2] << ", " <<  n.state.v[3]<< "]\n";
 
 	while (t < tmax) {
-
 		// this updates both t and dt, but we always want to integrate dt time
 		// forward. We thus need to pass in a "locally fixed" dt (tmp_dt).
 		double tmp_dt = dt;
-		t = neuron.integrate(t, tmp_dt);
+		t = HodgkinHuxley::integrate(n, t, tmp_dt, input);
 
 		// print data
-		outputfile << "    , [" << t << ", " << neuron.state.v[0] << ", " << neuron.state.v[1]  << ", " << neuron.state.v[2] << ", " <<  neuron.state.v[3]<< "]\n";
+		outputfile << "    , [" << t << ", " << n.state.v[0] << ", " << n.state.v[1]  << ", " << n.state.v[2] << ", " <<  n.state.v[3]<< "]\n";
 	}
 	outputfile << "])\n\n";
 
@@ -453,12 +448,220 @@ test_generalizedif_neuron()
 	outputfile << "plt.plot(data.T[0,:], data.T[1,:])\n";
 	outputfile << "plt.xlabel('ms')\n";
 	outputfile << "plt.ylabel('mV')\n";
-	outputfile << "plt.title('Generalized IF Neuron')\n";
+	outputfile << "plt.title('Hodgkin Huxley Neuron')\n";
 	outputfile << "plt.show()\n";
 
 	outputfile.close();
 }
-#endif
+
+
+/*
+ * compare the SoA population kernel against stepping individual neurons
+ */
+size_t
+test_izhikevich_population_soa(size_t N = 1000, size_t nsteps = 5000)
+{
+	const std::vector<std::string> types = {"tonic_spiking", "phasic_spiking", "tonic_bursting", "mixed_mode"};
+
+	// build a population of mixed types with different constant inputs
+	std::vector<Izhikevich::Neuron<double>> neurons;
+	std::vector<double> inputs;
+	Izhikevich::Population<double> pop;
+	for (size_t i = 0; i < N; i++) {
+		neurons.push_back(Izhikevich::make(types[i % types.size()]));
+		inputs.push_back(5.0 + 20.0 * double(i) / double(N));
+		Izhikevich::population_add(pop, neurons.back());
+	}
+
+	size_t mismatches = 0;
+	size_t spikes = 0;
+	double t_pop = 0.0;
+	const double dt = 0.1_ms;
+	for (size_t k = 0; k < nsteps; k++) {
+		for (size_t i = 0; i < N; i++) {
+			double t  = t_pop;
+			double dt_tmp = dt;
+			const double I = inputs[i];
+			Izhikevich::step(neurons[i], t, dt_tmp, [I](double) -> double { return I; });
+		}
+		Izhikevich::step(pop, t_pop, dt, inputs.data());
+
+		for (size_t i = 0; i < N; i++) {
+			spikes += pop.spiking[i];
+			if (bool(pop.spiking[i]) != neurons[i].state.spiking
+					|| std::abs(pop.v[i] - neurons[i].state.v[0]) > 1e-6
+					|| std::abs(pop.u[i] - neurons[i].state.v[1]) > 1e-6)
+				mismatches++;
+		}
+	}
+	std::cout << "izhikevich population: " << N << " neurons, " << spikes << " spikes, " << mismatches << " mismatches\n";
+	return mismatches;
+}
+
+
+/*
+ * __compare_population - step N neurons individually and as a population with
+ * constant inputs, and count the neurons whose state differs after a step.
+ * equal(pop, i, neuron) compares the population state of neuron i with that of
+ * the individually stepped neuron
+ */
+template <typename Neuron, typename Population, typename Equal>
+size_t
+__compare_population(
+		std::vector<Neuron> &neurons,
+		Population &pop,
+		const std::vector<double> &inputs,
+		size_t nsteps,
+		size_t &spikes,
+		Equal equal)
+{
+	const size_t N = neurons.size();
+	size_t mismatches = 0;
+	double t_pop = 0.0;
+	const double dt = 0.1_ms;
+	for (size_t k = 0; k < nsteps; k++) {
+		for (size_t i = 0; i < N; i++) {
+			double t  = t_pop;
+			double dt_tmp = dt;
+			const double I = inputs[i];
+			step(neurons[i], t, dt_tmp, [I](double) -> double { return I; });
+		}
+		step(pop, t_pop, dt, inputs.data());
+
+		for (size_t i = 0; i < N; i++) {
+			spikes += pop.spiking[i];
+			if (bool(pop.spiking[i]) != neurons[i].state.spiking || !equal(pop, i, neurons[i]))
+				mismatches++;
+		}
+	}
+	return mismatches;
+}
+
+
+/*
+ * the population kernels of the LeakyIF, AdEx, and QuadraticIF neurons must
+ * reproduce the single neuron step(). Parameters vary across the population
+ * and V_rest is non-zero, so that sign errors in the resting potential are
+ * not masked by the defaults
+ */
+size_t
+test_leakyif_population_soa(size_t N = 1000, size_t nsteps = 5000)
+{
+	std::vector<LeakyIF::Neuron<double>> neurons;
+	std::vector<double> inputs;
+	LeakyIF::Population<double> pop;
+	for (size_t i = 0; i < N; i++) {
+		auto n = LeakyIF::make<double>();
+		n.params.V_rest = -5.0_mV + 10.0_mV * double(i) / double(N);
+		n.state.v[0] = n.params.V_rest;
+		neurons.push_back(n);
+		inputs.push_back(10.0 + 20.0 * double(i) / double(N));
+		LeakyIF::population_add(pop, n);
+	}
+
+	size_t spikes = 0;
+	size_t mismatches = __compare_population(neurons, pop, inputs, nsteps, spikes,
+		[](const auto &pop, size_t i, const auto &n) {
+			return std::abs(pop.V[i] - n.state.v[0]) <= 1e-6
+			    && std::abs(pop.t_last_spike[i] - n.state.t_last_spike) <= 1e-6;
+		});
+	std::cout << "leaky IF population: " << N << " neurons, " << spikes << " spikes, " << mismatches << " mismatches\n";
+	return mismatches;
+}
+
+
+size_t
+test_adex_population_soa(size_t N = 1000, size_t nsteps = 5000)
+{
+	std::vector<AdEx::Neuron<double>> neurons;
+	std::vector<double> inputs;
+	AdEx::Population<double> pop;
+	for (size_t i = 0; i < N; i++) {
+		auto n = AdEx::make<double>();
+		n.params.a = 0.5 + double(i) / double(N);
+		n.params.b = 2.0 - double(i) / double(N);
+		neurons.push_back(n);
+		inputs.push_back(5.0 + 20.0 * double(i) / double(N));
+		AdEx::population_add(pop, n);
+	}
+
+	size_t spikes = 0;
+	size_t mismatches = __compare_population(neurons, pop, inputs, nsteps, spikes,
+		[](const auto &pop, size_t i, const auto &n) {
+			return std::abs(pop.V[i] - n.state.v[0]) <= 1e-6
+			    && std::abs(pop.w[i] - n.state.v[1]) <= 1e-6;
+		});
+	std::cout << "adex population: " << N << " neurons, " << spikes << " spikes, " << mismatches << " mismatches\n";
+	return mismatches;
+}
+
+
+size_t
+test_quadraticif_population_soa(size_t N = 1000, size_t nsteps = 5000)
+{
+	std::vector<QuadraticIF::Neuron<double>> neurons;
+	std::vector<double> inputs;
+	QuadraticIF::Population<double> pop;
+	for (size_t i = 0; i < N; i++) {
+		auto n = QuadraticIF::make<double>();
+		n.params.V_rest = -5.0_mV + 10.0_mV * double(i) / double(N);
+		neurons.push_back(n);
+		inputs.push_back(5.0 + 20.0 * double(i) / double(N));
+		QuadraticIF::population_add(pop, n);
+	}
+
+	size_t spikes = 0;
+	size_t mismatches = __compare_population(neurons, pop, inputs, nsteps, spikes,
+		[](const auto &pop, size_t i, const auto &n) {
+			return std::abs(pop.V[i] - n.state.v[0]) <= 1e-6
+			    && std::abs(pop.t_last_spike[i] - n.state.t_last_spike) <= 1e-6;
+		});
+	std::cout << "quadratic IF population: " << N << " neurons, " << spikes << " spikes, " << mismatches << " mismatches\n";
+	return mismatches;
+}
+
+
+/*
+ * compare the tabulated gating kinetics of the HH population against the
+ * analytic rates
+ */
+size_t
+test_hodgkin_huxley_gating_table(size_t N = 100, size_t nsteps = 5000)
+{
+	auto pop = HodgkinHuxley::make_population<double>(N, "classical");
+	auto lut = pop;
+	if (!HodgkinHuxley::use_gating_table(lut))
+		return 1;
+
+	auto validation = HodgkinHuxley::validate_gating_table(lut.gating, lut.params);
+	if (!validation.ok)
+		return 1;
+	double max_bound = 0.0;
+	for (auto b : lut.gating.error_bound)
+		max_bound = std::max(max_bound, b);
+
+	std::vector<double> inputs(N);
+	for (size_t i = 0; i < N; i++)
+		inputs[i] = 0.2 * double(i) / double(N);
+
+	size_t spikes_pop = 0, spikes_lut = 0;
+	double max_dV = 0.0;
+	double t_pop = 0.0, t_lut = 0.0;
+	const double dt = 0.01_ms;
+	for (size_t k = 0; k < nsteps; k++) {
+		HodgkinHuxley::step(pop, t_pop, dt, inputs.data());
+		HodgkinHuxley::step(lut, t_lut, dt, inputs.data());
+		for (size_t i = 0; i < N; i++) {
+			spikes_pop += pop.spiking[i];
+			spikes_lut += lut.spiking[i];
+			max_dV = std::max(max_dV, std::abs(pop.V[i] - lut.V[i]));
+		}
+	}
+	std::cout << "hodgkin-huxley gating table: " << lut.gating.size() << " grid points, error bound "
+	          << max_bound << ", max |dV| " << max_dV << " mV, " << spikes_pop << "/" << spikes_lut << " spike steps\n";
+	return spikes_pop != spikes_lut || max_dV > 1.0;
+}
+
 
 void
 test_stdp_kernel()
@@ -467,6 +670,147 @@ test_stdp_kernel()
 }
 
 
+/*
+ * brute-force evaluation of a trace, i.e. the sum over all spikes strictly
+ * before t
+ */
+double
+__trace(const std::vector<double> &spikes, double t, double tau)
+{
+	double x = 0.0;
+	for (auto s : spikes)
+		if (s < t)
+			x += std::exp(-(t - s) / tau);
+	return x;
+}
+
+
+/*
+ * compare the event-driven STDP against a brute-force evaluation of the pair
+ * and triplet rules on random spike trains
+ */
+size_t
+test_stdp_event_driven(size_t n_pre = 20, size_t n_post = 10, size_t nsteps = 2000)
+{
+	std::mt19937 rng(1234);
+	std::uniform_real_distribution<double> uniform(0.0, 1.0);
+
+	// random CSR connectivity
+	std::vector<size_t> row_offsets{0}, cols;
+	for (size_t i = 0; i < n_pre; i++) {
+		for (size_t j = 0; j < n_post; j++)
+			if (uniform(rng) < 0.5)
+				cols.push_back(j);
+		row_offsets.push_back(cols.size());
+	}
+
+	// unbounded weights, such that the brute-force sums are exact
+	STDPSynapseParams<double> pair = {
+		.tau_pre = 20.0_ms, .tau_post = 30.0_ms, .c_a_pre = 0.01, .c_a_post = -0.005,
+		.eta = 1.0, .w0 = 0.05, .w_min = -1e9, .w_max = 1e9};
+	auto triplet = tripletstdpsynapse_get_params<double>("visual_cortex");
+	triplet.w_min = -1e9;
+	triplet.w_max =  1e9;
+
+	auto pp = make_stdp_plasticity<double>(row_offsets, cols, n_post, pair);
+	auto pt = make_stdp_plasticity<double>(row_offsets, cols, n_post, triplet);
+
+	std::vector<std::vector<double>> pre_times(n_pre), post_times(n_post);
+	std::vector<std::uint8_t> pre_spiking(n_pre), post_spiking(n_post);
+	const double dt = 0.5_ms;
+	for (size_t k = 1; k <= nsteps; k++) {
+		const double t = double(k) * dt;
+		for (size_t i = 0; i < n_pre; i++)
+			if ((pre_spiking[i] = uniform(rng) < 0.02))
+				pre_times[i].push_back(t);
+		for (size_t i = 0; i < n_post; i++)
+			if ((post_spiking[i] = uniform(rng) < 0.02))
+				post_times[i].push_back(t);
+		if (!stdp_process_spikes(pp, std::span<const std::uint8_t>(pre_spiking), std::span<const std::uint8_t>(post_spiking), t))
+			return 1;
+		if (!stdp_process_spikes(pt, std::span<const std::uint8_t>(pre_spiking), std::span<const std::uint8_t>(post_spiking), t))
+			return 1;
+	}
+
+	double max_err_pair = 0.0, max_err_triplet = 0.0;
+	for (size_t i = 0; i < n_pre; i++) {
+		for (size_t e = row_offsets[i]; e < row_offsets[i + 1]; e++) {
+			const auto &pre  = pre_times[i];
+			const auto &post = post_times[cols[e]];
+
+			double w_pair = pair.w0, w_triplet = triplet.w0;
+			for (auto t : pre) {
+				w_pair    += pair.c_a_post * __trace(post, t, pair.tau_post);
+				w_triplet -= __trace(post, t, triplet.tau_minus)
+				           * (triplet.A2_minus + triplet.A3_minus * __trace(pre, t, triplet.tau_x));
+			}
+			for (auto t : post) {
+				w_pair    += pair.c_a_pre * __trace(pre, t, pair.tau_pre);
+				w_triplet += __trace(pre, t, triplet.tau_plus)
+				           * (triplet.A2_plus + triplet.A3_plus * __trace(post, t, triplet.tau_y));
+			}
+			max_err_pair    = std::max(max_err_pair, std::abs(w_pair - pp.weights[e]));
+			max_err_triplet = std::max(max_err_triplet, std::abs(w_triplet - pt.weights[e]));
+		}
+	}
+	std::cout << "stdp event-driven: " << cols.size() << " synapses, max error pair "
+	          << max_err_pair << ", triplet " << max_err_triplet << "\n";
+	return max_err_pair > 1e-12 || max_err_triplet > 1e-12;
+}
+
+
+/*
+ * the single triplet STDP synapse integrates its traces numerically, and must
+ * agree with the brute-force evaluation of the triplet rule up to the error of
+ * the integrator. Pre- and postsynaptic spikes do not coincide, as the single
+ * synapse processes them in the order of the calls
+ */
+size_t
+test_triplet_stdp_synapse(size_t nsteps = 20000)
+{
+	std::mt19937 rng(4321);
+	std::uniform_real_distribution<double> uniform(0.0, 1.0);
+
+	TripletSTDPSynapse<double> synapse("visual_cortex");
+	synapse.params.w_min = -1e9;
+	synapse.params.w_max =  1e9;
+	const auto &p = synapse.params;
+
+	std::vector<double> pre, post;
+	double t = 0.0;
+	for (size_t k = 0; k < nsteps; k++) {
+		double dt = 0.1_ms;
+		tripletstdpsynapse_step(synapse, t, dt);
+		t = double(k + 1) * 0.1_ms;
+		const double u = uniform(rng);
+		if (u < 0.002) {
+			tripletstdpsynapse_pre_spike(synapse);
+			pre.push_back(t);
+		}
+		else if (u < 0.004) {
+			tripletstdpsynapse_post_spike(synapse);
+			post.push_back(t);
+		}
+	}
+
+	double w = p.w0, dw = 0.0;
+	for (auto tp : pre) {
+		const double d = __trace(post, tp, p.tau_minus) * (p.A2_minus + p.A3_minus * __trace(pre, tp, p.tau_x));
+		w -= p.eta * d;
+		dw += std::abs(d);
+	}
+	for (auto tp : post) {
+		const double d = __trace(pre, tp, p.tau_plus) * (p.A2_plus + p.A3_plus * __trace(post, tp, p.tau_y));
+		w += p.eta * d;
+		dw += std::abs(d);
+	}
+	const double rel_err = std::abs(w - synapse.state.w) / dw;
+	std::cout << "triplet stdp synapse: " << pre.size() << " pre and " << post.size()
+	          << " post spikes, relative error " << rel_err << "\n";
+	return rel_err > 1e-4;
+}
+
+
 
 
 
@@ -486,16 +830,31 @@ main(int argc, char *argv[])
 	test_adexqif_neuron();
 	test_leakyif_neuron();
 	test_quadraticif_neuron();
+	test_generalizedif_neuron();
 	// test_hodgkin_huxley_neuron();
 
 #endif
 
+	if (test_izhikevich_population_soa())
+		return 1;
+	if (test_leakyif_population_soa())
+		return 1;
+	if (test_adex_population_soa())
+		return 1;
+	if (test_quadraticif_population_soa())
+		return 1;
+	if (test_hodgkin_huxley_gating_table())
+		return 1;
+	if (test_stdp_event_driven())
+		return 1;
+	if (test_triplet_stdp_synapse())
+		return 1;
+
 	// test_stdp_kernel();
 	// test_izhikevich_population();
 
 
 	// TODO:
-	// test_generalizedif_neuron();
 	// ExponentialIF
 
 	return 0;
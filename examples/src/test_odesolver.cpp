@@ -354,6 +354,264 @@ test_odesolver_ND()
 }
 
 
+template <size_t N, typename T = double>
+void
+oscillator(const T t,
+	const vector_t<N, T> &y,
+	vector_t<N, T> &dydt,
+	std::nullptr_t)
+{
+	NCR_UNUSED(t);
+	dydt[0] =  y[1];
+	dydt[1] = -y[0];
+}
+
+
+/*
+ * integrate sin(t) with the context based adaptive solvers, and locate the
+ * first crossing of 0.5 via dense output
+ */
+size_t
+test_odesolver_adaptive_context()
+{
+	size_t failures = 0;
+	for (int solver = 0; solver < 2; solver++) {
+		odesolve_adaptive_context<2> ctx;
+		ctx.config.abs_tol      = 1e-9;
+		ctx.config.rel_tol      = 1e-9;
+		ctx.config.dense_output = true;
+
+		vector_t<2> y{0.0, 1.0};
+		double t = 0.0, dt = 0.1, t_cross = -1.0;
+		bool found = false;
+		while (t < 2.0) {
+			dt = std::min(dt, 2.0 - t);
+			if (solver == 0)
+				odesolve_step_rkck_adaptive(ctx, oscillator, t, dt, y, y, nullptr);
+			else
+				odesolve_step_rkdp_adaptive(ctx, oscillator, t, dt, y, y, nullptr);
+			if (!found)
+				found = odesolve_dense_crossing(ctx, 0, 0.5, t_cross);
+		}
+
+		const double err_y = std::abs(y[0] - std::sin(2.0));
+		const double err_t = std::abs(t_cross - M_PI / 6.0);
+		const bool ok = err_y < 1e-7 && found && err_t < 1e-5 && ctx.stats.n_fsal_reused > 0;
+		failures += !ok;
+
+		std::cout << std::scientific << std::setprecision(2)
+			<< (solver == 0 ? "rkck" : "rkdp") << " context: "
+			<< ctx.stats.n_accepted << " accepted, "
+			<< ctx.stats.n_rejected << " rejected, "
+			<< ctx.stats.n_rhs_calls << " rhs calls, "
+			<< ctx.stats.n_fsal_reused << " reused, "
+			<< "err_y = " << err_y << ", err_t = " << err_t
+			<< (ok ? "" : " FAILED") << "\n";
+	}
+
+	// zero tolerances must not divide by zero, even for a component that
+	// starts at 0
+	for (int solver = 0; solver < 2; solver++) {
+		odesolve_adaptive_context<2> ctx;
+		ctx.config.abs_tol     = 0.0;
+		ctx.config.rel_tol     = 0.0;
+		ctx.config.max_retries = 4;
+
+		vector_t<2> y{0.0, 1.0};
+		double t = 0.0, dt = 0.1;
+		for (size_t k = 0; k < 10; k++) {
+			if (solver == 0)
+				odesolve_step_rkck_adaptive(ctx, oscillator, t, dt, y, y, nullptr);
+			else
+				odesolve_step_rkdp_adaptive(ctx, oscillator, t, dt, y, y, nullptr);
+		}
+		failures += !std::isfinite(y[0]) || !std::isfinite(y[1]) || !std::isfinite(t)
+		          || !(dt > 0.0) || !std::isfinite(dt) || ctx.stats.n_accepted != 10;
+	}
+	{
+		odesolve_batch_workspace<double> ws;
+		auto exp_batch = [](const double *t, const double *y, double *dydt, const size_t M) {
+			NCR_UNUSED(t);
+			for (size_t j = 0; j < M; j++)
+				dydt[j] = y[j];
+		};
+		double t = 0.0, dt = 0.1, y = 1.0;
+		for (size_t k = 0; k < 10; k++)
+			odesolve_step_rkck_adaptive_batch<1>(exp_batch, &t, &dt, 1, &y, &y, ws, nullptr, 0.0);
+		failures += !std::isfinite(y) || !(dt > 0.0) || !std::isfinite(dt);
+	}
+	return failures;
+}
+
+
+/*
+ * check that the streaming drivers produce the same samples as odesolve_1D,
+ * and that decimation, preallocated buffers and ring buffers work
+ */
+size_t
+test_odesolver_stream()
+{
+	differential_1D_fn fn = [](double t, double y) -> double {
+		NCR_UNUSED(y);
+		return std::cos(t);
+	};
+
+	auto full = odesolve_1D(odesolve_step_rk4_1D, fn, 0.0, 1.0, 0.01, 0.0);
+
+	// preallocated buffers with decimation
+	std::vector<double> ts(16), ys(16);
+	const size_t n = odesolve_1D_into(odesolve_step_rk4_1D, fn, 0.0, 1.0, 0.01, 0.0, ts.data(), ys.data(), ts.size(), 10);
+
+	size_t failures = (n != 11) + (full.ts.size() != 101);
+	for (size_t k = 0; k < n && k * 10 < full.ys.size(); k++)
+		failures += ys[k] != full.ys[k * 10] || ts[k] != full.ts[k * 10];
+
+	// keep only the last 5 samples of the lorenz system
+	odesolve_ring_buffer<3> ring(5);
+	vector_t<3> y_init{1.0, 0.0, 0.0};
+	const size_t n_lorenz = odesolve_stream(odesolve_step_rk4, lorenz, 0.0, 1.0, 0.01, y_init, ring, 1, nullptr);
+
+	std::vector<double> lts(101), lys(3 * 101);
+	const size_t n_into = odesolve_into(odesolve_step_rk4, lorenz, 0.0, 1.0, 0.01, y_init, lts.data(), lys.data(), lts.size(), 1, nullptr);
+
+	failures += (n_lorenz != 101) + (n_into != 101) + (ring.size() != 5);
+	for (size_t k = 0; k < ring.size(); k++) {
+		auto [t, y] = ring.get(k);
+		const size_t j = n_into - ring.size() + k;
+		failures += t != lts[j] || y[0] != lys[3 * j] || y[2] != lys[3 * j + 2];
+	}
+
+	std::cout << "odesolve stream: " << n << " decimated samples, " << n_lorenz << " streamed samples, " << failures << " failures\n";
+	return failures;
+}
+
+
+/*
+ * compare the batched RK4 against single system steps, and integrate a batch
+ * of exponentials with per-system adaptive step sizes
+ */
+size_t
+test_odesolver_batch(size_t M = 64)
+{
+	constexpr size_t N = 3;
+
+	auto lorenz_batch = [](const double t, const double *y, double *dydt, const size_t M) {
+		NCR_UNUSED(t);
+		const double *x0 = y, *x1 = y + M, *x2 = y + 2 * M;
+		NCR_IVDEP
+		for (size_t j = 0; j < M; j++) {
+			dydt[j]         = 10.0 * (x1[j] - x0[j]);
+			dydt[M + j]     = 28.0 * x0[j] - x1[j] - x0[j] * x2[j];
+			dydt[2 * M + j] = x0[j] * x1[j] - (8.0 / 3.0) * x2[j];
+		}
+	};
+
+	std::vector<vector_t<N>> ys(M);
+	std::vector<double> yb(N * M);
+	for (size_t j = 0; j < M; j++) {
+		ys[j] = {1.0 + 0.01 * double(j), 0.0, 0.0};
+		for (size_t d = 0; d < N; d++)
+			yb[d * M + j] = ys[j][d];
+	}
+
+	odesolve_batch_workspace<double> ws;
+	double t_batch = 0.0;
+	const double dt = 0.01;
+	for (size_t k = 0; k < 100; k++) {
+		for (size_t j = 0; j < M; j++) {
+			double t = t_batch, dt_tmp = dt;
+			vector_t<N> y_out;
+			odesolve_step_rk4(lorenz, t, dt_tmp, ys[j], y_out, nullptr);
+			ys[j] = y_out;
+		}
+		odesolve_step_rk4_batch<N>(lorenz_batch, t_batch, dt, M, yb.data(), yb.data(), ws);
+	}
+
+	size_t mismatches = 0;
+	for (size_t j = 0; j < M; j++)
+		for (size_t d = 0; d < N; d++)
+			mismatches += std::abs(yb[d * M + j] - ys[j][d]) > 1e-9;
+
+	// a single adaptive Cash & Karp step of each system, with step sizes that
+	// need a different number of retries. The batch retries rejected systems
+	// in subsequent calls, which must end where the single system step ends
+	{
+		auto lorenz_batch_t = [&lorenz_batch](const double *t, const double *y, double *dydt, const size_t M) {
+			lorenz_batch(t[0], y, dydt, M);
+		};
+
+		std::vector<double> tb(M, 0.0), dtb(M), y0(N * M), yc(N * M);
+		for (size_t j = 0; j < M; j++) {
+			dtb[j] = 1e-4 * std::pow(1.15, double(j));
+			for (size_t d = 0; d < N; d++)
+				y0[d * M + j] = d == 0 ? 1.0 + 0.01 * double(j) : 0.5;
+		}
+		std::vector<double> t_first(M), dt_first(M), y_first(N * M);
+		std::vector<std::uint8_t> accepted(M), done(M, 0);
+		size_t n_done = 0, n_calls = 0;
+		yc = y0;
+		while (n_done < M && n_calls < 1000) {
+			const size_t n_accepted = odesolve_step_rkck_adaptive_batch<N>(
+					lorenz_batch_t, tb.data(), dtb.data(), M, yc.data(), yc.data(), ws, accepted.data());
+			n_calls++;
+			mismatches += n_accepted != size_t(std::count(accepted.begin(), accepted.end(), 1));
+			for (size_t j = 0; j < M; j++) {
+				if (!accepted[j] || done[j])
+					continue;
+				done[j] = 1;
+				n_done++;
+				t_first[j]  = tb[j];
+				dt_first[j] = dtb[j];
+				for (size_t d = 0; d < N; d++)
+					y_first[d * M + j] = yc[d * M + j];
+			}
+		}
+
+		size_t n_retried = 0;
+		for (size_t j = 0; j < M; j++) {
+			double t = 0.0, dt = 1e-4 * std::pow(1.15, double(j));
+			vector_t<N> y_in, y_out;
+			for (size_t d = 0; d < N; d++)
+				y_in[d] = y0[d * M + j];
+			odesolve_step_rkck_adaptive(lorenz, t, dt, y_in, y_out, nullptr);
+
+			n_retried += t < 1e-4 * std::pow(1.15, double(j));
+			mismatches += !done[j] || std::abs(t_first[j] - t) > 1e-12 || std::abs(dt_first[j] - dt) > 1e-12;
+			for (size_t d = 0; d < N; d++)
+				mismatches += std::abs(y_first[d * M + j] - y_out[d]) > 1e-9;
+		}
+		std::cout << "odesolve batch rkck: " << M << " systems, " << n_calls << " attempts, "
+		          << n_retried << " retried systems\n";
+	}
+
+	// y' = r * y with a different rate per system
+	std::vector<double> rates(M), ts(M, 0.0), dts(M, 0.1), ye(M, 1.0);
+	for (size_t j = 0; j < M; j++)
+		rates[j] = 0.5 + double(j) / double(M);
+	auto exp_batch = [&rates](const double *t, const double *y, double *dydt, const size_t M) {
+		NCR_UNUSED(t);
+		for (size_t j = 0; j < M; j++)
+			dydt[j] = rates[j] * y[j];
+	};
+
+	size_t attempts = 0, n_done = 0;
+	while (n_done < M && attempts < 10000) {
+		for (size_t j = 0; j < M; j++)
+			dts[j] = std::min(dts[j], 1.0 - ts[j]);
+		odesolve_step_rkdp_adaptive_batch<1>(exp_batch, ts.data(), dts.data(), M, ye.data(), ye.data(), ws);
+		attempts++;
+		n_done = 0;
+		for (size_t j = 0; j < M; j++)
+			n_done += ts[j] >= 1.0 - 1e-12;
+	}
+	for (size_t j = 0; j < M; j++)
+		mismatches += std::abs(ye[j] - std::exp(rates[j] * ts[j])) > 1e-8;
+
+	std::cout << "odesolve batch: " << M << " systems, " << attempts << " adaptive attempts, " << mismatches << " mismatches\n";
+	return mismatches;
+}
+
+
 int
 main(int argc, char *argv[])
 {
@@ -364,5 +622,12 @@ main(int argc, char *argv[])
 	test_odesolver_ND();
 	test_odesolver_lorenz();
 
+	if (test_odesolver_batch())
+		return 1;
+	if (test_odesolver_adaptive_context())
+		return 1;
+	if (test_odesolver_stream())
+		return 1;
+
 	return 0;
 }
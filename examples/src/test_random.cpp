@@ -1,4 +1,9 @@
 #include <iostream>
+#include <sstream>
+#include <algorithm>
+#include <vector>
+#include <bit>
+#include <cmath>
 
 #include <ncr/ncr_random.hpp>
 
@@ -50,9 +55,144 @@ test_rng_state_serialization()
 
 
 
+/*
+ * known answers of Philox4x32-10 from the Random123 distribution, and checks
+ * of streams, positioning and state serialization
+ */
+bool
+test_philox()
+{
+	using ncr::philox4x32;
+	bool ok = true;
+
+	const philox4x32::block_type kat0 = philox4x32::block({0, 0, 0, 0}, {0, 0});
+	const philox4x32::block_type kat1 = philox4x32::block(
+		{0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}, {0xffffffff, 0xffffffff});
+	const philox4x32::block_type kat2 = philox4x32::block(
+		{0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344}, {0xa4093822, 0x299f31d0});
+	ok &= kat0 == philox4x32::block_type{0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8};
+	ok &= kat1 == philox4x32::block_type{0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd};
+	ok &= kat2 == philox4x32::block_type{0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1};
+
+	// the same (seed, stream) always gives the same numbers, independent of
+	// how many numbers other streams drew
+	philox4x32 a(1234, 7), b(1234, 8), c(1234, 7);
+	for (int i = 0; i < 100; i++)
+		b();
+	std::uint64_t xa[10], xc[10];
+	for (int i = 0; i < 10; i++) {
+		xa[i] = a();
+		xc[i] = c();
+	}
+	ok &= std::equal(xa, xa + 10, xc);
+	ok &= philox4x32(1234, 8)() != xa[0];
+
+	// jumping within a stream
+	philox4x32 d(1234, 7);
+	d.discard(5);
+	ok &= d() == xa[5];
+	d.set_position(2);
+	ok &= d() == xa[2] && d.position() == 3;
+
+	// state serialization and reseeding
+	std::stringstream ss;
+	ss << a;
+	philox4x32 e;
+	ss >> e;
+	ok &= e == a && e() == a();
+
+	philox4x32 f;
+	ncr::reseed_rng(&f, 1234, 7);
+	ok &= f() == xa[0];
+
+	// works with the distributions in ncr_random and <random>
+	double sum = 0.0;
+	for (int i = 0; i < 10000; i++)
+		sum += ncr::unif_random(&f);
+	ok &= std::abs(sum / 10000.0 - 0.5) < 0.02;
+
+	std::cout << "philox4x32: " << (ok ? "ok" : "FAILED") << "\n";
+	return ok;
+}
+
+
+/*
+ * check the moments of the bulk samplers
+ */
+bool
+test_bulk_samplers()
+{
+	constexpr size_t N = 100003;
+	ncr::philox4x32 rng(42);
+	bool ok = true;
+
+	auto moments = [](const auto &xs) {
+		double mean = 0.0, var = 0.0;
+		for (auto x: xs) mean += x;
+		mean /= double(xs.size());
+		for (auto x: xs) var += (x - mean) * (x - mean);
+		return std::pair{mean, var / double(xs.size())};
+	};
+
+	std::vector<double> u(N);
+	ncr::unif_random_fill(std::span<double>(u), &rng);
+	auto [mu_u, var_u] = moments(u);
+	ok &= std::abs(mu_u - 0.5) < 0.01 && std::abs(var_u - 1.0 / 12.0) < 0.01;
+	ok &= *std::min_element(u.begin(), u.end()) >= 0.0 && *std::max_element(u.begin(), u.end()) < 1.0;
+
+	std::vector<float> uf(N);
+	ncr::unif_random_fill(std::span<float>(uf), &rng);
+	auto [mu_f, var_f] = moments(uf);
+	ok &= std::abs(mu_f - 0.5) < 0.01 && std::abs(var_f - 1.0 / 12.0) < 0.01;
+
+	std::vector<double> g(N);
+	ncr::normal_fill(std::span<double>(g), 1.0, 2.0, &rng);
+	auto [mu_g, var_g] = moments(g);
+	ok &= std::abs(mu_g - 1.0) < 0.05 && std::abs(var_g - 4.0) < 0.1;
+
+	std::vector<double> e(N);
+	ncr::exponential_fill(std::span<double>(e), 4.0, &rng);
+	auto [mu_e, var_e] = moments(e);
+	ok &= std::abs(mu_e - 0.25) < 0.01 && std::abs(var_e - 1.0 / 16.0) < 0.01;
+
+	// bit masks, including the cleared padding of the last word
+	std::vector<std::uint64_t> mask((N + 63) / 64);
+	ncr::bernoulli_fill(std::span(mask), N, 0.1, &rng);
+	size_t nset = 0;
+	for (auto w: mask) nset += std::popcount(w);
+	ok &= std::abs(double(nset) / N - 0.1) < 0.01;
+	ok &= (mask.back() >> (N % 64)) == 0;
+
+	// 1000 neurons with rates between 0 and 100 Hz over 100 bins of 1ms
+	std::vector<double> rates(1000);
+	for (size_t i = 0; i < rates.size(); i++)
+		rates[i] = 100.0 * double(i) / double(rates.size());
+	std::vector<std::uint64_t> spikes((rates.size() + 63) / 64);
+	size_t nspikes = 0;
+	for (size_t k = 0; k < 100; k++) {
+		ncr::poisson_spike_mask(std::span(spikes), std::span<const double>(rates), 1e-3, &rng);
+		for (auto w: spikes) nspikes += std::popcount(w);
+	}
+	double expected = 0.0;
+	for (auto r: rates)
+		expected += 100.0 * (1.0 - std::exp(-r * 1e-3));
+	ok &= std::abs(double(nspikes) - expected) < 300.0;
+
+	auto bits = ncr::random_bits<100>(&rng);
+	ok &= bits.count() > 20 && bits.count() < 80;
+
+	std::cout << "bulk samplers: " << (ok ? "ok" : "FAILED") << "\n";
+	return ok;
+}
+
+
 int
 main(int, char *[])
 {
 	test_rng_state_serialization();
+	if (!test_philox())
+		return 1;
+	if (!test_bulk_samplers())
+		return 1;
 	return 0;
 }
@@ -0,0 +1,126 @@
+#include <iostream>
+#include <vector>
+#include <thread>
+#include <chrono>
+#include <cassert>
+
+#include <ncr/ncr_recorder.hpp>
+
+using namespace ncr;
+
+
+// backend that keeps everything in memory, and optionally takes some time to
+// write each chunk
+struct memory_backend : recorder_backend
+{
+	std::vector<std::uint32_t>       neurons;
+	std::vector<std::uint64_t>       spike_ticks;
+	std::vector<std::vector<double>> values;
+	std::vector<std::vector<std::uint64_t>> sample_ticks;
+	std::vector<size_t>              n_vars;
+	std::chrono::microseconds        delay{0};
+	bool                             finalized = false;
+	size_t                           n_writes = 0;
+
+	bool
+	init(const std::vector<recorder_trace> &traces) override
+	{
+		for (const auto &t: traces)
+			n_vars.push_back(t.n_vars);
+		values.resize(traces.size());
+		sample_ticks.resize(traces.size());
+		return true;
+	}
+
+	bool
+	write_spikes(std::span<const std::uint32_t> ns, std::span<const std::uint64_t> ts) override
+	{
+		std::this_thread::sleep_for(delay);
+		neurons.insert(neurons.end(), ns.begin(), ns.end());
+		spike_ticks.insert(spike_ticks.end(), ts.begin(), ts.end());
+		n_writes += 1;
+		return true;
+	}
+
+	bool
+	write_samples(size_t trace, std::span<const std::uint64_t> ts, std::span<const double> vs) override
+	{
+		std::this_thread::sleep_for(delay);
+		assert(vs.size() == ts.size() * n_vars[trace]);
+		sample_ticks[trace].insert(sample_ticks[trace].end(), ts.begin(), ts.end());
+		values[trace].insert(values[trace].end(), vs.begin(), vs.end());
+		n_writes += 1;
+		return true;
+	}
+
+	void finalize() override { finalized = true; }
+};
+
+
+void
+test_recorder(std::chrono::microseconds delay)
+{
+	const size_t n_neurons = 100;
+	const std::uint64_t n_ticks = 2000;
+
+	recorder rec(recorder_config{.spike_chunk_size = 256, .sample_chunk_size = 32, .max_pending_chunks = 2});
+	size_t v = recorder_add_trace(&rec, "v", n_neurons, 10);
+	size_t w = recorder_add_trace(&rec, "w", 2);
+
+	// the recorder owns the backend, but we keep a pointer to check results
+	auto *backend = new memory_backend();
+	backend->delay = delay;
+	[[maybe_unused]] bool ok = recorder_start(&rec, backend);
+	assert(ok);
+
+	std::vector<double> state(n_neurons);
+	size_t expected_spikes = 0;
+	for (std::uint64_t tick = 0; tick < n_ticks; tick++) {
+		for (size_t i = 0; i < n_neurons; i++) {
+			state[i] = double(tick) + double(i) / n_neurons;
+			if ((tick + i) % 7 == 0) {
+				recorder_spike(&rec, std::uint32_t(i), tick);
+				expected_spikes += 1;
+			}
+		}
+		recorder_sample(&rec, v, tick, state);
+		double ws[2] = {double(tick), -double(tick)};
+		ok = recorder_sample(&rec, w, tick, ws);
+		assert(ok);
+	}
+
+	// wrong number of values
+	ok = recorder_sample(&rec, w, 0, state);
+	assert(!ok);
+
+	recorder_flush(&rec);
+	assert(backend->neurons.size() == expected_spikes);
+	assert(backend->sample_ticks[v].size() == n_ticks / 10);
+	assert(backend->sample_ticks[w].size() == n_ticks);
+	for (size_t k = 0; k < backend->sample_ticks[v].size(); k++) {
+		assert(backend->sample_ticks[v][k] == k * 10);
+		assert(backend->values[v][k * n_neurons + 3] == double(k * 10) + 0.03);
+	}
+	for (size_t k = 0; k < backend->spike_ticks.size(); k++)
+		assert((backend->spike_ticks[k] + backend->neurons[k]) % 7 == 0);
+	assert(backend->values[w].back() == -double(n_ticks - 1));
+
+	auto stats = recorder_get_statistics(&rec);
+	assert(stats.spikes == expected_spikes);
+	assert(stats.samples == n_ticks / 10 + n_ticks);
+	assert(stats.chunks == backend->n_writes);
+	assert(stats.errors == 0);
+
+	recorder_stop(&rec);
+	std::cout << "recorder (delay " << delay.count() << "us): "
+	          << stats.spikes << " spikes, " << stats.samples << " samples, "
+	          << stats.chunks << " chunks\n";
+}
+
+
+int main()
+{
+	test_recorder(std::chrono::microseconds(0));
+	test_recorder(std::chrono::microseconds(200));
+	return 0;
+}
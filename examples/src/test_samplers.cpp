@@ -18,6 +18,7 @@
 #include <ncr/ncr_utils.hpp>
 #include <ncr/ncr_random.hpp>
 #include <ncr/ncr_algorithm.hpp>
+#include <ncr/ncr_parallel.hpp>
 
 
 namespace ncr {
@@ -177,6 +178,193 @@ main(int argc, char *argv[])
 		std::cout << target << std::endl;
 	}
 
+	{
+		// alias tables are built once and reused for all draws
+		ncr::alias_sampler<double> sampler(ws);
+
+		std::vector<ptrdiff_t> counts(ws.size(), 0);
+		std::vector<size_t> indices = sampler.sample(1000000, _rng);
+		for (size_t i = 0; i < indices.size(); i++) {
+			counts[indices[i]]++;
+		}
+		ptrdiff_t sum = std::accumulate(counts.begin(), counts.end(), 0);
+
+		std::vector<float> target(ws.size(), 0.0);
+		for (size_t i = 0; i < ws.size(); i++) {
+			target[i] = (float)counts[i] / (float)sum;
+		}
+		std::cout << target << std::endl;
+
+		// rebuild in place from a vector of structs with reversed weights
+		std::vector<custom_struct> vec(ws.size());
+		for (size_t i = 0; i < ws.size(); i++)
+			vec[i].x = ws[ws.size() - 1 - i];
+		sampler.rebuild(vec, [](const custom_struct &v){ return v.x; });
+
+		std::fill(counts.begin(), counts.end(), 0);
+		for (size_t i = 0; i < 1000000; i++)
+			counts[sampler.sample(_rng)]++;
+		for (size_t i = 0; i < ws.size(); i++) {
+			target[i] = (float)counts[i] / 1000000.f;
+			if (std::abs(target[i] - vec[i].x) > 0.01)
+				return 1;
+		}
+		std::cout << target << std::endl;
+	}
+
+	{
+		// systematic resampling selects each item floor or ceil of its
+		// expected count
+		const size_t m = 1000000;
+		std::vector<size_t> indices(m);
+		if (!ncr::low_variance_resample(std::span<const float>(ws), std::span<size_t>(indices), _rng))
+			return 1;
+
+		std::vector<ptrdiff_t> counts(ws.size(), 0);
+		for (size_t i = 0; i < indices.size(); i++) {
+			counts[indices[i]]++;
+		}
+		const float total = std::accumulate(ws.begin(), ws.end(), 0.f);
+		std::vector<float> target(ws.size(), 0.0);
+		for (size_t i = 0; i < ws.size(); i++) {
+			target[i] = (float)counts[i] / (float)m;
+			if (std::abs(counts[i] - (double)m * ws[i] / total) > 1.0 + 1e-3 * m * ws[i])
+				return 1;
+		}
+		std::cout << target << std::endl;
+
+		// struct accessor, stratified scheme, and rejection of zero weights
+		std::vector<custom_struct> vec{{.x = 0.1}, {.x = 0.65}, {.x = 0.0}, {.x = 0.1}, {.x = 0.0}, {.x = 0.15}, {.x = 0.0}};
+		indices = ncr::low_variance_sampler(vec, m, _rng, [](const custom_struct &v){ return v.x; });
+		if (indices.size() != m || !std::is_sorted(indices.begin(), indices.end()))
+			return 1;
+		indices = ncr::low_variance_resample(std::span<const float>(ws), m, _rng, ncr::resampling_scheme::stratified);
+		std::fill(counts.begin(), counts.end(), 0);
+		for (size_t i = 0; i < indices.size(); i++)
+			counts[indices[i]]++;
+		for (size_t i = 0; i < ws.size(); i++) {
+			target[i] = (float)counts[i] / (float)m;
+			if (std::abs(target[i] - ws[i] / total) > 0.01)
+				return 1;
+		}
+		std::cout << target << std::endl;
+
+		std::vector<float> zeros(4, 0.f);
+		if (ncr::low_variance_resample(std::span<const float>(zeros), std::span<size_t>(indices), _rng))
+			return 1;
+	}
+
+	{
+		// chunked parallel prefix sum for large particle counts
+		const size_t n = 200000;
+		std::uniform_real_distribution<double> unif(0.0, 1.0);
+		std::vector<double> weights(n);
+		for (auto &w : weights)
+			w = unif(*_rng) < 0.3 ? 0.0 : unif(*_rng);
+		const double total = std::accumulate(weights.begin(), weights.end(), 0.0);
+
+		ncr::thread_pool pool(4);
+		for (auto scheme : {ncr::resampling_scheme::systematic, ncr::resampling_scheme::stratified}) {
+			std::vector<size_t> indices(n);
+			if (!ncr::low_variance_resample(std::span<const double>(weights), std::span<size_t>(indices), _rng, scheme, &pool, 4096))
+				return 1;
+			if (!std::is_sorted(indices.begin(), indices.end()))
+				return 1;
+
+			std::vector<size_t> counts(n, 0);
+			for (auto i : indices)
+				counts[i]++;
+			for (size_t i = 0; i < n; i++) {
+				if (weights[i] == 0.0 && counts[i] != 0)
+					return 1;
+				if (scheme == ncr::resampling_scheme::systematic &&
+				    std::abs((double)counts[i] - n * weights[i] / total) > 1.0 + 1e-6)
+					return 1;
+			}
+
+			// particles are replaced in place by their selected copies
+			std::vector<size_t> particles(n);
+			std::iota(particles.begin(), particles.end(), 0);
+			if (!ncr::resample_inplace(std::span<size_t>(particles), std::span<const size_t>(indices)))
+				return 1;
+			std::sort(particles.begin(), particles.end());
+			if (particles != indices)
+				return 1;
+		}
+		std::cout << "resampled " << n << " particles in parallel" << std::endl;
+	}
+
+	{
+		// 1D localization with particles stored as structure of arrays. The
+		// measurement noise derives from the chunk, so that results with and
+		// without pool are comparable
+		using state_t = ncr::particle_columns<double, double>; // position, velocity
+		const size_t n = 100000;
+		const double sigma_z = 2.0;
+
+		ncr::thread_pool pool(4);
+		for (ncr::thread_pool *p : {(ncr::thread_pool*)nullptr, &pool}) {
+			ncr::particle_filter_soa<state_t> pf(n, 1234);
+			pf.pool = p;
+			std::mt19937_64 init(4321);
+			std::uniform_real_distribution<double> unif(-50.0, 50.0);
+			for (size_t i = 0; i < n; i++) {
+				pf.state.column<0>()[i] = unif(init);
+				pf.state.column<1>()[i] = 1.0;
+			}
+
+			double truth = 10.0;
+			size_t n_resampled = 0;
+			std::mt19937_64 meas(99);
+			std::normal_distribution<double> noise_z(0.0, sigma_z);
+			for (unsigned t = 0; t < 50; t++) {
+				truth += 1.0;
+				const double z = truth + noise_z(meas);
+				auto predict = [t](state_t &s, size_t begin, size_t end, unsigned) {
+					std::mt19937_64 rng(t * 1000003 + begin);
+					std::normal_distribution<double> noise(0.0, 0.3);
+					auto &x = s.column<0>();
+					auto &v = s.column<1>();
+					for (size_t i = begin; i < end; i++)
+						x[i] += v[i] + noise(rng);
+				};
+				auto loglik = [z, sigma_z](const state_t &s, size_t begin, size_t end, std::span<double> out, unsigned) {
+					const auto &x = s.column<0>();
+					for (size_t i = begin; i < end; i++) {
+						const double d = (x[i] - z) / sigma_z;
+						out[i - begin] = -0.5 * d * d;
+					}
+				};
+				n_resampled += pf.step(predict, loglik);
+			}
+			const double estimate = pf.expectation([](const state_t &s, size_t i) { return s.column<0>()[i]; });
+			if (std::abs(estimate - truth) > 1.5 || n_resampled == 0)
+				return 1;
+			std::cout << "soa particle filter (" << (p ? "pool" : "serial") << "): estimate "
+				<< std::setprecision(4) << estimate << ", truth " << truth
+				<< ", resampled " << n_resampled << " times" << std::endl;
+		}
+
+		// log-space weights survive likelihoods that underflow in linear space
+		ncr::particle_filter_soa<ncr::particle_columns<double>> pf(4);
+		const double ess = pf.update([](auto &, size_t begin, size_t end, std::span<double> out, unsigned) {
+			for (size_t i = begin; i < end; i++)
+				out[i - begin] = -2000.0 - double(i);
+		});
+		if (!(ess > 1.0 && ess < 4.0) || std::abs(pf.weights[0] / pf.weights[1] - std::exp(1.0)) > 1e-9)
+			return 1;
+	}
+
+	{
+		struct weighted { double weight; int id; };
+		std::vector<weighted> particles{{0.1, 0}, {0.0, 1}, {0.5, 2}, {0.4, 3}};
+		ncr::low_variance_resampler<weighted> resampler(1234);
+		std::vector<size_t> indices = resampler.resample(particles);
+		if (indices.size() != particles.size() || !std::is_sorted(indices.begin(), indices.end()))
+			return 1;
+		if (std::count(indices.begin(), indices.end(), 1) != 0 || std::count(indices.begin(), indices.end(), 2) != 2)
+			return 1;
+	}
 
 	return 0;
 }
@@ -0,0 +1,471 @@
+#include <iostream>
+#include <vector>
+#include <atomic>
+#include <thread>
+#include <chrono>
+#include <ctime>
+#include <fstream>
+
+#include <ncr/ncr_units.hpp>
+#include <ncr/ncr_memory.hpp>
+#include <ncr/ncr_random.hpp>
+#include <ncr/ncr_simulation.hpp>
+
+using namespace ncr;
+
+
+// state of a tiny network that is advanced in several phases per tick
+struct network {
+	std::vector<double>   v;
+	std::vector<uint8_t>  spiked;
+	std::vector<unsigned> worker_hits;
+	std::atomic<size_t>   n_spikes = 0;
+	size_t                n_delivered = 0;
+	std::vector<double>   dts;
+	bool                  order_ok = true;
+};
+
+
+static void
+integrate(const iteration_state *iter, size_t begin, size_t end, unsigned worker, void *data)
+{
+	auto net = static_cast<network*>(data);
+	net->worker_hits[worker] += 1;
+	for (size_t i = begin; i < end; i++) {
+		net->v[i] += iter->dt * static_cast<double>(i % 7 + 1);
+		net->spiked[i] = net->v[i] > 1.0;
+	}
+}
+
+
+static void
+emit(const iteration_state *, size_t begin, size_t end, unsigned, void *data)
+{
+	auto net = static_cast<network*>(data);
+	size_t local = 0;
+	for (size_t i = begin; i < end; i++) {
+		if (net->spiked[i]) {
+			local += 1;
+			net->v[i] = 0.0;
+		}
+	}
+	net->n_spikes += local;
+}
+
+
+static void
+deliver(const iteration_state *iter, size_t, size_t, unsigned, void *data)
+{
+	// serial phase, all spikes of this tick must have been emitted already
+	auto net = static_cast<network*>(data);
+	for (size_t i = 0; i < net->spiked.size(); i++)
+		if (net->spiked[i] && net->v[i] != 0.0)
+			net->order_ok = false;
+	net->n_delivered = net->n_spikes;
+	net->dts.push_back(iter->dt);
+}
+
+
+bool
+test_phases()
+{
+	std::cout << "simulation phases\n";
+
+	const size_t n = 10000;
+	simulation_config config{.nthreads = 4, .t_max = 10.0_ms, .dt = 0.1_ms};
+	simulation_callbacks callbacks;
+
+	network net;
+	net.v.assign(n, 0.0);
+	net.spiked.assign(n, 0);
+	net.worker_hits.assign(config.nthreads, 0);
+	callbacks.data = &net;
+
+	auto sim = simulation_setup(config, callbacks);
+	simulation_add_phase(sim, "integrate", integrate, n, 512);
+	simulation_add_phase(sim, "emit", emit, n, 2048);
+	simulation_add_phase(sim, "deliver", deliver);
+	auto stats = simulation_run(sim);
+
+	// reference run on a single thread with the same time steps
+	std::vector<double> v_ref(n, 0.0);
+	size_t n_spikes_ref = 0;
+	const size_t n_ticks_ref = net.dts.size();
+	for (double dt : net.dts) {
+		for (size_t i = 0; i < n; i++) {
+			v_ref[i] += dt * static_cast<double>(i % 7 + 1);
+			if (v_ref[i] > 1.0) {
+				v_ref[i] = 0.0;
+				n_spikes_ref += 1;
+			}
+		}
+	}
+
+	bool ok = n_ticks_ref > 0
+	       && net.v == v_ref
+	       && net.n_spikes == n_spikes_ref
+	       && net.n_delivered == n_spikes_ref
+	       && net.order_ok;
+
+	for (const auto &phase : sim->phases)
+		ok &= phase.timer.n_calls == n_ticks_ref;
+
+	size_t n_chunks = 0;
+	for (auto h : net.worker_hits)
+		n_chunks += h;
+	ok &= n_chunks == n_ticks_ref * ((n + 511) / 512);
+
+	// instrumentation of the run
+	ok &= stats.ticks + 1 == n_ticks_ref;
+	ok &= std::abs(stats.effective_simtime_ms - config.t_max) < 1e-9;
+	ok &= stats.realtime_factor > 0.0;
+	ok &= stats.tick_p50 <= stats.tick_p99 && stats.tick_p99 <= stats.tick_max && stats.tick_max.count() > 0;
+	ok &= sim->profile.tick_latency.count == n_ticks_ref;
+	std::cout << "  tick latency p50/p99/max: " << stats.tick_p50.count() << " / "
+	          << stats.tick_p99.count() << " / " << stats.tick_max.count() << " ns\n";
+
+	simulation_finish(&sim);
+	std::cout << net.n_spikes << " spikes" << (ok ? ", ok" : ", FAILED") << "\n";
+	return ok;
+}
+
+
+// state of the pause and command test
+struct control {
+	std::atomic<std::uint64_t> ticks = 0;
+	std::atomic<std::uint64_t> ticks_at_pause = 0;
+	std::atomic<bool>          pinged = false;
+};
+
+
+static bool
+never_stop(const iteration_state *, void *)
+{
+	return false;
+}
+
+
+static void
+count_tick(const iteration_state *, void *data)
+{
+	static_cast<control*>(data)->ticks += 1;
+}
+
+
+static void
+cmd_pause(simulation *sim, void *data)
+{
+	static_cast<control*>(data)->ticks_at_pause = static_cast<control*>(data)->ticks.load();
+	simulation_pause(sim);
+}
+
+
+static void
+cmd_ping(simulation *, void *data)
+{
+	static_cast<control*>(data)->pinged = true;
+}
+
+
+static void
+cmd_resume(simulation *sim, void *)
+{
+	simulation_resume(sim);
+}
+
+
+template <typename Pred>
+static bool
+wait_for(Pred &&pred)
+{
+	using namespace std::chrono_literals;
+	for (size_t i = 0; i < 5000; i++) {
+		if (pred())
+			return true;
+		std::this_thread::sleep_for(1ms);
+	}
+	return false;
+}
+
+
+bool
+test_pause_and_commands()
+{
+	using namespace std::chrono_literals;
+	std::cout << "simulation pause and commands\n";
+
+	control ctl;
+	simulation_config config{.nthreads = 1, .timeless = true};
+	simulation_callbacks callbacks{.stop_condition = never_stop, .tick = count_tick, .data = &ctl};
+
+	auto sim = simulation_setup(config, callbacks);
+	std::thread runner([sim]{ simulation_run(sim); });
+
+	bool ok = wait_for([&]{ return ctl.ticks > 1000; });
+
+	// pause from within the loop, then the loop must not tick anymore and
+	// must not burn CPU time
+	ok &= simulation_post(sim, cmd_pause, &ctl);
+	ok &= wait_for([&]{ return sim->paused.load(); });
+	const std::clock_t cpu_start = std::clock();
+	std::this_thread::sleep_for(200ms);
+	const double cpu_ms = 1000.0 * static_cast<double>(std::clock() - cpu_start) / CLOCKS_PER_SEC;
+	ok &= ctl.ticks == ctl.ticks_at_pause;
+	std::cout << "  cpu time while paused: " << cpu_ms << " ms\n";
+	ok &= cpu_ms < 100.0;
+
+	// commands are executed while paused
+	ok &= simulation_post(sim, cmd_ping, &ctl);
+	ok &= wait_for([&]{ return ctl.pinged.load(); });
+	ok &= ctl.ticks == ctl.ticks_at_pause;
+
+	// resume via a command, and stop from outside
+	ok &= simulation_post(sim, cmd_resume);
+	ok &= wait_for([&]{ return ctl.ticks > ctl.ticks_at_pause + 1000; });
+	simulation_stop(sim);
+	runner.join();
+
+	// a paused simulation can be stopped
+	ctl.ticks = 0;
+	std::thread runner2([sim]{ simulation_run(sim); });
+	ok &= wait_for([&]{ return ctl.ticks > 0; });
+	simulation_pause(sim);
+	std::this_thread::sleep_for(10ms);
+	simulation_stop(sim);
+	runner2.join();
+
+	simulation_finish(&sim);
+	std::cout << (ok ? "ok" : "FAILED") << "\n";
+	return ok;
+}
+
+
+bool
+test_latency_histogram()
+{
+	std::cout << "latency histogram\n";
+
+	latency_histogram h;
+	bool ok = h.quantile(0.5).count() == 0;
+
+	// bins are contiguous and ordered
+	for (unsigned i = 0; i + 1 < latency_histogram::n_bins; i++) {
+		ok &= latency_histogram::bin(latency_histogram::lower_bound(i)) == i;
+		ok &= latency_histogram::lower_bound(i) < latency_histogram::lower_bound(i + 1);
+	}
+	ok &= latency_histogram::bin(~std::uint64_t(0)) == latency_histogram::n_bins - 1;
+
+	// quantiles of 1..100000 ns are accurate to the width of a bin
+	for (std::int64_t ns = 1; ns <= 100000; ns++)
+		h.record(std::chrono::nanoseconds{ns});
+	for (double q : {0.5, 0.9, 0.99}) {
+		const double exact = q * 100000.0;
+		const double est   = static_cast<double>(h.quantile(q).count());
+		ok &= est >= exact && est <= exact * 1.125 + 1;
+	}
+	ok &= h.quantile(1.0).count() == 100000;
+
+	std::cout << (ok ? "ok" : "FAILED") << "\n";
+	return ok;
+}
+
+
+static void
+count_report(const simulation *, const simulation_profile *profile, void *data)
+{
+	static_cast<network*>(data)->n_delivered = profile->tick_latency.count;
+}
+
+
+bool
+test_report()
+{
+	std::cout << "simulation report\n";
+
+	simulation_config config{.nthreads = 1, .t_max = 1.0_ms, .dt = 0.1_ms, .report_interval = std::chrono::milliseconds{0}};
+	network net;
+	simulation_callbacks callbacks{.report = count_report, .data = &net};
+
+	auto sim = simulation_setup(config, callbacks);
+	auto stats = simulation_run(sim);
+
+	// with an interval of 0, the report is called after every tick
+	const bool ok = net.n_delivered == stats.ticks + 1;
+	simulation_finish(&sim);
+	std::cout << (ok ? "ok" : "FAILED") << "\n";
+	return ok;
+}
+
+
+// user state that evolves randomly and is part of checkpoints
+struct checkpoint_state {
+	std::vector<double>      v;
+	ncr::philox4x32          rng;
+	ncr::slab_memory<int>    slab{64};
+	std::vector<size_t>      live;
+
+	explicit checkpoint_state(std::uint64_t seed) : v(100, 0.0), rng(seed) {}
+
+	std::vector<simulation_state_block>
+	blocks()
+	{
+		return {
+			simulation_state("v", v),
+			simulation_state("rng", rng),
+			simulation_state("slab", slab),
+			simulation_state("live", live),
+		};
+	}
+
+	double
+	checksum()
+	{
+		double sum = 0.0;
+		for (auto x : v)
+			sum += x;
+		for (auto i : live)
+			sum += 1e-3 * *slab.get(i).value();
+		return sum + static_cast<double>(rng() % 1000);
+	}
+};
+
+
+static void
+checkpoint_tick(const iteration_state *iter, void *data)
+{
+	auto st = static_cast<checkpoint_state*>(data);
+	for (auto &x : st->v)
+		x += static_cast<double>(st->rng() % 100) * iter->dt;
+
+	auto idx = st->slab.alloc();
+	*st->slab.get(idx).value() = static_cast<int>(iter->ticks);
+	st->live.push_back(idx.value());
+	if (st->rng() % 3 == 0) {
+		const size_t k = st->rng() % st->live.size();
+		st->slab.free(st->live[k]);
+		st->live.erase(st->live.begin() + static_cast<std::ptrdiff_t>(k));
+	}
+}
+
+
+static bool
+stop_at_tick_40(const iteration_state *iter, void *)
+{
+	return iter->ticks == 40;
+}
+
+
+bool
+test_checkpoint()
+{
+	std::cout << "simulation checkpoints\n";
+
+	const std::string path = "/tmp/ncr_test_simulation.ckpt";
+	std::remove(path.c_str());
+
+	simulation_config config{.nthreads = 1, .t_max = 10.0_ms, .dt = 0.1_ms};
+
+	// uninterrupted reference run
+	checkpoint_state ref(7);
+	simulation_callbacks cb_ref{.tick = checkpoint_tick, .data = &ref};
+	auto sim = simulation_setup(config, cb_ref);
+	auto stats_ref = simulation_run(sim);
+	simulation_finish(&sim);
+
+	// run until tick 40 and checkpoint
+	checkpoint_state a(7);
+	simulation_callbacks cb_a{.stop_condition = stop_at_tick_40, .tick = checkpoint_tick, .data = &a};
+	sim = simulation_setup(config, cb_a, a.blocks(), path);
+	bool ok = sim && sim->iteration.ticks == 0;
+	simulation_run(sim);
+	ok &= sim->iteration.ticks == 40;
+	ok &= simulation_checkpoint(sim, path);
+	simulation_finish(&sim);
+
+	// resume into fresh state with a different seed
+	checkpoint_state b(99);
+	simulation_callbacks cb_b{.tick = checkpoint_tick, .data = &b};
+	sim = simulation_setup(config, cb_b, b.blocks(), path);
+	ok &= sim && sim->iteration.ticks == 40;
+	auto stats_b = simulation_run(sim);
+	simulation_finish(&sim);
+
+	ok &= stats_b.ticks == stats_ref.ticks;
+	ok &= stats_b.effective_simtime_ms == stats_ref.effective_simtime_ms;
+	ok &= b.v == ref.v && b.live == ref.live && b.checksum() == ref.checksum();
+
+	// periodic checkpoints during a run. Every 20th tick sleeps for longer
+	// than the interval, such that checkpoints are due independently of how
+	// fast the ticks are
+	std::remove(path.c_str());
+	simulation_config config_periodic{.nthreads = 1, .t_max = 10.0_ms, .dt = 0.1_ms,
+		.checkpoint_path = path, .checkpoint_interval = std::chrono::milliseconds{1}};
+	checkpoint_state c(7);
+	simulation_callbacks cb_c{
+		.tick = [](const iteration_state *iter, void *data) {
+			checkpoint_tick(iter, data);
+			if (iter->ticks % 20 == 0)
+				std::this_thread::sleep_for(std::chrono::milliseconds{2});
+		},
+		.data = &c};
+	sim = simulation_setup(config_periodic, cb_c, c.blocks());
+	simulation_run(sim);
+	ok &= sim->profile.checkpoint.n_calls >= 5;
+	std::cout << "  " << sim->profile.checkpoint.n_calls << " periodic checkpoints, mean "
+	          << sim->profile.checkpoint.mean_ns() / 1e3 << " us\n";
+	simulation_finish(&sim);
+
+	// checkpoints from within a tick are rejected, as the tick would be
+	// repeated after restoring
+	struct in_tick_state {
+		simulation  *sim = nullptr;
+		std::string  path;
+		size_t       n_ticks = 0;
+		size_t       n_rejected = 0;
+	} st{.path = path};
+	simulation_callbacks cb_e{
+		.tick = [](const iteration_state *, void *data) {
+			auto st = static_cast<in_tick_state*>(data);
+			st->n_ticks += 1;
+			st->n_rejected += !simulation_checkpoint(st->sim, st->path);
+		},
+		.data = &st};
+	std::remove(path.c_str());
+	sim = simulation_setup(config, cb_e);
+	st.sim = sim;
+	simulation_run(sim);
+	ok &= st.n_ticks > 0 && st.n_rejected == st.n_ticks && !std::ifstream(path);
+	ok &= simulation_checkpoint(sim, path);
+	simulation_finish(&sim);
+
+	// mismatching state is rejected
+	std::vector<double> other(3);
+	simulation_callbacks cb_d{.tick = checkpoint_tick, .data = &c};
+	sim = simulation_setup(config, cb_d, {simulation_state("missing", other)}, path);
+	ok &= sim == nullptr;
+
+	std::remove(path.c_str());
+	std::cout << (ok ? "ok" : "FAILED") << "\n";
+	return ok;
+}
+
+
+int
+main()
+{
+	if (!test_phases())
+		return 1;
+	std::cout << "\n";
+	if (!test_pause_and_commands())
+		return 1;
+	std::cout << "\n";
+	if (!test_latency_histogram())
+		return 1;
+	std::cout << "\n";
+	if (!test_report())
+		return 1;
+	std::cout << "\n";
+	if (!test_checkpoint())
+		return 1;
+	return 0;
+}
@@ -295,6 +295,178 @@ test_notime_mode()
 	// tidy up
 	port_clear_buffers(two, three, four, five);
 }
+
+/*
+ * run a transport with pseudo-random delays, and collect what was received
+ */
+template <typename Traits, typename Fn>
+std::vector<std::vector<double>>
+__run_random_ticks(transport<Traits> &transport, size_t max_ticks, Fn &&opts_for, size_t compact_every = 0)
+{
+	using port_type     = typename ncr::transport<Traits>::port_type;
+	using envelope_type = typename ncr::transport<Traits>::envelope_type;
+
+	port_type source, sink0, sink1;
+	register_ports(transport, &source, &sink0, &sink1);
+	connect(transport, &source, &sink0, &sink1);
+
+	// payload values received per tick, in order of arrival
+	std::vector<std::vector<double>> received(max_ticks);
+
+	size_t state = 1;
+	for (size_t ticks = 0; ticks < max_ticks; ++ticks) {
+		// send a few messages with pseudo-random delays
+		for (size_t i = 0; i < 3; i++) {
+			state = state * 6364136223846793005ull + 1442695040888963407ull;
+			const size_t delay = (state >> 33) % 200;
+			broadcast(transport, &source, payload_t{.value = double(ticks * 10 + i)}, opts_for(ticks + delay));
+		}
+
+		if constexpr (transport_deliverable_traits<Traits, size_t>)
+			process_messages(transport, ticks);
+		else
+			process_messages(transport, [&ticks](const envelope_type &env) -> bool {
+				return env.options.delivery_time <= ticks;
+			});
+
+		// compaction must be invisible to the receivers
+		if (compact_every > 0 && ticks % compact_every == 0)
+			transport_compact(transport);
+
+		for (auto *p: {&sink0, &sink1}) {
+			for (auto env_id: p->buffer)
+				received[ticks].push_back(transport_get_envelope(transport, env_id)->payload.value);
+			port_clear_buffer(*p);
+		}
+	}
+	return received;
+}
+
+struct TOptions {
+	ncr::time_point<ClockType::Ticks> delivery_time;
+};
+
+struct TListTraits {
+	using payload_type = payload_t;
+	using options_type = TOptions;
+};
+
+struct TBucketTraits {
+	using payload_type = payload_t;
+	using options_type = TOptions;
+
+	// use a small calendar to also test the overflow
+	static constexpr size_t calendar_size = 64;
+	static size_t delivery_bucket(const options_type &opts) { return opts.delivery_time.value; }
+};
+
+struct TInlineTraits {
+	using payload_type = payload_t;
+	using options_type = TOptions;
+
+	// comparison and delivery test that can be inlined
+	static bool compare(const auto &left, const auto &right) {
+		return left.options.delivery_time <= right.options.delivery_time;
+	}
+	static bool deliverable(const auto &env, const size_t &ticks) {
+		return env.options.delivery_time <= ticks;
+	}
+};
+
+bool
+test_bucketed_tick_mode()
+{
+	auto comp = [](auto &left, auto &right) -> bool {
+		return left.options.delivery_time <= right.options.delivery_time;
+	};
+	transport<TListTraits>   list_transport(comp);
+	transport<TBucketTraits> bucket_transport(comp);
+	transport<TInlineTraits> inline_transport;
+	transport<TBucketTraits> compact_transport(comp);
+
+	const size_t max_ticks = 1000;
+	auto r0 = __run_random_ticks(list_transport, max_ticks, [](size_t t) { return TOptions{.delivery_time = t}; });
+	auto r1 = __run_random_ticks(bucket_transport, max_ticks, [](size_t t) { return TOptions{.delivery_time = t}; });
+	auto r2 = __run_random_ticks(inline_transport, max_ticks, [](size_t t) { return TOptions{.delivery_time = t}; });
+	auto r3 = __run_random_ticks(compact_transport, max_ticks, [](size_t t) { return TOptions{.delivery_time = t}; }, 50);
+
+	size_t n_delivered = 0;
+	for (auto &r: r1)
+		n_delivered += r.size();
+	const bool same = r0 == r1 && r0 == r2 && r0 == r3;
+	std::cout << "delivered " << n_delivered << " messages, "
+	          << (same ? "identical" : "DIFFERENT") << " to list transport\n";
+	return same;
+}
+
+/*
+ * broadcast one message to many sinks, which should all receive the same
+ * envelope. The envelope must be gone after all sinks released it
+ */
+template <typename Traits>
+bool
+__test_shared_broadcast(transport<Traits> &transport, bool freeze)
+{
+	using port_type     = typename ncr::transport<Traits>::port_type;
+	using envelope_type = typename ncr::transport<Traits>::envelope_type;
+
+	const size_t n_sinks = 100;
+	port_type source;
+	std::vector<port_type> sinks(n_sinks);
+	register_ports(transport, &source);
+	for (auto &sink: sinks) {
+		register_ports(transport, &sink);
+		connect(transport, &source, &sink);
+	}
+	if (freeze)
+		transport_freeze(transport);
+
+	broadcast_shared(transport, &source, payload_t{.value = 3.14}, TOptions{.delivery_time = 1});
+	bool ok = transport.__mem_envelopes.size() == 1;
+
+	// nothing is due at tick 0
+	size_t ticks = 0;
+	auto due = [&ticks](const envelope_type &env) -> bool {
+		return env.options.delivery_time <= ticks;
+	};
+	process_messages(transport, due);
+	for (auto &sink: sinks)
+		ok = ok && sink.buffer.empty();
+
+	ticks = 1;
+	process_messages(transport, due);
+	for (auto &sink: sinks) {
+		ok = ok && sink.buffer.size() == 1 && sink.buffer[0] == sinks[0].buffer[0];
+		ok = ok && transport_get_envelope(transport, sink.buffer[0])->payload.value == 3.14;
+	}
+	ok = ok && transport.__mem_envelopes.size() == 1;
+
+	for (auto &sink: sinks)
+		port_clear_buffer(sink);
+	ok = ok && transport.__mem_envelopes.size() == 0;
+
+	unregister_ports(transport, &source);
+	for (auto &sink: sinks)
+		unregister_ports(transport, &sink);
+	return ok;
+}
+
+bool
+test_shared_broadcast()
+{
+	auto comp = [](auto &left, auto &right) -> bool {
+		return left.options.delivery_time <= right.options.delivery_time;
+	};
+	transport<TListTraits>   list_transport(comp);
+	transport<TBucketTraits> bucket_transport(comp);
+
+	const bool ok = __test_shared_broadcast(list_transport, false)
+	             && __test_shared_broadcast(bucket_transport, false)
+	             && __test_shared_broadcast(list_transport, true);
+	std::cout << "shared broadcast to 100 sinks " << (ok ? "ok" : "FAILED") << "\n";
+	return ok;
+}
+
 /*
 
 
@@ -396,6 +568,210 @@ test_pointers()
 */
 
 
+/*
+ * freeze connectivity into CSR format, and make sure that delivery and edge
+ * slots behave as expected across modifications
+ */
+bool
+test_freeze()
+{
+	transport<TInlineTraits> transport;
+	using port_type = typename ncr::transport<TInlineTraits>::port_type;
+
+	port_type source, sink0, sink1, sink2;
+	register_ports(transport, &source, &sink0, &sink1, &sink2);
+	connect(transport, &source, &sink0, &sink1);
+
+	transport_freeze(transport);
+	bool ok = transport.map.csr.frozen;
+
+	auto e0 = transport_edge(transport, source.index.value(), sink0.index.value());
+	auto e2 = transport_edge(transport, source.index.value(), sink2.index.value());
+	ok = ok && e0 && !e2;
+	if (e0)
+		transport.map.csr.weight[e0.value()] = 0.5;
+
+	broadcast(transport, &source, payload_t{.value = 1.0}, TOptions{.delivery_time = 0});
+	process_messages(transport, size_t(0));
+	ok = ok && sink0.buffer.size() == 1 && sink1.buffer.size() == 1 && sink2.buffer.empty();
+	port_clear_buffers(sink0, sink1);
+
+	// modifications thaw the transport, but delivery still works
+	connect(transport, &source, &sink2);
+	ok = ok && !transport.map.csr.frozen;
+	broadcast(transport, &source, payload_t{.value = 2.0}, TOptions{.delivery_time = 1});
+	process_messages(transport, size_t(1));
+	ok = ok && sink0.buffer.size() == 1 && sink1.buffer.size() == 1 && sink2.buffer.size() == 1;
+	port_clear_buffers(sink0, sink1, sink2);
+
+	// edge slots survive a re-freeze
+	transport_freeze(transport);
+	e0 = transport_edge(transport, source.index.value(), sink0.index.value());
+	e2 = transport_edge(transport, source.index.value(), sink2.index.value());
+	ok = ok && e0 && e2
+	   && transport.map.csr.weight[e0.value()] == 0.5
+	   && transport.map.csr.weight[e2.value()] == 1.0;
+
+	// messages to unregistered sinks are dropped
+	unregister_ports(transport, &sink1);
+	transport_freeze(transport);
+	broadcast(transport, &source, payload_t{.value = 3.0}, TOptions{.delivery_time = 2});
+	process_messages(transport, size_t(2));
+	ok = ok && sink0.buffer.size() == 1 && sink1.buffer.empty() && sink2.buffer.size() == 1;
+	port_clear_buffers(sink0, sink2);
+	ok = ok && transport.__mem_envelopes.size() == 0;
+
+	std::cout << "frozen transport " << (ok ? "ok" : "FAILED") << "\n";
+	return ok;
+}
+
+struct TImmediateTraits : back_inserter_traits, immediate_delivery_traits {
+	using payload_type = payload_t;
+	using options_type = TOptions;
+};
+
+struct TZeroDelayTraits : TInlineTraits {
+	// messages for tick 0 are synchronous, all others are delayed
+	static bool deliver_immediately(const options_type &opts) {
+		return opts.delivery_time.value == 0;
+	}
+};
+
+/*
+ * envelopes which are due on send bypass the transport's buffer
+ */
+bool
+test_immediate()
+{
+	bool ok = true;
+	{
+		transport<TImmediateTraits> transport;
+		using port_type = typename ncr::transport<TImmediateTraits>::port_type;
+		port_type source, sink0, sink1;
+		register_ports(transport, &source, &sink0, &sink1);
+		connect(transport, &source, &sink0, &sink1);
+
+		send(transport, source.index, sink0.index, payload_t{.value = 1.0}, TOptions{.delivery_time = 5});
+		ok = ok && sink0.buffer.size() == 1 && transport.buffer.empty();
+		broadcast_shared(transport, &source, payload_t{.value = 2.0}, TOptions{.delivery_time = 5});
+		ok = ok && sink0.buffer.size() == 2 && sink1.buffer.size() == 1 && transport.buffer.empty();
+		port_clear_buffers(sink0, sink1);
+		ok = ok && transport.__mem_envelopes.size() == 0;
+	}
+	{
+		transport<TZeroDelayTraits> transport;
+		using port_type = typename ncr::transport<TZeroDelayTraits>::port_type;
+		port_type source, sink;
+		register_ports(transport, &source, &sink);
+		connect(transport, &source, &sink);
+
+		send(transport, source.index, sink.index, payload_t{.value = 1.0}, TOptions{.delivery_time = 1});
+		send(transport, source.index, sink.index, payload_t{.value = 2.0}, TOptions{.delivery_time = 0});
+		ok = ok && sink.buffer.size() == 1 && transport.buffer.size() == 1;
+		ok = ok && transport_get_envelope(transport, sink.buffer[0])->payload.value == 2.0;
+		process_messages(transport, size_t(1));
+		ok = ok && sink.buffer.size() == 2 && transport.buffer.empty();
+		port_clear_buffers(sink);
+		ok = ok && transport.__mem_envelopes.size() == 0;
+	}
+	std::cout << "immediate delivery " << (ok ? "ok" : "FAILED") << "\n";
+	return ok;
+}
+
+/*
+ * consume the inbox of a port in a single pass, including envelopes which are
+ * shared with other ports and envelopes which arrive while draining
+ */
+bool
+test_drain()
+{
+	transport<TImmediateTraits> transport;
+	using port_type = typename ncr::transport<TImmediateTraits>::port_type;
+	port_type source, sink0, sink1;
+	register_ports(transport, &source, &sink0, &sink1);
+	connect(transport, &source, &sink0, &sink1);
+
+	for (size_t i = 0; i < 4; i++)
+		send(transport, source.index, sink0.index, payload_t{.value = double(i)}, TOptions{});
+	broadcast_shared(transport, &source, payload_t{.value = 4.0}, TOptions{});
+
+	// replies to sink0 itself must not be consumed in the same pass
+	std::vector<double> values;
+	size_t n = port_drain(sink0, [&](const payload_t &p) {
+		values.push_back(p.value);
+		if (p.value == 0.0)
+			send(transport, source.index, sink0.index, payload_t{.value = 5.0}, TOptions{});
+	});
+	bool ok = n == 5 && values == std::vector<double>{0.0, 1.0, 2.0, 3.0, 4.0};
+	ok = ok && sink0.buffer.size() == 1 && transport.__mem_envelopes.size() == 2;
+
+	// the shared envelope is still alive for sink1
+	double shared = 0.0;
+	n = port_drain(&sink1, [&](const payload_t &p) { shared = p.value; });
+	ok = ok && n == 1 && shared == 4.0 && transport.__mem_envelopes.size() == 1;
+
+	n = port_drain(sink0, [&](const payload_t &p) { shared = p.value; });
+	ok = ok && n == 1 && shared == 5.0 && sink0.buffer.empty();
+	ok = ok && port_drain(sink0, [](const payload_t &) {}) == 0;
+	ok = ok && transport.__mem_envelopes.size() == 0;
+
+	std::cout << "port drain " << (ok ? "ok" : "FAILED") << "\n";
+	return ok;
+}
+
+/*
+ * a ring of shards, in which each source sends to the sink of its own shard
+ * and of the next shard, running on a thread pool
+ */
+bool
+test_partitioned()
+{
+	const size_t n_shards = 4;
+	const size_t max_ticks = 100;
+
+	using port_type = typename ncr::transport<TInlineTraits>::port_type;
+	partitioned_transport<TInlineTraits> pt(n_shards);
+	std::vector<port_type> sources(n_shards), sinks(n_shards);
+	for (size_t k = 0; k < n_shards; k++)
+		register_ports(partitioned_shard(pt, k), &sources[k], &sinks[k]);
+	for (size_t k = 0; k < n_shards; k++) {
+		const size_t next = (k + 1) % n_shards;
+		connect(pt, shard_port{k, sources[k].index.value()}, shard_port{k, sinks[k].index.value()});
+		connect(pt, shard_port{k, sources[k].index.value()}, shard_port{next, sinks[next].index.value()});
+	}
+
+	thread_pool pool(n_shards);
+	bool ok = true;
+	std::vector<bool> shard_ok(n_shards, true);
+	for (size_t ticks = 0; ticks < max_ticks; ticks++) {
+		// each shard sends on its own thread, and checks what arrived
+		pool.run(n_shards, [&](size_t k, unsigned) {
+			const size_t prev = (k + n_shards - 1) % n_shards;
+			double expected = 0.0;
+			if (ticks > 0)
+				expected = double(k * 1000 + ticks - 1) + double(prev * 1000 + ticks - 1);
+
+			double sum = 0.0;
+			const size_t n = port_drain(sinks[k], [&](const payload_t &p) { sum += p.value; });
+			if (n != (ticks > 0 ? 2 : 0) || sum != expected)
+				shard_ok[k] = false;
+
+			broadcast(pt, shard_port{k, sources[k].index.value()},
+					payload_t{.value = double(k * 1000 + ticks)}, TOptions{.delivery_time = ticks + 1});
+		});
+		process_messages(pt, &pool, ticks + 1);
+	}
+	for (size_t k = 0; k < n_shards; k++) {
+		ok = ok && shard_ok[k];
+		port_clear_buffer(sinks[k]);
+		ok = ok && partitioned_shard(pt, k).__mem_envelopes.size() == 0;
+	}
+
+	std::cout << n_shards << " shards, " << max_ticks << " ticks " << (ok ? "ok" : "FAILED") << "\n";
+	return ok;
+}
+
+
 int
 main()
 {
@@ -408,6 +784,30 @@ main()
 	std::cout << "\nmode ignoring time\n";
 	test_notime_mode();
 
+	std::cout << "\nbucketed tick mode\n";
+	if (!test_bucketed_tick_mode())
+		return 1;
+
+	std::cout << "\nshared broadcast\n";
+	if (!test_shared_broadcast())
+		return 1;
+
+	std::cout << "\nfrozen transport\n";
+	if (!test_freeze())
+		return 1;
+
+	std::cout << "\nimmediate delivery\n";
+	if (!test_immediate())
+		return 1;
+
+	std::cout << "\nport drain\n";
+	if (!test_drain())
+		return 1;
+
+	std::cout << "\npartitioned transport\n";
+	if (!test_partitioned())
+		return 1;
+
 	/*
 	std::cout << "\npointer test\n";
 	test_pointers();
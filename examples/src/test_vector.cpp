@@ -142,6 +142,24 @@ test_misc()
 }
 
 
+void
+test_expressions()
+{
+	vector_t<3> y{1.0, 2.0, 3.0}, k1{0.5, 0.5, 0.5}, k2{-1.0, 0.0, 1.0}, r;
+
+	// a single row of a Butcher tableau is evaluated in one loop
+	r = y + (3./40.) * k1 + (9./40.) * k2;
+
+	// expressions can be reduced without storing them
+	const double err = error_norm(r, y - 0.25 * k2);
+
+	std::cout << std::fixed << std::setprecision(COUT_PRECISION);
+	std::cout << "r   = " << r << "\n";
+	std::cout << "err = " << err << "\n";
+	std::cout << "e   = " << (r - y) / 2.0 << "\n";
+}
+
+
 int main()
 {
 	test_daxpy();
@@ -149,6 +167,7 @@ int main()
 	test_vector();
 	test_vector_temporaries();
 	test_misc();
+	test_expressions();
 
 	return 0;
 }
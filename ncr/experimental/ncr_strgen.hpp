@@ -9,6 +9,7 @@
 
 #include <vector>
 #include <algorithm>
+#include <cstdint>
 
 // meh, includes the entire automata file. maybe there's a better way to solve
 // this (only needs basic_string_t at the moment
@@ -88,6 +89,13 @@ struct Random : IGenerator {
 		return ncr::random_string(this->_rng, &this->_alphabet, this->_length);
 	}
 
+	// packed version of operator(), which re-uses the memory of out
+	template <unsigned B>
+	void
+	operator() (ncr::packed_word<B> &out) {
+		ncr::random_string(this->_rng, &this->_alphabet, this->_length, out);
+	}
+
 	virtual void reset() {}
 
 private:
@@ -98,11 +106,42 @@ private:
 
 
 
+/*
+ * __n_strings - number of strings of given length over an alphabet
+ *
+ * Returns 0 if the number does not fit into 64 bits, which is also how
+ * feistel_permutation denotes a space of 2^64 elements. Sets overflow if the
+ * number of strings exceeds 2^64.
+ */
+inline std::uint64_t
+__n_strings(const ncr::basic_alphabet &alph, const size_t length, bool &overflow)
+{
+	overflow = false;
+	std::uint64_t n = 1;
+	for (size_t l = 0; l < length; l++) {
+		if (alph.n_symbols > 1 && n > UINT64_MAX / alph.n_symbols) {
+			// exactly 2^64 strings is representable as a full permutation
+			unsigned bits = 0;
+			while (bits < 64 && (std::uint64_t(1) << bits) < alph.n_symbols)
+				bits++;
+			overflow = (std::uint64_t(1) << bits) != alph.n_symbols || bits * length != 64;
+			return 0;
+		}
+		n *= alph.n_symbols;
+	}
+	return n;
+}
+
+
 /*
  * struct UniqueRandom - Generate random (but unique) strings
  *
  * This (stateful) struct generates random strings without the chance of
- * introducing duplicates.
+ * introducing duplicates. The i-th call yields the string with index p(i),
+ * where p is a keyed pseudo-random permutation of all string indices (see
+ * feistel_permutation). Hence, the generator needs O(1) memory independent of
+ * the number of strings, and works for up to 2^64 strings. reset() draws a new
+ * key from the random number generator.
  */
 struct UniqueRandom : IGenerator
 {
@@ -114,8 +153,12 @@ struct UniqueRandom : IGenerator
 		_rng(rng),
 		_alphabet(alph),
 		_length(length),
-		_n_max(std::pow(alph.n_symbols, length))
+		_i(0)
 	{
+		bool overflow;
+		this->_perm.resize(__n_strings(alph, length, overflow));
+		if (overflow)
+			log_warning("ncr::alphabet::generators::UniqueRandom: more than 2^64 strings of length ", length, ", restricting to the first 2^64.\n");
 		reset();
 	}
 
@@ -124,37 +167,47 @@ struct UniqueRandom : IGenerator
 	virtual ncr::basic_string_t
 	operator() ()
 	{
-		// TODO: make this behavior optional (via flag for constructor)
-		if (_indexes.size() == 0) {
-			log_warning("ncr::alphabet::generators::UniqueRandom exhausted, replenishing via automatic reset.\n");
-			reset();
-		}
-
-		// select a random entry of the list of indexes
-		size_t indx = choice<size_t>(0, this->_indexes.size() - 1, this->_rng);
-
-		// swap the chosen with the last, pop the end (this is a fast method to
-		// pop a random element from a vector)
-		std::swap(_indexes[indx], _indexes.back());
-		indx = _indexes.back();
-		_indexes.pop_back();
+		return ncr::nth_string(&this->_alphabet, this->_length, this->_next());
+	}
 
-		// select the n-th string selected above
-		return ncr::nth_string(&this->_alphabet, this->_length, indx);
+	// packed version of operator(), which re-uses the memory of out
+	template <unsigned B>
+	void
+	operator() (ncr::packed_word<B> &out)
+	{
+		ncr::nth_string(&this->_alphabet, this->_length, this->_next(), out);
 	}
 
 	virtual void reset() {
-		// resize and fill the vector
-		_indexes.resize(_n_max);
-		std::iota(std::begin(_indexes), std::end(_indexes), 0);
+		this->_perm.rekey((*this->_rng)());
+		this->_i = 0;
+		this->_exhausted = false;
 	}
 
 	private:
+		// index of the next string
+		std::uint64_t
+		_next()
+		{
+			// TODO: make this behavior optional (via flag for constructor)
+			if (this->_exhausted) {
+				log_warning("ncr::alphabet::generators::UniqueRandom exhausted, replenishing via automatic reset.\n");
+				reset();
+			}
+
+			// select the string at the permuted index. Note that a size of 0
+			// denotes 2^64 strings, in which case _i wraps around to 0
+			const std::uint64_t indx = this->_perm(this->_i++);
+			this->_exhausted = this->_i == this->_perm.size();
+			return indx;
+		}
+
 		std::mt19937_64 *_rng;
 		const ncr::basic_alphabet &_alphabet;
 		const size_t _length;
-		const size_t _n_max;
-		std::vector<size_t> _indexes;
+		ncr::feistel_permutation _perm;
+		std::uint64_t _i;
+		bool _exhausted = false;
 };
 
 
@@ -182,6 +235,23 @@ struct Successive : IGenerator {
 
 	virtual ncr::basic_string_t
 	operator() () {
+		return ncr::nth_string(&this->_alphabet, this->_length, this->_next());
+	}
+
+	// packed version of operator(), which re-uses the memory of out
+	template <unsigned B>
+	void
+	operator() (ncr::packed_word<B> &out) {
+		ncr::nth_string(&this->_alphabet, this->_length, this->_next(), out);
+	}
+
+	virtual void reset() {
+		this->_n = 0;
+	}
+
+private:
+	size_t
+	_next() {
 		// get the index for the next item, then increment the counter (modulo
 		// the max size)
 		size_t n = this->_n;
@@ -193,14 +263,9 @@ struct Successive : IGenerator {
 		if (this->_n == 0)
 			ncr::log_warning("ncr::alphabet::generators::Successive wrap around detected\n");
 
-		return ncr::nth_string(&this->_alphabet, this->_length, n);
-	}
-
-	virtual void reset() {
-		this->_n = 0;
+		return n;
 	}
 
-private:
 	size_t _n;
 	const size_t _n_max;
 	const ncr::basic_alphabet &_alphabet;
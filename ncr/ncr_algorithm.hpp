@@ -13,14 +13,23 @@
 #pragma once
 
 #include <cmath>
+#include <cassert>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <algorithm>
+#include <concepts>
 #include <functional>
 #include <iterator>
 #include <map>
+#include <numeric>
 #include <random>
+#include <span>
 #include <string>
 #include <vector>
 
 #include <ncr/ncr_utils.hpp>
+#include <ncr/ncr_parallel.hpp>
 
 namespace ncr
 {
@@ -132,54 +141,465 @@ weighted_sampler_std(const ContainerT &weights, size_t n_items, RngT *rng)
 
 
 /*
- * low_variance_sampler - sample items from a container with low variance
+ * alias_sampler - reusable weighted sampler based on the alias method
+ *
+ * In contrast to weighted_sampler and weighted_sampler_std, which prepare
+ * their tables on every call, the sampler is built once in O(n) with Vose's
+ * variant of Walker's alias method and afterwards draws samples in O(1). When
+ * the weights change, e.g. after the fitness of a population was evaluated
+ * again, rebuild() recomputes the tables in place without reallocating memory
+ * as long as the number of weights does not grow.
+ *
+ * Example:
+ *
+ *     ncr::alias_sampler<double> sampler(fitness);
+ *     for (size_t i = 0; i < n_offspring; i++)
+ *         parents[i] = sampler.sample(rng);
  *
  * template type arguments:
- *	T    - type of the container
- *	U    - type of the element inside a container
- *  P    - precision type, e.g. float, double, etc.
- *  RngT - random number generator type
+ *     P - precision type of the tables, e.g. float or double
+ */
+template <typename P = double>
+requires std::floating_point<P>
+struct alias_sampler
+{
+	// probability to keep column i, otherwise alias[i] is returned
+	std::vector<P>      prob;
+	std::vector<size_t> alias;
+
+	alias_sampler() = default;
+
+	template <typename ContainerT>
+	explicit
+	alias_sampler(const ContainerT &weights)
+	{
+		this->rebuild(weights);
+	}
+
+	template <typename ContainerT, typename ValueFn>
+	alias_sampler(const ContainerT &cont, ValueFn &&value)
+	{
+		this->rebuild(cont, std::forward<ValueFn>(value));
+	}
+
+	size_t size() const { return this->prob.size(); }
+	bool   empty() const { return this->prob.empty(); }
+
+	/*
+	 * rebuild - recompute the tables from a container of weights
+	 *
+	 * value is a function that produces the weight of an element, see
+	 * weighted_sampler. Weights must be non-negative. Returns false and leaves
+	 * the sampler empty if there is no positive weight.
+	 */
+	template <typename ContainerT, typename ValueFn>
+	bool
+	rebuild(const ContainerT &cont, ValueFn &&value)
+	{
+		const size_t n = std::size(cont);
+		this->prob.resize(n);
+		this->alias.resize(n);
+		this->_small.clear();
+		this->_large.clear();
+		this->_small.reserve(n);
+		this->_large.reserve(n);
+
+		size_t i = 0;
+		P sum = P(0);
+		for (const auto &elem : cont) {
+			const P w = static_cast<P>(value(elem));
+			assert(w >= P(0));
+			this->prob[i++] = w;
+			sum += w;
+		}
+		if (!(sum > P(0))) {
+			this->prob.clear();
+			this->alias.clear();
+			return false;
+		}
+
+		// scale to a mean of 1 and split into under- and overfull columns
+		const P scale = static_cast<P>(n) / sum;
+		for (i = 0; i < n; i++) {
+			this->prob[i] *= scale;
+			this->alias[i] = i;
+			if (this->prob[i] < P(1))
+				this->_small.push_back(i);
+			else
+				this->_large.push_back(i);
+		}
+
+		// fill each underfull column with the excess of an overfull one
+		while (!this->_small.empty() && !this->_large.empty()) {
+			const size_t s = this->_small.back();
+			const size_t l = this->_large.back();
+			this->_small.pop_back();
+
+			this->alias[s] = l;
+			this->prob[l] = (this->prob[l] + this->prob[s]) - P(1);
+			if (this->prob[l] < P(1)) {
+				this->_large.pop_back();
+				this->_small.push_back(l);
+			}
+		}
+
+		// whatever remains is full up to rounding errors
+		for (size_t l : this->_large)
+			this->prob[l] = P(1);
+		for (size_t s : this->_small)
+			this->prob[s] = P(1);
+		return true;
+	}
+
+	template <typename ContainerT>
+	bool
+	rebuild(const ContainerT &weights)
+	{
+		return this->rebuild(weights, [](const auto &w) { return w; });
+	}
+
+	/*
+	 * sample - draw a single index in O(1)
+	 *
+	 * A single uniform number selects the column and decides between the
+	 * column and its alias.
+	 */
+	template <typename RngT = std::mt19937_64>
+	size_t
+	sample(RngT *rng) const
+	{
+		assert(!this->empty());
+
+		std::uniform_real_distribution<P> unif(P(0), P(1));
+		const P u = unif(*rng) * static_cast<P>(this->size());
+		const size_t i = std::min(static_cast<size_t>(u), this->size() - 1);
+		return (u - static_cast<P>(i)) < this->prob[i] ? i : this->alias[i];
+	}
+
+	/*
+	 * sample - draw out.size() indexes into out
+	 */
+	template <typename RngT = std::mt19937_64>
+	void
+	sample(std::span<size_t> out, RngT *rng) const
+	{
+		for (auto &idx : out)
+			idx = this->sample(rng);
+	}
+
+	/*
+	 * sample - draw n_items indexes, as weighted_sampler does
+	 */
+	template <typename RngT = std::mt19937_64>
+	std::vector<size_t>
+	sample(size_t n_items, RngT *rng) const
+	{
+		std::vector<size_t> indices(n_items);
+		this->sample(std::span<size_t>(indices), rng);
+		return indices;
+	}
+
+private:
+	// work lists of the construction, kept to avoid reallocations
+	std::vector<size_t> _small;
+	std::vector<size_t> _large;
+};
+
+
+/*
+ * resampling_scheme - how the points of a low variance resampler are placed
+ *
+ * systematic uses a single random offset for all points, stratified draws an
+ * independent offset within each of the n equally sized strata.
+ */
+enum class resampling_scheme
+{
+	systematic,
+	stratified,
+};
+
+
+/*
+ * __resample_merge - assign points to the particles of a chunk
+ *
+ * Walks the particles [i_begin, i_end) and the points [j_begin, j_end) in a
+ * single merge pass. acc is the sum of all weights before i_begin, and point
+ * j is located at point(j). All points of the range must be at least acc.
+ */
+template <typename P, typename PointFn>
+inline void
+__resample_merge(
+		std::span<const P> weights, size_t i_begin, size_t i_end, P acc,
+		size_t j_begin, size_t j_end, PointFn &&point,
+		std::span<size_t> indices)
+{
+	size_t i = i_begin;
+	acc += weights[i];
+	for (size_t j = j_begin; j < j_end; j++) {
+		const P u = point(j);
+		while (u >= acc && i + 1 < i_end)
+			acc += weights[++i];
+		indices[j] = i;
+	}
+}
+
+
+/*
+ * __resample_first_point - first point j in [0, m) with point(j) >= value
+ */
+template <typename P, typename PointFn>
+inline size_t
+__resample_first_point(size_t m, P value, PointFn &&point)
+{
+	size_t lo = 0, hi = m;
+	while (lo < hi) {
+		const size_t mid = lo + (hi - lo) / 2;
+		if (point(mid) < value)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+	return lo;
+}
+
+
+/*
+ * low_variance_resample - systematic or stratified resampling of particles
+ *
+ * Draws indices.size() particle indexes proportionally to weights, such that
+ * particle i is selected either floor(m * w_i / W) or ceil(m * w_i / W) times
+ * for the systematic scheme, where W is the sum of all weights and m the
+ * number of indexes to draw. In contrast to weighted_sampler, no cumulative
+ * sums are stored, and the weights are traversed only once after summing
+ * them up. The resulting indexes are sorted, see resample_inplace.
+ *
+ * If a pool is given and there are more than grain weights, the prefix sum
+ * and the merge run chunk-wise on the workers of the pool. The result then
+ * depends on the grain, because the weights are summed up in a different
+ * order, but not on the number of workers. The stratified scheme draws its
+ * offsets on the calling thread into scratch memory in this case.
  *
- * TODO: extract U from the container (e.g. via ''contained_type'' or similar)
+ * Returns false if there are no weights or the weights do not sum to a
+ * positive finite value. Weights must be non-negative.
  */
-template <typename T, typename U, typename P, typename RngT = std::mt19937_64>
+template <typename P, typename RngT = std::mt19937_64>
 requires std::floating_point<P>
-std::vector<size_t>
-low_variance_sampler(T &container, size_t n_items, RngT *rng,
-                     const std::function<P(const U *elem)> &weight_fn)
-{
-	// uniform random distribution on [0, 1]
-	std::uniform_real_distribution<P> unif(static_cast<P>(0.0),
-	                                       static_cast<P>(1.0));
-
-	// number of elements in the container
-	std::vector<size_t> indices(n_items);
-
-	// select the agent with maximal fitness
-	auto max_item =
-	    std::max_element(container.begin(), container.end(),
-	                     [weight_fn](const U *left, const U *right) {
-		                     return weight_fn(left) < weight_fn(right);
-	                     });
-	auto max_weight = weight_fn(*max_item);
-
-	// weighting
-	auto beta       = 0.0;
-	// random start index for sampling
-	size_t index    = unif_random(rng);
-	for (size_t i = 0; i < n_items; i++) {
-		beta += unif(*rng) * 2.0 * max_weight;
-		while (beta > weight_fn(container[index])) {
-			beta -= weight_fn(container[index]);
-			index = (index + 1) % n_items;
+bool
+low_variance_resample(
+		std::span<const P> weights,
+		std::span<size_t>  indices,
+		RngT              *rng,
+		resampling_scheme  scheme = resampling_scheme::systematic,
+		thread_pool       *pool   = nullptr,
+		size_t             grain  = size_t(1) << 16)
+{
+	const size_t n = weights.size();
+	const size_t m = indices.size();
+	if (n == 0)
+		return false;
+	if (grain == 0)
+		grain = 1;
+
+	std::uniform_real_distribution<P> unif(P(0), P(1));
+	const bool parallel = pool && pool->size() > 1 && n > grain;
+
+	// serial path: one pass to sum up, one merge pass
+	if (!parallel) {
+		const P total = std::accumulate(weights.begin(), weights.end(), P(0));
+		if (!(total > P(0)) || !std::isfinite(total))
+			return false;
+		if (m == 0)
+			return true;
+
+		const P step = total / static_cast<P>(m);
+		if (scheme == resampling_scheme::systematic) {
+			const P offset = unif(*rng);
+			__resample_merge(weights, 0, n, P(0), 0, m,
+					[&](size_t j) { return (static_cast<P>(j) + offset) * step; },
+					indices);
+		}
+		else {
+			__resample_merge(weights, 0, n, P(0), 0, m,
+					[&](size_t j) { return (static_cast<P>(j) + unif(*rng)) * step; },
+					indices);
 		}
-		indices[i] = index;
+		return true;
 	}
 
+	// parallel path: chunk sums, exclusive scan over the chunks, merge
+	const size_t n_chunks = (n + grain - 1) / grain;
+	std::vector<P> prefix(n_chunks + 1, P(0));
+	pool->run(n_chunks, [&](size_t c, unsigned) {
+		const size_t begin = c * grain;
+		const size_t end   = std::min(n, begin + grain);
+		prefix[c + 1] = std::accumulate(weights.begin() + begin, weights.begin() + end, P(0));
+	});
+	for (size_t c = 0; c < n_chunks; c++)
+		prefix[c + 1] += prefix[c];
+
+	const P total = prefix[n_chunks];
+	if (!(total > P(0)) || !std::isfinite(total))
+		return false;
+	if (m == 0)
+		return true;
+
+	const P step = total / static_cast<P>(m);
+	P offset = P(0);
+	std::vector<P> offsets;
+	if (scheme == resampling_scheme::systematic)
+		offset = unif(*rng);
+	else {
+		offsets.resize(m);
+		for (auto &o : offsets)
+			o = unif(*rng);
+	}
+	auto point = [&](size_t j) {
+		return (static_cast<P>(j) + (offsets.empty() ? offset : offsets[j])) * step;
+	};
+
+	pool->run(n_chunks, [&](size_t c, unsigned) {
+		const size_t begin   = c * grain;
+		const size_t end     = std::min(n, begin + grain);
+		const size_t j_begin = c == 0 ? 0 : __resample_first_point(m, prefix[c], point);
+		const size_t j_end   = c + 1 == n_chunks ? m : __resample_first_point(m, prefix[c + 1], point);
+		if (j_begin < j_end)
+			__resample_merge(weights, begin, end, prefix[c], j_begin, j_end, point, indices);
+	});
+	return true;
+}
+
+
+/*
+ * low_variance_resample - convenience variant that returns m indexes
+ */
+template <typename P, typename RngT = std::mt19937_64>
+requires std::floating_point<P>
+std::vector<size_t>
+low_variance_resample(
+		std::span<const P> weights,
+		size_t             m,
+		RngT              *rng,
+		resampling_scheme  scheme = resampling_scheme::systematic,
+		thread_pool       *pool   = nullptr)
+{
+	std::vector<size_t> indices(m);
+	if (!low_variance_resample(weights, std::span<size_t>(indices), rng, scheme, pool))
+		indices.clear();
 	return indices;
 }
 
 
+/*
+ * resample_inplace - reorder n particles that are not stored in a span
+ *
+ * Same as the span variant below, but particles are copied with
+ * copy_fn(dst, src), e.g. to copy all columns of particles that are stored as
+ * structure of arrays. The indices must be sorted.
+ */
+template <typename CopyFn>
+bool
+resample_inplace(size_t n, std::span<const size_t> indices, CopyFn &&copy_fn)
+{
+	if (indices.size() != n)
+		return false;
+	if (n == 0)
+		return true;
+	if (!std::is_sorted(indices.begin(), indices.end()) || indices.back() >= n)
+		return false;
+
+	// next slot that is not selected by any index. r trails the free slot
+	// candidate f through the sorted indices
+	size_t f = 0, r = 0;
+	auto next_free = [&]() {
+		while (true) {
+			while (r < n && indices[r] < f)
+				r++;
+			if (r < n && indices[r] == f) {
+				f++;
+				continue;
+			}
+			return f++;
+		}
+	};
+
+	// copies of a particle only overwrite unselected slots, so no source is
+	// ever overwritten
+	for (size_t j = 0; j < n; ) {
+		const size_t i = indices[j];
+		size_t k = j + 1;
+		while (k < n && indices[k] == i)
+			k++;
+		for (size_t c = j + 1; c < k; c++)
+			copy_fn(next_free(), i);
+		j = k;
+	}
+	return true;
+}
+
+
+/*
+ * resample_inplace - replace particles by the particles selected by indices
+ *
+ * After the call, the container holds the same multiset of particles as
+ * {particles[indices[0]], particles[indices[1]], ...}, albeit not in the
+ * order of indices: particles that were selected at least once stay where
+ * they are, and their copies fill the slots of particles that were not
+ * selected. This requires sorted indices, as produced by
+ * low_variance_resample, and does not allocate. Unsorted indices fall back
+ * to a gather into a temporary copy.
+ *
+ * Returns false if the number of indices does not match the number of
+ * particles or an index is out of range.
+ */
+template <typename T>
+bool
+resample_inplace(std::span<T> particles, std::span<const size_t> indices)
+{
+	const size_t n = particles.size();
+	if (indices.size() != n)
+		return false;
+	if (n == 0)
+		return true;
+
+	if (!std::is_sorted(indices.begin(), indices.end())) {
+		if (*std::max_element(indices.begin(), indices.end()) >= n)
+			return false;
+		std::vector<T> tmp(particles.begin(), particles.end());
+		for (size_t j = 0; j < n; j++)
+			particles[j] = tmp[indices[j]];
+		return true;
+	}
+	return resample_inplace(n, indices, [&](size_t dst, size_t src) { particles[dst] = particles[src]; });
+}
+
+
+/*
+ * low_variance_sampler - sample items from a container with low variance
+ *
+ * Gathers the weights of all elements of the container once via weight_fn
+ * and then draws n_items indexes with systematic low_variance_resample.
+ *
+ * template type arguments:
+ *	T        - type of the container
+ *	RngT     - random number generator type
+ *	WeightFn - function to get the weight of an element of the container
+ */
+template <typename T, typename RngT = std::mt19937_64, typename WeightFn>
+std::vector<size_t>
+low_variance_sampler(const T &container, size_t n_items, RngT *rng, WeightFn &&weight_fn)
+{
+	using P = std::decay_t<std::invoke_result_t<WeightFn&, const typename T::value_type&>>;
+	static_assert(std::floating_point<P>, "weight_fn must return a floating point type");
+
+	std::vector<P> weights;
+	weights.reserve(std::size(container));
+	for (const auto &elem : container)
+		weights.push_back(weight_fn(elem));
+
+	return low_variance_resample(std::span<const P>(weights), n_items, rng);
+}
+
+
 /*
  * min - compute the minimum value from several arguments
  *
@@ -324,6 +744,287 @@ levensthein_dynamic(InputIt a_first, InputIt a_last, InputIt b_first,
 }
 
 
+/*
+ * levensthein_scratch - reusable memory of the bit-parallel Levensthein
+ * distance
+ *
+ * Passing the same scratch object to several calls avoids any allocation once
+ * the buffers are large enough for the longest sequence, which is relevant
+ * when computing millions of distances. A scratch object must not be used by
+ * several threads at the same time.
+ *
+ * template type arguments:
+ *     T - type of the symbols of the sequences
+ */
+template <typename T>
+struct levensthein_scratch
+{
+	// symbols of a single byte are looked up in a table, all other symbols
+	// via binary search in the sorted symbols of the first sequence
+	constexpr static bool byte_table = sizeof(T) == 1 && (std::is_integral_v<T> || std::is_enum_v<T>);
+
+	// words of the match masks of each symbol
+	std::vector<std::uint64_t> peq;
+
+	// sorted unique symbols (only used without byte_table)
+	std::vector<T>             symbols;
+
+	// bit vectors of vertical positive and negative deltas
+	std::vector<std::uint64_t> pv;
+	std::vector<std::uint64_t> mv;
+
+	// rows of the banded dynamic programming variant
+	std::vector<size_t>        row0;
+	std::vector<size_t>        row1;
+};
+
+
+/*
+ * __levensthein_block - advance one 64 bit block of the Myers recurrence
+ *
+ * This is the block based formulation of Hyyrö (2003), see also edlib. hin is
+ * the horizontal delta coming from the block above (-1, 0, or +1), and the
+ * function returns the horizontal delta at the row selected by out_bit.
+ */
+inline int
+__levensthein_block(std::uint64_t &pv, std::uint64_t &mv, std::uint64_t eq, const int hin, const std::uint64_t out_bit)
+{
+	const std::uint64_t hin_neg = hin < 0 ? 1 : 0;
+	const std::uint64_t hin_pos = hin > 0 ? 1 : 0;
+
+	const std::uint64_t xv = eq | mv;
+	eq |= hin_neg;
+	const std::uint64_t xh = (((eq & pv) + pv) ^ pv) | eq;
+	std::uint64_t ph = mv | ~(xh | pv);
+	std::uint64_t mh = pv & xh;
+
+	const int hout = int((ph & out_bit) != 0) - int((mh & out_bit) != 0);
+
+	ph = (ph << 1) | hin_pos;
+	mh = (mh << 1) | hin_neg;
+	pv = mh | ~(xv | ph);
+	mv = ph & xv;
+	return hout;
+}
+
+
+/*
+ * __levensthein_myers - bit-parallel Levensthein distance with an upper bound
+ *
+ * Returns the distance between a and b if it is at most k, and k + 1
+ * otherwise. The computation stops as soon as the distance is known to
+ * exceed k, which is the case when the score in the last row minus the number
+ * of remaining columns is larger than k.
+ */
+template <typename InputIt, typename T>
+size_t
+__levensthein_myers(
+		InputIt a_first, InputIt a_last,
+		InputIt b_first, InputIt b_last,
+		size_t k,
+		levensthein_scratch<T> &scratch)
+{
+	const size_t m = std::distance(a_first, a_last);
+	const size_t n = std::distance(b_first, b_last);
+
+	// the distance is at least the difference of the lengths
+	const size_t len_diff = m > n ? m - n : n - m;
+	if (len_diff > k)
+		return k + 1;
+	if (m == 0 || n == 0)
+		return len_diff;
+
+	const size_t W = (m + 63) / 64;
+
+	// build the match masks of the symbols of a
+	if constexpr (levensthein_scratch<T>::byte_table) {
+		scratch.peq.assign(256 * W, 0);
+		size_t i = 0;
+		for (auto it = a_first; it != a_last; ++it, ++i)
+			scratch.peq[size_t(static_cast<unsigned char>(*it)) * W + i / 64] |= std::uint64_t(1) << (i % 64);
+	}
+	else {
+		scratch.symbols.assign(a_first, a_last);
+		std::sort(scratch.symbols.begin(), scratch.symbols.end());
+		scratch.symbols.erase(std::unique(scratch.symbols.begin(), scratch.symbols.end()), scratch.symbols.end());
+
+		// the last entry contains the masks of symbols that are not in a
+		scratch.peq.assign((scratch.symbols.size() + 1) * W, 0);
+		size_t i = 0;
+		for (auto it = a_first; it != a_last; ++it, ++i) {
+			const size_t s = std::lower_bound(scratch.symbols.begin(), scratch.symbols.end(), *it) - scratch.symbols.begin();
+			scratch.peq[s * W + i / 64] |= std::uint64_t(1) << (i % 64);
+		}
+	}
+
+	scratch.pv.assign(W, ~std::uint64_t(0));
+	scratch.mv.assign(W, 0);
+	std::uint64_t *pv = scratch.pv.data();
+	std::uint64_t *mv = scratch.mv.data();
+
+	constexpr std::uint64_t high_bit = std::uint64_t(1) << 63;
+	const std::uint64_t last_bit     = std::uint64_t(1) << ((m - 1) % 64);
+
+	size_t score = m;
+	size_t j = 0;
+	for (auto it = b_first; it != b_last; ++it) {
+		const std::uint64_t *eq;
+		if constexpr (levensthein_scratch<T>::byte_table)
+			eq = &scratch.peq[size_t(static_cast<unsigned char>(*it)) * W];
+		else {
+			auto sym = std::lower_bound(scratch.symbols.begin(), scratch.symbols.end(), *it);
+			size_t s = sym - scratch.symbols.begin();
+			if (sym == scratch.symbols.end() || *it < *sym)
+				s = scratch.symbols.size();
+			eq = &scratch.peq[s * W];
+		}
+
+		// the first row of the DP matrix increases by one in each column
+		int h = 1;
+		for (size_t w = 0; w + 1 < W; w++)
+			h = __levensthein_block(pv[w], mv[w], eq[w], h, high_bit);
+		h = __levensthein_block(pv[W - 1], mv[W - 1], eq[W - 1], h, last_bit);
+		score += h;
+
+		// each remaining column can reduce the score by at most one
+		++j;
+		if (score > k && score - k > n - j)
+			return k + 1;
+	}
+	return score;
+}
+
+
+/*
+ * levensthein_myers - bit-parallel Levensthein distance
+ *
+ * Computes the Levensthein distance with the bit-vector algorithm of Myers
+ * (1999) in the block based formulation of Hyyrö (2003), which processes 64
+ * rows of the DP matrix at once. That is, the runtime is O(ceil(|a| / 64) *
+ * |b|). The symbols must either be of a single byte, or be comparable with
+ * operator<. Pass a scratch object to avoid allocations in repeated calls.
+ */
+template <typename InputIt>
+size_t
+levensthein_myers(
+		InputIt a_first, InputIt a_last,
+		InputIt b_first, InputIt b_last,
+		levensthein_scratch<typename std::iterator_traits<InputIt>::value_type> *scratch = nullptr)
+{
+	typedef typename std::iterator_traits<InputIt>::value_type elem_type;
+
+	constexpr size_t unbounded = std::numeric_limits<size_t>::max() - 1;
+	if (scratch)
+		return __levensthein_myers(a_first, a_last, b_first, b_last, unbounded, *scratch);
+
+	levensthein_scratch<elem_type> local;
+	return __levensthein_myers(a_first, a_last, b_first, b_last, unbounded, local);
+}
+
+
+/*
+ * levensthein_bounded - bit-parallel Levensthein distance with early exit
+ *
+ * Returns the Levensthein distance between a and b if it is at most k, and
+ * k + 1 otherwise. The computation stops as soon as the distance is known to
+ * exceed k, and does not start at all if the lengths differ by more than k.
+ */
+template <typename InputIt>
+size_t
+levensthein_bounded(
+		InputIt a_first, InputIt a_last,
+		InputIt b_first, InputIt b_last,
+		size_t k,
+		levensthein_scratch<typename std::iterator_traits<InputIt>::value_type> *scratch = nullptr)
+{
+	typedef typename std::iterator_traits<InputIt>::value_type elem_type;
+
+	if (scratch)
+		return __levensthein_myers(a_first, a_last, b_first, b_last, k, *scratch);
+
+	levensthein_scratch<elem_type> local;
+	return __levensthein_myers(a_first, a_last, b_first, b_last, k, local);
+}
+
+
+/*
+ * levensthein_banded - Levensthein distance restricted to a diagonal band
+ *
+ * This is the variant of levensthein_dynamic for arbitrary comparison
+ * functions when only distances up to k are of interest (Ukkonen, 1985). Only
+ * cells with |i - j| <= k are computed, and the computation stops as soon as
+ * all cells of a row exceed k. Returns the distance if it is at most k, and
+ * k + 1 otherwise. The runtime is O(k * min(|a|, |b|)).
+ */
+template <typename InputIt, class Compare, typename T>
+size_t
+levensthein_banded(
+		InputIt a_first, InputIt a_last,
+		InputIt b_first, InputIt b_last,
+		size_t k,
+		Compare cmp_equal,
+		levensthein_scratch<T> &scratch)
+{
+	const size_t M = std::distance(a_first, a_last);
+	const size_t N = std::distance(b_first, b_last);
+
+	const size_t len_diff = M > N ? M - N : N - M;
+	if (len_diff > k)
+		return k + 1;
+	if (M == 0 || N == 0)
+		return len_diff;
+
+	// cells outside of the band are treated as k + 1
+	const size_t inf = k + 1;
+	scratch.row0.assign(N + 1, inf);
+	scratch.row1.assign(N + 1, inf);
+	size_t *v0 = scratch.row0.data();
+	size_t *v1 = scratch.row1.data();
+
+	for (size_t j = 0; j <= std::min(N, k); j++)
+		v0[j] = j;
+
+	for (size_t i = 0; i < M; i++, ++a_first) {
+		const size_t j_lo = i + 1 > k ? i + 1 - k : 0;
+		const size_t j_hi = std::min(N, i + 1 + k);
+
+		v1[0] = i + 1 <= k ? i + 1 : inf;
+		if (j_lo > 0)
+			v1[j_lo - 1] = inf;
+
+		size_t row_min = v1[0];
+		auto b_local = std::next(b_first, j_lo > 0 ? j_lo - 1 : 0);
+		for (size_t j = std::max<size_t>(j_lo, 1); j <= j_hi; j++, ++b_local) {
+			const size_t substitution = v0[j - 1] + (cmp_equal(*a_first, *b_local) ? 0 : 1);
+			const size_t deletion     = v0[j] + 1;
+			const size_t insertion    = v1[j - 1] + 1;
+			v1[j] = std::min(inf, min(deletion, insertion, substitution));
+			row_min = std::min(row_min, v1[j]);
+		}
+		if (j_hi < N)
+			v1[j_hi + 1] = inf;
+
+		if (row_min > k)
+			return inf;
+		std::swap(v0, v1);
+	}
+	return std::min(v0[N], inf);
+}
+
+
+template <typename InputIt, class Compare>
+size_t
+levensthein_banded(
+		InputIt a_first, InputIt a_last,
+		InputIt b_first, InputIt b_last,
+		size_t k,
+		Compare cmp_equal)
+{
+	levensthein_scratch<typename std::iterator_traits<InputIt>::value_type> scratch;
+	return levensthein_banded(a_first, a_last, b_first, b_last, k, cmp_equal, scratch);
+}
+
+
 /*
  * levensthein - Compute the Levensthein distance between iterators
  *
@@ -343,17 +1044,23 @@ levensthein(InputIt a_first, InputIt a_last, InputIt b_first, InputIt b_last,
  * levensthein - Compute Levensthein distance between strings.
  *
  * The strings can be anything as long as operator== is defined for their
- * iterators' value_type.
+ * iterators' value_type. Strings of integral symbols use levensthein_myers.
  */
 template <typename InputIt>
 size_t
 levensthein(InputIt a_first, InputIt a_last, InputIt b_first, InputIt b_last)
 {
 	typedef typename std::iterator_traits<InputIt>::value_type elem_type;
-	auto cmp_eq = [](elem_type left, elem_type right) {
-		return left == right;
-	};
-	return levensthein(a_first, a_last, b_first, b_last, cmp_eq);
+
+	// integral symbols, e.g. characters, can use the bit-parallel version
+	if constexpr (std::is_integral_v<elem_type> || std::is_enum_v<elem_type>)
+		return levensthein_myers(a_first, a_last, b_first, b_last);
+	else {
+		auto cmp_eq = [](elem_type left, elem_type right) {
+			return left == right;
+		};
+		return levensthein(a_first, a_last, b_first, b_last, cmp_eq);
+	}
 }
 
 
@@ -519,4 +1226,175 @@ hamming(const char *a, const char *b)
 }
 
 
+/*
+ * condensed_size - number of entries of the strict upper triangle of an n x n
+ * matrix, i.e. the number of unordered pairs of n elements
+ */
+constexpr size_t
+condensed_size(size_t n)
+{
+	return n < 2 ? 0 : n * (n - 1) / 2;
+}
+
+
+/*
+ * condensed_index - index of the pair (i, j) with i < j in a condensed
+ * distance matrix of n elements
+ *
+ * The layout follows scipy's pdist, i.e. rows of the upper triangle are stored
+ * one after another: (0,1), (0,2), ..., (0,n-1), (1,2), ...
+ */
+constexpr size_t
+condensed_index(size_t n, size_t i, size_t j)
+{
+	return n * i - i * (i + 1) / 2 + (j - i - 1);
+}
+
+
+/*
+ * hamming_metric - metric adapter for pairwise_distances which calls hamming
+ *
+ * The call is unqualified so that argument dependent lookup selects the most
+ * specific overload, e.g. the popcount based hamming of ncr::dynamic_bitset
+ * when ncr_bitset.hpp is included.
+ */
+struct hamming_metric
+{
+	template <typename A, typename B>
+	size_t
+	operator()(const A &a, const B &b) const
+	{
+		return hamming(a, b);
+	}
+};
+
+
+/*
+ * levensthein_metric - metric adapter for pairwise_distances which computes
+ * the bit-parallel Levensthein distance
+ *
+ * The metric holds one scratch object per worker of a thread pool, so that
+ * no allocations happen once the buffers have grown to the longest sequence.
+ * If a bound k is given, the metric uses levensthein_bounded and thus returns
+ * k + 1 for all pairs whose distance exceeds k.
+ *
+ * template type arguments:
+ *     T - type of the symbols of the sequences
+ */
+template <typename T>
+struct levensthein_metric
+{
+	constexpr static size_t unbounded = std::numeric_limits<size_t>::max() - 1;
+
+	explicit levensthein_metric(unsigned n_workers = 1, size_t k = unbounded)
+	: scratch(n_workers == 0 ? 1 : n_workers), k(k)
+	{}
+
+	explicit levensthein_metric(const thread_pool *pool, size_t k = unbounded)
+	: levensthein_metric(pool ? pool->size() : 1, k)
+	{}
+
+	template <typename Sequence>
+	size_t
+	operator()(const Sequence &a, const Sequence &b, unsigned worker)
+	{
+		assert(worker < scratch.size());
+		return levensthein_bounded(std::begin(a), std::end(a), std::begin(b), std::end(b), k, &scratch[worker]);
+	}
+
+	// per worker scratch memory
+	std::vector<levensthein_scratch<T>> scratch;
+
+	// upper bound of the distance
+	size_t k;
+};
+
+
+/*
+ * __pairwise_distance - evaluate a metric for a pair of population members
+ *
+ * Metrics which accept a worker index receive it to select scratch memory.
+ */
+template <typename Metric, typename A>
+inline auto
+__pairwise_distance(Metric &metric, const A &a, const A &b, unsigned worker)
+{
+	if constexpr (std::is_invocable_v<Metric&, const A&, const A&, unsigned>)
+		return metric(a, b, worker);
+	else
+		return metric(a, b);
+}
+
+
+/*
+ * pairwise_distances - compute all pairwise distances of a population
+ *
+ * Fills out, which must be of size condensed_size(pop.size()), with the
+ * distances of all pairs (i, j), i < j, in the layout of condensed_index. The
+ * triangle is split into square tiles of tile x tile pairs, such that the
+ * members of two tiles stay in cache while all their pairs are evaluated. The
+ * tiles are distributed over the workers of the pool, or evaluated on the
+ * calling thread if pool is nullptr. Each entry of out is written by exactly
+ * one task, and the result does not depend on the number of workers.
+ *
+ * The metric is called either as metric(a, b, worker) or as metric(a, b), and
+ * must be safe to call concurrently for different worker indices.
+ *
+ * Returns false if out has the wrong size.
+ */
+template <typename Population, typename Metric, typename D>
+bool
+pairwise_distances(thread_pool *pool, const Population &pop, Metric &metric, std::span<D> out, size_t tile = 32)
+{
+	const size_t n = std::size(pop);
+	if (out.size() != condensed_size(n))
+		return false;
+	if (n < 2)
+		return true;
+	if (tile == 0)
+		tile = 1;
+
+	// enumerate all tiles on or above the diagonal
+	const size_t n_tiles = (n + tile - 1) / tile;
+	std::vector<std::pair<size_t, size_t>> tiles;
+	tiles.reserve(n_tiles * (n_tiles + 1) / 2);
+	for (size_t ti = 0; ti < n_tiles; ti++)
+		for (size_t tj = ti; tj < n_tiles; tj++)
+			tiles.emplace_back(ti, tj);
+
+	auto run_tile = [&](size_t task, unsigned worker) {
+		const auto [ti, tj] = tiles[task];
+		const size_t i_end = std::min(n, (ti + 1) * tile);
+		const size_t j_end = std::min(n, (tj + 1) * tile);
+		for (size_t i = ti * tile; i < i_end; i++) {
+			const size_t j_begin = ti == tj ? i + 1 : tj * tile;
+			for (size_t j = j_begin; j < j_end; j++)
+				out[condensed_index(n, i, j)] = static_cast<D>(__pairwise_distance(metric, pop[i], pop[j], worker));
+		}
+	};
+
+	if (pool)
+		pool->run(tiles.size(), run_tile);
+	else
+		for (size_t t = 0; t < tiles.size(); t++)
+			run_tile(t, 0);
+	return true;
+}
+
+
+/*
+ * pairwise_distances - compute all pairwise distances of a population
+ *
+ * Convenience variant which returns the condensed distance matrix.
+ */
+template <typename Population, typename Metric>
+std::vector<size_t>
+pairwise_distances(thread_pool *pool, const Population &pop, Metric &&metric, size_t tile = 32)
+{
+	std::vector<size_t> out(condensed_size(std::size(pop)));
+	pairwise_distances(pool, pop, metric, std::span<size_t>(out), tile);
+	return out;
+}
+
+
 } // namespace ncr
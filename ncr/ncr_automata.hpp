@@ -21,10 +21,13 @@
 #include <string>
 #include <unordered_map>
 #include <vector>
+#include <utility>
+#include <cassert>
 #include <random>
 #include <ostream>
 #include <tuple>
 #include <optional>
+#include <memory>
 #include <fstream>
 #include <ostream>
 #include <map>
@@ -39,6 +42,8 @@
 #include <ncr/ncr_utils.hpp>
 #include <ncr/ncr_log.hpp>
 #include <ncr/ncr_random.hpp>
+#include <ncr/ncr_memory.hpp>
+#include <ncr/ncr_parallel.hpp>
 
 namespace ncr {
 
@@ -232,6 +237,15 @@ struct symbol
 };
 
 
+/*
+ * symbol_id_t - type used to store symbol IDs in flat word buffers
+ */
+using symbol_id_t = std::uint32_t;
+
+// placeholder for a nullptr symbol, which is outside of every alphabet
+constexpr symbol_id_t symbol_id_invalid = ~symbol_id_t(0);
+
+
 /*
  * word_t - a word is a concatenation of symbols
  *
@@ -390,12 +404,16 @@ symbols_to_str(std::vector<symbol> symbols)
 
 /*
  * symbols_to_str - Turn a vector of pointer to symbols to a string.
+ *
+ * The string ends at the first nullptr symbol, similar to copy_str.
  */
 inline std::string
 symbols_to_str(std::vector<const symbol *> word)
 {
 	std::string result = "";
 	for (auto sym: word) {
+		if (sym == nullptr)
+			break;
 		result += sym->glyph;
 	}
 	return result;
@@ -418,26 +436,286 @@ random_string(RngT* rng, const basic_alphabet *alphabet, const size_t length)
 
 /*
  * nth_string - generate the n-th string of given length from an alphabet
+ *
+ * The string is the representation of n in base n_symbols, with the most
+ * significant digit first. This uses integer arithmetic only, and is thus
+ * exact for all 64 bit n.
  */
 inline basic_string_t
 nth_string(const basic_alphabet *alphabet, const size_t length, size_t n)
 {
 	basic_string_t result(length);
-	const auto alpha_len = alphabet->n_symbols;
-	assert((n < std::pow(alpha_len, length)) && "String index out of bounds");
+	const size_t alpha_len = alphabet->n_symbols;
+
+	for (size_t l = length; l > 0; l--) {
+		result[l - 1] = &alphabet->symbols[n % alpha_len];
+		n /= alpha_len;
+	}
+	assert((n == 0) && "String index out of bounds");
+
+	return result;
+}
+
+
+/*
+ * symbol_bits - bits per symbol ID in a packed word of an alphabet
+ *
+ * This is the smallest of 1, 2, 4, or 8 bits that can represent all symbol IDs
+ * of an alphabet with n_symbols symbols, such that a symbol never straddles
+ * the boundary of a 64 bit word. Alphabets with more than 256 symbols cannot
+ * be packed, and yield 0.
+ */
+constexpr unsigned
+symbol_bits(const size_t n_symbols)
+{
+	for (unsigned bits = 1; bits <= 8; bits *= 2)
+		if (n_symbols <= (size_t(1) << bits))
+			return bits;
+	return 0;
+}
+
+
+/*
+ * struct static_alphabet - an alphabet whose size is known at compile time
+ *
+ * The symbols are stored within the alphabet, with input symbols first and
+ * blank symbols last, and with IDs that correspond to their position. Hence,
+ * a static_alphabet that is declared inline constexpr is laid out entirely at
+ * compile time, as are the number of symbols and the number of bits required
+ * for a packed word over the alphabet. Use basic() to pass the alphabet to
+ * functions which expect a basic_alphabet, e.g.
+ *
+ *     inline constexpr auto dna = make_static_alphabet<4>("ACGT");
+ *     inline constexpr basic_alphabet dna_alphabet = dna.basic();
+ *     packed_word<dna.bits_per_symbol> word;
+ */
+template <size_t NInputSymbols, size_t NBlankSymbols = 0>
+struct static_alphabet
+{
+	static constexpr size_t   n_symbols       = NInputSymbols + NBlankSymbols;
+	static constexpr size_t   n_input_symbols = NInputSymbols;
+	static constexpr size_t   n_blank_symbols = NBlankSymbols;
+	static constexpr unsigned bits_per_symbol = symbol_bits(n_symbols);
+
+	const symbol
+		symbols[n_symbols];
+
+	constexpr basic_alphabet
+	basic() const
+	{
+		return {
+			.n_symbols       = n_symbols,
+			.n_input_symbols = n_input_symbols,
+			.n_blank_symbols = n_blank_symbols,
+			.symbols         = symbols,
+		};
+	}
+};
+
+
+template <size_t NInputSymbols, size_t NBlankSymbols, size_t... Is>
+constexpr static_alphabet<NInputSymbols, NBlankSymbols>
+__make_static_alphabet(const char *glyphs, std::index_sequence<Is...>)
+{
+	return {{ symbol{.id = Is, .glyph = glyphs[Is], .is_blank = Is >= NInputSymbols}... }};
+}
+
+
+/*
+ * make_static_alphabet - define a static alphabet given the glyphs of its symbols
+ *
+ * glyphs contains the glyphs of the input symbols followed by the glyphs of
+ * the blank symbols.
+ */
+template <size_t NInputSymbols, size_t NBlankSymbols = 0>
+constexpr static_alphabet<NInputSymbols, NBlankSymbols>
+make_static_alphabet(const char *glyphs)
+{
+	return __make_static_alphabet<NInputSymbols, NBlankSymbols>(glyphs,
+			std::make_index_sequence<NInputSymbols + NBlankSymbols>{});
+}
+
+
+/*
+ * struct packed_word - a word of symbol IDs packed into 64 bit words
+ *
+ * In contrast to basic_string_t, which stores an 8 byte pointer per symbol, a
+ * packed word stores BitsPerSymbol bits per symbol. Symbol i lives in the bits
+ * [(i % symbols_per_word) * BitsPerSymbol, ...) of data[i / symbols_per_word].
+ * Bits past the length of the word are always zero. The number of bits for an
+ * alphabet follows from symbol_bits, e.g. packed_word<2> for an alphabet of
+ * four symbols packs 32 symbols into one 64 bit word.
+ */
+template <unsigned BitsPerSymbol>
+struct packed_word
+{
+	static_assert(BitsPerSymbol == 1 || BitsPerSymbol == 2 || BitsPerSymbol == 4 || BitsPerSymbol == 8,
+			"packed_word requires 1, 2, 4, or 8 bits per symbol");
+
+	static constexpr unsigned      bits_per_symbol  = BitsPerSymbol;
+	static constexpr unsigned      symbols_per_word = 64 / BitsPerSymbol;
+	static constexpr std::uint64_t symbol_mask      = (std::uint64_t(1) << BitsPerSymbol) - 1;
+
+	// number of symbols in the word
+	size_t
+		length = 0;
+
+	// the packed symbol IDs
+	std::vector<std::uint64_t>
+		data = {};
+};
+
+
+/*
+ * packed_word_get - get the ID of the i-th symbol of a packed word
+ */
+template <unsigned B>
+inline symbol_id_t
+packed_word_get(const packed_word<B> &word, const size_t i)
+{
+	using W = packed_word<B>;
+	return static_cast<symbol_id_t>((word.data[i / W::symbols_per_word] >> ((i % W::symbols_per_word) * B)) & W::symbol_mask);
+}
+
+
+/*
+ * packed_word_set - set the ID of the i-th symbol of a packed word
+ */
+template <unsigned B>
+inline void
+packed_word_set(packed_word<B> &word, const size_t i, const symbol_id_t id)
+{
+	using W = packed_word<B>;
+	assert(id <= W::symbol_mask && "Symbol ID does not fit into packed word");
+	const unsigned shift = (i % W::symbols_per_word) * B;
+	std::uint64_t &w = word.data[i / W::symbols_per_word];
+	w = (w & ~(W::symbol_mask << shift)) | (std::uint64_t(id) << shift);
+}
+
+
+/*
+ * packed_word_resize - resize a packed word, new symbols have ID 0
+ */
+template <unsigned B>
+inline void
+packed_word_resize(packed_word<B> &word, const size_t length)
+{
+	using W = packed_word<B>;
+	word.data.resize((length + W::symbols_per_word - 1) / W::symbols_per_word, 0);
+
+	// clear the stale bits past the new end of the word
+	if (length < word.length && length % W::symbols_per_word)
+		word.data.back() &= ~std::uint64_t(0) >> (64 - (length % W::symbols_per_word) * B);
+	word.length = length;
+}
+
+
+/*
+ * packed_word_clear - remove all symbols, but keep the memory
+ */
+template <unsigned B>
+inline void
+packed_word_clear(packed_word<B> &word)
+{
+	word.data.clear();
+	word.length = 0;
+}
 
-	size_t l = length;
-	while (l > 0) {
-		size_t k = n / std::pow(alpha_len, l - 1);
-		result[length - l] = &alphabet->symbols[k];
-		n = max(0, n - k * std::pow(alpha_len, l-1));
-		l -= 1;
+
+/*
+ * packed_word_push - append a symbol ID to a packed word
+ */
+template <unsigned B>
+inline void
+packed_word_push(packed_word<B> &word, const symbol_id_t id)
+{
+	using W = packed_word<B>;
+	if (word.length % W::symbols_per_word == 0)
+		word.data.push_back(0);
+	packed_word_set(word, word.length++, id);
+}
+
+
+/*
+ * pack_str - pack a string of symbols into a packed word
+ *
+ * The string is copied up to the first nullptr symbol, similar to copy_str.
+ */
+template <unsigned B>
+inline void
+pack_str(const basic_string_t &src, packed_word<B> &dest)
+{
+	packed_word_clear(dest);
+	for (auto *sym: src) {
+		if (sym == nullptr)
+			break;
+		packed_word_push(dest, static_cast<symbol_id_t>(sym->id));
 	}
+}
 
+
+/*
+ * unpack_str - turn a packed word into a string of symbols of an alphabet
+ */
+template <unsigned B>
+inline basic_string_t
+unpack_str(const packed_word<B> &src, const basic_alphabet *alphabet)
+{
+	basic_string_t result(src.length);
+	for (size_t i = 0; i < src.length; i++)
+		result[i] = &alphabet->symbols[packed_word_get(src, i)];
 	return result;
 }
 
 
+/*
+ * random_string - fill a packed word with random input symbols
+ *
+ * This is the packed version of random_string, which re-uses the memory of
+ * result.
+ */
+template <unsigned B, typename RngT = std::mt19937_64>
+void
+random_string(RngT* rng, const basic_alphabet *alphabet, const size_t length, packed_word<B> &result)
+{
+	packed_word_clear(result);
+	for (size_t i = 0; i < length; ++i)
+		packed_word_push(result, static_cast<symbol_id_t>(choice(0ul, alphabet->n_input_symbols - 1, rng)));
+}
+
+
+/*
+ * nth_string - generate the n-th string of given length as a packed word
+ *
+ * This is the packed version of nth_string, which re-uses the memory of
+ * result. For alphabets whose size is a power of two that matches the bits
+ * per symbol, the digits are simply the bit groups of n.
+ */
+template <unsigned B>
+inline void
+nth_string(const basic_alphabet *alphabet, const size_t length, size_t n, packed_word<B> &result)
+{
+	const size_t alpha_len = alphabet->n_symbols;
+	assert(alpha_len <= packed_word<B>::symbol_mask + 1);
+
+	packed_word_clear(result);
+	packed_word_resize(result, length);
+	if (alpha_len == packed_word<B>::symbol_mask + 1) {
+		for (size_t l = length; l > 0; l--) {
+			packed_word_set(result, l - 1, static_cast<symbol_id_t>(n & packed_word<B>::symbol_mask));
+			n >>= B;
+		}
+	}
+	else {
+		for (size_t l = length; l > 0; l--) {
+			packed_word_set(result, l - 1, static_cast<symbol_id_t>(n % alpha_len));
+			n /= alpha_len;
+		}
+	}
+	assert((n == 0) && "String index out of bounds");
+}
+
+
 /*
  * state_gene - Encoding of a state for a genome
  */
@@ -940,13 +1218,14 @@ validate_genome(const basic_alphabet *alphabet, const fsm_genome &genome)
  *
  * This mutates the flag of an automaton
  */
-inline void
+template <typename RngT = std::mt19937_64>
+void
 mutate_states(
 		const fsm_genome &genome,
 		const mutation_rates &mr,
 		fsm_genome &target,
 		std::vector<transition_gene> &target_transitions,
-		std::mt19937_64 *rng,
+		RngT *rng,
 		// added 2023-02-14
 		size_t max_nstates = 3)
 {
@@ -1114,14 +1393,15 @@ mutate_states(
 /*
  * mutate_transitions - Mutate the transitions of an automaton.
  */
-inline void
+template <typename RngT = std::mt19937_64>
+void
 mutate_transitions(
 		const std::vector<transition_gene> &origin,
 		const mutation_rates &mr,
 		const basic_alphabet &alphabet,
 		const size_t nstates,
 		std::vector<transition_gene> &target,
-		std::mt19937_64 *rng)
+		RngT *rng)
 {
 	for (auto _t: origin) {
 		// drop this transition?
@@ -1195,12 +1475,13 @@ genome_rewrite_labels(fsm_genome &genome)
 /*
  * mutate_genome - Mutate a genome based on given mutation rates.
  */
-inline fsm_genome
+template <typename RngT = std::mt19937_64>
+fsm_genome
 mutate_genome(
 		const fsm_genome &genome,
 		const mutation_rates &mr,
 		const basic_alphabet &alphabet,
-		std::mt19937_64 *rng,
+		RngT *rng,
 		size_t max_nstates = 3)
 {
 	fsm_genome target;
@@ -1756,6 +2037,97 @@ init_transition_table(
 }
 
 
+/*
+ * fsm_state_id_t - type used to store state IDs in compiled transition tables
+ */
+using fsm_state_id_t = std::uint32_t;
+
+// sentinel which indicates that there is no transition for a Q x Σ pair
+inline constexpr fsm_state_id_t
+fsm_state_undefined = ~fsm_state_id_t(0);
+
+
+/*
+ * struct compiled_transition_table - flat form of a transition table
+ *
+ * While the transition table stores pointers to transitions, the compiled
+ * transition table stores the ID of the target state in one contiguous array
+ * that is indexed by [state * n_symbols + symbol]. Missing transitions are
+ * marked by fsm_state_undefined. In addition, the table contains a bitmask of
+ * all accepting states, and the ID of the initial state.
+ *
+ * The automata that are used in ncr are usually small, so that the entire
+ * table fits into the L1 cache. Running an FSM on the compiled table thus
+ * avoids to chase the pointers from the transition to its target state.
+ *
+ * Note: the compiled table expects that the ID of each state corresponds to its
+ *       index within the vector of states, which is the case for FSMs that were
+ *       initialized via fsm_init.
+ */
+struct compiled_transition_table
+{
+	// number of states and symbols that the table was compiled for
+	size_t
+		n_states = 0;
+
+	size_t
+		n_symbols = 0;
+
+	// ID of the initial state, or fsm_state_undefined if there is none
+	fsm_state_id_t
+		initial_state = fsm_state_undefined;
+
+	// [state * n_symbols + symbol] -> target state
+	std::vector<fsm_state_id_t>
+		next_state = {};
+
+	// bit i of the mask is set if state i is accepting
+	std::vector<std::uint64_t>
+		accepting = {};
+};
+
+
+/*
+ * init_compiled_transition_table - compile states and transitions into a table
+ */
+inline void
+init_compiled_transition_table(
+		const state_ptr_vector &states,
+		const transition_ptr_vector &transitions,
+		const size_t n_symbols,
+		compiled_transition_table &table)
+{
+	table.n_states      = states.size();
+	table.n_symbols     = n_symbols;
+	table.initial_state = fsm_state_undefined;
+	table.next_state.assign(table.n_states * n_symbols, fsm_state_undefined);
+	table.accepting.assign((table.n_states + 63) / 64, 0);
+
+	for (auto *s: states) {
+		if (is_final(s))
+			table.accepting[s->id / 64] |= std::uint64_t(1) << (s->id % 64);
+		if (is_start(s) && table.initial_state == fsm_state_undefined)
+			table.initial_state = static_cast<fsm_state_id_t>(s->id);
+	}
+
+	for (transition *t : transitions) {
+		if (!t->from || !t->to || t->read >= n_symbols)
+			continue;
+		table.next_state[t->from->id * n_symbols + t->read] = static_cast<fsm_state_id_t>(t->to->id);
+	}
+}
+
+
+/*
+ * is_final - determine if a state in a compiled transition table is accepting
+ */
+inline bool
+is_final(const compiled_transition_table &table, fsm_state_id_t s)
+{
+	return (table.accepting[s / 64] >> (s % 64)) & 1;
+}
+
+
 // TODO: merge with code above, as it is mostly a duplicate. Maybe use a
 // template, or XMacro List
 inline
@@ -2118,8 +2490,8 @@ init_successor_map(
  *
  * Note that this is a rather straightforward implementation, without overly
  * strong consideration of runtimes. If this appears to be a bottleneck, then
- * alternative algorithms for computation might be Hopcroft, 1971 or Valmari,
- * 2012.
+ * use dfa_compute_equivalence_sets_hopcroft below. Another alternative
+ * algorithm for computation might be Valmari, 2012.
  *
  */
 inline partition
@@ -2259,6 +2631,224 @@ dfa_compute_equivalence_sets(
 }
 
 
+/*
+ * dfa_minimize_algorithm - algorithms to compute the set of equivalent states
+ *
+ * Moore is the straightforward fixed-point iteration implemented in
+ * dfa_compute_equivalence_sets. Hopcroft is the worklist-based partition
+ * refinement implemented in dfa_compute_equivalence_sets_hopcroft. Both compute
+ * the same equivalence relation, but potentially with a different order of the
+ * subsets within the partition.
+ */
+enum struct dfa_minimize_algorithm : unsigned {
+	Moore    = 0,
+	Hopcroft = 1,
+};
+
+
+/*
+ * dfa_compute_equivalence_sets_hopcroft - Compute the set of equivalent states
+ *
+ * This computes the same partition as dfa_compute_equivalence_sets, but uses
+ * Hopcroft's algorithm (Hopcroft, 1971) in O(n k log n) instead of repeated
+ * passes over all pairs of states. The implementation follows the refinable
+ * partition data structure of Valmari and Lehtinen, 2008, and works entirely
+ * on flat arrays.
+ *
+ * Missing transitions are handled by an implicit sink state which is placed
+ * into its own block of the initial partition. Thereby, a state with a missing
+ * transition is always distinguishable from a state that has a transition for
+ * the same symbol, which is the same semantics as in are_distinguishable.
+ *
+ * The subsets of the returned partition are ordered by their smallest state,
+ * and the states within each subset are sorted.
+ */
+inline partition
+dfa_compute_equivalence_sets_hopcroft(
+		const basic_alphabet        *alphabet,
+		const state_ptr_vector      &states,
+		const transition_ptr_vector &transitions)
+{
+	const size_t n_states  = states.size();
+	const size_t n_symbols = alphabet->n_symbols;
+
+	partition result;
+	init_partition(result, 0, n_states);
+	if (n_states == 0)
+		return result;
+
+	// the sink state has index n_states
+	const size_t N    = n_states + 1;
+	const size_t sink = n_states;
+
+	// map from state ID to the index in the vector of states
+	size_t max_id = 0;
+	for (auto *s: states)
+		max_id = s->id > max_id ? s->id : max_id;
+	std::vector<ptrdiff_t> index_of(max_id + 1, -1);
+	for (size_t i = 0; i < n_states; ++i)
+		index_of[states[i]->id] = i;
+
+	// flat successor table, where missing transitions lead to the sink
+	std::vector<size_t> delta(N * n_symbols, sink);
+	for (auto *t: transitions) {
+		if (!t->from || !t->to || t->read >= n_symbols)
+			continue;
+		if (t->from->id > max_id || t->to->id > max_id)
+			continue;
+		const ptrdiff_t from = index_of[t->from->id];
+		const ptrdiff_t to   = index_of[t->to->id];
+		if (from < 0 || to < 0)
+			continue;
+		delta[from * n_symbols + t->read] = to;
+	}
+
+	// inverse transitions in CSR form. The predecessors of state q for symbol
+	// a are stored in inv[inv_offset[a * N + q] ... inv_offset[a * N + q + 1])
+	std::vector<size_t> inv_offset(N * n_symbols + 1, 0);
+	std::vector<size_t> inv(N * n_symbols);
+	for (size_t q = 0; q < N; ++q)
+		for (size_t a = 0; a < n_symbols; ++a)
+			inv_offset[a * N + delta[q * n_symbols + a] + 1] += 1;
+	for (size_t i = 1; i < inv_offset.size(); ++i)
+		inv_offset[i] += inv_offset[i - 1];
+	{
+		std::vector<size_t> fill(inv_offset.begin(), inv_offset.end() - 1);
+		for (size_t q = 0; q < N; ++q)
+			for (size_t a = 0; a < n_symbols; ++a)
+				inv[fill[a * N + delta[q * n_symbols + a]]++] = q;
+	}
+
+	// refinable partition. The elements of block b are stored in
+	// elems[first[b] ... end[b]), and the marked elements of a block in
+	// elems[first[b] ... mid[b]).
+	std::vector<size_t> elems(N), loc(N), block_of(N);
+	std::vector<size_t> first, mid, end;
+	first.reserve(N); mid.reserve(N); end.reserve(N);
+
+	// initial partition: non-final states, final states, sink
+	{
+		size_t pos = 0;
+		for (int final = 0; final < 2; ++final) {
+			const size_t begin = pos;
+			for (size_t q = 0; q < n_states; ++q) {
+				if (is_final(states[q]) == static_cast<bool>(final)) {
+					elems[pos] = q;
+					loc[q] = pos;
+					block_of[q] = first.size();
+					++pos;
+				}
+			}
+			if (pos > begin) {
+				first.push_back(begin);
+				mid.push_back(begin);
+				end.push_back(pos);
+			}
+		}
+		elems[pos] = sink;
+		loc[sink] = pos;
+		block_of[sink] = first.size();
+		first.push_back(pos);
+		mid.push_back(pos);
+		end.push_back(pos + 1);
+	}
+
+	// worklist of splitters (block, symbol). Initially, this contains all
+	// blocks except for the largest one, for all symbols
+	std::vector<std::pair<size_t, size_t>> worklist;
+	{
+		size_t largest = 0;
+		for (size_t b = 1; b < first.size(); ++b)
+			if (end[b] - first[b] > end[largest] - first[largest])
+				largest = b;
+		for (size_t b = 0; b < first.size(); ++b) {
+			if (b == largest)
+				continue;
+			for (size_t a = 0; a < n_symbols; ++a)
+				worklist.push_back({b, a});
+		}
+	}
+
+	std::vector<size_t> touched;
+	touched.reserve(N);
+	while (!worklist.empty()) {
+		auto [splitter, a] = worklist.back();
+		worklist.pop_back();
+
+		// mark all predecessors of the splitter for symbol a
+		for (size_t i = first[splitter]; i < end[splitter]; ++i) {
+			const size_t q = elems[i];
+			const size_t *pred_begin = inv.data() + inv_offset[a * N + q];
+			const size_t *pred_end   = inv.data() + inv_offset[a * N + q + 1];
+			for (const size_t *it = pred_begin; it != pred_end; ++it) {
+				const size_t p = *it;
+				const size_t b = block_of[p];
+				if (loc[p] < mid[b])
+					continue;
+				if (mid[b] == first[b])
+					touched.push_back(b);
+				// swap p into the marked part of its block
+				const size_t other = elems[mid[b]];
+				std::swap(elems[loc[p]], elems[mid[b]]);
+				loc[other] = loc[p];
+				loc[p] = mid[b];
+				mid[b] += 1;
+			}
+		}
+
+		// split all touched blocks into marked and unmarked states
+		for (size_t b: touched) {
+			if (mid[b] == end[b]) {
+				// all states marked, no split
+				mid[b] = first[b];
+				continue;
+			}
+
+			// the smaller part becomes the new block
+			const size_t n_marked   = mid[b] - first[b];
+			const size_t n_unmarked = end[b] - mid[b];
+			const size_t nb = first.size();
+			if (n_marked <= n_unmarked) {
+				first.push_back(first[b]);
+				end.push_back(mid[b]);
+				first[b] = mid[b];
+			}
+			else {
+				first.push_back(mid[b]);
+				end.push_back(end[b]);
+				end[b] = mid[b];
+			}
+			mid.push_back(first[nb]);
+			mid[b] = first[b];
+			for (size_t i = first[nb]; i < end[nb]; ++i)
+				block_of[elems[i]] = nb;
+
+			// whether or not (b, c) is still in the worklist, adding the
+			// smaller part is sufficient
+			for (size_t c = 0; c < n_symbols; ++c)
+				worklist.push_back({nb, c});
+		}
+		touched.clear();
+	}
+
+	// convert to a partition, skipping the sink. Subsets are created in the
+	// order in which their smallest state appears
+	std::vector<ptrdiff_t> subset_of_block(first.size(), -1);
+	for (size_t q = 0; q < n_states; ++q) {
+		const size_t b = block_of[q];
+		if (subset_of_block[b] < 0) {
+			subset_of_block[b] = result.subsets.size();
+			result.subsets.emplace_back();
+		}
+		const int s = static_cast<int>(subset_of_block[b]);
+		result.subsets[s].push_back(static_cast<int>(q));
+		result.subset_map[q] = s;
+	}
+
+	return result;
+}
+
+
 /*
  * dfa_merge_equivalent_sets - Merge states that are equivalent
  *
@@ -2350,7 +2940,8 @@ std::tuple<state_ptr_vector, transition_ptr_vector>
 dfa_minimize(
 		const basic_alphabet *alphabet,
 		const state_ptr_vector &states,
-		const transition_ptr_vector &transitions)
+		const transition_ptr_vector &transitions,
+		const dfa_minimize_algorithm algorithm = dfa_minimize_algorithm::Moore)
 {
 	// TODO: remove dead/and useless states
 	// remove_dead_states(fsm.states, fsm.transitions);
@@ -2360,7 +2951,9 @@ dfa_minimize(
 	auto [ss_reachable, ts_reachable] = dfa_remove_unreachable(states, transitions);
 
 	log_verbose("dfa_compute_equivalence_sets\n");
-	partition equiv_sets = dfa_compute_equivalence_sets(alphabet, ss_reachable, ts_reachable);
+	partition equiv_sets = (algorithm == dfa_minimize_algorithm::Hopcroft)
+		? dfa_compute_equivalence_sets_hopcroft(alphabet, ss_reachable, ts_reachable)
+		: dfa_compute_equivalence_sets(alphabet, ss_reachable, ts_reachable);
 
 	// merge states
 	log_verbose("dfa_merge_equivalent_sets\n");
@@ -2375,6 +2968,46 @@ dfa_minimize(
 }
 
 
+/*
+ * struct fsm_arena - arena memory for realized states and transitions
+ *
+ * An FSM that has an arena assigned allocates all its states and transitions
+ * from the arena instead of via new. Multiple FSMs can share one arena, e.g.
+ * all FSMs of one generation. Releasing all of them then boils down to a
+ * single call to fsm_arena_reset.
+ *
+ * Note that dfa_minimize and fsm_minimize return pointers to the original
+ * states and transitions. That is, their results live in the same arena as
+ * the FSM that was minimized and become invalid after the arena is reset.
+ */
+struct fsm_arena
+{
+	arena_memory<state>
+		states;
+
+	arena_memory<transition>
+		transitions;
+
+	fsm_arena(const size_t page_size = 256)
+		: states(page_size), transitions(page_size)
+	{}
+};
+
+
+/*
+ * fsm_arena_reset - release all states and transitions of an arena at once
+ *
+ * All FSMs that were initialized with this arena must not be used anymore
+ * after a reset, unless they are re-initialized via fsm_init.
+ */
+inline void
+fsm_arena_reset(fsm_arena &arena)
+{
+	arena.states.reset();
+	arena.transitions.reset();
+}
+
+
 /*
  * struct finite_state_machine - A finite state machine.
  *
@@ -2403,11 +3036,17 @@ struct finite_state_machine {
 	fsm_genome
 		genome;
 
+	// optional arena from which states and transitions will be allocated. If
+	// this is nullptr, the FSM allocates its states and transitions via new.
+	fsm_arena*
+		arena = nullptr;
+
 	// the realized states and transitions are stored in the following two
 	// vectors.
 	// Note that these vectors also are supposed to have the ownership of the
 	// objects! That is, if you remove a state or transition from one of the
 	// vectors, you are also responsible to release the memory, if needed.
+	// If the FSM has an arena, then the arena owns the objects instead.
 	state_ptr_vector
 		states = {};
 
@@ -2434,6 +3073,11 @@ struct finite_state_machine {
 	transition_ptr_table
 		transition_table = {};
 
+	// compiled form of the transition table, which stores the target state
+	// IDs in a flat array. This is used by the fast path in fsm_run_batch.
+	compiled_transition_table
+		compiled_table = {};
+
 	// TODO:
 	//  * add storage for trace of a run
 	//  * add an accumulator for the fitness of this FSM
@@ -2444,24 +3088,32 @@ struct finite_state_machine {
 /*
  * translate - Translate a genome into realized states and transitions
  *
- * Note that this function allocates memory for new objects (via new)
+ * If arena is nullptr, this function allocates memory for new objects (via
+ * new), and the caller is responsible to delete them. Otherwise, the objects
+ * are taken from the arena.
  */
 inline
 std::tuple<state_ptr_vector, state_ptr_vector, state_ptr_vector, transition_ptr_vector>
-fsm_translate(const fsm_genome &genome)
+fsm_translate(const fsm_genome &genome, fsm_arena *arena)
 {
 	state_ptr_vector states;
 	state_ptr_vector starts;
 	state_ptr_vector accepting;
 	transition_ptr_vector transitions;
 
+	states.reserve(genome.states.size());
+	transitions.reserve(genome.transitions.size());
+
 	// instantiate states from the genome.
 	for (size_t i = 0; i < genome.states.size(); ++i) {
-		state *s = new state;
+		state *s = arena ? arena->states.alloc() : new state;
 		s->id      = i;
 		s->gene_id = genome.states[i].id;
 		s->label   = genome.states[i].label;
 		s->flag    = genome.states[i].flag;
+		// items from an arena are recycled and might contain stale transitions
+		s->transitions_outgoing.clear();
+		s->transitions_incoming.clear();
 		states.push_back(s);
 		if (is_start(s))
 			starts.push_back(s);
@@ -2472,7 +3124,7 @@ fsm_translate(const fsm_genome &genome)
 	// instantiate all transitions. Makes sure to map the proper indices for the
 	// list of states
 	for (size_t i = 0; i < genome.transitions.size(); ++i) {
-		transition *t = new transition;
+		transition *t = arena ? arena->transitions.alloc() : new transition;
 		t->id    = i;
 		t->from  = get_state_by_gene_id(states, genome.transitions[i].state_from);
 		t->to    = get_state_by_gene_id(states, genome.transitions[i].state_to);
@@ -2499,7 +3151,15 @@ fsm_translate(const fsm_genome &genome)
 }
 
 
-/*
+inline
+std::tuple<state_ptr_vector, state_ptr_vector, state_ptr_vector, transition_ptr_vector>
+fsm_translate(const fsm_genome &genome)
+{
+	return fsm_translate(genome, nullptr);
+}
+
+
+/*
  * fsm_encode_genome - (Re-)compute the genome for given states and transitions
  *
  * This function takes states and transitions and produces the genome that
@@ -2577,16 +3237,19 @@ fsm_encode_genome(
 
 
 /*
- * init - initialize a finite state machine
+ * init - initialize a finite state machine from a genome
  *
- * This function takes an FSM and first transcribes its genome into proper
- * states and transitions. Then, the transition table will be initialized
+ * In contrast to fsm_init(fsm), the genome is only read during the
+ * initialization and not copied into fsm.genome, which is left as is. This
+ * avoids the copy of the genome when many genomes are evaluated in a row with
+ * the same FSM. Note that functions which work on fsm.genome, e.g.
+ * fsm_validate, do not see the genome then.
  */
 inline void
-fsm_init(finite_state_machine &fsm)
+fsm_init(finite_state_machine &fsm, const fsm_genome &genome)
 {
 	// translate the genome into real states and transitions
-	auto [states, starts, accepting, transitions] = fsm_translate(fsm.genome);
+	auto [states, starts, accepting, transitions] = fsm_translate(genome, fsm.arena);
 	fsm.states           = states;
 	fsm.transitions      = transitions;
 	fsm.starting_states  = starts;
@@ -2599,11 +3262,31 @@ fsm_init(finite_state_machine &fsm)
 			fsm.alphabet->n_symbols,
 			fsm.transition_table);
 
+	// and its compiled form
+	init_compiled_transition_table(
+			fsm.states,
+			fsm.transitions,
+			fsm.alphabet->n_symbols,
+			fsm.compiled_table);
+
 	// set flag. might be important later on
 	fsm.initialized = true;
 }
 
 
+/*
+ * init - initialize a finite state machine
+ *
+ * This function takes an FSM and first transcribes its genome into proper
+ * states and transitions. Then, the transition table will be initialized
+ */
+inline void
+fsm_init(finite_state_machine &fsm)
+{
+	fsm_init(fsm, fsm.genome);
+}
+
+
 /*
  * fsm_free - release an FSM, and all memory that was acquired for it
  */
@@ -2615,15 +3298,24 @@ fsm_free(finite_state_machine &fsm)
 		return;
 	}
 
-	for (size_t i = 0; i < fsm.states.size(); ++i) {
-		delete fsm.states[i];
-		fsm.states[i] = nullptr;
-	}
-	for (size_t i = 0; i < fsm.transitions.size(); ++i) {
-		delete fsm.transitions[i];
-		fsm.transitions[i] = nullptr;
+	// memory from an arena is only released when the arena gets reset
+	if (!fsm.arena) {
+		for (size_t i = 0; i < fsm.states.size(); ++i) {
+			delete fsm.states[i];
+			fsm.states[i] = nullptr;
+		}
+		for (size_t i = 0; i < fsm.transitions.size(); ++i) {
+			delete fsm.transitions[i];
+			fsm.transitions[i] = nullptr;
+		}
 	}
+	fsm.states.clear();
+	fsm.transitions.clear();
+	fsm.starting_states.clear();
+	fsm.accepting_states.clear();
+	fsm.current_state = nullptr;
 	fsm.transition_table.clear();
+	fsm.compiled_table = {};
 	fsm.initialized = false;
 }
 
@@ -2825,14 +3517,901 @@ fsm_run(
 }
 
 
+/*
+ * struct fsm_word_batch - a flat buffer of words for batched runs
+ *
+ * Instead of storing each word as a vector of pointers to symbols, the batch
+ * stores the symbol IDs of all words back to back in one contiguous buffer.
+ * The i-th word lives in symbols[offsets[i] ... offsets[i+1]). Hence, offsets
+ * always contains one more entry than there are words in the batch.
+ *
+ * A batch can be cleared and refilled without releasing its memory, so that
+ * a batch that is re-used across generations does not touch the heap anymore
+ * once its capacity suffices.
+ */
+struct fsm_word_batch
+{
+	// concatenated symbol IDs of all words
+	std::vector<symbol_id_t>
+		symbols = {};
+
+	// start offset of each word into symbols, plus the end of the last word
+	std::vector<size_t>
+		offsets = {0};
+};
+
+
+/*
+ * fsm_word_batch_size - get the number of words stored in a batch
+ */
+inline size_t
+fsm_word_batch_size(const fsm_word_batch &batch)
+{
+	return batch.offsets.size() - 1;
+}
+
+
+/*
+ * fsm_word_batch_clear - remove all words from a batch, but keep its memory
+ */
+inline void
+fsm_word_batch_clear(fsm_word_batch &batch)
+{
+	batch.symbols.clear();
+	batch.offsets.resize(1);
+	batch.offsets[0] = 0;
+}
+
+
+/*
+ * fsm_word_batch_reserve - reserve memory for n_words of (total) n_symbols
+ */
+inline void
+fsm_word_batch_reserve(fsm_word_batch &batch, size_t n_words, size_t n_symbols)
+{
+	batch.symbols.reserve(n_symbols);
+	batch.offsets.reserve(n_words + 1);
+}
+
+
+/*
+ * fsm_word_batch_push - append a word to a batch
+ *
+ * A word that contains a nullptr symbol is still appended, such that the
+ * results of fsm_run_batch correspond 1:1 to the pushed words. The symbols up
+ * to the nullptr are followed by symbol_id_invalid, for which fsm_run_word
+ * reports ERROR_INVALID_WORD after the same prefix as fsm_run. The return
+ * value is ERROR_INVALID_WORD for such a word, and OK otherwise.
+ */
+inline fsm_run_flags
+fsm_word_batch_push(fsm_word_batch &batch, const basic_string_t &word)
+{
+	fsm_run_flags result = fsm_run_flags::OK;
+	for (auto *sym: word) {
+		if (sym == nullptr) {
+			batch.symbols.push_back(symbol_id_invalid);
+			result = fsm_run_flags::ERROR_INVALID_WORD;
+			break;
+		}
+		batch.symbols.push_back(static_cast<symbol_id_t>(sym->id));
+	}
+	batch.offsets.push_back(batch.symbols.size());
+	return result;
+}
+
+
+/*
+ * fsm_run_word - run a compiled transition table on a single word
+ *
+ * The word is given as an array of symbol IDs of a certain length. The return
+ * value are the flags that fsm_run would return for the word. If
+ * accepted_length is not nullptr, the number of symbols for which a transition
+ * existed will be written to it.
+ */
+inline fsm_run_flags
+fsm_run_word(
+		const compiled_transition_table &table,
+		const symbol_id_t               *word,
+		const size_t                     length,
+		unsigned                        *accepted_length = nullptr)
+{
+	if (table.initial_state == fsm_state_undefined) {
+		if (accepted_length)
+			*accepted_length = 0;
+		return fsm_run_flags::ERROR_CURRENT_STATE_NOT_SET;
+	}
+
+	fsm_run_flags result = fsm_run_flags::OK;
+	const fsm_state_id_t *next_state = table.next_state.data();
+	const size_t n_symbols = table.n_symbols;
+
+	fsm_state_id_t current = table.initial_state;
+	size_t i = 0;
+	for (; i < length; ++i) {
+		const symbol_id_t sym = word[i];
+		if (sym >= n_symbols) {
+			result |= fsm_run_flags::ERROR_INVALID_WORD;
+			break;
+		}
+		const fsm_state_id_t next = next_state[current * n_symbols + sym];
+		if (next == fsm_state_undefined) {
+			result |= fsm_run_flags::ERROR_NO_VIABLE_TRANSITION;
+			break;
+		}
+		current = next;
+	}
+
+	if (!is_final(table, current))
+		result |= fsm_run_flags::ERROR_NOT_IN_FINAL_STATE;
+
+	if (accepted_length)
+		*accepted_length = static_cast<unsigned>(i);
+	return result;
+}
+
+
+/*
+ * fsm_run_batch - run a finite state machine on a batch of words
+ *
+ * This is the fast path of fsm_run for the case in which only the outcome of
+ * each run is of interest. Each word is run from the initial state of the FSM,
+ * and the flags that fsm_run would return are written to flags_out. If
+ * accepted_lengths is given, then also the number of symbols for which a
+ * transition existed is stored for each word.
+ *
+ * In contrast to fsm_run, this function neither records a trace, nor builds
+ * any strings, nor does it modify the current state of the FSM. Rather, it
+ * walks the compiled transition table that was built in fsm_init. The only
+ * allocations happen if flags_out or accepted_lengths need to grow to the size
+ * of the batch.
+ *
+ * Note that symbol IDs outside of the FSM's alphabet are reported as
+ * ERROR_INVALID_WORD, which corresponds to a nullptr symbol in fsm_run.
+ */
+inline void
+fsm_run_batch(
+		const finite_state_machine  &fsm,
+		const fsm_word_batch        &words,
+		std::vector<fsm_run_flags>  &flags_out,
+		std::vector<unsigned>       *accepted_lengths = nullptr)
+{
+	const size_t n_words = fsm_word_batch_size(words);
+	flags_out.resize(n_words);
+	if (accepted_lengths)
+		accepted_lengths->resize(n_words);
+
+	if (!fsm.initialized) {
+		std::fill(flags_out.begin(), flags_out.end(), fsm_run_flags::ERROR_NOT_INITIALIZED);
+		if (accepted_lengths)
+			std::fill(accepted_lengths->begin(), accepted_lengths->end(), 0);
+		return;
+	}
+
+	const symbol_id_t *syms = words.symbols.data();
+	for (size_t w = 0; w < n_words; ++w) {
+		const size_t begin = words.offsets[w];
+		const size_t end   = words.offsets[w + 1];
+		flags_out[w] = fsm_run_word(fsm.compiled_table, syms + begin, end - begin,
+				accepted_lengths ? &(*accepted_lengths)[w] : nullptr);
+	}
+}
+
+
+/*
+ * struct fsm_packed_batch - a flat buffer of packed words for batched runs
+ *
+ * This is the packed variant of fsm_word_batch. The symbol IDs of all words
+ * are stored back to back in one packed word, and the i-th word lives in the
+ * symbols [offsets[i], offsets[i+1]). For a binary alphabet, this requires 32
+ * times less memory than fsm_word_batch.
+ */
+template <unsigned BitsPerSymbol>
+struct fsm_packed_batch
+{
+	// concatenated symbol IDs of all words
+	packed_word<BitsPerSymbol>
+		symbols = {};
+
+	// start offset of each word into symbols, plus the end of the last word
+	std::vector<size_t>
+		offsets = {0};
+
+	// one flag per word, set if the word was cut at a nullptr symbol. Packed
+	// words have no spare symbol ID as placeholder for a full alphabet
+	std::vector<std::uint8_t>
+		invalid = {};
+};
+
+
+/*
+ * fsm_packed_batch_size - get the number of words stored in a batch
+ */
+template <unsigned B>
+inline size_t
+fsm_packed_batch_size(const fsm_packed_batch<B> &batch)
+{
+	return batch.offsets.size() - 1;
+}
+
+
+/*
+ * fsm_packed_batch_clear - remove all words from a batch, but keep its memory
+ */
+template <unsigned B>
+inline void
+fsm_packed_batch_clear(fsm_packed_batch<B> &batch)
+{
+	packed_word_clear(batch.symbols);
+	batch.offsets.resize(1);
+	batch.offsets[0] = 0;
+	batch.invalid.clear();
+}
+
+
+/*
+ * fsm_packed_batch_push - append a word to a batch
+ *
+ * A word that contains a nullptr symbol is stored up to the nullptr and
+ * flagged as invalid, see fsm_word_batch_push.
+ */
+template <unsigned B>
+inline fsm_run_flags
+fsm_packed_batch_push(fsm_packed_batch<B> &batch, const basic_string_t &word)
+{
+	fsm_run_flags result = fsm_run_flags::OK;
+	for (auto *sym: word) {
+		if (sym == nullptr) {
+			result = fsm_run_flags::ERROR_INVALID_WORD;
+			break;
+		}
+		packed_word_push(batch.symbols, static_cast<symbol_id_t>(sym->id));
+	}
+	batch.offsets.push_back(batch.symbols.length);
+	batch.invalid.push_back(result != fsm_run_flags::OK);
+	return result;
+}
+
+
+/*
+ * fsm_packed_batch_push - append a packed word to a batch
+ */
+template <unsigned B>
+inline void
+fsm_packed_batch_push(fsm_packed_batch<B> &batch, const packed_word<B> &word)
+{
+	for (size_t i = 0; i < word.length; i++)
+		packed_word_push(batch.symbols, packed_word_get(word, i));
+	batch.offsets.push_back(batch.symbols.length);
+	batch.invalid.push_back(0);
+}
+
+
+/*
+ * __fsm_run_packed - run a compiled transition table on the symbols [begin,
+ * end) of a packed word
+ *
+ * See fsm_run_word for the return value and accepted_length. The symbols are
+ * shifted out of one 64 bit word after the other.
+ */
+template <unsigned B>
+inline fsm_run_flags
+__fsm_run_packed(
+		const compiled_transition_table &table,
+		const packed_word<B>            &word,
+		const size_t                     begin,
+		const size_t                     end,
+		unsigned                        *accepted_length)
+{
+	using W = packed_word<B>;
+
+	if (table.initial_state == fsm_state_undefined) {
+		if (accepted_length)
+			*accepted_length = 0;
+		return fsm_run_flags::ERROR_CURRENT_STATE_NOT_SET;
+	}
+
+	fsm_run_flags result = fsm_run_flags::OK;
+	const fsm_state_id_t *next_state = table.next_state.data();
+	const std::uint64_t *data = word.data.data();
+	const size_t n_symbols = table.n_symbols;
+
+	fsm_state_id_t current = table.initial_state;
+	std::uint64_t bits = 0;
+	if (begin < end)
+		bits = data[begin / W::symbols_per_word] >> ((begin % W::symbols_per_word) * B);
+
+	size_t i = begin;
+	for (; i < end; ++i) {
+		if (i % W::symbols_per_word == 0)
+			bits = data[i / W::symbols_per_word];
+		const symbol_id_t sym = static_cast<symbol_id_t>(bits & W::symbol_mask);
+		bits >>= B;
+
+		if (sym >= n_symbols) {
+			result |= fsm_run_flags::ERROR_INVALID_WORD;
+			break;
+		}
+		const fsm_state_id_t next = next_state[current * n_symbols + sym];
+		if (next == fsm_state_undefined) {
+			result |= fsm_run_flags::ERROR_NO_VIABLE_TRANSITION;
+			break;
+		}
+		current = next;
+	}
+
+	if (!is_final(table, current))
+		result |= fsm_run_flags::ERROR_NOT_IN_FINAL_STATE;
+
+	if (accepted_length)
+		*accepted_length = static_cast<unsigned>(i - begin);
+	return result;
+}
+
+
+/*
+ * fsm_run_word - run a compiled transition table on a packed word
+ */
+template <unsigned B>
+inline fsm_run_flags
+fsm_run_word(
+		const compiled_transition_table &table,
+		const packed_word<B>            &word,
+		unsigned                        *accepted_length = nullptr)
+{
+	return __fsm_run_packed(table, word, 0, word.length, accepted_length);
+}
+
+
+/*
+ * fsm_run - run a finite state machine on a packed word
+ *
+ * Similar to fsm_run_batch, this runs the word from the initial state of the
+ * FSM on its compiled transition table, and neither records a trace nor
+ * modifies the current state of the FSM.
+ */
+template <unsigned B>
+inline fsm_run_flags
+fsm_run(
+		const finite_state_machine &fsm,
+		const packed_word<B>       &word,
+		unsigned                   *accepted_length = nullptr)
+{
+	if (!fsm.initialized) {
+		if (accepted_length)
+			*accepted_length = 0;
+		return fsm_run_flags::ERROR_NOT_INITIALIZED;
+	}
+	return fsm_run_word(fsm.compiled_table, word, accepted_length);
+}
+
+
+/*
+ * fsm_run_batch - run a finite state machine on a batch of packed words
+ *
+ * For details, see fsm_run_batch for an fsm_word_batch.
+ */
+template <unsigned B>
+inline void
+fsm_run_batch(
+		const finite_state_machine  &fsm,
+		const fsm_packed_batch<B>   &words,
+		std::vector<fsm_run_flags>  &flags_out,
+		std::vector<unsigned>       *accepted_lengths = nullptr)
+{
+	const size_t n_words = fsm_packed_batch_size(words);
+	flags_out.resize(n_words);
+	if (accepted_lengths)
+		accepted_lengths->resize(n_words);
+
+	if (!fsm.initialized) {
+		std::fill(flags_out.begin(), flags_out.end(), fsm_run_flags::ERROR_NOT_INITIALIZED);
+		if (accepted_lengths)
+			std::fill(accepted_lengths->begin(), accepted_lengths->end(), 0);
+		return;
+	}
+
+	for (size_t w = 0; w < n_words; ++w) {
+		const size_t begin = words.offsets[w];
+		const size_t end   = words.offsets[w + 1];
+		unsigned length;
+		fsm_run_flags flags = __fsm_run_packed(fsm.compiled_table, words.symbols, begin, end, &length);
+
+		// like fsm_run, report the nullptr of an invalid word if the entire
+		// prefix was read
+		if (words.invalid[w] && length == end - begin && flags != fsm_run_flags::ERROR_CURRENT_STATE_NOT_SET)
+			flags |= fsm_run_flags::ERROR_INVALID_WORD;
+		flags_out[w] = flags;
+		if (accepted_lengths)
+			(*accepted_lengths)[w] = length;
+	}
+}
+
+
 inline
 std::tuple<state_ptr_vector, transition_ptr_vector>
-fsm_minimize(const finite_state_machine &fsm)
+fsm_minimize(
+		const finite_state_machine &fsm,
+		const dfa_minimize_algorithm algorithm = dfa_minimize_algorithm::Moore)
 {
 	// forward to DFA's minimize
 	return dfa_minimize(fsm.alphabet,
 			            fsm.states,
-						fsm.transitions);
+						fsm.transitions,
+						algorithm);
+}
+
+
+
+/*
+ * fsm_canonicalize - compute the canonical form of an FSM's minimal DFA
+ *
+ * The canonical form is the minimal DFA of the FSM, in which the states are
+ * labelled in breadth-first order starting from the initial state, and where
+ * the successors of each state are visited in the order of the symbols of the
+ * alphabet. The canonical form does not depend on the order of the states, on
+ * unreachable states, or on states that are equivalent.
+ *
+ * Like the minimization, the canonical form distinguishes missing transitions
+ * from transitions into a non-accepting sink state. Two FSMs thus have
+ * identical canonical forms if and only if fsm_run yields the same flags for
+ * every word. For complete DFAs, i.e. DFAs with a transition for each state
+ * and symbol, this is the case if and only if they accept the same language.
+ * A partial DFA and the same DFA completed with an explicit sink state accept
+ * the same language, but have different canonical forms, because their runs
+ * fail with ERROR_NO_VIABLE_TRANSITION and ERROR_NOT_IN_FINAL_STATE,
+ * respectively. Note that the emitted symbols of transitions are not part of
+ * the canonical form, as they are not considered during minimization either.
+ *
+ * The canonical form is stored as a compiled transition table with the
+ * initial state 0, so that it can directly be run with fsm_run_word.
+ *
+ * Note: the quotient automaton is built from the partition of equivalent
+ *       states and not from the output of dfa_minimize, because the latter
+ *       drops transitions that lead to states that were merged into another.
+ */
+inline void
+fsm_canonicalize(
+		const finite_state_machine   &fsm,
+		compiled_transition_table    &canonical,
+		const dfa_minimize_algorithm  algorithm = dfa_minimize_algorithm::Hopcroft)
+{
+	const size_t n_symbols = fsm.alphabet->n_symbols;
+	canonical.n_states      = 0;
+	canonical.n_symbols     = n_symbols;
+	canonical.initial_state = fsm_state_undefined;
+	canonical.next_state.clear();
+	canonical.accepting.clear();
+
+	if (!fsm.initialized)
+		return;
+	const state *initial = get_initial_state(fsm.states);
+	if (!initial)
+		return;
+
+	// minimize the reachable part of the automaton
+	auto [ss, ts] = dfa_remove_unreachable(fsm.states, fsm.transitions);
+	partition p = (algorithm == dfa_minimize_algorithm::Hopcroft)
+		? dfa_compute_equivalence_sets_hopcroft(fsm.alphabet, ss, ts)
+		: dfa_compute_equivalence_sets(fsm.alphabet, ss, ts);
+
+	// successor table over the indexes of the reachable states
+	size_t max_id = 0;
+	for (auto *s: ss)
+		max_id = s->id > max_id ? s->id : max_id;
+	std::vector<ptrdiff_t> index_of(max_id + 1, -1);
+	for (size_t i = 0; i < ss.size(); ++i)
+		index_of[ss[i]->id] = i;
+
+	std::vector<ptrdiff_t> delta(ss.size() * n_symbols, DFA_TRANSITION_UNDEFINED);
+	for (auto *t: ts) {
+		if (!t->from || !t->to || t->read >= n_symbols)
+			continue;
+		if (t->from->id > max_id || t->to->id > max_id)
+			continue;
+		const ptrdiff_t from = index_of[t->from->id];
+		const ptrdiff_t to   = index_of[t->to->id];
+		if (from >= 0 && to >= 0)
+			delta[from * n_symbols + t->read] = to;
+	}
+
+	// label all subsets in breadth-first order
+	const size_t n_subsets = p.subsets.size();
+	std::vector<ptrdiff_t> label(n_subsets, -1);
+	std::vector<size_t> order;
+	order.reserve(n_subsets);
+
+	const size_t start = p.subset_map[index_of[initial->id]];
+	label[start] = 0;
+	order.push_back(start);
+	for (size_t i = 0; i < order.size(); ++i) {
+		const size_t rep = p.subsets[order[i]][0];
+		for (size_t a = 0; a < n_symbols; ++a) {
+			const ptrdiff_t to = delta[rep * n_symbols + a];
+			if (to < 0)
+				continue;
+			const size_t subset = p.subset_map[to];
+			if (label[subset] < 0) {
+				label[subset] = order.size();
+				order.push_back(subset);
+			}
+		}
+	}
+
+	// fill the compiled transition table
+	const size_t n_states = order.size();
+	canonical.n_states      = n_states;
+	canonical.initial_state = 0;
+	canonical.next_state.assign(n_states * n_symbols, fsm_state_undefined);
+	canonical.accepting.assign((n_states + 63) / 64, 0);
+	for (size_t i = 0; i < n_states; ++i) {
+		const size_t rep = p.subsets[order[i]][0];
+		if (is_final(ss[rep]))
+			canonical.accepting[i / 64] |= std::uint64_t(1) << (i % 64);
+		for (size_t a = 0; a < n_symbols; ++a) {
+			const ptrdiff_t to = delta[rep * n_symbols + a];
+			if (to >= 0)
+				canonical.next_state[i * n_symbols + a] = static_cast<fsm_state_id_t>(label[p.subset_map[to]]);
+		}
+	}
+}
+
+
+/*
+ * fsm_canonical_hash - compute a 64-bit hash of a canonical form
+ *
+ * The hash combines the sizes, the transitions, and the accepting states with
+ * FNV-1a and a final avalanche step (from splitmix64).
+ */
+inline std::uint64_t
+fsm_canonical_hash(const compiled_transition_table &canonical)
+{
+	std::uint64_t h = 0xcbf29ce484222325ull;
+	auto mix = [&h](std::uint64_t v) {
+		h ^= v;
+		h *= 0x100000001b3ull;
+	};
+
+	mix(canonical.n_states);
+	mix(canonical.n_symbols);
+	for (auto next: canonical.next_state)
+		mix(next);
+	for (auto word: canonical.accepting)
+		mix(word);
+
+	h ^= h >> 30; h *= 0xbf58476d1ce4e5b9ull;
+	h ^= h >> 27; h *= 0x94d049bb133111ebull;
+	h ^= h >> 31;
+	return h;
+}
+
+
+/*
+ * fsm_hash - compute the hash of the canonical form of an FSM
+ */
+inline std::uint64_t
+fsm_hash(
+		const finite_state_machine   &fsm,
+		const dfa_minimize_algorithm  algorithm = dfa_minimize_algorithm::Hopcroft)
+{
+	compiled_transition_table canonical;
+	fsm_canonicalize(fsm, canonical, algorithm);
+	return fsm_canonical_hash(canonical);
+}
+
+
+/*
+ * struct fsm_fitness_cache - cache of fitness values keyed by canonical hashes
+ *
+ * Offspring that are structurally identical to an FSM that was evaluated
+ * already, e.g. because the mutation was a no-op or only touched unreachable
+ * states, have the same canonical hash. Their fitness can thus be looked up
+ * instead of being recomputed.
+ *
+ * Note that this only makes sense if the fitness depends on the accepted
+ * language alone, i.e. on the result of running the FSM, but not on the
+ * genome itself (e.g. a penalty on the number of states) or on emitted
+ * symbols. Hash collisions are not resolved, the chance of a collision is in
+ * the order of 2^-64 per pair of distinct automata.
+ */
+struct fsm_fitness_cache
+{
+	std::unordered_map<std::uint64_t, double>
+		values = {};
+
+	size_t
+		hits = 0;
+
+	size_t
+		misses = 0;
+};
+
+
+/*
+ * fsm_fitness_cache_get - look up a fitness value given a canonical hash
+ */
+inline std::optional<double>
+fsm_fitness_cache_get(fsm_fitness_cache &cache, std::uint64_t hash)
+{
+	auto it = cache.values.find(hash);
+	if (it == cache.values.end()) {
+		cache.misses += 1;
+		return {};
+	}
+	cache.hits += 1;
+	return it->second;
+}
+
+
+/*
+ * fsm_fitness_cache_insert - store a fitness value for a canonical hash
+ */
+inline void
+fsm_fitness_cache_insert(fsm_fitness_cache &cache, std::uint64_t hash, double fitness)
+{
+	cache.values[hash] = fitness;
+}
+
+
+/*
+ * fsm_fitness_cache_clear - remove all entries and reset the statistics
+ */
+inline void
+fsm_fitness_cache_clear(fsm_fitness_cache &cache)
+{
+	cache.values.clear();
+	cache.hits   = 0;
+	cache.misses = 0;
+}
+
+/*
+ * struct fsm_population_config - configuration of the population functions
+ *
+ * The population functions below mutate and evaluate entire populations of
+ * genomes on a thread pool. Each genome gets its own stream of random numbers,
+ * which is derived from the seed, the generation, and the index of the genome
+ * within the population. Hence, results are reproducible independent of the
+ * number of threads that are used.
+ */
+struct fsm_population_config
+{
+	// alphabet of all FSMs in the population
+	const basic_alphabet *
+		alphabet = nullptr;
+
+	// mutation rates and maximal number of states, see mutate_genome
+	mutation_rates
+		rates = {};
+
+	size_t
+		max_nstates = 3;
+
+	// base seed from which the random number streams of all genomes are
+	// derived
+	std::uint64_t
+		seed = 0;
+
+	// number of genomes that are processed in one task of the thread pool
+	size_t
+		grain = 16;
+};
+
+
+/*
+ * struct fsm_population_workspace - per-worker memory of the population functions
+ *
+ * The evaluation functions translate each genome into an FSM whose states and
+ * transitions come from an arena of the worker. Arenas keep their pages after
+ * a reset, so passing the same workspace to the evaluation of each generation
+ * avoids allocating them anew per call. A workspace must not be used by two
+ * calls concurrently.
+ */
+struct fsm_population_workspace
+{
+	std::vector<std::unique_ptr<fsm_arena>>
+		arenas = {};
+};
+
+
+/*
+ * __fsm_population_arenas - get one arena per worker of the pool
+ */
+inline std::vector<std::unique_ptr<fsm_arena>>&
+__fsm_population_arenas(thread_pool *pool, fsm_population_workspace &workspace)
+{
+	const size_t n_workers = pool ? pool->size() : 1;
+	while (workspace.arenas.size() < n_workers)
+		workspace.arenas.push_back(std::make_unique<fsm_arena>());
+	return workspace.arenas;
+}
+
+
+/*
+ * fsm_population_stream - get the random number stream ID of a genome
+ */
+inline std::uint64_t
+fsm_population_stream(std::uint64_t generation, size_t index)
+{
+	return (generation << 32) ^ static_cast<std::uint64_t>(index);
+}
+
+
+/*
+ * fsm_population_mutate - mutate all parents into offspring
+ *
+ * offspring[i] will contain the mutated version of parents[i]. If pool is
+ * nullptr, all genomes are mutated on the calling thread.
+ */
+inline void
+fsm_population_mutate(
+		thread_pool                 *pool,
+		const fsm_population_config &config,
+		const std::uint64_t          generation,
+		const std::vector<fsm_genome> &parents,
+		std::vector<fsm_genome>     &offspring)
+{
+	offspring.resize(parents.size());
+
+	// each genome has its own stream of a counter-based generator, which is
+	// selected in constant time, see reseed_rng for philox4x32
+	parallel_for(pool, parents.size(), config.grain,
+		[&](size_t begin, size_t end, unsigned) {
+			for (size_t i = begin; i < end; ++i) {
+				philox4x32 rng(config.seed, fsm_population_stream(generation, i));
+				offspring[i] = mutate_genome(parents[i], config.rates, *config.alphabet, &rng, config.max_nstates);
+			}
+		});
+}
+
+
+/*
+ * fsm_population_evaluate - evaluate the fitness of all genomes
+ *
+ * Each genome is translated into an FSM with the help of a per-worker arena,
+ * and then passed to the fitness function, which has the signature
+ *
+ *     double fitness_fn(finite_state_machine &fsm, size_t index);
+ *
+ * The FSM is initialized and reset when it is passed to the fitness function.
+ * It is initialized from genomes[index] via fsm_init(fsm, genome), i.e. the
+ * genome is not copied into fsm.genome. The fitness function might be called
+ * concurrently from several threads, and must therefore not modify shared
+ * state without synchronization. The result of the fitness function for
+ * genomes[i] is stored in fitness[i].
+ *
+ * If workspace is nullptr, the arenas only live during the call.
+ */
+template <typename FitnessFn>
+void
+fsm_population_evaluate(
+		thread_pool                 *pool,
+		const fsm_population_config &config,
+		const std::vector<fsm_genome> &genomes,
+		std::vector<double>         &fitness,
+		FitnessFn                  &&fitness_fn,
+		fsm_population_workspace    *workspace = nullptr)
+{
+	fitness.resize(genomes.size());
+
+	fsm_population_workspace local;
+	auto &arenas = __fsm_population_arenas(pool, workspace ? *workspace : local);
+	parallel_for(pool, genomes.size(), config.grain,
+		[&](size_t begin, size_t end, unsigned worker) {
+			finite_state_machine fsm;
+			fsm.alphabet = config.alphabet;
+			fsm.arena    = arenas[worker].get();
+			for (size_t i = begin; i < end; ++i) {
+				fsm_init(fsm, genomes[i]);
+				fsm_reset(fsm);
+				fitness[i] = fitness_fn(fsm, i);
+				fsm_free(fsm);
+				fsm_arena_reset(*fsm.arena);
+			}
+		});
+}
+
+
+/*
+ * fsm_population_step - mutate a population and evaluate the offspring
+ *
+ * This is a shorthand for fsm_population_mutate, followed by a call to
+ * fsm_population_evaluate on the offspring.
+ */
+template <typename FitnessFn>
+void
+fsm_population_step(
+		thread_pool                 *pool,
+		const fsm_population_config &config,
+		const std::uint64_t          generation,
+		const std::vector<fsm_genome> &parents,
+		std::vector<fsm_genome>     &offspring,
+		std::vector<double>         &fitness,
+		FitnessFn                  &&fitness_fn,
+		fsm_population_workspace    *workspace = nullptr)
+{
+	fsm_population_mutate(pool, config, generation, parents, offspring);
+	fsm_population_evaluate(pool, config, offspring, fitness, std::forward<FitnessFn>(fitness_fn), workspace);
+}
+
+
+
+/*
+ * fsm_population_evaluate_cached - evaluate genomes, skipping known automata
+ *
+ * This is similar to fsm_population_evaluate, but first computes the canonical
+ * hash of each genome's FSM. Only one genome per hash is evaluated, and only
+ * if the hash is not found in the cache already. All other genomes receive the
+ * cached fitness. The fitness function is only called for the representative
+ * genome of a hash, and its index is passed along as for
+ * fsm_population_evaluate. See fsm_fitness_cache for the requirements on the
+ * fitness function, and fsm_population_evaluate for the workspace.
+ */
+template <typename FitnessFn>
+void
+fsm_population_evaluate_cached(
+		thread_pool                 *pool,
+		const fsm_population_config &config,
+		const std::vector<fsm_genome> &genomes,
+		std::vector<double>         &fitness,
+		fsm_fitness_cache           &cache,
+		FitnessFn                  &&fitness_fn,
+		fsm_population_workspace    *workspace = nullptr)
+{
+	const size_t n = genomes.size();
+	fitness.resize(n);
+
+	// compute all hashes in parallel
+	std::vector<std::uint64_t> hashes(n);
+	fsm_population_workspace local;
+	auto &arenas = __fsm_population_arenas(pool, workspace ? *workspace : local);
+	parallel_for(pool, n, config.grain,
+		[&](size_t begin, size_t end, unsigned worker) {
+			finite_state_machine fsm;
+			fsm.alphabet = config.alphabet;
+			fsm.arena    = arenas[worker].get();
+			for (size_t i = begin; i < end; ++i) {
+				fsm_init(fsm, genomes[i]);
+				hashes[i] = fsm_hash(fsm);
+				fsm_free(fsm);
+				fsm_arena_reset(*fsm.arena);
+			}
+		});
+
+	// determine which genomes need to be evaluated. This happens serially to
+	// keep the outcome independent of the number of threads
+	std::vector<size_t> todo;
+	std::unordered_map<std::uint64_t, size_t> representative;
+	for (size_t i = 0; i < n; ++i) {
+		if (representative.count(hashes[i]))
+			continue;
+		representative[hashes[i]] = i;
+		auto cached = fsm_fitness_cache_get(cache, hashes[i]);
+		if (cached)
+			fitness[i] = cached.value();
+		else
+			todo.push_back(i);
+	}
+
+	// evaluate all unknown automata
+	parallel_for(pool, todo.size(), config.grain,
+		[&](size_t begin, size_t end, unsigned worker) {
+			finite_state_machine fsm;
+			fsm.alphabet = config.alphabet;
+			fsm.arena    = arenas[worker].get();
+			for (size_t j = begin; j < end; ++j) {
+				const size_t i = todo[j];
+				fsm_init(fsm, genomes[i]);
+				fsm_reset(fsm);
+				fitness[i] = fitness_fn(fsm, i);
+				fsm_free(fsm);
+				fsm_arena_reset(*fsm.arena);
+			}
+		});
+
+	// update the cache and propagate the results to all duplicates
+	for (size_t i: todo)
+		fsm_fitness_cache_insert(cache, hashes[i], fitness[i]);
+	for (size_t i = 0; i < n; ++i)
+		fitness[i] = fitness[representative[hashes[i]]];
 }
 
 
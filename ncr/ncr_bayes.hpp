@@ -4,6 +4,11 @@
  * SPDX-FileCopyrightText: 2022-2023 Nicolai Waniek <n@rochus.net>
  * SPDX-License-Identifier: MIT
  * See LICENSE file for more details.
+ *
+ * Besides the classic particle filter over particle objects with virtual
+ * functions, this file contains particle_filter_soa, which keeps the state of
+ * all particles in a structure of arrays (e.g. particle_columns), calls batch
+ * functors on ranges of particles in parallel, and keeps weights in log space.
  */
 
 #pragma once
@@ -14,6 +19,13 @@
 #include <random>
 #include <chrono>
 #include <algorithm>
+#include <span>
+#include <cmath>
+#include <limits>
+#include <tuple>
+#include <concepts>
+
+#include <ncr/ncr_algorithm.hpp>
 
 namespace ncr {
 
@@ -35,7 +47,8 @@ struct particle
 /*
  * the low variance resampler selects N indices out of a set of particles
  *
- * TODO: adapt to ncr_algorithm.low_variance_sampler
+ * The weights of the particles are gathered into contiguous memory, and the
+ * indices are drawn with ncr::low_variance_resample.
  */
 template <typename ParticleType, typename RealType = double>
 struct low_variance_resampler
@@ -54,34 +67,31 @@ struct low_variance_resampler
 
 	/*
 	 * resample - resample particles with low variance
+	 *
+	 * Draws as many indices as there are particles. The indices are sorted,
+	 * see ncr::resample_inplace.
 	 */
 	std::vector<size_t>
 	resample(const std::vector<ParticleType> &particles)
 	{
-		size_t index = size_t(unif(rng) * N);
-		std::vector<size_t> indices(N);
+		N = particles.size();
+		weights.resize(N);
+		for (size_t i = 0; i < N; i++)
+			weights[i] = particles[i].weight;
 
-		RealType beta = 0.0;
-		auto max_particle = std::max_element(particles.begin(), particles.end(),
-				[](ParticleType a, ParticleType b) {
-					return a.weight < b.weight;
-				});
-		RealType max_weight = (*max_particle).weight;
-		for (size_t i = 0; i < N; i++) {
-			beta += unif(rng) * 2.0 * max_weight;
-			while (beta > particles[index].weight) {
-				beta -= particles[index].weight;
-				index = (index + 1) % N;
-			}
-			indices[i] = index;
+		std::vector<size_t> indices(N);
+		if (!low_variance_resample(std::span<const RealType>(weights), std::span<size_t>(indices), &rng, scheme)) {
+			// degenerate weights, keep all particles
+			for (size_t i = 0; i < N; i++)
+				indices[i] = i;
 		}
 		return indices;
 	}
 
-	size_t N;
-	std::random_device rd;
+	size_t N = 0;
+	resampling_scheme scheme = resampling_scheme::systematic;
 	std::mt19937_64 rng;
-	std::uniform_real_distribution<RealType> unif{0.0, 1.0};
+	std::vector<RealType> weights;
 };
 
 
@@ -107,12 +117,288 @@ struct particle_filter {
 	}
 
 	void resample() {
-		std::vector<size_t> &&indices = resampler.resample(this->particles);
-		std::vector<ParticleType> new_particles(N);
-		for (size_t i = 0; i < N; i++)
-			new_particles[i] = particles[indices[i]];
-		std::swap(new_particles, particles);
+		std::vector<size_t> indices = resampler.resample(this->particles);
+		resample_inplace(std::span<ParticleType>(particles), std::span<const size_t>(indices));
+	}
+};
+
+
+/*
+ * particle_state - structure of arrays that stores the state of n particles
+ *
+ * copy(dst, src) copies all state variables of particle src to particle dst.
+ */
+template <typename S>
+concept particle_state = requires(S s, const S cs, size_t i) {
+	{ cs.size() } -> std::convertible_to<size_t>;
+	s.resize(i);
+	s.copy(i, i);
+};
+
+
+/*
+ * particle_columns - particle state with one column per state variable
+ *
+ * Example for a 2D pose:
+ *
+ *     ncr::particle_columns<double, double, double> pose; // x, y, theta
+ *     auto &x = pose.column<0>();
+ */
+template <typename... Ts>
+struct particle_columns
+{
+	std::tuple<std::vector<Ts>...> columns;
+
+	template <size_t I>       auto& column()       { return std::get<I>(this->columns); }
+	template <size_t I> const auto& column() const { return std::get<I>(this->columns); }
+
+	size_t
+	size() const
+	{
+		return std::get<0>(this->columns).size();
+	}
+
+	void
+	resize(size_t n)
+	{
+		std::apply([n](auto &... cols) { (cols.resize(n), ...); }, this->columns);
+	}
+
+	void
+	copy(size_t dst, size_t src)
+	{
+		std::apply([=](auto &... cols) { ((cols[dst] = cols[src]), ...); }, this->columns);
+	}
+};
+
+
+/*
+ * particle_filter_soa - particle filter over a structure of arrays
+ *
+ * The filter calls batch functors on chunks of grain particles, distributed
+ * over the workers of pool if one is set:
+ *
+ *     predict(state, begin, end, worker)
+ *     log_likelihood(state, begin, end, out, worker)
+ *
+ * where log_likelihood writes the log-likelihood of the measurement for
+ * particles [begin, end) to out[0, end - begin). Note that which worker
+ * processes which chunk is not deterministic. For reproducible results,
+ * random numbers should be derived from begin, e.g. by seeding an rng per
+ * chunk.
+ *
+ * Weights are accumulated and normalized in log space, so that products of
+ * many small likelihoods don't underflow. Resampling only happens if the
+ * effective sample size drops below resample_threshold * size().
+ */
+template <particle_state State, typename RealType = double>
+struct particle_filter_soa
+{
+	State                 state;
+	std::vector<RealType> log_weights;
+	std::vector<RealType> weights;
+
+	thread_pool          *pool = nullptr;
+	size_t                grain = 4096;
+	RealType              resample_threshold = RealType(0.5);
+	resampling_scheme     scheme = resampling_scheme::systematic;
+	std::mt19937_64       rng;
+
+	particle_filter_soa(size_t Nparticles, std::uint64_t seed = 0)
+	: rng(seed)
+	{
+		this->resize(Nparticles);
 	}
+
+	size_t size() const { return this->weights.size(); }
+
+	// change the number of particles and reset all weights
+	void
+	resize(size_t n)
+	{
+		this->state.resize(n);
+		this->log_weights.resize(n);
+		this->weights.resize(n);
+		this->_indices.resize(n);
+		this->reset_weights();
+	}
+
+	void
+	reset_weights()
+	{
+		const size_t n = this->size();
+		if (!n)
+			return;
+		std::fill(this->log_weights.begin(), this->log_weights.end(), -std::log(RealType(n)));
+		std::fill(this->weights.begin(), this->weights.end(), RealType(1) / RealType(n));
+	}
+
+	template <typename Fn>
+	void
+	predict(Fn &&fn)
+	{
+		this->_for_chunks([&](size_t begin, size_t end, unsigned worker) {
+			fn(this->state, begin, end, worker);
+		});
+	}
+
+	/*
+	 * update - weight all particles by the likelihood of a measurement
+	 *
+	 * Returns the effective sample size 1 / sum(w_i^2) of the normalized
+	 * weights. If the likelihood of all particles is zero, the weights are
+	 * reset to uniform and 0 is returned.
+	 */
+	template <typename Fn>
+	RealType
+	update(Fn &&log_likelihood)
+	{
+		const size_t n = this->size();
+		if (!n)
+			return RealType(0);
+
+		// reductions are computed per chunk, and then summed up in chunk
+		// order. The result thus doesn't depend on the number of workers
+		const size_t g = this->_grain();
+		const size_t n_chunks = (n + g - 1) / g;
+		this->_partial.assign(n_chunks, RealType(0));
+
+		constexpr RealType neg_inf = -std::numeric_limits<RealType>::infinity();
+		this->_for_chunks([&](size_t begin, size_t end, unsigned worker) {
+			std::span<RealType> lw(this->log_weights.data() + begin, end - begin);
+			std::span<RealType> out(this->weights.data() + begin, end - begin);
+			log_likelihood(this->state, begin, end, out, worker);
+			RealType m = neg_inf;
+			for (size_t i = 0; i < lw.size(); i++) {
+				lw[i] += out[i];
+				m = std::max(m, lw[i]);
+			}
+			this->_partial[begin / g] = m;
+		});
+		const RealType max_lw = *std::max_element(this->_partial.begin(), this->_partial.end());
+		if (!std::isfinite(max_lw)) {
+			this->reset_weights();
+			return RealType(0);
+		}
+
+		// sum of exp(lw - max) for the normalization
+		this->_for_chunks([&](size_t begin, size_t end, unsigned) {
+			RealType sum = 0;
+			for (size_t i = begin; i < end; i++) {
+				this->weights[i] = std::exp(this->log_weights[i] - max_lw);
+				sum += this->weights[i];
+			}
+			this->_partial[begin / g] = sum;
+		});
+		RealType sum = 0;
+		for (auto p: this->_partial)
+			sum += p;
+		const RealType log_norm = max_lw + std::log(sum);
+
+		// normalize, and gather the sum of squares for the ESS
+		this->_for_chunks([&](size_t begin, size_t end, unsigned) {
+			RealType sq = 0;
+			for (size_t i = begin; i < end; i++) {
+				this->log_weights[i] -= log_norm;
+				this->weights[i] /= sum;
+				sq += this->weights[i] * this->weights[i];
+			}
+			this->_partial[begin / g] = sq;
+		});
+		RealType sq = 0;
+		for (auto p: this->_partial)
+			sq += p;
+		return RealType(1) / sq;
+	}
+
+	/*
+	 * resample - draw a new set of particles proportionally to their weights
+	 *
+	 * The state is reordered in place, and the weights are reset to uniform.
+	 */
+	bool
+	resample()
+	{
+		const size_t n = this->size();
+		if (!low_variance_resample(std::span<const RealType>(this->weights), std::span<size_t>(this->_indices),
+					&this->rng, this->scheme, this->pool))
+			return false;
+		if (!resample_inplace(n, std::span<const size_t>(this->_indices),
+					[&](size_t dst, size_t src) { this->state.copy(dst, src); }))
+			return false;
+		this->reset_weights();
+		return true;
+	}
+
+	/*
+	 * step - predict, update, and resample if the effective sample size is
+	 * below the threshold. Returns true if the particles were resampled
+	 */
+	template <typename PredictFn, typename LikelihoodFn>
+	bool
+	step(PredictFn &&predict_fn, LikelihoodFn &&log_likelihood)
+	{
+		this->predict(std::forward<PredictFn>(predict_fn));
+		const RealType ess = this->update(std::forward<LikelihoodFn>(log_likelihood));
+		if (ess >= this->resample_threshold * RealType(this->size()))
+			return false;
+		return this->resample();
+	}
+
+	/*
+	 * expectation - weighted mean of fn(state, i) over all particles
+	 */
+	template <typename Fn>
+	RealType
+	expectation(Fn &&fn)
+	{
+		const size_t n = this->size();
+		if (!n)
+			return RealType(0);
+		const size_t g = this->_grain();
+		this->_partial.assign((n + g - 1) / g, RealType(0));
+		this->_for_chunks([&](size_t begin, size_t end, unsigned) {
+			RealType acc = 0;
+			for (size_t i = begin; i < end; i++)
+				acc += this->weights[i] * fn(this->state, i);
+			this->_partial[begin / g] = acc;
+		});
+		RealType acc = 0;
+		for (auto p: this->_partial)
+			acc += p;
+		return acc;
+	}
+
+private:
+	size_t
+	_grain() const
+	{
+		return this->grain ? this->grain : 1;
+	}
+
+	// run fn(begin, end, worker) over chunks of grain particles. In contrast
+	// to parallel_for, the chunks are the same with and without a pool, so
+	// that results don't depend on it
+	template <typename Fn>
+	void
+	_for_chunks(Fn &&fn)
+	{
+		const size_t n = this->size();
+		const size_t g = this->_grain();
+		const size_t n_chunks = (n + g - 1) / g;
+		auto chunk_fn = [&](size_t chunk, unsigned worker) {
+			const size_t begin = chunk * g;
+			fn(begin, std::min(n, begin + g), worker);
+		};
+		if (this->pool)
+			this->pool->run(n_chunks, chunk_fn);
+		else
+			for (size_t c = 0; c < n_chunks; c++)
+				chunk_fn(c, 0u);
+	}
+
+	std::vector<size_t>   _indices;
+	std::vector<RealType> _partial;
 };
 
 
@@ -14,11 +14,18 @@
 #include <string>
 #include <utility>
 #include <ostream>
+#include <istream>
+#include <optional>
+#include <limits>
+#include <cstring>
 #include <locale>
 #include <stdexcept>
 #include <concepts>
 #include <bit> // popcount
 
+#include <ncr/ncr_utils.hpp>
+#include <ncr/ncr_bits.hpp>
+
 namespace ncr {
 
 /*
@@ -57,6 +64,131 @@ namespace ncr {
  */
 
 
+/*
+ * bulk kernels on the raw words of bitsets
+ *
+ * These operate directly on the word arrays of (equally sized) bitsets, and
+ * are written as simple loops without dependencies across iterations so that
+ * the compiler can vectorize them. dst and src might be the same array, e.g.
+ * for a &= a, which is why they are not declared __restrict. Counting uses
+ * several independent accumulators to not serialize on a single sum. Note
+ * that popcount will only be vectorized if the target supports it, e.g. with
+ * -mavx512vpopcntdq, and is a scalar popcnt per word otherwise.
+ *
+ * The fused kernels (count_and, count_xor, any_and) never materialize the
+ * intermediate bitset.
+ */
+template <std::unsigned_integral W>
+inline void
+__bitset_and(W *dst, const W *src, const size_t n)
+{
+	NCR_IVDEP
+	for (size_t i = 0; i < n; i++)
+		dst[i] &= src[i];
+}
+
+template <std::unsigned_integral W>
+inline void
+__bitset_or(W *dst, const W *src, const size_t n)
+{
+	NCR_IVDEP
+	for (size_t i = 0; i < n; i++)
+		dst[i] |= src[i];
+}
+
+template <std::unsigned_integral W>
+inline void
+__bitset_xor(W *dst, const W *src, const size_t n)
+{
+	NCR_IVDEP
+	for (size_t i = 0; i < n; i++)
+		dst[i] ^= src[i];
+}
+
+template <std::unsigned_integral W>
+inline void
+__bitset_andnot(W *dst, const W *src, const size_t n)
+{
+	NCR_IVDEP
+	for (size_t i = 0; i < n; i++)
+		dst[i] &= static_cast<W>(~src[i]);
+}
+
+// count the set bits of f(i) for all words i in [0, n)
+template <std::unsigned_integral W, typename Fn>
+inline size_t
+__bitset_count_words(const size_t n, Fn &&f)
+{
+	size_t c0 = 0, c1 = 0, c2 = 0, c3 = 0;
+	size_t i = 0;
+	for (; i + 4 <= n; i += 4) {
+		c0 += static_cast<size_t>(std::popcount(static_cast<W>(f(i + 0))));
+		c1 += static_cast<size_t>(std::popcount(static_cast<W>(f(i + 1))));
+		c2 += static_cast<size_t>(std::popcount(static_cast<W>(f(i + 2))));
+		c3 += static_cast<size_t>(std::popcount(static_cast<W>(f(i + 3))));
+	}
+	for (; i < n; i++)
+		c0 += static_cast<size_t>(std::popcount(static_cast<W>(f(i))));
+	return c0 + c1 + c2 + c3;
+}
+
+template <std::unsigned_integral W>
+inline size_t
+__bitset_count(const W *a, const size_t n)
+{
+	return __bitset_count_words<W>(n, [a](size_t i) { return a[i]; });
+}
+
+template <std::unsigned_integral W>
+inline size_t
+__bitset_count_and(const W *a, const W *b, const size_t n)
+{
+	return __bitset_count_words<W>(n, [a, b](size_t i) { return a[i] & b[i]; });
+}
+
+template <std::unsigned_integral W>
+inline size_t
+__bitset_count_xor(const W *a, const W *b, const size_t n)
+{
+	return __bitset_count_words<W>(n, [a, b](size_t i) { return a[i] ^ b[i]; });
+}
+
+// test if any word of f(i) is non-zero. This reduces blocks of words with OR
+// and only checks once per block, so that each block vectorizes
+template <std::unsigned_integral W, typename Fn>
+inline bool
+__bitset_any_words(const size_t n, Fn &&f)
+{
+	constexpr size_t block = 64 / sizeof(W) > 0 ? 64 / sizeof(W) : 1;
+	size_t i = 0;
+	for (; i + block <= n; i += block) {
+		W acc = 0;
+		for (size_t j = 0; j < block; j++)
+			acc |= static_cast<W>(f(i + j));
+		if (acc)
+			return true;
+	}
+	for (; i < n; i++)
+		if (static_cast<W>(f(i)))
+			return true;
+	return false;
+}
+
+template <std::unsigned_integral W>
+inline bool
+__bitset_any(const W *a, const size_t n)
+{
+	return __bitset_any_words<W>(n, [a](size_t i) { return a[i]; });
+}
+
+template <std::unsigned_integral W>
+inline bool
+__bitset_any_and(const W *a, const W *b, const size_t n)
+{
+	return __bitset_any_words<W>(n, [a, b](size_t i) { return a[i] & b[i]; });
+}
+
+
 /*
  * base template for all functions that a compile-time and dynamic bitset share
  * in common using a Curiously Recurring Template Pattern (CRTP)
@@ -73,6 +205,10 @@ struct _bitset_base
 	constexpr static size_t
 		_bits_per_word  = sizeof(word_t) * CHAR_BIT;
 
+	// word with all bits set. Note the cast, as ~ promotes small types to int
+	constexpr static word_t
+		_all_ones = static_cast<word_t>(~static_cast<word_t>(0));
+
 	// copy data from a regular string
 	template <typename CharT, typename Traits, typename Alloc>
 	void
@@ -334,18 +470,98 @@ struct _bitset_base
 	size_t
 	count() const
 	{
-		size_t result = 0;
 		auto _this = static_cast<const Derived*>(this);
-		for (size_t i = 0; i < _this->_word_count; i++)
-			result += _bits_in_word(i);
-		return result;
+		return __bitset_count(_this->_bits, _this->_word_count);
 	}
 
 	bool all() const  { return count() == static_cast<const Derived*>(this)->_Nbits; }
 
-	bool any() const  { return count() > 0; }
+	bool any() const
+	{
+		auto _this = static_cast<const Derived*>(this);
+		return __bitset_any(_this->_bits, _this->_word_count);
+	}
 
-	bool none() const { return count() == 0; }
+	bool none() const { return !any(); }
+
+	// find the index of the first set bit at or after position pos. Returns
+	// size() if there is no such bit
+	size_t
+	_find_from(size_t pos) const
+	{
+		auto _this = static_cast<const Derived*>(this);
+		if (pos >= _this->_Nbits)
+			return _this->_Nbits;
+
+		size_t p = get_pos(pos);
+		word_t w = _this->_bits[p] & static_cast<word_t>(_all_ones << (pos % _bits_per_word));
+		while (w == 0) {
+			if (++p >= _this->_word_count)
+				return _this->_Nbits;
+			w = _this->_bits[p];
+		}
+
+		// padding bits might be set, see set()
+		const size_t result = p * _bits_per_word + static_cast<size_t>(std::countr_zero(w));
+		return result < _this->_Nbits ? result : _this->_Nbits;
+	}
+
+	// find the index of the first set bit, or size() if no bit is set
+	size_t
+	find_first() const
+	{
+		return _find_from(0);
+	}
+
+	// find the index of the next set bit after pos, or size() if there is none
+	size_t
+	find_next(size_t pos) const
+	{
+		return _find_from(pos + 1);
+	}
+
+	// call fn(i) for the index i of each set bit, in increasing order. This
+	// skips entire words without any set bit, and thereby is well suited for
+	// sparse bitsets
+	template <typename Fn>
+	void
+	for_each_set(Fn &&fn) const
+	{
+		auto _this = static_cast<const Derived*>(this);
+		for (size_t p = 0; p < _this->_word_count; p++) {
+			word_t w = _this->_bits[p];
+
+			// mask out padding bits in the last word
+			const size_t base = p * _bits_per_word;
+			if (base + _bits_per_word > _this->_Nbits)
+				w &= static_cast<word_t>(_all_ones >> (base + _bits_per_word - _this->_Nbits));
+
+			while (w != 0) {
+				fn(base + static_cast<size_t>(std::countr_zero(w)));
+				// clear the lowest set bit
+				w &= static_cast<word_t>(w - 1);
+			}
+		}
+	}
+
+	// test if the word count of another bitset matches, as required by the bulk
+	// operations
+	void
+	_check_size(const Derived &b, const char *msg) const
+	{
+		if (b._Nbits != static_cast<const Derived*>(this)->_Nbits)
+			throw std::length_error(msg);
+	}
+
+	// bitwise operators: clear all bits that are set in b, i.e. this & ~b
+	Derived&
+	andnot(const Derived &b)
+	{
+		auto _this = static_cast<Derived*>(this);
+		_check_size(b, "Length mismatch in andnot of ncr::bitset.");
+		__bitset_andnot(_this->_bits, b._bits, _this->_word_count);
+		return *_this;
+	}
 
 };
 
@@ -412,8 +628,7 @@ struct bitset : _bitset_base<StorageType, bitset<Nbits, StorageType>>
 	bitset<_Nbits, StorageType>&
 	operator^=(const bitset<_Nbits, StorageType> &b)
 	{
-		for (size_t i = 0; i < _word_count; i++)
-			_bits[i] ^= b._bits[i];
+		__bitset_xor(_bits, b._bits, _word_count);
 		return *this;
 	}
 
@@ -421,8 +636,7 @@ struct bitset : _bitset_base<StorageType, bitset<Nbits, StorageType>>
 	bitset<_Nbits, StorageType>&
 	operator|=(const bitset<_Nbits, StorageType> &b)
 	{
-		for (size_t i = 0; i < _word_count; i++)
-			_bits[i] |= b._bits[i];
+		__bitset_or(_bits, b._bits, _word_count);
 		return *this;
 	}
 
@@ -430,8 +644,7 @@ struct bitset : _bitset_base<StorageType, bitset<Nbits, StorageType>>
 	bitset<_Nbits, StorageType>&
 	operator&=(const bitset<_Nbits, StorageType> &b)
 	{
-		for (size_t i = 0; i < _word_count; i++)
-			_bits[i] &= b._bits[i];
+		__bitset_and(_bits, b._bits, _word_count);
 		return *this;
 	}
 
@@ -526,13 +739,28 @@ operator^(const bitset<Nbits, StorageType> &a, const bitset<Nbits, StorageType>
 	return result;
 }
 
-// hamming distance between two bitsets based on XOR-ing the two sets
+// hamming distance between two bitsets, i.e. the number of bits of a ^ b
 template <size_t Nbits, typename StorageType>
 inline size_t
 hamming(const bitset<Nbits, StorageType> &a, const bitset<Nbits, StorageType> &b)
 {
-	auto tmp = a ^ b;
-	return tmp.count();
+	return __bitset_count_xor(a._bits, b._bits, a._word_count);
+}
+
+// number of bits of a & b
+template <size_t Nbits, typename StorageType>
+inline size_t
+count_and(const bitset<Nbits, StorageType> &a, const bitset<Nbits, StorageType> &b)
+{
+	return __bitset_count_and(a._bits, b._bits, a._word_count);
+}
+
+// test if a & b has any bit set
+template <size_t Nbits, typename StorageType>
+inline bool
+any_and(const bitset<Nbits, StorageType> &a, const bitset<Nbits, StorageType> &b)
+{
+	return __bitset_any_and(a._bits, b._bits, a._word_count);
 }
 
 
@@ -718,8 +946,7 @@ struct dynamic_bitset : _bitset_base<StorageType, dynamic_bitset<StorageType>>
 		if (b._Nbits != _Nbits)
 			throw std::length_error("Length mismatch in operator^= of ncr::dynamic_bitset.");
 
-		for (size_t i = 0; i < _word_count; i++)
-			_bits[i] ^= b._bits[i];
+		__bitset_xor(_bits, b._bits, _word_count);
 		return *this;
 	}
 
@@ -730,8 +957,7 @@ struct dynamic_bitset : _bitset_base<StorageType, dynamic_bitset<StorageType>>
 		if (b._Nbits != _Nbits)
 			throw std::length_error("Length mismatch in operator^= of ncr::dynamic_bitset.");
 
-		for (size_t i = 0; i < _word_count; i++)
-			_bits[i] |= b._bits[i];
+		__bitset_or(_bits, b._bits, _word_count);
 		return *this;
 	}
 
@@ -742,8 +968,7 @@ struct dynamic_bitset : _bitset_base<StorageType, dynamic_bitset<StorageType>>
 		if (b._Nbits != _Nbits)
 			throw std::length_error("Length mismatch in operator^= of ncr::dynamic_bitset.");
 
-		for (size_t i = 0; i < _word_count; i++)
-			_bits[i] &= b._bits[i];
+		__bitset_and(_bits, b._bits, _word_count);
 		return *this;
 	}
 
@@ -852,13 +1077,31 @@ operator^(const dynamic_bitset<StorageType> &a, const dynamic_bitset<StorageType
 	return result;
 }
 
-// hamming distance between two bitsets is rather simple to compute
+// hamming distance between two bitsets, i.e. the number of bits of a ^ b
 template <typename StorageType>
 inline size_t
 hamming(const dynamic_bitset<StorageType> &a, const dynamic_bitset<StorageType> &b)
 {
-	auto tmp = a ^ b;
-	return tmp.count();
+	a._check_size(b, "Length mismatch in hamming of ncr::dynamic_bitset.");
+	return __bitset_count_xor(a._bits, b._bits, a._word_count);
+}
+
+// number of bits of a & b
+template <typename StorageType>
+inline size_t
+count_and(const dynamic_bitset<StorageType> &a, const dynamic_bitset<StorageType> &b)
+{
+	a._check_size(b, "Length mismatch in count_and of ncr::dynamic_bitset.");
+	return __bitset_count_and(a._bits, b._bits, a._word_count);
+}
+
+// test if a & b has any bit set
+template <typename StorageType>
+inline bool
+any_and(const dynamic_bitset<StorageType> &a, const dynamic_bitset<StorageType> &b)
+{
+	a._check_size(b, "Length mismatch in any_and of ncr::dynamic_bitset.");
+	return __bitset_any_and(a._bits, b._bits, a._word_count);
 }
 
 // Levensthein for this type of bitset
@@ -895,4 +1138,338 @@ operator<<(std::basic_ostream<CharT, Traits> &os, const dynamic_bitset<StorageTy
 }
 
 
+
+/*
+ * binary serialization of bitsets
+ *
+ * A serialized bitset consists of a header of 16 bytes, followed by the raw
+ * words of the bitset:
+ *
+ *     offset  size  content
+ *          0     4  magic "NCRB"
+ *          4     1  format version (1)
+ *          5     1  bytes per word
+ *          6     1  byte order of the writer (0 little, 1 big endian)
+ *          7     1  reserved (0)
+ *          8     8  number of bits, in the byte order of the writer
+ *         16     *  words, in the byte order of the writer
+ *
+ * Writing thus never converts or copies the words, and readers only swap bytes
+ * if the byte order of the file differs from their own. A file which was
+ * written on a machine with the same byte order can also be used directly from
+ * a memory mapped region, see bitset_map.
+ */
+struct bitset_header {
+	char magic[4];
+	u8   version;
+	u8   word_size;
+	u8   byte_order;
+	u8   reserved;
+	u64  nbits;
+};
+static_assert(sizeof(bitset_header) == 16);
+
+constexpr u8 bitset_format_version = 1;
+
+constexpr u8
+__bitset_native_byte_order()
+{
+	return std::endian::native == std::endian::big ? 1 : 0;
+}
+
+
+/*
+ * __bitset_bswap - swap the bytes of a storage word of any unsigned type
+ */
+template <std::unsigned_integral W>
+inline W
+__bitset_bswap(W w)
+{
+	if constexpr (sizeof(W) == 1)
+		return w;
+	else if constexpr (sizeof(W) == 2)
+		return std::bit_cast<W>(bswap<u16>(std::bit_cast<u16>(w)));
+	else if constexpr (sizeof(W) == 4)
+		return std::bit_cast<W>(bswap<u32>(std::bit_cast<u32>(w)));
+	else
+		return std::bit_cast<W>(bswap<u64>(std::bit_cast<u64>(w)));
+}
+
+
+/*
+ * __bitset_header_decode - check a header, and bring it into native byte order
+ *
+ * Returns true if the words that follow the header need to be byte swapped.
+ */
+inline std::optional<bool>
+__bitset_header_decode(bitset_header &header, const size_t word_size)
+{
+	if (std::memcmp(header.magic, "NCRB", 4) != 0 || header.version != bitset_format_version)
+		return {};
+	if (header.word_size != word_size || header.byte_order > 1)
+		return {};
+
+	const bool swap = header.byte_order != __bitset_native_byte_order();
+	if (swap)
+		header.nbits = bswap<u64>(header.nbits);
+	return swap;
+}
+
+
+/*
+ * __bitset_payload_size - number of bytes of the words that follow a header
+ *
+ * The header must be in native byte order. Returns nothing if the number of
+ * bits, words, or bytes does not fit into a size_t, which happens only for
+ * damaged or malicious headers.
+ */
+template <std::unsigned_integral W>
+inline std::optional<size_t>
+__bitset_payload_size(const bitset_header &header)
+{
+	const u64 bpw = sizeof(W) * CHAR_BIT;
+	const u64 word_count = header.nbits / bpw + (header.nbits % bpw != 0);
+	if (header.nbits > std::numeric_limits<size_t>::max()
+	    || word_count > std::numeric_limits<size_t>::max() / sizeof(W))
+		return {};
+	return static_cast<size_t>(word_count) * sizeof(W);
+}
+
+
+/*
+ * __bitset_stream_remaining - number of bytes left in a seekable stream
+ *
+ * Returns nothing if the stream does not support seeking, in which case the
+ * position of the stream is not changed.
+ */
+inline std::optional<size_t>
+__bitset_stream_remaining(std::istream &is)
+{
+	const auto pos = is.tellg();
+	if (pos < 0)
+		return {};
+	if (!is.seekg(0, std::ios::end)) {
+		is.clear();
+		is.seekg(pos);
+		return {};
+	}
+	const auto end = is.tellg();
+	is.seekg(pos);
+	if (end < pos)
+		return {};
+	return static_cast<size_t>(end - pos);
+}
+
+
+/*
+ * bitset_serialized_size - number of bytes of a serialized bitset
+ */
+template <typename StorageType, typename Derived>
+inline size_t
+bitset_serialized_size(const _bitset_base<StorageType, Derived> &bits)
+{
+	return sizeof(bitset_header) + bits.word_count() * sizeof(StorageType);
+}
+
+
+/*
+ * bitset_write - write a bitset to a binary stream
+ *
+ * The words of the bitset are written directly from the bitset's memory.
+ * Returns false if writing failed.
+ */
+template <typename StorageType, typename Derived>
+inline bool
+bitset_write(std::ostream &os, const _bitset_base<StorageType, Derived> &bits)
+{
+	const auto &b = static_cast<const Derived&>(bits);
+
+	bitset_header header{
+		.magic      = {'N', 'C', 'R', 'B'},
+		.version    = bitset_format_version,
+		.word_size  = static_cast<u8>(sizeof(StorageType)),
+		.byte_order = __bitset_native_byte_order(),
+		.reserved   = 0,
+		.nbits      = static_cast<u64>(b._Nbits)};
+	os.write(reinterpret_cast<const char*>(&header), sizeof(header));
+	if (b._word_count > 0)
+		os.write(reinterpret_cast<const char*>(b._bits), static_cast<std::streamsize>(b._word_count * sizeof(StorageType)));
+	return static_cast<bool>(os);
+}
+
+
+/*
+ * bitset_read_words - read the words of a bitset into pre-sized storage
+ *
+ * This reads a serialized bitset with exactly n_words words of type W into
+ * dst, and returns the number of bits, or nothing if the stream doesn't
+ * contain a matching bitset.
+ */
+template <std::unsigned_integral W>
+inline std::optional<size_t>
+bitset_read_words(std::istream &is, W *dst, const size_t n_words)
+{
+	bitset_header header;
+	if (!is.read(reinterpret_cast<char*>(&header), sizeof(header)))
+		return {};
+	auto swap = __bitset_header_decode(header, sizeof(W));
+	if (!swap)
+		return {};
+
+	auto n_bytes = __bitset_payload_size<W>(header);
+	if (!n_bytes || n_bytes.value() != n_words * sizeof(W))
+		return {};
+
+	if (n_words > 0 && !is.read(reinterpret_cast<char*>(dst), static_cast<std::streamsize>(n_bytes.value())))
+		return {};
+	if (swap.value())
+		for (size_t i = 0; i < n_words; i++)
+			dst[i] = __bitset_bswap(dst[i]);
+	return static_cast<size_t>(header.nbits);
+}
+
+
+/*
+ * bitset_read - read a fixed size bitset from a binary stream
+ *
+ * Returns false if the stream does not contain a bitset of the same size and
+ * storage type.
+ */
+template <size_t Nbits, typename StorageType>
+inline bool
+bitset_read(std::istream &is, bitset<Nbits, StorageType> &bits)
+{
+	auto nbits = bitset_read_words(is, bits._bits, bits._word_count);
+	return nbits && nbits.value() == Nbits;
+}
+
+
+/*
+ * bitset_read - read a dynamic bitset from a binary stream
+ *
+ * The bitset is resized to the size stored in the stream, and the words are
+ * read directly into the bitset's memory, i.e. no memory is allocated if the
+ * bitset already has the right size. Returns false if the stream does not
+ * contain a bitset of the same storage type. If the stream is seekable, the
+ * size in the header is checked against the remaining bytes before the bitset
+ * is resized, so that a damaged header cannot trigger a huge allocation.
+ */
+template <typename StorageType>
+inline bool
+bitset_read(std::istream &is, dynamic_bitset<StorageType> &bits)
+{
+	bitset_header header;
+	if (!is.read(reinterpret_cast<char*>(&header), sizeof(header)))
+		return false;
+	auto swap = __bitset_header_decode(header, sizeof(StorageType));
+	if (!swap)
+		return false;
+
+	auto n_bytes = __bitset_payload_size<StorageType>(header);
+	if (!n_bytes)
+		return false;
+	auto remaining = __bitset_stream_remaining(is);
+	if (remaining && remaining.value() < n_bytes.value())
+		return false;
+
+	bits.resize(static_cast<size_t>(header.nbits));
+	if (n_bytes.value() > 0 && !is.read(reinterpret_cast<char*>(bits._bits), static_cast<std::streamsize>(n_bytes.value())))
+		return false;
+	if (swap.value())
+		for (size_t i = 0; i < bits._word_count; i++)
+			bits._bits[i] = __bitset_bswap(bits._bits[i]);
+	return true;
+}
+
+
+/*
+ * struct bitset_view - read-only view onto the words of a serialized bitset
+ */
+template <std::unsigned_integral W>
+struct bitset_view {
+	size_t   nbits      = 0;
+	size_t   word_count = 0;
+	const W *words      = nullptr;
+
+	bool test(size_t i) const {
+		return (words[i / (sizeof(W) * CHAR_BIT)] >> (i % (sizeof(W) * CHAR_BIT))) & W(1);
+	}
+};
+
+
+/*
+ * bitset_map - access a serialized bitset within a memory region
+ *
+ * The region could be, for instance, a memory mapped file. If the bitset was
+ * written with the same byte order and the words are suitably aligned, the
+ * result points directly into the region. If the byte order differs and the
+ * region is writable, call bitset_map_inplace instead.
+ */
+template <std::unsigned_integral W>
+inline std::optional<bitset_view<W>>
+bitset_map(const void *data, const size_t size)
+{
+	if (size < sizeof(bitset_header))
+		return {};
+
+	bitset_header header;
+	std::memcpy(&header, data, sizeof(header));
+	auto swap = __bitset_header_decode(header, sizeof(W));
+	if (!swap || swap.value())
+		return {};
+
+	const char *words = static_cast<const char*>(data) + sizeof(bitset_header);
+	if (reinterpret_cast<std::uintptr_t>(words) % alignof(W) != 0)
+		return {};
+
+	auto n_bytes = __bitset_payload_size<W>(header);
+	if (!n_bytes || n_bytes.value() > size - sizeof(bitset_header))
+		return {};
+	return bitset_view<W>{
+		.nbits      = static_cast<size_t>(header.nbits),
+		.word_count = n_bytes.value() / sizeof(W),
+		.words      = reinterpret_cast<const W*>(words)};
+}
+
+
+/*
+ * bitset_map_inplace - access a serialized bitset within a writable region
+ *
+ * In contrast to bitset_map, this converts the bitset to native byte order in
+ * place if required, including the header. Hence, this is done only once even
+ * if the region is mapped several times.
+ */
+template <std::unsigned_integral W>
+inline std::optional<bitset_view<W>>
+bitset_map_inplace(void *data, const size_t size)
+{
+	if (size < sizeof(bitset_header))
+		return {};
+
+	bitset_header header;
+	std::memcpy(&header, data, sizeof(header));
+	auto swap = __bitset_header_decode(header, sizeof(W));
+	if (!swap)
+		return {};
+
+	if (swap.value()) {
+		auto n_bytes = __bitset_payload_size<W>(header);
+		if (!n_bytes || n_bytes.value() > size - sizeof(bitset_header))
+			return {};
+		const size_t word_count = n_bytes.value() / sizeof(W);
+
+		char *words = static_cast<char*>(data) + sizeof(bitset_header);
+		for (size_t i = 0; i < word_count; i++) {
+			W w;
+			std::memcpy(&w, words + i * sizeof(W), sizeof(W));
+			w = __bitset_bswap(w);
+			std::memcpy(words + i * sizeof(W), &w, sizeof(W));
+		}
+		header.byte_order = __bitset_native_byte_order();
+		std::memcpy(data, &header, sizeof(header));
+	}
+	return bitset_map<W>(data, size);
+}
+
+
 } // ncr::
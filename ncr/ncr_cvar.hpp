@@ -24,9 +24,13 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 #include <sstream>
 #include <vector>
 #include <optional>
+#include <memory>
+#include <functional>
+#include <unordered_map>
 
 #include <ncr/ncr_log.hpp>
 #include <ncr/ncr_utils.hpp>
@@ -922,78 +926,150 @@ NCR_CVAR_VECTOR_TYPE_LIST(VECTOR_SET_VALUE)
 
 
 /*
- * TODO: maybe rename to simply cvars_t
- * TODO: documentation
+ * cvar_is_basic_type - test if T is one of the non-vector cvar types
  */
-struct cvar_map
+template <typename T>
+inline constexpr bool cvar_is_basic_type = false;
+
+#define CVAR_IS_BASIC_TYPE(_0, CPP_TYPE, ...) \
+	template <> inline constexpr bool cvar_is_basic_type<CPP_TYPE> = true;
+NCR_CVAR_TYPE_LIST(CVAR_IS_BASIC_TYPE)
+#undef CVAR_IS_BASIC_TYPE
+
+
+/*
+ * cvar_handle - typed handle to the value of a cvar
+ *
+ * A handle is resolved once, e.g. via cvar_map::handle, and afterwards reads
+ * the value of the cvar with a single load, i.e. without looking up the name
+ * or checking the type again. Handles stay valid as long as the cvar_map that
+ * owns the cvar exists, and reflect any later changes to the value.
+ *
+ * Example:
+ *
+ *     auto mutation_rate = cvars.handle<double>("g_mutation_rate");
+ *     for (...)
+ *         x *= *mutation_rate;
+ */
+template <typename T>
+requires cvar_is_basic_type<T>
+struct cvar_handle
 {
-	size_t size;
-	size_t last_idx;
-	cvar **map;
-
-	cvar_map(size_t _size = 2048)
-	: size(_size)
-	, last_idx(0)
-	, map(new cvar*[size])
-	{
-		for (size_t i = 0; i < this->last_idx; i++) {
-			this->map[i] = nullptr;
-		}
-	}
+	cvar_handle() = default;
 
-	~cvar_map()
+	// returns an empty handle if cvar is nullptr or not of type T
+	explicit
+	cvar_handle(const cvar *cvar)
 	{
-		for (size_t i = 0; i < this->last_idx; i++) {
-			delete map[i];
+		if (cvar && cvar->type == cpp_to_cvt<T>::value) {
+			this->_cvar  = cvar;
+			this->_value = &cvar->value.get_value<const T&>();
 		}
-		delete[] map;
 	}
 
+	explicit operator bool() const { return this->_value != nullptr; }
+
+	const T& operator*()  const { return *this->_value; }
+	const T* operator->() const { return this->_value; }
+	const T& get()        const { return *this->_value; }
+
+	const cvar* get_cvar() const { return this->_cvar; }
+
+private:
+	const cvar *_cvar  = nullptr;
+	const T    *_value = nullptr;
+};
+
+
+/*
+ * __cvar_name_hash - transparent hash to look up names via std::string_view
+ */
+struct __cvar_name_hash
+{
+	using is_transparent = void;
+
+	size_t operator()(std::string_view name) const { return std::hash<std::string_view>{}(name); }
+};
+
+
+/*
+ * cvar_map - registry of all cvars of a program
+ *
+ * cvars are stored in the order in which they were registered, which is also
+ * the order in which they are written to files. Lookups by name go through a
+ * hash index and accept any std::string_view without allocating. Pointers to
+ * cvars, and thus also cvar_handles, remain valid until the map is destroyed.
+ *
+ * TODO: maybe rename to simply cvars_t
+ */
+struct cvar_map
+{
+	cvar_map() = default;
 	cvar_map(const cvar_map &) = delete;
+	cvar_map& operator=(const cvar_map &) = delete;
+
+	// number of registered cvars
+	size_t size() const { return this->_cvars.size(); }
 
 	inline cvar *
-	get(std::string name)
+	get(std::string_view name)
+	{
+		auto it = this->_index.find(name);
+		return it != this->_index.end() ? this->_cvars[it->second].get() : nullptr;
+	}
+
+	inline const cvar *
+	get(std::string_view name) const
 	{
-		// find the variable in the map and return a pointer to it
-		for (size_t i = 0; i < this->last_idx; i++)
-			if (this->map[i]->name == name)
-				return this->map[i];
-		return nullptr;
+		auto it = this->_index.find(name);
+		return it != this->_index.end() ? this->_cvars[it->second].get() : nullptr;
 	}
 
 	inline std::optional<cvar*>
-	get_safe(std::string name)
+	get_safe(std::string_view name)
 	{
 		cvar *cvar = this->get(name);
 		return (cvar != nullptr) ? std::optional(cvar) : std::nullopt;
 	}
 
+	/*
+	 * handle - resolve a typed handle to a cvar
+	 *
+	 * Returns an empty handle and logs an error if there is no such cvar or
+	 * it is not of type T.
+	 */
+	template <typename T>
+	inline cvar_handle<T>
+	handle(std::string_view name) const
+	{
+		const cvar *c = this->get(name);
+		cvar_handle<T> result(c);
+		if (!result)
+			log_error("Cannot resolve handle to cvar \"", name, "\".\n");
+		return result;
+	}
+
 	/*
 	 * register_cvar - register a cvar, given its default value
 	 */
 	template <typename T>
 	inline cvar*
-	register_cvar(std::string name, T default_value)
+	register_cvar(std::string_view name, T default_value)
 	{
-		for (size_t i = 0; i < this->last_idx; i++) {
-			if (this->map[i]->name == name) {
-				log_error("Duplicate cvar name \"", name, "\".\n");
-				return nullptr;
-			}
-		}
-		if (this->last_idx == this->size) {
-			log_error("Exceeding cvar_map of size ", this->size, ".\n");
+		if (this->_index.contains(name)) {
+			log_error("Duplicate cvar name \"", name, "\".\n");
 			return nullptr;
 		}
 
-		cvar *c = new cvar(name, cpp_to_cvt<T>::value);
+		auto c = std::make_unique<cvar>(std::string(name), cpp_to_cvt<T>::value);
 
 		// TODO: move into cvar
-		cvar_set_default(c, default_value);
-		cvar_set(c, default_value);
+		cvar_set_default(c.get(), default_value);
+		cvar_set(c.get(), default_value);
 
-		this->map[this->last_idx++] = c;
-		return c;
+		this->_index.emplace(c->name, this->_cvars.size());
+		this->_cvars.push_back(std::move(c));
+		return this->_cvars.back().get();
 	}
 
 	/*
@@ -1006,9 +1082,8 @@ struct cvar_map
 
 		std::ofstream cfg_file;
 		cfg_file.open(filename);
-		for (size_t i = 0; i < this->last_idx; i++) {
-			auto &cvar = this->map[i];
-			auto str = cvar_to_str(cvar);
+		for (const auto &cvar : this->_cvars) {
+			auto str = cvar_to_str(cvar.get());
 			if (cvar->type == cvar_type::CVT_STRING)
 				str = "\"" + str + "\"";
 			cfg_file << "set " << cvar->name << " " << str << ";\n";
@@ -1023,12 +1098,18 @@ struct cvar_map
 	{
 		// TODO: write an "apply" or "map" method for cvars instead of having
 		// this here and alos in write_to_file
-		for (size_t i = 0; i < this->last_idx; i++) {
-			auto &cvar = this->map[i];
+		for (const auto &cvar : this->_cvars)
 			cvar->write_hdf5_attribute(group);
-		}
 	}
 #endif
+
+private:
+	// cvars in order of registration. The cvars live on the heap so that
+	// pointers and handles to them survive growing the vector
+	std::vector<std::unique_ptr<cvar>> _cvars;
+
+	// name -> position in _cvars. The keys are the names of the cvars
+	std::unordered_map<std::string, size_t, __cvar_name_hash, std::equal_to<>> _index;
 };
 
 
@@ -1049,7 +1130,7 @@ write_cvars_to_file(const ncr::cvar_map &cvars, std::string filename)
  * This function returns a nullptr in case the cvar is not found by name.
  */
 inline cvar*
-cvar_map_get(cvar_map &map, std::string name)
+cvar_map_get(cvar_map &map, std::string_view name)
 {
 	return map.get(name);
 }
@@ -1062,7 +1143,7 @@ cvar_map_get(cvar_map &map, std::string name)
  * nullopt.
  */
 inline std::optional<cvar*>
-cvar_map_get_safe(cvar_map &map, std::string name)
+cvar_map_get_safe(cvar_map &map, std::string_view name)
 {
 	return map.get_safe(name);
 
@@ -1071,7 +1152,7 @@ cvar_map_get_safe(cvar_map &map, std::string name)
 
 template <typename T>
 inline cvar*
-cvar_map_register(cvar_map &map, std::string name, T default_value)
+cvar_map_register(cvar_map &map, std::string_view name, T default_value)
 {
 	return map.register_cvar<T>(name, default_value);
 }
@@ -5,14 +5,935 @@
  * SPDX-License-Identifier: MIT
  * See LICENSE file for more details.
  *
+ * The first part of this file contains a small ray caster over triangles,
+ * accelerated by a bounding volume hierarchy (bvh). Walls and boxes are
+ * turned into triangles when they are added to a scene. The bvh is stored in
+ * flat arrays, built once, and can be refit when primitives move without
+ * changing the topology of the scene. Example:
+ *
+ *     std::vector<ncr::triangle> tris;
+ *     for (size_t i = 0; i < walls.size(); i++)
+ *         ncr::add_wall(tris, walls[i].x0, walls[i].x1, 0.5f, i);
+ *     ncr::bvh tree;
+ *     ncr::bvh_build(tree, tris);
+ *
+ *     ncr::ray_hit hit;
+ *     if (ncr::bvh_closest_hit(tree, ncr::ray{origin, dir}, hit))
+ *         distance = hit.t; // hit.id is the index of the wall
  */
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
+#include <cmath>
+#include <limits>
+#include <algorithm>
+#include <vector>
+#include <span>
+
 #include <ncr/ncr_log.hpp>
 #include <ncr/ncr_math.hpp>
+#include <ncr/ncr_utils.hpp>
 
 namespace ncr {
 
+
+/*
+ * basic arithmetic on Vec3f
+ */
+constexpr inline Vec3f operator+(Vec3f a, Vec3f b) { return {a.x + b.x, a.y + b.y, a.z + b.z}; }
+constexpr inline Vec3f operator-(Vec3f a, Vec3f b) { return {a.x - b.x, a.y - b.y, a.z - b.z}; }
+constexpr inline Vec3f operator*(float s, Vec3f a) { return {s * a.x, s * a.y, s * a.z}; }
+constexpr inline float dot(Vec3f a, Vec3f b)       { return a.x * b.x + a.y * b.y + a.z * b.z; }
+constexpr inline Vec3f cross(Vec3f a, Vec3f b)     { return {a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x}; }
+constexpr inline Vec3f vmin(Vec3f a, Vec3f b)      { return {std::min(a.x, b.x), std::min(a.y, b.y), std::min(a.z, b.z)}; }
+constexpr inline Vec3f vmax(Vec3f a, Vec3f b)      { return {std::max(a.x, b.x), std::max(a.y, b.y), std::max(a.z, b.z)}; }
+constexpr inline float component(Vec3f a, unsigned axis) { return axis == 0 ? a.x : (axis == 1 ? a.y : a.z); }
+
+
+/*
+ * ray - a ray that can be cast into a scene
+ *
+ * Only hits with distance in (tmin, tmax) are reported. Distances are in
+ * multiples of dir, i.e. in world units if dir is normalized.
+ */
+struct ray {
+	Vec3f origin;
+	Vec3f dir;
+	float tmin = 0.0f;
+	float tmax = std::numeric_limits<float>::infinity();
+};
+
+
+/*
+ * ray_hit - closest intersection of a ray with a scene
+ *
+ * prim is the index of the triangle in the array that the bvh was built
+ * from, id the user defined id of the triangle (e.g. the index of a wall), and
+ * u, v are the barycentric coordinates of the hit within the triangle.
+ */
+struct ray_hit {
+	float         t = std::numeric_limits<float>::infinity();
+	std::uint32_t prim = ~std::uint32_t(0);
+	std::uint32_t id = ~std::uint32_t(0);
+	float         u = 0.0f, v = 0.0f;
+
+	Vec3f point(const ray &r) const { return r.origin + t * r.dir; }
+};
+
+
+/*
+ * aabb - axis aligned bounding box
+ */
+struct aabb {
+	Vec3f lo = { std::numeric_limits<float>::infinity(),  std::numeric_limits<float>::infinity(),  std::numeric_limits<float>::infinity()};
+	Vec3f hi = {-std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity()};
+
+	void grow(Vec3f p)       { this->lo = vmin(this->lo, p); this->hi = vmax(this->hi, p); }
+	void grow(const aabb &b) { this->lo = vmin(this->lo, b.lo); this->hi = vmax(this->hi, b.hi); }
+	bool empty() const       { return this->lo.x > this->hi.x; }
+
+	float
+	area() const
+	{
+		if (this->empty())
+			return 0.0f;
+		const Vec3f e = this->hi - this->lo;
+		return 2.0f * (e.x * e.y + e.y * e.z + e.z * e.x);
+	}
+};
+
+
+/*
+ * triangle - triangle with a user defined id
+ */
+struct triangle {
+	Vec3f         a, b, c;
+	std::uint32_t id = 0;
+
+	aabb
+	bounds() const
+	{
+		aabb box;
+		box.grow(this->a);
+		box.grow(this->b);
+		box.grow(this->c);
+		return box;
+	}
+
+	Vec3f centroid() const { return (1.0f / 3.0f) * (this->a + this->b + this->c); }
+};
+
+
+/*
+ * add_wall - add a vertical wall from x0 to x1 with a certain height
+ *
+ * The wall stands on the plane z = x0.z and is made of two triangles.
+ */
+inline
+void
+add_wall(std::vector<triangle> &tris, Vec3f x0, Vec3f x1, float height, std::uint32_t id)
+{
+	const Vec3f up = {0.0f, 0.0f, height};
+	x1.z = x0.z;
+	tris.push_back({x0, x1, x1 + up, id});
+	tris.push_back({x0, x1 + up, x0 + up, id});
+}
+
+
+/*
+ * add_box - add the four walls of an axis aligned box from x0 to x1
+ */
+inline
+void
+add_box(std::vector<triangle> &tris, Vec3f x0, Vec3f x1, float height, std::uint32_t id)
+{
+	add_wall(tris, {x0.x, x1.y, x0.z}, {x1.x, x1.y, x0.z}, height, id);
+	add_wall(tris, {x1.x, x1.y, x0.z}, {x1.x, x0.y, x0.z}, height, id);
+	add_wall(tris, {x1.x, x0.y, x0.z}, {x0.x, x0.y, x0.z}, height, id);
+	add_wall(tris, {x0.x, x0.y, x0.z}, {x0.x, x1.y, x0.z}, height, id);
+}
+
+
+/*
+ * intersect - Möller-Trumbore intersection of a ray and a triangle
+ *
+ * Ignores the orientation of the triangle. Returns true if the triangle is
+ * hit within (r.tmin, tmax), in which case t, u, v contain the distance and
+ * the barycentric coordinates of the hit.
+ */
+inline
+bool
+intersect(const ray &r, const triangle &tri, float tmax, float &t, float &u, float &v)
+{
+	const Vec3f e1 = tri.b - tri.a;
+	const Vec3f e2 = tri.c - tri.a;
+	const Vec3f P = cross(r.dir, e2);
+	const float det = dot(e1, P);
+	// ray parallel to the triangle
+	if (det == 0.0f)
+		return false;
+	const float inv_det = 1.0f / det;
+
+	const Vec3f T = r.origin - tri.a;
+	u = dot(T, P) * inv_det;
+	if (u < 0.0f || u > 1.0f)
+		return false;
+
+	const Vec3f Q = cross(T, e1);
+	v = dot(r.dir, Q) * inv_det;
+	if (v < 0.0f || u + v > 1.0f)
+		return false;
+
+	t = dot(e2, Q) * inv_det;
+	return t > r.tmin && t < tmax;
+}
+
+
+/*
+ * bvh_node - node of a bvh
+ *
+ * Leaves have count > 0 and contain the primitives [first, first + count).
+ * Inner nodes have count == 0, and their children are first and first + 1.
+ */
+struct bvh_node {
+	aabb          bounds;
+	std::uint32_t first = 0;
+	std::uint32_t count = 0;
+
+	bool is_leaf() const { return this->count > 0; }
+};
+
+
+/*
+ * bvh - bounding volume hierarchy over triangles
+ *
+ * The triangles are stored in the order of the leaves, prims maps them back
+ * to their index in the array the bvh was built from. Nodes are stored such
+ * that children always come after their parent.
+ */
+struct bvh {
+	std::vector<bvh_node>      nodes;
+	std::vector<triangle>      tris;
+	std::vector<std::uint32_t> prims;
+
+	// maximum number of triangles per leaf
+	unsigned                   max_leaf_size = 4;
+
+	size_t size() const { return this->tris.size(); }
+};
+
+
+/*
+ * __bvh_split - find the best split of a node with a binned surface area
+ * heuristic. Returns false if not splitting is cheaper
+ */
+inline
+bool
+__bvh_split(const bvh &tree, const std::vector<Vec3f> &centroids, const bvh_node &node, unsigned &axis, float &pos)
+{
+	constexpr unsigned n_bins = 12;
+
+	aabb cbox;
+	for (std::uint32_t i = node.first; i < node.first + node.count; i++)
+		cbox.grow(centroids[i]);
+
+	float best_cost = std::numeric_limits<float>::infinity();
+	for (unsigned a = 0; a < 3; a++) {
+		const float lo = component(cbox.lo, a);
+		const float hi = component(cbox.hi, a);
+		if (!(hi > lo))
+			continue;
+
+		aabb     bins[n_bins];
+		unsigned counts[n_bins] = {};
+		const float scale = n_bins / (hi - lo);
+		for (std::uint32_t i = node.first; i < node.first + node.count; i++) {
+			const unsigned b = std::min(n_bins - 1, unsigned((component(centroids[i], a) - lo) * scale));
+			bins[b].grow(tree.tris[i].bounds());
+			counts[b] += 1;
+		}
+
+		// sweep from the right to get the cost of all right sides
+		float    right_area[n_bins];
+		unsigned right_count[n_bins];
+		aabb box;
+		unsigned count = 0;
+		for (unsigned b = n_bins - 1; b > 0; b--) {
+			box.grow(bins[b]);
+			count += counts[b];
+			right_area[b] = box.area();
+			right_count[b] = count;
+		}
+
+		box = aabb();
+		count = 0;
+		for (unsigned b = 0; b < n_bins - 1; b++) {
+			box.grow(bins[b]);
+			count += counts[b];
+			const float cost = count * box.area() + right_count[b + 1] * right_area[b + 1];
+			if (count && right_count[b + 1] && cost < best_cost) {
+				best_cost = cost;
+				axis = a;
+				pos = lo + (b + 1) / scale;
+			}
+		}
+	}
+	return best_cost < node.count * node.bounds.area();
+}
+
+
+/*
+ * bvh_refit - recompute the bounds of all nodes
+ *
+ * If tris is not empty, it must contain the triangles in the order of the
+ * array the bvh was built from, and they replace the triangles of the bvh.
+ * This is meant for scenes where primitives move, but are neither added nor
+ * removed. Note that the quality of the bvh degrades if primitives move far.
+ */
+inline
+bool
+bvh_refit(bvh &tree, std::span<const triangle> tris = {})
+{
+	if (!tris.empty()) {
+		if (tris.size() != tree.tris.size()) {
+			log_error("bvh_refit: expected ", tree.tris.size(), " triangles, got ", tris.size(), "\n");
+			return false;
+		}
+		for (size_t i = 0; i < tree.tris.size(); i++)
+			tree.tris[i] = tris[tree.prims[i]];
+	}
+
+	// children come after their parents
+	for (size_t k = tree.nodes.size(); k-- > 0; ) {
+		bvh_node &node = tree.nodes[k];
+		node.bounds = aabb();
+		if (node.is_leaf())
+			for (std::uint32_t i = node.first; i < node.first + node.count; i++)
+				node.bounds.grow(tree.tris[i].bounds());
+		else {
+			node.bounds.grow(tree.nodes[node.first].bounds);
+			node.bounds.grow(tree.nodes[node.first + 1].bounds);
+		}
+	}
+	return true;
+}
+
+
+/*
+ * bvh_build - build a bvh over triangles
+ */
+inline
+bool
+bvh_build(bvh &tree, std::span<const triangle> tris)
+{
+	tree.nodes.clear();
+	tree.tris.assign(tris.begin(), tris.end());
+	tree.prims.resize(tris.size());
+	if (tris.size() >= std::numeric_limits<std::uint32_t>::max()) {
+		log_error("bvh_build: too many triangles\n");
+		return false;
+	}
+	if (tris.empty())
+		return true;
+
+	std::vector<Vec3f> centroids(tris.size());
+	for (size_t i = 0; i < tris.size(); i++) {
+		tree.prims[i] = std::uint32_t(i);
+		centroids[i] = tris[i].centroid();
+	}
+
+	tree.nodes.reserve(2 * tris.size() / std::max(1u, tree.max_leaf_size) + 1);
+	tree.nodes.push_back({aabb(), 0, std::uint32_t(tris.size())});
+
+	// split nodes top-down. Each split appends the two children
+	std::vector<std::uint32_t> stack{0};
+	while (!stack.empty()) {
+		const std::uint32_t k = stack.back();
+		stack.pop_back();
+
+		bvh_node node = tree.nodes[k];
+		node.bounds = aabb();
+		for (std::uint32_t i = node.first; i < node.first + node.count; i++)
+			node.bounds.grow(tree.tris[i].bounds());
+		tree.nodes[k].bounds = node.bounds;
+		if (node.count <= tree.max_leaf_size)
+			continue;
+
+		unsigned axis = 0;
+		float pos = 0.0f;
+		if (!__bvh_split(tree, centroids, node, axis, pos))
+			continue;
+
+		// partition the triangles of the node
+		std::uint32_t i = node.first;
+		std::uint32_t j = node.first + node.count;
+		while (i < j) {
+			if (component(centroids[i], axis) < pos)
+				i++;
+			else {
+				j--;
+				std::swap(centroids[i], centroids[j]);
+				std::swap(tree.tris[i], tree.tris[j]);
+				std::swap(tree.prims[i], tree.prims[j]);
+			}
+		}
+		const std::uint32_t n_left = i - node.first;
+		if (n_left == 0 || n_left == node.count)
+			continue;
+
+		const std::uint32_t left = std::uint32_t(tree.nodes.size());
+		tree.nodes.push_back({aabb(), node.first, n_left});
+		tree.nodes.push_back({aabb(), i, node.count - n_left});
+		tree.nodes[k].first = left;
+		tree.nodes[k].count = 0;
+		stack.push_back(left + 1);
+		stack.push_back(left);
+	}
+	return true;
+}
+
+
+/*
+ * __bvh_slab - intersect a ray with a box. Returns the entry distance or
+ * infinity if the box is missed within (tmin, tmax)
+ */
+inline
+float
+__bvh_slab(const aabb &box, Vec3f origin, Vec3f inv_dir, float tmin, float tmax)
+{
+	const float tx0 = (box.lo.x - origin.x) * inv_dir.x, tx1 = (box.hi.x - origin.x) * inv_dir.x;
+	const float ty0 = (box.lo.y - origin.y) * inv_dir.y, ty1 = (box.hi.y - origin.y) * inv_dir.y;
+	const float tz0 = (box.lo.z - origin.z) * inv_dir.z, tz1 = (box.hi.z - origin.z) * inv_dir.z;
+	// fmin/fmax drop NaNs, which appear as 0 * inf for rays that lie in the
+	// plane of a slab. Such slabs then don't restrict the interval
+	const float t0 = std::fmax(std::fmax(tmin, std::fmin(tx0, tx1)), std::fmax(std::fmin(ty0, ty1), std::fmin(tz0, tz1)));
+	const float t1 = std::fmin(std::fmin(tmax, std::fmax(tx0, tx1)), std::fmin(std::fmax(ty0, ty1), std::fmax(tz0, tz1)));
+	return t0 <= t1 ? t0 : std::numeric_limits<float>::infinity();
+}
+
+
+/*
+ * __bvh_stack - traversal stack of node indices
+ *
+ * The bvh of n triangles is at most n deep, but binned splits keep it far
+ * below 64 for all practical scenes. The stack only allocates if needed.
+ */
+struct __bvh_stack {
+	constexpr static size_t local_size = 64;
+
+	std::uint32_t              local[local_size];
+	std::vector<std::uint32_t> heap;
+	size_t                     sp = 0;
+
+	bool empty() const { return this->sp == 0; }
+
+	void
+	push(std::uint32_t k)
+	{
+		if (this->sp < local_size) this->local[this->sp] = k;
+		else this->heap.push_back(k);
+		this->sp++;
+	}
+
+	std::uint32_t
+	pop()
+	{
+		this->sp--;
+		if (this->sp < local_size)
+			return this->local[this->sp];
+		const std::uint32_t k = this->heap.back();
+		this->heap.pop_back();
+		return k;
+	}
+};
+
+
+/*
+ * __bvh_traverse - traverse a bvh front to back
+ *
+ * Calls leaf_fn(node, tmax) for all leaves that the ray hits before tmax.
+ * leaf_fn returns the new tmax, and traversal stops when leaf_fn returns a
+ * negative value.
+ */
+template <typename LeafFn>
+inline
+void
+__bvh_traverse(const bvh &tree, const ray &r, LeafFn &&leaf_fn)
+{
+	if (tree.nodes.empty())
+		return;
+
+	const Vec3f inv_dir = {1.0f / r.dir.x, 1.0f / r.dir.y, 1.0f / r.dir.z};
+	float tmax = r.tmax;
+	if (__bvh_slab(tree.nodes[0].bounds, r.origin, inv_dir, r.tmin, tmax) == std::numeric_limits<float>::infinity())
+		return;
+
+	__bvh_stack stack;
+	std::uint32_t k = 0;
+	while (true) {
+		const bvh_node &node = tree.nodes[k];
+		if (node.is_leaf()) {
+			tmax = leaf_fn(node, tmax);
+			if (tmax < 0.0f)
+				return;
+		}
+		else {
+			// visit the closer child first
+			std::uint32_t c0 = node.first, c1 = node.first + 1;
+			float t0 = __bvh_slab(tree.nodes[c0].bounds, r.origin, inv_dir, r.tmin, tmax);
+			float t1 = __bvh_slab(tree.nodes[c1].bounds, r.origin, inv_dir, r.tmin, tmax);
+			if (t1 < t0) {
+				std::swap(t0, t1);
+				std::swap(c0, c1);
+			}
+			if (t0 != std::numeric_limits<float>::infinity()) {
+				if (t1 != std::numeric_limits<float>::infinity())
+					stack.push(c1);
+				k = c0;
+				continue;
+			}
+		}
+
+		// next node on the stack that is still in front of the closest hit
+		while (true) {
+			if (stack.empty())
+				return;
+			k = stack.pop();
+			if (__bvh_slab(tree.nodes[k].bounds, r.origin, inv_dir, r.tmin, tmax) != std::numeric_limits<float>::infinity())
+				break;
+		}
+	}
+}
+
+
+/*
+ * bvh_closest_hit - find the closest intersection of a ray with the scene
+ */
+inline
+bool
+bvh_closest_hit(const bvh &tree, const ray &r, ray_hit &hit)
+{
+	hit = ray_hit();
+	__bvh_traverse(tree, r, [&](const bvh_node &leaf, float tmax) {
+		for (std::uint32_t i = leaf.first; i < leaf.first + leaf.count; i++) {
+			float t, u, v;
+			if (intersect(r, tree.tris[i], tmax, t, u, v)) {
+				tmax  = t;
+				hit.t = t;
+				hit.u = u;
+				hit.v = v;
+				hit.prim = tree.prims[i];
+				hit.id = tree.tris[i].id;
+			}
+		}
+		return tmax;
+	});
+	return hit.prim != ~std::uint32_t(0);
+}
+
+
+/*
+ * bvh_any_hit - test if a ray hits anything within (r.tmin, r.tmax)
+ *
+ * This is cheaper than bvh_closest_hit, because traversal stops at the first
+ * hit, e.g. for occlusion tests.
+ */
+inline
+bool
+bvh_any_hit(const bvh &tree, const ray &r)
+{
+	bool any = false;
+	__bvh_traverse(tree, r, [&](const bvh_node &leaf, float tmax) {
+		for (std::uint32_t i = leaf.first; i < leaf.first + leaf.count; i++) {
+			float t, u, v;
+			if (intersect(r, tree.tris[i], tmax, t, u, v)) {
+				any = true;
+				return -1.0f;
+			}
+		}
+		return tmax;
+	});
+	return any;
+}
+
+
+
+/*
+ * ray_packet - rays in structure of arrays form
+ *
+ * Packets are processed in blocks of ray_packet_width consecutive rays, each
+ * ray in one SIMD lane. The loops over lanes are branch free and meant to be
+ * vectorized by the compiler (with optimization and e.g. -march=native).
+ * Traversal of a bvh works best if the rays of a block are coherent, e.g.
+ * neighboring rays of a sensor sweep.
+ */
+constexpr size_t ray_packet_width = 16;
+
+struct ray_packet {
+	std::vector<float> ox, oy, oz;
+	std::vector<float> dx, dy, dz;
+
+	// only hits with distance in (tmin, tmax) are reported
+	float tmin = 0.0f;
+	float tmax = std::numeric_limits<float>::infinity();
+
+	size_t size() const { return this->ox.size(); }
+
+	void
+	resize(size_t n)
+	{
+		for (auto *v: {&this->ox, &this->oy, &this->oz, &this->dx, &this->dy, &this->dz})
+			v->resize(n);
+	}
+
+	void
+	set(size_t i, Vec3f origin, Vec3f dir)
+	{
+		this->ox[i] = origin.x; this->oy[i] = origin.y; this->oz[i] = origin.z;
+		this->dx[i] = dir.x;    this->dy[i] = dir.y;    this->dz[i] = dir.z;
+	}
+
+	ray
+	get(size_t i) const
+	{
+		return {{this->ox[i], this->oy[i], this->oz[i]}, {this->dx[i], this->dy[i], this->dz[i]}, this->tmin, this->tmax};
+	}
+};
+
+
+/*
+ * ray_packet_fan - packet of n rays in the xy-plane, e.g. for a range sensor
+ *
+ * The rays start at origin and are spread evenly over fov radians, centered
+ * around heading. A fov of 2 pi gives a full sweep, in which the first ray
+ * points towards heading.
+ */
+inline
+ray_packet
+ray_packet_fan(Vec3f origin, float heading, float fov, size_t n, float tmax = std::numeric_limits<float>::infinity())
+{
+	ray_packet packet;
+	packet.resize(n);
+	packet.tmax = tmax;
+	const bool full = fov >= 2.0f * float(M_PI);
+	const float step = n > 1 ? fov / float(full ? n : n - 1) : 0.0f;
+	const float start = n > 1 && !full ? heading - 0.5f * fov : heading;
+	for (size_t i = 0; i < n; i++) {
+		const float a = start + float(i) * step;
+		packet.set(i, origin, {std::cos(a), std::sin(a), 0.0f});
+	}
+	return packet;
+}
+
+
+/*
+ * ray_packet_hits - per ray results of a packet query
+ *
+ * Rays that hit nothing have t = infinity and prim = id = ~0.
+ */
+struct ray_packet_hits {
+	std::vector<float>         t;
+	std::vector<std::uint32_t> prim;
+	std::vector<std::uint32_t> id;
+
+	size_t size() const { return this->t.size(); }
+
+	void
+	reset(size_t n)
+	{
+		this->t.assign(n, std::numeric_limits<float>::infinity());
+		this->prim.assign(n, ~std::uint32_t(0));
+		this->id.assign(n, ~std::uint32_t(0));
+	}
+};
+
+
+/*
+ * __packet_block - one block of a packet, loaded into lane arrays
+ *
+ * Unused lanes have t = -infinity, so that they never hit anything. The
+ * inverse directions avoid infinities, so that slab tests never produce NaNs.
+ */
+struct __packet_block {
+	constexpr static size_t W = ray_packet_width;
+
+	float ox[W], oy[W], oz[W];
+	float dx[W], dy[W], dz[W];
+	float ix[W], iy[W], iz[W];
+	float t[W];
+	std::uint32_t prim[W];
+	float tmin;
+	size_t begin, count;
+
+	void
+	load(const ray_packet &packet, size_t _begin)
+	{
+		this->begin = _begin;
+		this->count = std::min(W, packet.size() - _begin);
+		this->tmin  = packet.tmin;
+		for (size_t i = 0; i < W; i++) {
+			const bool used = i < this->count;
+			const size_t j = used ? _begin + i : _begin;
+			this->ox[i] = packet.ox[j]; this->oy[i] = packet.oy[j]; this->oz[i] = packet.oz[j];
+			this->dx[i] = packet.dx[j]; this->dy[i] = packet.dy[j]; this->dz[i] = packet.dz[j];
+			this->ix[i] = 1.0f / (this->dx[i] == 0.0f ? 1e-30f : this->dx[i]);
+			this->iy[i] = 1.0f / (this->dy[i] == 0.0f ? 1e-30f : this->dy[i]);
+			this->iz[i] = 1.0f / (this->dz[i] == 0.0f ? 1e-30f : this->dz[i]);
+			this->t[i]    = used ? packet.tmax : -std::numeric_limits<float>::infinity();
+			this->prim[i] = ~std::uint32_t(0);
+		}
+	}
+};
+
+
+// min and max which compile to SIMD instructions
+constexpr inline float __lane_min(float a, float b) { return a < b ? a : b; }
+constexpr inline float __lane_max(float a, float b) { return a > b ? a : b; }
+
+
+/*
+ * __packet_slab - intersect all lanes of a block with a box
+ *
+ * Returns the smallest entry distance of all lanes that hit the box, or
+ * infinity if no lane hits it.
+ */
+inline
+float
+__packet_slab(const __packet_block &pb, const aabb &box)
+{
+	constexpr float inf = std::numeric_limits<float>::infinity();
+	float emin = inf;
+	NCR_IVDEP
+	for (size_t i = 0; i < __packet_block::W; i++) {
+		const float tx0 = (box.lo.x - pb.ox[i]) * pb.ix[i], tx1 = (box.hi.x - pb.ox[i]) * pb.ix[i];
+		const float ty0 = (box.lo.y - pb.oy[i]) * pb.iy[i], ty1 = (box.hi.y - pb.oy[i]) * pb.iy[i];
+		const float tz0 = (box.lo.z - pb.oz[i]) * pb.iz[i], tz1 = (box.hi.z - pb.oz[i]) * pb.iz[i];
+		const float t0 = __lane_max(__lane_max(pb.tmin, __lane_min(tx0, tx1)), __lane_max(__lane_min(ty0, ty1), __lane_min(tz0, tz1)));
+		const float t1 = __lane_min(__lane_min(pb.t[i], __lane_max(tx0, tx1)), __lane_min(__lane_max(ty0, ty1), __lane_max(tz0, tz1)));
+		emin = __lane_min(emin, t0 <= t1 ? t0 : inf);
+	}
+	return emin;
+}
+
+
+/*
+ * __packet_triangle - intersect all lanes of a block with a triangle
+ *
+ * Lanes that hit the triangle before their current t get the new distance
+ * and prim. Returns true if any lane was hit.
+ */
+inline
+bool
+__packet_triangle(__packet_block &pb, const triangle &tri, std::uint32_t prim)
+{
+	const Vec3f e1 = tri.b - tri.a;
+	const Vec3f e2 = tri.c - tri.a;
+	unsigned any = 0;
+	NCR_IVDEP
+	for (size_t i = 0; i < __packet_block::W; i++) {
+		// Möller-Trumbore, see intersect
+		const float px = pb.dy[i] * e2.z - pb.dz[i] * e2.y;
+		const float py = pb.dz[i] * e2.x - pb.dx[i] * e2.z;
+		const float pz = pb.dx[i] * e2.y - pb.dy[i] * e2.x;
+		const float det = e1.x * px + e1.y * py + e1.z * pz;
+		const float inv_det = 1.0f / (det == 0.0f ? 1e-30f : det);
+
+		const float tx = pb.ox[i] - tri.a.x, ty = pb.oy[i] - tri.a.y, tz = pb.oz[i] - tri.a.z;
+		const float u = (tx * px + ty * py + tz * pz) * inv_det;
+		const float qx = ty * e1.z - tz * e1.y;
+		const float qy = tz * e1.x - tx * e1.z;
+		const float qz = tx * e1.y - ty * e1.x;
+		const float v = (pb.dx[i] * qx + pb.dy[i] * qy + pb.dz[i] * qz) * inv_det;
+		const float t = (e2.x * qx + e2.y * qy + e2.z * qz) * inv_det;
+
+		const bool hit = (det != 0.0f) & (u >= 0.0f) & (v >= 0.0f) & (u + v <= 1.0f) & (t > pb.tmin) & (t < pb.t[i]);
+		pb.t[i]    = hit ? t : pb.t[i];
+		pb.prim[i] = hit ? prim : pb.prim[i];
+		any |= hit;
+	}
+	return any;
+}
+
+
+/*
+ * __packet_traverse - traverse a bvh with a block of rays
+ *
+ * A node is visited if any lane hits its box, children in the order of their
+ * closest entry. With AnyHit, lanes are retired after their first hit, and
+ * traversal stops once all lanes are retired.
+ */
+template <bool AnyHit>
+inline
+void
+__packet_traverse(const bvh &tree, __packet_block &pb)
+{
+	constexpr float inf = std::numeric_limits<float>::infinity();
+	if (tree.nodes.empty() || __packet_slab(pb, tree.nodes[0].bounds) == inf)
+		return;
+
+	__bvh_stack stack;
+	std::uint32_t k = 0;
+	while (true) {
+		const bvh_node &node = tree.nodes[k];
+		if (node.is_leaf()) {
+			for (std::uint32_t i = node.first; i < node.first + node.count; i++) {
+				if (!__packet_triangle(pb, tree.tris[i], i) || !AnyHit)
+					continue;
+				// retire lanes that were hit
+				unsigned alive = 0;
+				for (size_t l = 0; l < __packet_block::W; l++) {
+					pb.t[l] = pb.prim[l] != ~std::uint32_t(0) ? -inf : pb.t[l];
+					alive |= pb.t[l] != -inf;
+				}
+				if (!alive)
+					return;
+			}
+		}
+		else {
+			std::uint32_t c0 = node.first, c1 = node.first + 1;
+			float t0 = __packet_slab(pb, tree.nodes[c0].bounds);
+			float t1 = __packet_slab(pb, tree.nodes[c1].bounds);
+			if (t1 < t0) {
+				std::swap(t0, t1);
+				std::swap(c0, c1);
+			}
+			if (t0 != inf) {
+				if (t1 != inf)
+					stack.push(c1);
+				k = c0;
+				continue;
+			}
+		}
+
+		// next node that is still hit by any lane
+		while (true) {
+			if (stack.empty())
+				return;
+			k = stack.pop();
+			if (__packet_slab(pb, tree.nodes[k].bounds) != inf)
+				break;
+		}
+	}
+}
+
+
+/*
+ * bvh_closest_hit - closest hits of all rays of a packet
+ */
+inline
+void
+bvh_closest_hit(const bvh &tree, const ray_packet &packet, ray_packet_hits &hits)
+{
+	hits.reset(packet.size());
+	__packet_block pb;
+	for (size_t b = 0; b < packet.size(); b += ray_packet_width) {
+		pb.load(packet, b);
+		__packet_traverse<false>(tree, pb);
+		for (size_t i = 0; i < pb.count; i++) {
+			if (pb.prim[i] == ~std::uint32_t(0))
+				continue;
+			hits.t[b + i]    = pb.t[i];
+			hits.prim[b + i] = tree.prims[pb.prim[i]];
+			hits.id[b + i]   = tree.tris[pb.prim[i]].id;
+		}
+	}
+}
+
+
+/*
+ * bvh_any_hit - occlusion test of all rays of a packet
+ *
+ * occluded must have the size of the packet, and is set to 1 for all rays
+ * that hit anything within (tmin, tmax), and 0 otherwise.
+ */
+inline
+bool
+bvh_any_hit(const bvh &tree, const ray_packet &packet, std::span<std::uint8_t> occluded)
+{
+	if (occluded.size() != packet.size()) {
+		log_error("bvh_any_hit: expected ", packet.size(), " results, got ", occluded.size(), "\n");
+		return false;
+	}
+	__packet_block pb;
+	for (size_t b = 0; b < packet.size(); b += ray_packet_width) {
+		pb.load(packet, b);
+		__packet_traverse<true>(tree, pb);
+		for (size_t i = 0; i < pb.count; i++)
+			occluded[b + i] = pb.prim[i] != ~std::uint32_t(0);
+	}
+	return true;
+}
+
+
+/*
+ * intersect - closest hits of a packet with a set of triangles, without bvh
+ *
+ * This is meant for small scenes, for which a bvh doesn't pay off. The prim
+ * of a hit is the index into tris.
+ */
+inline
+void
+intersect(const ray_packet &packet, std::span<const triangle> tris, ray_packet_hits &hits)
+{
+	hits.reset(packet.size());
+	__packet_block pb;
+	for (size_t b = 0; b < packet.size(); b += ray_packet_width) {
+		pb.load(packet, b);
+		for (size_t k = 0; k < tris.size(); k++)
+			__packet_triangle(pb, tris[k], std::uint32_t(k));
+		for (size_t i = 0; i < pb.count; i++) {
+			if (pb.prim[i] == ~std::uint32_t(0))
+				continue;
+			hits.t[b + i]    = pb.t[i];
+			hits.prim[b + i] = pb.prim[i];
+			hits.id[b + i]   = tris[pb.prim[i]].id;
+		}
+	}
+}
+
+
+/*
+ * intersect - closest hits of a packet with a set of boxes
+ *
+ * Rays that start within a box hit it where they leave it. The prim and id
+ * of a hit are the index into boxes.
+ */
+inline
+void
+intersect(const ray_packet &packet, std::span<const aabb> boxes, ray_packet_hits &hits)
+{
+	hits.reset(packet.size());
+	__packet_block pb;
+	for (size_t b = 0; b < packet.size(); b += ray_packet_width) {
+		pb.load(packet, b);
+		for (size_t k = 0; k < boxes.size(); k++) {
+			const aabb &box = boxes[k];
+			NCR_IVDEP
+			for (size_t i = 0; i < __packet_block::W; i++) {
+				const float tx0 = (box.lo.x - pb.ox[i]) * pb.ix[i], tx1 = (box.hi.x - pb.ox[i]) * pb.ix[i];
+				const float ty0 = (box.lo.y - pb.oy[i]) * pb.iy[i], ty1 = (box.hi.y - pb.oy[i]) * pb.iy[i];
+				const float tz0 = (box.lo.z - pb.oz[i]) * pb.iz[i], tz1 = (box.hi.z - pb.oz[i]) * pb.iz[i];
+				const float t0 = __lane_max(__lane_min(tx0, tx1), __lane_max(__lane_min(ty0, ty1), __lane_min(tz0, tz1)));
+				const float t1 = __lane_min(__lane_max(tx0, tx1), __lane_min(__lane_max(ty0, ty1), __lane_max(tz0, tz1)));
+				const float t = t0 > pb.tmin ? t0 : t1;
+				const bool hit = (t0 <= t1) & (t > pb.tmin) & (t < pb.t[i]);
+				pb.t[i]    = hit ? t : pb.t[i];
+				pb.prim[i] = hit ? std::uint32_t(k) : pb.prim[i];
+			}
+		}
+		for (size_t i = 0; i < pb.count; i++) {
+			if (pb.prim[i] == ~std::uint32_t(0))
+				continue;
+			hits.t[b + i]    = pb.t[i];
+			hits.prim[b + i] = pb.prim[i];
+			hits.id[b + i]   = pb.prim[i];
+		}
+	}
+}
+
+
+
 #if 0
 
 /*
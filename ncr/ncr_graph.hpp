@@ -5,14 +5,709 @@
  * SPDX-License-Identifier: MIT
  * See LICENSE file for more details.
  *
+ * This file contains a compact, immutable graph in compressed sparse row (CSR)
+ * format together with a graph edit distance (GED). Graphs can be created from
+ * an explicit list of edges, from a finite_state_machine, or from the frozen
+ * connectivity of a transport.
+ *
+ * The GED is the minimal cost of vertex and edge substitutions, insertions and
+ * deletions that transform one graph into another. Computing it exactly is NP
+ * hard, and the A*-GED of Riesen et al. 2013 quickly runs out of memory as
+ * it keeps all open partial mappings. Here, the exact variant is a depth first
+ * branch and bound (DF-GED, Abu-Aisheh et al. 2015), which needs memory linear
+ * in the size of the graphs, and the approximate variant is a beam search
+ * which keeps only the best beam_width partial mappings per level. Both prune
+ * with the same admissible lower bound. See also notes/graph_edit_distance.
+ *
+ * Example:
+ *
+ *     std::vector<ncr::graph> graphs;
+ *     for (auto &fsm : population)
+ *         graphs.push_back(ncr::make_graph(fsm));
+ *     ncr::thread_pool pool;
+ *     auto D = ncr::ged_all_pairs(graphs, {}, &pool);
+ *     // D[i * graphs.size() + j] is the distance between graph i and j
  */
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <span>
+#include <optional>
+#include <algorithm>
+#include <limits>
+
+#include <ncr/ncr_log.hpp>
+#include <ncr/ncr_parallel.hpp>
+#include <ncr/ncr_automata.hpp>
+#include <ncr/ncr_transport2.hpp>
+
 namespace ncr {
 
-// Definitions of vertex and edge
 
-// A*
+/*
+ * graph_edge - labelled edge for graph construction
+ */
+struct graph_edge
+{
+	std::uint32_t from;
+	std::uint32_t to;
+	std::uint32_t label = 0;
+};
+
+
+/*
+ * graph - directed, vertex and edge labelled graph in CSR format
+ *
+ * The outgoing edges of vertex i are [row_offsets[i], row_offsets[i+1]), sorted
+ * by target and label. Multiple edges between the same pair of vertices are
+ * allowed, e.g. for transitions of an automaton which read different symbols.
+ * The transpose (incoming edges) is stored as well, such that both directions
+ * can be iterated without any search.
+ */
+struct graph
+{
+	std::vector<std::uint32_t> vertex_labels;
+
+	// outgoing edges
+	std::vector<size_t>        row_offsets;
+	std::vector<std::uint32_t> targets;
+	std::vector<std::uint32_t> edge_labels;
+
+	// incoming edges, sources sorted ascending per vertex
+	std::vector<size_t>        col_offsets;
+	std::vector<std::uint32_t> sources;
+};
+
+
+inline size_t
+graph_num_vertices(const graph &g)
+{
+	return g.vertex_labels.size();
+}
+
+
+inline size_t
+graph_num_edges(const graph &g)
+{
+	return g.targets.size();
+}
+
+
+/*
+ * graph_edge_labels - labels of all edges from u to v, sorted ascending
+ */
+inline std::span<const std::uint32_t>
+graph_edge_labels(const graph &g, size_t u, size_t v)
+{
+	const auto first = g.targets.begin() + g.row_offsets[u];
+	const auto last  = g.targets.begin() + g.row_offsets[u + 1];
+	const auto range = std::equal_range(first, last, std::uint32_t(v));
+	return std::span<const std::uint32_t>(
+			g.edge_labels.data() + (range.first  - g.targets.begin()),
+			size_t(range.second - range.first));
+}
+
+
+/*
+ * make_graph - create a graph from a list of edges
+ *
+ * vertex_labels is either empty, in which case all vertices have label 0, or
+ * has n_vertices entries. Edges with an out of range vertex are dropped with an
+ * error message.
+ */
+inline graph
+make_graph(
+		size_t n_vertices,
+		std::span<const graph_edge> edges,
+		std::span<const std::uint32_t> vertex_labels = {})
+{
+	graph g;
+	if (vertex_labels.size() == n_vertices)
+		g.vertex_labels.assign(vertex_labels.begin(), vertex_labels.end());
+	else {
+		if (!vertex_labels.empty())
+			log_error("Number of vertex labels does not match number of vertices in make_graph.\n");
+		g.vertex_labels.assign(n_vertices, 0);
+	}
+
+	std::vector<graph_edge> sorted;
+	sorted.reserve(edges.size());
+	for (const auto &e : edges) {
+		if (e.from >= n_vertices || e.to >= n_vertices) {
+			log_error("Edge (", e.from, ", ", e.to, ") out of range in make_graph.\n");
+			continue;
+		}
+		sorted.push_back(e);
+	}
+	std::sort(sorted.begin(), sorted.end(), [](const graph_edge &a, const graph_edge &b) {
+		if (a.from != b.from) return a.from < b.from;
+		if (a.to   != b.to)   return a.to   < b.to;
+		return a.label < b.label;
+	});
+
+	g.row_offsets.assign(n_vertices + 1, 0);
+	g.col_offsets.assign(n_vertices + 1, 0);
+	g.targets.reserve(sorted.size());
+	g.edge_labels.reserve(sorted.size());
+	for (const auto &e : sorted) {
+		g.row_offsets[e.from + 1]++;
+		g.col_offsets[e.to + 1]++;
+		g.targets.push_back(e.to);
+		g.edge_labels.push_back(e.label);
+	}
+	for (size_t i = 0; i < n_vertices; i++) {
+		g.row_offsets[i + 1] += g.row_offsets[i];
+		g.col_offsets[i + 1] += g.col_offsets[i];
+	}
+
+	// edges are sorted by source, hence the sources per target are as well
+	g.sources.resize(sorted.size());
+	std::vector<size_t> fill(g.col_offsets.begin(), g.col_offsets.end() - 1);
+	for (const auto &e : sorted)
+		g.sources[fill[e.to]++] = e.from;
+
+	return g;
+}
+
+
+/*
+ * make_graph - create a graph from a finite state machine
+ *
+ * Vertices are the states of the FSM, labelled by their start (1) and final
+ * (2) flags. Edges are the transitions, labelled with read * n_symbols + write.
+ * The FSM must be initialized.
+ */
+inline graph
+make_graph(const finite_state_machine &fsm)
+{
+	const size_t n_symbols = fsm.alphabet ? fsm.alphabet->n_symbols : 0;
+
+	std::vector<std::uint32_t> labels(fsm.states.size(), 0);
+	for (size_t i = 0; i < fsm.states.size(); i++) {
+		const state *s = fsm.states[i];
+		labels[i] = (is_start(s) ? 1u : 0u) | (is_final(s) ? 2u : 0u);
+	}
+
+	std::vector<graph_edge> edges;
+	edges.reserve(fsm.transitions.size());
+	for (const transition *t : fsm.transitions) {
+		edges.push_back({
+			.from  = std::uint32_t(t->from->id),
+			.to    = std::uint32_t(t->to->id),
+			.label = std::uint32_t(t->read * n_symbols + t->write),
+		});
+	}
+	return make_graph(fsm.states.size(), edges, labels);
+}
+
+
+/*
+ * make_graph - create a graph from the connectivity of a transport
+ *
+ * Vertices are the dense port indices of the transport's CSR, i.e. vertex i
+ * corresponds to port transport.map.csr.port_ids[i]. All labels are 0. Returns
+ * std::nullopt if the transport is not frozen (see transport_freeze).
+ */
+template <typename Traits>
+std::optional<graph>
+make_graph(const transport<Traits> &transport)
+{
+	const auto &csr = transport.map.csr;
+	if (!csr.frozen) {
+		log_error("Transport must be frozen in make_graph.\n");
+		return std::nullopt;
+	}
+
+	const size_t n = csr.row_offsets.empty() ? 0 : csr.row_offsets.size() - 1;
+	std::vector<graph_edge> edges;
+	edges.reserve(csr.sinks.size());
+	for (size_t i = 0; i < n; i++)
+		for (size_t e = csr.row_offsets[i]; e < csr.row_offsets[i + 1]; e++)
+			edges.push_back({.from = std::uint32_t(i), .to = std::uint32_t(csr.sinks[e])});
+	return make_graph(n, edges);
+}
+
+
+/*
+ * ged_costs - costs of the edit operations
+ *
+ * Substituting a vertex or edge with one of the same label is free.
+ */
+struct ged_costs
+{
+	double vertex_substitution = 1.0;
+	double vertex_insertion    = 1.0;
+	double vertex_deletion     = 1.0;
+	double edge_substitution   = 1.0;
+	double edge_insertion      = 1.0;
+	double edge_deletion       = 1.0;
+};
+
+
+/*
+ * ged_options - configuration of the graph edit distance
+ *
+ * With beam_width = 0, the exact DF-GED is computed, which is only limited by
+ * max_expansions (0 = unlimited). Otherwise, a beam search which keeps the best
+ * beam_width partial mappings per level yields an upper bound.
+ */
+struct ged_options
+{
+	ged_costs costs;
+	size_t    beam_width     = 0;
+	size_t    max_expansions = 0;
+};
+
+
+/*
+ * ged_result - result of a graph edit distance computation
+ *
+ * mapping[u] is the vertex of the second graph that vertex u of the first graph
+ * was substituted with, or npos if u was deleted. exact is false if the beam
+ * search was used or the expansion limit was hit, in which case distance is an
+ * upper bound of the GED.
+ */
+struct ged_result
+{
+	static constexpr size_t npos = ~size_t(0);
+
+	double              distance = 0.0;
+	bool                exact    = true;
+	size_t              expansions = 0;
+	std::vector<size_t> mapping;
+};
+
+
+/*
+ * __ged_multiset_cost - cost to edit the sorted edge labels a into b
+ */
+inline double
+__ged_multiset_cost(std::span<const std::uint32_t> a, std::span<const std::uint32_t> b, const ged_costs &c)
+{
+	if (a.empty() && b.empty())
+		return 0.0;
+
+	size_t common = 0;
+	for (size_t i = 0, j = 0; i < a.size() && j < b.size(); ) {
+		if      (a[i] < b[j]) i++;
+		else if (b[j] < a[i]) j++;
+		else { common++; i++; j++; }
+	}
+	const size_t na  = a.size() - common;
+	const size_t nb  = b.size() - common;
+	const size_t sub = std::min(na, nb);
+	return double(sub) * std::min(c.edge_substitution, c.edge_deletion + c.edge_insertion)
+	     + double(na - sub) * c.edge_deletion
+	     + double(nb - sub) * c.edge_insertion;
+}
+
+
+/*
+ * __ged_context - shared state of a GED computation between g1 and g2
+ *
+ * Vertices of g1 are processed in a fixed order (descending degree, which
+ * prunes early). A partial mapping assigns the first k vertices of this order.
+ * For the lower bound, the context tracks how many edges of either graph are
+ * not accounted for yet, i.e. have an endpoint which is not processed (g1) or
+ * not used as the image of a processed vertex (g2).
+ */
+struct __ged_context
+{
+	static constexpr size_t npos = ged_result::npos;
+
+	const graph       &g1;
+	const graph       &g2;
+	const ged_costs   &costs;
+
+	std::vector<size_t> order;
+
+	// number of g1 edges between order[k] and order[0..k]
+	std::vector<size_t> edges_closed;
+
+	// distinct vertex labels, and their counts in g2
+	std::vector<std::uint32_t> labels;
+	std::vector<size_t>        count2_total;
+
+	// number of remaining g1 vertices with a label, for each level
+	std::vector<std::vector<size_t>> count1_suffix;
+
+	__ged_context(const graph &_g1, const graph &_g2, const ged_costs &_costs)
+	: g1(_g1), g2(_g2), costs(_costs)
+	{
+		const size_t n1 = graph_num_vertices(g1);
 
+		order.resize(n1);
+		for (size_t i = 0; i < n1; i++)
+			order[i] = i;
+		auto degree = [&](size_t u) {
+			return (g1.row_offsets[u + 1] - g1.row_offsets[u]) + (g1.col_offsets[u + 1] - g1.col_offsets[u]);
+		};
+		std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) { return degree(a) > degree(b); });
 
+		std::vector<size_t> position(n1);
+		for (size_t k = 0; k < n1; k++)
+			position[order[k]] = k;
+		edges_closed.assign(n1, 0);
+		for (size_t u = 0; u < n1; u++)
+			for (size_t e = g1.row_offsets[u]; e < g1.row_offsets[u + 1]; e++)
+				edges_closed[std::max(position[u], position[g1.targets[e]])]++;
+
+		labels.assign(g1.vertex_labels.begin(), g1.vertex_labels.end());
+		labels.insert(labels.end(), g2.vertex_labels.begin(), g2.vertex_labels.end());
+		std::sort(labels.begin(), labels.end());
+		labels.erase(std::unique(labels.begin(), labels.end()), labels.end());
+
+		count2_total.assign(labels.size(), 0);
+		for (auto l : g2.vertex_labels)
+			count2_total[label_index(l)]++;
+
+		count1_suffix.assign(n1 + 1, std::vector<size_t>(labels.size(), 0));
+		for (size_t k = n1; k-- > 0; ) {
+			count1_suffix[k] = count1_suffix[k + 1];
+			count1_suffix[k][label_index(g1.vertex_labels[order[k]])]++;
+		}
+	}
+
+	size_t
+	label_index(std::uint32_t l) const
+	{
+		return size_t(std::lower_bound(labels.begin(), labels.end(), l) - labels.begin());
+	}
+};
+
+
+/*
+ * __ged_state - a partial mapping of the first k vertices of the order
+ */
+struct __ged_state
+{
+	size_t              k = 0;
+	double              cost = 0.0;
+	double              bound = 0.0;
+
+	// image of each g1 vertex (indexed by vertex, not by order), and the
+	// pre-image of each g2 vertex
+	std::vector<size_t> image;
+	std::vector<size_t> preimage;
+
+	// remaining vertices of g2 per label, and unaccounted edges
+	std::vector<size_t> count2;
+	size_t              edges1_open = 0;
+	size_t              edges2_open = 0;
+};
+
+
+inline __ged_state
+__ged_initial_state(const __ged_context &ctx)
+{
+	__ged_state s;
+	s.image.assign(graph_num_vertices(ctx.g1), ctx.npos);
+	s.preimage.assign(graph_num_vertices(ctx.g2), ctx.npos);
+	s.count2      = ctx.count2_total;
+	s.edges1_open = graph_num_edges(ctx.g1);
+	s.edges2_open = graph_num_edges(ctx.g2);
+	return s;
+}
+
+
+/*
+ * __ged_lower_bound - admissible estimate of the cost to complete a state
+ *
+ * Remaining vertices with equal labels may be substituted for free, all others
+ * need at least a substitution, and surplus vertices an insertion or deletion.
+ * Each unaccounted edge is matched with another one, or inserted or deleted.
+ */
+inline double
+__ged_lower_bound(const __ged_context &ctx, const __ged_state &s)
+{
+	const auto &c     = ctx.costs;
+	const auto &count1 = ctx.count1_suffix[s.k];
+	size_t n1 = 0, n2 = 0, common = 0;
+	for (size_t l = 0; l < ctx.labels.size(); l++) {
+		n1     += count1[l];
+		n2     += s.count2[l];
+		common += std::min(count1[l], s.count2[l]);
+	}
+	const size_t sub = std::min(n1, n2) - common;
+	double h = double(sub) * std::min(c.vertex_substitution, c.vertex_deletion + c.vertex_insertion);
+	h += n1 > n2 ? double(n1 - n2) * c.vertex_deletion : double(n2 - n1) * c.vertex_insertion;
+
+	const size_t e1 = s.edges1_open, e2 = s.edges2_open;
+	h += e1 > e2 ? double(e1 - e2) * c.edge_deletion : double(e2 - e1) * c.edge_insertion;
+	return h;
+}
+
+
+/*
+ * __ged_step_cost - additional cost of mapping the next vertex u to v (or npos)
+ *
+ * This accounts for the vertex itself and all edges between u and the already
+ * processed vertices, including self loops.
+ */
+inline double
+__ged_step_cost(const __ged_context &ctx, const __ged_state &s, size_t v)
+{
+	const auto &c  = ctx.costs;
+	const size_t u = ctx.order[s.k];
+
+	double cost;
+	if (v == ctx.npos)
+		cost = c.vertex_deletion;
+	else
+		cost = ctx.g1.vertex_labels[u] == ctx.g2.vertex_labels[v] ? 0.0 : c.vertex_substitution;
+
+	auto edge_cost = [&](size_t a1, size_t b1, size_t a2, size_t b2) {
+		auto l1 = graph_edge_labels(ctx.g1, a1, b1);
+		if (a2 == ctx.npos || b2 == ctx.npos)
+			return double(l1.size()) * c.edge_deletion;
+		return __ged_multiset_cost(l1, graph_edge_labels(ctx.g2, a2, b2), c);
+	};
+
+	cost += edge_cost(u, u, v, v);
+	for (size_t j = 0; j < s.k; j++) {
+		const size_t w  = ctx.order[j];
+		const size_t vw = s.image[w];
+		cost += edge_cost(u, w, v, vw);
+		cost += edge_cost(w, u, vw, v);
+	}
+	return cost;
 }
+
+
+/*
+ * __ged_edges_closed2 - number of g2 edges between v and the used vertices or v itself
+ */
+inline size_t
+__ged_edges_closed2(const __ged_context &ctx, const __ged_state &s, size_t v)
+{
+	const auto &g2 = ctx.g2;
+	size_t n = 0;
+	for (size_t e = g2.row_offsets[v]; e < g2.row_offsets[v + 1]; e++)
+		n += g2.targets[e] == v || s.preimage[g2.targets[e]] != ctx.npos;
+	for (size_t e = g2.col_offsets[v]; e < g2.col_offsets[v + 1]; e++)
+		n += g2.sources[e] != v && s.preimage[g2.sources[e]] != ctx.npos;
+	return n;
+}
+
+
+/*
+ * __ged_extend - map the next vertex to v (or npos) and update cost and bound
+ */
+inline void
+__ged_extend(const __ged_context &ctx, __ged_state &s, size_t v, double step_cost)
+{
+	const size_t u = ctx.order[s.k];
+	s.edges1_open -= ctx.edges_closed[s.k];
+	if (v != ctx.npos) {
+		s.edges2_open -= __ged_edges_closed2(ctx, s, v);
+		s.count2[ctx.label_index(ctx.g2.vertex_labels[v])]--;
+		s.preimage[v] = u;
+	}
+	s.image[u] = v;
+	s.cost += step_cost;
+	s.k++;
+
+	// all of g1 is processed, remaining vertices and edges of g2 are inserted,
+	// which is exactly the lower bound
+	s.bound = s.cost + __ged_lower_bound(ctx, s);
+	if (s.k == ctx.order.size())
+		s.cost = s.bound;
+}
+
+
+/*
+ * __ged_undo - revert __ged_extend
+ */
+inline void
+__ged_undo(const __ged_context &ctx, __ged_state &s, size_t v, double cost_before)
+{
+	s.k--;
+	const size_t u = ctx.order[s.k];
+	s.image[u] = ctx.npos;
+	if (v != ctx.npos) {
+		s.preimage[v] = ctx.npos;
+		s.count2[ctx.label_index(ctx.g2.vertex_labels[v])]++;
+		s.edges2_open += __ged_edges_closed2(ctx, s, v);
+	}
+	s.edges1_open += ctx.edges_closed[s.k];
+	s.cost = cost_before;
+}
+
+
+/*
+ * __ged_candidates - all extensions of a state, sorted by their bound
+ */
+inline void
+__ged_candidates(
+		const __ged_context &ctx,
+		__ged_state &s,
+		std::vector<std::pair<double, size_t>> &out)
+{
+	out.clear();
+	const double cost_before = s.cost;
+	for (size_t v = 0; v <= graph_num_vertices(ctx.g2); v++) {
+		const size_t w = v == graph_num_vertices(ctx.g2) ? ctx.npos : v;
+		if (w != ctx.npos && s.preimage[w] != ctx.npos)
+			continue;
+		const double step = __ged_step_cost(ctx, s, w);
+		__ged_extend(ctx, s, w, step);
+		out.push_back({s.bound, w});
+		__ged_undo(ctx, s, w, cost_before);
+	}
+	std::stable_sort(out.begin(), out.end(), [](const auto &a, const auto &b) { return a.first < b.first; });
+}
+
+
+/*
+ * __ged_beam - beam search for an upper bound of the GED
+ */
+inline ged_result
+__ged_beam(const __ged_context &ctx, size_t beam_width)
+{
+	const size_t n1 = ctx.order.size();
+	std::vector<__ged_state> beam{__ged_initial_state(ctx)};
+	beam[0].bound = __ged_lower_bound(ctx, beam[0]);
+	if (n1 == 0)
+		beam[0].cost = beam[0].bound;
+
+	ged_result result;
+	result.exact = false;
+
+	std::vector<__ged_state> next;
+	std::vector<std::pair<double, size_t>> candidates;
+	for (size_t level = 0; level < n1; level++) {
+		next.clear();
+		for (auto &s : beam) {
+			__ged_candidates(ctx, s, candidates);
+			for (const auto &cand : candidates) {
+				const size_t v = cand.second;
+				__ged_state t = s;
+				__ged_extend(ctx, t, v, __ged_step_cost(ctx, s, v));
+				next.push_back(std::move(t));
+				result.expansions++;
+			}
+		}
+		const size_t keep = std::min(beam_width, next.size());
+		std::partial_sort(next.begin(), next.begin() + keep, next.end(),
+				[](const __ged_state &a, const __ged_state &b) { return a.bound < b.bound; });
+		next.resize(keep);
+		std::swap(beam, next);
+	}
+
+	const auto best = std::min_element(beam.begin(), beam.end(),
+			[](const __ged_state &a, const __ged_state &b) { return a.cost < b.cost; });
+	result.distance = best->cost;
+	result.mapping  = best->image;
+	return result;
+}
+
+
+/*
+ * __ged_dfs - depth first branch and bound over partial mappings
+ *
+ * Returns false if the expansion limit was hit.
+ */
+inline bool
+__ged_dfs(
+		const __ged_context &ctx,
+		__ged_state &s,
+		ged_result &best,
+		size_t max_expansions,
+		std::vector<std::vector<std::pair<double, size_t>>> &candidates)
+{
+	if (s.k == ctx.order.size()) {
+		if (s.cost < best.distance) {
+			best.distance = s.cost;
+			best.mapping  = s.image;
+		}
+		return true;
+	}
+
+	auto &cands = candidates[s.k];
+	__ged_candidates(ctx, s, cands);
+	for (size_t i = 0; i < cands.size(); i++) {
+		// candidates are sorted, hence all remaining ones can be pruned
+		if (cands[i].first >= best.distance)
+			break;
+		if (max_expansions && best.expansions >= max_expansions)
+			return false;
+		best.expansions++;
+
+		const size_t v = cands[i].second;
+		const double cost_before = s.cost;
+		__ged_extend(ctx, s, v, __ged_step_cost(ctx, s, v));
+		const bool ok = __ged_dfs(ctx, s, best, max_expansions, candidates);
+		__ged_undo(ctx, s, v, cost_before);
+		if (!ok)
+			return false;
+	}
+	return true;
+}
+
+
+/*
+ * graph_edit_distance - compute the (exact or approximate) GED of two graphs
+ *
+ * The exact variant starts from the upper bound of a narrow beam search, and
+ * then explores all partial mappings whose lower bound is below the best
+ * complete mapping found so far. Memory is O(|V1| |V2|).
+ */
+inline ged_result
+graph_edit_distance(const graph &g1, const graph &g2, const ged_options &opts = {})
+{
+	__ged_context ctx(g1, g2, opts.costs);
+
+	if (opts.beam_width > 0)
+		return __ged_beam(ctx, opts.beam_width);
+
+	ged_result best = __ged_beam(ctx, 4);
+	best.exact = true;
+
+	// the beam may already have found an optimal mapping
+	__ged_state s = __ged_initial_state(ctx);
+	if (__ged_lower_bound(ctx, s) < best.distance) {
+		std::vector<std::vector<std::pair<double, size_t>>> candidates(ctx.order.size());
+		best.exact = __ged_dfs(ctx, s, best, opts.max_expansions, candidates);
+	}
+	return best;
+}
+
+
+/*
+ * ged_all_pairs - GED between all pairs of graphs
+ *
+ * Returns a row-major n x n matrix. Only pairs i < j are computed, and the
+ * result is mirrored, which is exact for symmetric costs and exact GED. If a
+ * thread pool is given, the pairs are distributed over its workers.
+ */
+inline std::vector<double>
+ged_all_pairs(std::span<const graph> graphs, const ged_options &opts = {}, thread_pool *pool = nullptr)
+{
+	const size_t n = graphs.size();
+	std::vector<double> D(n * n, 0.0);
+	if (n < 2)
+		return D;
+
+	const size_t n_pairs = n * (n - 1) / 2;
+	parallel_for(pool, n_pairs, 1, [&](size_t begin, size_t end, unsigned) {
+		for (size_t p = begin; p < end; p++) {
+			// invert p = i * (2n - i - 1) / 2 + (j - i - 1)
+			size_t i = 0, row = n - 1, offset = p;
+			while (offset >= row) {
+				offset -= row;
+				row--;
+				i++;
+			}
+			const size_t j = i + 1 + offset;
+			const double d = graph_edit_distance(graphs[i], graphs[j], opts).distance;
+			D[i * n + j] = d;
+			D[j * n + i] = d;
+		}
+	});
+	return D;
+}
+
+
+} // ncr::
@@ -78,6 +78,13 @@
 #endif
 
 #include <mutex>
+#include <atomic>
+#include <thread>
+#include <memory>
+#include <cstring>
+#include <cstdint>
+#include <string>
+#include <string_view>
 #include <ostream>
 #include <iostream>
 #include <fstream>
@@ -216,6 +223,266 @@ private:
 
 
 
+/*
+ * log_overflow - behavior of logger_policy_async when its buffer is full
+ */
+enum struct log_overflow : unsigned {
+	// wait until the background thread made room for the message
+	Block,
+	// discard the message and count it, see logger_policy_async::dropped
+	Drop,
+};
+
+
+/*
+ * logger_policy_async - policy that moves the writing of messages to a
+ * background thread
+ *
+ * Messages are copied into a bounded lock-free ring buffer, from which a
+ * background thread takes them in batches and forwards them to another
+ * policy, e.g. logger_policy_file_t. Hence, callers never wait for I/O, but
+ * only pay for a copy of the message. Messages up to inline_capacity bytes
+ * are stored in the buffer itself, longer messages are moved to the heap.
+ * Any number of threads may push messages at the same time, also without a
+ * logger via push().
+ *
+ * The async policy takes ownership of the wrapped policy. Example:
+ *
+ *     ncr::NCR_LOG_DECLARATION(new ncr::logger_policy_async(
+ *         new ncr::logger_policy_file_t("sim.log"), 4096, ncr::log_overflow::Drop));
+ */
+struct logger_policy_async : logger_policy {
+	constexpr static size_t inline_capacity = 232;
+
+	explicit
+	logger_policy_async(logger_policy *sink, size_t capacity = 4096, log_overflow overflow = log_overflow::Block)
+	: _sink(sink), _overflow(overflow)
+	{
+		size_t n = 2;
+		while (n < capacity)
+			n <<= 1;
+		_mask  = n - 1;
+		_slots = std::make_unique<_slot[]>(n);
+		for (size_t i = 0; i < n; i++)
+			_slots[i].seq.store(i, std::memory_order_relaxed);
+	}
+
+	~logger_policy_async() override
+	{
+		this->finalize();
+		this->_drain();
+	}
+
+	void log_error(const std::string &msg)   override { this->push(log_level::Error, msg); }
+	void log_warning(const std::string &msg) override { this->push(log_level::Warning, msg); }
+	void log_debug(const std::string &msg)   override { this->push(log_level::Debug, msg); }
+	void log_verbose(const std::string &msg) override { this->push(log_level::Verbose, msg); }
+
+	// initialize the wrapped policy and start the background thread
+	void
+	init() override
+	{
+		if (this->_running.load())
+			return;
+		if (this->_sink)
+			this->_sink->init();
+		this->_stop.store(false);
+		this->_running.store(true);
+		this->_thread = std::thread(&logger_policy_async::_run, this);
+	}
+
+	// write all pending messages, stop the background thread, and finalize
+	// the wrapped policy
+	void
+	finalize() override
+	{
+		if (!this->_running.load())
+			return;
+		this->_stop.store(true);
+		this->_wake();
+		this->_thread.join();
+		this->_running.store(false);
+		this->_drain();
+		if (this->_sink)
+			this->_sink->finalize();
+	}
+
+	/*
+	 * push - enqueue a message of a certain level
+	 *
+	 * Returns false if the message was dropped because the buffer is full
+	 * and the policy was configured to drop messages.
+	 */
+	bool
+	push(log_level level, std::string_view msg)
+	{
+		size_t pos = this->_tail.load(std::memory_order_relaxed);
+		_slot *s;
+		while (true) {
+			s = &this->_slots[pos & this->_mask];
+			const size_t seq = s->seq.load(std::memory_order_acquire);
+			const auto diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos);
+			if (diff == 0) {
+				if (this->_tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+					break;
+			}
+			else if (diff < 0) {
+				// full
+				if (this->_overflow == log_overflow::Drop || !this->_running.load(std::memory_order_relaxed)) {
+					this->_dropped.fetch_add(1, std::memory_order_relaxed);
+					return false;
+				}
+				const size_t head = this->_head.load(std::memory_order_acquire);
+				if (head + this->_mask + 1 <= pos) {
+					this->_wake();
+					this->_head.wait(head, std::memory_order_acquire);
+				}
+				pos = this->_tail.load(std::memory_order_relaxed);
+			}
+			else
+				pos = this->_tail.load(std::memory_order_relaxed);
+		}
+
+		s->level = level;
+		s->len   = msg.size();
+		if (msg.size() <= inline_capacity) {
+			s->heap = nullptr;
+			if (!msg.empty())
+				std::memcpy(s->text, msg.data(), msg.size());
+		}
+		else {
+			s->heap = new char[msg.size()];
+			std::memcpy(s->heap, msg.data(), msg.size());
+		}
+		s->seq.store(pos + 1, std::memory_order_release);
+
+		// wake the background thread only if it is about to sleep
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		if (this->_sleeping.load(std::memory_order_relaxed))
+			this->_wake();
+		return true;
+	}
+
+	/*
+	 * flush - block until all messages pushed so far were written
+	 */
+	void
+	flush()
+	{
+		const size_t target = this->_tail.load(std::memory_order_acquire);
+		while (this->_running.load()) {
+			const size_t head = this->_head.load(std::memory_order_acquire);
+			if (head >= target)
+				return;
+			this->_wake();
+			this->_head.wait(head, std::memory_order_acquire);
+		}
+		this->_drain();
+	}
+
+	// number of messages that were dropped due to a full buffer
+	std::uint64_t dropped() const { return this->_dropped.load(std::memory_order_relaxed); }
+
+	// capacity of the ring buffer in messages
+	size_t capacity() const { return this->_mask + 1; }
+
+private:
+	struct _slot {
+		std::atomic<size_t> seq;
+		log_level           level;
+		size_t              len;
+		char               *heap;
+		char                text[inline_capacity];
+	};
+
+	void
+	_wake()
+	{
+		this->_epoch.fetch_add(1, std::memory_order_release);
+		this->_epoch.notify_one();
+	}
+
+	// write all messages that are currently in the buffer. Returns the number
+	// of written messages. Only the background thread, or the thread that
+	// finalizes the policy, may call this
+	size_t
+	_drain()
+	{
+		size_t head = this->_head.load(std::memory_order_relaxed);
+		size_t n = 0;
+		std::string msg;
+		while (true) {
+			_slot &s = this->_slots[head & this->_mask];
+			if (s.seq.load(std::memory_order_acquire) != head + 1)
+				break;
+
+			msg.assign(s.heap ? s.heap : s.text, s.len);
+			delete[] s.heap;
+			s.heap = nullptr;
+			const log_level level = s.level;
+			s.seq.store(head + this->_mask + 1, std::memory_order_release);
+			head += 1;
+			n += 1;
+
+			if (this->_sink) {
+				switch (level) {
+				case log_level::Error:   this->_sink->log_error(msg);   break;
+				case log_level::Warning: this->_sink->log_warning(msg); break;
+				case log_level::Debug:   this->_sink->log_debug(msg);   break;
+				case log_level::Verbose: this->_sink->log_verbose(msg); break;
+				default: break;
+				}
+			}
+
+			// publish progress regularly to unblock waiting producers
+			if ((n & 63) == 0) {
+				this->_head.store(head, std::memory_order_release);
+				this->_head.notify_all();
+			}
+		}
+		this->_head.store(head, std::memory_order_release);
+		this->_head.notify_all();
+		return n;
+	}
+
+	// main loop of the background thread
+	void
+	_run()
+	{
+		while (true) {
+			this->_drain();
+			if (this->_stop.load())
+				return;
+
+			// announce sleeping, and check once more for messages that were
+			// pushed in between. The fences pair with the one in push()
+			this->_sleeping.store(true, std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			const auto epoch = this->_epoch.load(std::memory_order_acquire);
+			const size_t head = this->_head.load(std::memory_order_relaxed);
+			const bool pending = this->_slots[head & this->_mask].seq.load(std::memory_order_acquire) == head + 1;
+			if (!pending && !this->_stop.load())
+				this->_epoch.wait(epoch, std::memory_order_acquire);
+			this->_sleeping.store(false, std::memory_order_relaxed);
+		}
+	}
+
+	std::unique_ptr<logger_policy> _sink;
+	log_overflow                   _overflow;
+
+	std::unique_ptr<_slot[]>       _slots;
+	size_t                         _mask = 0;
+	alignas(64) std::atomic<size_t>        _tail = 0;
+	alignas(64) std::atomic<size_t>        _head = 0;
+	alignas(64) std::atomic<std::uint32_t> _epoch = 0;
+	std::atomic<bool>              _sleeping = false;
+	std::atomic<bool>              _stop = false;
+	std::atomic<bool>              _running = false;
+	std::atomic<std::uint64_t>     _dropped = 0;
+	std::thread                    _thread;
+};
+
+
 /*
  * logger - A minimalistic logger implementation
  */
@@ -5,11 +5,38 @@
  * SPDX-License-Identifier: MIT
  * See LICENSE file for more details.
  *
+ * Besides the raw format of write_dense/read_dense, this file contains an
+ * aligned format with a self-describing header (dtype, byte order, storage
+ * order, alignment). Files in the aligned format can be written in chunks with
+ * dense_writer, and memory-mapped without copying with mapped_dense, which is
+ * meant for large (weight) matrices that shouldn't be read into memory as a
+ * whole. Example:
+ *
+ *     ncr::matrix::io::dense_writer<float> writer;
+ *     writer.open("weights.bin", n_rows, n_cols, ncr::matrix::io::storage_order::RowMajor);
+ *     for (...)
+ *         writer.append(row_block);
+ *     writer.close();
+ *
+ *     ncr::matrix::io::mapped_dense<float> weights;
+ *     if (weights.open("weights.bin") == ncr::matrix::io::status::Success) {
+ *         auto W = weights.map<Eigen::RowMajor>();
+ *         ...
+ *     }
  */
 #pragma once
 
 #include <iostream>
 #include <fstream>
+#include <cstdint>
+#include <cstring>
+#include <cassert>
+#include <algorithm>
+#include <type_traits>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
 #include <Eigen/Dense>
 #include <ncr/ncr_utils.hpp>
 #include <ncr/ncr_filesystem.hpp>
@@ -25,7 +52,11 @@ enum struct status: unsigned {
 	WriteError        = 0x02,
 	ReadError         = 0x04,
 	// TODO: more specific errors
-	ErrorFileNotFound = 0x08
+	ErrorFileNotFound = 0x08,
+	ErrorHeader       = 0x10,
+	ErrorType         = 0x20,
+	ErrorByteOrder    = 0x40,
+	ErrorMap          = 0x80,
 };
 NCR_DEFINE_ENUM_FLAG_OPERATORS(status)
 
@@ -94,5 +125,493 @@ read_dense(const std::string &filename, Matrix &matrix)
 
 
 
+/*
+ * dtype - scalar type of the elements of a matrix in the aligned format
+ */
+enum struct dtype : std::uint8_t {
+	Unknown = 0,
+	Int8,
+	UInt8,
+	Int16,
+	UInt16,
+	Int32,
+	UInt32,
+	Int64,
+	UInt64,
+	Float32,
+	Float64,
+};
+
+
+/*
+ * dtype_of - get the dtype of a scalar type
+ */
+template <typename T>
+constexpr dtype
+dtype_of()
+{
+	using U = std::remove_cv_t<T>;
+	if constexpr (std::is_same_v<U, float>)            return dtype::Float32;
+	else if constexpr (std::is_same_v<U, double>)      return dtype::Float64;
+	else if constexpr (!std::is_integral_v<U>)         return dtype::Unknown;
+	else if constexpr (sizeof(U) == 1)                 return std::is_signed_v<U> ? dtype::Int8  : dtype::UInt8;
+	else if constexpr (sizeof(U) == 2)                 return std::is_signed_v<U> ? dtype::Int16 : dtype::UInt16;
+	else if constexpr (sizeof(U) == 4)                 return std::is_signed_v<U> ? dtype::Int32 : dtype::UInt32;
+	else if constexpr (sizeof(U) == 8)                 return std::is_signed_v<U> ? dtype::Int64 : dtype::UInt64;
+	else                                               return dtype::Unknown;
+}
+
+
+/*
+ * storage_order - memory layout of the elements of a matrix
+ */
+enum struct storage_order : std::uint8_t {
+	ColMajor = 0,
+	RowMajor = 1,
+};
+
+
+/*
+ * dense_header - header of the aligned format
+ *
+ * The header is written in the byte order of the writing machine. Readers
+ * detect the byte order via the byte_order field, which always contains
+ * 0x01020304 in the byte order of the writer. The data starts at data_offset,
+ * which is a multiple of alignment.
+ */
+struct dense_header {
+	constexpr static char          magic_value[8] = {'N', 'C', 'R', 'M', 'A', 'T', 'R', 'X'};
+	constexpr static std::uint32_t byte_order_value = 0x01020304;
+	constexpr static std::uint16_t version_value = 1;
+
+	char          magic[8];
+	std::uint32_t byte_order;
+	std::uint16_t version;
+	dtype         type;
+	storage_order order;
+	std::uint32_t elem_size;
+	std::uint32_t alignment;
+	std::uint64_t rows;
+	std::uint64_t cols;
+	std::uint64_t data_offset;
+	std::uint8_t  _reserved[16];
+};
+static_assert(sizeof(dense_header) == 64);
+
+
+/*
+ * __byteswap - reverse the bytes of a value in place
+ */
+template <typename T>
+inline void
+__byteswap(T &v)
+{
+	auto *bytes = reinterpret_cast<unsigned char*>(&v);
+	std::reverse(bytes, bytes + sizeof(T));
+}
+
+
+/*
+ * __dense_data_offset - offset of the data for a given alignment
+ */
+inline std::uint64_t
+__dense_data_offset(std::uint32_t alignment)
+{
+	const std::uint64_t a = std::max<std::uint64_t>(alignment, 1);
+	return (sizeof(dense_header) + a - 1) / a * a;
+}
+
+
+/*
+ * __dense_read_header - read and validate a header
+ *
+ * If the file was written on a machine with different byte order, the header
+ * is converted and swapped is set to true. file_size is used to check that
+ * the data is complete.
+ */
+inline status
+__dense_read_header(const void *buffer, std::uint64_t file_size, dense_header &header, bool &swapped)
+{
+	if (file_size < sizeof(dense_header))
+		return status::ErrorHeader;
+	std::memcpy(&header, buffer, sizeof(dense_header));
+	if (std::memcmp(header.magic, dense_header::magic_value, sizeof(header.magic)) != 0)
+		return status::ErrorHeader;
+
+	swapped = false;
+	if (header.byte_order != dense_header::byte_order_value) {
+		__byteswap(header.byte_order);
+		if (header.byte_order != dense_header::byte_order_value)
+			return status::ErrorHeader;
+		__byteswap(header.version);
+		__byteswap(header.elem_size);
+		__byteswap(header.alignment);
+		__byteswap(header.rows);
+		__byteswap(header.cols);
+		__byteswap(header.data_offset);
+		swapped = true;
+	}
+
+	if (header.version != dense_header::version_value
+	    || header.data_offset < sizeof(dense_header)
+	    || header.elem_size == 0
+	    || (header.alignment && header.data_offset % header.alignment))
+		return status::ErrorHeader;
+
+	// also guard against overflow of rows * cols * elem_size
+	const std::uint64_t avail = file_size - std::min(file_size, header.data_offset);
+	if (header.cols && header.rows > avail / header.elem_size / header.cols)
+		return status::ErrorHeader;
+	return status::Success;
+}
+
+
+/*
+ * dense_writer - chunked writer for the aligned format
+ *
+ * The number of rows and columns must be known in advance. Afterwards, the
+ * matrix is written in blocks of rows (RowMajor) or columns (ColMajor) with
+ * append(). close() checks that all elements were written, an incomplete file
+ * is reported as WriteError.
+ */
+template <typename Scalar>
+struct dense_writer
+{
+	static_assert(dtype_of<Scalar>() != dtype::Unknown, "unsupported scalar type");
+
+	~dense_writer() { this->close(); }
+
+	status
+	open(const std::string &filename, std::uint64_t rows, std::uint64_t cols,
+	     storage_order order = storage_order::ColMajor, std::uint32_t alignment = 64)
+	{
+		this->close();
+		this->_out.open(filename, std::ios::out | std::ios::binary | std::ios::trunc);
+		if (!this->_out.is_open())
+			return status::WriteError;
+
+		this->_header = {};
+		std::memcpy(this->_header.magic, dense_header::magic_value, sizeof(this->_header.magic));
+		this->_header.byte_order  = dense_header::byte_order_value;
+		this->_header.version     = dense_header::version_value;
+		this->_header.type        = dtype_of<Scalar>();
+		this->_header.order       = order;
+		this->_header.elem_size   = sizeof(Scalar);
+		this->_header.alignment   = std::max<std::uint32_t>(alignment, 1);
+		this->_header.rows        = rows;
+		this->_header.cols        = cols;
+		this->_header.data_offset = __dense_data_offset(this->_header.alignment);
+		this->_written = 0;
+
+		// header and zero padding up to the data
+		this->_out.write(reinterpret_cast<const char*>(&this->_header), sizeof(dense_header));
+		for (std::uint64_t i = sizeof(dense_header); i < this->_header.data_offset; i++)
+			this->_out.put(0);
+		return this->_out ? status::Success : status::WriteError;
+	}
+
+	// append raw elements in the storage order of the file
+	status
+	append(const Scalar *data, std::uint64_t count)
+	{
+		if (!this->_out.is_open() || this->_written + count > this->size())
+			return status::WriteError;
+		this->_out.write(reinterpret_cast<const char*>(data), count * sizeof(Scalar));
+		this->_written += count;
+		return this->_out ? status::Success : status::WriteError;
+	}
+
+	// append a block of full rows (RowMajor files) or full columns (ColMajor
+	// files). The block can be any Eigen expression of matching scalar type
+	template <typename Derived>
+	status
+	append(const Eigen::DenseBase<Derived> &block)
+	{
+		static_assert(std::is_same_v<typename Derived::Scalar, Scalar>);
+		const bool row_major = this->_header.order == storage_order::RowMajor;
+		if (row_major  && std::uint64_t(block.cols()) != this->_header.cols) return status::WriteError;
+		if (!row_major && std::uint64_t(block.rows()) != this->_header.rows) return status::WriteError;
+
+		// write directly if the block's memory layout already matches
+		if constexpr (bool(Derived::Flags & Eigen::DirectAccessBit)) {
+			const bool contiguous = block.innerStride() == 1
+			    && block.outerStride() == (bool(Derived::IsRowMajor) ? block.cols() : block.rows());
+			if (contiguous && (bool(Derived::IsRowMajor) == row_major || block.rows() == 1 || block.cols() == 1))
+				return this->append(block.derived().data(), std::uint64_t(block.size()));
+		}
+
+		if (row_major) {
+			Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor> tmp = block;
+			return this->append(tmp.data(), std::uint64_t(tmp.size()));
+		}
+		Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic, Eigen::ColMajor> tmp = block;
+		return this->append(tmp.data(), std::uint64_t(tmp.size()));
+	}
+
+	status
+	close()
+	{
+		if (!this->_out.is_open())
+			return status::Success;
+		this->_out.close();
+		if (this->_out.fail() || this->_written != this->size())
+			return status::WriteError;
+		return status::Success;
+	}
+
+	std::uint64_t size()    const { return this->_header.rows * this->_header.cols; }
+	std::uint64_t written() const { return this->_written; }
+
+private:
+	std::ofstream _out;
+	dense_header  _header = {};
+	std::uint64_t _written = 0;
+};
+
+
+/*
+ * write_dense_aligned - write a matrix in the aligned format
+ */
+template <typename Matrix>
+inline status
+write_dense_aligned(const std::string &filename, const Matrix &matrix, std::uint32_t alignment = 64)
+{
+	using scalar_t = typename Matrix::Scalar;
+	dense_writer<scalar_t> writer;
+	const auto order = Matrix::IsRowMajor ? storage_order::RowMajor : storage_order::ColMajor;
+	status s = writer.open(filename, matrix.rows(), matrix.cols(), order, alignment);
+	if (s != status::Success)
+		return s;
+	s = writer.append(matrix);
+	if (s != status::Success)
+		return s;
+	return writer.close();
+}
+
+
+/*
+ * mmap_mode - how mapped_dense maps a file
+ */
+enum struct mmap_mode : unsigned {
+	// read-only access
+	ReadOnly,
+	// writable, but changes are private to the process (copy on write)
+	Private,
+	// writable, changes go to the file
+	Shared,
+};
+
+
+/*
+ * mapped_dense - zero-copy view of a matrix file in the aligned format
+ *
+ * The file is mapped into memory, and pages are loaded on demand by the
+ * operating system. Hence, also matrices that are larger than the available
+ * memory can be used. The view is valid as long as the mapped_dense object
+ * lives. Files that were written with a different byte order cannot be
+ * mapped, use read_dense_aligned instead.
+ *
+ * Elements are accessible via map(), which returns an Eigen::Map, or via
+ * ptr() together with row_stride() and col_stride(), e.g. to attach a
+ * vector_t to a column:
+ *
+ *     ncr::vector_t<N, double> col(m.ptr_mutable(0, j), m.row_stride());
+ *
+ * data(), ptr(), and map() give read access in all modes. Their _mutable
+ * counterparts are only available in mode Private or Shared, and return
+ * nullptr (data_mutable, ptr_mutable) in mode ReadOnly, because writing to a
+ * read-only mapping would fault.
+ */
+template <typename Scalar>
+struct mapped_dense
+{
+	static_assert(dtype_of<Scalar>() != dtype::Unknown, "unsupported scalar type");
+
+	mapped_dense() = default;
+	mapped_dense(const mapped_dense &) = delete;
+	mapped_dense& operator=(const mapped_dense &) = delete;
+	~mapped_dense() { this->close(); }
+
+	status
+	open(const std::string &filename, mmap_mode mode = mmap_mode::ReadOnly)
+	{
+		this->close();
+
+		const int fd = ::open(filename.c_str(), mode == mmap_mode::Shared ? O_RDWR : O_RDONLY);
+		if (fd < 0)
+			return status::ErrorFileNotFound;
+		struct stat st;
+		if (::fstat(fd, &st) != 0 || st.st_size <= 0) {
+			::close(fd);
+			return status::ReadError;
+		}
+
+		const int prot  = mode == mmap_mode::ReadOnly ? PROT_READ : PROT_READ | PROT_WRITE;
+		const int flags = mode == mmap_mode::Shared ? MAP_SHARED : MAP_PRIVATE;
+		void *addr = ::mmap(nullptr, size_t(st.st_size), prot, flags, fd, 0);
+		// the mapping stays valid after closing the descriptor
+		::close(fd);
+		if (addr == MAP_FAILED)
+			return status::ErrorMap;
+		this->_addr = addr;
+		this->_length = size_t(st.st_size);
+		this->_mode = mode;
+
+		bool swapped = false;
+		status s = __dense_read_header(addr, this->_length, this->_header, swapped);
+		if (s == status::Success && swapped)
+			s = status::ErrorByteOrder;
+		if (s == status::Success && (this->_header.type != dtype_of<Scalar>() || this->_header.elem_size != sizeof(Scalar)))
+			s = status::ErrorType;
+		if (s == status::Success && (this->_header.data_offset % alignof(Scalar)))
+			s = status::ErrorHeader;
+		if (s != status::Success) {
+			this->close();
+			return s;
+		}
+		return status::Success;
+	}
+
+	void
+	close()
+	{
+		if (this->_addr)
+			::munmap(this->_addr, this->_length);
+		this->_addr = nullptr;
+		this->_length = 0;
+		this->_header = {};
+		this->_mode = mmap_mode::ReadOnly;
+	}
+
+	// hint the operating system about the access pattern, e.g. MADV_SEQUENTIAL
+	// or MADV_WILLNEED
+	bool
+	advise(int advice)
+	{
+		return this->_addr && ::madvise(this->_addr, this->_length, advice) == 0;
+	}
+
+	bool          is_open() const { return this->_addr != nullptr; }
+	std::uint64_t rows()    const { return this->_header.rows; }
+	std::uint64_t cols()    const { return this->_header.cols; }
+	std::uint64_t size()    const { return this->rows() * this->cols(); }
+	storage_order order()   const { return this->_header.order; }
+	bool          writable() const { return this->_addr && this->_mode != mmap_mode::ReadOnly; }
+
+	// distance (in elements) between (r, c) and (r + 1, c)
+	size_t row_stride() const { return this->order() == storage_order::RowMajor ? this->cols() : 1; }
+	// distance (in elements) between (r, c) and (r, c + 1)
+	size_t col_stride() const { return this->order() == storage_order::RowMajor ? 1 : this->rows(); }
+
+	const Scalar*
+	data() const
+	{
+		if (!this->_addr)
+			return nullptr;
+		return reinterpret_cast<const Scalar*>(static_cast<const char*>(this->_addr) + this->_header.data_offset);
+	}
+
+	Scalar*
+	data_mutable()
+	{
+		if (!this->writable())
+			return nullptr;
+		return reinterpret_cast<Scalar*>(static_cast<char*>(this->_addr) + this->_header.data_offset);
+	}
+
+	const Scalar*
+	ptr(size_t r, size_t c) const
+	{
+		return this->data() + r * this->row_stride() + c * this->col_stride();
+	}
+
+	Scalar*
+	ptr_mutable(size_t r, size_t c)
+	{
+		Scalar *p = this->data_mutable();
+		return p ? p + r * this->row_stride() + c * this->col_stride() : nullptr;
+	}
+
+	// Eigen view of the data. The Options must match the storage order of the
+	// file
+	template <int Options = Eigen::ColMajor>
+	Eigen::Map<const Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic, Options>>
+	map() const
+	{
+		assert(bool(Options & Eigen::RowMajor) == (this->order() == storage_order::RowMajor));
+		return {this->data(), Eigen::Index(this->rows()), Eigen::Index(this->cols())};
+	}
+
+	// writable Eigen view of the data, requires mode Private or Shared
+	template <int Options = Eigen::ColMajor>
+	Eigen::Map<Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic, Options>>
+	map_mutable()
+	{
+		assert(bool(Options & Eigen::RowMajor) == (this->order() == storage_order::RowMajor));
+		assert(this->writable());
+		return {this->data_mutable(), Eigen::Index(this->rows()), Eigen::Index(this->cols())};
+	}
+
+private:
+	void         *_addr = nullptr;
+	size_t        _length = 0;
+	dense_header  _header = {};
+	mmap_mode     _mode = mmap_mode::ReadOnly;
+};
+
+
+/*
+ * read_dense_aligned - read a matrix in the aligned format into memory
+ *
+ * In contrast to mapped_dense, this also reads files with a different byte
+ * order or storage order than the matrix, which are converted while reading.
+ */
+template <typename Matrix>
+inline status
+read_dense_aligned(const std::string &filename, Matrix &matrix)
+{
+	using scalar_t = typename Matrix::Scalar;
+	if (!ncr::filesystem::exists(filename))
+		return status::ErrorFileNotFound;
+
+	std::ifstream in(filename, std::ios::in | std::ios::binary | std::ios::ate);
+	if (!in.is_open())
+		return status::ReadError;
+	const std::uint64_t file_size = std::uint64_t(in.tellg());
+	in.seekg(0);
+
+	char buffer[sizeof(dense_header)] = {};
+	in.read(buffer, sizeof(buffer));
+	dense_header header;
+	bool swapped = false;
+	status s = __dense_read_header(buffer, file_size, header, swapped);
+	if (s != status::Success)
+		return s;
+	if (header.type != dtype_of<scalar_t>() || header.elem_size != sizeof(scalar_t))
+		return status::ErrorType;
+
+	// read in the storage order of the file, and let Eigen convert
+	const bool row_major = header.order == storage_order::RowMajor;
+	Eigen::Matrix<scalar_t, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor> rm;
+	Eigen::Matrix<scalar_t, Eigen::Dynamic, Eigen::Dynamic, Eigen::ColMajor> cm;
+	scalar_t *data;
+	if (row_major) { rm.resize(header.rows, header.cols); data = rm.data(); }
+	else           { cm.resize(header.rows, header.cols); data = cm.data(); }
+
+	in.seekg(std::streamoff(header.data_offset));
+	in.read(reinterpret_cast<char*>(data), std::streamsize(header.rows * header.cols * sizeof(scalar_t)));
+	if (!in)
+		return status::ReadError;
+	if (swapped)
+		for (std::uint64_t i = 0; i < header.rows * header.cols; i++)
+			__byteswap(data[i]);
+
+	if (row_major) matrix = std::move(rm);
+	else           matrix = std::move(cm);
+	return status::Success;
+}
+
+
+
 } // ::io
 }} // ncr::matrix
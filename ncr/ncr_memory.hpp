@@ -1,5 +1,5 @@
 /*
- * ncr_memory - A reference counted slab memory.
+ * ncr_memory - A reference counted slab memory, and a simple arena.
  *
  * SPDX-FileCopyrightText: 2022-2023 Nicolai Waniek <n@rochus.net>
  * SPDX-License-Identifier: MIT
@@ -7,11 +7,19 @@
  */
 #pragma once
 
+#include <cassert>
 #include <cstddef>
+#include <cstdint>
+#include <atomic>
+#include <memory>
+#include <bit>
+#include <iterator>
+#include <type_traits>
+#include <algorithm>
 #include <vector>
-#include <list>
 #include <optional>
 #include <ostream>
+#include <cstring>
 
 #include <ncr/ncr_log.hpp>
 #include <ncr/ncr_utils.hpp>
@@ -31,7 +39,8 @@ using slab_memory_index_t = std::size_t;
 /*
  * slab_memory_item - memory item for arbitrary types T
  *
- * TODO: separate reference counting from data into two independent structs
+ * Note that slab_memory does not store items like this, but keeps values and
+ * their meta data apart, see slab_memory_page.
  */
 template <typename T>
 struct slab_memory_item {
@@ -50,6 +59,26 @@ struct slab_memory_item {
 static constexpr const size_t slab_memory_default_page_size = 2048;
 
 
+/*
+ * slab_memory_page - one page of a slab_memory
+ *
+ * Values are stored contiguously and apart from the data that is required to
+ * manage them, i.e. reference counts and the occupancy bitmap, in which bit i
+ * is set if the i-th item of the page is in use. Especially for small values,
+ * scanning values thus doesn't drag the meta data through the cache.
+ */
+template <typename T>
+struct slab_memory_page {
+	std::vector<T>             values;
+	std::vector<size_t>        ref_counts;
+	std::vector<std::uint64_t> occupied;
+
+	slab_memory_page(const size_t page_size)
+	: values(page_size), ref_counts(page_size, 0), occupied((page_size + 63) / 64, 0)
+	{}
+};
+
+
 /*
  * some statistics that we might collect over the span of the slab_memory
  * lifetime
@@ -80,15 +109,17 @@ struct slab_memory_stats {
  * Paging is used primarily to avoid invalidating pointers to items. That is,
  * the individual pages will not be moved around after allocation. However, the
  * vector with the pointers to pages might be moved.
+ *
+ * Each page stores the values in a dense array, and reference counts and
+ * occupancy in parallel arrays (see slab_memory_page). Hence, get() returns a
+ * pointer straight into the dense value array of a page.
  */
 template <typename T>
 struct slab_memory
 {
 	// types used within this memory
 	using index_type        = slab_memory_index_t;
-	using item_type	        = slab_memory_item<T>;
-	using memory_type       = std::vector<item_type>;
-	using page_type         = std::vector<memory_type*>;
+	using page_type         = slab_memory_page<T>;
 	template <typename ValueType> using optional = std::optional<ValueType>;
 
 	// functions
@@ -99,14 +130,38 @@ struct slab_memory
 	optional<size_t>        decref(const optional<index_type> index);
 
 	std::vector<optional<index_type>> calloc(size_t N);
-	// TODO: free version for vector
-
-	// TODO: needs iterators .begin(), .end(), ++, etc. to walk over all memory
-	//       items
+	size_t                  free(const std::vector<optional<index_type>> &indexes);
+	template <typename InputIt>
+	size_t                  free(InputIt first, InputIt last);
+
+	// forward iterator over all live items, i.e. items with ref_count > 0, in
+	// order of their index. Free items are skipped via the occupancy bitmap
+	template <bool Const>
+	struct basic_iterator;
+	using iterator          = basic_iterator<false>;
+	using const_iterator    = basic_iterator<true>;
+
+	iterator                begin()       { return iterator(this, this->_next_live(0)); };
+	iterator                end()         { return iterator(this, this->_last_index); };
+	const_iterator          begin() const { return const_iterator(this, this->_next_live(0)); };
+	const_iterator          end()   const { return const_iterator(this, this->_last_index); };
+
+	std::vector<optional<index_type>> compact();
+
+	// raw snapshot of the whole memory including free lists and statistics,
+	// e.g. for simulation checkpoints. T must be trivially copyable
+	size_t                  checkpoint_size() const;
+	void                    checkpoint_save(std::byte *dst) const;
+	bool                    checkpoint_load(const std::byte *src, size_t size);
 
 	optional<T * const>     get(const optional<index_type> index);
 	void                    set(const optional<index_type> index, T&& value);
 
+	// unchecked access to a live item, e.g. when scanning a batch of indexes
+	// which are known to be valid. See slab_memory::get for a checked version
+	T&                      operator[](index_type index)       { return this->_value(index); };
+	const T&                operator[](index_type index) const { return this->_value(index); };
+
 	size_t                  capacity()   const { return this->_stats.capacity; };
 	size_t                  size()       const { return this->_stats.size; };
 	size_t                  page_count() const { return this->_stats.page_count; };
@@ -119,19 +174,66 @@ struct slab_memory
 
 private:
 	void                    _release(const optional<index_type> index);
-	item_type&              _get_item(size_t index);
+	T&                      _value(size_t index);
+	const T&                _value(size_t index) const;
+	size_t&                 _ref_count(size_t index);
+	size_t                  _ref_count(size_t index) const;
 	void                    _alloc_page();
+	size_t                  _next_live(size_t index) const;
+	void                    _set_occupied(size_t index, bool occupied);
 
 	// the memory itself
-	page_type               pages;
-	std::list<index_type>	_free_indexes;
+	std::vector<page_type*> pages;
 	size_t                  _last_index = 0;
 
+	// stack of released items. Re-using the most recently released item first
+	// is likely to hit memory which is still in cache. In contrast to a list,
+	// pushing and popping doesn't allocate once the stack reached its
+	// (high-water mark) capacity
+	std::vector<index_type> _free_indexes;
+
 	// statistics and maintenance
 	slab_memory_stats       _stats;
 };
 
 
+/*
+ * slab_memory::basic_iterator - iterator over the live items of a slab_memory
+ *
+ * Dereferencing the iterator yields the value of the item, index() the index
+ * of the item. Iterators are invalidated by compact, but not by alloc or free
+ * of other items.
+ */
+template <typename T>
+template <bool Const>
+struct slab_memory<T>::basic_iterator
+{
+	using slab_type         = std::conditional_t<Const, const slab_memory<T>, slab_memory<T>>;
+	using iterator_category = std::forward_iterator_tag;
+	using difference_type   = std::ptrdiff_t;
+	using value_type        = T;
+	using pointer           = std::conditional_t<Const, const T*, T*>;
+	using reference         = std::conditional_t<Const, const T&, T&>;
+
+	basic_iterator() = default;
+	basic_iterator(slab_type *slab, size_t index) : _slab(slab), _index(index) {}
+
+	reference       operator*()  const { return this->_slab->_value(this->_index); }
+	pointer         operator->() const { return &this->_slab->_value(this->_index); }
+	index_type      index()      const { return this->_index; }
+	size_t          ref_count()  const { return this->_slab->_ref_count(this->_index); }
+
+	basic_iterator& operator++()       { this->_index = this->_slab->_next_live(this->_index + 1); return *this; }
+	basic_iterator  operator++(int)    { auto tmp = *this; ++(*this); return tmp; }
+
+	bool operator==(const basic_iterator &other) const { return this->_index == other._index; }
+
+private:
+	slab_type *_slab  = nullptr;
+	size_t     _index = 0;
+};
+
+
 /*
  * slab_memory::_alloc_page - allocate a new page
  */
@@ -139,9 +241,7 @@ template <typename T>
 void
 slab_memory<T>::_alloc_page()
 {
-	auto page = new memory_type();
-	page->resize(this->_stats.page_size);
-	this->pages.push_back(page);
+	this->pages.push_back(new page_type(this->_stats.page_size));
 
 	// update stats and maintenance
 	this->_stats.page_count += 1;
@@ -178,19 +278,272 @@ slab_memory<T>::~slab_memory()
 
 
 /*
- * slab_memory::_get_item - get the item for a given index
+ * slab_memory::_value - get the value for a given index
  */
 template <typename T>
-auto
-slab_memory<T>::_get_item(size_t index) -> item_type&
+T&
+slab_memory<T>::_value(size_t index)
+{
+	return this->pages[index / this->_stats.page_size]->values[index % this->_stats.page_size];
+}
+
+template <typename T>
+const T&
+slab_memory<T>::_value(size_t index) const
+{
+	return this->pages[index / this->_stats.page_size]->values[index % this->_stats.page_size];
+}
+
+
+/*
+ * slab_memory::_ref_count - get the reference count for a given index
+ */
+template <typename T>
+size_t&
+slab_memory<T>::_ref_count(size_t index)
+{
+	return this->pages[index / this->_stats.page_size]->ref_counts[index % this->_stats.page_size];
+}
+
+template <typename T>
+size_t
+slab_memory<T>::_ref_count(size_t index) const
+{
+	return this->pages[index / this->_stats.page_size]->ref_counts[index % this->_stats.page_size];
+}
+
+
+/*
+ * slab_memory::_set_occupied - mark an item as used or free in the bitmap
+ */
+template <typename T>
+void
+slab_memory<T>::_set_occupied(size_t index, bool occupied)
 {
-	const size_t page_index  = index / this->_stats.page_size;
 	const size_t page_offset = index % this->_stats.page_size;
-	memory_type& page  = *this->pages[page_index];
-	item_type& item    = page[page_offset];
-	return item;
+	std::uint64_t &word = this->pages[index / this->_stats.page_size]->occupied[page_offset / 64];
+	const std::uint64_t mask = std::uint64_t(1) << (page_offset % 64);
+	if (occupied)
+		word |= mask;
+	else
+		word &= ~mask;
+}
+
+
+/*
+ * slab_memory::_next_live - get the first live index >= index
+ *
+ * Returns _last_index if there is no such item.
+ */
+template <typename T>
+size_t
+slab_memory<T>::_next_live(size_t index) const
+{
+	const size_t page_size = this->_stats.page_size;
+	const size_t n_words   = (page_size + 63) / 64;
+
+	while (index < this->_last_index) {
+		const size_t page_index  = index / page_size;
+		const size_t page_offset = index % page_size;
+		const auto  &bitmap      = this->pages[page_index]->occupied;
+
+		// mask out everything below the offset within the first word
+		size_t w = page_offset / 64;
+		std::uint64_t word = bitmap[w] & (~std::uint64_t(0) << (page_offset % 64));
+		while (word == 0 && ++w < n_words)
+			word = bitmap[w];
+
+		if (word != 0) {
+			const size_t result = page_index * page_size + w * 64 + std::countr_zero(word);
+			return result < this->_last_index ? result : this->_last_index;
+		}
+		index = (page_index + 1) * page_size;
+	}
+	return this->_last_index;
+}
+
+
+/*
+ * slab_memory::compact - move all live items to the front of the memory
+ *
+ * Live items keep their relative order and are moved into the lowest indexes,
+ * and pages which are no longer needed are released. The result maps each old
+ * index to the new one, or to an empty optional for items that weren't in use.
+ * After compaction, all indexes held elsewhere must be translated with this
+ * map, and pointers to values become invalid.
+ */
+template <typename T>
+auto
+slab_memory<T>::compact() -> std::vector<optional<index_type>>
+{
+	std::vector<optional<index_type>> remap(this->_last_index);
+
+	size_t n_live = 0;
+	for (size_t i = this->_next_live(0); i < this->_last_index; i = this->_next_live(i + 1)) {
+		const size_t j = n_live++;
+		remap[i] = j;
+		if (i == j)
+			continue;
+
+		this->_value(j)     = std::move(this->_value(i));
+		this->_ref_count(j) = this->_ref_count(i);
+		this->_ref_count(i) = 0;
+		this->_set_occupied(j, true);
+		this->_set_occupied(i, false);
+	}
+	this->_last_index = n_live;
+	this->_free_indexes.clear();
+
+	// release pages that are not needed anymore, but keep at least one
+	const size_t n_pages = std::max<size_t>(1, (n_live + this->_stats.page_size - 1) / this->_stats.page_size);
+	while (this->pages.size() > n_pages) {
+		delete this->pages.back();
+		this->pages.pop_back();
+		this->_stats.page_count -= 1;
+		this->_stats.capacity   -= this->_stats.page_size;
+	}
+	this->_stats.size = n_live;
+	return remap;
+}
+
+
+/*
+ * slab_memory::checkpoint_size - number of bytes of a raw snapshot
+ *
+ * The snapshot consists of a header with the page size, page count, last
+ * index, and number of free indexes, followed by the statistics, the pages
+ * (values, reference counts, occupancy bitmap), and the free indexes.
+ */
+template <typename T>
+size_t
+slab_memory<T>::checkpoint_size() const
+{
+	static_assert(std::is_trivially_copyable_v<T>, "slab_memory checkpoints require a trivially copyable T");
+
+	const size_t page_size = this->_stats.page_size;
+	const size_t page_bytes = page_size * (sizeof(T) + sizeof(size_t))
+	                        + ((page_size + 63) / 64) * sizeof(std::uint64_t);
+	return 4 * sizeof(std::uint64_t)
+	     + sizeof(slab_memory_stats)
+	     + this->pages.size() * page_bytes
+	     + this->_free_indexes.size() * sizeof(index_type);
 }
 
+
+/*
+ * slab_memory::checkpoint_save - write a raw snapshot to dst
+ *
+ * dst must provide checkpoint_size() bytes.
+ */
+template <typename T>
+void
+slab_memory<T>::checkpoint_save(std::byte *dst) const
+{
+	static_assert(std::is_trivially_copyable_v<T>, "slab_memory checkpoints require a trivially copyable T");
+
+	auto put = [&dst](const void *src, size_t n) {
+		if (n) std::memcpy(dst, src, n);
+		dst += n;
+	};
+
+	const std::uint64_t header[4] = {
+		this->_stats.page_size,
+		this->pages.size(),
+		this->_last_index,
+		this->_free_indexes.size(),
+	};
+	put(header, sizeof(header));
+	put(&this->_stats, sizeof(slab_memory_stats));
+	for (const auto *page : this->pages) {
+		put(page->values.data(),     page->values.size()     * sizeof(T));
+		put(page->ref_counts.data(), page->ref_counts.size() * sizeof(size_t));
+		put(page->occupied.data(),   page->occupied.size()   * sizeof(std::uint64_t));
+	}
+	put(this->_free_indexes.data(), this->_free_indexes.size() * sizeof(index_type));
+}
+
+
+/*
+ * slab_memory::checkpoint_load - replace the memory by a raw snapshot
+ *
+ * The page size of the snapshot takes precedence over the current one.
+ * Returns false and leaves the memory untouched if the snapshot is malformed.
+ */
+template <typename T>
+bool
+slab_memory<T>::checkpoint_load(const std::byte *src, size_t size)
+{
+	static_assert(std::is_trivially_copyable_v<T>, "slab_memory checkpoints require a trivially copyable T");
+
+	std::uint64_t header[4];
+	if (size < sizeof(header) + sizeof(slab_memory_stats))
+		return false;
+	std::memcpy(header, src, sizeof(header));
+
+	const size_t page_size = header[0];
+	const size_t n_pages   = header[1];
+	const size_t n_words   = (page_size + 63) / 64;
+	const size_t n_free    = header[3];
+
+	// all sizes are checked against the size of the snapshot before they are
+	// multiplied, so that none of the products below can overflow
+	const size_t body = size - sizeof(header) - sizeof(slab_memory_stats);
+	if (page_size == 0 || n_pages == 0 || page_size > body / (sizeof(T) + sizeof(size_t)))
+		return false;
+	const size_t page_bytes = page_size * (sizeof(T) + sizeof(size_t)) + n_words * sizeof(std::uint64_t);
+	if (n_pages > body / page_bytes)
+		return false;
+	const size_t capacity = n_pages * page_size;
+	if (header[2] > capacity || n_free > (body - n_pages * page_bytes) / sizeof(index_type))
+		return false;
+	if (body != n_pages * page_bytes + n_free * sizeof(index_type))
+		return false;
+
+	// released items must refer to slots within the snapshot
+	const std::byte *free_src = src + sizeof(header) + sizeof(slab_memory_stats) + n_pages * page_bytes;
+	for (size_t i = 0; i < n_free; i++) {
+		index_type index;
+		std::memcpy(&index, free_src + i * sizeof(index_type), sizeof(index_type));
+		if (index >= capacity)
+			return false;
+	}
+
+	auto get = [&src](void *dst, size_t n) {
+		if (n) std::memcpy(dst, src, n);
+		src += n;
+	};
+	src += sizeof(header);
+
+	// pages of a different size cannot be reused
+	if (page_size != this->_stats.page_size) {
+		for (auto *page : this->pages)
+			delete page;
+		this->pages.clear();
+	}
+	while (this->pages.size() > n_pages) {
+		delete this->pages.back();
+		this->pages.pop_back();
+	}
+	while (this->pages.size() < n_pages)
+		this->pages.push_back(new page_type(page_size));
+
+	get(&this->_stats, sizeof(slab_memory_stats));
+	for (auto *page : this->pages) {
+		get(page->values.data(),     page_size * sizeof(T));
+		get(page->ref_counts.data(), page_size * sizeof(size_t));
+		get(page->occupied.data(),   n_words   * sizeof(std::uint64_t));
+	}
+	this->_free_indexes.resize(n_free);
+	get(this->_free_indexes.data(), n_free * sizeof(index_type));
+
+	this->_last_index       = header[2];
+	this->_stats.page_size  = page_size;
+	this->_stats.page_count = n_pages;
+	this->_stats.capacity   = capacity;
+	return true;
+}
+
+
 /*
  * slab_memory::get - get const pointer to value of certain memory location
  *
@@ -207,9 +560,8 @@ slab_memory<T>::get(const optional<slab_memory_index_t> index) -> optional<T * c
 	if (!index)
 		return {};
 
-	item_type &mem_item = this->_get_item(index.value());
-	std::optional<T*> result = &mem_item.value;
-	if (mem_item.ref_count <= 0) {
+	std::optional<T*> result = &this->_value(index.value());
+	if (this->_ref_count(index.value()) <= 0) {
 		log_warning("slab_memory::get_ptr() on memory with refcount <= 0.");
 		// TODO: this should probably return an empty, and not the
 		// negative-refcount element in the memory
@@ -228,15 +580,14 @@ slab_memory<T>::set(const optional<slab_memory_index_t> index, T&& value)
 	if (!index)
 		return;
 
-	item_type& item = this->_get_item(index.value());
-	item.value = std::move(value);
+	this->_value(index.value()) = std::move(value);
 }
 
 
 /*
  * slab_memory::alloc - Get a pointer to a new memory item
  *
- * Returns a pointer to a slab_memory_item. The memory used for the memory can be
+ * Returns the index of a new memory item. The memory used for the memory can be
  * either newly allocated, or re-used memory of a prior memory whose reference
  * count dropped to 0.
  */
@@ -249,9 +600,9 @@ slab_memory<T>::alloc() -> optional<index_type>
 
 	// re-use memory that was freed in a previous run, or use last slab space element?
 	if (this->_free_indexes.size() > 0) {
-		// grab the first ID in the list
-		index = this->_free_indexes.front();
-		this->_free_indexes.pop_front();
+		// grab the most recently released ID
+		index = this->_free_indexes.back();
+		this->_free_indexes.pop_back();
 		this->_stats.total_reused += 1;
 
 		log_verbose("    repurposed id = ", index.value(), "\n");
@@ -268,9 +619,8 @@ slab_memory<T>::alloc() -> optional<index_type>
 	log_verbose( "    memory size = ", this->capacity(), "\n");
 
 	// ref-counting and statistics
-	item_type &item = this->_get_item(index.value());
-	item.index      = index;
-	item.ref_count  = 1;
+	this->_ref_count(index.value()) = 1;
+	this->_set_occupied(index.value(), true);
 
 	// update stats
 	this->_stats.total_allocated += 1;
@@ -289,8 +639,14 @@ template <typename T>
 auto
 slab_memory<T>::calloc(size_t N) -> std::vector<optional<index_type>>
 {
-	// TODO: this needs a better implementation than this for loop
 	std::vector<optional<index_type>> result;
+	result.reserve(N);
+
+	// allocate all pages that will be required up front
+	const size_t n_new = N > this->_free_indexes.size() ? N - this->_free_indexes.size() : 0;
+	while (this->_last_index + n_new > this->capacity())
+		this->_alloc_page();
+
 	for (size_t i = 0; i < N; ++i)
 		result.emplace_back(this->alloc());
 	return result;
@@ -325,10 +681,10 @@ slab_memory<T>::free(optional<index_type> index) -> optional<size_t>
 	}
 	log_verbose("    id = ", index.value(), "\n");
 
-	item_type &item = this->_get_item(index.value());
-	size_t ref_count = item.ref_count;
+	size_t &item_ref_count = this->_ref_count(index.value());
+	size_t ref_count = item_ref_count;
 	if (ref_count > 0) {
-		ref_count = --(item.ref_count);
+		ref_count = --item_ref_count;
 		if (ref_count == 0)
 			this->_release(index);
 	}
@@ -342,6 +698,54 @@ slab_memory<T>::free(optional<index_type> index) -> optional<size_t>
 }
 
 
+/*
+ * slab_memory::free - free all memory items within [first, last)
+ *
+ * This is the same as calling free on each item individually, and returns the
+ * number of items which were released, i.e. whose reference count dropped to
+ * 0. The iterators can refer to either index_type or optional<index_type>.
+ */
+template <typename T>
+template <typename InputIt>
+size_t
+slab_memory<T>::free(InputIt first, InputIt last)
+{
+	size_t n_released = 0;
+	for (; first != last; ++first) {
+		const optional<index_type> index = *first;
+		if (!index) {
+			this->_stats.invalid_freed += 1;
+			continue;
+		}
+
+		this->_stats.total_freed += 1;
+		size_t &ref_count = this->_ref_count(index.value());
+		if (ref_count == 0) {
+			log_warning("slab_memory::free called on item with ref_count <= 0\n");
+			continue;
+		}
+		if (--ref_count == 0) {
+			this->_release(index);
+			n_released += 1;
+		}
+	}
+	return n_released;
+}
+
+
+/*
+ * slab_memory::free - free all memory items of a vector
+ *
+ * For details, see slab_memory::free(first, last).
+ */
+template <typename T>
+size_t
+slab_memory<T>::free(const std::vector<optional<index_type>> &indexes)
+{
+	return this->free(indexes.begin(), indexes.end());
+}
+
+
 /*
  * slab_memory::incref - increment the reference count of a memory.
  *
@@ -358,7 +762,7 @@ slab_memory<T>::incref(const optional<index_type> index) -> optional<size_t>
 		return {};
 	}
 	this->_stats.total_incref += 1;
-	return ++(this->memory[index.value()].ref_count);
+	return ++(this->_ref_count(index.value()));
 }
 
 
@@ -409,19 +813,17 @@ slab_memory<T>::copy(const optional<slab_memory_index_t> index) -> optional<inde
 	if (!new_index)
 		return {};
 
-	item_type &new_item = this->_get_item(new_index.value());
-	item_type &origin   = this->_get_item(index.value());
+	T &new_value = this->_value(new_index.value());
+	T &origin    = this->_value(index.value());
 
 	log_verbose("slab_memory<T>::copy\n");
 	log_verbose("    origin id        = ", index.value(), "\n");
-	log_verbose("    origin ptr       = ", reinterpret_cast<const void*>(&origin), "\n");
-	log_verbose("    origin value ptr = ", reinterpret_cast<const void*>(&origin.value), "\n");
+	log_verbose("    origin value ptr = ", reinterpret_cast<const void*>(&origin), "\n");
 	log_verbose("    elem id          = ", new_index.value(), "\n");
-	log_verbose("    elem ptr         = ", reinterpret_cast<const void*>(&new_item), "\n");
-	log_verbose("    elem value ptr   = ", reinterpret_cast<const void*>(&new_item.value), "\n");
+	log_verbose("    elem value ptr   = ", reinterpret_cast<const void*>(&new_value), "\n");
 
 	// rely on operator= for the contained value type
-	new_item.value = origin.value;
+	new_value = origin;
 	return new_index;
 }
 
@@ -444,12 +846,12 @@ slab_memory<T>::_release(const optional<slab_memory_index_t> index)
 
 	// push the ID into the list of free items
 	this->_free_indexes.push_back(index.value());
-	item_type &item = this->_get_item(index.value());
-	item.index     = {};
-	item.ref_count = 0;
+	this->_ref_count(index.value()) = 0;
+	this->_set_occupied(index.value(), false);
 
 	// additional statistics
 	this->_stats.real_released += 1;
+	this->_stats.size = this->_last_index - this->_free_indexes.size();
 }
 
 /*
@@ -462,6 +864,465 @@ slab_memory<T>::stats
 */
 
 
+/*
+ * concurrent_slab_memory - a slab memory for several threads
+ *
+ * The memory is used by a fixed number of workers, each of which is
+ * identified by an index in [0, n_workers), e.g. the worker index that
+ * ncr::thread_pool passes to its tasks. Each worker has its own cache with a
+ * stack of free slots and a range of never used slots on the page it claimed
+ * last. Claiming a new page only requires an atomic increment of the global
+ * page counter, and the page table has a fixed size, so that pages never
+ * move. Hence, neither alloc nor free take a lock.
+ *
+ * Each page belongs to the worker that claimed it. Slots which are released
+ * by another worker are pushed onto the owner's remote-free stack (lock-free,
+ * multiple producers, single consumer), and the owner takes them back once
+ * its local free stack ran empty.
+ *
+ * Reference counts are atomic, because consumers on different threads might
+ * hold references to the same item. Statistics, on the other hand, are kept
+ * per worker without any atomics, and stats() aggregates them on demand. The
+ * result is only exact if no worker is active at the time.
+ *
+ * Note: a worker index must only be used by one thread at a time.
+ */
+template <typename T>
+struct concurrent_slab_memory
+{
+	using index_type = slab_memory_index_t;
+	template <typename ValueType> using optional = std::optional<ValueType>;
+
+	static constexpr size_t default_max_pages = 4096;
+
+	optional<index_type>    alloc(unsigned worker);
+	optional<size_t>        free(unsigned worker, optional<index_type> index);
+	optional<size_t>        incref(unsigned worker, const optional<index_type> index);
+	optional<size_t>        decref(unsigned worker, const optional<index_type> index);
+
+	optional<T * const>     get(const optional<index_type> index);
+
+	size_t                  n_workers()  const { return this->_n_workers; };
+	size_t                  capacity()   const { return this->page_count() * this->_page_size; };
+	size_t                  page_count() const;
+	size_t                  page_size()  const { return this->_page_size; };
+	size_t                  size()       const { return this->stats().size; };
+	slab_memory_stats       stats()      const;
+
+	concurrent_slab_memory(
+			const unsigned n_workers,
+			const size_t page_size = slab_memory_default_page_size,
+			const size_t max_pages = default_max_pages);
+	~concurrent_slab_memory();
+
+	concurrent_slab_memory(const concurrent_slab_memory&) = delete;
+	concurrent_slab_memory& operator=(const concurrent_slab_memory&) = delete;
+
+private:
+	static constexpr index_type npos = ~index_type(0);
+
+	struct page_type {
+		std::vector<T>                   values;
+		std::unique_ptr<std::atomic<size_t>[]> ref_counts;
+		std::vector<index_type>          next;   // links of the remote-free stack
+		unsigned                         owner;
+
+		page_type(size_t page_size, unsigned owner)
+		: values(page_size), ref_counts(new std::atomic<size_t>[page_size]), next(page_size, npos), owner(owner)
+		{
+			for (size_t i = 0; i < page_size; i++)
+				this->ref_counts[i].store(0, std::memory_order_relaxed);
+		}
+	};
+
+	// per-worker state, on separate cache lines to avoid false sharing
+	struct alignas(64) cache_type {
+		std::vector<index_type>          free_indexes;
+		index_type                       bump_next = 0;
+		index_type                       bump_end  = 0;
+		std::atomic<index_type>          remote_head{npos};
+		slab_memory_stats                stats;
+	};
+
+	page_type&              _page(index_type index) const;
+	std::atomic<size_t>&    _ref_count(index_type index) const;
+	void                    _release(unsigned worker, index_type index);
+	bool                    _claim_page(unsigned worker);
+
+	const unsigned          _n_workers;
+	const size_t            _page_size;
+	const size_t            _max_pages;
+
+	// global page table. _n_pages counts claimed pages, some of which might not
+	// be published in the table yet
+	std::unique_ptr<std::atomic<page_type*>[]> _pages;
+	std::atomic<size_t>     _n_pages{0};
+
+	std::unique_ptr<cache_type[]> _caches;
+};
+
+
+/*
+ * concurrent_slab_memory::concurrent_slab_memory - initialize the memory
+ *
+ * Pages are claimed lazily by the workers which allocate from the memory.
+ */
+template <typename T>
+concurrent_slab_memory<T>::concurrent_slab_memory(
+		const unsigned n_workers,
+		const size_t page_size,
+		const size_t max_pages)
+: _n_workers(n_workers > 0 ? n_workers : 1)
+, _page_size(page_size > 0 ? page_size : slab_memory_default_page_size)
+, _max_pages(max_pages > 0 ? max_pages : default_max_pages)
+, _pages(new std::atomic<page_type*>[_max_pages])
+, _caches(new cache_type[_n_workers])
+{
+	for (size_t i = 0; i < this->_max_pages; i++)
+		this->_pages[i].store(nullptr, std::memory_order_relaxed);
+	for (unsigned w = 0; w < this->_n_workers; w++)
+		this->_caches[w].stats.page_size = this->_page_size;
+}
+
+
+/*
+ * concurrent_slab_memory::~concurrent_slab_memory - release all pages
+ */
+template <typename T>
+concurrent_slab_memory<T>::~concurrent_slab_memory()
+{
+	for (size_t i = 0; i < this->_max_pages; i++)
+		delete this->_pages[i].load(std::memory_order_acquire);
+}
+
+
+template <typename T>
+auto
+concurrent_slab_memory<T>::_page(index_type index) const -> page_type&
+{
+	// the index was handed out after the page was published, so the page must
+	// exist
+	return *this->_pages[index / this->_page_size].load(std::memory_order_acquire);
+}
+
+
+template <typename T>
+std::atomic<size_t>&
+concurrent_slab_memory<T>::_ref_count(index_type index) const
+{
+	return this->_page(index).ref_counts[index % this->_page_size];
+}
+
+
+/*
+ * concurrent_slab_memory::_claim_page - get a fresh page for a worker
+ */
+template <typename T>
+bool
+concurrent_slab_memory<T>::_claim_page(unsigned worker)
+{
+	const size_t page_index = this->_n_pages.fetch_add(1, std::memory_order_relaxed);
+	if (page_index >= this->_max_pages) {
+		this->_n_pages.fetch_sub(1, std::memory_order_relaxed);
+		return false;
+	}
+
+	this->_pages[page_index].store(new page_type(this->_page_size, worker), std::memory_order_release);
+
+	cache_type &cache = this->_caches[worker];
+	cache.bump_next = page_index * this->_page_size;
+	cache.bump_end  = cache.bump_next + this->_page_size;
+	return true;
+}
+
+
+/*
+ * concurrent_slab_memory::page_count - number of pages claimed by all workers
+ */
+template <typename T>
+size_t
+concurrent_slab_memory<T>::page_count() const
+{
+	return std::min(this->_n_pages.load(std::memory_order_relaxed), this->_max_pages);
+}
+
+
+/*
+ * concurrent_slab_memory::alloc - allocate a new item on behalf of a worker
+ *
+ * Slots are taken from the worker's own free stack first, then from its
+ * remote-free stack, then from the page the worker claimed last, and only then
+ * from a new page.
+ */
+template <typename T>
+auto
+concurrent_slab_memory<T>::alloc(unsigned worker) -> optional<index_type>
+{
+	assert(worker < this->_n_workers);
+	cache_type &cache = this->_caches[worker];
+
+	// take back everything that other workers released
+	if (cache.free_indexes.empty()) {
+		index_type index = cache.remote_head.exchange(npos, std::memory_order_acquire);
+		while (index != npos) {
+			cache.free_indexes.push_back(index);
+			index = this->_page(index).next[index % this->_page_size];
+		}
+	}
+
+	index_type index;
+	if (!cache.free_indexes.empty()) {
+		index = cache.free_indexes.back();
+		cache.free_indexes.pop_back();
+		cache.stats.total_reused += 1;
+	}
+	else {
+		if (cache.bump_next == cache.bump_end && !this->_claim_page(worker)) {
+			log_error("concurrent_slab_memory::alloc: out of pages (max_pages = ", this->_max_pages, ")\n");
+			return {};
+		}
+		index = cache.bump_next++;
+		cache.stats.real_allocated += 1;
+	}
+
+	this->_ref_count(index).store(1, std::memory_order_relaxed);
+	cache.stats.total_allocated += 1;
+	return index;
+}
+
+
+/*
+ * concurrent_slab_memory::_release - return a slot to its owner
+ */
+template <typename T>
+void
+concurrent_slab_memory<T>::_release(unsigned worker, index_type index)
+{
+	page_type &page = this->_page(index);
+	this->_caches[worker].stats.real_released += 1;
+
+	if (page.owner == worker) {
+		this->_caches[worker].free_indexes.push_back(index);
+		return;
+	}
+
+	// push onto the owner's remote-free stack. Only the owner pops, and it
+	// always takes the entire stack, so there's no ABA problem
+	std::atomic<index_type> &head = this->_caches[page.owner].remote_head;
+	index_type &next = page.next[index % this->_page_size];
+	next = head.load(std::memory_order_relaxed);
+	while (!head.compare_exchange_weak(next, index, std::memory_order_release, std::memory_order_relaxed))
+		;
+}
+
+
+/*
+ * concurrent_slab_memory::free - decrement the reference count of an item
+ *
+ * If the reference count drops to zero, the item is released. See
+ * slab_memory::free for details.
+ */
+template <typename T>
+auto
+concurrent_slab_memory<T>::free(unsigned worker, optional<index_type> index) -> optional<size_t>
+{
+	assert(worker < this->_n_workers);
+	cache_type &cache = this->_caches[worker];
+	if (!index) {
+		log_warning("call to concurrent_slab_memory::free with invalid index\n");
+		cache.stats.invalid_freed += 1;
+		return {};
+	}
+	cache.stats.total_freed += 1;
+
+	std::atomic<size_t> &ref_count = this->_ref_count(index.value());
+	size_t current = ref_count.load(std::memory_order_relaxed);
+	do {
+		if (current == 0) {
+			log_warning("concurrent_slab_memory::free called on item with ref_count <= 0\n");
+			return 0;
+		}
+	} while (!ref_count.compare_exchange_weak(current, current - 1, std::memory_order_acq_rel, std::memory_order_relaxed));
+
+	if (current == 1)
+		this->_release(worker, index.value());
+	return current - 1;
+}
+
+
+/*
+ * concurrent_slab_memory::incref - increment the reference count of an item
+ *
+ * The caller must already hold a reference to the item. The statistics are
+ * accounted to the calling worker.
+ */
+template <typename T>
+auto
+concurrent_slab_memory<T>::incref(unsigned worker, const optional<index_type> index) -> optional<size_t>
+{
+	assert(worker < this->_n_workers);
+	if (!index) {
+		this->_caches[worker].stats.invalid_incref += 1;
+		return {};
+	}
+	this->_caches[worker].stats.total_incref += 1;
+	return this->_ref_count(index.value()).fetch_add(1, std::memory_order_relaxed) + 1;
+}
+
+
+/*
+ * concurrent_slab_memory::decref - decrement the reference count of an item
+ */
+template <typename T>
+auto
+concurrent_slab_memory<T>::decref(unsigned worker, const optional<index_type> index) -> optional<size_t>
+{
+	assert(worker < this->_n_workers);
+	if (!index) {
+		this->_caches[worker].stats.invalid_decref += 1;
+		return {};
+	}
+	this->_caches[worker].stats.total_decref += 1;
+	return this->free(worker, index);
+}
+
+
+/*
+ * concurrent_slab_memory::get - get a pointer to the value of an item
+ */
+template <typename T>
+auto
+concurrent_slab_memory<T>::get(const optional<index_type> index) -> optional<T * const>
+{
+	if (!index)
+		return {};
+	return &this->_page(index.value()).values[index.value() % this->_page_size];
+}
+
+
+/*
+ * concurrent_slab_memory::stats - aggregate the statistics of all workers
+ */
+template <typename T>
+slab_memory_stats
+concurrent_slab_memory<T>::stats() const
+{
+	slab_memory_stats result;
+	result.page_size  = this->_page_size;
+	result.page_count = this->page_count();
+	result.capacity   = this->capacity();
+
+	for (unsigned w = 0; w < this->_n_workers; w++) {
+		const auto &s = this->_caches[w].stats;
+		result.real_allocated   += s.real_allocated;
+		result.real_released    += s.real_released;
+		result.total_allocated  += s.total_allocated;
+		result.total_freed      += s.total_freed;
+		result.invalid_released += s.invalid_released;
+		result.invalid_freed    += s.invalid_freed;
+		result.total_reused     += s.total_reused;
+		result.invalid_decref   += s.invalid_decref;
+		result.invalid_incref   += s.invalid_incref;
+		result.total_incref     += s.total_incref;
+		result.total_decref     += s.total_decref;
+	}
+	result.size = result.total_allocated - result.real_released;
+	return result;
+}
+
+
+/*
+ * arena_memory - a paged bump allocator for objects of type T
+ *
+ * In contrast to slab_memory, an arena does not track individual items. It
+ * simply hands out the next free item, and all items are released at once by
+ * calling reset(). This is useful for objects that share the same lifetime,
+ * for instance all states and transitions of an FSM, or all FSMs of one
+ * generation of an evolutionary run.
+ *
+ * Like the slab memory, the arena stores the items in pages, so that pointers
+ * to items remain valid until the arena is reset or destroyed. Pages are kept
+ * after a reset and re-used during subsequent calls to alloc.
+ *
+ * Note: items are recycled and not re-constructed during alloc. That is, an
+ *       item might still contain the values that it had before the last reset.
+ *       The caller is expected to initialize all members of the item. The
+ *       advantage is that members which themselves hold memory, e.g. vectors,
+ *       keep their capacity and will not allocate again when they are cleared
+ *       and refilled.
+ */
+template <typename T>
+struct arena_memory
+{
+	using memory_type = std::vector<T>;
+	using page_type   = std::vector<memory_type*>;
+
+	T*                      alloc();
+	void                    reset() { this->_size = 0; };
+
+	size_t                  capacity()   const { return this->pages.size() * this->_page_size; };
+	size_t                  size()       const { return this->_size; };
+	size_t                  page_count() const { return this->pages.size(); };
+	size_t                  page_size()  const { return this->_page_size; };
+
+	arena_memory(const size_t page_size = slab_memory_default_page_size);
+	~arena_memory();
+
+	// arenas hand out pointers to their items, so they must not be copied
+	arena_memory(const arena_memory&) = delete;
+	arena_memory& operator=(const arena_memory&) = delete;
+
+private:
+	page_type               pages;
+	size_t                  _size = 0;
+	size_t                  _page_size;
+};
+
+
+/*
+ * arena_memory::arena_memory - initialize a new arena
+ *
+ * Pages will be allocated lazily during the first call to alloc.
+ */
+template <typename T>
+arena_memory<T>::arena_memory(const size_t page_size)
+	: _page_size(page_size > 0 ? page_size : slab_memory_default_page_size)
+{}
+
+
+/*
+ * arena_memory::~arena_memory - release an arena and all its pages
+ */
+template <typename T>
+arena_memory<T>::~arena_memory()
+{
+	for (size_t i = 0; i < this->pages.size(); ++i) {
+		delete this->pages[i];
+		this->pages[i] = nullptr;
+	}
+}
+
+
+/*
+ * arena_memory::alloc - get a pointer to the next free item of the arena
+ */
+template <typename T>
+T*
+arena_memory<T>::alloc()
+{
+	if (this->_size >= this->capacity()) {
+		auto page = new memory_type();
+		page->resize(this->_page_size);
+		this->pages.push_back(page);
+	}
+
+	const size_t page_index  = this->_size / this->_page_size;
+	const size_t page_offset = this->_size % this->_page_size;
+	this->_size += 1;
+	return &(*this->pages[page_index])[page_offset];
+}
+
+
 /*
  * slab_memory_get - get pointer to a certain memory.
  *
@@ -15,6 +15,11 @@
 #include <string>
 #include <cmath>
 #include <functional>
+#include <vector>
+#include <cstdint>
+#include <array>
+#include <span>
+#include <algorithm>
 
 #include <ncr/ncr_log.hpp>
 #include <ncr/ncr_units.hpp>
@@ -258,6 +263,141 @@ integrate(
 }
 
 
+/*
+ * Population - structure-of-arrays storage for N Izhikevich neurons
+ *
+ * Each state variable and each parameter is kept in its own contiguous array,
+ * so that step() below can update all neurons in a single branch free loop
+ * which the compiler can auto-vectorize. Spike flags are stored as bytes,
+ * because std::vector<bool> cannot be vectorized.
+ *
+ * Note that GCC only if-converts (and thus vectorizes) the after-spike reset
+ * with -fno-trapping-math, which is implied by -ffast-math.
+ */
+template <typename T = double>
+struct Population
+{
+	// state variables
+	std::vector<T>            v;
+	std::vector<T>            u;
+	std::vector<T>            v_reported;
+	std::vector<std::uint8_t> spiking;
+
+	// parameters (see Params for details)
+	std::vector<T>            a;
+	std::vector<T>            b;
+	std::vector<T>            c;
+	std::vector<T>            d;
+	std::vector<T>            thresh;
+};
+
+
+template <typename T>
+inline size_t
+population_size(const Population<T> &pop)
+{
+	return pop.v.size();
+}
+
+
+/*
+ * population_add - append a neuron to a population
+ */
+template <typename T>
+inline void
+population_add(Population<T> &pop, const Neuron<T> &n)
+{
+	pop.v.push_back(n.state.v[0]);
+	pop.u.push_back(n.state.v[1]);
+	pop.v_reported.push_back(n.state.v_reported);
+	pop.spiking.push_back(n.state.spiking);
+
+	pop.a.push_back(n.params.a);
+	pop.b.push_back(n.params.b);
+	pop.c.push_back(n.params.c);
+	pop.d.push_back(n.params.d);
+	pop.thresh.push_back(n.params.thresh);
+}
+
+
+/*
+ * make_population - create a population of N neurons of the same type
+ */
+template <typename T = double>
+inline Population<T>
+make_population(size_t N, std::string type)
+{
+	const Params<T> params = get_default_params<T>(type);
+
+	Population<T> pop;
+	pop.v.assign(N, params.V0);
+	pop.u.assign(N, params.b * params.V0);
+	pop.v_reported.assign(N, params.V0);
+	pop.spiking.assign(N, 0);
+
+	pop.a.assign(N, params.a);
+	pop.b.assign(N, params.b);
+	pop.c.assign(N, params.c);
+	pop.d.assign(N, params.d);
+	pop.thresh.assign(N, params.thresh);
+	return pop;
+}
+
+
+/*
+ * step - advance all neurons of a population by one RK2 step
+ *
+ * Iext must point to population_size(pop) input values, which are held
+ * constant during the step. Apart from that, this computes the same as the
+ * single neuron step() with odesolve_step_rk2.
+ */
+template <typename T>
+inline void
+step(
+		Population<T> &pop,
+		T &t,
+		const T dt,
+		const T *Iext)
+{
+	const size_t N = population_size(pop);
+
+	T *v           = pop.v.data();
+	T *u           = pop.u.data();
+	T *v_reported  = pop.v_reported.data();
+	std::uint8_t *spiking = pop.spiking.data();
+
+	const T *a      = pop.a.data();
+	const T *b      = pop.b.data();
+	const T *c      = pop.c.data();
+	const T *d      = pop.d.data();
+	const T *thresh = pop.thresh.data();
+
+	NCR_IVDEP
+	for (size_t i = 0; i < N; i++) {
+		const T v0 = v[i], u0 = u[i], I = Iext[i];
+
+		const T k1v = dt * (T(0.04)*v0*v0 + T(5.0)*v0 + T(140.0) - u0 + I);
+		const T k1u = dt * (a[i] * (b[i]*v0 - u0));
+
+		const T v1 = v0 + k1v, u1 = u0 + k1u;
+		const T k2v = dt * (T(0.04)*v1*v1 + T(5.0)*v1 + T(140.0) - u1 + I);
+		const T k2u = dt * (a[i] * (b[i]*v1 - u1));
+
+		const T vn = v0 + T(0.5) * (k1v + k2v);
+		const T un = u0 + T(0.5) * (k1u + k2u);
+
+		// after-spike reset without branches
+		const T u_spike = un + d[i];
+		const bool spike = vn > thresh[i];
+		v[i]          = spike ? c[i]      : vn;
+		u[i]          = spike ? u_spike   : un;
+		v_reported[i] = spike ? thresh[i] : vn;
+		spiking[i]    = spike;
+	}
+	t += dt;
+}
+
+
 } // Izhikevich::
   // }}}
 
@@ -437,7 +577,9 @@ struct Params
 	// Membrane time constant
 	T tau = 10.0_ms;
 
-	// Adaptation current time constant
+	// Adaptation current time constant. Currently unused: both the single
+	// neuron and the population step relax w with the membrane time constant
+	// tau
 	T tau_w = 30.0_ms;
 };
 
@@ -545,7 +687,7 @@ step(
 	const T
 		V_reset  = n.params.V_reset,
 		V_thresh = n.params.V_thresh,
-		b        = n.params.a;
+		b        = n.params.b;
 
 	// determine if spike or not
 	n.state.spiking = n.state.v[0] >= V_thresh;
@@ -583,6 +725,141 @@ integrate(
 }
 
 
+/*
+ * Population - structure-of-arrays storage for N AdEx neurons
+ *
+ * See Izhikevich::Population for details on the layout. Vectorization of
+ * step() additionally requires a vectorized std::exp, which GCC only uses with
+ * -ffast-math.
+ */
+template <typename T = double>
+struct Population
+{
+	// state variables
+	std::vector<T>            V;
+	std::vector<T>            w;
+	std::vector<std::uint8_t> spiking;
+
+	// parameters (see Params for details)
+	std::vector<T>            V_rest;
+	std::vector<T>            V_reset;
+	std::vector<T>            V_thresh;
+	std::vector<T>            V_ap_thresh;
+	std::vector<T>            delta_t;
+	std::vector<T>            a;
+	std::vector<T>            b;
+	std::vector<T>            R;
+	std::vector<T>            tau;
+};
+
+
+template <typename T>
+inline size_t
+population_size(const Population<T> &pop)
+{
+	return pop.V.size();
+}
+
+
+/*
+ * population_add - append a neuron to a population
+ */
+template <typename T>
+inline void
+population_add(Population<T> &pop, const Neuron<T> &n)
+{
+	pop.V.push_back(n.state.v[0]);
+	pop.w.push_back(n.state.v[1]);
+	pop.spiking.push_back(n.state.spiking);
+
+	pop.V_rest.push_back(n.params.V_rest);
+	pop.V_reset.push_back(n.params.V_reset);
+	pop.V_thresh.push_back(n.params.V_thresh);
+	pop.V_ap_thresh.push_back(n.params.V_ap_thresh);
+	pop.delta_t.push_back(n.params.delta_t);
+	pop.a.push_back(n.params.a);
+	pop.b.push_back(n.params.b);
+	pop.R.push_back(n.params.R);
+	pop.tau.push_back(n.params.tau);
+}
+
+
+/*
+ * make_population - create a population of N neurons with default parameters
+ */
+template <typename T = double>
+inline Population<T>
+make_population(size_t N)
+{
+	Population<T> pop;
+	const Neuron<T> n = make<T>();
+	for (size_t i = 0; i < N; i++)
+		population_add(pop, n);
+	return pop;
+}
+
+
+/*
+ * step - advance all neurons of a population by one RK2 step
+ *
+ * Iext must point to population_size(pop) input values, which are held
+ * constant during the step. The after-spike increment of w is Params::b, and
+ * w relaxes with Params::tau, as in the single neuron step().
+ */
+template <typename T>
+inline void
+step(
+		Population<T> &pop,
+		T &t,
+		const T dt,
+		const T *Iext)
+{
+	const size_t N = population_size(pop);
+
+	T *V = pop.V.data();
+	T *w = pop.w.data();
+	std::uint8_t *spiking = pop.spiking.data();
+
+	const T *V_rest      = pop.V_rest.data();
+	const T *V_reset     = pop.V_reset.data();
+	const T *V_thresh    = pop.V_thresh.data();
+	const T *V_ap_thresh = pop.V_ap_thresh.data();
+	const T *delta_t     = pop.delta_t.data();
+	const T *a           = pop.a.data();
+	const T *b           = pop.b.data();
+	const T *R           = pop.R.data();
+	const T *tau         = pop.tau.data();
+
+	NCR_IVDEP
+	for (size_t i = 0; i < N; i++) {
+		const T V0 = V[i], w0 = w[i], I = Iext[i];
+		const T inv_tau = T(1.0) / tau[i];
+
+		// the products and divisions below associate as in the single neuron
+		// diffeq() and odesolve_step_rk2. The exponential term amplifies any
+		// rounding difference near the spike threshold, which would otherwise
+		// accumulate into diverging spike times
+		const T k1V = dt * (inv_tau * (-(V0 - V_rest[i]) + delta_t[i] * std::exp((V0 - V_ap_thresh[i]) / delta_t[i]) - R[i] * w0 + R[i] * I));
+		const T k1w = dt * (inv_tau * (a[i] * (V0 - V_rest[i]) - w0));
+
+		const T V1 = V0 + k1V, w1 = w0 + k1w;
+		const T k2V = dt * (inv_tau * (-(V1 - V_rest[i]) + delta_t[i] * std::exp((V1 - V_ap_thresh[i]) / delta_t[i]) - R[i] * w1 + R[i] * I));
+		const T k2w = dt * (inv_tau * (a[i] * (V1 - V_rest[i]) - w1));
+
+		const T Vn = V0 + T(0.5) * (k1V + k2V);
+		const T wn = w0 + T(0.5) * (k1w + k2w);
+
+		// after-spike reset without branches
+		const T w_spike = wn + b[i];
+		const bool spike = Vn >= V_thresh[i];
+		V[i]       = spike ? V_reset[i] : Vn;
+		w[i]       = spike ? w_spike    : wn;
+		spiking[i] = spike;
+	}
+	t += dt;
+}
+
+
 } // AdEx::
   // }}}
 
@@ -843,7 +1120,7 @@ diffeq(
 	T Iext = input(t);
 
 	// dynamical system specification
-	dydt[0] = 1.0/tau * ((-y[0] - V_rest) + Iext);
+	dydt[0] = 1.0/tau * (-(y[0] - V_rest) + Iext);
 }
 
 
@@ -880,6 +1157,121 @@ step(
 }
 
 
+/*
+ * Population - structure-of-arrays storage for N Leaky IF neurons
+ *
+ * See Izhikevich::Population for details on the layout.
+ */
+template <typename T = double>
+struct Population
+{
+	// state variables
+	std::vector<T>            V;
+	std::vector<T>            t_last_spike;
+	std::vector<std::uint8_t> spiking;
+
+	// parameters (see Params for details)
+	std::vector<T>            V_rest;
+	std::vector<T>            V_reset;
+	std::vector<T>            V_thresh;
+	std::vector<T>            tau;
+	std::vector<T>            tau_refractory;
+};
+
+
+template <typename T>
+inline size_t
+population_size(const Population<T> &pop)
+{
+	return pop.V.size();
+}
+
+
+/*
+ * population_add - append a neuron to a population
+ */
+template <typename T>
+inline void
+population_add(Population<T> &pop, const Neuron<T> &n)
+{
+	pop.V.push_back(n.state.v[0]);
+	pop.t_last_spike.push_back(n.state.t_last_spike);
+	pop.spiking.push_back(n.state.spiking);
+
+	pop.V_rest.push_back(n.params.V_rest);
+	pop.V_reset.push_back(n.params.V_reset);
+	pop.V_thresh.push_back(n.params.V_thresh);
+	pop.tau.push_back(n.params.tau);
+	pop.tau_refractory.push_back(n.params.tau_refractory);
+}
+
+
+/*
+ * make_population - create a population of N neurons with default parameters
+ */
+template <typename T = double>
+inline Population<T>
+make_population(size_t N)
+{
+	Population<T> pop;
+	const Neuron<T> n = make<T>();
+	for (size_t i = 0; i < N; i++)
+		population_add(pop, n);
+	return pop;
+}
+
+
+/*
+ * step - advance all neurons of a population by one RK2 step
+ *
+ * Iext must point to population_size(pop) input values, which are held
+ * constant during the step. Neurons within their absolute refractory period
+ * are not integrated, as in the single neuron step().
+ */
+template <typename T>
+inline void
+step(
+		Population<T> &pop,
+		T &t,
+		const T dt,
+		const T *Iext)
+{
+	const size_t N = population_size(pop);
+
+	T *V            = pop.V.data();
+	T *t_last_spike = pop.t_last_spike.data();
+	std::uint8_t *spiking = pop.spiking.data();
+
+	const T *V_rest         = pop.V_rest.data();
+	const T *V_reset        = pop.V_reset.data();
+	const T *V_thresh       = pop.V_thresh.data();
+	const T *tau            = pop.tau.data();
+	const T *tau_refractory = pop.tau_refractory.data();
+
+	NCR_IVDEP
+	for (size_t i = 0; i < N; i++) {
+		const T V0 = V[i], I = Iext[i];
+		const T inv_tau = T(1.0) / tau[i];
+
+		const T k1 = dt * inv_tau * (-(V0 - V_rest[i]) + I);
+		const T k2 = dt * inv_tau * (-(V0 + k1 - V_rest[i]) + I);
+		const T Vn = V0 + T(0.5) * (k1 + k2);
+
+		// refractoriness and after-spike reset without branches
+		const T t_last = t_last_spike[i];
+		const T t_refr = t_last - dt;
+
+		const bool refractory = t_last > 0;
+		const bool spike      = !refractory && Vn > V_thresh[i];
+
+		V[i]            = refractory ? V0     : (spike ? V_reset[i]        : Vn);
+		t_last_spike[i] = refractory ? t_refr : (spike ? tau_refractory[i] : t_last);
+		spiking[i]      = spike;
+	}
+	t += dt;
+}
+
+
 
 } // LeakIF::
   // }}}
@@ -1064,6 +1456,131 @@ integrate(
 }
 
 
+/*
+ * Population - structure-of-arrays storage for N Quadratic IF neurons
+ *
+ * See Izhikevich::Population for details on the layout.
+ */
+template <typename T = double>
+struct Population
+{
+	// state variables
+	std::vector<T>            V;
+	std::vector<T>            t_last_spike;
+	std::vector<std::uint8_t> spiking;
+
+	// parameters (see Params for details)
+	std::vector<T>            V_rest;
+	std::vector<T>            V_reset;
+	std::vector<T>            V_thresh;
+	std::vector<T>            V_critical;
+	std::vector<T>            c;
+	std::vector<T>            R;
+	std::vector<T>            tau;
+	std::vector<T>            tau_refractory;
+};
+
+
+template <typename T>
+inline size_t
+population_size(const Population<T> &pop)
+{
+	return pop.V.size();
+}
+
+
+/*
+ * population_add - append a neuron to a population
+ */
+template <typename T>
+inline void
+population_add(Population<T> &pop, const Neuron<T> &n)
+{
+	pop.V.push_back(n.state.v[0]);
+	pop.t_last_spike.push_back(n.state.t_last_spike);
+	pop.spiking.push_back(n.state.spiking);
+
+	pop.V_rest.push_back(n.params.V_rest);
+	pop.V_reset.push_back(n.params.V_reset);
+	pop.V_thresh.push_back(n.params.V_thresh);
+	pop.V_critical.push_back(n.params.V_critical);
+	pop.c.push_back(n.params.c);
+	pop.R.push_back(n.params.R);
+	pop.tau.push_back(n.params.tau);
+	pop.tau_refractory.push_back(n.params.tau_refractory);
+}
+
+
+/*
+ * make_population - create a population of N neurons with default parameters
+ */
+template <typename T = double>
+inline Population<T>
+make_population(size_t N)
+{
+	Population<T> pop;
+	const Neuron<T> n = make<T>();
+	for (size_t i = 0; i < N; i++)
+		population_add(pop, n);
+	return pop;
+}
+
+
+/*
+ * step - advance all neurons of a population by one RK2 step
+ *
+ * Iext must point to population_size(pop) input values, which are held
+ * constant during the step. Neurons within their absolute refractory period
+ * are not integrated, as in the single neuron step().
+ */
+template <typename T>
+inline void
+step(
+		Population<T> &pop,
+		T &t,
+		const T dt,
+		const T *Iext)
+{
+	const size_t N = population_size(pop);
+
+	T *V            = pop.V.data();
+	T *t_last_spike = pop.t_last_spike.data();
+	std::uint8_t *spiking = pop.spiking.data();
+
+	const T *V_rest         = pop.V_rest.data();
+	const T *V_reset        = pop.V_reset.data();
+	const T *V_thresh       = pop.V_thresh.data();
+	const T *V_critical     = pop.V_critical.data();
+	const T *c              = pop.c.data();
+	const T *R              = pop.R.data();
+	const T *tau            = pop.tau.data();
+	const T *tau_refractory = pop.tau_refractory.data();
+
+	NCR_IVDEP
+	for (size_t i = 0; i < N; i++) {
+		const T V0 = V[i], I = Iext[i];
+		const T inv_tau = T(1.0) / tau[i];
+
+		const T k1 = dt * inv_tau * (c[i] * (V0 - V_rest[i]) * (V0 - V_critical[i]) + R[i] * I);
+		const T V1 = V0 + k1;
+		const T k2 = dt * inv_tau * (c[i] * (V1 - V_rest[i]) * (V1 - V_critical[i]) + R[i] * I);
+		const T Vn = V0 + T(0.5) * (k1 + k2);
+
+		// refractoriness and after-spike reset without branches
+		const T t_last = t_last_spike[i];
+		const T t_refr = t_last - dt;
+
+		const bool refractory = t_last > 0;
+		const bool spike      = !refractory && Vn > V_thresh[i];
+
+		V[i]            = refractory ? V0     : (spike ? V_reset[i]        : Vn);
+		t_last_spike[i] = refractory ? t_refr : (spike ? tau_refractory[i] : t_last);
+		spiking[i]      = spike;
+	}
+	t += dt;
+}
+
+
 } // QuadraticIF ::
   // }}}
 
@@ -1077,35 +1594,42 @@ namespace GeneralizedIF {
  * Mihalas & Nieburg, "A Generalized Integrate-and-Fire Neural Model Produces
  * Diverse Spiking Behaviors", 2009, Neural Computation, Volume 21, Issue 3.
  *
+ * The model has a membrane potential V, an adaptive threshold Theta, and
+ * NInternalCurrents spike-induced currents I_j:
+ *
+ *     dI_j/dt   = -k_j I_j
+ *     dV/dt     = 1/C (Iext + sum_j I_j - G (V - E_L))
+ *     dTheta/dt = a (V - E_L) - b (Theta - Theta_inf)
+ *
+ * When V reaches Theta, the neuron spikes and its state is reset to
+ *
+ *     I_j   <- R_j I_j + A_j
+ *     V     <- V_reset
+ *     Theta <- max(Theta_reset, Theta)
+ *
+ * As for the other models, the input function is a template parameter and the
+ * neuron is passed by reference, such that the solver, the differential
+ * equation and the input can be inlined together. The number of internal
+ * currents is known at compile time, which allows the compiler to fully
+ * unroll the loops over them.
  */
-#if 0
-template <size_t NInternalCurrents, typename T>
-struct GeneralizedIFNeuron;
-
 
-template <typename T = double>
-using generalizedif_input_fn_t = T(*)(T t, void *dptr);
+template <size_t NInternalCurrents = 2>
+constexpr static size_t Dimensionality = 2 + NInternalCurrents;
 
 
-template <typename T = double>
-T
-generalizedif_demo_input(T t, void *)
+template <size_t NInternalCurrents = 2, typename T = double>
+struct Params
 {
-	NCR_UNUSED(t);
-	if (t > 10.0_ms)
-		return 20.0;
-	return 0.0;
-}
+	// Values taken from Mihalas & Niebur, 2009 (see in particular Table 1, and
+	// its description). Rates are given per ms, currents in units of mV/ms
 
-
-template <size_t NInternalCurrents, typename T = double>
-struct GeneralizedIFParams
-{
-	// Values taken from Mihalis & Niebur, 2009 (see in particular Table 1, and
-	// its description)
+	// Membrane capacitance and conductance
+	T C = 1.0;
+	T G = 0.05;
 
 	// Resting potential
-	T V0 = -70.0_mV;
+	T E_L = -70.0_mV;
 
 	// Voltage Reset after spike
 	T V_reset = -70.0_mV;
@@ -1116,167 +1640,220 @@ struct GeneralizedIFParams
 	// Threshold potential reset value
 	T Theta_reset = -60.0_mV;
 
-	// ion channel resistance vector
-	vector_t<NInternalCurrents, T> R;
+	// Threshold adaptation to the membrane potential, and threshold decay rate
+	T a = 0.0;
+	T b = 0.01;
 
-	// ion channel model parameters s s s A
-	vector_t<NInternalCurrents, T> A;
+	// decay rates of the internal currents
+	vector_t<NInternalCurrents, T> k;
 
+	// multiplicative and additive reset of the internal currents
+	vector_t<NInternalCurrents, T> R;
+	vector_t<NInternalCurrents, T> A;
 };
 
-template <size_t NInternalCurrents, typename T = double>
-struct GeneralizedIFState
+
+template <size_t NInternalCurrents = 2, typename T = double>
+struct State
 {
 	/*
 	 * the Generalized IF Neuron has multiple dynamic variables: V, V_threshold,
-	 * as well as all internal currents. In the paper by Mihalas & Niebur, 2 Input
-	 * Channels are described. They are arrange in the vector as
+	 * as well as all internal currents. They are arranged in the vector as
 	 *    v[0] = V
-	 *    v[1] = V_thresh
+	 *    v[1] = Theta
 	 *    v[2] = I_0
 	 *    .
 	 *    .
-	 *    v[N+2] = I_N
+	 *    v[N+1] = I_{N-1}
 	 */
-	vector_t<GeneralizedIFNeuron<NInternalCurrents, T>::N, T> v;
+	vector_t<Dimensionality<NInternalCurrents>, T> v;
 
 	/*
 	 * flag indicative if the neuron is spiking
 	 */
 	bool spiking;
-
-	/*
-	 * default constructor for the state of a Generalized IF neuron
-	 */
-	GeneralizedIFState()
-	: spiking(false)
-	{
-		// initialize state vector
-		v[0] = -70.0_mV;
-		v[1] = -50.0_mV;
-		for (size_t i = 0; i < NInternalCurrents; i++)
-			v[i+2] = 0.0;
-	}
 };
 
-template <size_t NInternalCurrents, size_t N, typename T = double>
-void
-generalizedif_diffeq(
-		const T t,
-		const vector_t<N, T> &y,
-		vector_t<N, T> &dydt,
-		void *dptr)
-{
-	static_assert(N == GeneralizedIFNeuron<NInternalCurrents, T>::N);
-	if (!dptr) {
-		log_error("Missing argument dptr to generalizedif_diffeq.\n");
-		return;
-	}
-	GeneralizedIFNeuron<NInternalCurrents, T> *neuron = (GeneralizedIFNeuron<NInternalCurrents, T>*)dptr;
 
-	// shorthand extraction
-	const T tau        = neuron->params.tau;
-	const T V_rest     = neuron->params.V_rest;
-	const T c          = neuron->params.c;
-	const T R          = neuron->params.R;
-	const T V_critical = neuron->params.V_critical;
+template <size_t NInternalCurrents = 2, typename T = double>
+struct Neuron
+{
+	// Each neuron has a base-type from which its parameters are synthesized
+	std::string type;
 
-	// get input for the current time step
-	T Iext = 0.0;
-	if (neuron->input_fn)
-		Iext = neuron->input_fn(t, neuron->input_fn_dptr);
+	// params and state of the neuron
+	Params<NInternalCurrents, T> params;
+	State<NInternalCurrents, T>  state;
+};
 
-	// dynamical system specification
-}
 
-template <size_t NInternalCurrents, typename T = double>
-void
-generalizedif_step(
-		GeneralizedIFNeuron<NInternalCurrents, T> *neuron,
-		T &t,
-		T &dt,
-		odesolver_step_fn<GeneralizedIFNeuron<NInternalCurrents, T>::N, T> step_fn = odesolve_step_rk2<GeneralizedIFNeuron<NInternalCurrents, T>::N, T>)
+/*
+ * get_default_params - parameters for some of the behaviors in Mihalas & Niebur 2009
+ *
+ * The parameter sets only differ in a, A_0 and A_1. Internal currents beyond
+ * the first two are disabled.
+ */
+template <size_t NInternalCurrents = 2, typename T = double>
+inline Params<NInternalCurrents, T>
+get_default_params(std::string type)
 {
-	vector_t<GeneralizedIFNeuron<NInternalCurrents, T>::N, T> y_out;
+	struct behavior { T a, A0, A1; };
+	behavior c;
+	if      (type == "tonic_spiking")    c = {0.000,  0.0,  0.0};
+	else if (type == "spike_freq_adapt") c = {0.005,  0.0,  0.0};
+	else if (type == "phasic_spiking")   c = {0.005,  0.0,  0.0};
+	else if (type == "tonic_bursting")   c = {0.005, 10.0, -0.6};
+	else if (type == "phasic_bursting")  c = {0.005, 10.0, -0.6};
+	else if (type == "mixed_mode")       c = {0.005,  5.0, -0.3};
+	else {
+		log_warning("Unknown GeneralizedIF neuron type \"", type, "\". Using fallback \"tonic_spiking\" instead.\n");
+		c = {0.000,  0.0,  0.0};
+	}
 
-	// forward integration
-	step_fn(neuron->diff_eq, t, dt, neuron->state.v, y_out, neuron);
-	neuron->state.v = y_out;
+	Params<NInternalCurrents, T> p;
+	p.a = c.a;
+	for (size_t j = 0; j < NInternalCurrents; j++) {
+		p.k[j] = 0.0;
+		p.R[j] = 0.0;
+		p.A[j] = 0.0;
+	}
+	if constexpr (NInternalCurrents > 0) {
+		p.k[0] = 0.2;
+		p.A[0] = c.A0;
+	}
+	if constexpr (NInternalCurrents > 1) {
+		p.k[1] = 0.02;
+		p.R[1] = 1.0;
+		p.A[1] = c.A1;
+	}
+	return p;
+}
 
-	// determine if spike or not
-	neuron->state.spiking = y_out[0] >= y_out[1];
-	if (neuron->state.spiking) {
-		neuron->state.y[0] = neuron->params.V_reset;
 
-	}
+template <typename T = double>
+inline auto
+get_demo_input(std::string type) -> T(*)(T)
+{
+	if (type == "tonic_spiking")    return [](T t) -> T { if (t > 10.0_ms) return 1.5; return 0.0; };
+	if (type == "spike_freq_adapt") return [](T t) -> T { if (t > 10.0_ms) return 2.0; return 0.0; };
+	if (type == "phasic_spiking")   return [](T t) -> T { if (t > 10.0_ms) return 1.5; return 0.0; };
+	if (type == "tonic_bursting")   return [](T t) -> T { if (t > 10.0_ms) return 2.0; return 0.0; };
+	if (type == "phasic_bursting")  return [](T t) -> T { if (t > 10.0_ms) return 1.5; return 0.0; };
+	if (type == "mixed_mode")       return [](T t) -> T { if (t > 10.0_ms) return 2.0; return 0.0; };
+
+	log_error("Unknown GeneralizedIF neuron type \"", type, " in call to get_demo_input.\n");
+	return [](T) -> T { return 0.0; };
 }
 
+
 template <size_t NInternalCurrents = 2, typename T = double>
-struct GeneralizedIFNeuron
+inline Neuron<NInternalCurrents, T>
+make(std::string type = "tonic_spiking")
 {
-	// dimensions of the models' dynamical system, which is {V, V_thresh, Input1, ... InputN}
-	constexpr static size_t N = 2 + NInternalCurrents;
+	Neuron<NInternalCurrents, T> n;
+	n.type = type;
+	n.params = get_default_params<NInternalCurrents, T>(type);
 
-	// params and state of the neuron
-	GeneralizedIFParams<NInternalCurrents, T> params;
-	GeneralizedIFState<NInternalCurrents, T>  state;
+	n.state.v[0] = n.params.E_L;
+	n.state.v[1] = n.params.Theta_inf;
+	for (size_t j = 0; j < NInternalCurrents; j++)
+		n.state.v[2 + j] = 0.0;
+	n.state.spiking = false;
+	return n;
+}
 
-	// differential equation of the neuron (set to the default implementation)
-	dynamical_system_fn<N, T> diff_eq = generalizedif_diffeq<NInternalCurrents, N, T>;
 
-	// function wich provides input to the neuron, and additional data passed
-	// along
-	generalizedif_input_fn_t<T> input_fn = nullptr;
-	void *input_fn_dptr = nullptr;
+// type of a solver required for the differential equation of a generalized
+// IF neuron
+template <size_t NInternalCurrents, typename T, typename InputFunction>
+using SolverType = odesolver_step_fn<Dimensionality<NInternalCurrents>, T, InputFunction, Neuron<NInternalCurrents, T>&>;
 
-	/*
-	 * set_input - set the input function to the neuron
-	 */
-	void
-	set_input(generalizedif_input_fn_t<T> _input_fn, void *_dptr = nullptr)
-	{
-		this->input_fn = _input_fn;
-		this->input_fn_dptr = _dptr;
-	}
 
-	/*
-	 * step - forward integration for timestep t and a delta-t
-	 *
-	 * Note: depending on the integrator step function, dt might be changed. If
-	 * this is the case and undesired, it might be better to call .integrate
-	 * with the same arguments, which will forward integrate up until t+dt is
-	 * reached.
-	 */
-	void
-	step(
-			T &t,
-			T &dt,
-			odesolver_step_fn<N, T> step_fn = odesolve_step_rk2<N, T>)
-	{
-		generalizedif_step(this, t, dt, step_fn);
-	}
+template <size_t NInternalCurrents, typename T, typename InputFunction>
+inline void
+diffeq(
+		const T t,
+		const vector_t<Dimensionality<NInternalCurrents>, T> &y,
+		vector_t<Dimensionality<NInternalCurrents>, T> &dydt,
+		InputFunction input,
+		Neuron<NInternalCurrents, T> &neuron)
+{
+	const auto &p = neuron.params;
 
-	/*
-	 * integrate - forward integrate until t+dt is reached
-	 */
-	void
-	integrate(
-			T &t,
-			T &dt,
-			odesolver_step_fn<N, T> step_fn = odesolve_step_rk2<N, T>)
-	{
-		T t_target = t+dt;
-		while (t < t_target) {
-			dt = std::min(dt, t_target - t);
-			step(t, dt, step_fn);
-		}
-	}
-};
-#endif
+	// get input for the current time step
+	const T Iext = input(t);
 
+	// internal currents
+	T I_int = 0.0;
+	for (size_t j = 0; j < NInternalCurrents; j++) {
+		I_int      += y[2 + j];
+		dydt[2 + j] = -p.k[j] * y[2 + j];
+	}
 
-} // GeneralizeIF::
-  // }}}
+	// dynamical system specification
+	const T V     = y[0];
+	const T Theta = y[1];
+	dydt[0] = (Iext + I_int - p.G * (V - p.E_L)) / p.C;
+	dydt[1] = p.a * (V - p.E_L) - p.b * (Theta - p.Theta_inf);
+}
+
+
+template <size_t NInternalCurrents, typename T, typename InputFunction>
+inline void
+step(
+		Neuron<NInternalCurrents, T> &n,
+		T &t,
+		T &dt,
+		InputFunction input,
+		SolverType<NInternalCurrents, T, InputFunction> solver = odesolve_step_rk2)
+{
+	vector_t<Dimensionality<NInternalCurrents>, T> y_out;
+
+	// forward integration
+	solver(diffeq, t, dt, n.state.v, y_out, input, n);
+	n.state.v = y_out;
+
+	// determine if spike or not
+	n.state.spiking = y_out[0] >= y_out[1];
+	if (n.state.spiking) {
+		const auto &p = n.params;
+		n.state.v[0] = p.V_reset;
+		n.state.v[1] = std::max(p.Theta_reset, y_out[1]);
+		for (size_t j = 0; j < NInternalCurrents; j++)
+			n.state.v[2 + j] = p.R[j] * y_out[2 + j] + p.A[j];
+	}
+}
+
+
+template <size_t NInternalCurrents, typename T, typename InputFunction>
+inline T
+integrate(
+		Neuron<NInternalCurrents, T> &n,
+		const T t,
+		const T dt,
+		InputFunction input,
+		SolverType<NInternalCurrents, T, InputFunction> solver = odesolve_step_rk2)
+{
+	// compute the target time to reach during integration
+	T t_target = t+dt;
+
+	// needs local dt to pass as reference to step(), in order to avoid
+	// updating the callees dt
+	T dt_tmp = dt;
+	T t_tmp = t;
+
+	// iterate until target time reached using local variables only
+	while (t_tmp < t_target) {
+		dt_tmp = std::min(dt_tmp, t_target - t_tmp);
+		step(n, t_tmp, dt_tmp, input, solver);
+	}
+
+	return t_tmp;
+}
+
+
+} // GeneralizeIF::
+  // }}}
 
 
 
@@ -1351,23 +1928,217 @@ get_demo_input(std::string type) -> T(*)(T)
 
 
 template <typename T>
-T __hh_n_inf(const T v, Params<T> &params)
+T __hh_n_inf(const T v, const Params<T> &params)
 {
-	return params.alpha_n(v) / (params.alpha_n(v) + params.beta_n(v));
+	const T a = params.alpha_n(v);
+	return a / (a + params.beta_n(v));
 }
 
 
 template <typename T>
-T __hh_m_inf(const T v, Params<T> &params)
+T __hh_m_inf(const T v, const Params<T> &params)
 {
-	return params.alpha_m(v) / (params.alpha_m(v) + params.beta_m(v));
+	const T a = params.alpha_m(v);
+	return a / (a + params.beta_m(v));
 }
 
 
 template <typename T>
-T __hh_h_inf(const T v, Params<T> &params)
+T __hh_h_inf(const T v, const Params<T> &params)
 {
-	return params.alpha_h(v) / (params.alpha_h(v) + params.beta_h(v));
+	const T a = params.alpha_h(v);
+	return a / (a + params.beta_h(v));
+}
+
+
+/*
+ * rates - indexes of the gating rates in the arrays below
+ */
+enum GatingRate : unsigned {
+	ALPHA_N = 0, BETA_N, ALPHA_M, BETA_M, ALPHA_H, BETA_H,
+	N_GATING_RATES
+};
+
+
+/*
+ * __hh_rates - evaluate all alpha and beta functions at v
+ */
+template <typename T>
+inline void
+__hh_rates(const Params<T> &p, const T v, T *r)
+{
+	r[ALPHA_N] = p.alpha_n(v);
+	r[BETA_N]  = p.beta_n(v);
+	r[ALPHA_M] = p.alpha_m(v);
+	r[BETA_M]  = p.beta_m(v);
+	r[ALPHA_H] = p.alpha_h(v);
+	r[BETA_H]  = p.beta_h(v);
+}
+
+
+/*
+ * GatingTable - tabulated alpha and beta functions
+ *
+ * The rates are sampled on a regular voltage grid [v_min, v_max] with spacing
+ * dv, and linearly interpolated in between. This replaces the exp calls of
+ * the gating kinetics by a table lookup. Voltages outside of the grid fall
+ * back to the analytic functions.
+ *
+ * The error of linear interpolation of a rate f within the grid is at most
+ * dv^2 / 8 * max |f''|. make_gating_table estimates max |f''| from second
+ * differences on the grid, and stores the resulting bound (with a margin of
+ * 10%) in error_bound. validate_gating_table checks this against the analytic
+ * functions. With the default dv = 0.01 mV, the bounds of the classical
+ * parameters are below 2e-6 per ms, dominated by beta_m at -100 mV.
+ */
+template <typename T = double>
+struct GatingTable
+{
+	T v_min  = 0.0;
+	T v_max  = 0.0;
+	T dv     = 0.0;
+	T inv_dv = 0.0;
+
+	// rates at the grid points, N_GATING_RATES values per grid point
+	std::vector<T> rates;
+
+	// bound of the absolute interpolation error of each rate
+	std::array<T, N_GATING_RATES> error_bound{};
+
+	bool   empty() const { return this->rates.empty(); }
+	size_t size()  const { return this->rates.size() / N_GATING_RATES; }
+};
+
+
+/*
+ * make_gating_table - tabulate the rates of a parameter set
+ */
+template <typename T>
+inline GatingTable<T>
+make_gating_table(const Params<T> &p, T v_min = -100.0_mV, T v_max = 100.0_mV, T dv = 0.01_mV)
+{
+	GatingTable<T> table;
+	if (!(dv > T(0.0)) || !(v_max > v_min)) {
+		log_error("make_gating_table: invalid voltage grid\n");
+		return table;
+	}
+
+	const size_t n = size_t(std::ceil((v_max - v_min) / dv)) + 1;
+	table.v_min  = v_min;
+	table.dv     = dv;
+	table.inv_dv = T(1.0) / dv;
+	table.v_max  = v_min + T(n - 1) * dv;
+	table.rates.resize(n * N_GATING_RATES);
+
+	for (size_t i = 0; i < n; i++) {
+		const T v = v_min + T(i) * dv;
+		T *r = &table.rates[i * N_GATING_RATES];
+		__hh_rates(p, v, r);
+
+		// removable singularities, e.g. of alpha_n at v = -50 mV, are
+		// replaced by their limit
+		for (unsigned k = 0; k < N_GATING_RATES; k++) {
+			if (std::isfinite(r[k]))
+				continue;
+			T lo[N_GATING_RATES], hi[N_GATING_RATES];
+			__hh_rates(p, v - dv * T(1e-3), lo);
+			__hh_rates(p, v + dv * T(1e-3), hi);
+			r[k] = T(0.5) * (lo[k] + hi[k]);
+		}
+	}
+
+	// interpolation error bound from the second differences
+	for (size_t i = 1; i + 1 < n; i++) {
+		for (unsigned k = 0; k < N_GATING_RATES; k++) {
+			const T d2 = table.rates[(i - 1) * N_GATING_RATES + k]
+			           - T(2.0) * table.rates[i * N_GATING_RATES + k]
+			           + table.rates[(i + 1) * N_GATING_RATES + k];
+			table.error_bound[k] = std::max(table.error_bound[k], std::abs(d2));
+		}
+	}
+	for (auto &b: table.error_bound)
+		b *= T(1.1) / T(8.0);
+	return table;
+}
+
+
+/*
+ * __hh_rates - interpolate all rates at v from a table
+ */
+template <typename T>
+inline void
+__hh_rates(const GatingTable<T> &table, const Params<T> &p, const T v, T *r)
+{
+	const T x = (v - table.v_min) * table.inv_dv;
+	if (!(x >= T(0.0)) || !(v < table.v_max)) {
+		__hh_rates(p, v, r);
+		return;
+	}
+	const size_t i = size_t(x);
+	const T frac = x - T(i);
+	const T *lo = &table.rates[i * N_GATING_RATES];
+	const T *hi = lo + N_GATING_RATES;
+	for (unsigned k = 0; k < N_GATING_RATES; k++)
+		r[k] = lo[k] + frac * (hi[k] - lo[k]);
+}
+
+
+/*
+ * GatingTableValidation - result of validate_gating_table
+ */
+template <typename T = double>
+struct GatingTableValidation
+{
+	// largest absolute error of each rate, and the voltage where it occurred
+	std::array<T, N_GATING_RATES> max_error{};
+	std::array<T, N_GATING_RATES> v_max_error{};
+
+	// true if all errors are within the table's error_bound
+	bool ok = false;
+};
+
+
+/*
+ * validate_gating_table - compare a table against the analytic rates
+ *
+ * Evaluates both at samples_per_interval voltages within each grid interval.
+ * Near removable singularities, the analytic functions themselves are only
+ * accurate to a few ulp of the cancelled terms, which is accounted for by a
+ * small tolerance.
+ */
+template <typename T>
+inline GatingTableValidation<T>
+validate_gating_table(const GatingTable<T> &table, const Params<T> &p, size_t samples_per_interval = 4)
+{
+	GatingTableValidation<T> result;
+	if (table.empty())
+		return result;
+
+	T max_rate = 0.0;
+	for (auto r: table.rates)
+		max_rate = std::max(max_rate, std::abs(r));
+	const T tolerance = T(1e-9) * (T(1.0) + max_rate);
+
+	for (size_t i = 0; i + 1 < table.size(); i++) {
+		for (size_t s = 0; s < samples_per_interval; s++) {
+			const T v = table.v_min + (T(i) + (T(s) + T(0.5)) / T(samples_per_interval)) * table.dv;
+			T exact[N_GATING_RATES], approx[N_GATING_RATES];
+			__hh_rates(p, v, exact);
+			__hh_rates(table, p, v, approx);
+			for (unsigned k = 0; k < N_GATING_RATES; k++) {
+				const T err = std::abs(exact[k] - approx[k]);
+				if (std::isfinite(exact[k]) && err > result.max_error[k]) {
+					result.max_error[k] = err;
+					result.v_max_error[k] = v;
+				}
+			}
+		}
+	}
+
+	result.ok = true;
+	for (unsigned k = 0; k < N_GATING_RATES; k++)
+		result.ok = result.ok && result.max_error[k] <= table.error_bound[k] + tolerance;
+	return result;
 }
 
 
@@ -1594,6 +2365,161 @@ integrate(
 }
 
 
+/*
+ * Population - structure-of-arrays storage for N Hodgkin-Huxley neurons
+ *
+ * In contrast to the other models, all neurons of a population share one set
+ * of Params, because the gating kinetics are given as functions. The state
+ * variables are kept in one contiguous array each. If gating is not empty,
+ * step() takes the rates from the table instead of the functions in params,
+ * see use_gating_table.
+ */
+template <typename T = double>
+struct Population
+{
+	// shared parameters of all neurons
+	Params<T>                 params;
+	GatingTable<T>            gating;
+
+	// state variables
+	std::vector<T>            V;
+	std::vector<T>            n;
+	std::vector<T>            m;
+	std::vector<T>            h;
+	std::vector<std::uint8_t> spiking;
+};
+
+
+template <typename T>
+inline size_t
+population_size(const Population<T> &pop)
+{
+	return pop.V.size();
+}
+
+
+/*
+ * make_population - create a population of N neurons of the same type
+ */
+template <typename T = double>
+inline Population<T>
+make_population(size_t N, std::string type)
+{
+	Population<T> pop;
+	pop.params = get_default_params<T>(type);
+	pop.V.assign(N, pop.params.V0);
+	pop.n.assign(N, __hh_n_inf(pop.params.V0, pop.params));
+	pop.m.assign(N, __hh_m_inf(pop.params.V0, pop.params));
+	pop.h.assign(N, __hh_h_inf(pop.params.V0, pop.params));
+	pop.spiking.assign(N, 0);
+	return pop;
+}
+
+
+/*
+ * use_gating_table - let a population take its rates from a lookup table
+ *
+ * Returns false if the table could not be built. Use validate_gating_table to
+ * check the accuracy of pop.gating.
+ */
+template <typename T>
+inline bool
+use_gating_table(Population<T> &pop, T v_min = -100.0_mV, T v_max = 100.0_mV, T dv = 0.01_mV)
+{
+	pop.gating = make_gating_table(pop.params, v_min, v_max, dv);
+	return !pop.gating.empty();
+}
+
+
+/*
+ * __hh_population_diffeq - right hand side of the HH system for one neuron
+ */
+template <bool UseTable, typename T>
+inline void
+__hh_population_diffeq(
+		const Params<T> &p,
+		const GatingTable<T> &table,
+		const T V, const T n, const T m, const T h, const T Iext,
+		T &dV, T &dn, T &dm, T &dh)
+{
+	const T I_Na = p.g_Na * (V - p.E_Na) * m * m * m * h;
+	const T I_K  = p.g_K  * (V - p.E_K)  * n * n * n * n;
+	const T I_l  = p.g_l  * (V - p.E_l);
+
+	T r[N_GATING_RATES];
+	if constexpr (UseTable)
+		__hh_rates(table, p, V, r);
+	else
+		__hh_rates(p, V, r);
+
+	dV = (T(1.0) / p.C_m) * (Iext - (I_Na + I_K + I_l));
+	dn = r[ALPHA_N] * (T(1.0) - n) - r[BETA_N] * n;
+	dm = r[ALPHA_M] * (T(1.0) - m) - r[BETA_M] * m;
+	dh = r[ALPHA_H] * (T(1.0) - h) - r[BETA_H] * h;
+}
+
+
+/*
+ * __hh_population_step - RK2 step of all neurons, see step below
+ */
+template <bool UseTable, typename T>
+inline void
+__hh_population_step(
+		Population<T> &pop,
+		const T dt,
+		const T *Iext)
+{
+	const size_t N = population_size(pop);
+	const Params<T> &p = pop.params;
+	const GatingTable<T> &g = pop.gating;
+
+	T *V = pop.V.data();
+	T *n = pop.n.data();
+	T *m = pop.m.data();
+	T *h = pop.h.data();
+	std::uint8_t *spiking = pop.spiking.data();
+
+	for (size_t i = 0; i < N; i++) {
+		T k1V, k1n, k1m, k1h;
+		T k2V, k2n, k2m, k2h;
+
+		__hh_population_diffeq<UseTable>(p, g, V[i], n[i], m[i], h[i], Iext[i], k1V, k1n, k1m, k1h);
+		k1V *= dt; k1n *= dt; k1m *= dt; k1h *= dt;
+
+		__hh_population_diffeq<UseTable>(p, g, V[i] + k1V, n[i] + k1n, m[i] + k1m, h[i] + k1h, Iext[i], k2V, k2n, k2m, k2h);
+		k2V *= dt; k2n *= dt; k2m *= dt; k2h *= dt;
+
+		V[i] += T(0.5) * (k1V + k2V);
+		n[i] += T(0.5) * (k1n + k2n);
+		m[i] += T(0.5) * (k1m + k2m);
+		h[i] += T(0.5) * (k1h + k2h);
+		spiking[i] = V[i] > p.V_thresh;
+	}
+}
+
+
+/*
+ * step - advance all neurons of a population by one RK2 step
+ *
+ * Iext must point to population_size(pop) input values, which are held
+ * constant during the step.
+ */
+template <typename T>
+inline void
+step(
+		Population<T> &pop,
+		T &t,
+		const T dt,
+		const T *Iext)
+{
+	if (pop.gating.empty())
+		__hh_population_step<false>(pop, dt, Iext);
+	else
+		__hh_population_step<true>(pop, dt, Iext);
+	t += dt;
+}
+
+
 
 
 } // HodgkinHuxley::
@@ -1688,37 +2614,77 @@ stdpsynapse_get_params(std::string param_type_str = "theta_decorrelation")
 
 /*
  * stdpsynapse_diffeq - differential equations for the synape's state
+ *
+ * Between spikes, both traces simply decay exponentially with their respective
+ * time constant. Spikes are handled in stdpsynapse_pre_spike and
+ * stdpsynapse_post_spike.
  */
-template <size_t N, typename T = double>
-void
+template <typename T = double>
+inline void
 stdpsynapse_diffeq(
 		const T t,
-		const vector_t<N, T> &y,
-		vector_t<N, T> &dydt,
-		void *dptr)
+		const vector_t<2, T> &y,
+		vector_t<2, T> &dydt,
+		STDPSynapse<T> &synapse)
 {
-	static_assert(N == STDPSynapse<T>::N);
-	if (!dptr) {
-		log_error("Missing argument dptr to stdpsynapse_diffeq.\n");
-		return;
-	}
-	STDPSynapse<T> *synapse = (STDPSynapse<T>*)dptr;
-
-	// TODO: fill in
-	NCR_UNUSED(t, y, dydt);
+	NCR_UNUSED(t);
+	dydt[0] = -y[0] / synapse.params.tau_pre;
+	dydt[1] = -y[1] / synapse.params.tau_post;
 }
 
 
+// type of a solver required for the differential equation of an STDP synapse
+template <typename T>
+using STDPSynapseSolverType = odesolver_step_fn<2, T, STDPSynapse<T>&>;
 
 
 /*
- * stdpsynapse_pre_spike - treatment of the dynamics before a spike occurs
+ * stdpsynapse_step - forward integration of the synapse's traces
  */
+template <typename T>
+inline void
+stdpsynapse_step(
+		STDPSynapse<T> &synapse,
+		T &t,
+		T &dt,
+		STDPSynapseSolverType<T> solver = odesolve_step_rk2)
+{
+	static_assert(STDPSynapse<T>::N == 2);
+	vector_t<2, T> y_out;
+	solver(stdpsynapse_diffeq, t, dt, synapse.state.a, y_out, synapse);
+	synapse.state.a = y_out;
+}
 
 
 /*
- * stdpsynapse_post_spike - treatment of the dynamics after a spike occured
+ * stdpsynapse_pre_spike - treatment of the dynamics when the presynaptic neuron spikes
+ *
+ * The weight changes by the current value of the post trace, which results in
+ * depression for negative c_a_post. Afterwards, the pre trace is bumped.
  */
+template <typename T>
+void
+stdpsynapse_pre_spike(STDPSynapse<T> &synapse)
+{
+	auto &p = synapse.params;
+	auto &s = synapse.state;
+	s.w = std::clamp(s.w + p.eta * s.a[1], p.w_min, p.w_max);
+	s.a[0] += p.c_a_pre;
+}
+
+
+/*
+ * stdpsynapse_post_spike - treatment of the dynamics when the postsynaptic neuron spikes
+ */
+template <typename T>
+void
+stdpsynapse_post_spike(STDPSynapse<T> &synapse)
+{
+	auto &p = synapse.params;
+	auto &s = synapse.state;
+	s.w = std::clamp(s.w + p.eta * s.a[0], p.w_min, p.w_max);
+	s.a[1] += p.c_a_post;
+}
 
 
 /*
@@ -1731,8 +2697,11 @@ struct STDPSynapseState
 	// accounting for the pre-spike dynamics, and one for post-spike dynamics
 	vector_t<STDPSynapse<T>::N, T> a;
 
+	// current weight of the synapse
+	T w;
+
 	STDPSynapseState()
-	: a{0.0, 0.0}
+	: a{0.0, 0.0}, w(0.0)
 	{ }
 };
 
@@ -1748,26 +2717,679 @@ struct STDPSynapse
 
 	STDPSynapse(std::string _param_type_str)
 	: params(stdpsynapse_get_params<T>(_param_type_str))
-	{}
+	{
+		state.w = params.w0;
+	}
 };
 
 
 /*
  * Triplet Rule STDP Synapse
+ *
+ * The triplet rule of Pfister and Gerstner 2006 uses two traces on each side
+ * of the synapse. The fast traces r1 (pre) and o1 (post) implement the pair
+ * terms, while the slow traces r2 (pre) and o2 (post) modulate depression and
+ * potentiation, respectively:
+ *
+ *     pre spike:  w -= eta * o1 * (A2_minus + A3_minus * r2),  r1 += 1, r2 += 1
+ *     post spike: w += eta * r1 * (A2_plus  + A3_plus  * o2),  o1 += 1, o2 += 1
+ *
+ * where r2 and o2 are evaluated just before the spike.
+ */
+template <typename T = double>
+struct TripletSTDPSynapseParams
+{
+	// time constants of the fast pre/post traces, and the slow pre/post traces
+	T tau_plus;
+	T tau_minus;
+	T tau_x;
+	T tau_y;
+
+	// amplitudes of the pair and triplet terms
+	T A2_plus;
+	T A3_plus;
+	T A2_minus;
+	T A3_minus;
+
+	// Learning rate of this synapse
+	T eta;
+
+	// Weight setup, i.e. initial weights, minimal and maximal weight
+	T w0;
+	T w_min;
+	T w_max;
+};
+
+
+/*
+ * tripletstdpsynapse_get_params - get parameters for a triplet STDP synapse
+ *
+ * The parameter sets are the all-to-all fits of the full model in Pfister and
+ * Gerstner 2006 (Table 4).
+ */
+template <typename T>
+TripletSTDPSynapseParams<T>
+tripletstdpsynapse_get_params(std::string param_type_str = "hippocampal")
+{
+	static std::map<std::string, TripletSTDPSynapseParams<T>> stdp_types;
+	static const std::string default_type = "hippocampal";
+
+	stdp_types["hippocampal"] =
+	{
+		.tau_plus  =  16.8_ms,
+		.tau_minus =  33.7_ms,
+		.tau_x     = 946.0_ms,
+		.tau_y     =  27.0_ms,
+		.A2_plus   =   6.1e-3,
+		.A3_plus   =   6.7e-3,
+		.A2_minus  =   1.6e-3,
+		.A3_minus  =   1.4e-3,
+		.eta       =   1.0,
+		.w0        =   0.5,
+		.w_min     =   0.0,
+		.w_max     =   1.0,
+	};
+
+	stdp_types["visual_cortex"] =
+	{
+		.tau_plus  =  16.8_ms,
+		.tau_minus =  33.7_ms,
+		.tau_x     = 101.0_ms,
+		.tau_y     = 125.0_ms,
+		.A2_plus   =   5.0e-10,
+		.A3_plus   =   6.2e-3,
+		.A2_minus  =   7.0e-3,
+		.A3_minus  =   2.3e-4,
+		.eta       =   1.0,
+		.w0        =   0.5,
+		.w_min     =   0.0,
+		.w_max     =   1.0,
+	};
+
+	if (!stdp_types.contains(param_type_str)) {
+		log_warning("Unknown triplet STDP Synapse parameter set \"", param_type_str, "\". Using fallback \"", default_type, "\" instead.\n");
+		return stdp_types[default_type];
+	}
+	return stdp_types[param_type_str];
+}
+
+
+/*
+ * TripletSTDPSynapseState - State of a triplet STDP synapse
  */
+template <typename T = double>
+struct TripletSTDPSynapseState
+{
+	// the traces {r1, r2, o1, o2}, i.e. the fast and slow presynaptic traces
+	// followed by the fast and slow postsynaptic traces
+	vector_t<4, T> a;
+
+	// current weight of the synapse
+	T w;
+
+	TripletSTDPSynapseState()
+	: a{0.0, 0.0, 0.0, 0.0}, w(0.0)
+	{ }
+};
+
+
+template <typename T = double>
 struct TripletSTDPSynapse
 {
+	// the synapse has dimensionality 4 (i.e. it uses four dynamic variables)
+	constexpr static size_t N = 4;
+
+	TripletSTDPSynapseParams<T> params;
+	TripletSTDPSynapseState<T>  state;
+
+	TripletSTDPSynapse(std::string _param_type_str)
+	: params(tripletstdpsynapse_get_params<T>(_param_type_str))
+	{
+		state.w = params.w0;
+	}
 };
 
 
+/*
+ * tripletstdpsynapse_diffeq - exponential decay of the four traces
+ */
+template <typename T>
+inline void
+tripletstdpsynapse_diffeq(
+		const T t,
+		const vector_t<4, T> &y,
+		vector_t<4, T> &dydt,
+		TripletSTDPSynapse<T> &synapse)
+{
+	NCR_UNUSED(t);
+	const auto &p = synapse.params;
+	dydt[0] = -y[0] / p.tau_plus;
+	dydt[1] = -y[1] / p.tau_x;
+	dydt[2] = -y[2] / p.tau_minus;
+	dydt[3] = -y[3] / p.tau_y;
+}
+
+
+// type of a solver required for the differential equation of a triplet STDP
+// synapse
+template <typename T>
+using TripletSTDPSynapseSolverType = odesolver_step_fn<4, T, TripletSTDPSynapse<T>&>;
+
+
+/*
+ * tripletstdpsynapse_step - forward integration of the synapse's traces
+ */
+template <typename T>
+inline void
+tripletstdpsynapse_step(
+		TripletSTDPSynapse<T> &synapse,
+		T &t,
+		T &dt,
+		TripletSTDPSynapseSolverType<T> solver = odesolve_step_rk2)
+{
+	vector_t<4, T> y_out;
+	solver(tripletstdpsynapse_diffeq, t, dt, synapse.state.a, y_out, synapse);
+	synapse.state.a = y_out;
+}
+
+
+/*
+ * tripletstdpsynapse_pre_spike - treatment of the dynamics when the presynaptic neuron spikes
+ *
+ * The weight is depressed by the fast post trace o1, modulated by the slow pre
+ * trace r2 just before the spike. Afterwards, both pre traces are bumped.
+ */
+template <typename T>
+void
+tripletstdpsynapse_pre_spike(TripletSTDPSynapse<T> &synapse)
+{
+	auto &p = synapse.params;
+	auto &s = synapse.state;
+	s.w = std::clamp(s.w - p.eta * s.a[2] * (p.A2_minus + p.A3_minus * s.a[1]), p.w_min, p.w_max);
+	s.a[0] += T(1);
+	s.a[1] += T(1);
+}
+
+
+/*
+ * tripletstdpsynapse_post_spike - treatment of the dynamics when the postsynaptic neuron spikes
+ *
+ * The weight is potentiated by the fast pre trace r1, modulated by the slow
+ * post trace o2 just before the spike. Afterwards, both post traces are bumped.
+ */
+template <typename T>
+void
+tripletstdpsynapse_post_spike(TripletSTDPSynapse<T> &synapse)
+{
+	auto &p = synapse.params;
+	auto &s = synapse.state;
+	s.w = std::clamp(s.w + p.eta * s.a[0] * (p.A2_plus + p.A3_plus * s.a[3]), p.w_min, p.w_max);
+	s.a[2] += T(1);
+	s.a[3] += T(1);
+}
+
+
+/*
+ *
+ * Event-driven STDP
+ *
+ * Integrating the traces of each synapse in every time step is prohibitive
+ * for large networks. However, the traces only depend on the spike times of
+ * the pre- or postsynaptic neuron, and not on the synapse itself. Hence,
+ * STDPPlasticity stores traces per neuron, and decays them analytically to the
+ * current time only when the neuron or one of its partners spikes.
+ *
+ * The weights are stored in CSR format, where the plastic synapses of the
+ * presynaptic neuron i are the edges [row_offsets[i], row_offsets[i+1]). This
+ * is the layout of the frozen CSR of a transport (see ncr_transport2), hence
+ * weights[e] corresponds to the transport edge e, given that the plasticity
+ * was built from the transport's row_offsets and sinks. A transpose index
+ * lists the incoming edges of each postsynaptic neuron.
+ *
+ * Params is either STDPSynapseParams (pair rule) or TripletSTDPSynapseParams
+ * (triplet rule). For the pair rule, only the fast traces are used.
+ *
+ * Example:
+ *
+ *     auto pre  = Izhikevich::make_population<double>(1000, "tonic_spiking");
+ *     auto post = Izhikevich::make_population<double>(1000, "tonic_spiking");
+ *     auto plasticity = make_stdp_plasticity<double>(row_offsets, cols, 1000,
+ *         tripletstdpsynapse_get_params<double>());
+ *     while (t < 1.0_s) {
+ *         step(pre, t_pre, dt, I_pre.data());
+ *         step(post, t_post, dt, I_post.data());
+ *         stdp_step(plasticity, pre, post, t_post);
+ *     }
+ *
+ * The spikes of a step are processed sequentially on the calling thread. The
+ * traces of a postsynaptic neuron are decayed lazily by every presynaptic
+ * spike that reaches it, so processing presynaptic neurons in parallel would
+ * race on these shared traces.
+ */
+template <typename T, typename Params = STDPSynapseParams<T>>
+struct STDPPlasticity
+{
+	Params params;
+
+	// plastic synapses in CSR format, rows are presynaptic neurons
+	std::vector<size_t> row_offsets;
+	std::vector<size_t> cols;
+	std::vector<T>      weights;
+
+	// transpose index, i.e. incoming edges of each postsynaptic neuron and
+	// their presynaptic neuron
+	std::vector<size_t> col_offsets;
+	std::vector<size_t> col_edges;
+	std::vector<size_t> col_sources;
+
+	// fast and slow traces of the presynaptic neurons, and their last update
+	std::vector<T>      r1, r2, t_pre;
+
+	// fast and slow traces of the postsynaptic neurons, and their last update
+	std::vector<T>      o1, o2, t_post;
+
+	// scratch space for the spikes of one step
+	std::vector<size_t> _pre_spikes, _post_spikes;
+};
+
+
+template <typename T, typename Params>
+inline size_t
+stdp_num_pre(const STDPPlasticity<T, Params> &p)
+{
+	return p.t_pre.size();
+}
+
+
+template <typename T, typename Params>
+inline size_t
+stdp_num_post(const STDPPlasticity<T, Params> &p)
+{
+	return p.t_post.size();
+}
+
+
+/*
+ * __stdp_taus - time constants {r1, r2, o1, o2} of a rule
+ */
+template <typename T>
+inline std::array<T, 4>
+__stdp_taus(const STDPSynapseParams<T> &p)
+{
+	return {p.tau_pre, p.tau_pre, p.tau_post, p.tau_post};
+}
+
+template <typename T>
+inline std::array<T, 4>
+__stdp_taus(const TripletSTDPSynapseParams<T> &p)
+{
+	return {p.tau_plus, p.tau_x, p.tau_minus, p.tau_y};
+}
+
+
+/*
+ * __stdp_bump_pre, __stdp_bump_post - increase of the traces after a spike
+ */
+template <typename T>
+inline std::array<T, 2>
+__stdp_bump_pre(const STDPSynapseParams<T> &p)        { return {p.c_a_pre, T(0)}; }
+
+template <typename T>
+inline std::array<T, 2>
+__stdp_bump_post(const STDPSynapseParams<T> &p)       { return {p.c_a_post, T(0)}; }
+
+template <typename T>
+inline std::array<T, 2>
+__stdp_bump_pre(const TripletSTDPSynapseParams<T> &)  { return {T(1), T(1)}; }
+
+template <typename T>
+inline std::array<T, 2>
+__stdp_bump_post(const TripletSTDPSynapseParams<T> &) { return {T(1), T(1)}; }
+
+
+/*
+ * __stdp_dw_pre - weight change of a synapse when its presynaptic neuron spikes
+ */
+template <typename T>
+inline T
+__stdp_dw_pre(const STDPSynapseParams<T> &p, T o1, T, T)
+{
+	return p.eta * o1;
+}
+
+template <typename T>
+inline T
+__stdp_dw_pre(const TripletSTDPSynapseParams<T> &p, T o1, T, T r2)
+{
+	return -p.eta * o1 * (p.A2_minus + p.A3_minus * r2);
+}
+
+
+/*
+ * __stdp_dw_post - weight change of a synapse when its postsynaptic neuron spikes
+ */
+template <typename T>
+inline T
+__stdp_dw_post(const STDPSynapseParams<T> &p, T r1, T, T)
+{
+	return p.eta * r1;
+}
+
+template <typename T>
+inline T
+__stdp_dw_post(const TripletSTDPSynapseParams<T> &p, T r1, T o2, T)
+{
+	return p.eta * r1 * (p.A2_plus + p.A3_plus * o2);
+}
+
+
+/*
+ * __stdp_decay - decay two traces from t_last to t
+ *
+ * This is a no-op if the traces were already updated at time t, which avoids
+ * evaluating exp() for every synapse of a neuron that spiked.
+ */
+template <typename T>
+inline void
+__stdp_decay(T &x1, T &x2, T &t_last, T t, T tau1, T tau2)
+{
+	if (t_last == t)
+		return;
+	const T dt = t - t_last;
+	x1 *= std::exp(-dt / tau1);
+	x2 *= std::exp(-dt / tau2);
+	t_last = t;
+}
+
+
+/*
+ * make_stdp_plasticity - create plastic synapses from a CSR connectivity
+ *
+ * row_offsets has one entry per presynaptic neuron plus one, and cols holds
+ * the index of the postsynaptic neuron for each edge. All weights are
+ * initialized to params.w0 and all traces to zero. For a frozen transport,
+ * pass map.csr.row_offsets and map.csr.sinks and the number of dense ports as
+ * n_post.
+ *
+ * Returns an empty plasticity and logs an error if the CSR is malformed.
+ */
+template <typename T, typename Params>
+STDPPlasticity<T, Params>
+make_stdp_plasticity(
+		std::span<const size_t> row_offsets,
+		std::span<const size_t> cols,
+		size_t n_post,
+		Params params)
+{
+	STDPPlasticity<T, Params> p;
+	p.params = params;
+
+	if (row_offsets.empty() || row_offsets.back() != cols.size()) {
+		log_error("Malformed CSR in make_stdp_plasticity.\n");
+		return p;
+	}
+	for (size_t i = 1; i < row_offsets.size(); i++) {
+		if (row_offsets[i] < row_offsets[i-1]) {
+			log_error("Malformed CSR in make_stdp_plasticity.\n");
+			return p;
+		}
+	}
+	for (auto c : cols) {
+		if (c >= n_post) {
+			log_error("Postsynaptic index ", c, " out of range in make_stdp_plasticity.\n");
+			return p;
+		}
+	}
+
+	const size_t n_pre = row_offsets.size() - 1;
+	p.row_offsets.assign(row_offsets.begin(), row_offsets.end());
+	p.cols.assign(cols.begin(), cols.end());
+	p.weights.assign(cols.size(), params.w0);
+
+	// counting sort of the edges by their postsynaptic neuron
+	p.col_offsets.assign(n_post + 1, 0);
+	for (auto c : cols)
+		p.col_offsets[c + 1]++;
+	for (size_t i = 0; i < n_post; i++)
+		p.col_offsets[i + 1] += p.col_offsets[i];
+	p.col_edges.resize(cols.size());
+	p.col_sources.resize(cols.size());
+	std::vector<size_t> fill(p.col_offsets.begin(), p.col_offsets.end() - 1);
+	for (size_t i = 0; i < n_pre; i++) {
+		for (size_t e = row_offsets[i]; e < row_offsets[i + 1]; e++) {
+			const size_t k = fill[cols[e]]++;
+			p.col_edges[k]   = e;
+			p.col_sources[k] = i;
+		}
+	}
+
+	p.r1.assign(n_pre, T(0));
+	p.r2.assign(n_pre, T(0));
+	p.t_pre.assign(n_pre, T(0));
+	p.o1.assign(n_post, T(0));
+	p.o2.assign(n_post, T(0));
+	p.t_post.assign(n_post, T(0));
+	return p;
+}
+
+
+/*
+ * stdp_reset - reset all traces, and optionally the weights, to their initial state
+ */
+template <typename T, typename Params>
+void
+stdp_reset(STDPPlasticity<T, Params> &p, bool reset_weights = true)
+{
+	std::fill(p.r1.begin(), p.r1.end(), T(0));
+	std::fill(p.r2.begin(), p.r2.end(), T(0));
+	std::fill(p.t_pre.begin(), p.t_pre.end(), T(0));
+	std::fill(p.o1.begin(), p.o1.end(), T(0));
+	std::fill(p.o2.begin(), p.o2.end(), T(0));
+	std::fill(p.t_post.begin(), p.t_post.end(), T(0));
+	if (reset_weights)
+		std::fill(p.weights.begin(), p.weights.end(), p.params.w0);
+}
+
+
+/*
+ * __stdp_apply_pre - weight changes of all outgoing synapses of a presynaptic spike
+ */
+template <typename T, typename Params>
+inline void
+__stdp_apply_pre(STDPPlasticity<T, Params> &p, size_t pre, T t, const std::array<T, 4> &tau)
+{
+	__stdp_decay(p.r1[pre], p.r2[pre], p.t_pre[pre], t, tau[0], tau[1]);
+	const T r2 = p.r2[pre];
+	for (size_t e = p.row_offsets[pre]; e < p.row_offsets[pre + 1]; e++) {
+		const size_t post = p.cols[e];
+		__stdp_decay(p.o1[post], p.o2[post], p.t_post[post], t, tau[2], tau[3]);
+		const T dw = __stdp_dw_pre(p.params, p.o1[post], p.o2[post], r2);
+		p.weights[e] = std::clamp(p.weights[e] + dw, p.params.w_min, p.params.w_max);
+	}
+}
+
+
+/*
+ * __stdp_apply_post - weight changes of all incoming synapses of a postsynaptic spike
+ */
+template <typename T, typename Params>
+inline void
+__stdp_apply_post(STDPPlasticity<T, Params> &p, size_t post, T t, const std::array<T, 4> &tau)
+{
+	__stdp_decay(p.o1[post], p.o2[post], p.t_post[post], t, tau[2], tau[3]);
+	const T o2 = p.o2[post];
+	for (size_t k = p.col_offsets[post]; k < p.col_offsets[post + 1]; k++) {
+		const size_t e   = p.col_edges[k];
+		const size_t pre = p.col_sources[k];
+		__stdp_decay(p.r1[pre], p.r2[pre], p.t_pre[pre], t, tau[0], tau[1]);
+		const T dw = __stdp_dw_post(p.params, p.r1[pre], o2, p.r2[pre]);
+		p.weights[e] = std::clamp(p.weights[e] + dw, p.params.w_min, p.params.w_max);
+	}
+}
+
+
+/*
+ * __stdp_bump_pre_trace, __stdp_bump_post_trace - add a spike to the traces of a neuron
+ */
+template <typename T, typename Params>
+inline void
+__stdp_bump_pre_trace(STDPPlasticity<T, Params> &p, size_t pre, T t, const std::array<T, 4> &tau)
+{
+	const auto bump = __stdp_bump_pre(p.params);
+	__stdp_decay(p.r1[pre], p.r2[pre], p.t_pre[pre], t, tau[0], tau[1]);
+	p.r1[pre] += bump[0];
+	p.r2[pre] += bump[1];
+}
+
+template <typename T, typename Params>
+inline void
+__stdp_bump_post_trace(STDPPlasticity<T, Params> &p, size_t post, T t, const std::array<T, 4> &tau)
+{
+	const auto bump = __stdp_bump_post(p.params);
+	__stdp_decay(p.o1[post], p.o2[post], p.t_post[post], t, tau[2], tau[3]);
+	p.o1[post] += bump[0];
+	p.o2[post] += bump[1];
+}
+
+
+/*
+ * stdp_pre_spike - handle a single spike of presynaptic neuron pre at time t
+ *
+ * Spikes must be passed in temporal order. If a pre- and postsynaptic spike
+ * occur at the same time, the one processed first does not see the other.
+ * Use stdp_process_spikes to handle all spikes of one time step at once.
+ */
+template <typename T, typename Params>
+void
+stdp_pre_spike(STDPPlasticity<T, Params> &p, size_t pre, T t)
+{
+	const auto tau = __stdp_taus(p.params);
+	__stdp_apply_pre(p, pre, t, tau);
+	__stdp_bump_pre_trace(p, pre, t, tau);
+}
+
+
+/*
+ * stdp_post_spike - handle a single spike of postsynaptic neuron post at time t
+ */
+template <typename T, typename Params>
+void
+stdp_post_spike(STDPPlasticity<T, Params> &p, size_t post, T t)
+{
+	const auto tau = __stdp_taus(p.params);
+	__stdp_apply_post(p, post, t, tau);
+	__stdp_bump_post_trace(p, post, t, tau);
+}
+
+
+/*
+ * stdp_process_spikes - handle all spikes of one time step
+ *
+ * pre_spiking and post_spiking hold one flag per neuron, as in the spiking
+ * member of a Population. All weight changes are computed from the traces
+ * just before time t, and only then the traces of the spiking neurons are
+ * bumped. Hence, simultaneous pre- and postsynaptic spikes do not interact,
+ * independent of the order in which they are processed.
+ *
+ * Returns false and logs an error if the flags do not match the size of the
+ * plasticity.
+ */
+template <typename T, typename Params>
+bool
+stdp_process_spikes(
+		STDPPlasticity<T, Params> &p,
+		std::span<const std::uint8_t> pre_spiking,
+		std::span<const std::uint8_t> post_spiking,
+		T t)
+{
+	if (pre_spiking.size() != stdp_num_pre(p) || post_spiking.size() != stdp_num_post(p)) {
+		log_error("Spike flags do not match the size of the plasticity in stdp_process_spikes.\n");
+		return false;
+	}
+
+	p._pre_spikes.clear();
+	for (size_t i = 0; i < pre_spiking.size(); i++)
+		if (pre_spiking[i])
+			p._pre_spikes.push_back(i);
+	p._post_spikes.clear();
+	for (size_t i = 0; i < post_spiking.size(); i++)
+		if (post_spiking[i])
+			p._post_spikes.push_back(i);
+
+	const auto tau = __stdp_taus(p.params);
+	for (auto i : p._pre_spikes)
+		__stdp_apply_pre(p, i, t, tau);
+	for (auto i : p._post_spikes)
+		__stdp_apply_post(p, i, t, tau);
+	for (auto i : p._pre_spikes)
+		__stdp_bump_pre_trace(p, i, t, tau);
+	for (auto i : p._post_spikes)
+		__stdp_bump_post_trace(p, i, t, tau);
+	return true;
+}
+
+
+/*
+ * stdp_step - apply plasticity to the spikes of two populations
+ *
+ * Call this after stepping both populations to time t. pre and post can be
+ * the same population for recurrent connectivity.
+ */
+template <typename T, typename Params, typename PrePopulation, typename PostPopulation>
+bool
+stdp_step(
+		STDPPlasticity<T, Params> &p,
+		const PrePopulation &pre,
+		const PostPopulation &post,
+		T t)
+{
+	return stdp_process_spikes(p,
+			std::span<const std::uint8_t>(pre.spiking),
+			std::span<const std::uint8_t>(post.spiking),
+			t);
+}
+
+
 
 /*
  *
  * Populations of identical neurons
  *
+ * Each neuron model provides its own structure-of-arrays Population together
+ * with make_population() and a step() kernel that advances all neurons at
+ * once. population_traits maps a neuron type to its population, such that
+ * generic code can use Population<NeuronType>. step() is found via ADL.
+ *
+ * Example:
+ *
+ *     Population<Izhikevich::Neuron<float>> pop =
+ *         Izhikevich::make_population<float>(100000, "tonic_spiking");
+ *     std::vector<float> I(population_size(pop), 10.0f);
+ *     float t = 0.0f, dt = 0.1_ms;
+ *     while (t < 1.0_s)
+ *         step(pop, t, dt, I.data());
+ *
  */
 template <typename NeuronType>
-struct Population {};
+struct population_traits;
+
+template <typename T>
+struct population_traits<Izhikevich::Neuron<T>>    { using type = Izhikevich::Population<T>; };
+
+template <typename T>
+struct population_traits<AdEx::Neuron<T>>          { using type = AdEx::Population<T>; };
+
+template <typename T>
+struct population_traits<LeakyIF::Neuron<T>>       { using type = LeakyIF::Population<T>; };
+
+template <typename T>
+struct population_traits<QuadraticIF::Neuron<T>>   { using type = QuadraticIF::Population<T>; };
+
+template <typename T>
+struct population_traits<HodgkinHuxley::Neuron<T>> { using type = HodgkinHuxley::Population<T>; };
+
+template <typename NeuronType>
+using Population = typename population_traits<NeuronType>::type;
 
 
 } // ncr::
@@ -13,11 +13,16 @@
 #pragma once
 
 #include <cmath>
+#include <cstdint>
+#include <limits>
+#include <algorithm>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
 // vector is required for N-D ODE solvers
 #include <ncr/ncr_vector.hpp>
+#include <ncr/ncr_utils.hpp>
 
 namespace ncr {
 
@@ -163,15 +168,17 @@ odesolve_step_rk2(
     //     yn = y + 0.5 * (k1 + k2)
     //     return xn, yn, h
 
-	// temporaries : TODO: can reduce one
-	vector_t<N, T> k1, k2;
+	// temporaries. The vector arithmetic below uses expression templates, which
+	// are evaluated directly into the stage input ys and into y_out
+	vector_t<N, T> k1, k2, ys;
 
 	// compute intermediate step k1
 	fn(t, y_in, k1, std::forward<Args>(args)...);
 	k1 *= dt;
 
 	// compute intermediate step k2
-	fn(t + dt, y_in + k1, k2, std::forward<Args>(args)...);
+	ys = y_in + k1;
+	fn(t + dt, ys, k2, std::forward<Args>(args)...);
 	k2 *= dt;
 
 	// compute final value
@@ -223,25 +230,27 @@ odesolve_step_rk4(
 		vector_t<N, T>       &y_out,
 		Args... args)
 {
-	// TODO: in this function, several temporaries get created. try to reduce
-	//       the number
-
-	vector_t<N, T> k1, k2, k3, k4;
+	// temporaries. The vector arithmetic below uses expression templates, which
+	// are evaluated directly into the stage input ys and into y_out
+	vector_t<N, T> k1, k2, k3, k4, ys;
 
 	// compute k1: k1 = dt * f(t, y);
 	fn(t, y_in, k1, std::forward<Args>(args)...);
 	k1 *= dt;
 
 	// compute k2: k2 = dt * f(t + 1./2. * dt, y + 1./2. * k1);
-	fn(t + 0.5 * dt, y_in + 0.5 * k1, k2, std::forward<Args>(args)...);
+	ys = y_in + 0.5 * k1;
+	fn(t + 0.5 * dt, ys, k2, std::forward<Args>(args)...);
 	k2 *= dt;
 
 	// compute k3: k3 = dt * f(t + 1./2. * dt, y + 1./2. * k2);
-	fn(t + 0.5 * dt, y_in + 0.5 * k2, k3, std::forward<Args>(args)...);
+	ys = y_in + 0.5 * k2;
+	fn(t + 0.5 * dt, ys, k3, std::forward<Args>(args)...);
 	k3 *= dt;
 
 	// compute k4: h * f(t + dt,         y + k3);
-	fn(t + dt, y_in + k3, k4, std::forward<Args>(args)...);
+	ys = y_in + k3;
+	fn(t + dt, ys, k4, std::forward<Args>(args)...);
 	k4 *= dt;
 
 	// assemble: yn = y + 1.0/6.0 * (k1 + 2.0*k2 + 2.0*k3 + k4);
@@ -309,10 +318,13 @@ odesolve_step_rkck_adaptive(
 		vector_t<N, T>       &y_out,
 		Args... args)
 {
-	// TODO: this function generates many temporaries, try to reduce this
-	vector_t<N, T> k1, k2, k3, k4, k5, k6, yn4, yn5;
+	// temporaries. The vector arithmetic below uses expression templates, such
+	// that each row of the Butcher tableau is evaluated in a single loop
+	// directly into the stage input ys
+	vector_t<N, T> k1, k2, k3, k4, k5, k6, ys, yn4;
 
-	// TODO: make the tolerance configurable
+	// Note: see the variant with an odesolve_adaptive_context below for
+	//       configurable tolerances
 	constexpr T tolerance = 1.0e-10;
 	T error = 2. * tolerance;
 
@@ -326,27 +338,31 @@ odesolve_step_rkck_adaptive(
         fn(t, y_in, k1, std::forward<Args>(args)...);
 		k1 *= dt;
 
-        fn(t + (1./5.) * dt, y_in + (1./5.)        * k1, k2, std::forward<Args>(args)...);
+        ys = y_in + (1./5.)        * k1;
+        fn(t + (1./5.) * dt, ys, k2, std::forward<Args>(args)...);
 		k2 *= dt;
 
-        fn(t + (3./10.)* dt, y_in + (3./40.)       * k1 + (9./40.)    * k2, k3, std::forward<Args>(args)...);
+        ys = y_in + (3./40.)       * k1 + (9./40.)    * k2;
+        fn(t + (3./10.)* dt, ys, k3, std::forward<Args>(args)...);
 		k3 *= dt;
 
-        fn(t + (3./5.) * dt, y_in + (3./10.)       * k1 - (9./10.)    * k2 + (6./5.)       * k3, k4, std::forward<Args>(args)...);
+        ys = y_in + (3./10.)       * k1 - (9./10.)    * k2 + (6./5.)       * k3;
+        fn(t + (3./5.) * dt, ys, k4, std::forward<Args>(args)...);
 		k4 *= dt;
 
-        fn(t + (1./1.) * dt, y_in - (11./54.)      * k1 + (5./2.)     * k2 - (70./27.)     * k3 + (35./27.)        * k4, k5, std::forward<Args>(args)...);
+        ys = y_in - (11./54.)      * k1 + (5./2.)     * k2 - (70./27.)     * k3 + (35./27.)        * k4;
+        fn(t + (1./1.) * dt, ys, k5, std::forward<Args>(args)...);
 		k5 *= dt;
 
-        fn(t + (7./8.) * dt, y_in + (1631./55296.) * k1 + (175./512.) * k2 + (575./13824.) * k3 + (44275./110592.) * k4 + (253./4096.) * k5, k6, std::forward<Args>(args)...);
+        ys = y_in + (1631./55296.) * k1 + (175./512.) * k2 + (575./13824.) * k3 + (44275./110592.) * k4 + (253./4096.) * k5;
+        fn(t + (7./8.) * dt, ys, k6, std::forward<Args>(args)...);
 		k6 *= dt;
 
-        // compute 4th and 5th order estimates
+        // compute 4th and 5th order estimates. The latter is only required
+        // for the error and therefore not stored
         yn4 = y_in + (37./378.)     * k1 + (250./621.)     * k3 + (125./594.)     * k4 +                      (512./1771.) * k6;
-        yn5 = y_in + (2825./27648.) * k1 + (18575./48384.) * k3 + (13525./55296.) * k4 + (277./14336.) * k5 + (1./4.)      * k6;
-
-		// TODO: this generates a temporary, maybe remove
-        error = (yn4 - yn5).asum();
+        error = error_norm(yn4,
+              y_in + (2825./27648.) * k1 + (18575./48384.) * k3 + (13525./55296.) * k4 + (277./14336.) * k5 + (1./4.)      * k6);
         if (error != 0.) {
             dt = 0.8 * dt * pow((tolerance / error), 0.25);
 		}
@@ -415,10 +431,13 @@ odesolve_step_rkdp_adaptive(
 		vector_t<N, T>       &y_out,
 		Args... args)
 {
-	// TODO: this function generates many temporaries, try to reduce this
-	vector_t<N, T> k1, k2, k3, k4, k5, k6, k7, yn5, yn6;
+	// temporaries. The vector arithmetic below uses expression templates, such
+	// that each row of the Butcher tableau is evaluated in a single loop
+	// directly into the stage input ys
+	vector_t<N, T> k1, k2, k3, k4, k5, k6, k7, ys, yn5;
 
-	// TODO: make the tolerance configurable
+	// Note: see the variant with an odesolve_adaptive_context below for
+	//       configurable tolerances
 	constexpr T tolerance = 1.0e-10;
 	T error = 2. * tolerance;
 
@@ -431,29 +450,35 @@ odesolve_step_rkdp_adaptive(
         fn(t, y_in, k1, std::forward<Args>(args)...);
 		k1 *= dt;
 
-        fn(t + (1./5.)  * dt, y_in + (1./5.)        * k1, k2, std::forward<Args>(args)...);
+        ys = y_in + (1./5.)        * k1;
+        fn(t + (1./5.)  * dt, ys, k2, std::forward<Args>(args)...);
 		k2 *= dt;
 
-        fn(t + (3./10.) * dt, y_in + (3./40.)       * k1 + (9./40.)       * k2, k3, std::forward<Args>(args)...);
+        ys = y_in + (3./40.)       * k1 + (9./40.)       * k2;
+        fn(t + (3./10.) * dt, ys, k3, std::forward<Args>(args)...);
 		k3 *= dt;
 
-        fn(t + (4./5.)  * dt, y_in + (44./45.)      * k1 - (56./15.)      * k2 + (32./9.)       * k3, k4, std::forward<Args>(args)...);
+        ys = y_in + (44./45.)      * k1 - (56./15.)      * k2 + (32./9.)       * k3;
+        fn(t + (4./5.)  * dt, ys, k4, std::forward<Args>(args)...);
 		k4 *= dt;
 
-        fn(t + (8./9.)  * dt, y_in + (19372./6561.) * k1 - (25360./2187.) * k2 + (64448./6561.) * k3 - (212./729.)  * k4, k5, std::forward<Args>(args)...);
+        ys = y_in + (19372./6561.) * k1 - (25360./2187.) * k2 + (64448./6561.) * k3 - (212./729.)  * k4;
+        fn(t + (8./9.)  * dt, ys, k5, std::forward<Args>(args)...);
 		k5 *= dt;
 
-        fn(t + (1./1.)  * dt, y_in + (9017./3168.)  * k1 - (355./33.)     * k2 + (46732./5247.) * k3 + (49./176.)   * k4 - (5103./18656.) * k5, k6, std::forward<Args>(args)...);
+        ys = y_in + (9017./3168.)  * k1 - (355./33.)     * k2 + (46732./5247.) * k3 + (49./176.)   * k4 - (5103./18656.) * k5;
+        fn(t + (1./1.)  * dt, ys, k6, std::forward<Args>(args)...);
 		k6 *= dt;
 
-        fn(t + (1./1.)  * dt, y_in + (35./384.)     * k1                       + (500./1113.)   * k3 + (125./192.)  * k4 - (2187./6784.)  * k5 + (11./84.) * k6, k7, std::forward<Args>(args)...);
+        ys = y_in + (35./384.)     * k1                       + (500./1113.)   * k3 + (125./192.)  * k4 - (2187./6784.)  * k5 + (11./84.) * k6;
+        fn(t + (1./1.)  * dt, ys, k7, std::forward<Args>(args)...);
 		k7 *= dt;
 
-        // compute estimates
+        // compute estimates. The higher order estimate is only required for
+        // the error and therefore not stored
         yn5 = y_in + (35./384.)     * k1 + (500./1113.)   * k3 + (125./192.) * k4 - (2187./6784.)    * k5 + (11./84.)    * k6;
-        yn6 = y_in + (5179./57600.) * k1 + (7571./16695.) * k3 + (393./640.) * k4 - (92097./339200.) * k5 + (187./2100.) * k6 + (1./40.) * k7;
-
-        error = (yn5 - yn6).asum();
+        error = error_norm(yn5,
+              y_in + (5179./57600.) * k1 + (7571./16695.) * k3 + (393./640.) * k4 - (92097./339200.) * k5 + (187./2100.) * k6 + (1./40.) * k7);
         // TODO: check if the adaptation is numerically correct
         if (error != 0.) {
             dt = 0.8 * dt * pow((tolerance / error), (1./4.));
@@ -463,6 +488,903 @@ odesolve_step_rkdp_adaptive(
 }
 
 
+/*
+ * Adaptive solvers with a context
+ *
+ * The following variants of the adaptive solvers use a context, which holds
+ * the configuration of the error control, statistics about the integration,
+ * and the last accepted step. The latter is used for dense output (e.g. to
+ * locate threshold crossings within a step) and to reuse the derivative at
+ * the end of the last step as first stage of the next one (first same as
+ * last, FSAL).
+ *
+ * In contrast to the solvers above, the error of a step is measured in the
+ * maximum norm of the component-wise error scaled by
+ *
+ *		abs_tol + rel_tol * max(|y_in[i]|, |y_out[i]|)
+ *
+ * and a step is accepted if the scaled error is at most 1. The stages are
+ * evaluated at t + c * dt, after which t advances by the accepted dt. On
+ * return, dt contains the step size proposed for the next step.
+ *
+ * Example:
+ *
+ *     odesolve_adaptive_context<2> ctx;
+ *     ctx.config.abs_tol = 1e-6;
+ *     ctx.config.rel_tol = 1e-4;
+ *     while (t < t_max) {
+ *         odesolve_step_rkdp_adaptive(ctx, fn, t, dt, y, y, args...);
+ *         if (odesolve_dense_crossing(ctx, 0, threshold, t_spike))
+ *             ...
+ *     }
+ */
+template <typename T = double>
+struct odesolve_adaptive_config
+{
+	// absolute and relative tolerance of the error control. If the resulting
+	// scale of a component is not positive, e.g. if abs_tol is 0 and the
+	// component is 0, it is replaced by machine epsilon
+	T        abs_tol      = T(1.0e-10);
+	T        rel_tol      = T(0.0);
+
+	// limits of the step size
+	T        dt_min       = T(0.0);
+	T        dt_max       = std::numeric_limits<T>::infinity();
+
+	// number of times a step is rejected and retried before the step is
+	// accepted anyway (see odesolve_adaptive_stats::n_forced)
+	unsigned max_retries  = 64;
+
+	// the step size is scaled by safety * err^(-1/5), limited to the range
+	// [shrink_min, grow_max]
+	T        safety       = T(0.9);
+	T        shrink_min   = T(0.2);
+	T        grow_max     = T(5.0);
+
+	// Cash & Karp: evaluate the derivative at the end of each accepted step.
+	// This enables dense output and is reused as first stage of the next
+	// step. Dormand & Prince always provides this without extra cost.
+	bool     dense_output = false;
+};
+
+
+/*
+ * odesolve_adaptive_stats - counters of an adaptive integration
+ */
+struct odesolve_adaptive_stats
+{
+	// accepted and rejected attempts
+	size_t n_accepted    = 0;
+	size_t n_rejected    = 0;
+
+	// steps that were accepted without meeting the tolerance, because either
+	// dt_min or max_retries was reached
+	size_t n_forced      = 0;
+
+	// evaluations of the dynamical system, and those that were saved by FSAL
+	size_t n_rhs_calls   = 0;
+	size_t n_fsal_reused = 0;
+};
+
+
+/*
+ * odesolve_adaptive_context - configuration, statistics and last step
+ */
+template <size_t N, typename T = double>
+struct odesolve_adaptive_context
+{
+	odesolve_adaptive_config<T> config;
+	odesolve_adaptive_stats     stats;
+
+	// last accepted step from (t0, y0) to (t1, y1), and the derivatives f0
+	// and f1 at both ends. f1 is only valid if f1_valid is true
+	bool           has_step = false;
+	bool           f1_valid = false;
+	T              t0 = T(0), t1 = T(0);
+	vector_t<N, T> y0, y1, f0, f1;
+};
+
+
+/*
+ * odesolve_adaptive_reset - forget the last step, but keep config and stats
+ *
+ * Call this whenever the state of the system was changed in between steps, for
+ * instance after a spike reset, and the change might not be detected (see
+ * __odesolve_adaptive_first_stage).
+ */
+template <size_t N, typename T>
+void
+odesolve_adaptive_reset(odesolve_adaptive_context<N, T> &ctx)
+{
+	ctx.has_step = false;
+	ctx.f1_valid = false;
+}
+
+
+/*
+ * __odesolve_adaptive_first_stage - compute or reuse f(t, y_in)
+ *
+ * The derivative at the end of the last step is only reused if the step ends
+ * exactly at (t, y_in), so that changes to the state in between steps are
+ * safe.
+ */
+template <size_t N, typename T, typename... Args>
+void
+__odesolve_adaptive_first_stage(
+		odesolve_adaptive_context<N, T> &ctx,
+		const dynamical_system_fn<N, T, Args...> fn,
+		const T t,
+		const vector_t<N, T> &y_in,
+		vector_t<N, T> &k1,
+		Args... args)
+{
+	bool reuse = ctx.has_step && ctx.f1_valid && t == ctx.t1;
+	for (size_t i = 0; reuse && i < N; i++)
+		reuse = y_in[i] == ctx.y1[i];
+
+	if (reuse) {
+		k1 = ctx.f1;
+		ctx.stats.n_fsal_reused++;
+	}
+	else {
+		fn(t, y_in, k1, std::forward<Args>(args)...);
+		ctx.stats.n_rhs_calls++;
+	}
+}
+
+
+/*
+ * __odesolve_positive_tolerance - replace a tolerance <= 0 by machine epsilon
+ *
+ * The error control divides by the tolerance, which thus must be positive.
+ */
+template <typename T>
+inline T
+__odesolve_positive_tolerance(const T tolerance)
+{
+	return tolerance > T(0) ? tolerance : std::numeric_limits<T>::epsilon();
+}
+
+
+/*
+ * __odesolve_adaptive_error - scaled error of the estimates ya and yb
+ */
+template <size_t N, typename T>
+T
+__odesolve_adaptive_error(
+		const odesolve_adaptive_config<T> &config,
+		const vector_t<N, T> &y_in,
+		const vector_t<N, T> &ya,
+		const vector_t<N, T> &yb)
+{
+	T err = T(0);
+	for (size_t i = 0; i < N; i++) {
+		const T scale = __odesolve_positive_tolerance(config.abs_tol + config.rel_tol * std::max(std::abs(y_in[i]), std::abs(ya[i])));
+		err = std::max(err, std::abs(ya[i] - yb[i]) / scale);
+	}
+	return err;
+}
+
+
+/*
+ * __odesolve_adaptive_control - decide about a step and adapt dt
+ *
+ * Returns true if the step of size dt with scaled error err should be accepted.
+ * In this case, dt_next is the proposal for the next step. Otherwise, dt_next
+ * is the step size for the retry.
+ */
+template <size_t N, typename T>
+bool
+__odesolve_adaptive_control(
+		odesolve_adaptive_context<N, T> &ctx,
+		const T err,
+		const T dt,
+		const unsigned retries,
+		T &dt_next)
+{
+	const odesolve_adaptive_config<T> &config = ctx.config;
+
+	T factor = config.grow_max;
+	if (err > T(0))
+		factor = std::clamp(config.safety * std::pow(err, T(-0.2)), config.shrink_min, config.grow_max);
+
+	bool accept = err <= T(1);
+	if (!accept && (retries >= config.max_retries || dt <= config.dt_min)) {
+		ctx.stats.n_forced++;
+		accept = true;
+	}
+
+	// don't increase the step size right after a rejection
+	if (retries > 0)
+		factor = std::min(factor, T(1));
+
+	dt_next = std::clamp(dt * factor, config.dt_min, config.dt_max);
+	if (accept)
+		ctx.stats.n_accepted++;
+	else
+		ctx.stats.n_rejected++;
+	return accept;
+}
+
+
+/*
+ * __odesolve_adaptive_record - store an accepted step in the context
+ */
+template <size_t N, typename T>
+void
+__odesolve_adaptive_record(
+		odesolve_adaptive_context<N, T> &ctx,
+		const T t0,
+		const T t1,
+		const vector_t<N, T> &y0,
+		const vector_t<N, T> &y1,
+		const vector_t<N, T> &f0)
+{
+	ctx.has_step = true;
+	ctx.f1_valid = false;
+	ctx.t0 = t0;
+	ctx.t1 = t1;
+	ctx.y0 = y0;
+	ctx.y1 = y1;
+	ctx.f0 = f0;
+}
+
+
+/*
+ * odesolve_step_rkck_adaptive - adaptive Cash & Karp step with a context
+ *
+ * Returns false if the step was accepted without meeting the tolerance, see
+ * odesolve_adaptive_config::max_retries.
+ */
+template <size_t N, typename T, typename... Args>
+bool
+odesolve_step_rkck_adaptive(
+		odesolve_adaptive_context<N, T> &ctx,
+		const dynamical_system_fn<N, T, Args...> fn,
+		T &t,
+		T &dt,
+		const vector_t<N, T> &y_in,
+		vector_t<N, T>       &y_out,
+		Args... args)
+{
+	vector_t<N, T> k1, k2, k3, k4, k5, k6, ys, yn4, y0;
+	const odesolve_adaptive_config<T> &config = ctx.config;
+
+	// y_out and y_in may be the same vector
+	y0 = y_in;
+	__odesolve_adaptive_first_stage(ctx, fn, t, y0, k1, std::forward<Args>(args)...);
+
+	dt = std::clamp(dt, config.dt_min, config.dt_max);
+	bool within_tolerance = true;
+	for (unsigned retries = 0; ; retries++) {
+		// for why those numbers, see Cash & Karp, 1990, Table (5) on page 206.
+		// Note that the stages are not scaled by dt, but the coefficients are
+		ys = y0 + ((1./5.) * dt) * k1;
+		fn(t + (1./5.) * dt, ys, k2, std::forward<Args>(args)...);
+
+		ys = y0 + ((3./40.) * dt) * k1 + ((9./40.) * dt) * k2;
+		fn(t + (3./10.) * dt, ys, k3, std::forward<Args>(args)...);
+
+		ys = y0 + ((3./10.) * dt) * k1 - ((9./10.) * dt) * k2 + ((6./5.) * dt) * k3;
+		fn(t + (3./5.) * dt, ys, k4, std::forward<Args>(args)...);
+
+		ys = y0 - ((11./54.) * dt) * k1 + ((5./2.) * dt) * k2 - ((70./27.) * dt) * k3 + ((35./27.) * dt) * k4;
+		fn(t + dt, ys, k5, std::forward<Args>(args)...);
+
+		ys = y0 + ((1631./55296.) * dt) * k1 + ((175./512.) * dt) * k2 + ((575./13824.) * dt) * k3 + ((44275./110592.) * dt) * k4 + ((253./4096.) * dt) * k5;
+		fn(t + (7./8.) * dt, ys, k6, std::forward<Args>(args)...);
+		ctx.stats.n_rhs_calls += 5;
+
+		// 5th order solution and embedded 4th order estimate (in ys)
+		yn4 = y0 + ((37./378.) * dt) * k1 + ((250./621.) * dt) * k3 + ((125./594.) * dt) * k4 + ((512./1771.) * dt) * k6;
+		ys  = y0 + ((2825./27648.) * dt) * k1 + ((18575./48384.) * dt) * k3 + ((13525./55296.) * dt) * k4 + ((277./14336.) * dt) * k5 + ((1./4.) * dt) * k6;
+
+		const T err = __odesolve_adaptive_error(config, y0, yn4, ys);
+		T dt_next;
+		if (__odesolve_adaptive_control(ctx, err, dt, retries, dt_next)) {
+			within_tolerance = err <= T(1);
+			y_out = yn4;
+			__odesolve_adaptive_record(ctx, t, t + dt, y0, yn4, k1);
+			t += dt;
+			dt = dt_next;
+			break;
+		}
+		dt = dt_next;
+	}
+
+	// derivative at the end of the step, if requested
+	if (config.dense_output) {
+		fn(ctx.t1, ctx.y1, ctx.f1, std::forward<Args>(args)...);
+		ctx.stats.n_rhs_calls++;
+		ctx.f1_valid = true;
+	}
+	return within_tolerance;
+}
+
+
+/*
+ * odesolve_step_rkdp_adaptive - adaptive Dormand & Prince step with a context
+ *
+ * The last stage is evaluated at the end of the step and is thus reused as the
+ * first stage of the next step (FSAL), and for dense output. Returns false if
+ * the step was accepted without meeting the tolerance.
+ */
+template <size_t N, typename T, typename... Args>
+bool
+odesolve_step_rkdp_adaptive(
+		odesolve_adaptive_context<N, T> &ctx,
+		const dynamical_system_fn<N, T, Args...> fn,
+		T &t,
+		T &dt,
+		const vector_t<N, T> &y_in,
+		vector_t<N, T>       &y_out,
+		Args... args)
+{
+	vector_t<N, T> k1, k2, k3, k4, k5, k6, k7, ys, yn6, y0;
+	const odesolve_adaptive_config<T> &config = ctx.config;
+
+	// y_out and y_in may be the same vector
+	y0 = y_in;
+	__odesolve_adaptive_first_stage(ctx, fn, t, y0, k1, std::forward<Args>(args)...);
+
+	dt = std::clamp(dt, config.dt_min, config.dt_max);
+	bool within_tolerance = true;
+	for (unsigned retries = 0; ; retries++) {
+		// Note that the stages are not scaled by dt, but the coefficients are
+		ys = y0 + ((1./5.) * dt) * k1;
+		fn(t + (1./5.) * dt, ys, k2, std::forward<Args>(args)...);
+
+		ys = y0 + ((3./40.) * dt) * k1 + ((9./40.) * dt) * k2;
+		fn(t + (3./10.) * dt, ys, k3, std::forward<Args>(args)...);
+
+		ys = y0 + ((44./45.) * dt) * k1 - ((56./15.) * dt) * k2 + ((32./9.) * dt) * k3;
+		fn(t + (4./5.) * dt, ys, k4, std::forward<Args>(args)...);
+
+		ys = y0 + ((19372./6561.) * dt) * k1 - ((25360./2187.) * dt) * k2 + ((64448./6561.) * dt) * k3 - ((212./729.) * dt) * k4;
+		fn(t + (8./9.) * dt, ys, k5, std::forward<Args>(args)...);
+
+		ys = y0 + ((9017./3168.) * dt) * k1 - ((355./33.) * dt) * k2 + ((46732./5247.) * dt) * k3 + ((49./176.) * dt) * k4 - ((5103./18656.) * dt) * k5;
+		fn(t + dt, ys, k6, std::forward<Args>(args)...);
+
+		// the input of the last stage is the 5th order solution
+		ys = y0 + ((35./384.) * dt) * k1 + ((500./1113.) * dt) * k3 + ((125./192.) * dt) * k4 - ((2187./6784.) * dt) * k5 + ((11./84.) * dt) * k6;
+		fn(t + dt, ys, k7, std::forward<Args>(args)...);
+		ctx.stats.n_rhs_calls += 6;
+
+		yn6 = y0 + ((5179./57600.) * dt) * k1 + ((7571./16695.) * dt) * k3 + ((393./640.) * dt) * k4 - ((92097./339200.) * dt) * k5 + ((187./2100.) * dt) * k6 + ((1./40.) * dt) * k7;
+
+		const T err = __odesolve_adaptive_error(config, y0, ys, yn6);
+		T dt_next;
+		if (__odesolve_adaptive_control(ctx, err, dt, retries, dt_next)) {
+			within_tolerance = err <= T(1);
+			y_out = ys;
+			__odesolve_adaptive_record(ctx, t, t + dt, y0, ys, k1);
+			ctx.f1 = k7;
+			ctx.f1_valid = true;
+			t += dt;
+			dt = dt_next;
+			break;
+		}
+		dt = dt_next;
+	}
+	return within_tolerance;
+}
+
+
+/*
+ * __odesolve_dense_component - cubic Hermite interpolant of one component
+ */
+template <size_t N, typename T>
+T
+__odesolve_dense_component(const odesolve_adaptive_context<N, T> &ctx, const size_t i, const T s)
+{
+	const T h   = ctx.t1 - ctx.t0;
+	const T s2  = s * s;
+	const T s3  = s2 * s;
+	const T h00 = T(2) * s3 - T(3) * s2 + T(1);
+	const T h10 = s3 - T(2) * s2 + s;
+	const T h01 = T(-2) * s3 + T(3) * s2;
+	const T h11 = s3 - s2;
+	return h00 * ctx.y0[i] + h10 * h * ctx.f0[i] + h01 * ctx.y1[i] + h11 * h * ctx.f1[i];
+}
+
+
+/*
+ * odesolve_dense_eval - evaluate the last accepted step at time t
+ *
+ * Uses cubic Hermite interpolation between both ends of the step, which is
+ * third order accurate. t should be within [ctx.t0, ctx.t1]. Returns false if
+ * there is no step, or if the derivative at its end is not known (see
+ * odesolve_adaptive_config::dense_output).
+ */
+template <size_t N, typename T>
+bool
+odesolve_dense_eval(const odesolve_adaptive_context<N, T> &ctx, const T t, vector_t<N, T> &y)
+{
+	if (!ctx.has_step || !ctx.f1_valid)
+		return false;
+
+	const T h = ctx.t1 - ctx.t0;
+	const T s = h > T(0) ? (t - ctx.t0) / h : T(1);
+	for (size_t i = 0; i < N; i++)
+		y[i] = __odesolve_dense_component(ctx, i, s);
+	return true;
+}
+
+
+/*
+ * odesolve_dense_crossing - locate a threshold crossing in the last step
+ *
+ * Checks if component i of the state crossed threshold (in either direction)
+ * during the last accepted step, and if so locates the time of the crossing on
+ * the dense output via bisection. Note that only a change of sign between the
+ * two ends of the step is detected.
+ */
+template <size_t N, typename T>
+bool
+odesolve_dense_crossing(
+		const odesolve_adaptive_context<N, T> &ctx,
+		const size_t i,
+		const T threshold,
+		T &t_cross)
+{
+	if (!ctx.has_step || !ctx.f1_valid)
+		return false;
+
+	const T g0 = ctx.y0[i] - threshold;
+	const T g1 = ctx.y1[i] - threshold;
+	if (g0 == T(0) || (g0 < T(0)) == (g1 < T(0)))
+		return false;
+
+	T lo = T(0), hi = T(1);
+	for (unsigned iter = 0; iter < 60 && hi - lo > std::numeric_limits<T>::epsilon(); iter++) {
+		const T mid = T(0.5) * (lo + hi);
+		const T g   = __odesolve_dense_component(ctx, i, mid) - threshold;
+		if ((g < T(0)) == (g0 < T(0)))
+			lo = mid;
+		else
+			hi = mid;
+	}
+	t_cross = ctx.t0 + hi * (ctx.t1 - ctx.t0);
+	return true;
+}
+
+
+/*
+ * Batched ODE solvers
+ *
+ * The following steppers advance M independent systems of dimension N at once.
+ * The state of all systems is stored as a structure of arrays, i.e. component
+ * d of system j is at y[d * M + j], such that each component forms a
+ * contiguous lane of M values. Instead of a function pointer per system, the
+ * right hand side is a functor which computes the derivatives of all systems
+ * in one call and can thus be inlined and vectorized by the compiler.
+ *
+ * The fixed step solvers share one t and one dt across all systems, and their
+ * right hand side is called as
+ *
+ *		fn(const T t, const T *y, T *dydt, const size_t M)
+ *
+ * where y and dydt are blocks of N * M values in the layout described above.
+ * The adaptive solvers keep a separate t and dt for each system, see
+ * odesolve_step_rkck_adaptive_batch below. In all batched solvers, y_out may
+ * be the same block as y_in.
+ *
+ * Example:
+ *
+ *     odesolve_batch_workspace<double> ws;
+ *     std::vector<double> y(2 * M);
+ *     auto fn = [](double t, const double *y, double *dydt, size_t M) {
+ *         NCR_IVDEP
+ *         for (size_t j = 0; j < M; j++) {
+ *             dydt[j]     =  y[M + j];
+ *             dydt[M + j] = -y[j];
+ *         }
+ *     };
+ *     odesolve_step_rk4_batch<2>(fn, t, dt, M, y.data(), y.data(), ws);
+ */
+
+
+/*
+ * odesolve_batch_workspace - scratch memory of the batched solvers
+ *
+ * The buffers only grow, such that repeated steps of the same batch size do
+ * not allocate.
+ */
+template <typename T = double>
+struct odesolve_batch_workspace
+{
+	std::vector<T> buffer;
+
+	// get memory for n_blocks blocks of n values each
+	T*
+	get(size_t n_blocks, size_t n)
+	{
+		if (this->buffer.size() < n_blocks * n)
+			this->buffer.resize(n_blocks * n);
+		return this->buffer.data();
+	}
+};
+
+
+/*
+ * __odesolve_batch_row - evaluate one row of a Butcher tableau
+ *
+ * Computes out = y + sum_s a[s] * k[s] over n values. The sum is accumulated
+ * from left to right, i.e. in the same order as in the single system solvers.
+ */
+template <size_t S, typename T>
+inline void
+__odesolve_batch_row(
+		T *out,
+		const T *y,
+		const T (&a)[S],
+		const T *const (&k)[S],
+		const size_t n)
+{
+	NCR_IVDEP
+	for (size_t i = 0; i < n; i++) {
+		T acc = y[i];
+		for (size_t s = 0; s < S; s++)
+			acc += a[s] * k[s][i];
+		out[i] = acc;
+	}
+}
+
+
+/*
+ * __odesolve_batch_scale - multiply n values by dt
+ */
+template <typename T>
+inline void
+__odesolve_batch_scale(T *k, const T dt, const size_t n)
+{
+	NCR_IVDEP
+	for (size_t i = 0; i < n; i++)
+		k[i] *= dt;
+}
+
+
+/*
+ * odesolve_step_euler_batch - single Euler step for M systems
+ */
+template <size_t N, typename T, typename Fn>
+void
+odesolve_step_euler_batch(
+		Fn &&fn,
+		T &t,
+		const T dt,
+		const size_t M,
+		const T *y_in,
+		T *y_out,
+		odesolve_batch_workspace<T> &ws)
+{
+	const size_t n = N * M;
+	T *k1 = ws.get(1, n);
+
+	fn(t, y_in, k1, M);
+	__odesolve_batch_row<1>(y_out, y_in, {dt}, {k1}, n);
+	t += dt;
+}
+
+
+/*
+ * odesolve_step_rk2_batch - Runge Kutta 2nd order step for M systems
+ */
+template <size_t N, typename T, typename Fn>
+void
+odesolve_step_rk2_batch(
+		Fn &&fn,
+		T &t,
+		const T dt,
+		const size_t M,
+		const T *y_in,
+		T *y_out,
+		odesolve_batch_workspace<T> &ws)
+{
+	const size_t n = N * M;
+	T *k1 = ws.get(3, n);
+	T *k2 = k1 + n;
+	T *ys = k2 + n;
+
+	fn(t, y_in, k1, M);
+	__odesolve_batch_scale(k1, dt, n);
+
+	__odesolve_batch_row<1>(ys, y_in, {T(1.0)}, {k1}, n);
+	fn(t + dt, ys, k2, M);
+	__odesolve_batch_scale(k2, dt, n);
+
+	// y_in + 0.5 * (k1 + k2)
+	NCR_IVDEP
+	for (size_t i = 0; i < n; i++)
+		y_out[i] = y_in[i] + T(0.5) * (k1[i] + k2[i]);
+
+	t += dt;
+}
+
+
+/*
+ * odesolve_step_rk4_batch - Runge Kutta 4th order step for M systems
+ */
+template <size_t N, typename T, typename Fn>
+void
+odesolve_step_rk4_batch(
+		Fn &&fn,
+		T &t,
+		const T dt,
+		const size_t M,
+		const T *y_in,
+		T *y_out,
+		odesolve_batch_workspace<T> &ws)
+{
+	const size_t n = N * M;
+	T *k1 = ws.get(5, n);
+	T *k2 = k1 + n;
+	T *k3 = k2 + n;
+	T *k4 = k3 + n;
+	T *ys = k4 + n;
+
+	fn(t, y_in, k1, M);
+	__odesolve_batch_scale(k1, dt, n);
+
+	__odesolve_batch_row<1>(ys, y_in, {T(0.5)}, {k1}, n);
+	fn(t + T(0.5) * dt, ys, k2, M);
+	__odesolve_batch_scale(k2, dt, n);
+
+	__odesolve_batch_row<1>(ys, y_in, {T(0.5)}, {k2}, n);
+	fn(t + T(0.5) * dt, ys, k3, M);
+	__odesolve_batch_scale(k3, dt, n);
+
+	__odesolve_batch_row<1>(ys, y_in, {T(1.0)}, {k3}, n);
+	fn(t + dt, ys, k4, M);
+	__odesolve_batch_scale(k4, dt, n);
+
+	// y_in + 1.0/6.0 * (k1 + 2.0 * k2 + 2.0 * k3 + k4)
+	NCR_IVDEP
+	for (size_t i = 0; i < n; i++)
+		y_out[i] = y_in[i] + T(1.0/6.0) * (k1[i] + T(2.0) * k2[i] + T(2.0) * k3[i] + k4[i]);
+
+	t += dt;
+}
+
+
+/*
+ * __odesolve_batch_stage_times - per system time of a stage, t + c * dt
+ */
+template <typename T>
+inline void
+__odesolve_batch_stage_times(T *ts, const T *t, const T *dt, const T c, const size_t M)
+{
+	NCR_IVDEP
+	for (size_t j = 0; j < M; j++)
+		ts[j] = t[j] + c * dt[j];
+}
+
+
+/*
+ * __odesolve_batch_scale_lanes - multiply each component of system j by dt[j]
+ */
+template <size_t N, typename T>
+inline void
+__odesolve_batch_scale_lanes(T *k, const T *dt, const size_t M)
+{
+	for (size_t d = 0; d < N; d++) {
+		T *kd = k + d * M;
+		NCR_IVDEP
+		for (size_t j = 0; j < M; j++)
+			kd[j] *= dt[j];
+	}
+}
+
+
+/*
+ * __odesolve_batch_accept - per system error control of the adaptive solvers
+ *
+ * Compares the two estimates ya and yb of each system. Systems whose error in
+ * the L1 norm (as in the single system solvers) is within the tolerance take
+ * ya as their new state and advance their time. All other systems keep their
+ * state and time. The step size of every system is adapted to its error.
+ * A tolerance <= 0 is replaced by machine epsilon. Returns the number of
+ * accepted systems.
+ */
+template <size_t N, typename T>
+inline size_t
+__odesolve_batch_accept(
+		const size_t M,
+		const T tol,
+		const T exponent,
+		T *t,
+		T *dt,
+		const T *y_in,
+		T *y_out,
+		const T *ya,
+		const T *yb,
+		T *err,
+		std::uint8_t *accepted)
+{
+	const T tolerance = __odesolve_positive_tolerance(tol);
+	std::fill(err, err + M, T(0));
+	for (size_t d = 0; d < N; d++) {
+		const T *a = ya + d * M;
+		const T *b = yb + d * M;
+		NCR_IVDEP
+		for (size_t j = 0; j < M; j++)
+			err[j] += std::abs(a[j] - b[j]);
+	}
+
+	size_t n_accepted = 0;
+	for (size_t j = 0; j < M; j++) {
+		const bool accept = err[j] <= tolerance;
+		if (accept)
+			t[j] += dt[j];
+		if (err[j] != T(0))
+			dt[j] = T(0.8) * dt[j] * std::pow(tolerance / err[j], exponent);
+		if (accepted)
+			accepted[j] = accept;
+		n_accepted += accept;
+	}
+
+	for (size_t d = 0; d < N; d++) {
+		const T *a  = ya   + d * M;
+		const T *yi = y_in + d * M;
+		T *yo       = y_out + d * M;
+		NCR_IVDEP
+		for (size_t j = 0; j < M; j++)
+			yo[j] = err[j] <= tolerance ? a[j] : yi[j];
+	}
+	return n_accepted;
+}
+
+
+/*
+ * odesolve_step_rkck_adaptive_batch - adaptive Cash & Karp step for M systems
+ *
+ * In contrast to the fixed step batch solvers, each system j has its own time
+ * t[j] and step size dt[j], and the right hand side is called as
+ *
+ *		fn(const T *t, const T *y, T *dydt, const size_t M)
+ *
+ * with one time per system. A call performs a single attempt for all systems
+ * in lockstep. Systems with an error estimate within tolerance are advanced,
+ * while rejected systems keep their state and time and retry with a reduced
+ * step size on the next call. If accepted is not nullptr, it receives one
+ * flag per system. Returns the number of accepted systems.
+ */
+template <size_t N, typename T, typename Fn>
+size_t
+odesolve_step_rkck_adaptive_batch(
+		Fn &&fn,
+		T *t,
+		T *dt,
+		const size_t M,
+		const T *y_in,
+		T *y_out,
+		odesolve_batch_workspace<T> &ws,
+		std::uint8_t *accepted = nullptr,
+		const T tolerance = T(1.0e-10))
+{
+	const size_t n = N * M;
+	T *k1  = ws.get(9 * N + 2, M);
+	T *k2  = k1 + n;
+	T *k3  = k2 + n;
+	T *k4  = k3 + n;
+	T *k5  = k4 + n;
+	T *k6  = k5 + n;
+	T *ys  = k6 + n;
+	T *yn4 = ys + n;
+	T *yn5 = yn4 + n;
+	T *ts  = yn5 + n;
+	T *err = ts + M;
+
+	// for why those numbers, see Cash & Karp, 1990, Table (5) on page 206.
+	fn(t, y_in, k1, M);
+	__odesolve_batch_scale_lanes<N>(k1, dt, M);
+
+	__odesolve_batch_stage_times(ts, t, dt, T(1./5.), M);
+	__odesolve_batch_row<1>(ys, y_in, {T(1./5.)}, {k1}, n);
+	fn(ts, ys, k2, M);
+	__odesolve_batch_scale_lanes<N>(k2, dt, M);
+
+	__odesolve_batch_stage_times(ts, t, dt, T(3./10.), M);
+	__odesolve_batch_row<2>(ys, y_in, {T(3./40.), T(9./40.)}, {k1, k2}, n);
+	fn(ts, ys, k3, M);
+	__odesolve_batch_scale_lanes<N>(k3, dt, M);
+
+	__odesolve_batch_stage_times(ts, t, dt, T(3./5.), M);
+	__odesolve_batch_row<3>(ys, y_in, {T(3./10.), T(-9./10.), T(6./5.)}, {k1, k2, k3}, n);
+	fn(ts, ys, k4, M);
+	__odesolve_batch_scale_lanes<N>(k4, dt, M);
+
+	__odesolve_batch_stage_times(ts, t, dt, T(1./1.), M);
+	__odesolve_batch_row<4>(ys, y_in, {T(-11./54.), T(5./2.), T(-70./27.), T(35./27.)}, {k1, k2, k3, k4}, n);
+	fn(ts, ys, k5, M);
+	__odesolve_batch_scale_lanes<N>(k5, dt, M);
+
+	__odesolve_batch_stage_times(ts, t, dt, T(7./8.), M);
+	__odesolve_batch_row<5>(ys, y_in, {T(1631./55296.), T(175./512.), T(575./13824.), T(44275./110592.), T(253./4096.)}, {k1, k2, k3, k4, k5}, n);
+	fn(ts, ys, k6, M);
+	__odesolve_batch_scale_lanes<N>(k6, dt, M);
+
+	// compute 4th and 5th order estimates
+	__odesolve_batch_row<4>(yn4, y_in, {T(37./378.), T(250./621.), T(125./594.), T(512./1771.)}, {k1, k3, k4, k6}, n);
+	__odesolve_batch_row<5>(yn5, y_in, {T(2825./27648.), T(18575./48384.), T(13525./55296.), T(277./14336.), T(1./4.)}, {k1, k3, k4, k5, k6}, n);
+
+	return __odesolve_batch_accept<N>(M, tolerance, T(0.25), t, dt, y_in, y_out, yn4, yn5, err, accepted);
+}
+
+
+/*
+ * odesolve_step_rkdp_adaptive_batch - adaptive Dormand & Prince step for M systems
+ *
+ * See odesolve_step_rkck_adaptive_batch for details on the interface.
+ */
+template <size_t N, typename T, typename Fn>
+size_t
+odesolve_step_rkdp_adaptive_batch(
+		Fn &&fn,
+		T *t,
+		T *dt,
+		const size_t M,
+		const T *y_in,
+		T *y_out,
+		odesolve_batch_workspace<T> &ws,
+		std::uint8_t *accepted = nullptr,
+		const T tolerance = T(1.0e-10))
+{
+	const size_t n = N * M;
+	T *k1  = ws.get(9 * N + 2, M);
+	T *k2  = k1 + n;
+	T *k3  = k2 + n;
+	T *k4  = k3 + n;
+	T *k5  = k4 + n;
+	T *k6  = k5 + n;
+	T *k7  = k6 + n;
+	T *ys  = k7 + n;
+	T *yn6 = ys + n;
+	T *ts  = yn6 + n;
+	T *err = ts + M;
+
+	fn(t, y_in, k1, M);
+	__odesolve_batch_scale_lanes<N>(k1, dt, M);
+
+	__odesolve_batch_stage_times(ts, t, dt, T(1./5.), M);
+	__odesolve_batch_row<1>(ys, y_in, {T(1./5.)}, {k1}, n);
+	fn(ts, ys, k2, M);
+	__odesolve_batch_scale_lanes<N>(k2, dt, M);
+
+	__odesolve_batch_stage_times(ts, t, dt, T(3./10.), M);
+	__odesolve_batch_row<2>(ys, y_in, {T(3./40.), T(9./40.)}, {k1, k2}, n);
+	fn(ts, ys, k3, M);
+	__odesolve_batch_scale_lanes<N>(k3, dt, M);
+
+	__odesolve_batch_stage_times(ts, t, dt, T(4./5.), M);
+	__odesolve_batch_row<3>(ys, y_in, {T(44./45.), T(-56./15.), T(32./9.)}, {k1, k2, k3}, n);
+	fn(ts, ys, k4, M);
+	__odesolve_batch_scale_lanes<N>(k4, dt, M);
+
+	__odesolve_batch_stage_times(ts, t, dt, T(8./9.), M);
+	__odesolve_batch_row<4>(ys, y_in, {T(19372./6561.), T(-25360./2187.), T(64448./6561.), T(-212./729.)}, {k1, k2, k3, k4}, n);
+	fn(ts, ys, k5, M);
+	__odesolve_batch_scale_lanes<N>(k5, dt, M);
+
+	__odesolve_batch_stage_times(ts, t, dt, T(1./1.), M);
+	__odesolve_batch_row<5>(ys, y_in, {T(9017./3168.), T(-355./33.), T(46732./5247.), T(49./176.), T(-5103./18656.)}, {k1, k2, k3, k4, k5}, n);
+	fn(ts, ys, k6, M);
+	__odesolve_batch_scale_lanes<N>(k6, dt, M);
+
+	// the input of the last stage is the same as the 5th order estimate
+	__odesolve_batch_row<5>(ys, y_in, {T(35./384.), T(500./1113.), T(125./192.), T(-2187./6784.), T(11./84.)}, {k1, k3, k4, k5, k6}, n);
+	fn(ts, ys, k7, M);
+	__odesolve_batch_scale_lanes<N>(k7, dt, M);
+
+	// compute estimates
+	const T *yn5 = ys;
+	__odesolve_batch_row<6>(yn6, y_in, {T(5179./57600.), T(7571./16695.), T(393./640.), T(-92097./339200.), T(187./2100.), T(1./40.)}, {k1, k3, k4, k5, k6, k7}, n);
+
+	return __odesolve_batch_accept<N>(M, tolerance, T(0.25), t, dt, y_in, y_out, yn5, yn6, err, accepted);
+}
+
+
 /*
  * result of a solver call consists of the values as well as the steps where the
  * values were computed
@@ -473,6 +1395,203 @@ struct solver_result_1D_t {
 };
 
 
+/*
+ * Streaming ODE drivers
+ *
+ * The drivers below integrate from t0 to tmax and hand each sample (t, y) to a
+ * sink instead of collecting all of them. The sink is a callable
+ *
+ *		sink(t, y)
+ *
+ * which may return bool. If it returns false, the integration stops after the
+ * current step. The initial value is always passed to the sink. Afterwards,
+ * only every decimate-th step is passed along, as well as the final step, such
+ * that the sink always sees the end of the integration. Besides any callable,
+ * an odesolve_ring_buffer can be used as sink to keep only the most recent
+ * samples, and the _into variants write into caller provided buffers.
+ */
+
+
+/*
+ * __odesolve_clamp_dt - avoid that a step exceeds tmax
+ */
+template <typename T>
+inline T
+__odesolve_clamp_dt(const T t, const T tmax, T dt)
+{
+	// epsilon to check during computation of dt to catch the most sever
+	// rounding errors at the end of an integration
+	constexpr T eps = 1e-10;
+
+	// don't exceed tmax during integration
+	dt = std::min(dt, tmax - t);
+	// try to minimize rounding errors
+	if (dt + eps >= tmax - t)
+		dt = tmax - t;
+	return dt;
+}
+
+
+/*
+ * __odesolve_emit - pass a sample to a sink, returns false if the sink wants
+ * to stop
+ */
+template <typename Sink, typename T, typename Y>
+inline bool
+__odesolve_emit(Sink &sink, const T t, const Y &y)
+{
+	if constexpr (std::is_same_v<std::invoke_result_t<Sink&, const T, const Y&>, bool>)
+		return sink(t, y);
+	else {
+		sink(t, y);
+		return true;
+	}
+}
+
+
+/*
+ * odesolve_ring_buffer - sink that keeps the most recent capacity samples
+ *
+ * The values of sample k are stored at ys[k * N], and get() returns the k-th
+ * oldest sample still in the buffer.
+ */
+template <size_t N, typename T = double>
+struct odesolve_ring_buffer
+{
+	std::vector<T> ts;
+	std::vector<T> ys;
+	size_t         head  = 0;
+	size_t         count = 0;
+
+	explicit odesolve_ring_buffer(size_t capacity)
+	: ts(capacity)
+	, ys(capacity * N)
+	{
+		assert(capacity > 0);
+	}
+
+	size_t capacity() const { return this->ts.size(); }
+	size_t size() const     { return this->count; }
+
+	void
+	operator()(const T t, const vector_t<N, T> &y)
+	{
+		T *dst = &this->ys[this->head * N];
+		for (size_t i = 0; i < N; i++)
+			dst[i] = y[i];
+		this->_push(t);
+	}
+
+	void
+	operator()(const T t, const T y) requires (N == 1)
+	{
+		this->ys[this->head] = y;
+		this->_push(t);
+	}
+
+	// time and pointer to the N values of the k-th oldest sample
+	std::pair<T, const T*>
+	get(size_t k) const
+	{
+		assert(k < this->count);
+		const size_t idx = (this->head + this->capacity() - this->count + k) % this->capacity();
+		return {this->ts[idx], &this->ys[idx * N]};
+	}
+
+	void
+	clear()
+	{
+		this->head  = 0;
+		this->count = 0;
+	}
+
+private:
+	void
+	_push(const T t)
+	{
+		this->ts[this->head] = t;
+		this->head = (this->head + 1) % this->capacity();
+		this->count = std::min(this->count + 1, this->capacity());
+	}
+};
+
+
+/*
+ * odesolve_1D_stream - solve a 1D system and stream the samples to a sink
+ *
+ * Returns the number of samples that were passed to the sink.
+ */
+template <typename Sink>
+size_t
+odesolve_1D_stream(
+		solver_step_1D_fn solver,
+		differential_1D_fn f,
+		double t0,
+		double tmax,
+		double dt,
+		double yInit,
+		Sink &&sink,
+		size_t decimate = 1)
+{
+	if (decimate == 0)
+		decimate = 1;
+
+	size_t n_emitted = 1;
+	if (!__odesolve_emit(sink, t0, yInit))
+		return n_emitted;
+
+	double t = t0;
+	double yn = yInit;
+	for (size_t step = 1; t < tmax; step++) {
+		dt = __odesolve_clamp_dt(t, tmax, dt);
+
+		// integration step (note: t and dt are changed by calling solver)
+		yn = solver(f, t, dt, yn);
+
+		if (step % decimate == 0 || !(t < tmax)) {
+			n_emitted++;
+			if (!__odesolve_emit(sink, t, yn))
+				break;
+		}
+	}
+	return n_emitted;
+}
+
+
+/*
+ * odesolve_1D_into - solve a 1D system into preallocated buffers
+ *
+ * ts and ys must have room for capacity samples each. The integration stops
+ * when the buffers are full. Returns the number of samples written.
+ */
+inline size_t
+odesolve_1D_into(
+		solver_step_1D_fn solver,
+		differential_1D_fn f,
+		double t0,
+		double tmax,
+		double dt,
+		double yInit,
+		double *ts,
+		double *ys,
+		size_t capacity,
+		size_t decimate = 1)
+{
+	if (capacity == 0)
+		return 0;
+
+	size_t n = 0;
+	odesolve_1D_stream(solver, f, t0, tmax, dt, yInit,
+		[&](double t, double y) -> bool {
+			ts[n] = t;
+			ys[n] = y;
+			return ++n < capacity;
+		},
+		decimate);
+	return n;
+}
+
+
 /*
  * ode_solve - solve a system with a given integrator
  */
@@ -487,34 +1606,97 @@ odesolve_1D(
 		double yInit)
 {
 	solver_result_1D_t result;
-	result.ys.push_back(yInit);
-	result.ts.push_back(t0);
+	odesolve_1D_stream(solver, f, t0, tmax, dt, yInit,
+		[&result](double t, double y) {
+			result.ys.push_back(y);
+			result.ts.push_back(t);
+		});
+	return result;
+}
 
-	// epsilon to check during computation of dt to catch the most sever
-	// rounding errors at the end of an integration
-	constexpr double eps = 1e-10;
 
-	double t = t0;
-	double yn = yInit;
-	double step_result;
-	while (t < tmax) {
-		// don't exceed tmax during integration
-		dt = std::min(dt, tmax - t);
-		// try to minimize rounding errors
-		if (dt + eps >= tmax - t)
-			dt = tmax - t;
-
-		// integration step
-		step_result = solver(f, t, dt, yn);
-
-		// move results out to the caller
-		result.ys.push_back(step_result);
-		result.ts.push_back(t);
-
-		// update yn (note: t and dt were changed by calling solver above)
-		yn = step_result;
+/*
+ * odesolve_stream - solve an N-D system and stream the samples to a sink
+ *
+ * The sink is called as sink(t, y) with y a const vector_t<N, T> &. Returns
+ * the number of samples that were passed to the sink.
+ */
+template <size_t N, typename T, typename Sink, typename... Args>
+size_t
+odesolve_stream(
+		const odesolver_step_fn<N, T, Args...> solver,
+		const dynamical_system_fn<N, T, Args...> fn,
+		T t0,
+		T tmax,
+		T dt,
+		const vector_t<N, T> &y_init,
+		Sink &&sink,
+		size_t decimate,
+		Args... args)
+{
+	if (decimate == 0)
+		decimate = 1;
+
+	size_t n_emitted = 1;
+	if (!__odesolve_emit(sink, t0, y_init))
+		return n_emitted;
+
+	vector_t<N, T> y_in, y_out;
+	y_in = y_init;
+
+	T t = t0;
+	for (size_t step = 1; t < tmax; step++) {
+		dt = __odesolve_clamp_dt(t, tmax, dt);
+
+		// integration step (note: t and dt are changed by calling solver)
+		solver(fn, t, dt, y_in, y_out, std::forward<Args>(args)...);
+		std::swap(y_in, y_out);
+
+		if (step % decimate == 0 || !(t < tmax)) {
+			n_emitted++;
+			if (!__odesolve_emit(sink, t, y_in))
+				break;
+		}
 	}
-	return result;
+	return n_emitted;
+}
+
+
+/*
+ * odesolve_into - solve an N-D system into preallocated buffers
+ *
+ * ts must have room for capacity samples, and ys for capacity * N values,
+ * where sample k is stored at ys[k * N]. The integration stops when the
+ * buffers are full. Returns the number of samples written.
+ */
+template <size_t N, typename T, typename... Args>
+size_t
+odesolve_into(
+		const odesolver_step_fn<N, T, Args...> solver,
+		const dynamical_system_fn<N, T, Args...> fn,
+		T t0,
+		T tmax,
+		T dt,
+		const vector_t<N, T> &y_init,
+		T *ts,
+		T *ys,
+		size_t capacity,
+		size_t decimate,
+		Args... args)
+{
+	if (capacity == 0)
+		return 0;
+
+	size_t n = 0;
+	odesolve_stream(solver, fn, t0, tmax, dt, y_init,
+		[&](T t, const vector_t<N, T> &y) -> bool {
+			ts[n] = t;
+			for (size_t i = 0; i < N; i++)
+				ys[n * N + i] = y[i];
+			return ++n < capacity;
+		},
+		decimate, std::forward<Args>(args)...);
+	return n;
 }
 
 
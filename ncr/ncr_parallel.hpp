@@ -0,0 +1,235 @@
+/*
+ * ncr_parallel - a minimalistic thread pool and parallel loops
+ *
+ * SPDX-FileCopyrightText: 2023 Nicolai Waniek <n@rochus.net>
+ * SPDX-License-Identifier: MIT
+ * See LICENSE file for more details.
+ *
+ * This file contains a small persistent thread pool which executes a number of
+ * tasks in fork-join fashion, i.e. the caller blocks until all tasks are done.
+ * Tasks are handed out dynamically via an atomic counter, and the calling
+ * thread participates in the work as worker 0. Hence, a pool with nthreads = 1
+ * does not spawn any thread and simply runs everything on the caller's thread.
+ *
+ * Note that which worker executes which task is not deterministic. Code that
+ * needs reproducible results, e.g. random numbers, should thus derive its
+ * state from the task index and not from the worker index. The worker index is
+ * meant to select per-worker scratch memory.
+ *
+ * Example:
+ *
+ *     ncr::thread_pool pool(4);
+ *     std::vector<double> ys(xs.size());
+ *     ncr::parallel_for(pool, xs.size(), 1024,
+ *         [&](size_t begin, size_t end, unsigned worker) {
+ *             for (size_t i = begin; i < end; i++)
+ *                 ys[i] = f(xs[i]);
+ *         });
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <vector>
+#include <algorithm>
+#include <cassert>
+
+namespace ncr {
+
+
+/*
+ * thread_pool - persistent pool of worker threads
+ *
+ * run() is not re-entrant: tasks must not call run() on the same pool, and
+ * only one thread at a time may call run(). Use a separate pool for nested
+ * parallelism. In debug builds, an assertion catches violating calls that
+ * would hand out tasks to the worker threads.
+ */
+struct thread_pool
+{
+	using task_fn = std::function<void (size_t task, unsigned worker)>;
+
+	explicit thread_pool(unsigned nthreads = std::thread::hardware_concurrency());
+	~thread_pool();
+
+	thread_pool(const thread_pool&) = delete;
+	thread_pool& operator=(const thread_pool&) = delete;
+
+	// number of workers, including the calling thread
+	unsigned                size() const { return static_cast<unsigned>(this->_threads.size()) + 1; };
+
+	// execute fn(task, worker) for all tasks in [0, n_tasks) and wait until
+	// all of them are done
+	void                    run(size_t n_tasks, const task_fn &fn);
+
+private:
+	void                    _worker_loop(unsigned worker);
+	void                    _work(unsigned worker);
+
+	std::vector<std::thread> _threads;
+	std::mutex              _mutex;
+	std::condition_variable _cv_start;
+	std::condition_variable _cv_done;
+
+	// description of the current job
+	const task_fn          *_job = nullptr;
+	size_t                  _n_tasks = 0;
+	std::atomic<size_t>     _next_task = 0;
+
+	// synchronization of job generations and shutdown
+	std::uint64_t           _generation = 0;
+	unsigned                _n_busy = 0;
+	bool                    _stop = false;
+
+	// set while run() distributes a job, to detect re-entrant calls
+	std::atomic<bool>       _running = false;
+};
+
+
+/*
+ * thread_pool::thread_pool - spawn nthreads - 1 worker threads
+ */
+inline
+thread_pool::thread_pool(unsigned nthreads)
+{
+	if (nthreads == 0)
+		nthreads = 1;
+	for (unsigned i = 1; i < nthreads; i++)
+		this->_threads.emplace_back(&thread_pool::_worker_loop, this, i);
+}
+
+
+/*
+ * thread_pool::~thread_pool - stop and join all worker threads
+ */
+inline
+thread_pool::~thread_pool()
+{
+	{
+		std::lock_guard<std::mutex> lock(this->_mutex);
+		this->_stop = true;
+	}
+	this->_cv_start.notify_all();
+	for (auto &t: this->_threads)
+		t.join();
+}
+
+
+/*
+ * thread_pool::_work - grab and execute tasks until there are none left
+ */
+inline void
+thread_pool::_work(unsigned worker)
+{
+	size_t task;
+	while ((task = this->_next_task.fetch_add(1, std::memory_order_relaxed)) < this->_n_tasks)
+		(*this->_job)(task, worker);
+}
+
+
+/*
+ * thread_pool::_worker_loop - main loop of each worker thread
+ */
+inline void
+thread_pool::_worker_loop(unsigned worker)
+{
+	std::uint64_t generation = 0;
+	while (true) {
+		{
+			std::unique_lock<std::mutex> lock(this->_mutex);
+			this->_cv_start.wait(lock, [&]{ return this->_stop || this->_generation != generation; });
+			if (this->_stop)
+				return;
+			generation = this->_generation;
+		}
+
+		this->_work(worker);
+
+		std::lock_guard<std::mutex> lock(this->_mutex);
+		if (--this->_n_busy == 0)
+			this->_cv_done.notify_one();
+	}
+}
+
+
+/*
+ * thread_pool::run - execute n_tasks tasks on all workers of the pool
+ */
+inline void
+thread_pool::run(size_t n_tasks, const task_fn &fn)
+{
+	if (n_tasks == 0)
+		return;
+
+	// avoid any synchronization if there's nothing to distribute
+	if (this->_threads.empty() || n_tasks == 1) {
+		for (size_t i = 0; i < n_tasks; i++)
+			fn(i, 0);
+		return;
+	}
+
+	[[maybe_unused]] const bool running = this->_running.exchange(true, std::memory_order_acquire);
+	assert(!running && "thread_pool::run() is not re-entrant");
+
+	{
+		std::lock_guard<std::mutex> lock(this->_mutex);
+		this->_job     = &fn;
+		this->_n_tasks = n_tasks;
+		this->_next_task.store(0, std::memory_order_relaxed);
+		this->_n_busy  = static_cast<unsigned>(this->_threads.size());
+		this->_generation += 1;
+	}
+	this->_cv_start.notify_all();
+
+	// the calling thread is worker 0
+	this->_work(0);
+
+	std::unique_lock<std::mutex> lock(this->_mutex);
+	this->_cv_done.wait(lock, [&]{ return this->_n_busy == 0; });
+	this->_job = nullptr;
+	this->_running.store(false, std::memory_order_release);
+}
+
+
+/*
+ * parallel_for - run fn(begin, end, worker) over chunks of [0, n)
+ *
+ * The range is split into chunks of at most grain elements, which are then
+ * distributed over the workers of the pool. If the pool is nullptr, the whole
+ * range is processed on the calling thread as a single chunk.
+ */
+template <typename Fn>
+void
+parallel_for(thread_pool *pool, size_t n, size_t grain, Fn &&fn)
+{
+	if (n == 0)
+		return;
+	if (!pool) {
+		fn(size_t(0), n, 0u);
+		return;
+	}
+	if (grain == 0)
+		grain = 1;
+
+	const size_t n_chunks = (n + grain - 1) / grain;
+	pool->run(n_chunks, [&](size_t chunk, unsigned worker) {
+		const size_t begin = chunk * grain;
+		const size_t end   = std::min(n, begin + grain);
+		fn(begin, end, worker);
+	});
+}
+
+template <typename Fn>
+void
+parallel_for(thread_pool &pool, size_t n, size_t grain, Fn &&fn)
+{
+	parallel_for(&pool, n, grain, std::forward<Fn>(fn));
+}
+
+
+} // ncr::
@@ -15,6 +15,15 @@
 #include <tuple>
 #include <bitset>
 #include <cassert>
+#include <cstdint>
+#include <array>
+#include <istream>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <span>
+#include <algorithm>
+#include <type_traits>
 
 // TODO: check if the following dependencies are requried, or if the types could
 //       be inferred somehow during compilation. These types are currenlty used
@@ -69,6 +78,355 @@ auto reseed_rng(RngT *rng, uint64_t seed = 0) -> RngT*
 }
 
 
+/*
+ * reseed_rng(rng, seed, stream) - Reseed a random number generator for a stream
+ *
+ * This derives the state of the generator from the pair (seed, stream). It is
+ * useful to give each item of a collection, e.g. each genome of a population,
+ * its own reproducible stream of random numbers that does not depend on the
+ * order in which the items are processed. In contrast to reseed_rng(rng, seed),
+ * a seed of 0 is a valid seed here and does not depend on the current time.
+ */
+template <typename RngT = std::mt19937_64>
+auto reseed_rng(RngT *rng, uint64_t seed, uint64_t stream) -> RngT*
+{
+	assert(rng != nullptr);
+
+	std::seed_seq seq{
+		uint32_t(seed & 0xFFFFFFFF),   uint32_t(seed >> 32),
+		uint32_t(stream & 0xFFFFFFFF), uint32_t(stream >> 32)};
+	rng->seed(seq);
+
+	return rng;
+}
+
+
+/*
+ * philox4x32 - counter based random number generator
+ *
+ * Philox4x32-10 according to Salmon et al., "Parallel random numbers: as easy
+ * as 1, 2, 3", 2011. In contrast to a Mersenne Twister, the generator has no
+ * sequential state. Each output block is a bijective function of a 64 bit key
+ * (the seed) and a 128 bit counter, which consists of a 64 bit stream id and a
+ * 64 bit position within the stream. Hence, any neuron, genome or thread can
+ * get its own independent and reproducible stream by using its index as stream
+ * id, and jumping to a position in a stream is O(1). The whole state consists
+ * of a few words and is cheap to create on the stack.
+ *
+ * philox4x32 satisfies UniformRandomBitGenerator, produces 64 bit numbers, and
+ * can thus be used as RngT in all functions of this file as well as with the
+ * distributions of <random>. Each block yields two 64 bit numbers.
+ *
+ * Example:
+ *
+ *     // stream for neuron i, independent of all other neurons
+ *     ncr::philox4x32 rng(seed, i);
+ *     double u = ncr::unif_random(&rng);
+ */
+struct philox4x32
+{
+	typedef std::uint64_t result_type;
+
+	typedef std::array<std::uint32_t, 4> block_type;
+
+	constexpr static std::uint32_t M0 = 0xD2511F53;
+	constexpr static std::uint32_t M1 = 0xCD9E8D57;
+	constexpr static std::uint32_t W0 = 0x9E3779B9;
+	constexpr static std::uint32_t W1 = 0xBB67AE85;
+	constexpr static unsigned      rounds = 10;
+
+	static constexpr result_type min() { return 0; }
+	static constexpr result_type max() { return ~result_type(0); }
+
+	explicit
+	philox4x32(std::uint64_t seed = 0, std::uint64_t stream = 0, std::uint64_t counter = 0)
+	: _key(seed)
+	, _stream(stream)
+	, _counter(counter)
+	{ }
+
+	// seed from a seed sequence, as used by reseed_rng. The first two words
+	// make up the key, the next two the stream id.
+	explicit
+	philox4x32(std::seed_seq &seq)
+	{
+		this->seed(seq);
+	}
+
+	void
+	seed(std::uint64_t seed, std::uint64_t stream = 0)
+	{
+		this->_key     = seed;
+		this->_stream  = stream;
+		this->_counter = 0;
+		this->_index   = 2;
+	}
+
+	void
+	seed(std::seed_seq &seq)
+	{
+		std::array<std::uint32_t, 4> w;
+		seq.generate(w.begin(), w.end());
+		this->seed(
+			std::uint64_t(w[0]) | (std::uint64_t(w[1]) << 32),
+			std::uint64_t(w[2]) | (std::uint64_t(w[3]) << 32));
+	}
+
+	// select a stream and restart at its beginning
+	void
+	set_stream(std::uint64_t stream)
+	{
+		this->_stream  = stream;
+		this->_counter = 0;
+		this->_index   = 2;
+	}
+
+	std::uint64_t key() const    { return this->_key; }
+	std::uint64_t stream() const { return this->_stream; }
+
+	// position within the stream, i.e. the number of values drawn so far
+	std::uint64_t
+	position() const
+	{
+		return this->_index == 2 ? 2 * this->_counter : 2 * (this->_counter - 1) + this->_index;
+	}
+
+	// jump to a position within the current stream
+	void
+	set_position(std::uint64_t pos)
+	{
+		this->_counter = pos / 2;
+		this->_index   = 2;
+		if (pos % 2) {
+			this->_refill();
+			this->_index = 1;
+		}
+	}
+
+	void
+	discard(unsigned long long n)
+	{
+		this->set_position(this->position() + n);
+	}
+
+	result_type
+	operator()()
+	{
+		if (this->_index == 2)
+			this->_refill();
+		return this->_buffer[this->_index++];
+	}
+
+	/*
+	 * block - the raw Philox4x32-10 bijection of a counter and a key
+	 */
+	static constexpr block_type
+	block(block_type ctr, std::array<std::uint32_t, 2> key)
+	{
+		for (unsigned r = 0; r < rounds; r++) {
+			const std::uint64_t p0 = std::uint64_t(M0) * ctr[0];
+			const std::uint64_t p1 = std::uint64_t(M1) * ctr[2];
+			ctr = {
+				std::uint32_t(p1 >> 32) ^ ctr[1] ^ key[0],
+				std::uint32_t(p1),
+				std::uint32_t(p0 >> 32) ^ ctr[3] ^ key[1],
+				std::uint32_t(p0)
+			};
+			key[0] += W0;
+			key[1] += W1;
+		}
+		return ctr;
+	}
+
+	/*
+	 * at - the two values of block counter of a stream without any state
+	 */
+	static constexpr std::array<result_type, 2>
+	at(std::uint64_t seed, std::uint64_t stream, std::uint64_t counter)
+	{
+		const block_type b = block(
+			{std::uint32_t(counter), std::uint32_t(counter >> 32), std::uint32_t(stream), std::uint32_t(stream >> 32)},
+			{std::uint32_t(seed), std::uint32_t(seed >> 32)});
+		return {
+			std::uint64_t(b[0]) | (std::uint64_t(b[1]) << 32),
+			std::uint64_t(b[2]) | (std::uint64_t(b[3]) << 32)
+		};
+	}
+
+	friend bool
+	operator==(const philox4x32 &a, const philox4x32 &b)
+	{
+		return a._key == b._key && a._stream == b._stream && a.position() == b.position();
+	}
+
+	// the state is written as key, stream and position, see mkrng(state)
+	friend std::ostream&
+	operator<<(std::ostream &os, const philox4x32 &rng)
+	{
+		return os << rng._key << ' ' << rng._stream << ' ' << rng.position();
+	}
+
+	friend std::istream&
+	operator>>(std::istream &is, philox4x32 &rng)
+	{
+		std::uint64_t key, stream, pos;
+		if (is >> key >> stream >> pos) {
+			rng.seed(key, stream);
+			rng.set_position(pos);
+		}
+		return is;
+	}
+
+private:
+	void
+	_refill()
+	{
+		this->_buffer  = at(this->_key, this->_stream, this->_counter++);
+		this->_index   = 0;
+	}
+
+	std::uint64_t               _key     = 0;
+	std::uint64_t               _stream  = 0;
+	std::uint64_t               _counter = 0;
+	std::array<result_type, 2>  _buffer  = {0, 0};
+	unsigned                    _index   = 2;
+};
+
+
+/*
+ * reseed_rng(rng, seed) - Reseed a philox4x32 generator
+ *
+ * The seed becomes the key of the generator, and the stream is reset to 0. As
+ * for the other generators, a seed of 0 is replaced by the current time.
+ */
+inline philox4x32*
+reseed_rng(philox4x32 *rng, uint64_t seed = 0)
+{
+	assert(rng != nullptr);
+
+	if (!seed)
+		seed = static_cast<uint64_t>(std::chrono::high_resolution_clock::now().time_since_epoch().count());
+	rng->seed(seed);
+	return rng;
+}
+
+
+/*
+ * reseed_rng(rng, seed, stream) - Select a stream of a philox4x32 generator
+ *
+ * In contrast to the generic version, this does not need a seed sequence, as
+ * the pair (seed, stream) directly forms the key and counter of the generator.
+ */
+inline philox4x32*
+reseed_rng(philox4x32 *rng, uint64_t seed, uint64_t stream)
+{
+	assert(rng != nullptr);
+
+	rng->seed(seed, stream);
+	return rng;
+}
+
+
+/*
+ * feistel_permutation - keyed pseudo-random permutation of [0, n)
+ *
+ * The permutation is a balanced Feistel network on the smallest even number of
+ * bits that covers n. Values outside of [0, n) are mapped back into the range
+ * by cycle-walking, i.e. the network is applied until the result is below n.
+ * Because the network on 2^b elements is a bijection, so is the restriction to
+ * [0, n), and less than four evaluations of the network are expected per call.
+ *
+ * The whole state are the round keys, hence enumerating p(0), p(1), ... yields
+ * all elements of [0, n) exactly once in random order with O(1) memory. The
+ * permutation is not cryptographically secure. n = 0 denotes the full range
+ * of 2^64 elements.
+ *
+ * Example:
+ *
+ *     ncr::feistel_permutation p(1000, seed);
+ *     for (uint64_t i = 0; i < 1000; i++)
+ *         visit(p(i));
+ */
+struct feistel_permutation
+{
+	constexpr static unsigned rounds = 6;
+
+	feistel_permutation(std::uint64_t n = 0, std::uint64_t key = 0)
+	{
+		this->resize(n);
+		this->rekey(key);
+	}
+
+	// number of elements, 0 if the permutation is over all 2^64 elements
+	std::uint64_t
+	size() const { return this->_n; }
+
+	void
+	resize(std::uint64_t n)
+	{
+		this->_n = n;
+
+		// bits required to represent n - 1, rounded up to an even number
+		unsigned bits = 64;
+		if (n > 0) {
+			bits = 0;
+			while (bits < 64 && (std::uint64_t(1) << bits) < n)
+				bits++;
+		}
+		bits = std::max(2u, bits + (bits & 1u));
+		this->_half_bits = bits / 2;
+		this->_half_mask = (std::uint64_t(1) << this->_half_bits) - 1;
+	}
+
+	void
+	rekey(std::uint64_t key)
+	{
+		for (auto &k : this->_keys)
+			k = __mix(key += 0x9e3779b97f4a7c15ull);
+	}
+
+	std::uint64_t
+	operator()(std::uint64_t i) const
+	{
+		assert((this->_n == 0 || i < this->_n) && "Index out of range");
+
+		std::uint64_t x = this->_encrypt(i);
+		while (this->_n != 0 && x >= this->_n)
+			x = this->_encrypt(x);
+		return x;
+	}
+
+private:
+	// avalanche step of splitmix64
+	static std::uint64_t
+	__mix(std::uint64_t z)
+	{
+		z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+		z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+		return z ^ (z >> 31);
+	}
+
+	std::uint64_t
+	_encrypt(std::uint64_t x) const
+	{
+		std::uint64_t l = x >> this->_half_bits;
+		std::uint64_t r = x & this->_half_mask;
+		for (auto k : this->_keys) {
+			const std::uint64_t f = __mix(r ^ k) & this->_half_mask;
+			const std::uint64_t t = l ^ f;
+			l = r;
+			r = t;
+		}
+		return (l << this->_half_bits) | r;
+	}
+
+	std::uint64_t                   _n = 0;
+	unsigned                        _half_bits = 32;
+	std::uint64_t                   _half_mask = 0xffffffffull;
+	std::array<std::uint64_t, rounds> _keys = {};
+};
+
+
 /*
  * choice(a, b, rng) - Draw a random number from range [a, b]
  */
@@ -321,6 +679,257 @@ auto gamma(size_t N, RealType a, RealType b, RngT *rng) ->  std::vector<RealType
 
 
 
+/*
+ * Bulk sampling
+ *
+ * The following functions fill a caller provided span with samples. Instead of
+ * passing each sample through a std:: distribution, they first draw a block of
+ * raw 64 bit numbers, and then transform the whole block in a simple loop that
+ * the compiler can vectorize. Each random number yields one double, two
+ * floats, or two Bernoulli trials. Note that vectorization of the transforms
+ * that use std::log, std::sqrt or std::cos and similar functions requires a
+ * vector math library, which GCC only uses with -ffast-math.
+ *
+ * All functions work with any RngT, but are fastest when RngT produces 64 bit
+ * numbers over the full range, such as std::mt19937_64 or philox4x32.
+ */
+
+// number of raw random numbers that are drawn and transformed at once
+constexpr size_t __bulk_block_size = 256;
+
+
+/*
+ * __rng_fill_raw - fill a buffer with uniformly distributed 64 bit numbers
+ */
+template <typename RngT>
+inline void
+__rng_fill_raw(std::uint64_t *raw, size_t n, RngT *rng)
+{
+	assert(rng != nullptr);
+
+	if constexpr (RngT::min() == 0 && RngT::max() == ~std::uint64_t(0)) {
+		for (size_t i = 0; i < n; i++)
+			raw[i] = (*rng)();
+	}
+	else {
+		std::uniform_int_distribution<std::uint64_t> d;
+		for (size_t i = 0; i < n; i++)
+			raw[i] = d(*rng);
+	}
+}
+
+
+/*
+ * unif_random_fill(out, rng) - fill out with uniform numbers in [0, 1)
+ *
+ * Doubles use the upper 53 bits of one random number each. Floats use 24 bits
+ * each, such that one random number gives two floats.
+ */
+template <typename T = double, typename RngT = std::mt19937_64>
+void
+unif_random_fill(std::span<T> out, RngT *rng)
+{
+	static_assert(std::is_same_v<T, double> || std::is_same_v<T, float>);
+
+	std::uint64_t raw[__bulk_block_size];
+	constexpr size_t per_raw = std::is_same_v<T, float> ? 2 : 1;
+	constexpr size_t chunk   = __bulk_block_size * per_raw;
+
+	for (size_t offset = 0; offset < out.size(); offset += chunk) {
+		const size_t n     = std::min(chunk, out.size() - offset);
+		const size_t n_raw = (n + per_raw - 1) / per_raw;
+		T *dst = out.data() + offset;
+		__rng_fill_raw(raw, n_raw, rng);
+
+		if constexpr (per_raw == 1) {
+			for (size_t i = 0; i < n; i++)
+				dst[i] = T(raw[i] >> 11) * T(0x1.0p-53);
+		}
+		else {
+			for (size_t i = 0; i < n; i++)
+				dst[i] = T(std::uint32_t(raw[i / 2] >> (32 * (i % 2))) >> 8) * T(0x1.0p-24);
+		}
+	}
+}
+
+
+/*
+ * unif_random_fill(out, a, b, rng) - fill out with uniform numbers in [a, b)
+ */
+template <typename T = double, typename RngT = std::mt19937_64>
+void
+unif_random_fill(std::span<T> out, T a, T b, RngT *rng)
+{
+	unif_random_fill(out, rng);
+	const T span = b - a;
+	for (size_t i = 0; i < out.size(); i++)
+		out[i] = a + span * out[i];
+}
+
+
+/*
+ * normal_fill(out, mu, sigma, rng) - fill out with normally distributed numbers
+ *
+ * This uses the Box-Muller transform, which turns each pair of uniform numbers
+ * into a pair of independent normal samples.
+ */
+template <typename T = double, typename RngT = std::mt19937_64>
+void
+normal_fill(std::span<T> out, T mu, T sigma, RngT *rng)
+{
+	constexpr T two_pi = T(2.0 * M_PI);
+	T u[__bulk_block_size];
+
+	for (size_t offset = 0; offset < out.size(); offset += __bulk_block_size) {
+		const size_t n      = std::min(__bulk_block_size, out.size() - offset);
+		const size_t npairs = (n + 1) / 2;
+		T *dst = out.data() + offset;
+		unif_random_fill(std::span<T>(u, 2 * npairs), rng);
+
+		// u[i] is in [0, 1), hence 1 - u[i] is in (0, 1] for the logarithm
+		for (size_t i = 0; i < n / 2; i++) {
+			const T r     = std::sqrt(T(-2) * std::log(T(1) - u[2 * i]));
+			const T theta = two_pi * u[2 * i + 1];
+			dst[2 * i]     = mu + sigma * r * std::cos(theta);
+			dst[2 * i + 1] = mu + sigma * r * std::sin(theta);
+		}
+		if (n % 2) {
+			const T r = std::sqrt(T(-2) * std::log(T(1) - u[n - 1]));
+			dst[n - 1] = mu + sigma * r * std::cos(two_pi * u[n]);
+		}
+	}
+}
+
+
+/*
+ * exponential_fill(out, lambda, rng) - fill out with exponential samples
+ *
+ * lambda is the rate of the distribution, i.e. the mean is 1 / lambda
+ */
+template <typename T = double, typename RngT = std::mt19937_64>
+void
+exponential_fill(std::span<T> out, T lambda, RngT *rng)
+{
+	assert(lambda > T(0));
+
+	unif_random_fill(out, rng);
+	const T scale = T(-1) / lambda;
+	for (size_t i = 0; i < out.size(); i++)
+		out[i] = scale * std::log1p(-out[i]);
+}
+
+
+/*
+ * __bernoulli_threshold - 33 bit threshold for comparisons with 32 bit numbers
+ */
+template <typename T>
+inline std::uint64_t
+__bernoulli_threshold(T p)
+{
+	if (!(p > T(0)))
+		return 0;
+	if (p >= T(1))
+		return std::uint64_t(1) << 32;
+	return std::uint64_t(p * T(0x1.0p32));
+}
+
+
+/*
+ * __bernoulli_word - 64 Bernoulli trials with per-bit thresholds
+ *
+ * Bit k is set if the k-th 32 bit number of raw is below threshold[k].
+ */
+inline std::uint64_t
+__bernoulli_word(const std::uint64_t *raw, const std::uint64_t *threshold)
+{
+	std::uint64_t word = 0;
+	for (unsigned k = 0; k < 64; k++) {
+		const std::uint64_t u = std::uint32_t(raw[k / 2] >> (32 * (k % 2)));
+		word |= std::uint64_t(u < threshold[k]) << k;
+	}
+	return word;
+}
+
+
+/*
+ * bernoulli_fill(words, nbits, p, rng) - fill a bit mask with Bernoulli trials
+ *
+ * Each of the first nbits bits of words is set with probability p. Remaining
+ * bits of the last word are cleared. words must have room for at least
+ * (nbits + 63) / 64 words. For p = 0.5, each random number gives 64 bits.
+ * Otherwise, each random number gives two trials with a resolution of 2^-32.
+ */
+template <typename T = double, typename RngT = std::mt19937_64>
+void
+bernoulli_fill(std::span<std::uint64_t> words, size_t nbits, T p, RngT *rng)
+{
+	const size_t nwords = (nbits + 63) / 64;
+	assert(words.size() >= nwords);
+
+	if (p == T(0.5))
+		__rng_fill_raw(words.data(), nwords, rng);
+	else {
+		std::uint64_t threshold[64];
+		std::fill(threshold, threshold + 64, __bernoulli_threshold(p));
+
+		std::uint64_t raw[32];
+		for (size_t w = 0; w < nwords; w++) {
+			__rng_fill_raw(raw, 32, rng);
+			words[w] = __bernoulli_word(raw, threshold);
+		}
+	}
+
+	if (nbits % 64)
+		words[nwords - 1] &= ~std::uint64_t(0) >> (64 - nbits % 64);
+}
+
+
+/*
+ * poisson_spike_mask(mask, rates, dt, rng) - draw Poisson spikes of a population
+ *
+ * Bit i of mask is set if neuron i, which fires with Poisson rate rates[i],
+ * emits a spike within a time bin of length dt. The probability of this is
+ * 1 - exp(-rates[i] * dt). mask must have room for (rates.size() + 63) / 64
+ * words, and bits past the last neuron are cleared.
+ */
+template <typename T = double, typename RngT = std::mt19937_64>
+void
+poisson_spike_mask(std::span<std::uint64_t> mask, std::span<const T> rates, T dt, RngT *rng)
+{
+	const size_t n      = rates.size();
+	const size_t nwords = (n + 63) / 64;
+	assert(mask.size() >= nwords);
+
+	std::uint64_t threshold[64];
+	std::uint64_t raw[32];
+	for (size_t w = 0; w < nwords; w++) {
+		const size_t begin = w * 64;
+		const size_t count = std::min<size_t>(64, n - begin);
+
+		// spike probabilities of the next 64 neurons
+		for (size_t k = 0; k < count; k++)
+			threshold[k] = __bernoulli_threshold(-std::expm1(-rates[begin + k] * dt));
+		std::fill(threshold + count, threshold + 64, 0);
+
+		__rng_fill_raw(raw, 32, rng);
+		mask[w] = __bernoulli_word(raw, threshold);
+	}
+}
+
+
+/*
+ * poisson_spike_mask(mask, n, rate, dt, rng) - Poisson spikes with one rate
+ *
+ * Same as above, but all n neurons share the same rate.
+ */
+template <typename T = double, typename RngT = std::mt19937_64>
+void
+poisson_spike_mask(std::span<std::uint64_t> mask, size_t n, T rate, T dt, RngT *rng)
+{
+	bernoulli_fill(mask, n, T(-std::expm1(-rate * dt)), rng);
+}
+
+
 template <typename RngT, typename T>
 T random_grid_coord(RngT *rng, const std::tuple<T, T> &limits)
 {
@@ -438,10 +1047,13 @@ template <int N, typename RngT = std::mt19937_64>
 std::bitset<N>
 random_bits(RngT *rng)
 {
+	// each random number yields 64 bits
+	std::uint64_t raw[(N + 63) / 64];
+	__rng_fill_raw(raw, (N + 63) / 64, rng);
+
 	std::bitset<N> result;
-	std::bernoulli_distribution dist(0.5);
-	for(size_t i = 0; i < N; i++)
-		result.set(i, dist(rng));
+	for (size_t w = 0; w < (N + 63) / 64; w++)
+		result |= std::bitset<N>(raw[w]) << (64 * w);
 	return result;
 }
 
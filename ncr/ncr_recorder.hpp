@@ -0,0 +1,605 @@
+/*
+ * ncr_recorder - buffered recording of spikes and state variables
+ *
+ * SPDX-FileCopyrightText: 2023 Nicolai Waniek <n@rochus.net>
+ * SPDX-License-Identifier: MIT
+ * See LICENSE file for more details
+ *
+ * A recorder accumulates spikes (neuron id, tick) and samples of state
+ * variables (e.g. membrane potentials) in chunks in memory. Full chunks are
+ * handed to a background thread, which writes them to a recorder_backend in
+ * one go. Hence the simulation thread only pays for a copy of the recorded
+ * values and never waits for I/O, unless the background thread falls behind
+ * by more than max_pending_chunks chunks.
+ *
+ * With NCR_RECORDER_ENABLE_HDF5, recorder_backend_hdf5 appends the chunks to
+ * extendible, chunked and optionally compressed HDF5 datasets via HighFive.
+ * The layout of the file is
+ *
+ *     /spikes/neuron          uint32 [n_spikes]
+ *     /spikes/tick            uint64 [n_spikes]
+ *     /traces/<name>/tick     uint64 [n_samples]
+ *     /traces/<name>/values   double [n_samples, n_vars]
+ *
+ * Example:
+ *
+ *     ncr::recorder rec;
+ *     size_t v = ncr::recorder_add_trace(&rec, "v", n_neurons, 10);
+ *     ncr::recorder_start(&rec, new ncr::recorder_backend_hdf5("run.h5"));
+ *     for (uint64_t tick = 0; ...; tick++) {
+ *         ...
+ *         ncr::recorder_spike(&rec, neuron, tick);
+ *         ncr::recorder_sample(&rec, v, tick, potentials);
+ *     }
+ *     ncr::recorder_stop(&rec);
+ *
+ * All recording functions must be called from one thread, usually the
+ * simulation thread.
+ */
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include <deque>
+#include <span>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+#include <ncr/ncr_log.hpp>
+
+#ifdef NCR_RECORDER_ENABLE_HDF5
+#include <highfive/H5File.hpp>
+#include <highfive/H5DataSet.hpp>
+#include <highfive/H5DataSpace.hpp>
+#include <highfive/H5PropertyList.hpp>
+#endif
+
+namespace ncr {
+
+
+/*
+ * recorder_trace - description of a recorded state variable
+ *
+ * Each sample of a trace contains n_vars values, e.g. the membrane potential
+ * of n_vars neurons. recorder_sample only records every interval-th tick.
+ */
+struct recorder_trace {
+	std::string   name;
+	size_t        n_vars   = 1;
+	std::uint64_t interval = 1;
+};
+
+
+/*
+ * recorder_backend - interface for the storage of recorded chunks
+ *
+ * All functions are called from the background thread of the recorder. init
+ * is called once before any chunk is written, and it receives all traces
+ * that were registered with the recorder. The index of a trace in this list is
+ * passed along to write_samples.
+ */
+struct recorder_backend {
+	virtual ~recorder_backend() = default;
+
+	virtual bool init(const std::vector<recorder_trace> &traces) = 0;
+
+	// append spikes, i.e. pairs of neurons[i], ticks[i]
+	virtual bool write_spikes(std::span<const std::uint32_t> neurons, std::span<const std::uint64_t> ticks) = 0;
+
+	// append samples of a trace. values contains ticks.size() rows of n_vars
+	// values each
+	virtual bool write_samples(size_t trace, std::span<const std::uint64_t> ticks, std::span<const double> values) = 0;
+
+	// called after the last chunk was written
+	virtual void finalize() {}
+};
+
+
+/*
+ * recorder_config - configuration of a recorder
+ */
+struct recorder_config {
+	// number of spikes per chunk
+	size_t spike_chunk_size = 1 << 16;
+
+	// number of samples (rows) per chunk of a trace
+	size_t sample_chunk_size = 1024;
+
+	// number of full chunks that may wait for the background thread before
+	// the recording thread blocks
+	size_t max_pending_chunks = 16;
+};
+
+
+/*
+ * recorder_statistics - counters of a recorder
+ */
+struct recorder_statistics {
+	std::uint64_t spikes  = 0;
+	std::uint64_t samples = 0;
+	std::uint64_t chunks  = 0;
+
+	// number of times the recording thread had to wait for the background
+	// thread
+	std::uint64_t stalls  = 0;
+
+	// number of chunks that the backend failed to write
+	std::uint64_t errors  = 0;
+};
+
+
+/*
+ * __recorder_chunk - buffer of spikes or of samples of one trace
+ */
+struct __recorder_chunk {
+	// index of the trace, or npos for spikes
+	constexpr static size_t npos = ~size_t(0);
+
+	size_t                     trace = npos;
+	std::vector<std::uint64_t> ticks;
+	std::vector<std::uint32_t> neurons;
+	std::vector<double>        values;
+
+	void
+	clear()
+	{
+		this->ticks.clear();
+		this->neurons.clear();
+		this->values.clear();
+	}
+};
+
+
+/*
+ * recorder - buffered recorder of spikes and traces
+ */
+struct recorder {
+	recorder_config                                config;
+	std::vector<recorder_trace>                    traces;
+	std::unique_ptr<recorder_backend>              backend;
+
+	// chunks that are currently filled by the recording thread
+	std::unique_ptr<__recorder_chunk>              spikes;
+	std::vector<std::unique_ptr<__recorder_chunk>> samples;
+
+	// hand-over to the background thread, guarded by mtx
+	std::mutex                                     mtx;
+	std::condition_variable                        cv_pending;
+	std::condition_variable                        cv_done;
+	std::deque<std::unique_ptr<__recorder_chunk>>  pending;
+	std::vector<std::unique_ptr<__recorder_chunk>> free_chunks;
+	bool                                           busy = false;
+	bool                                           stop = false;
+	std::thread                                    writer;
+
+	recorder_statistics                            stats;
+
+	recorder() = default;
+	explicit recorder(const recorder_config &cfg) : config(cfg) {}
+	~recorder();
+};
+
+
+/*
+ * __recorder_get_chunk - get an empty chunk, reusing chunks when possible
+ */
+inline
+std::unique_ptr<__recorder_chunk>
+__recorder_get_chunk(recorder *rec, size_t trace)
+{
+	std::unique_ptr<__recorder_chunk> chunk;
+	{
+		std::lock_guard<std::mutex> lock(rec->mtx);
+		if (!rec->free_chunks.empty()) {
+			chunk = std::move(rec->free_chunks.back());
+			rec->free_chunks.pop_back();
+		}
+	}
+	if (!chunk)
+		chunk = std::make_unique<__recorder_chunk>();
+
+	chunk->trace = trace;
+	if (trace == __recorder_chunk::npos) {
+		chunk->ticks.reserve(rec->config.spike_chunk_size);
+		chunk->neurons.reserve(rec->config.spike_chunk_size);
+	}
+	else {
+		chunk->ticks.reserve(rec->config.sample_chunk_size);
+		chunk->values.reserve(rec->config.sample_chunk_size * rec->traces[trace].n_vars);
+	}
+	return chunk;
+}
+
+
+/*
+ * __recorder_submit - hand a chunk over to the background thread
+ */
+inline
+void
+__recorder_submit(recorder *rec, std::unique_ptr<__recorder_chunk> &chunk)
+{
+	if (!chunk || chunk->ticks.empty())
+		return;
+
+	const size_t trace = chunk->trace;
+	{
+		std::unique_lock<std::mutex> lock(rec->mtx);
+		if (rec->pending.size() >= rec->config.max_pending_chunks) {
+			rec->stats.stalls += 1;
+			rec->cv_done.wait(lock, [&]{ return rec->pending.size() < rec->config.max_pending_chunks; });
+		}
+		rec->pending.push_back(std::move(chunk));
+		rec->stats.chunks += 1;
+	}
+	rec->cv_pending.notify_one();
+	chunk = __recorder_get_chunk(rec, trace);
+}
+
+
+/*
+ * __recorder_write - write a chunk to the backend
+ */
+inline
+bool
+__recorder_write(recorder_backend *backend, const __recorder_chunk &chunk)
+{
+	if (chunk.trace == __recorder_chunk::npos)
+		return backend->write_spikes(chunk.neurons, chunk.ticks);
+	return backend->write_samples(chunk.trace, chunk.ticks, chunk.values);
+}
+
+
+/*
+ * __recorder_run - main loop of the background thread
+ */
+inline
+void
+__recorder_run(recorder *rec)
+{
+	std::unique_lock<std::mutex> lock(rec->mtx);
+	while (true) {
+		rec->cv_pending.wait(lock, [&]{ return rec->stop || !rec->pending.empty(); });
+		if (rec->pending.empty() && rec->stop)
+			return;
+
+		auto chunk = std::move(rec->pending.front());
+		rec->pending.pop_front();
+		rec->busy = true;
+
+		lock.unlock();
+		const bool ok = __recorder_write(rec->backend.get(), *chunk);
+		if (!ok)
+			log_error("recorder: failed to write chunk\n");
+		chunk->clear();
+		lock.lock();
+
+		if (!ok)
+			rec->stats.errors += 1;
+		rec->free_chunks.push_back(std::move(chunk));
+		rec->busy = false;
+		rec->cv_done.notify_all();
+	}
+}
+
+
+/*
+ * recorder_add_trace - register a trace before starting the recorder
+ *
+ * Returns the index of the trace, which is to be passed to recorder_sample.
+ */
+inline
+size_t
+recorder_add_trace(recorder *rec, std::string name, size_t n_vars, std::uint64_t interval = 1)
+{
+	assert(rec != nullptr);
+	assert(!rec->writer.joinable() && "traces must be added before recorder_start");
+	rec->traces.push_back({std::move(name), n_vars, interval ? interval : 1});
+	return rec->traces.size() - 1;
+}
+
+
+/*
+ * recorder_start - initialize the backend and start the background thread
+ *
+ * The recorder takes ownership of the backend. Returns false if the backend
+ * could not be initialized.
+ */
+inline
+bool
+recorder_start(recorder *rec, recorder_backend *backend)
+{
+	assert(rec != nullptr);
+	if (rec->writer.joinable()) {
+		log_error("recorder: already started\n");
+		delete backend;
+		return false;
+	}
+	rec->backend.reset(backend);
+	if (!rec->backend || !rec->backend->init(rec->traces)) {
+		log_error("recorder: could not initialize backend\n");
+		rec->backend.reset();
+		return false;
+	}
+
+	if (!rec->config.spike_chunk_size)   rec->config.spike_chunk_size = 1;
+	if (!rec->config.sample_chunk_size)  rec->config.sample_chunk_size = 1;
+	if (!rec->config.max_pending_chunks) rec->config.max_pending_chunks = 1;
+
+	rec->spikes = __recorder_get_chunk(rec, __recorder_chunk::npos);
+	rec->samples.clear();
+	for (size_t i = 0; i < rec->traces.size(); i++)
+		rec->samples.push_back(__recorder_get_chunk(rec, i));
+
+	rec->stop = false;
+	rec->writer = std::thread(__recorder_run, rec);
+	return true;
+}
+
+
+/*
+ * recorder_spike - record a spike of a neuron
+ */
+inline
+void
+recorder_spike(recorder *rec, std::uint32_t neuron, std::uint64_t tick)
+{
+	assert(rec != nullptr && rec->spikes);
+	auto &chunk = *rec->spikes;
+	chunk.neurons.push_back(neuron);
+	chunk.ticks.push_back(tick);
+	rec->stats.spikes += 1;
+	if (chunk.ticks.size() >= rec->config.spike_chunk_size)
+		__recorder_submit(rec, rec->spikes);
+}
+
+
+/*
+ * recorder_spikes - record the spikes of several neurons during one tick
+ */
+inline
+void
+recorder_spikes(recorder *rec, std::span<const std::uint32_t> neurons, std::uint64_t tick)
+{
+	for (auto n: neurons)
+		recorder_spike(rec, n, tick);
+}
+
+
+/*
+ * recorder_sample - record a sample of a trace
+ *
+ * The sample is only recorded if tick is a multiple of the trace's interval.
+ * values must contain n_vars values. Returns true if the sample was recorded.
+ */
+inline
+bool
+recorder_sample(recorder *rec, size_t trace, std::uint64_t tick, std::span<const double> values)
+{
+	assert(rec != nullptr && trace < rec->samples.size());
+	const auto &desc = rec->traces[trace];
+	if (tick % desc.interval)
+		return false;
+	if (values.size() != desc.n_vars) {
+		log_error("recorder: sample of trace '", desc.name, "' has ", values.size(), " values, expected ", desc.n_vars, "\n");
+		return false;
+	}
+
+	auto &chunk = *rec->samples[trace];
+	chunk.ticks.push_back(tick);
+	chunk.values.insert(chunk.values.end(), values.begin(), values.end());
+	rec->stats.samples += 1;
+	if (chunk.ticks.size() >= rec->config.sample_chunk_size)
+		__recorder_submit(rec, rec->samples[trace]);
+	return true;
+}
+
+
+/*
+ * recorder_flush - write all recorded data and wait until it is written
+ */
+inline
+void
+recorder_flush(recorder *rec)
+{
+	assert(rec != nullptr);
+	if (!rec->writer.joinable())
+		return;
+	__recorder_submit(rec, rec->spikes);
+	for (auto &chunk: rec->samples)
+		__recorder_submit(rec, chunk);
+
+	std::unique_lock<std::mutex> lock(rec->mtx);
+	rec->cv_done.wait(lock, [&]{ return rec->pending.empty() && !rec->busy; });
+}
+
+
+/*
+ * recorder_stop - write all recorded data, stop the background thread, and
+ * finalize the backend
+ */
+inline
+void
+recorder_stop(recorder *rec)
+{
+	assert(rec != nullptr);
+	if (!rec->writer.joinable())
+		return;
+	recorder_flush(rec);
+	{
+		std::lock_guard<std::mutex> lock(rec->mtx);
+		rec->stop = true;
+	}
+	rec->cv_pending.notify_one();
+	rec->writer.join();
+
+	rec->backend->finalize();
+	rec->backend.reset();
+	rec->spikes.reset();
+	rec->samples.clear();
+	rec->free_chunks.clear();
+}
+
+
+/*
+ * recorder_get_statistics - get the counters of a recorder
+ */
+inline
+recorder_statistics
+recorder_get_statistics(recorder *rec)
+{
+	assert(rec != nullptr);
+	std::lock_guard<std::mutex> lock(rec->mtx);
+	return rec->stats;
+}
+
+
+inline
+recorder::~recorder()
+{
+	recorder_stop(this);
+}
+
+
+
+#ifdef NCR_RECORDER_ENABLE_HDF5
+
+/*
+ * recorder_backend_hdf5 - write recorded chunks to extendible HDF5 datasets
+ *
+ * Each dataset is chunked with chunk_size rows. If compression is larger than
+ * zero, the datasets are compressed with deflate of the given level (1-9).
+ */
+struct recorder_backend_hdf5 : recorder_backend
+{
+	explicit
+	recorder_backend_hdf5(std::string filename, size_t chunk_size = 4096, unsigned compression = 0)
+	: _filename(std::move(filename)), _chunk_size(chunk_size ? chunk_size : 1), _compression(compression)
+	{}
+
+	bool
+	init(const std::vector<recorder_trace> &traces) override
+	{
+		try {
+			this->_file = std::make_unique<HighFive::File>(this->_filename,
+				HighFive::File::ReadWrite | HighFive::File::Create | HighFive::File::Truncate);
+
+			this->_spike_neurons = std::make_unique<HighFive::DataSet>(
+				this->_create<std::uint32_t>("/spikes/neuron", 0));
+			this->_spike_ticks = std::make_unique<HighFive::DataSet>(
+				this->_create<std::uint64_t>("/spikes/tick", 0));
+
+			this->_traces.clear();
+			for (const auto &trace: traces) {
+				const std::string group = "/traces/" + trace.name;
+				this->_traces.push_back({
+					this->_create<std::uint64_t>(group + "/tick", 0),
+					this->_create<double>(group + "/values", trace.n_vars),
+					trace.n_vars,
+					0});
+			}
+			this->_n_spikes = 0;
+		}
+		catch (const HighFive::Exception &e) {
+			log_error("recorder_backend_hdf5: ", e.what(), "\n");
+			return false;
+		}
+		return true;
+	}
+
+	bool
+	write_spikes(std::span<const std::uint32_t> neurons, std::span<const std::uint64_t> ticks) override
+	{
+		try {
+			const size_t offset = this->_n_spikes;
+			const size_t n = ticks.size();
+			this->_spike_neurons->resize({offset + n});
+			this->_spike_neurons->select({offset}, {n}).write_raw(neurons.data());
+			this->_spike_ticks->resize({offset + n});
+			this->_spike_ticks->select({offset}, {n}).write_raw(ticks.data());
+			this->_n_spikes += n;
+		}
+		catch (const HighFive::Exception &e) {
+			log_error("recorder_backend_hdf5: ", e.what(), "\n");
+			return false;
+		}
+		return true;
+	}
+
+	bool
+	write_samples(size_t trace, std::span<const std::uint64_t> ticks, std::span<const double> values) override
+	{
+		try {
+			auto &t = this->_traces[trace];
+			const size_t offset = t.n_samples;
+			const size_t n = ticks.size();
+			t.ticks.resize({offset + n});
+			t.ticks.select({offset}, {n}).write_raw(ticks.data());
+			t.values.resize({offset + n, t.n_vars});
+			t.values.select({offset, 0}, {n, t.n_vars}).write_raw(values.data());
+			t.n_samples += n;
+		}
+		catch (const HighFive::Exception &e) {
+			log_error("recorder_backend_hdf5: ", e.what(), "\n");
+			return false;
+		}
+		return true;
+	}
+
+	void
+	finalize() override
+	{
+		if (this->_file)
+			this->_file->flush();
+		this->_traces.clear();
+		this->_spike_neurons.reset();
+		this->_spike_ticks.reset();
+		this->_file.reset();
+	}
+
+private:
+	struct _trace_datasets {
+		HighFive::DataSet ticks;
+		HighFive::DataSet values;
+		size_t            n_vars;
+		size_t            n_samples;
+	};
+
+	// create an extendible dataset. 1D if n_cols is 0, 2D otherwise
+	template <typename T>
+	HighFive::DataSet
+	_create(const std::string &path, size_t n_cols)
+	{
+		HighFive::DataSetCreateProps props;
+		if (n_cols) {
+			HighFive::DataSpace space({0, n_cols}, {HighFive::DataSpace::UNLIMITED, n_cols});
+			props.add(HighFive::Chunking(std::vector<hsize_t>{this->_chunk_size, n_cols}));
+			if (this->_compression)
+				props.add(HighFive::Deflate(this->_compression));
+			return this->_file->createDataSet<T>(path, space, props);
+		}
+		HighFive::DataSpace space({0}, {HighFive::DataSpace::UNLIMITED});
+		props.add(HighFive::Chunking(std::vector<hsize_t>{this->_chunk_size}));
+		if (this->_compression)
+			props.add(HighFive::Deflate(this->_compression));
+		return this->_file->createDataSet<T>(path, space, props);
+	}
+
+	std::string                        _filename;
+	size_t                             _chunk_size;
+	unsigned                           _compression;
+	std::unique_ptr<HighFive::File>    _file;
+	std::unique_ptr<HighFive::DataSet> _spike_neurons;
+	std::unique_ptr<HighFive::DataSet> _spike_ticks;
+	std::vector<_trace_datasets>       _traces;
+	size_t                             _n_spikes = 0;
+};
+
+#endif // NCR_RECORDER_ENABLE_HDF5
+
+
+} // ncr::
@@ -14,11 +14,33 @@
 #include <cassert>
 #include <thread>
 #include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <cstddef>
+#include <bit>
+#include <algorithm>
+#include <type_traits>
+#include <array>
+#include <memory>
+#include <string>
+#include <vector>
+#include <concepts>
+
+#include <sys/stat.h>
+#include <unistd.h>
 
 #include <ncr/ncr_log.hpp>
+#include <ncr/ncr_parallel.hpp>
 #include <ncr/ncr_units.hpp>
 #include <ncr/ncr_common.hpp>
 
+// instrumentation of simulation_run, i.e. tick latency histograms, timers of
+// callbacks and phases, and periodic reports. If this is false, no clocks
+// will be read during the simulation loop
+#ifndef NCR_SIMULATION_PROFILING
+#	define NCR_SIMULATION_PROFILING true
+#endif
+
 namespace ncr {
 
 
@@ -101,12 +123,29 @@ struct simulation_config {
 	// than this delta-t
 	// This value will be ignored if running in timeless mode.
 	double              dt       = 0.1_ms;
+
+	// wall-clock interval in which the report callback is invoked.
+	// This value will be ignored if no report callback is set.
+	std::chrono::milliseconds report_interval{1000};
+
+	// file to which simulation_run writes a checkpoint every
+	// checkpoint_interval of wall-clock time, see simulation_checkpoint.
+	// Periodic checkpoints are disabled if the path is empty or the interval
+	// is 0.
+	std::string               checkpoint_path{};
+	std::chrono::milliseconds checkpoint_interval{0};
 };
 
 
 // typedefs for the callbacks for better readability
 typedef bool (*cb_stop_condition_fn_t)(const iteration_state*, void *data);
 typedef void (*cb_tick_fn_t)(const iteration_state*, void *data);
+typedef void (*cb_phase_fn_t)(const iteration_state*, size_t begin, size_t end, unsigned worker, void *data);
+
+struct simulation;
+struct simulation_profile;
+typedef void (*cb_command_fn_t)(simulation*, void *data);
+typedef void (*cb_report_fn_t)(const simulation*, const simulation_profile*, void *data);
 
 
 /*
@@ -147,6 +186,11 @@ struct simulation_callbacks {
 	//       numerical epsilon.
 	cb_tick_fn_t tick = nullptr;
 
+	// report is called periodically, see simulation_config::report_interval,
+	// with the profile of the running simulation. This requires
+	// NCR_SIMULATION_PROFILING
+	cb_report_fn_t report = nullptr;
+
 	// often, it is necessary to access some user defined variables during a
 	// simulation, e.g. to track global state without having static global
 	// variables. this is what the `data` field is made for. `data` will be
@@ -179,6 +223,314 @@ struct simulation_run_statistics {
 	std::chrono::seconds      runtime_s;
 	std::chrono::hours        runtime_h;
 	std::chrono::days         runtime_d;
+
+	// simulated ticks and time. The expected time is 0 for a timeless
+	// simulation
+	std::uint64_t             ticks                = 0;
+	double                    expected_simtime_ms  = 0.0;
+	double                    effective_simtime_ms = 0.0;
+
+	// simulated time per wall-clock time, 0 for a timeless simulation
+	double                    realtime_factor      = 0.0;
+
+	// tick latencies. These are only available with NCR_SIMULATION_PROFILING
+	double                    iter_cma_ns          = 0.0;
+	std::chrono::nanoseconds  tick_p50{0};
+	std::chrono::nanoseconds  tick_p99{0};
+	std::chrono::nanoseconds  tick_max{0};
+};
+
+
+/*
+ * simulation_timer - accumulated runtime of a part of a simulation
+ */
+struct simulation_timer {
+	std::uint64_t            n_calls = 0;
+	std::chrono::nanoseconds total{0};
+	std::chrono::nanoseconds max{0};
+
+	void
+	record(std::chrono::nanoseconds dt)
+	{
+		n_calls += 1;
+		total   += dt;
+		max      = std::max(max, dt);
+	}
+
+	double
+	mean_ns() const
+	{
+		return n_calls ? static_cast<double>(total.count()) / static_cast<double>(n_calls) : 0.0;
+	}
+
+	void reset() { *this = simulation_timer{}; }
+};
+
+
+/*
+ * latency_histogram - fixed-size log-linear histogram of durations
+ *
+ * Each power of two of nanoseconds is split into 8 linear sub-buckets, so
+ * recording is a few bit operations and quantiles are accurate to within
+ * 12.5%. The histogram covers the full range of 64 bit nanoseconds and never
+ * allocates.
+ */
+struct latency_histogram {
+	constexpr static unsigned sub_bits = 3;
+	constexpr static unsigned n_sub    = 1u << sub_bits;
+	constexpr static unsigned n_bins   = (64 - sub_bits + 1) * n_sub;
+
+	std::array<std::uint64_t, n_bins> bins{};
+	std::uint64_t                     count = 0;
+	std::uint64_t                     max   = 0;
+
+	static constexpr unsigned
+	bin(std::uint64_t ns)
+	{
+		if (ns < n_sub)
+			return static_cast<unsigned>(ns);
+		const unsigned msb = static_cast<unsigned>(std::bit_width(ns)) - 1;
+		const unsigned sub = static_cast<unsigned>(ns >> (msb - sub_bits)) & (n_sub - 1);
+		return (msb - sub_bits + 1) * n_sub + sub;
+	}
+
+	// smallest duration that falls into bin i
+	static constexpr std::uint64_t
+	lower_bound(unsigned i)
+	{
+		if (i < n_sub)
+			return i;
+		const unsigned msb = i / n_sub + sub_bits - 1;
+		return (std::uint64_t(1) << msb) | (std::uint64_t(i % n_sub) << (msb - sub_bits));
+	}
+
+	void
+	record(std::chrono::nanoseconds dt)
+	{
+		const std::uint64_t ns = dt.count() > 0 ? static_cast<std::uint64_t>(dt.count()) : 0;
+		bins[bin(ns)] += 1;
+		count += 1;
+		max = std::max(max, ns);
+	}
+
+	// duration below which a fraction q of all recorded durations lie. The
+	// result is the upper end of the bin, but never more than the maximum
+	std::chrono::nanoseconds
+	quantile(double q) const
+	{
+		if (count == 0)
+			return std::chrono::nanoseconds{0};
+		const auto rank = static_cast<std::uint64_t>(std::ceil(std::clamp(q, 0.0, 1.0) * static_cast<double>(count)));
+		std::uint64_t seen = 0;
+		for (unsigned i = 0; i < n_bins; i++) {
+			seen += bins[i];
+			if (seen >= std::max<std::uint64_t>(rank, 1)) {
+				const std::uint64_t upper = i + 1 < n_bins ? lower_bound(i + 1) - 1 : max;
+				return std::chrono::nanoseconds{static_cast<std::int64_t>(std::min(upper, max))};
+			}
+		}
+		return std::chrono::nanoseconds{static_cast<std::int64_t>(max)};
+	}
+
+	void
+	reset()
+	{
+		bins.fill(0);
+		count = 0;
+		max   = 0;
+	}
+};
+
+
+/*
+ * simulation_profile - instrumentation of a running simulation
+ *
+ * The profile is reset at the start of simulation_run and maintained only if
+ * NCR_SIMULATION_PROFILING is true. Phases carry their own timers, see
+ * simulation_phase.
+ */
+struct simulation_profile {
+	// latency of each tick from the start of the iteration until all phases
+	// are done, excluding any time in which the simulation was paused
+	latency_histogram tick_latency;
+
+	// cumulative moving average of the tick latency
+	long double       iter_cma = 0.0L;
+
+	// timers of the callbacks, of command handling, and of checkpoints
+	simulation_timer  stop_condition;
+	simulation_timer  tick;
+	simulation_timer  commands;
+	simulation_timer  checkpoint;
+
+	// wall-clock start of the run and time of the last report
+	std::chrono::steady_clock::time_point loop_start;
+	std::chrono::steady_clock::time_point last_report;
+};
+
+
+/*
+ * simulation_phase - one phase of a simulation tick
+ *
+ * Phases split a tick into ordered steps, e.g. integrating neurons, emitting
+ * spikes, delivering messages, and plasticity. The items [0, n_items) of a
+ * phase are split into chunks of at most grain items, and fn is called as
+ * fn(iteration, begin, end, worker, data) for each chunk. The chunks of a
+ * phase are distributed over the workers of the simulation's thread pool, and
+ * the next phase starts only after all chunks of the previous phase are done.
+ * The worker index is in [0, config.nthreads) and meant to select per-worker
+ * scratch memory. A phase with n_items = 0 is serial and called once with
+ * begin = end = 0 on the thread that runs the simulation.
+ *
+ * n_items and grain can be changed between ticks via simulation_get_phase.
+ */
+struct simulation_phase {
+	// name of the phase, used for reporting
+	std::string   name;
+
+	// callback which processes a chunk of items
+	cb_phase_fn_t fn      = nullptr;
+
+	// number of items of the phase, 0 for a serial phase
+	size_t        n_items = 0;
+
+	// maximal number of items per chunk
+	size_t        grain   = 1024;
+
+	// user data passed to fn. If this is nullptr, the data of the
+	// simulation_callbacks will be passed
+	void         *data    = nullptr;
+
+	// timing of the phase, accumulated over all ticks. This is only
+	// maintained with NCR_SIMULATION_PROFILING
+	simulation_timer timer{};
+};
+
+
+/*
+ * simulation_command - a request that is executed by the simulation loop
+ *
+ * Commands are executed on the thread that runs the simulation between two
+ * ticks, and also while the simulation is paused. Hence, fn may safely modify
+ * the state of the simulation, e.g. to resume it, or forward a string to
+ * cmd_execute_string. The memory pointed to by data must stay valid until
+ * the command was executed.
+ */
+struct simulation_command {
+	cb_command_fn_t fn   = nullptr;
+	void           *data = nullptr;
+};
+
+
+/*
+ * simulation_command_queue - bounded lock-free multi-producer queue
+ *
+ * Any number of threads may push commands, but only the simulation loop pops
+ * them. This is the bounded queue of Vyukov, in which each slot carries a
+ * sequence number that tells producers and the consumer whether the slot is
+ * free or filled. Neither push nor pop allocate or block.
+ */
+struct simulation_command_queue {
+	explicit simulation_command_queue(size_t capacity = 256)
+	{
+		// round up to a power of two for cheap index masking
+		size_t n = 2;
+		while (n < capacity)
+			n <<= 1;
+		_mask  = n - 1;
+		_slots = std::make_unique<slot[]>(n);
+		for (size_t i = 0; i < n; i++)
+			_slots[i].seq.store(i, std::memory_order_relaxed);
+	}
+
+	size_t capacity() const { return _mask + 1; }
+
+	// push a command. Returns false if the queue is full
+	bool
+	push(const simulation_command &cmd)
+	{
+		size_t pos = _tail.load(std::memory_order_relaxed);
+		slot *s;
+		while (true) {
+			s = &_slots[pos & _mask];
+			const size_t seq = s->seq.load(std::memory_order_acquire);
+			const auto diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos);
+			if (diff == 0) {
+				if (_tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+					break;
+			}
+			else if (diff < 0)
+				return false;
+			else
+				pos = _tail.load(std::memory_order_relaxed);
+		}
+		s->cmd = cmd;
+		s->seq.store(pos + 1, std::memory_order_release);
+		return true;
+	}
+
+	// pop a command. Must only be called from the consumer thread
+	bool
+	pop(simulation_command &cmd)
+	{
+		slot &s = _slots[_head & _mask];
+		if (s.seq.load(std::memory_order_acquire) != _head + 1)
+			return false;
+		cmd = s.cmd;
+		s.seq.store(_head + _mask + 1, std::memory_order_release);
+		_head += 1;
+		return true;
+	}
+
+	// test if there is a command to pop. Must only be called from the
+	// consumer thread
+	bool
+	empty() const
+	{
+		return _slots[_head & _mask].seq.load(std::memory_order_acquire) != _head + 1;
+	}
+
+private:
+	struct slot {
+		std::atomic<size_t> seq;
+		simulation_command  cmd;
+	};
+
+	std::unique_ptr<slot[]> _slots;
+	size_t                  _mask = 0;
+	alignas(64) std::atomic<size_t> _tail = 0;
+	alignas(64) size_t              _head = 0;
+};
+
+
+/*
+ * simulation_state_block - user state that is part of a checkpoint
+ *
+ * A block is either a raw block of bytes bytes at obj, or an object which is
+ * written and read via the size, save, and load functions. See
+ * simulation_state, which creates blocks for trivially copyable objects (e.g.
+ * RNG states), vectors of them (e.g. arrays of neuron states), and
+ * checkpointable types such as slab_memory.
+ */
+struct simulation_state_block {
+	std::string name;
+	void       *obj   = nullptr;
+	size_t      bytes = 0;
+
+	size_t    (*size)(const void *obj) = nullptr;
+	void      (*save)(const void *obj, std::byte *dst) = nullptr;
+	bool      (*load)(void *obj, const std::byte *src, size_t size) = nullptr;
+};
+
+
+/*
+ * checkpointable - types that provide their own raw snapshot
+ */
+template <typename T>
+concept checkpointable = requires(T &obj, const T &cobj, std::byte *dst, const std::byte *src, size_t size) {
+	{ cobj.checkpoint_size() } -> std::convertible_to<size_t>;
+	cobj.checkpoint_save(dst);
+	{ obj.checkpoint_load(src, size) } -> std::convertible_to<bool>;
 };
 
 
@@ -197,6 +549,35 @@ struct simulation {
 
 	// iteration state of the simulation
 	iteration_state                iteration;
+
+	// ordered phases of each tick, see simulation_add_phase
+	std::vector<simulation_phase>  phases{};
+
+	// instrumentation of the current or last run
+	simulation_profile             profile{};
+
+	// worker pool of the phases, created lazily when the simulation runs
+	std::unique_ptr<thread_pool>   pool{};
+
+	// user command requests, see simulation_post
+	simulation_command_queue       commands{};
+
+	// user state that is written to and restored from checkpoints
+	std::vector<simulation_state_block> state_blocks{};
+	std::vector<std::byte>         checkpoint_buffer{};
+
+	// set if the next tick is the last one of a timed simulation. This is
+	// part of the simulation state to allow resuming from a checkpoint
+	bool                           last_iteration = false;
+
+	// set while the tick callback and the phases of a tick run, during which
+	// checkpoints are rejected
+	bool                           in_tick = false;
+
+	// incremented whenever the loop must re-evaluate whether it is paused,
+	// i.e. on pause, resume, stop, and new commands. A paused loop blocks in
+	// an atomic wait on this counter instead of spinning
+	std::atomic<std::uint32_t>     control_epoch{0};
 };
 
 
@@ -207,6 +588,345 @@ struct simulation {
 //       functions.
 
 
+/*
+ * simulation_checkpoint_header - first 64 bytes of a checkpoint file
+ *
+ * A checkpoint file consists of this header, a directory of n_blocks
+ * simulation_checkpoint_entry, and the payloads of the blocks. All payloads
+ * start at multiples of simulation_checkpoint_alignment bytes, so that a
+ * memory mapped checkpoint can be accessed in place. All values are stored
+ * in the byte order of the machine that wrote the checkpoint.
+ */
+struct simulation_checkpoint_header {
+	char          magic[8];
+	std::uint32_t version;
+	std::uint32_t n_blocks;
+	std::uint64_t ticks;
+	double        t;
+	double        dt;
+	double        t_0;
+	double        t_max;
+	std::uint64_t flags;
+};
+
+struct simulation_checkpoint_entry {
+	char          name[48];
+	std::uint64_t offset;
+	std::uint64_t size;
+};
+
+constexpr char          simulation_checkpoint_magic[8]     = {'N', 'C', 'R', 'C', 'K', 'P', 'T', '\0'};
+constexpr std::uint32_t simulation_checkpoint_version      = 1;
+constexpr size_t        simulation_checkpoint_alignment    = 64;
+constexpr std::uint64_t simulation_checkpoint_timeless     = 1u << 0;
+constexpr std::uint64_t simulation_checkpoint_last_iteration = 1u << 1;
+
+static_assert(sizeof(simulation_checkpoint_header) == 64);
+static_assert(sizeof(simulation_checkpoint_entry) == 64);
+
+
+/*
+ * simulation_register_state - add a state block to the checkpoints of sim
+ *
+ * Names identify the blocks when restoring, must be unique, and must be
+ * shorter than 48 characters. The registered objects must outlive sim.
+ */
+inline
+bool
+simulation_register_state(simulation *sim, simulation_state_block block)
+{
+	assert(sim != nullptr);
+	if (block.name.empty() || block.name.size() >= sizeof(simulation_checkpoint_entry::name)) {
+		log_error("invalid name of simulation state block '", block.name, "'\n");
+		return false;
+	}
+	for (const auto &b : sim->state_blocks) {
+		if (b.name == block.name) {
+			log_error("duplicate simulation state block '", block.name, "'\n");
+			return false;
+		}
+	}
+	sim->state_blocks.push_back(std::move(block));
+	return true;
+}
+
+
+/*
+ * simulation_state - describe user state as a simulation_state_block
+ *
+ * There are overloads for raw memory, trivially copyable objects such as
+ * random number generators, vectors of trivially copyable elements, which
+ * are resized when restoring, and checkpointable types such as slab_memory.
+ */
+inline
+simulation_state_block
+simulation_state(std::string name, void *ptr, size_t bytes)
+{
+	return simulation_state_block{.name = std::move(name), .obj = ptr, .bytes = bytes};
+}
+
+
+template <typename T>
+requires checkpointable<T>
+simulation_state_block
+simulation_state(std::string name, T &obj)
+{
+	return simulation_state_block{
+		.name  = std::move(name),
+		.obj   = &obj,
+		.size  = [](const void *o) -> size_t { return static_cast<const T*>(o)->checkpoint_size(); },
+		.save  = [](const void *o, std::byte *dst) { static_cast<const T*>(o)->checkpoint_save(dst); },
+		.load  = [](void *o, const std::byte *src, size_t n) -> bool { return static_cast<T*>(o)->checkpoint_load(src, n); },
+	};
+}
+
+
+template <typename T>
+requires (!checkpointable<T> && std::is_trivially_copyable_v<T>)
+simulation_state_block
+simulation_state(std::string name, T &obj)
+{
+	return simulation_state(std::move(name), static_cast<void*>(&obj), sizeof(T));
+}
+
+
+template <typename T>
+requires std::is_trivially_copyable_v<T>
+simulation_state_block
+simulation_state(std::string name, std::vector<T> &vec)
+{
+	return simulation_state_block{
+		.name  = std::move(name),
+		.obj   = &vec,
+		.size  = [](const void *o) -> size_t { return static_cast<const std::vector<T>*>(o)->size() * sizeof(T); },
+		.save  = [](const void *o, std::byte *dst) {
+			auto v = static_cast<const std::vector<T>*>(o);
+			if (!v->empty()) std::memcpy(dst, v->data(), v->size() * sizeof(T));
+		},
+		.load  = [](void *o, const std::byte *src, size_t n) -> bool {
+			if (n % sizeof(T))
+				return false;
+			auto v = static_cast<std::vector<T>*>(o);
+			v->resize(n / sizeof(T));
+			if (n) std::memcpy(v->data(), src, n);
+			return true;
+		},
+	};
+}
+
+
+/*
+ * simulation_register_state - add user state to the checkpoints of sim
+ */
+template <typename... Args>
+bool
+simulation_register_state(simulation *sim, std::string name, Args &&...args)
+{
+	return simulation_register_state(sim, simulation_state(std::move(name), std::forward<Args>(args)...));
+}
+
+
+/*
+ * __simulation_block_size - payload size of a state block
+ */
+inline
+size_t
+__simulation_block_size(const simulation_state_block &block)
+{
+	return block.size ? block.size(block.obj) : block.bytes;
+}
+
+
+/*
+ * simulation_checkpoint - write the state of a simulation to a file
+ *
+ * The file contains the iteration state and all registered state blocks, see
+ * simulation_checkpoint_header. The checkpoint is first written to a
+ * temporary file next to path, flushed to disk, and then renamed to path.
+ * Hence, path either contains the previous or the new checkpoint, even if the
+ * process is killed while writing. Raw blocks are written straight from
+ * memory, other blocks are serialized into a buffer that is kept across
+ * checkpoints.
+ *
+ * This must be called from the thread that runs the simulation between two
+ * ticks, e.g. from a command, or when the simulation is not running. Calls
+ * from the tick callback or from a phase fail, because the iteration state is
+ * only advanced after the tick, and a restored simulation would repeat the
+ * tick.
+ */
+inline
+bool
+simulation_checkpoint(simulation *sim, const std::string &path)
+{
+	assert(sim != nullptr);
+
+	if (sim->in_tick) {
+		log_error("cannot write checkpoint ", path, " during a tick\n");
+		return false;
+	}
+
+	auto align = [](size_t offset) {
+		return (offset + simulation_checkpoint_alignment - 1) / simulation_checkpoint_alignment * simulation_checkpoint_alignment;
+	};
+
+	const size_t n_blocks = sim->state_blocks.size();
+	simulation_checkpoint_header header{};
+	std::memcpy(header.magic, simulation_checkpoint_magic, sizeof(header.magic));
+	header.version  = simulation_checkpoint_version;
+	header.n_blocks = static_cast<std::uint32_t>(n_blocks);
+	header.ticks    = sim->iteration.ticks;
+	header.t        = sim->iteration.t;
+	header.dt       = sim->iteration.dt;
+	header.t_0      = sim->iteration.t_0;
+	header.t_max    = sim->iteration.t_max;
+	header.flags    = (sim->iteration.timeless ? simulation_checkpoint_timeless : 0)
+	                | (sim->last_iteration ? simulation_checkpoint_last_iteration : 0);
+
+	std::vector<simulation_checkpoint_entry> entries(n_blocks);
+	size_t offset = align(sizeof(header) + n_blocks * sizeof(simulation_checkpoint_entry));
+	for (size_t i = 0; i < n_blocks; i++) {
+		const auto &block = sim->state_blocks[i];
+		std::memset(entries[i].name, 0, sizeof(entries[i].name));
+		std::memcpy(entries[i].name, block.name.data(), block.name.size());
+		entries[i].offset = offset;
+		entries[i].size   = __simulation_block_size(block);
+		offset = align(offset + entries[i].size);
+	}
+
+	const std::string tmp_path = path + ".tmp";
+	std::FILE *f = std::fopen(tmp_path.c_str(), "wb");
+	if (!f) {
+		log_error("cannot open checkpoint file ", tmp_path, "\n");
+		return false;
+	}
+
+	// write with zero padding up to the offset of the next payload
+	static const std::byte padding[simulation_checkpoint_alignment] = {};
+	size_t pos = 0;
+	bool ok = true;
+	auto write = [&](const void *data, size_t n) {
+		ok = ok && (n == 0 || std::fwrite(data, 1, n, f) == n);
+		pos += n;
+	};
+	auto pad_to = [&](size_t target) {
+		write(padding, target - pos);
+	};
+
+	write(&header, sizeof(header));
+	write(entries.data(), entries.size() * sizeof(simulation_checkpoint_entry));
+	for (size_t i = 0; i < n_blocks && ok; i++) {
+		const auto &block = sim->state_blocks[i];
+		pad_to(entries[i].offset);
+		if (!block.save) {
+			write(block.obj, entries[i].size);
+			continue;
+		}
+		sim->checkpoint_buffer.resize(entries[i].size);
+		block.save(block.obj, sim->checkpoint_buffer.data());
+		write(sim->checkpoint_buffer.data(), entries[i].size);
+	}
+	pad_to(offset);
+
+	ok = ok && std::fflush(f) == 0 && ::fsync(::fileno(f)) == 0;
+	ok = (std::fclose(f) == 0) && ok;
+	if (!ok || std::rename(tmp_path.c_str(), path.c_str()) != 0) {
+		log_error("cannot write checkpoint file ", path, "\n");
+		std::remove(tmp_path.c_str());
+		return false;
+	}
+	return true;
+}
+
+
+/*
+ * simulation_restore - restore the state of a simulation from a file
+ *
+ * All registered state blocks must be present in the checkpoint with
+ * matching sizes for raw blocks. Blocks in the file that were not registered
+ * are ignored. t_max of the configuration takes precedence over the
+ * checkpoint, so that a restored simulation can also be extended. Returns
+ * false if the file cannot be read or does not match, in which case the
+ * simulation state might be partially restored.
+ */
+inline
+bool
+simulation_restore(simulation *sim, const std::string &path)
+{
+	assert(sim != nullptr);
+
+	std::FILE *f = std::fopen(path.c_str(), "rb");
+	if (!f) {
+		log_error("cannot open checkpoint file ", path, "\n");
+		return false;
+	}
+	auto &buffer = sim->checkpoint_buffer;
+	bool ok = std::fseek(f, 0, SEEK_END) == 0;
+	const long file_size = ok ? std::ftell(f) : -1;
+	ok = ok && file_size >= 0 && std::fseek(f, 0, SEEK_SET) == 0;
+	if (ok) {
+		buffer.resize(static_cast<size_t>(file_size));
+		ok = buffer.empty() || std::fread(buffer.data(), 1, buffer.size(), f) == buffer.size();
+	}
+	std::fclose(f);
+
+	simulation_checkpoint_header header;
+	ok = ok && buffer.size() >= sizeof(header);
+	if (ok)
+		std::memcpy(&header, buffer.data(), sizeof(header));
+	ok = ok && std::memcmp(header.magic, simulation_checkpoint_magic, sizeof(header.magic)) == 0
+	        && header.version == simulation_checkpoint_version
+	        && (buffer.size() - sizeof(header)) / sizeof(simulation_checkpoint_entry) >= header.n_blocks;
+	if (!ok) {
+		log_error("invalid checkpoint file ", path, "\n");
+		return false;
+	}
+	if (((header.flags & simulation_checkpoint_timeless) != 0) != sim->config.timeless) {
+		log_error("checkpoint ", path, " does not match the simulation mode\n");
+		return false;
+	}
+
+	std::vector<simulation_checkpoint_entry> entries(header.n_blocks);
+	if (!entries.empty())
+		std::memcpy(entries.data(), buffer.data() + sizeof(header), entries.size() * sizeof(simulation_checkpoint_entry));
+
+	for (auto &block : sim->state_blocks) {
+		const simulation_checkpoint_entry *entry = nullptr;
+		for (auto &e : entries) {
+			if (std::strncmp(e.name, block.name.c_str(), sizeof(e.name)) == 0) {
+				entry = &e;
+				break;
+			}
+		}
+		if (!entry || entry->offset > buffer.size() || entry->size > buffer.size() - entry->offset) {
+			log_error("checkpoint ", path, " lacks state block '", block.name, "'\n");
+			return false;
+		}
+
+		const std::byte *src = buffer.data() + entry->offset;
+		if (!block.load) {
+			if (entry->size != block.bytes) {
+				log_error("size mismatch of state block '", block.name, "' in checkpoint ", path, "\n");
+				return false;
+			}
+			if (block.bytes)
+				std::memcpy(block.obj, src, block.bytes);
+		}
+		else if (!block.load(block.obj, src, entry->size)) {
+			log_error("cannot restore state block '", block.name, "' from checkpoint ", path, "\n");
+			return false;
+		}
+	}
+
+	sim->iteration.ticks = header.ticks;
+	sim->iteration.t     = header.t;
+	sim->iteration.dt    = header.dt;
+	sim->iteration.t_0   = header.t_0;
+	sim->last_iteration  = (header.flags & simulation_checkpoint_last_iteration) != 0
+	                    && header.t_max == sim->iteration.t_max;
+	return true;
+}
+
+
 /*
  * simulation_setup - set up a new simulation object given some callbacks
  */
@@ -261,6 +981,209 @@ simulation_setup(
 }
 
 
+/*
+ * simulation_setup - set up a simulation and resume it from a checkpoint
+ *
+ * Registers the state blocks and, if the checkpoint file exists, restores the
+ * simulation from it. Otherwise, the simulation starts from the beginning.
+ * This allows restarting preempted runs with the same arguments. If
+ * checkpoint_path is empty, config.checkpoint_path is used. Returns nullptr
+ * if the checkpoint exists but cannot be restored.
+ */
+inline
+simulation*
+simulation_setup(
+		const simulation_config &config,
+		const simulation_callbacks &callbacks,
+		std::vector<simulation_state_block> blocks,
+		std::string checkpoint_path = {})
+{
+	auto sim = simulation_setup(config, callbacks);
+	if (!sim)
+		return nullptr;
+
+	for (auto &block : blocks) {
+		if (!simulation_register_state(sim, std::move(block))) {
+			delete sim;
+			return nullptr;
+		}
+	}
+
+	if (checkpoint_path.empty())
+		checkpoint_path = config.checkpoint_path;
+	struct stat st;
+	if (checkpoint_path.empty() || ::stat(checkpoint_path.c_str(), &st) != 0)
+		return sim;
+
+	if (!simulation_restore(sim, checkpoint_path)) {
+		delete sim;
+		return nullptr;
+	}
+	log_debug("Resumed simulation from ", checkpoint_path, " at tick ", sim->iteration.ticks, "\n");
+	return sim;
+}
+
+
+/*
+ * simulation_add_phase - append a phase to each tick of a simulation
+ *
+ * Phases are executed in the order in which they were added, after the tick
+ * callback. Returns the index of the phase.
+ */
+inline
+size_t
+simulation_add_phase(simulation *sim, simulation_phase phase)
+{
+	assert(sim != nullptr);
+	assert(phase.fn != nullptr);
+	sim->phases.push_back(std::move(phase));
+	return sim->phases.size() - 1;
+}
+
+
+/*
+ * simulation_add_phase - append a phase to each tick of a simulation
+ */
+inline
+size_t
+simulation_add_phase(
+		simulation *sim,
+		std::string name,
+		cb_phase_fn_t fn,
+		size_t n_items = 0,
+		size_t grain = 1024,
+		void *data = nullptr)
+{
+	return simulation_add_phase(sim, simulation_phase{
+		.name    = std::move(name),
+		.fn      = fn,
+		.n_items = n_items,
+		.grain   = grain,
+		.data    = data,
+	});
+}
+
+
+/*
+ * simulation_get_phase - get a phase of a simulation, e.g. to resize it
+ */
+inline
+simulation_phase*
+simulation_get_phase(simulation *sim, size_t index)
+{
+	assert(sim != nullptr);
+	return index < sim->phases.size() ? &sim->phases[index] : nullptr;
+}
+
+
+/*
+ * __simulation_timed - call fn and record its runtime in timer
+ *
+ * Without NCR_SIMULATION_PROFILING, this simply calls fn.
+ */
+template <typename Fn>
+inline
+decltype(auto)
+__simulation_timed([[maybe_unused]] simulation_timer &timer, Fn &&fn)
+{
+#if NCR_SIMULATION_PROFILING
+	using namespace std::chrono;
+	const auto start = steady_clock::now();
+	if constexpr (std::is_void_v<decltype(fn())>) {
+		fn();
+		timer.record(duration_cast<nanoseconds>(steady_clock::now() - start));
+	}
+	else {
+		auto result = fn();
+		timer.record(duration_cast<nanoseconds>(steady_clock::now() - start));
+		return result;
+	}
+#else
+	return fn();
+#endif
+}
+
+
+/*
+ * __simulation_run_phases - execute all phases of a tick
+ *
+ * thread_pool::run returns only after all chunks were processed, which is the
+ * barrier between consecutive phases.
+ */
+inline
+void
+__simulation_run_phases(simulation *sim)
+{
+	if (sim->phases.empty())
+		return;
+
+	if (!sim->pool)
+		sim->pool = std::make_unique<thread_pool>(sim->config.nthreads);
+
+	for (auto &phase : sim->phases) {
+		void *data = phase.data ? phase.data : sim->callbacks.data;
+		__simulation_timed(phase.timer, [&]{
+			if (phase.n_items == 0)
+				phase.fn(&sim->iteration, 0, 0, 0, data);
+			else
+				parallel_for(sim->pool.get(), phase.n_items, phase.grain,
+					[&](size_t begin, size_t end, unsigned worker) {
+						phase.fn(&sim->iteration, begin, end, worker, data);
+					});
+		});
+	}
+}
+
+
+/*
+ * __simulation_notify - wake up the simulation loop if it is paused
+ */
+inline
+void
+__simulation_notify(simulation *sim)
+{
+	sim->control_epoch.fetch_add(1, std::memory_order_release);
+	sim->control_epoch.notify_all();
+}
+
+
+/*
+ * __simulation_drain_commands - execute all pending commands
+ *
+ * At most one queue's worth of commands is executed, so that commands which
+ * post further commands cannot stall the simulation.
+ */
+inline
+void
+__simulation_drain_commands(simulation *sim)
+{
+	simulation_command cmd;
+	for (size_t i = 0; i < sim->commands.capacity() && sim->commands.pop(cmd); i++)
+		if (cmd.fn)
+			cmd.fn(sim, cmd.data);
+}
+
+
+/*
+ * __simulation_wait_while_paused - block until the loop has something to do
+ *
+ * Returns when the simulation was resumed or stopped, or a command arrived.
+ * The epoch is read before the conditions are evaluated, so any change that
+ * happens afterwards also changes the epoch and cannot be missed.
+ */
+inline
+void
+__simulation_wait_while_paused(simulation *sim)
+{
+	while (true) {
+		const auto epoch = sim->control_epoch.load(std::memory_order_acquire);
+		if (!sim->paused || !sim->running || !sim->commands.empty())
+			return;
+		sim->control_epoch.wait(epoch, std::memory_order_acquire);
+	}
+}
+
+
 inline
 simulation_run_statistics
 simulation_get_statistics(
@@ -297,12 +1220,97 @@ simulation_get_statistics(
 }
 
 
+/*
+ * simulation_get_statistics - statistics of a simulation's current state
+ *
+ * This includes the simulated time and the tick latencies of the profile. It
+ * must be called from the thread that runs the simulation, e.g. in the report
+ * callback, or after simulation_run returned.
+ */
+inline
+simulation_run_statistics
+simulation_get_statistics(
+	const simulation *sim,
+	std::chrono::steady_clock::time_point loop_start,
+	std::chrono::steady_clock::time_point loop_end)
+{
+	using namespace std::chrono;
+
+	auto result = simulation_get_statistics(loop_start, loop_end);
+
+	result.ticks                = sim->iteration.ticks;
+	result.expected_simtime_ms  = sim->config.timeless ? 0.0 : sim->iteration.t_max - sim->iteration.t_0;
+	result.effective_simtime_ms = sim->config.timeless ? 0.0 : sim->iteration.t - sim->iteration.t_0;
+
+	const double runtime_ms = std::chrono::duration<double, std::milli>(loop_end - loop_start).count();
+	if (!sim->config.timeless && runtime_ms > 0.0)
+		result.realtime_factor = result.effective_simtime_ms / runtime_ms;
+
+	const auto &profile = sim->profile;
+	result.iter_cma_ns = static_cast<double>(profile.iter_cma);
+	result.tick_p50    = profile.tick_latency.quantile(0.50);
+	result.tick_p99    = profile.tick_latency.quantile(0.99);
+	result.tick_max    = nanoseconds{static_cast<std::int64_t>(profile.tick_latency.max)};
+	return result;
+}
+
 
 /*
- * simulation_run - run a simulation
+ * __simulation_profile_reset - reset the profile at the start of a run
  */
 inline
 void
+__simulation_profile_reset(simulation *sim, std::chrono::steady_clock::time_point loop_start)
+{
+	auto &profile = sim->profile;
+	profile.tick_latency.reset();
+	profile.iter_cma = 0.0L;
+	profile.stop_condition.reset();
+	profile.tick.reset();
+	profile.commands.reset();
+	profile.checkpoint.reset();
+	profile.loop_start  = loop_start;
+	profile.last_report = loop_start;
+	for (auto &phase : sim->phases)
+		phase.timer.reset();
+}
+
+
+/*
+ * __simulation_profile_tick - record the latency of a tick and report
+ */
+inline
+void
+__simulation_profile_tick(
+		[[maybe_unused]] simulation *sim,
+		[[maybe_unused]] std::chrono::steady_clock::time_point iter_start)
+{
+#if NCR_SIMULATION_PROFILING
+	using namespace std::chrono;
+
+	auto &profile = sim->profile;
+	const auto now = steady_clock::now();
+	const auto iter_time = duration_cast<nanoseconds>(now - iter_start);
+
+	// cumulative moving average and histogram of the tick latency
+	profile.tick_latency.record(iter_time);
+	profile.iter_cma += (static_cast<long double>(iter_time.count()) - profile.iter_cma)
+	                  / static_cast<long double>(profile.tick_latency.count);
+
+	if (sim->callbacks.report && now - profile.last_report >= sim->config.report_interval) {
+		profile.last_report = now;
+		sim->callbacks.report(sim, &profile, sim->callbacks.data);
+	}
+#endif
+}
+
+
+
+/*
+ * simulation_run - run a simulation
+ */
+inline
+simulation_run_statistics
 simulation_run(simulation *sim)
 {
 	using namespace std::chrono;
@@ -311,27 +1319,45 @@ simulation_run(simulation *sim)
 	assert(sim != nullptr);
 	sim->running = true;
 
-	// measure code execution time, cumulative moving average
-	steady_clock::time_point loop_start, loop_end, iter_start, iter_end;
-	long double iter_cma = 0.0L;
+	// measure code execution time
+	steady_clock::time_point loop_start, loop_end, iter_start;
 	loop_start = steady_clock::now();
+	__simulation_profile_reset(sim, loop_start);
+
+	const bool periodic_checkpoints = !sim->config.checkpoint_path.empty()
+	                               && sim->config.checkpoint_interval.count() > 0;
+	auto last_checkpoint = loop_start;
 
-	bool is_last_iteration = false;
 	sim->iteration.timeless = sim->config.timeless;
 	while (sim->running) {
 		// iteration time measurement
+#if NCR_SIMULATION_PROFILING
 		iter_start = steady_clock::now();
+#endif
 
-		// TODO: handle any user command requests
+		// handle any user command requests. They might pause, resume, or
+		// stop the simulation
+		if (!sim->commands.empty())
+			__simulation_timed(sim->profile.commands, [&]{ __simulation_drain_commands(sim); });
+		if (!sim->running)
+			break;
 
-		// TODO: if the simulation is paused, move it to the background
-		if (sim->paused)
+		// a paused simulation sleeps until it is resumed, stopped, or
+		// receives a command
+		if (sim->paused) {
+			__simulation_wait_while_paused(sim);
 			continue;
+		}
 
 		// in a timeless simulation, need to evaluate the stop-condition
 		// callback. Due to the setup function, it is guaranteed in this case
 		// that the callback is available
-		if (sim->config.timeless && sim->callbacks.stop_condition(&sim->iteration, sim->callbacks.data)) {
+		auto stop_condition = [&]{
+			return __simulation_timed(sim->profile.stop_condition, [&]{
+				return sim->callbacks.stop_condition(&sim->iteration, sim->callbacks.data);
+			});
+		};
+		if (sim->config.timeless && stop_condition()) {
 			sim->running = false;
 			break;
 		}
@@ -339,7 +1365,7 @@ simulation_run(simulation *sim)
 			// in a timed simulation, it's unclear if the user specified a
 			// stop-condition. If yes, then evaluate the stop condition and do
 			// not evaluate the regular time comparison
-			if (sim->callbacks.stop_condition && sim->callbacks.stop_condition(&sim->iteration, sim->callbacks.data)) {
+			if (sim->callbacks.stop_condition && stop_condition()) {
 				sim->running = false;
 				break;
 			}
@@ -348,12 +1374,20 @@ simulation_run(simulation *sim)
 		// TODO: figure out if more information is needed in the callback
 		// TODO: determine if there are callbacks that need to be called
 		//       earlier, for instance to pause a simulation
+		sim->in_tick = true;
 		if (sim->callbacks.tick)
-			sim->callbacks.tick(&sim->iteration, sim->callbacks.data);
+			__simulation_timed(sim->profile.tick, [&]{ sim->callbacks.tick(&sim->iteration, sim->callbacks.data); });
+
+		// ordered, possibly parallel phases of the tick
+		__simulation_run_phases(sim);
+		sim->in_tick = false;
+
+		// tick latency and periodic reports
+		__simulation_profile_tick(sim, iter_start);
 
 		// this flag might have been set in the code block below during the
 		// previous iteration. Read the long comment below to understand why.
-		if (is_last_iteration) {
+		if (sim->last_iteration) {
 			sim->running = false;
 			break;
 		}
@@ -394,7 +1428,7 @@ simulation_run(simulation *sim)
 				// starts with t0, so advancing the time must happen _after_ the
 				// iteration callback was invoked. Overall, this carry-over flag
 				// is the cleanest way to check for the final iteration.
-				is_last_iteration = true;
+				sim->last_iteration = true;
 				sim->iteration.dt = tdelta;
 			}
 			sim->iteration.t += sim->iteration.dt;
@@ -404,42 +1438,46 @@ simulation_run(simulation *sim)
 		// simulation
 		sim->iteration.ticks += 1;
 
-		// measure simulation code execution time in a cumulative moving average
-		// Note that the computation will break as soon as sim->iteration.ticks
-		// overflows. This will, however, only rarely be the case for
-		// excessively long simulations.
-		iter_end = steady_clock::now();
-		auto iter_time = duration_cast<nanoseconds>(iter_end - iter_start).count();
-		iter_cma = iter_cma + (iter_time - iter_cma) / static_cast<double>(sim->iteration.ticks);
+		// periodic checkpoints happen between ticks, so that a restored
+		// simulation continues with the next tick
+		if (periodic_checkpoints && steady_clock::now() - last_checkpoint >= sim->config.checkpoint_interval) {
+			__simulation_timed(sim->profile.checkpoint, [&]{
+				simulation_checkpoint(sim, sim->config.checkpoint_path);
+			});
+			last_checkpoint = steady_clock::now();
+		}
 	}
 	loop_end = std::chrono::steady_clock::now();
 
-#if NCR_LOG_LEVEL >= NCR_LOG_LEVEL_DEBUG
-	// runtime statistics
-	auto stats = simulation_get_statistics(loop_start, loop_end);
-
-	// emit some statistics
-	// TODO: add iter_cma, expected_simtime_ms, and effective_simtime_ms to
-	//       simulation_run_statistics.
-
-	// this is the expected simulation time. It is 0 for a timeless simulation
-	double expected_simtime_ms = sim->iteration.t_max - sim->iteration.t_0;
-	// effective simulation time, which is the integrated time (which might
-	// deviate from expected_simtime in case of numerical issues, but this
-	// should be accounted for above
-	double effective_simtime_ms = sim->iteration.t;
+	// runtime statistics. The expected simulation time is 0 for a timeless
+	// simulation. The effective simulation time is the integrated time, which
+	// might deviate from the expected time in case of numerical issues, but
+	// this should be accounted for above
+	auto stats = simulation_get_statistics(sim, loop_start, loop_end);
 
+#if NCR_LOG_LEVEL >= NCR_LOG_LEVEL_DEBUG
 	log_debug(
 		std::scientific,
 		"Finished simulation\n",
 		"    Simulation Mode:          ", sim->config.timeless ? "timeless" : "timed", "\n",
-		"    Expected Simulated Time:  ", expected_simtime_ms, " ms (0 for timeless mode)\n"
-		"    Effective Simulated Time: ", effective_simtime_ms, " ms (0 for timeless mode)\n",
-		"    Simulated Ticks:          ", sim->iteration.ticks, "\n",
+		"    Expected Simulated Time:  ", stats.expected_simtime_ms, " ms (0 for timeless mode)\n"
+		"    Effective Simulated Time: ", stats.effective_simtime_ms, " ms (0 for timeless mode)\n",
+		"    Simulated Ticks:          ", stats.ticks, "\n",
 		"    Absolute Running Time:    ", stats.runtime_d.count(), "d ", stats.runtime_h.count(), "h ", stats.runtime_min.count(), "min ", stats.runtime_s.count(), "s ", stats.runtime_ms.count(), "ms\n",
-		"    1 Iteration Runtime CMA:  ", iter_cma, " ns\n",
-		"    Realtime Factor:          ", sim->config.timeless ? 0 : (effective_simtime_ms / stats.runtime_total_ms.count()), "\n");
+		"    1 Iteration Runtime CMA:  ", stats.iter_cma_ns, " ns\n",
+		"    Tick Latency p50/p99/max: ", stats.tick_p50.count(), " / ", stats.tick_p99.count(), " / ", stats.tick_max.count(), " ns\n",
+		"    Realtime Factor:          ", stats.realtime_factor, "\n");
+
+	for (const auto &phase : sim->phases) {
+		log_debug(
+			std::scientific,
+			"    Phase '", phase.name, "': ", phase.timer.n_calls, " calls, ",
+			phase.timer.mean_ns(), " ns mean, ",
+			static_cast<double>(phase.timer.max.count()), " ns max\n");
+	}
 #endif
+
+	return stats;
 }
 
 
@@ -471,6 +1509,7 @@ simulation_pause(simulation *sim)
 {
 	assert(sim != nullptr);
 	sim->paused = true;
+	__simulation_notify(sim);
 }
 
 
@@ -483,6 +1522,7 @@ simulation_resume(simulation *sim)
 {
 	assert(sim != nullptr);
 	sim->paused = false;
+	__simulation_notify(sim);
 }
 
 
@@ -495,6 +1535,34 @@ simulation_stop(simulation *sim)
 {
 	assert(sim != nullptr);
 	sim->running = false;
+	__simulation_notify(sim);
+}
+
+
+/*
+ * simulation_post - request the execution of a command by the simulation
+ *
+ * This function is thread-safe and lock-free. The command is executed by the
+ * simulation loop before the next tick, or immediately if the simulation is
+ * paused. Returns false if the command queue is full.
+ */
+inline
+bool
+simulation_post(simulation *sim, const simulation_command &cmd)
+{
+	assert(sim != nullptr);
+	if (!sim->commands.push(cmd))
+		return false;
+	__simulation_notify(sim);
+	return true;
+}
+
+
+inline
+bool
+simulation_post(simulation *sim, cb_command_fn_t fn, void *data = nullptr)
+{
+	return simulation_post(sim, simulation_command{.fn = fn, .data = data});
 }
 
 
@@ -18,10 +18,15 @@
 #include <unordered_map>
 #include <concepts>
 #include <functional>
+#include <type_traits>
+#include <algorithm>
+#include <memory>
 
 #include <ncr/ncr_units.hpp>
 #include <ncr/ncr_common.hpp>
+#include <ncr/ncr_utils.hpp>
 #include <ncr/ncr_memory.hpp>
+#include <ncr/ncr_parallel.hpp>
 
 
 namespace ncr {
@@ -100,6 +105,16 @@ struct envelope {
 using port_index = std::size_t;
 
 
+/*
+ * broadcast_sink - sink of an envelope that is shared by all sinks of a source
+ *
+ * Envelopes sent via broadcast_shared carry this value as id.sink. They are
+ * expanded to all sinks that are connected to id.source only at delivery, and
+ * all of the sinks receive the very same envelope.
+ */
+inline constexpr port_index broadcast_sink = ~port_index(0);
+
+
 /*
  * struct port - Connection point to handle payload of type T
  *
@@ -142,8 +157,7 @@ template <typename T>
 void
 port_clear_buffer(port<T> &p)
 {
-	for (size_t i = 0; i < p.buffer.size(); ++i)
-		free_envelope(p.transport, p.buffer[i]);
+	p.transport->__mem_envelopes.free(p.buffer.begin(), p.buffer.end());
 	p.buffer.clear();
 }
 
@@ -195,6 +209,84 @@ port_drain(port<T> &p)
 }
 
 
+/*
+ * port_drain - consume all pending messages on a port
+ *
+ * This calls fn with a const reference to the payload of each envelope in the
+ * buffer, in order of arrival, and afterwards releases all of the envelopes
+ * with a single bulk free on the envelope memory. Envelopes which arrive while
+ * draining, e.g. when fn sends to this port with immediate delivery, remain in
+ * the buffer for the next call. The payload must not be retained beyond the
+ * call to fn. Returns the number of consumed envelopes.
+ */
+template <typename T, typename Fn>
+	requires std::invocable<Fn&, const typename T::payload_type&>
+size_t
+port_drain(port<T> &p, Fn &&fn)
+{
+	auto &mem = p.transport->__mem_envelopes;
+
+	// buffer is a deque, and push_back invalidates its iterators but not its
+	// elements, so that index-based access remains valid
+	const size_t n = p.buffer.size();
+	for (size_t i = 0; i < n; ++i) {
+		const auto &env = mem[p.buffer[i]];
+		fn(env.payload);
+	}
+	mem.free(p.buffer.begin(), p.buffer.begin() + n);
+	p.buffer.erase(p.buffer.begin(), p.buffer.begin() + n);
+	return n;
+}
+
+
+/*
+ * port_drain - consume all pending messages on a port
+ */
+template <typename T, typename Fn>
+	requires std::invocable<Fn&, const typename T::payload_type&>
+size_t
+port_drain(port<T> *p, Fn &&fn)
+{
+	return port_drain(*p, std::forward<Fn>(fn));
+}
+
+
+/*
+ * struct __transport_csr - forward map in compressed sparse row format
+ *
+ * Once a network is built, its connectivity usually doesn't change anymore.
+ * transport_freeze compiles the forward map into this struct, in which all
+ * registered ports have a dense index, and the sinks of the source with dense
+ * index i are sinks[row_offsets[i] .. row_offsets[i+1]), sorted by port ID.
+ * Each edge has a delay and weight slot, which the transport itself does not
+ * interpret. They survive a re-freeze as long as the edge exists.
+ *
+ * Any change to ports or connections marks the CSR as stale, and the
+ * transport falls back to the hash maps until the next transport_freeze.
+ */
+template <typename Traits>
+	requires std::copyable<typename Traits::payload_type>
+	      && std::copyable<typename Traits::options_type>
+struct __transport_csr
+{
+	static constexpr size_t npos = ~size_t(0);
+
+	// true if the CSR reflects the current state of the transport
+	bool frozen = false;
+
+	// port ID -> dense index (or npos for unknown ports), and the reverse
+	std::vector<size_t>        dense_of;
+	std::vector<port_index>    port_ids;
+	std::vector<port<Traits>*> ports;
+
+	// connectivity, indexed by dense source index and edge index, respectively
+	std::vector<size_t>        row_offsets;
+	std::vector<size_t>        sinks;
+	std::vector<double>        delay;
+	std::vector<double>        weight;
+};
+
+
 /*
  * struct __transport_map_t - internally used map
  *
@@ -215,9 +307,320 @@ struct __transport_map
 
 	// reverse transport map, which links all sinks to their sources
 	std::unordered_map<size_t, std::unordered_set<size_t>> reverse;
+
+	// compiled form of the forward map, see transport_freeze
+	__transport_csr<Traits> csr;
+};
+
+
+
+
+/*
+ * concept transport_bucketed_traits - Traits with discrete delivery buckets
+ *
+ * If the Traits of a transport provide a static function delivery_bucket,
+ * which maps the options of an envelope to a discrete point in time (e.g. the
+ * tick of delivery), then the transport stores pending envelopes in a calendar
+ * queue instead of a sorted list. Inserting an envelope is then O(1), and
+ * process_messages drains whole buckets at once.
+ *
+ * The size of the calendar, i.e. how many buckets into the future can be
+ * addressed directly, can be set via an optional static constexpr
+ * calendar_size. Envelopes beyond that are kept in an overflow heap and moved
+ * into the calendar as soon as their bucket comes within reach.
+ *
+ * Example:
+ *
+ *     struct Traits {
+ *         using payload_type = some_payload;
+ *         using options_type = some_options;
+ *
+ *         static size_t delivery_bucket(const options_type &opts) {
+ *             return opts.delivery_time.value;
+ *         }
+ *     };
+ */
+template <typename Traits>
+concept transport_bucketed_traits = requires(const typename Traits::options_type &opts) {
+	{ Traits::delivery_bucket(opts) } -> std::convertible_to<size_t>;
+};
+
+
+template <typename Traits>
+struct __transport_calendar_size {
+	static constexpr size_t value = 1024;
+};
+
+template <typename Traits>
+	requires requires { { Traits::calendar_size } -> std::convertible_to<size_t>; }
+struct __transport_calendar_size<Traits> {
+	static constexpr size_t value = Traits::calendar_size > 0 ? Traits::calendar_size : 1;
+};
+
+
+/*
+ * struct __transport_calendar - calendar queue of pending envelopes
+ *
+ * The calendar is a ring of buckets, each of which holds the envelopes that
+ * are due in a certain bucket (e.g. tick) in insertion order. now is the
+ * earliest bucket which might still contain envelopes. The ring covers buckets
+ * [now, now + ring.size()), everything beyond lives in the overflow heap,
+ * which is ordered by (bucket, insertion sequence).
+ */
+struct __transport_calendar
+{
+	struct overflow_item {
+		size_t         bucket;
+		size_t         seq;
+		envelope_index env;
+
+		// std heaps are max-heaps, so invert the comparison
+		bool operator<(const overflow_item &other) const {
+			if (bucket != other.bucket)
+				return bucket > other.bucket;
+			return seq > other.seq;
+		}
+	};
+
+	std::vector<std::vector<envelope_index>> ring;
+	std::vector<overflow_item>               overflow;
+
+	size_t now      = 0;
+	size_t seq      = 0;
+
+	// number of envelopes in the ring, excluding the overflow
+	size_t in_ring  = 0;
 };
 
 
+/*
+ * __calendar_size - number of envelopes pending in a calendar
+ */
+inline size_t
+__calendar_size(const __transport_calendar &cal)
+{
+	return cal.in_ring + cal.overflow.size();
+}
+
+
+/*
+ * __calendar_insert - insert an envelope into the bucket it is due in
+ *
+ * Envelopes for buckets that are already in the past are put into the current
+ * bucket, and thus will be delivered on the next call to process_messages.
+ */
+inline void
+__calendar_insert(
+		__transport_calendar &cal,
+		size_t bucket,
+		const envelope_index env_id)
+{
+	assert(!cal.ring.empty());
+
+	bucket = std::max(bucket, cal.now);
+	if (bucket - cal.now < cal.ring.size()) {
+		cal.ring[bucket % cal.ring.size()].push_back(env_id);
+		cal.in_ring += 1;
+	}
+	else {
+		cal.overflow.push_back({bucket, cal.seq++, env_id});
+		std::push_heap(cal.overflow.begin(), cal.overflow.end());
+	}
+}
+
+
+/*
+ * __calendar_advance - move the calendar to a new current bucket
+ *
+ * This moves all the envelopes from the overflow, which are now within reach
+ * of the ring, into their buckets. Note that this must not skip over any
+ * non-empty bucket in the ring.
+ */
+inline void
+__calendar_advance(
+		__transport_calendar &cal,
+		const size_t bucket)
+{
+	cal.now = std::max(cal.now, bucket);
+	while (!cal.overflow.empty() && cal.overflow.front().bucket - cal.now < cal.ring.size()) {
+		std::pop_heap(cal.overflow.begin(), cal.overflow.end());
+		const auto &item = cal.overflow.back();
+		cal.ring[item.bucket % cal.ring.size()].push_back(item.env);
+		cal.in_ring += 1;
+		cal.overflow.pop_back();
+	}
+}
+
+
+/*
+ * __calendar_next_bucket - get the next non-empty bucket, starting from now
+ *
+ * Returns an empty optional if there are no pending envelopes. Otherwise, env
+ * is set to the first envelope that is due in the returned bucket.
+ */
+inline std::optional<size_t>
+__calendar_next_bucket(
+		const __transport_calendar &cal,
+		envelope_index &env)
+{
+	if (__calendar_size(cal) == 0)
+		return {};
+
+	// nothing within the ring, so the next bucket is in the overflow. Note
+	// that we must not advance the calendar here, because time might not yet
+	// have reached the bucket
+	if (cal.in_ring == 0) {
+		env = cal.overflow.front().env;
+		return cal.overflow.front().bucket;
+	}
+
+	size_t bucket = cal.now;
+	while (cal.ring[bucket % cal.ring.size()].empty())
+		++bucket;
+	env = cal.ring[bucket % cal.ring.size()].front();
+	return bucket;
+}
+
+
+/*
+ * concept transport_compare_traits - Traits with a static envelope comparison
+ *
+ * If the Traits provide a static function compare(left, right), which returns
+ * true if the envelope left shall be delivered before (or together with) the
+ * envelope right, then the transport uses it to sort envelopes instead of the
+ * std::function which is passed to the constructor. In contrast to the latter,
+ * Traits::compare can be inlined.
+ *
+ * For time-less transports, the Traits can simply derive from
+ * back_inserter_traits or front_inserter_traits, in which case new envelopes
+ * are directly put at the end or the front of the buffer.
+ *
+ * Example:
+ *
+ *     struct Traits {
+ *         using payload_type = some_payload;
+ *         using options_type = some_options;
+ *
+ *         static bool compare(const auto &left, const auto &right) {
+ *             return left.options.delivery_time <= right.options.delivery_time;
+ *         }
+ *     };
+ *
+ *     transport<Traits> transport;
+ */
+template <typename Traits>
+concept transport_compare_traits = requires(const envelope<Traits> &left, const envelope<Traits> &right) {
+	{ Traits::compare(left, right) } -> std::convertible_to<bool>;
+};
+
+
+/*
+ * struct back_inserter_traits - put new envelopes at the end of the buffer
+ */
+struct back_inserter_traits {
+	template <typename Envelope>
+	static constexpr bool compare(const Envelope &, const Envelope &) { return true; }
+};
+
+
+/*
+ * struct front_inserter_traits - put new envelopes at the front of the buffer
+ */
+struct front_inserter_traits {
+	template <typename Envelope>
+	static constexpr bool compare(const Envelope &, const Envelope &) { return false; }
+};
+
+
+/*
+ * concept transport_deliverable_traits - Traits with a static delivery test
+ *
+ * If the Traits provide a static function deliverable(envelope, context), then
+ * process_messages can be called with the context instead of a function that
+ * tests each envelope. The context is anything that the test requires, e.g.
+ * the current simulation time.
+ *
+ * Example:
+ *
+ *     struct Traits {
+ *         ...
+ *         static bool deliverable(const auto &env, const size_t &ticks) {
+ *             return env.options.delivery_time <= ticks;
+ *         }
+ *     };
+ *
+ *     process_messages(transport, ticks);
+ */
+template <typename Traits, typename Context>
+concept transport_deliverable_traits = requires(const envelope<Traits> &env, const Context &ctx) {
+	{ Traits::deliverable(env, ctx) } -> std::convertible_to<bool>;
+};
+
+
+/*
+ * concept transport_immediate_traits - Traits which deliver envelopes on send
+ *
+ * By default, send puts every envelope into the transport's buffer (or
+ * calendar), and only process_messages moves it to the sink. For synchronous
+ * or zero-delay messages, this detour is unnecessary. If the Traits provide
+ * a static function deliver_immediately(options), then send calls it for each
+ * new envelope, and puts the envelope straight into the sink's buffer if it
+ * returns true. Traits with a static constexpr bool immediate_delivery = true
+ * deliver all envelopes immediately, and never touch the transport's buffer.
+ * For time-less transports, the Traits can simply derive from
+ * immediate_delivery_traits.
+ *
+ * Note that immediately delivered envelopes overtake envelopes which are still
+ * pending in the transport's buffer.
+ *
+ * Example:
+ *
+ *     struct Traits {
+ *         using payload_type = some_payload;
+ *         using options_type = some_options;
+ *
+ *         static bool deliver_immediately(const options_type &opts) {
+ *             return opts.delay == 0;
+ *         }
+ *     };
+ */
+template <typename Traits>
+concept transport_immediate_traits = requires(const typename Traits::options_type &opts) {
+	{ Traits::deliver_immediately(opts) } -> std::convertible_to<bool>;
+};
+
+template <typename Traits>
+concept transport_always_immediate_traits = requires {
+	requires bool(Traits::immediate_delivery);
+};
+
+
+/*
+ * struct immediate_delivery_traits - deliver all envelopes already on send
+ */
+struct immediate_delivery_traits {
+	static constexpr bool immediate_delivery = true;
+};
+
+
+/*
+ * __deliver_immediately - test if an envelope bypasses the transport's buffer
+ */
+template <typename Traits>
+inline bool
+__deliver_immediately(const typename Traits::options_type &opts)
+{
+	if constexpr (transport_always_immediate_traits<Traits>) {
+		NCR_UNUSED(opts);
+		return true;
+	}
+	else if constexpr (transport_immediate_traits<Traits>)
+		return Traits::deliver_immediately(opts);
+	else {
+		NCR_UNUSED(opts);
+		return false;
+	}
+}
 
 
 /*
@@ -246,6 +649,10 @@ struct transport
 	// buffer to store message
 	buffer_type buffer;
 
+	// calendar queue to store messages, which is used instead of the buffer if
+	// the Traits satisfy transport_bucketed_traits
+	__transport_calendar calendar;
+
 	// internal variable which gets incremented everytime a port gets
 	// registered. Registering a port at the moment simply means giving it a
 	// unique ID, determined by this variable here.
@@ -294,18 +701,36 @@ struct transport
 		bool operator()(const envelope_type &, const envelope_type &) { return false; }
 	};
 
-	// TODO: maybe turn into callable struct, so that it can be accessed via
-	//       TransportType::accept_all ?
-	typedef std::function<bool(const typename transport<Traits>::envelope_type)> DeliveryAttempt;
-	const DeliveryAttempt accept_all = [](const envelope_type &){ return true; };
-	const DeliveryAttempt reject_all = [](const envelope_type &){ return false; };
+	// type-erased delivery test. Note that process_messages accepts any
+	// callable, which is preferable as it can be inlined
+	typedef std::function<bool(const envelope_type&)> DeliveryAttempt;
+
+	// delivery tests that accept or reject all envelopes
+	struct accept_all_fn {
+		bool operator()(const envelope_type &) const { return true; }
+	};
+	struct reject_all_fn {
+		bool operator()(const envelope_type &) const { return false; }
+	};
+	const accept_all_fn accept_all{};
+	const reject_all_fn reject_all{};
 
 	// comparison function for envelopes to make sure they are inserted
 	// internally in order of their delivery. This is something that must be
-	// specified externally and passed in the constructor.
+	// specified externally and passed in the constructor, unless the Traits
+	// satisfy transport_compare_traits, in which case it is not used.
 	CompareEnvelopes comp_envs;
 
-	transport(CompareEnvelopes comp) : comp_envs(comp) { assert(comp); }
+	transport(CompareEnvelopes comp) : comp_envs(comp)
+	{
+		assert(comp || transport_compare_traits<Traits>);
+		if constexpr (transport_bucketed_traits<Traits>)
+			this->calendar.ring.resize(__transport_calendar_size<Traits>::value);
+	}
+
+	transport() requires transport_compare_traits<Traits>
+	: transport(CompareEnvelopes{})
+	{ }
 };
 
 
@@ -386,6 +811,38 @@ transport_get_envelope(
 }
 
 
+/*
+ * transport_compact - compact the envelope memory of a transport
+ *
+ * After long runs, live envelopes might be spread thinly over many pages of
+ * the envelope memory. This moves them to the front of the memory, releases
+ * unused pages, and translates all envelope indexes that the transport and
+ * its registered ports hold. Envelope indexes or pointers which are held
+ * anywhere else, e.g. in ports that are not registered, become invalid.
+ */
+template <typename T>
+void
+transport_compact(transport<T> &transport)
+{
+	const auto remap = transport.__mem_envelopes.compact();
+	auto translate = [&remap](envelope_index &env_id) {
+		assert(env_id < remap.size() && remap[env_id]);
+		env_id = remap[env_id].value();
+	};
+
+	for (auto &env_id: transport.buffer)
+		translate(env_id);
+	for (auto &bucket: transport.calendar.ring)
+		for (auto &env_id: bucket)
+			translate(env_id);
+	for (auto &item: transport.calendar.overflow)
+		translate(item.env);
+	for (auto &[_, p]: transport.known_ports)
+		for (auto &env_id: p->buffer)
+			translate(env_id);
+}
+
+
 /*
  * connect - connect a source and sink using a given transport via port IDs
  */
@@ -396,6 +853,7 @@ void connect(
 		std::optional<port_index> sink_id)
 {
 	if (!source_id || !sink_id) return;
+	transport.map.csr.frozen = false;
 
 	// store in the forward map
 	transport.map.forward[source_id.value()].insert(sink_id.value());
@@ -462,6 +920,7 @@ void disconnect(
 		std::optional<port_index> sink_id)
 {
 	if (!source_id || !sink_id) return;
+	transport.map.csr.frozen = false;
 
 	// remove forward link from forward map
 	auto needle = transport.map.forward.find(source_id.value());
@@ -549,6 +1008,13 @@ template <typename T>
 port<T>*
 __get_port(transport<T> &transport, port_index id)
 {
+	const auto &csr = transport.map.csr;
+	if (csr.frozen) {
+		if (id < csr.dense_of.size() && csr.dense_of[id] != csr.npos)
+			return csr.ports[csr.dense_of[id]];
+		return nullptr;
+	}
+
 	auto needle = transport.known_ports.find(id);
 	if (needle != transport.known_ports.end())
 		return needle->second;
@@ -556,20 +1022,234 @@ __get_port(transport<T> &transport, port_index id)
 }
 
 
-// TODO: rename this function
+/*
+ * __csr_edge - find the edge from source_id to sink_id within a CSR
+ */
+template <typename T>
+std::optional<size_t>
+__csr_edge(
+		const __transport_csr<T> &csr,
+		port_index source_id,
+		port_index sink_id)
+{
+	if (source_id >= csr.dense_of.size() || sink_id >= csr.dense_of.size())
+		return {};
+
+	const size_t src = csr.dense_of[source_id];
+	const size_t snk = csr.dense_of[sink_id];
+	if (src == csr.npos || snk == csr.npos)
+		return {};
+
+	// sinks within a row are sorted
+	auto first = csr.sinks.begin() + csr.row_offsets[src];
+	auto last  = csr.sinks.begin() + csr.row_offsets[src + 1];
+	auto it    = std::lower_bound(first, last, snk);
+	if (it == last || *it != snk)
+		return {};
+	return static_cast<size_t>(it - csr.sinks.begin());
+}
+
+
+/*
+ * transport_edge - get the index of the edge from source_id to sink_id
+ *
+ * The index can be used to access the edge's slots in transport.map.csr, e.g.
+ * transport.map.csr.weight[edge]. Edges only have an index while the transport
+ * is frozen.
+ */
+template <typename T>
+std::optional<size_t>
+transport_edge(
+		const transport<T> &transport,
+		port_index source_id,
+		port_index sink_id)
+{
+	if (!transport.map.csr.frozen)
+		return {};
+	return __csr_edge(transport.map.csr, source_id, sink_id);
+}
+
+
+/*
+ * transport_freeze - compile the connectivity of a transport into CSR format
+ *
+ * After freezing, looking up ports during delivery and iterating the sinks of
+ * a source (e.g. in broadcast) no longer use any hash map. Connecting,
+ * disconnecting, or (un)registering ports is still possible, but the
+ * transport then uses the hash maps until transport_freeze is called again.
+ */
+template <typename T>
+void
+transport_freeze(transport<T> &transport)
+{
+	auto &csr = transport.map.csr;
+
+	// keep the previous CSR around to carry over the edge slots
+	__transport_csr<T> prev = std::move(csr);
+	csr = {};
+
+	// dense indices in order of port IDs
+	csr.port_ids.reserve(transport.known_ports.size());
+	for (const auto &[id, _]: transport.known_ports)
+		csr.port_ids.push_back(id);
+	std::sort(csr.port_ids.begin(), csr.port_ids.end());
+
+	csr.dense_of.assign(transport.last_port_id, csr.npos);
+	csr.ports.reserve(csr.port_ids.size());
+	for (size_t i = 0; i < csr.port_ids.size(); i++) {
+		csr.dense_of[csr.port_ids[i]] = i;
+		csr.ports.push_back(transport.known_ports[csr.port_ids[i]]);
+	}
+
+	// build rows. Connections to or from unregistered ports are dropped
+	csr.row_offsets.assign(csr.port_ids.size() + 1, 0);
+	for (size_t src = 0; src < csr.port_ids.size(); src++) {
+		auto needle = transport.map.forward.find(csr.port_ids[src]);
+		if (needle != transport.map.forward.end()) {
+			for (auto sink_id: needle->second)
+				if (sink_id < csr.dense_of.size() && csr.dense_of[sink_id] != csr.npos)
+					csr.sinks.push_back(csr.dense_of[sink_id]);
+			std::sort(csr.sinks.begin() + csr.row_offsets[src], csr.sinks.end());
+		}
+		csr.row_offsets[src + 1] = csr.sinks.size();
+	}
+
+	// edge slots, taken from the previous CSR if the edge existed before
+	csr.delay.assign(csr.sinks.size(), 0.0);
+	csr.weight.assign(csr.sinks.size(), 1.0);
+	if (!prev.row_offsets.empty()) {
+		for (size_t src = 0; src < csr.port_ids.size(); src++) {
+			for (size_t e = csr.row_offsets[src]; e < csr.row_offsets[src + 1]; e++) {
+				auto old = __csr_edge(prev, csr.port_ids[src], csr.port_ids[csr.sinks[e]]);
+				if (old) {
+					csr.delay[e]  = prev.delay[old.value()];
+					csr.weight[e] = prev.weight[old.value()];
+				}
+			}
+		}
+	}
+	csr.frozen = true;
+}
+
+
+/*
+ * __for_each_sink - call fn(sink_id, port*) for each registered sink of a source
+ */
+template <typename T, typename Fn>
+void
+__for_each_sink(transport<T> &transport, port_index source_id, Fn &&fn)
+{
+	const auto &csr = transport.map.csr;
+	if (csr.frozen) {
+		if (source_id >= csr.dense_of.size() || csr.dense_of[source_id] == csr.npos)
+			return;
+		const size_t src = csr.dense_of[source_id];
+		for (size_t e = csr.row_offsets[src]; e < csr.row_offsets[src + 1]; e++)
+			fn(csr.port_ids[csr.sinks[e]], csr.ports[csr.sinks[e]]);
+		return;
+	}
+
+	auto sinks = transport.map.forward.find(source_id);
+	if (sinks == transport.map.forward.end())
+		return;
+	for (auto sink_id: sinks->second) {
+		port<T> *sink = __get_port(transport, sink_id);
+		if (sink != nullptr)
+			fn(sink_id, sink);
+	}
+}
+
+
+/*
+ * __deliver_envelope - put an envelope into the buffer of its sink(s)
+ *
+ * A shared envelope (see broadcast_shared) is put into the buffers of all
+ * sinks which are connected to its source at the time of delivery. Each of
+ * them holds one reference to the envelope, and thus frees it as usual.
+ */
 template <typename T>
 void
+__deliver_envelope(
+		transport<T> &tr,
+		const envelope_index env_id,
+		const typename transport<T>::envelope_type &env)
+{
+	using port_type = typename transport<T>::port_type;
+
+	if (env.id.sink == broadcast_sink) {
+		size_t n_delivered = 0;
+		__for_each_sink(tr, env.id.source, [&](port_index, port_type *sink) {
+			// the first sink takes over the reference of the transport
+			if (n_delivered++ > 0)
+				tr.__mem_envelopes.incref(env_id);
+			sink->buffer.push_back(env_id);
+		});
+		if (n_delivered == 0)
+			free_envelope(tr, env_id);
+		return;
+	}
+
+	// try to find the port. The port, and thereby its pointer, might have gone
+	// away or become invalid in the meantime, so we try to locate it in the
+	// list of known ports
+	port_type *sink = __get_port(tr, env.id.sink);
+	if (sink != nullptr)
+		// in this case, the recipient must delete all envelopes
+		sink->buffer.push_back(env_id);
+	else
+		// delete memory allocated for the message
+		free_envelope(tr, env_id);
+}
+
+
+/*
+ * process_messages - deliver all envelopes for which attempt_delivery is true
+ *
+ * attempt_delivery can be any callable which accepts an envelope and returns
+ * a bool. Lambdas or function objects are preferable over a DeliveryAttempt
+ * std::function, as they can be inlined.
+ *
+ * TODO: rename this function
+ */
+template <typename T, typename DeliveryFn>
+	requires std::predicate<DeliveryFn&, const typename transport<T>::envelope_type&>
+void
 process_messages(transport<T> &tr,
-		typename transport<T>::DeliveryAttempt attempt_delivery)
+		DeliveryFn &&attempt_delivery)
 {
-	assert(attempt_delivery);
+	if constexpr (std::is_constructible_v<bool, DeliveryFn&>)
+		assert(static_cast<bool>(attempt_delivery));
 
 	using envelope_type = typename transport<T>::envelope_type;
-	using port_type     = typename transport<T>::port_type;
 
 	// select the proper function to use for time evaluation
 	// auto check_delivery_fn = transport.__check_delivery_fns[transport.time_mode];
 
+	// all envelopes within a bucket of the calendar are due at the same time,
+	// so it's enough to attempt delivery of the first one to deliver the entire
+	// bucket
+	if constexpr (transport_bucketed_traits<T>) {
+		auto &cal = tr.calendar;
+		envelope_index first;
+		std::optional<size_t> bucket;
+		while ((bucket = __calendar_next_bucket(cal, first))) {
+			if (!attempt_delivery(*tr.__mem_envelopes.get(first).value()))
+				break;
+
+			// the bucket is due, which means that we're at least at this point
+			// in time. Advancing also moves envelopes of this bucket from the
+			// overflow into the ring
+			__calendar_advance(cal, bucket.value());
+
+			auto &envs = cal.ring[bucket.value() % cal.ring.size()];
+			for (const envelope_index env_id : envs)
+				__deliver_envelope(tr, env_id, *tr.__mem_envelopes.get(env_id).value());
+			cal.in_ring -= envs.size();
+			envs.clear();
+		}
+		return;
+	}
+
 	// mailbuffer is sorted by timestamp, so we can actually break as soon as we
 	// reached a message which doesn't need delivery
 	for (auto it = tr.buffer.begin(); it != tr.buffer.end();) {
@@ -584,16 +1264,7 @@ process_messages(transport<T> &tr,
 		// for instance time of the simulation and options present in an
 		// envelope, which is why it is mapped to a function that is passed in.
 		if (attempt_delivery(*env)) {
-			// try to find the port. The port, and thereby its pointer, might
-			// have gone away or become invalid in the meantime, so we try to
-			// locate it in the list of known ports
-			port_type *sink = __get_port(tr, env->id.sink);
-			if (sink != nullptr)
-				// in this case, the recipient must delete all envelopes
-				sink->buffer.push_back(env_id);
-			else
-				// delete memory allocated for the message
-				free_envelope(tr, env_id);
+			__deliver_envelope(tr, env_id, *env);
 
 			// remove from list and go to the next item
 			it = tr.buffer.erase(it);
@@ -608,6 +1279,24 @@ process_messages(transport<T> &tr,
 }
 
 
+/*
+ * process_messages - deliver all envelopes for which Traits::deliverable is true
+ *
+ * See transport_deliverable_traits for details.
+ */
+template <typename T, typename Context>
+	requires transport_deliverable_traits<T, Context>
+	      && (!std::predicate<Context&, const typename transport<T>::envelope_type&>)
+void
+process_messages(transport<T> &tr,
+		const Context &ctx)
+{
+	process_messages(tr, [&ctx](const typename transport<T>::envelope_type &env) -> bool {
+		return T::deliverable(env, ctx);
+	});
+}
+
+
 template <typename T>
 void
 __mailbuffer_insert(
@@ -616,6 +1305,13 @@ __mailbuffer_insert(
 {
 	// TODO: find the right place to insert stuff, ideally temporally ordered
 
+	// calendar queues directly know where to put the envelope
+	if constexpr (transport_bucketed_traits<T>) {
+		auto new_envelope = transport_get_envelope(transport, new_env_id);
+		__calendar_insert(transport.calendar, T::delivery_bucket(new_envelope->options), new_env_id);
+		return;
+	}
+
 	// assume that new mails will be mostly appended to the list. still, they
 	// should be added at the correct location. Hence, we search from the back
 	// until we find the proper slot to insert the element based on the
@@ -623,11 +1319,27 @@ __mailbuffer_insert(
 	auto rbegin = transport.buffer.rbegin();
 	auto rend   = transport.buffer.rend();
 
+	// time-less transports don't need to search
+	if constexpr (std::derived_from<T, back_inserter_traits>) {
+		transport.buffer.push_back(new_env_id);
+		return;
+	}
+	if constexpr (std::derived_from<T, front_inserter_traits>) {
+		transport.buffer.push_front(new_env_id);
+		return;
+	}
+
 	auto new_envelope = transport_get_envelope(transport, new_env_id);
 	while (rbegin != rend) {
 		auto left = transport_get_envelope(transport, *rbegin);
-		if (transport.comp_envs(*left, *new_envelope))
-			break;
+		if constexpr (transport_compare_traits<T>) {
+			if (T::compare(*left, *new_envelope))
+				break;
+		}
+		else {
+			if (transport.comp_envs(*left, *new_envelope))
+				break;
+		}
 		++rbegin;
 	}
 
@@ -682,23 +1394,13 @@ send(
 	envelope->options = std::move(options);
 	envelope->payload = std::move(payload);
 
-	// in case the transport operates in TTM_NONE, directly put the message into
-	// the recipient's buffer. If not, then need to place it into the mail
-	// buffer for delivery at the appropriate time.
-	// TODO: if delivery is *right now*, then directly put into sink's buffer,
-	//       don't store locally
-	//if (can_deliver(env)) {
-	if (false) {
-	//if (transport.time_mode == TTM_NONE) {
-		if (sink)
-			sink->buffer.push_back(env_id);
-		else
-			free_envelope(transport, env_id);
-	}
-	else {
-		// insert into mailbuffer
-	    __mailbuffer_insert(transport, env_id);
-	}
+	// envelopes which are due right now go directly into the recipient's
+	// buffer (see transport_immediate_traits). All others are placed into the
+	// mail buffer for delivery at the appropriate time.
+	if (__deliver_immediately<T>(envelope->options))
+		sink->buffer.push_back(env_id);
+	else
+		__mailbuffer_insert(transport, env_id);
 }
 
 
@@ -715,12 +1417,9 @@ broadcast(
 {
 	if (!source_id) return;
 
-	auto sinks = transport.map.forward.find(source_id.value());
-	if (sinks == transport.map.forward.end())
-		return;
-
-	for (auto sink_id : sinks->second)
+	__for_each_sink(transport, source_id.value(), [&](port_index sink_id, port<T> *) {
 		send(transport, source_id, sink_id, payload, opts);
+	});
 }
 
 
@@ -765,6 +1464,92 @@ broadcast(
 }
 
 
+/*
+ * broadcast_shared - send one message that is shared by all connected sinks
+ *
+ * In contrast to broadcast, which allocates and fills one envelope per sink,
+ * broadcast_shared allocates only a single envelope. The sinks are determined
+ * during delivery from the transport's map, and every sink receives the same
+ * envelope (with id.sink set to broadcast_sink) and holds one reference to it.
+ * Clearing a port's buffer thus only frees the envelope once the last of the
+ * sinks released it.
+ *
+ * Note that sinks must treat the payload of a shared envelope as read-only,
+ * because modifications are visible to all other sinks.
+ */
+template <typename T>
+inline void
+broadcast_shared(
+		transport<T> &transport,
+		std::optional<port_index> source_id,
+		typename T::payload_type payload,
+		typename T::options_type opts)
+{
+	if (!source_id) return;
+
+	auto source = __get_port(transport, source_id.value());
+	if (source == nullptr)
+		return;
+
+	// nothing to do if there's no one listening
+	auto sinks = transport.map.forward.find(source_id.value());
+	if (sinks == transport.map.forward.end() || sinks->second.empty())
+		return;
+
+	envelope_index env_id = alloc_envelope(transport);
+	auto *envelope = transport.__mem_envelopes.get(env_id).value();
+
+	envelope->id.source = source_id.value();
+	envelope->id.sink   = broadcast_sink;
+	envelope->id.msg    = source->last_msg_id++;
+	envelope->options   = std::move(opts);
+	envelope->payload   = std::move(payload);
+
+	if (__deliver_immediately<T>(envelope->options))
+		__deliver_envelope(transport, env_id, *envelope);
+	else
+		__mailbuffer_insert(transport, env_id);
+}
+
+
+template <typename T>
+inline void
+broadcast_shared(
+		transport<T> *transport,
+		std::optional<port_index> source_id,
+		typename T::payload_type payload,
+		typename T::options_type opts)
+{
+	broadcast_shared<T>(*transport, source_id, std::move(payload), std::move(opts));
+}
+
+
+template <typename T>
+inline void
+broadcast_shared(
+		transport<T> &transport,
+		port<T> *source,
+		typename T::payload_type payload,
+		typename T::options_type opts)
+{
+	assert(source);
+	broadcast_shared<T>(transport, source->index, std::move(payload), std::move(opts));
+}
+
+
+template <typename T>
+inline void
+broadcast_shared(
+		transport<T> *transport,
+		port<T> *source,
+		typename T::payload_type payload,
+		typename T::options_type opts)
+{
+	assert(source);
+	broadcast_shared<T>(*transport, source->index, std::move(payload), std::move(opts));
+}
+
+
 
 /*
  * register_ports - make a port aware to a transport
@@ -787,6 +1572,7 @@ register_ports(
 
 	// store the ID in the transport's list of known ports
 	transport.known_ports[p->index.value()] = p;
+	transport.map.csr.frozen = false;
 }
 
 
@@ -807,6 +1593,7 @@ unregister_ports(
 
 	// remove from known ports
 	transport.known_ports.erase(p->index.value());
+	transport.map.csr.frozen = false;
 
 	// reset the transport pointer, and set index to an unknown state.
 	// TODO: could also use optional for the transport
@@ -869,4 +1656,323 @@ unregister_ports(
 }
 
 
+
+/*
+ * struct partitioned_transport - transport that is split into shards
+ *
+ * Each shard is a regular transport with its own ports, mail buffer and
+ * envelope memory, and is meant to be owned by one worker thread. Ports are
+ * registered with a shard (see partitioned_shard) and addressed globally via
+ * shard_port. Connections within a shard are stored in the shard itself,
+ * connections to other shards in the remote map of the source's shard.
+ *
+ * Messages to ports of other shards are not put into the target shard during
+ * send. Instead, they are put into an outbox that only the sending shard
+ * writes to, one for each pair of shards. process_messages then first moves
+ * all parcels of the outboxes addressed to a shard into the shard, and then
+ * delivers per shard, with one task per shard. Hence, there is no lock around
+ * send, as long as the following rules, similar to a BSP superstep, are
+ * obeyed:
+ *
+ *  - each shard is only accessed by one thread at a time, i.e. send,
+ *    broadcast, and port operations for a shard happen on one thread
+ *  - process_messages is not called concurrently with any send or broadcast,
+ *    e.g. it is called after a parallel tick was joined
+ *
+ * Note that envelopes which arrived from another shard contain the ID of the
+ * source port within its own shard in id.source.
+ *
+ * Example:
+ *
+ *     partitioned_transport<Traits> pt(4);
+ *     register_ports(partitioned_shard(pt, 0), &a);
+ *     register_ports(partitioned_shard(pt, 1), &b);
+ *     connect(pt, shard_port{0, a.index.value()}, shard_port{1, b.index.value()});
+ *
+ *     pool.run(4, [&](size_t shard, unsigned) { ... broadcast(pt, ...); });
+ *     process_messages(pt, &pool, ticks);
+ */
+struct shard_port
+{
+	size_t     shard;
+	port_index port;
+
+	bool operator==(const shard_port &) const = default;
+};
+
+
+template <typename Traits>
+	requires std::copyable<typename Traits::payload_type>
+	      && std::copyable<typename Traits::options_type>
+struct partitioned_transport
+{
+	typedef transport<Traits>                         transport_type;
+	typedef typename transport_type::envelope_type    envelope_type;
+	typedef typename transport_type::CompareEnvelopes CompareEnvelopes;
+
+	// a message on its way to another shard
+	struct parcel {
+		port_index                    source;
+		port_index                    sink;
+		size_t                        msg;
+		typename Traits::options_type options;
+		typename Traits::payload_type payload;
+	};
+
+	// the shards. Ports store a pointer to their transport, which is why the
+	// shards are not stored by value
+	std::vector<std::unique_ptr<transport_type>> shards;
+
+	// per shard, map from a source to all its sinks on other shards
+	std::vector<std::unordered_map<port_index, std::vector<shard_port>>> remote;
+
+	// outboxes, where outbox[from * shards.size() + to] contains everything
+	// that was sent from shard 'from' to shard 'to'. The outboxes of a sending
+	// shard are thus adjacent in memory
+	std::vector<std::vector<parcel>> outbox;
+
+	partitioned_transport(size_t n_shards, CompareEnvelopes comp)
+	: remote(n_shards), outbox(n_shards * n_shards)
+	{
+		assert(n_shards > 0);
+		for (size_t i = 0; i < n_shards; i++)
+			this->shards.push_back(std::make_unique<transport_type>(comp));
+	}
+
+	partitioned_transport(size_t n_shards) requires transport_compare_traits<Traits>
+	: partitioned_transport(n_shards, CompareEnvelopes{})
+	{ }
+};
+
+
+/*
+ * partitioned_shard - get the transport of a shard
+ */
+template <typename T>
+inline transport<T>&
+partitioned_shard(partitioned_transport<T> &pt, size_t shard)
+{
+	assert(shard < pt.shards.size());
+	return *pt.shards[shard];
+}
+
+
+/*
+ * partitioned_shard_count - get the number of shards of a transport
+ */
+template <typename T>
+inline size_t
+partitioned_shard_count(const partitioned_transport<T> &pt)
+{
+	return pt.shards.size();
+}
+
+
+/*
+ * connect - connect a source and a sink of a partitioned transport
+ */
+template <typename T>
+void
+connect(
+		partitioned_transport<T> &pt,
+		shard_port source,
+		shard_port sink)
+{
+	if (source.shard == sink.shard) {
+		connect(partitioned_shard(pt, source.shard), source.port, sink.port);
+		return;
+	}
+
+	auto &sinks = pt.remote[source.shard][source.port];
+	if (std::find(sinks.begin(), sinks.end(), sink) == sinks.end())
+		sinks.push_back(sink);
+}
+
+
+/*
+ * disconnect - disconnect a source and a sink of a partitioned transport
+ */
+template <typename T>
+void
+disconnect(
+		partitioned_transport<T> &pt,
+		shard_port source,
+		shard_port sink)
+{
+	if (source.shard == sink.shard) {
+		disconnect(partitioned_shard(pt, source.shard), source.port, sink.port);
+		return;
+	}
+
+	auto needle = pt.remote[source.shard].find(source.port);
+	if (needle == pt.remote[source.shard].end())
+		return;
+	auto &sinks = needle->second;
+	sinks.erase(std::remove(sinks.begin(), sinks.end(), sink), sinks.end());
+}
+
+
+/*
+ * __partitioned_post - put a message to another shard into the outbox
+ */
+template <typename T>
+void
+__partitioned_post(
+		partitioned_transport<T> &pt,
+		port<T> &source,
+		shard_port source_addr,
+		shard_port sink,
+		typename T::payload_type payload,
+		typename T::options_type options)
+{
+	auto &box = pt.outbox[source_addr.shard * pt.shards.size() + sink.shard];
+	box.push_back({
+		.source  = source_addr.port,
+		.sink    = sink.port,
+		.msg     = source.last_msg_id++,
+		.options = std::move(options),
+		.payload = std::move(payload)});
+}
+
+
+/*
+ * send - send a message from source to sink of a partitioned transport
+ *
+ * This must be called from the thread which currently owns the source's shard.
+ */
+template <typename T>
+void
+send(
+		partitioned_transport<T> &pt,
+		shard_port source,
+		shard_port sink,
+		typename T::payload_type payload,
+		typename T::options_type options)
+{
+	if (source.shard == sink.shard) {
+		send(partitioned_shard(pt, source.shard), source.port, sink.port, std::move(payload), std::move(options));
+		return;
+	}
+
+	auto *src = __get_port(partitioned_shard(pt, source.shard), source.port);
+	if (src == nullptr)
+		return;
+	__partitioned_post(pt, *src, source, sink, std::move(payload), std::move(options));
+}
+
+
+/*
+ * broadcast - send a message to all sinks of a source, on all shards
+ *
+ * This must be called from the thread which currently owns the source's shard.
+ */
+template <typename T>
+void
+broadcast(
+		partitioned_transport<T> &pt,
+		shard_port source,
+		typename T::payload_type payload,
+		typename T::options_type opts)
+{
+	auto &tr = partitioned_shard(pt, source.shard);
+	broadcast(tr, source.port, payload, opts);
+
+	auto needle = pt.remote[source.shard].find(source.port);
+	if (needle == pt.remote[source.shard].end())
+		return;
+	auto *src = __get_port(tr, source.port);
+	if (src == nullptr)
+		return;
+	for (const auto &sink: needle->second)
+		__partitioned_post(pt, *src, source, sink, payload, opts);
+}
+
+
+/*
+ * partitioned_exchange - move all parcels addressed to a shard into the shard
+ *
+ * This only touches the outboxes to the given shard, and the shard itself.
+ * Thus, it can run concurrently for different shards.
+ */
+template <typename T>
+void
+partitioned_exchange(partitioned_transport<T> &pt, size_t shard)
+{
+	auto &tr = partitioned_shard(pt, shard);
+	const size_t n = pt.shards.size();
+
+	for (size_t from = 0; from < n; from++) {
+		auto &box = pt.outbox[from * n + shard];
+		for (auto &p: box) {
+			// drop messages to ports which are gone
+			if (__get_port(tr, p.sink) == nullptr)
+				continue;
+
+			envelope_index env_id = alloc_envelope(tr);
+			auto *envelope = tr.__mem_envelopes.get(env_id).value();
+			envelope->id.source = p.source;
+			envelope->id.sink   = p.sink;
+			envelope->id.msg    = p.msg;
+			envelope->options   = std::move(p.options);
+			envelope->payload   = std::move(p.payload);
+			if (__deliver_immediately<T>(envelope->options))
+				__deliver_envelope(tr, env_id, *envelope);
+			else
+				__mailbuffer_insert(tr, env_id);
+		}
+		box.clear();
+	}
+}
+
+
+/*
+ * process_messages - exchange and deliver messages of all shards
+ *
+ * Each shard is handled by one task on the thread pool, which first gathers
+ * the shard's parcels from all outboxes and then processes the messages of
+ * the shard. If pool is nullptr, the shards are processed on the calling
+ * thread. Note that attempt_delivery is called concurrently from several
+ * threads.
+ */
+template <typename T, typename DeliveryFn>
+	requires std::predicate<DeliveryFn&, const typename transport<T>::envelope_type&>
+void
+process_messages(
+		partitioned_transport<T> &pt,
+		thread_pool *pool,
+		DeliveryFn &&attempt_delivery)
+{
+	auto task = [&](size_t shard, unsigned) {
+		partitioned_exchange(pt, shard);
+		process_messages(partitioned_shard(pt, shard), attempt_delivery);
+	};
+
+	if (pool)
+		pool->run(pt.shards.size(), task);
+	else
+		for (size_t shard = 0; shard < pt.shards.size(); shard++)
+			task(shard, 0);
+}
+
+
+/*
+ * process_messages - exchange and deliver messages given a delivery context
+ *
+ * See transport_deliverable_traits for details.
+ */
+template <typename T, typename Context>
+	requires transport_deliverable_traits<T, Context>
+	      && (!std::predicate<Context&, const typename transport<T>::envelope_type&>)
+void
+process_messages(
+		partitioned_transport<T> &pt,
+		thread_pool *pool,
+		const Context &ctx)
+{
+	process_messages(pt, pool, [&ctx](const typename transport<T>::envelope_type &env) -> bool {
+		return T::deliverable(env, ctx);
+	});
+}
+
+
 } // ncr::
@@ -143,6 +143,21 @@ constexpr std::size_t len(T(&)[N]) { return N; }
 #define NCR_UNUSED(...)               NCR_UNUSED_INDIRECT2(NCR_COUNT_ARGS(__VA_ARGS__), __VA_ARGS__)
 
 
+/*
+ * Tell the compiler that the iterations of the next loop do not depend on each
+ * other, i.e. that the arrays accessed within the loop do not alias. This
+ * avoids runtime alias checks, which compilers give up on if there are too
+ * many arrays, and thus enables vectorization of larger loops.
+ */
+#if defined(__clang__)
+	#define NCR_IVDEP _Pragma("clang loop vectorize(assume_safety)")
+#elif defined(__GNUC__)
+	#define NCR_IVDEP _Pragma("GCC ivdep")
+#else
+	#define NCR_IVDEP
+#endif
+
+
 /*
  * The following two tables define converters from string to other types. The
  * first table contains the types for which a 'standard implementation' for the
@@ -14,9 +14,15 @@
 #include <cstddef>
 #include <cassert>
 #include <algorithm>
+#include <array>
+#include <cmath>
+#include <concepts>
+#include <type_traits>
 
 #include <initializer_list>
 #include <iostream>
+#include <memory>
+#include <new>
 
 #ifndef NCR_USE_BLAS
 #	define NCR_USE_BLAS false
@@ -24,6 +30,11 @@
 #ifndef NCR_VECTOR_MOVE_SEMANTICS
 #	define NCR_VECTOR_MOVE_SEMANTICS true
 #endif
+// vectors up to this size which own their memory store their elements inline
+// instead of on the heap
+#ifndef NCR_VECTOR_INLINE_STORAGE_MAX
+#	define NCR_VECTOR_INLINE_STORAGE_MAX 32
+#endif
 
 // additional includes might be required when compiling with BLAS support
 #if NCR_USE_BLAS
@@ -33,9 +44,28 @@
 namespace ncr {
 
 
+// vector_t or an expression node of the expression templates further below, which
+// provide the value type and the dimension of the vector
+template <typename E>
+concept vector_operand = requires {
+	typename E::value_type;
+	{ E::N } -> std::convertible_to<size_t>;
+	requires E::__vector_operand;
+};
+
+// expression nodes only, i.e. operands that are not a vector_t
+template <typename E>
+concept vector_expression = vector_operand<E> && E::__vector_expression;
+
+
 // custom vector class which can attach to a memory location
 // NOTE: keep the _t suffix to make it more easily distinguishable from
 // std::vector or other vector classes, i.e. from Eigen.
+//
+// Vectors which are not attached to external memory own their storage. For
+// N <= NCR_VECTOR_INLINE_STORAGE_MAX, the storage is part of the vector
+// itself, such that temporaries (e.g. in ODE solver steps) live on the stack
+// and don't require any heap allocation. Larger vectors allocate on the heap.
 template <size_t _N, typename T = double>
 struct vector_t
 {
@@ -50,9 +80,37 @@ struct vector_t
 
 	constexpr static size_t N = _N;
 
+	constexpr static bool inline_storage = _N <= NCR_VECTOR_INLINE_STORAGE_MAX;
+
+	constexpr static bool __vector_operand    = true;
+	constexpr static bool __vector_expression = false;
+
 	typedef
 		vector_t<_N, T> vector_type;
 
+	typedef
+		T value_type;
+
+	// inline storage of owning vectors with inline_storage. The storage is
+	// the member of an anonymous union, and only becomes alive in __alloc.
+	// Vectors which are attached to external memory thus never construct or
+	// initialize it
+	union {
+		std::array<T, inline_storage ? _N : 0>
+			__storage;
+	};
+
+	// get memory for an owning vector
+	T*
+	__alloc() {
+		if constexpr (inline_storage) {
+			::new (static_cast<void*>(&this->__storage)) std::array<T, _N>;
+			return this->__storage.data();
+		}
+		else
+			return new T[_N];
+	}
+
 
 	// constructor that only hooks into existing memory and doesn't allocate
 	// itself. Note: This constructor doesn't default initialize.
@@ -67,7 +125,7 @@ struct vector_t
 	: stride(1)
 	, __allocating(true)
 	{
-		this->base_ptr = new T[_N];
+		this->base_ptr = this->__alloc();
 		(*this) = (T)0;
 	}
 
@@ -78,7 +136,7 @@ struct vector_t
 	, __allocating(true)
 	{
 		assert(list.size() == _N);
-		this->base_ptr = new T[_N];
+		this->base_ptr = this->__alloc();
 		(*this) = list;
 	}
 
@@ -92,12 +150,26 @@ struct vector_t
 		(*this) = list;
 	}
 
+	// constructor that allocates memory and evaluates an expression into it,
+	// e.g. when an expression is passed as a const vector_t reference
+	template <vector_expression E>
+	vector_t(const E &e)
+	: stride(1)
+	, __allocating(true)
+	{
+		static_assert(E::N == _N, "vector dimensions must match");
+		this->base_ptr = this->__alloc();
+		(*this) = e;
+	}
+
 	// destructor
 	~vector_t() {
-		// FIXME: can get rid of the != nullptr test
-		if (this->__allocating) {
+		if (!this->__allocating)
+			return;
+		if constexpr (inline_storage)
+			std::destroy_at(&this->__storage);
+		else
 			delete[] this->base_ptr;
-		}
 	}
 
 	// remove copy contructor
@@ -111,7 +183,7 @@ struct vector_t
 			return;
 
 		// allocate memory
-		this->base_ptr = new T[_N];
+		this->base_ptr = this->__alloc();
 
 		// copy over stuff
 	#if NCR_USE_BLAS
@@ -129,6 +201,16 @@ struct vector_t
 	, stride(v.stride)
 	, __allocating(v.__allocating)
 	{
+		// inline storage cannot be taken over, and needs to be copied. Note
+		// that the stride of an owning vector is always 1
+		if constexpr (inline_storage) {
+			if (v.__allocating) {
+				::new (static_cast<void*>(&this->__storage)) std::array<T, _N>(v.__storage);
+				this->base_ptr = this->__storage.data();
+				return;
+			}
+		}
+
 		// prevent double-free corruption by setting the base_ptr of the
 		// "incomming" vector to nullptr
 		v.base_ptr = nullptr;
@@ -166,6 +248,18 @@ struct vector_t
 		return *this;
 	}
 
+	// assignment operator for an expression, which evaluates all elements in
+	// a single loop
+	template <vector_expression E>
+	vector_type&
+	operator=(const E &e)
+	{
+		static_assert(E::N == _N, "vector dimensions must match");
+		for (size_t i = 0; i < N; i++)
+			(*this)[i] = e[i];
+		return *this;
+	}
+
 	// assignment operator from an initializer list
 	// Note: there is no straightforward way to do this via blas, if a user
 	// intends to use the blas backend
@@ -188,14 +282,11 @@ struct vector_t
 		if (&right == this)
 			return *this;
 
-		// in case we work with allocating vectors, then we can simply grab the
-		// pointer as memory management is handled within. If not, we need to
-		// copy
-		if (this->__allocating && right.__allocating) {
-			// grab pointer and set incoming one to null to prevent double free
-			// corruptions
-			this->base_ptr = right.base_ptr;
-			right.base_ptr = nullptr;
+		// in case we work with heap allocating vectors, then we can simply
+		// swap the pointers as memory management is handled within. If not,
+		// we need to copy
+		if (!inline_storage && this->__allocating && right.__allocating) {
+			std::swap(this->base_ptr, right.base_ptr);
 		}
 		else {
 		#if NCR_USE_BLAS
@@ -315,7 +406,7 @@ struct vector_t
 
 
 	T
-	asum() {
+	asum() const {
 	#if NCR_USE_BLAS
 		return cblas_dasum(N, this->base_ptr, this->stride);
 	#else
@@ -329,255 +420,207 @@ struct vector_t
 
 
 /*
- * Scalar Operators, i.e.
- *		alpha OP vector
- * or
- *		vector OP alpha
+ * Expression templates
+ *
+ * The free operators below do not compute their result immediately. Instead,
+ * they return lightweight expression nodes which reference their vector
+ * operands and store scalars and sub-expressions by value. The expression is
+ * evaluated element by element in a single loop only when it is assigned to
+ * (or used to construct) a vector_t, or when it is reduced, for instance via
+ * asum() or error_norm(). Hence, something like
+ *
+ *		y = y_in + (3./40.) * k1 + (9./40.) * k2;
+ *
+ * does not create any intermediate vector. Elements are combined in the same
+ * order as the written expression, which means that results are identical to
+ * evaluating the expression step by step.
+ *
+ * Note that expression nodes hold references to the vectors they were built
+ * from. Do not store them (e.g. via auto) beyond the lifetime of their
+ * operands. Also note that assignment is element-wise, so a vector may appear
+ * on both sides of an assignment, but must not overlap with a vector view of
+ * different offset or stride that is used in the same expression.
  */
 
-// operator+
-template <size_t _N, typename T = double>
-vector_t<_N, T>
-operator+ (T v, const vector_t<_N, T> &vec)
-{
-	vector_t<_N, T> result;
-	result = vec;
-	result += v;
-	return result;
-}
+// vectors are referenced, everything else is copied into the expression
+template <typename E>
+using __vexpr_operand_t = std::conditional_t<E::__vector_expression, const E, const E&>;
 
-template <size_t _N, typename T = double>
-vector_t<_N, T>
-operator+ (const vector_t<_N, T> &vec, T v)
-{
-	vector_t<_N, T> result;
-	result = vec;
-	result += v;
-	return result;
-}
 
-#if NCR_VECTOR_MOVE_SEMANTICS
-template <size_t _N, typename T = double>
-vector_t<_N, T>&&
-operator+ (T v, vector_t<_N, T> &&vec)
+// scalar that is broadcast to all elements of an expression
+template <size_t _N, typename T>
+struct __vexpr_scalar
 {
-	vec += v;
-	return std::move(vec);
-}
+	typedef T value_type;
+	constexpr static size_t N = _N;
+	constexpr static bool __vector_operand    = true;
+	constexpr static bool __vector_expression = true;
 
-template <size_t _N, typename T = double>
-vector_t<_N, T>&&
-operator+ (vector_t<_N, T> &&vec, T v)
-{
-	vec += v;
-	return std::move(vec);
-}
-#endif
+	const T v;
 
+	T operator[](const size_t) const { return v; }
+};
 
-// operator*
-template <size_t _N, typename T = double>
-vector_t<_N, T>
-operator* (T v, const vector_t<_N, T> &vec)
-{
-	vector_t<_N, T> result;
-	result = vec;
-	result *= v;
-	return result;
-}
 
-template <size_t _N, typename T = double>
-vector_t<_N, T>
-operator* (const vector_t<_N, T> &vec, T v)
-{
-	vector_t<_N, T> result;
-	result = vec;
-	result *= v;
-	return result;
-}
+// element-wise operations that can appear in an expression
+struct __vexpr_add { template <typename T> static T apply(const T a, const T b) { return a + b; } };
+struct __vexpr_sub { template <typename T> static T apply(const T a, const T b) { return a - b; } };
+struct __vexpr_mul { template <typename T> static T apply(const T a, const T b) { return a * b; } };
+struct __vexpr_div { template <typename T> static T apply(const T a, const T b) { return a / b; } };
 
-#if NCR_VECTOR_MOVE_SEMANTICS
-template <size_t _N, typename T = double>
-vector_t<_N, T>&&
-operator* (T v, vector_t<_N, T> &&vec)
-{
-	vec *= v;
-	return std::move(vec);
-}
 
-template <size_t _N, typename T = double>
-vector_t<_N, T>&&
-operator* (vector_t<_N, T> &&vec, T v)
+// binary node of an expression
+template <typename Op, vector_operand L, vector_operand R>
+struct __vexpr_binary
 {
-	vec *= v;
-	return std::move(vec);
-}
-#endif
+	static_assert(L::N == R::N, "vector dimensions must match");
+	static_assert(std::is_same_v<typename L::value_type, typename R::value_type>, "vector types must match");
 
+	typedef typename L::value_type value_type;
+	constexpr static size_t N = L::N;
+	constexpr static bool __vector_operand    = true;
+	constexpr static bool __vector_expression = true;
 
+	__vexpr_operand_t<L> l;
+	__vexpr_operand_t<R> r;
 
-// operator/
-template <size_t _N, typename T = double>
-vector_t<_N, T>
-operator/ (T v, const vector_t<_N, T> &vec)
-{
-	vector_t<_N, T> result;
-	result = v;
-	result /= vec;
-	return result;
-}
+	value_type
+	operator[](const size_t idx) const {
+		return Op::apply(l[idx], r[idx]);
+	}
 
-template <size_t _N, typename T = double>
-vector_t<_N, T>
-operator/ (const vector_t<_N, T> &vec, T v)
-{
-	vector_t<_N, T> result;
-	result = vec;
-	result /= v;
-	return result;
-}
+	value_type
+	asum() const {
+		value_type result = (value_type)0;
+		for (size_t i = 0; i < N; i++)
+			result += std::abs((*this)[i]);
+		return result;
+	}
+};
 
-#if NCR_VECTOR_MOVE_SEMANTICS
-template <size_t _N, typename T = double>
-vector_t<_N, T>&&
-operator/ (vector_t<_N, T> &&vec, T v)
-{
-	vec /= v;
-	return std::move(vec);
-}
 
-template <size_t _N, typename T = double>
-vector_t<_N, T>&&
-operator/ (T v, vector_t<_N, T> &&vec)
+// helper to reduce the verbosity of the operators below
+template <typename Op, vector_operand L, vector_operand R>
+__vexpr_binary<Op, L, R>
+__vexpr_make(const L &l, const R &r)
 {
-	vec *= 1./v;
-	return std::move(vec);
+	return {l, r};
 }
-#endif
 
-
-// operator-
-template <size_t _N, typename T = double>
-vector_t<_N, T>
-operator- (T v, const vector_t<_N, T> &vec)
+template <vector_operand E>
+__vexpr_scalar<E::N, typename E::value_type>
+__vexpr_broadcast(const typename E::value_type v)
 {
-	vector_t<_N, T> result;
-	result = v;
-	result -= vec;
-	return result;
+	return {v};
 }
 
-template <size_t _N, typename T = double>
-vector_t<_N, T>
-operator- (const vector_t<_N, T> &vec, T v)
-{
-	vector_t<_N, T> result;
-	result = vec;
-	result -= v;
-	return result;
-}
 
-#if NCR_VECTOR_MOVE_SEMANTICS
-template <size_t _N, typename T = double>
-vector_t<_N, T>&&
-operator- (vector_t<_N, T> &&vec, T v)
+/*
+ * Vector Vector ops, i.e. v0 OP v1
+ */
+template <vector_operand L, vector_operand R>
+auto
+operator+ (const L &l, const R &r)
 {
-	vec -= v;
-	return std::move(vec);
+	return __vexpr_make<__vexpr_add>(l, r);
 }
 
-template <size_t _N, typename T = double>
-vector_t<_N, T>&&
-operator- (T v, vector_t<_N, T> &&vec)
+template <vector_operand L, vector_operand R>
+auto
+operator- (const L &l, const R &r)
 {
-	// FIXME: maybe not the fastest
-	vec *= -1.0;
-	vec += v;
-	return std::move(vec);
+	return __vexpr_make<__vexpr_sub>(l, r);
 }
-#endif
 
 
 /*
- * Vector Vector ops, i.e. v0 OP v1
+ * Scalar Operators, i.e.
+ *		alpha OP vector
+ * or
+ *		vector OP alpha
  */
+template <vector_operand E>
+auto
+operator+ (const typename E::value_type v, const E &e)
+{
+	return __vexpr_make<__vexpr_add>(__vexpr_broadcast<E>(v), e);
+}
 
-// operator+
-template <size_t N, typename T = double>
-vector_t<N, T>
-operator+ (const vector_t<N, T> &v0, const vector_t<N, T> &v1)
+template <vector_operand E>
+auto
+operator+ (const E &e, const typename E::value_type v)
 {
-	vector_t<N, T> result;
-	result  = v0;
-	result += v1;
-	return result;
+	return __vexpr_make<__vexpr_add>(e, __vexpr_broadcast<E>(v));
 }
 
-#if NCR_VECTOR_MOVE_SEMANTICS
-template <size_t N, typename T = double>
-vector_t<N, T>&&
-operator+ (vector_t<N, T> &&v0, const vector_t<N, T> &v1)
+template <vector_operand E>
+auto
+operator- (const typename E::value_type v, const E &e)
 {
-	v0 += v1;
-	return std::move(v0);
+	return __vexpr_make<__vexpr_sub>(__vexpr_broadcast<E>(v), e);
 }
 
-template <size_t N, typename T = double>
-vector_t<N, T>&&
-operator+ (const vector_t<N, T> &v0, vector_t<N, T> &&v1)
+template <vector_operand E>
+auto
+operator- (const E &e, const typename E::value_type v)
 {
-	v1 += v0;
-	return std::move(v1);
+	return __vexpr_make<__vexpr_sub>(e, __vexpr_broadcast<E>(v));
 }
 
-template <size_t N, typename T = double>
-vector_t<N, T>&&
-operator+ (vector_t<N, T> &&v0, vector_t<N, T> &&v1)
+template <vector_operand E>
+auto
+operator* (const typename E::value_type v, const E &e)
 {
-	v0 += v1;
-	return std::move(v0);
+	return __vexpr_make<__vexpr_mul>(__vexpr_broadcast<E>(v), e);
 }
-#endif
 
+template <vector_operand E>
+auto
+operator* (const E &e, const typename E::value_type v)
+{
+	return __vexpr_make<__vexpr_mul>(e, __vexpr_broadcast<E>(v));
+}
 
-// operator-
-template <size_t N, typename T = double>
-vector_t<N, T>
-operator- (const vector_t<N, T> &v0, const vector_t<N, T> &v1)
+template <vector_operand E>
+auto
+operator/ (const typename E::value_type v, const E &e)
 {
-	vector_t<N, T> result;
-	result  = v0;
-	result -= v1;
-	return result;
+	return __vexpr_make<__vexpr_div>(__vexpr_broadcast<E>(v), e);
 }
 
-#if NCR_VECTOR_MOVE_SEMANTICS
-template <size_t N, typename T = double>
-vector_t<N, T>&&
-operator- (vector_t<N, T> &&v0, const vector_t<N, T> &v1)
+template <vector_operand E>
+auto
+operator/ (const E &e, const typename E::value_type v)
 {
-	v0 -= v1;
-	return std::move(v0);
+	assert(v != 0.0);
+	return __vexpr_make<__vexpr_mul>(e, __vexpr_broadcast<E>(1.0 / v));
 }
 
-template <size_t N, typename T = double>
-vector_t<N, T>&&
-operator- (const vector_t<N, T> &v0, vector_t<N, T> &&v1)
+
+/*
+ * asum - sum of absolute values of a vector or an expression
+ */
+template <vector_operand E>
+typename E::value_type
+asum(const E &e)
 {
-	// FIXME: maybe not the fastest
-	v1 *= -1.0;
-	v1 += v0;
-	return std::move(v1);
+	return e.asum();
 }
 
-template <size_t N, typename T = double>
-vector_t<N, T>&&
-operator- (vector_t<N, T> &&v0, vector_t<N, T> &&v1)
+
+/*
+ * error_norm - sum of absolute differences between a and b
+ *
+ * This is the same as (a - b).asum(), i.e. the L1 norm of the difference, and
+ * is used as error estimate in the adaptive ODE solvers. It is computed in one
+ * pass without storing the difference.
+ */
+template <vector_operand L, vector_operand R>
+typename L::value_type
+error_norm(const L &a, const R &b)
 {
-	v0 -= v1;
-	return std::move(v0);
+	return (a - b).asum();
 }
-#endif
 
 
 // additional operators
@@ -595,5 +638,19 @@ operator<<(std::ostream &os, const vector_t<N, T> &v)
 	return os;
 }
 
+template <vector_expression E>
+std::ostream&
+operator<<(std::ostream &os, const E &e)
+{
+	os << "[";
+	if (E::N > 0)
+		os << e[0];
+	for (size_t i = 1; i < E::N; i++) {
+		os << ", " << e[i];
+	}
+	os << "]";
+	return os;
+}
+
 
 } // ncr::
@@ -0,0 +1,13 @@
+#!/usr/bin/env python
+
+import numpy as np
+import matplotlib.pyplot as plt
+
+data = np.array([[0, -65], [0.1, -64.992], [0.2, -64.984], [0.3, -64.9762], [0.4, -64.9683], [0.5, -64.9606], [0.6, -64.9529], [0.7, -64.9453], [0.8, -64.9377], [0.9, -64.9302], [1, -64.9228], [1.1, -64.9154], [1.2, -64.9081], [1.3, -64.9008], [1.4, -64.8936], [1.5, -64.8865], [1.6, -64.8795], [1.7, -64.8725], [1.8, -64.8656], [1.9, -64.8587], [2, -64.8519], [2.1, -64.8452], [2.2, -64.8385], [2.3, -64.8319], [2.4, -64.8254], [2.5, -64.8189], [2.6, -64.8125], [2.7, -64.8061], [2.8, -64.7999], [2.9, -64.7936], [3, -64.7875], [3.1, -64.7814], [3.2, -64.7754], [3.3, -64.7694], [3.4, -64.7635], [3.5, -64.7577], [3.6, -64.752], [3.7, -64.7463], [3.8, -64.7406], [3.9, -64.735], [4, -64.7295], [4.1, -64.7241], [4.2, -64.7187], [4.3, -64.7134], [4.4, -64.7081], [4.5, -64.7029], [4.6, -64.6978], [4.7, -64.6927], [4.8, -64.6877], [4.9, -64.6828], [5, -64.6779], [5.1, -64.673], [5.2, -64.6683], [5.3, -64.6636], [5.4, -64.6589], [5.5, -64.6543], [5.6, -64.6498], [5.7, -64.6454], [5.8, -64.641], [5.9, -64.6366], [6, -64.6323], [6.1, -64.6281], [6.2, -64.6239], [6.3, -64.6198], [6.4, -64.6157], [6.5, -64.6117], [6.6, -64.6078], [6.7, -64.6039], [6.8, -64.6001], [6.9, -64.5963], [7, -64.5926], [7.1, -64.5889], [7.2, -64.5853], [7.3, -64.5818], [7.4, -64.5783], [7.5, -64.5748], [7.6, -64.5715], [7.7, -64.5681], [7.8, -64.5648], [7.9, -64.5616], [8, -64.5584], [8.1, -64.5553], [8.2, -64.5522], [8.3, -64.5492], [8.4, -64.5462], [8.5, -64.5433], [8.6, -64.5404], [8.7, -64.5376], [8.8, -64.5348], [8.9, -64.5321], [9, -64.5294], [9.1, -64.5268], [9.2, -64.5242], [9.3, -64.5217], [9.4, -64.5192], [9.5, -64.5167], [9.6, -64.5144], [9.7, -64.512], [9.8, -64.5097], [9.9, -64.5074], [10, -64.5052], [10.1, -64.5031], [10.2, -64.5009], [10.3, -64.4989], [10.4, -64.4968], [10.5, -64.4948], [10.6, -64.4929], [10.7, -64.491], [10.8, -64.4891], [10.9, -64.4873], [11, -64.4855], [11.1, -64.4837], [11.2, -64.482], [11.3, -64.4804], [11.4, -64.4787], [11.5, -64.4771], [11.6, -64.4756], [11.7, -64.4741], [11.8, -64.4726], [11.9, -64.4712], [12, -64.4698], [12.1, -64.4684], [12.2, -64.4671], [12.3, -64.4658], [12.4, -64.4645], [12.5, -64.4633], [12.6, -64.4621], [12.7, -64.4609], [12.8, -64.4598], [12.9, -64.4587], [13, -64.4577], [13.1, -64.4566], [13.2, -64.4557], [13.3, -64.4547], [13.4, -64.4538], [13.5, -64.4529], [13.6, -64.452], [13.7, -64.4512], [13.8, -64.4504], [13.9, -64.4496], [14, -64.4488], [14.1, -64.4481], [14.2, -64.4474], [14.3, -64.4468], [14.4, -64.4461], [14.5, -64.4455], [14.6, -64.4449], [14.7, -64.4444], [14.8, -64.4439], [14.9, -64.4434], [15, -64.4429], [15.1, -64.4424], [15.2, -64.442], [15.3, -64.4416], [15.4, -64.4412], [15.5, -64.4409], [15.6, -64.4405], [15.7, -64.4402], [15.8, -64.4399], [15.9, -64.4397], [16, -64.4394], [16.1, -64.4392], [16.2, -64.439], [16.3, -64.4388], [16.4, -64.4387], [16.5, -64.4386], [16.6, -64.4384], [16.7, -64.4383], [16.8, -64.4383], [16.9, -64.4382], [17, -64.4382], [17.1, -64.4381], [17.2, -64.4381], [17.3, -64.4382], [17.4, -64.4382], [17.5, -64.4382], [17.6, -64.4383], [17.7, -64.4384], [17.8, -64.4385], [17.9, -64.4386], [18, -64.4387], [18.1, -64.4389], [18.2, -64.439], [18.3, -64.4392], [18.4, -64.4394], [18.5, -64.4396], [18.6, -64.4398], [18.7, -64.4401], [18.8, -64.4403], [18.9, -64.4406], [19, -64.4409], [19.1, -64.4411], [19.2, -64.4414], [19.3, -64.4417], [19.4, -64.4421], [19.5, -64.4424], [19.6, -64.4427], [19.7, -64.4431], [19.8, -64.4435], [19.9, -64.4438], [20, -64.3942], [20.1, -64.2954], [20.2, -64.1972], [20.3, -64.0998], [20.4, -64.0031], [20.5, -63.9072], [20.6, -63.8119], [20.7, -63.7174], [20.8, -63.6236], [20.9, -63.5304], [21, -63.438], [21.1, -63.3463], [21.2, -63.2553], [21.3, -63.1649], [21.4, -63.0752], [21.5, -62.9862], [21.6, -62.8979], [21.7, -62.8102], [21.8, -62.7232], [21.9, -62.6369], [22, -62.5512], [22.1, -62.4661], [22.2, -62.3816], [22.3, -62.2978], [22.4, -62.2146], [22.5, -62.132], [22.6, -62.05], [22.7, -61.9686], [22.8, -61.8878], [22.9, -61.8075], [23, -61.7279], [23.1, -61.6488], [23.2, -61.5702], [23.3, -61.4922], [23.4, -61.4148], [23.5, -61.3379], [23.6, -61.2615], [23.7, -61.1857], [23.8, -61.1103], [23.9, -61.0355], [24, -60.9612], [24.1, -60.8873], [24.2, -60.8139], [24.3, -60.741], [24.4, -60.6686], [24.5, -60.5966], [24.6, -60.525], [24.7, -60.4539], [24.8, -60.3832], [24.9, -60.3129], [25, -60.2431], [25.1, -60.1736], [25.2, -60.1045], [25.3, -60.0358], [25.4, -59.9675], [25.5, -59.8995], [25.6, -59.8319], [25.7, -59.7646], [25.8, -59.6977], [25.9, -59.631], [26, -59.5647], [26.1, -59.4987], [26.2, -59.4329], [26.3, -59.3675], [26.4, -59.3023], [26.5, -59.2374], [26.6, -59.1727], [26.7, -59.1082], [26.8, -59.044], [26.9, -58.9799], [27, -58.9161], [27.1, -58.8524], [27.2, -58.7889], [27.3, -58.7256], [27.4, -58.6624], [27.5, -58.5994], [27.6, -58.5365], [27.7, -58.4737], [27.8, -58.4109], [27.9, -58.3483], [28, -58.2857], [28.1, -58.2231], [28.2, -58.1606], [28.3, -58.0981], [28.4, -58.0356], [28.5, -57.9731], [28.6, -57.9105], [28.7, -57.8479], [28.8, -57.7852], [28.9, -57.7224], [29, -57.6595], [29.1, -57.5965], [29.2, -57.5333], [29.3, -57.4699], [29.4, -57.4064], [29.5, -57.3426], [29.6, -57.2786], [29.7, -57.2142], [29.8, -57.1496], [29.9, -57.0847], [30, -57.0194], [30.1, -56.9537], [30.2, -56.8876], [30.3, -56.821], [30.4, -56.754], [30.5, -56.6864], [30.6, -56.6182], [30.7, -56.5495], [30.8, -56.4801], [30.9, -56.41], [31, -56.3391], [31.1, -56.2675], [31.2, -56.195], [31.3, -56.1216], [31.4, -56.0473], [31.5, -55.9719], [31.6, -55.8954], [31.7, -55.8178], [31.8, -55.7389], [31.9, -55.6586], [32, -55.577], [32.1, -55.4938], [32.2, -55.4089], [32.3, -55.3223], [32.4, -55.2339], [32.5, -55.1434], [32.6, -55.0508], [32.7, -54.9559], [32.8, -54.8585], [32.9, -54.7584], [33, -54.6554], [33.1, -54.5492], [33.2, -54.4397], [33.3, -54.3265], [33.4, -54.2093], [33.5, -54.0878], [33.6, -53.9614], [33.7, -53.8299], [33.8, -53.6925], [33.9, -53.5488], [34, -53.3981], [34.1, -53.2395], [34.2, -53.0721], [34.3, -52.8948], [34.4, -52.7063], [34.5, -52.5049], [34.6, -52.2889], [34.7, -52.0558], [34.8, -51.8028], [34.9, -51.5259], [35, -51.2205], [35.1, -50.8799], [35.2, -50.4955], [35.3, -50.0545], [35.4, -49.5384], [35.5, -48.9177], [35.6, -48.1418], [35.7, -47.1133], [35.8, -45.6053], [35.9, -42.8661], [36, -32.3888], [36.1, -68], [36.2, -67.9555], [36.3, -67.9102], [36.4, -67.8642], [36.5, -67.8175], [36.6, -67.77], [36.7, -67.7219], [36.8, -67.6731], [36.9, -67.6236], [37, -67.5736], [37.1, -67.5229], [37.2, -67.4717], [37.3, -67.4199], [37.4, -67.3675], [37.5, -67.3146], [37.6, -67.2613], [37.7, -67.2074], [37.8, -67.1531], [37.9, -67.0983], [38, -67.0431], [38.1, -66.9874], [38.2, -66.9314], [38.3, -66.875], [38.4, -66.8182], [38.5, -66.7611], [38.6, -66.7036], [38.7, -66.6458], [38.8, -66.5877], [38.9, -66.5294], [39, -66.4707], [39.1, -66.4118], [39.2, -66.3526], [39.3, -66.2933], [39.4, -66.2336], [39.5, -66.1738], [39.6, -66.1138], [39.7, -66.0536], [39.8, -65.9933], [39.9, -65.9328], [40, -65.8721], [40.1, -65.8113], [40.2, -65.7504], [40.3, -65.6894], [40.4, -65.6283], [40.5, -65.5671], [40.6, -65.5058], [40.7, -65.4445], [40.8, -65.3831], [40.9, -65.3216], [41, -65.2602], [41.1, -65.1986], [41.2, -65.1371], [41.3, -65.0756], [41.4, -65.014], [41.5, -64.9525], [41.6, -64.891], [41.7, -64.8295], [41.8, -64.768], [41.9, -64.7066], [42, -64.6452], [42.1, -64.5838], [42.2, -64.5226], [42.3, -64.4613], [42.4, -64.4002], [42.5, -64.3391], [42.6, -64.2782], [42.7, -64.2173], [42.8, -64.1565], [42.9, -64.0958], [43, -64.0352], [43.1, -63.9748], [43.2, -63.9144], [43.3, -63.8542], [43.4, -63.7941], [43.5, -63.7341], [43.6, -63.6743], [43.7, -63.6146], [43.8, -63.5551], [43.9, -63.4957], [44, -63.4365], [44.1, -63.3774], [44.2, -63.3184], [44.3, -63.2597], [44.4, -63.2011], [44.5, -63.1427], [44.6, -63.0844], [44.7, -63.0263], [44.8, -62.9684], [44.9, -62.9107], [45, -62.8531], [45.1, -62.7958], [45.2, -62.7386], [45.3, -62.6816], [45.4, -62.6248], [45.5, -62.5682], [45.6, -62.5118], [45.7, -62.4556], [45.8, -62.3995], [45.9, -62.3437], [46, -62.2881], [46.1, -62.2326], [46.2, -62.1774], [46.3, -62.1224], [46.4, -62.0675], [46.5, -62.0129], [46.6, -61.9584], [46.7, -61.9042], [46.8, -61.8502], [46.9, -61.7964], [47, -61.7427], [47.1, -61.6893], [47.2, -61.6361], [47.3, -61.5831], [47.4, -61.5302], [47.5, -61.4776], [47.6, -61.4252], [47.7, -61.373], [47.8, -61.321], [47.9, -61.2691], [48, -61.2175], [48.1, -61.1661], [48.2, -61.1148], [48.3, -61.0638], [48.4, -61.0129], [48.5, -60.9623], [48.6, -60.9118], [48.7, -60.8615], [48.8, -60.8114], [48.9, -60.7615], [49, -60.7118], [49.1, -60.6622], [49.2, -60.6129], [49.3, -60.5637], [49.4, -60.5147], [49.5, -60.4658], [49.6, -60.4172], [49.7, -60.3687], [49.8, -60.3204], [49.9, -60.2722], [50, -60.2242], [50.1, -60.1763], [50.2, -60.1287], [50.3, -60.0811], [50.4, -60.0338], [50.5, -59.9865], [50.6, -59.9394], [50.7, -59.8925], [50.8, -59.8457], [50.9, -59.799], [51, -59.7525], [51.1, -59.7061], [51.2, -59.6599], [51.3, -59.6137], [51.4, -59.5677], [51.5, -59.5218], [51.6, -59.476], [51.7, -59.4303], [51.8, -59.3847], [51.9, -59.3393], [52, -59.2939], [52.1, -59.2486], [52.2, -59.2034], [52.3, -59.1583], [52.4, -59.1133], [52.5, -59.0683], [52.6, -59.0234], [52.7, -58.9786], [52.8, -58.9339], [52.9, -58.8892], [53, -58.8446], [53.1, -58.8], [53.2, -58.7554], [53.3, -58.7109], [53.4, -58.6665], [53.5, -58.622], [53.6, -58.5776], [53.7, -58.5332], [53.8, -58.4888], [53.9, -58.4443], [54, -58.3999], [54.1, -58.3555], [54.2, -58.3111], [54.3, -58.2666], [54.4, -58.2221], [54.5, -58.1776], [54.6, -58.133], [54.7, -58.0884], [54.8, -58.0437], [54.9, -57.9989], [55, -57.9541], [55.1, -57.9092], [55.2, -57.8641], [55.3, -57.819], [55.4, -57.7738], [55.5, -57.7284], [55.6, -57.6829], [55.7, -57.6372], [55.8, -57.5914], [55.9, -57.5455], [56, -57.4993], [56.1, -57.453], [56.2, -57.4064], [56.3, -57.3597], [56.4, -57.3127], [56.5, -57.2655], [56.6, -57.218], [56.7, -57.1702], [56.8, -57.1222], [56.9, -57.0738], [57, -57.0251], [57.1, -56.9761], [57.2, -56.9267], [57.3, -56.877], [57.4, -56.8268], [57.5, -56.7763], [57.6, -56.7253], [57.7, -56.6738], [57.8, -56.6219], [57.9, -56.5694], [58, -56.5164], [58.1, -56.4628], [58.2, -56.4087], [58.3, -56.3539], [58.4, -56.2984], [58.5, -56.2423], [58.6, -56.1854], [58.7, -56.1277], [58.8, -56.0693], [58.9, -56.01], [59, -55.9498], [59.1, -55.8886], [59.2, -55.8265], [59.3, -55.7633], [59.4, -55.6989], [59.5, -55.6334], [59.6, -55.5667], [59.7, -55.4986], [59.8, -55.4292], [59.9, -55.3583], [60, -55.2858], [60.1, -55.2116], [60.2, -55.1357], [60.3, -55.0579], [60.4, -54.9781], [60.5, -54.8962], [60.6, -54.812], [60.7, -54.7253], [60.8, -54.636], [60.9, -54.5439], [61, -54.4488], [61.1, -54.3505], [61.2, -54.2486], [61.3, -54.1429], [61.4, -54.0331], [61.5, -53.9188], [61.6, -53.7996], [61.7, -53.675], [61.8, -53.5446], [61.9, -53.4076], [62, -53.2635], [62.1, -53.1113], [62.2, -52.9502], [62.3, -52.779], [62.4, -52.5964], [62.5, -52.4009], [62.6, -52.1904], [62.7, -51.9626], [62.8, -51.7144], [62.9, -51.4422], [63, -51.1409], [63.1, -50.804], [63.2, -50.4223], [63.3, -49.9831], [63.4, -49.4671], [63.5, -48.8439], [63.6, -48.0608], [63.7, -47.0156], [63.8, -45.4657], [63.9, -42.5799], [64, -30.1432], [64.1, -68], [64.2, -67.9715], [64.3, -67.9418], [64.4, -67.9112], [64.5, -67.8795], [64.6, -67.8468], [64.7, -67.8131], [64.8, -67.7785], [64.9, -67.743], [65, -67.7065], [65.1, -67.6692], [65.2, -67.631], [65.3, -67.592], [65.4, -67.5522], [65.5, -67.5116], [65.6, -67.4702], [65.7, -67.4281], [65.8, -67.3852], [65.9, -67.3417], [66, -67.2974], [66.1, -67.2525], [66.2, -67.207], [66.3, -67.1608], [66.4, -67.114], [66.5, -67.0667], [66.6, -67.0188], [66.7, -66.9703], [66.8, -66.9213], [66.9, -66.8718], [67, -66.8218], [67.1, -66.7713], [67.2, -66.7204], [67.3, -66.669], [67.4, -66.6172], [67.5, -66.565], [67.6, -66.5124], [67.7, -66.4594], [67.8, -66.406], [67.9, -66.3524], [68, -66.2983], [68.1, -66.244], [68.2, -66.1893], [68.3, -66.1344], [68.4, -66.0792], [68.5, -66.0237], [68.6, -65.968], [68.7, -65.9121], [68.8, -65.8559], [68.9, -65.7995], [69, -65.7429], [69.1, -65.6861], [69.2, -65.6292], [69.3, -65.5721], [69.4, -65.5148], [69.5, -65.4574], [69.6, -65.3999], [69.7, -65.3423], [69.8, -65.2845], [69.9, -65.2266], [70, -65.1687], [70.1, -65.1107], [70.2, -65.0526], [70.3, -64.9945], [70.4, -64.9363], [70.5, -64.878], [70.6, -64.8198], [70.7, -64.7615], [70.8, -64.7031], [70.9, -64.6448], [71, -64.5865], [71.1, -64.5282], [71.2, -64.4699], [71.3, -64.4116], [71.4, -64.3534], [71.5, -64.2951], [71.6, -64.237], [71.7, -64.1788], [71.8, -64.1208], [71.9, -64.0628], [72, -64.0048], [72.1, -63.947], [72.2, -63.8892], [72.3, -63.8315], [72.4, -63.7738], [72.5, -63.7163], [72.6, -63.6589], [72.7, -63.6015], [72.8, -63.5443], [72.9, -63.4872], [73, -63.4302], [73.1, -63.3733], [73.2, -63.3166], [73.3, -63.26], [73.4, -63.2035], [73.5, -63.1471], [73.6, -63.0909], [73.7, -63.0348], [73.8, -62.9789], [73.9, -62.9231], [74, -62.8675], [74.1, -62.812], [74.2, -62.7567], [74.3, -62.7015], [74.4, -62.6465], [74.5, -62.5917], [74.6, -62.537], [74.7, -62.4824], [74.8, -62.4281], [74.9, -62.3739], [75, -62.3199], [75.1, -62.2661], [75.2, -62.2124], [75.3, -62.1589], [75.4, -62.1056], [75.5, -62.0524], [75.6, -61.9995], [75.7, -61.9467], [75.8, -61.8941], [75.9, -61.8417], [76, -61.7894], [76.1, -61.7373], [76.2, -61.6855], [76.3, -61.6338], [76.4, -61.5822], [76.5, -61.5309], [76.6, -61.4797], [76.7, -61.4287], [76.8, -61.3779], [76.9, -61.3273], [77, -61.2768], [77.1, -61.2266], [77.2, -61.1765], [77.3, -61.1266], [77.4, -61.0768], [77.5, -61.0273], [77.6, -60.9779], [77.7, -60.9287], [77.8, -60.8796], [77.9, -60.8308], [78, -60.7821], [78.1, -60.7335], [78.2, -60.6852], [78.3, -60.637], [78.4, -60.5889], [78.5, -60.541], [78.6, -60.4933], [78.7, -60.4458], [78.8, -60.3984], [78.9, -60.3511], [79, -60.3041], [79.1, -60.2571], [79.2, -60.2103], [79.3, -60.1637], [79.4, -60.1172], [79.5, -60.0708], [79.6, -60.0246], [79.7, -59.9785], [79.8, -59.9326], [79.9, -59.8868], [80, -59.8411], [80.1, -59.7955], [80.2, -59.7501], [80.3, -59.7048], [80.4, -59.6596], [80.5, -59.6145], [80.6, -59.5695], [80.7, -59.5247], [80.8, -59.4799], [80.9, -59.4353], [81, -59.3907], [81.1, -59.3462], [81.2, -59.3019], [81.3, -59.2576], [81.4, -59.2134], [81.5, -59.1692], [81.6, -59.1252], [81.7, -59.0812], [81.8, -59.0373], [81.9, -58.9934], [82, -58.9496], [82.1, -58.9059], [82.2, -58.8622], [82.3, -58.8185], [82.4, -58.7749], [82.5, -58.7313], [82.6, -58.6878], [82.7, -58.6443], [82.8, -58.6008], [82.9, -58.5573], [83, -58.5138], [83.1, -58.4703], [83.2, -58.4268], [83.3, -58.3833], [83.4, -58.3398], [83.5, -58.2962], [83.6, -58.2526], [83.7, -58.209], [83.8, -58.1654], [83.9, -58.1217], [84, -58.0779], [84.1, -58.034], [84.2, -57.9901], [84.3, -57.9461], [84.4, -57.9021], [84.5, -57.8579], [84.6, -57.8136], [84.7, -57.7692], [84.8, -57.7247], [84.9, -57.68], [85, -57.6352], [85.1, -57.5902], [85.2, -57.5451], [85.3, -57.4997], [85.4, -57.4542], [85.5, -57.4085], [85.6, -57.3626], [85.7, -57.3164], [85.8, -57.27], [85.9, -57.2234], [86, -57.1765], [86.1, -57.1292], [86.2, -57.0817], [86.3, -57.0339], [86.4, -56.9858], [86.5, -56.9372], [86.6, -56.8884], [86.7, -56.8391], [86.8, -56.7894], [86.9, -56.7393], [87, -56.6888], [87.1, -56.6377], [87.2, -56.5862], [87.3, -56.5341], [87.4, -56.4815], [87.5, -56.4283], [87.6, -56.3745], [87.7, -56.3201], [87.8, -56.265], [87.9, -56.2091], [88, -56.1526], [88.1, -56.0952], [88.2, -56.037], [88.3, -55.9779], [88.4, -55.918], [88.5, -55.857], [88.6, -55.7951], [88.7, -55.7321], [88.8, -55.6679], [88.9, -55.6025], [89, -55.5359], [89.1, -55.4679], [89.2, -55.3985], [89.3, -55.3277], [89.4, -55.2552], [89.5, -55.181], [89.6, -55.105], [89.7, -55.0271], [89.8, -54.9472], [89.9, -54.8651], [90, -54.7807], [90.1, -54.6938], [90.2, -54.6042], [90.3, -54.5118], [90.4, -54.4162], [90.5, -54.3174], [90.6, -54.215], [90.7, -54.1086], [90.8, -53.9981], [90.9, -53.883], [91, -53.7628], [91.1, -53.6372], [91.2, -53.5056], [91.3, -53.3672], [91.4, -53.2215], [91.5, -53.0676], [91.6, -52.9044], [91.7, -52.7309], [91.8, -52.5456], [91.9, -52.3469], [92, -52.1327], [92.1, -51.9005], [92.2, -51.6472], [92.3, -51.3686], [92.4, -51.0596], [92.5, -50.713], [92.6, -50.3189], [92.7, -49.8633], [92.8, -49.3247], [92.9, -48.6688], [93, -47.8343], [93.1, -46.6978], [93.2, -44.946], [93.3, -41.3317], [93.4, -68], [93.5, -67.961], [93.6, -67.9212], [93.7, -67.8805], [93.8, -67.839], [93.9, -67.7967], [94, -67.7536], [94.1, -67.7097], [94.2, -67.6651], [94.3, -67.6198], [94.4, -67.5737], [94.5, -67.527], [94.6, -67.4797], [94.7, -67.4317], [94.8, -67.3831], [94.9, -67.3339], [95, -67.2841], [95.1, -67.2337], [95.2, -67.1829], [95.3, -67.1315], [95.4, -67.0796], [95.5, -67.0272], [95.6, -66.9743], [95.7, -66.921], [95.8, -66.8673], [95.9, -66.8131], [96, -66.7586], [96.1, -66.7037], [96.2, -66.6484], [96.3, -66.5927], [96.4, -66.5368], [96.5, -66.4805], [96.6, -66.4239], [96.7, -66.367], [96.8, -66.3098], [96.9, -66.2524], [97, -66.1947], [97.1, -66.1368], [97.2, -66.0787], [97.3, -66.0203], [97.4, -65.9618], [97.5, -65.9031], [97.6, -65.8442], [97.7, -65.7851], [97.8, -65.7259], [97.9, -65.6666], [98, -65.6071], [98.1, -65.5476], [98.2, -65.4879], [98.3, -65.4281], [98.4, -65.3683], [98.5, -65.3083], [98.6, -65.2484], [98.7, -65.1883], [98.8, -65.1282], [98.9, -65.0681], [99, -65.008], [99.1, -64.9478], [99.2, -64.8876], [99.3, -64.8275], [99.4, -64.7673], [99.5, -64.7071], [99.6, -64.647], [99.7, -64.5869], [99.8, -64.5269], [99.9, -64.4668], [100, -64.4069], [100.1, -64.347], [100.2, -64.2871], [100.3, -64.2274], [100.4, -64.1677], [100.5, -64.1081], [100.6, -64.0485], [100.7, -63.9891], [100.8, -63.9298], [100.9, -63.8705], [101, -63.8114], [101.1, -63.7524], [101.2, -63.6935], [101.3, -63.6348], [101.4, -63.5761], [101.5, -63.5176], [101.6, -63.4593], [101.7, -63.401], [101.8, -63.343], [101.9, -63.285], [102, -63.2272], [102.1, -63.1696], [102.2, -63.1121], [102.3, -63.0548], [102.4, -62.9976], [102.5, -62.9406], [102.6, -62.8838], [102.7, -62.8272], [102.8, -62.7707], [102.9, -62.7144], [103, -62.6582], [103.1, -62.6023], [103.2, -62.5465], [103.3, -62.4909], [103.4, -62.4355], [103.5, -62.3803], [103.6, -62.3252], [103.7, -62.2704], [103.8, -62.2157], [103.9, -62.1612], [104, -62.1069], [104.1, -62.0528], [104.2, -61.9989], [104.3, -61.9452], [104.4, -61.8917], [104.5, -61.8384], [104.6, -61.7852], [104.7, -61.7323], [104.8, -61.6795], [104.9, -61.627], [105, -61.5746], [105.1, -61.5224], [105.2, -61.4704], [105.3, -61.4187], [105.4, -61.3671], [105.5, -61.3156], [105.6, -61.2644], [105.7, -61.2134], [105.8, -61.1626], [105.9, -61.1119], [106, -61.0614], [106.1, -61.0111], [106.2, -60.961], [106.3, -60.9111], [106.4, -60.8614], [106.5, -60.8118], [106.6, -60.7625], [106.7, -60.7133], [106.8, -60.6642], [106.9, -60.6154], [107, -60.5667], [107.1, -60.5182], [107.2, -60.4699], [107.3, -60.4217], [107.4, -60.3737], [107.5, -60.3258], [107.6, -60.2781], [107.7, -60.2306], [107.8, -60.1832], [107.9, -60.136], [108, -60.0889], [108.1, -60.042], [108.2, -59.9952], [108.3, -59.9486], [108.4, -59.9021], [108.5, -59.8557], [108.6, -59.8095], [108.7, -59.7634], [108.8, -59.7174], [108.9, -59.6716], [109, -59.6258], [109.1, -59.5802], [109.2, -59.5347], [109.3, -59.4893], [109.4, -59.444], [109.5, -59.3989], [109.6, -59.3538], [109.7, -59.3088], [109.8, -59.2639], [109.9, -59.2191], [110, -59.1744], [110.1, -59.1298], [110.2, -59.0852], [110.3, -59.0407], [110.4, -58.9963], [110.5, -58.9519], [110.6, -58.9076], [110.7, -58.8634], [110.8, -58.8192], [110.9, -58.775], [111, -58.7309], [111.1, -58.6868], [111.2, -58.6427], [111.3, -58.5987], [111.4, -58.5546], [111.5, -58.5106], [111.6, -58.4666], [111.7, -58.4226], [111.8, -58.3785], [111.9, -58.3345], [112, -58.2904], [112.1, -58.2463], [112.2, -58.2022], [112.3, -58.158], [112.4, -58.1138], [112.5, -58.0695], [112.6, -58.0251], [112.7, -57.9807], [112.8, -57.9362], [112.9, -57.8916], [113, -57.8469], [113.1, -57.8021], [113.2, -57.7572], [113.3, -57.7121], [113.4, -57.6669], [113.5, -57.6215], [113.6, -57.576], [113.7, -57.5304], [113.8, -57.4845], [113.9, -57.4384], [114, -57.3922], [114.1, -57.3457], [114.2, -57.299], [114.3, -57.252], [114.4, -57.2048], [114.5, -57.1573], [114.6, -57.1095], [114.7, -57.0614], [114.8, -57.013], [114.9, -56.9642], [115, -56.9151], [115.1, -56.8656], [115.2, -56.8157], [115.3, -56.7653], [115.4, -56.7146], [115.5, -56.6633], [115.6, -56.6116], [115.7, -56.5594], [115.8, -56.5066], [115.9, -56.4532], [116, -56.3993], [116.1, -56.3447], [116.2, -56.2894], [116.3, -56.2335], [116.4, -56.1768], [116.5, -56.1194], [116.6, -56.0611], [116.7, -56.002], [116.8, -55.942], [116.9, -55.881], [117, -55.819], [117.1, -55.756], [117.2, -55.6918], [117.3, -55.6265], [117.4, -55.5599], [117.5, -55.4921], [117.6, -55.4228], [117.7, -55.352], [117.8, -55.2797], [117.9, -55.2057], [118, -55.1299], [118.1, -55.0522], [118.2, -54.9726], [118.3, -54.8908], [118.4, -54.8067], [118.5, -54.7202], [118.6, -54.631], [118.7, -54.5391], [118.8, -54.4441], [118.9, -54.3458], [119, -54.2441], [119.1, -54.1385], [119.2, -54.0288], [119.3, -53.9146], [119.4, -53.7955], [119.5, -53.671], [119.6, -53.5406], [119.7, -53.4037], [119.8, -53.2596], [119.9, -53.1075], [120, -52.9464], [120.1, -52.7753], [120.2, -52.5927], [120.3, -52.3971], [120.4, -52.1866], [120.5, -51.9587], [120.6, -51.7105], [120.7, -51.4381], [120.8, -51.1366], [120.9, -50.7994], [121, -50.4174], [121.1, -49.9776], [121.2, -49.4608], [121.3, -48.8364], [121.4, -48.0514], [121.5, -47.0028], [121.6, -45.4457], [121.7, -42.5356], [121.8, -68], [121.9, -67.9602], [122, -67.9195], [122.1, -67.878], [122.2, -67.8357], [122.3, -67.7926], [122.4, -67.7487], [122.5, -67.7041], [122.6, -67.6587], [122.7, -67.6127], [122.8, -67.566], [122.9, -67.5186], [123, -67.4705], [123.1, -67.4218], [123.2, -67.3726], [123.3, -67.3227], [123.4, -67.2723], [123.5, -67.2214], [123.6, -67.1699], [123.7, -67.1179], [123.8, -67.0654], [123.9, -67.0125], [124, -66.9591], [124.1, -66.9053], [124.2, -66.851], [124.3, -66.7964], [124.4, -66.7413], [124.5, -66.6859], [124.6, -66.6301], [124.7, -66.574], [124.8, -66.5176], [124.9, -66.4609], [125, -66.4039], [125.1, -66.3465], [125.2, -66.289], [125.3, -66.2312], [125.4, -66.1731], [125.5, -66.1148], [125.6, -66.0563], [125.7, -65.9976], [125.8, -65.9387], [125.9, -65.8797], [126, -65.8205], [126.1, -65.7611], [126.2, -65.7016], [126.3, -65.642], [126.4, -65.5822], [126.5, -65.5224], [126.6, -65.4624], [126.7, -65.4024], [126.8, -65.3423], [126.9, -65.2821], [127, -65.2219], [127.1, -65.1616], [127.2, -65.1013], [127.3, -65.041], [127.4, -64.9806], [127.5, -64.9203], [127.6, -64.8599], [127.7, -64.7995], [127.8, -64.7392], [127.9, -64.6789], [128, -64.6186], [128.1, -64.5583], [128.2, -64.4981], [128.3, -64.438], [128.4, -64.3779], [128.5, -64.3178], [128.6, -64.2578], [128.7, -64.198], [128.8, -64.1381], [128.9, -64.0784], [129, -64.0188], [129.1, -63.9593], [129.2, -63.8998], [129.3, -63.8405], [129.4, -63.7813], [129.5, -63.7222], [129.6, -63.6633], [129.7, -63.6044], [129.8, -63.5457], [129.9, -63.4872], [130, -63.4287], [130.1, -63.3705], [130.2, -63.3123], [130.3, -63.2543], [130.4, -63.1965], [130.5, -63.1388], [130.6, -63.0813], [130.7, -63.024], [130.8, -62.9668], [130.9, -62.9098], [131, -62.8529], [131.1, -62.7962], [131.2, -62.7397], [131.3, -62.6834], [131.4, -62.6273], [131.5, -62.5713], [131.6, -62.5155], [131.7, -62.4599], [131.8, -62.4045], [131.9, -62.3493], [132, -62.2942], [132.1, -62.2394], [132.2, -62.1847], [132.3, -62.1303], [132.4, -62.076], [132.5, -62.0219], [132.6, -61.968], [132.7, -61.9143], [132.8, -61.8608], [132.9, -61.8075], [133, -61.7544], [133.1, -61.7015], [133.2, -61.6487], [133.3, -61.5962], [133.4, -61.5439], [133.5, -61.4917], [133.6, -61.4398], [133.7, -61.388], [133.8, -61.3364], [133.9, -61.285], [134, -61.2339], [134.1, -61.1829], [134.2, -61.132], [134.3, -61.0814], [134.4, -61.031], [134.5, -60.9807], [134.6, -60.9307], [134.7, -60.8808], [134.8, -60.8311], [134.9, -60.7816], [135, -60.7322], [135.1, -60.6831], [135.2, -60.6341], [135.3, -60.5852], [135.4, -60.5366], [135.5, -60.4881], [135.6, -60.4398], [135.7, -60.3917], [135.8, -60.3437], [135.9, -60.2959], [136, -60.2482], [136.1, -60.2007], [136.2, -60.1534], [136.3, -60.1062], [136.4, -60.0591], [136.5, -60.0122], [136.6, -59.9655], [136.7, -59.9188], [136.8, -59.8724], [136.9, -59.826], [137, -59.7798], [137.1, -59.7337], [137.2, -59.6878], [137.3, -59.6419], [137.4, -59.5962], [137.5, -59.5506], [137.6, -59.5051], [137.7, -59.4598], [137.8, -59.4145], [137.9, -59.3693], [138, -59.3242], [138.1, -59.2793], [138.2, -59.2344], [138.3, -59.1896], [138.4, -59.1448], [138.5, -59.1002], [138.6, -59.0556], [138.7, -59.0111], [138.8, -58.9667], [138.9, -58.9223], [139, -58.878], [139.1, -58.8337], [139.2, -58.7895], [139.3, -58.7453], [139.4, -58.7011], [139.5, -58.657], [139.6, -58.6129], [139.7, -58.5688], [139.8, -58.5247], [139.9, -58.4806], [140, -58.4366], [140.1, -58.3925], [140.2, -58.3484], [140.3, -58.3043], [140.4, -58.2601], [140.5, -58.2159], [140.6, -58.1717], [140.7, -58.1275], [140.8, -58.0831], [140.9, -58.0388], [141, -57.9943], [141.1, -57.9498], [141.2, -57.9051], [141.3, -57.8604], [141.4, -57.8156], [141.5, -57.7706], [141.6, -57.7256], [141.7, -57.6804], [141.8, -57.635], [141.9, -57.5895], [142, -57.5438], [142.1, -57.498], [142.2, -57.4519], [142.3, -57.4057], [142.4, -57.3592], [142.5, -57.3125], [142.6, -57.2656], [142.7, -57.2184], [142.8, -57.1709], [142.9, -57.1232], [143, -57.0751], [143.1, -57.0267], [143.2, -56.978], [143.3, -56.929], [143.4, -56.8795], [143.5, -56.8297], [143.6, -56.7794], [143.7, -56.7287], [143.8, -56.6776], [143.9, -56.6259], [144, -56.5738], [144.1, -56.5211], [144.2, -56.4679], [144.3, -56.414], [144.4, -56.3596], [144.5, -56.3045], [144.6, -56.2487], [144.7, -56.1922], [144.8, -56.1349], [144.9, -56.0768], [145, -56.0179], [145.1, -55.958], [145.2, -55.8973], [145.3, -55.8355], [145.4, -55.7728], [145.5, -55.7089], [145.6, -55.6438], [145.7, -55.5775], [145.8, -55.51], [145.9, -55.441], [146, -55.3706], [146.1, -55.2986], [146.2, -55.225], [146.3, -55.1497], [146.4, -55.0725], [146.5, -54.9933], [146.6, -54.9121], [146.7, -54.8285], [146.8, -54.7426], [146.9, -54.6541], [147, -54.5628], [147.1, -54.4686], [147.2, -54.3712], [147.3, -54.2703], [147.4, -54.1657], [147.5, -54.057], [147.6, -53.9439], [147.7, -53.8261], [147.8, -53.703], [147.9, -53.5741], [148, -53.4389], [148.1, -53.2966], [148.2, -53.1466], [148.3, -52.9878], [148.4, -52.8193], [148.5, -52.6397], [148.6, -52.4475], [148.7, -52.2409], [148.8, -52.0176], [148.9, -51.7747], [149, -51.5088], [149.1, -51.2151], [149.2, -50.8875], [149.3, -50.5176], [149.4, -50.0938], [149.5, -49.5985], [149.6, -49.0047], [149.7, -48.2667], [149.8, -47.2985], [149.9, -45.9075], [150, -43.5064], [150.1, -36.2354], [150.2, -68], [150.3, -67.9632], [150.4, -67.9255], [150.5, -67.887], [150.6, -67.8475], [150.7, -67.8072], [150.8, -67.7661], [150.9, -67.7241], [151, -67.6814], [151.1, -67.6379], [151.2, -67.5937], [151.3, -67.5488], [151.4, -67.5032], [151.5, -67.4569], [151.6, -67.41], [151.7, -67.3624], [151.8, -67.3142], [151.9, -67.2655], [152, -67.2161], [152.1, -67.1662], [152.2, -67.1158], [152.3, -67.0648], [152.4, -67.0134], [152.5, -66.9615], [152.6, -66.9091], [152.7, -66.8562], [152.8, -66.8029], [152.9, -66.7493], [153, -66.6952], [153.1, -66.6407], [153.2, -66.5859], [153.3, -66.5307], [153.4, -66.4752], [153.5, -66.4194], [153.6, -66.3633], [153.7, -66.3069], [153.8, -66.2502], [153.9, -66.1932], [154, -66.136], [154.1, -66.0786], [154.2, -66.0209], [154.3, -65.9631], [154.4, -65.905], [154.5, -65.8468], [154.6, -65.7884], [154.7, -65.7298], [154.8, -65.6711], [154.9, -65.6122], [155, -65.5532], [155.1, -65.4941], [155.2, -65.4349], [155.3, -65.3756], [155.4, -65.3162], [155.5, -65.2568], [155.6, -65.1973], [155.7, -65.1377], [155.8, -65.0781], [155.9, -65.0184], [156, -64.9587], [156.1, -64.899], [156.2, -64.8393], [156.3, -64.7796], [156.4, -64.7199], [156.5, -64.6602], [156.6, -64.6006], [156.7, -64.5409], [156.8, -64.4813], [156.9, -64.4217], [157, -64.3622], [157.1, -64.3028], [157.2, -64.2434], [157.3, -64.184], [157.4, -64.1248], [157.5, -64.0656], [157.6, -64.0065], [157.7, -63.9475], [157.8, -63.8886], [157.9, -63.8298], [158, -63.7711], [158.1, -63.7125], [158.2, -63.6541], [158.3, -63.5957], [158.4, -63.5375], [158.5, -63.4794], [158.6, -63.4214], [158.7, -63.3636], [158.8, -63.3059], [158.9, -63.2484], [159, -63.191], [159.1, -63.1338], [159.2, -63.0767], [159.3, -63.0198], [159.4, -62.963], [159.5, -62.9064], [159.6, -62.8499], [159.7, -62.7936], [159.8, -62.7375], [159.9, -62.6816], [160, -62.6258], [160.1, -62.5702], [160.2, -62.5148], [160.3, -62.4596], [160.4, -62.4045], [160.5, -62.3497], [160.6, -62.295], [160.7, -62.2405], [160.8, -62.1861], [160.9, -62.132], [161, -62.078], [161.1, -62.0243], [161.2, -61.9707], [161.3, -61.9173], [161.4, -61.8641], [161.5, -61.8111], [161.6, -61.7583], [161.7, -61.7057], [161.8, -61.6532], [161.9, -61.601], [162, -61.5489], [162.1, -61.497], [162.2, -61.4454], [162.3, -61.3939], [162.4, -61.3426], [162.5, -61.2914], [162.6, -61.2405], [162.7, -61.1898], [162.8, -61.1392], [162.9, -61.0888], [163, -61.0386], [163.1, -60.9886], [163.2, -60.9388], [163.3, -60.8891], [163.4, -60.8397], [163.5, -60.7904], [163.6, -60.7413], [163.7, -60.6923], [163.8, -60.6435], [163.9, -60.5949], [164, -60.5465], [164.1, -60.4982], [164.2, -60.4501], [164.3, -60.4022], [164.4, -60.3544], [164.5, -60.3068], [164.6, -60.2594], [164.7, -60.2121], [164.8, -60.1649], [164.9, -60.1179], [165, -60.071], [165.1, -60.0243], [165.2, -59.9778], [165.3, -59.9313], [165.4, -59.885], [165.5, -59.8389], [165.6, -59.7929], [165.7, -59.747], [165.8, -59.7012], [165.9, -59.6555], [166, -59.61], [166.1, -59.5646], [166.2, -59.5193], [166.3, -59.4741], [166.4, -59.429], [166.5, -59.384], [166.6, -59.3391], [166.7, -59.2943], [166.8, -59.2496], [166.9, -59.2049], [167, -59.1604], [167.1, -59.1159], [167.2, -59.0715], [167.3, -59.0272], [167.4, -58.9829], [167.5, -58.9387], [167.6, -58.8946], [167.7, -58.8505], [167.8, -58.8064], [167.9, -58.7624], [168, -58.7184], [168.1, -58.6744], [168.2, -58.6305], [168.3, -58.5866], [168.4, -58.5427], [168.5, -58.4988], [168.6, -58.4549], [168.7, -58.411], [168.8, -58.3671], [168.9, -58.3232], [169, -58.2793], [169.1, -58.2353], [169.2, -58.1913], [169.3, -58.1472], [169.4, -58.1031], [169.5, -58.0589], [169.6, -58.0147], [169.7, -57.9703], [169.8, -57.9259], [169.9, -57.8814], [170, -57.8368], [170.1, -57.7921], [170.2, -57.7473], [170.3, -57.7023], [170.4, -57.6572], [170.5, -57.6119], [170.6, -57.5665], [170.7, -57.5209], [170.8, -57.4751], [170.9, -57.4291], [171, -57.383], [171.1, -57.3365], [171.2, -57.2899], [171.3, -57.243], [171.4, -57.1958], [171.5, -57.1484], [171.6, -57.1007], [171.7, -57.0526], [171.8, -57.0043], [171.9, -56.9555], [172, -56.9065], [172.1, -56.857], [172.2, -56.8071], [172.3, -56.7568], [172.4, -56.7061], [172.5, -56.6549], [172.6, -56.6032], [172.7, -56.551], [172.8, -56.4982], [172.9, -56.4449], [173, -56.3909], [173.1, -56.3364], [173.2, -56.2811], [173.3, -56.2252], [173.4, -56.1685], [173.5, -56.111], [173.6, -56.0527], [173.7, -55.9936], [173.8, -55.9336], [173.9, -55.8726], [174, -55.8105], [174.1, -55.7475], [174.2, -55.6833], [174.3, -55.6179], [174.4, -55.5513], [174.5, -55.4833], [174.6, -55.4139], [174.7, -55.3431], [174.8, -55.2706], [174.9, -55.1965], [175, -55.1206], [175.1, -55.0428], [175.2, -54.963], [175.3, -54.8811], [175.4, -54.7968], [175.5, -54.7101], [175.6, -54.6207], [175.7, -54.5285], [175.8, -54.4333], [175.9, -54.3347], [176, -54.2326], [176.1, -54.1267], [176.2, -54.0166], [176.3, -53.902], [176.4, -53.7824], [176.5, -53.6575], [176.6, -53.5265], [176.7, -53.389], [176.8, -53.2442], [176.9, -53.0913], [177, -52.9293], [177.1, -52.7571], [177.2, -52.5734], [177.3, -52.3765], [177.4, -52.1644], [177.5, -51.9347], [177.6, -51.6843], [177.7, -51.4093], [177.8, -51.1047], [177.9, -50.7635], [178, -50.3765], [178.1, -49.9302], [178.2, -49.4044], [178.3, -48.767], [178.4, -47.9619], [178.5, -46.8779], [178.6, -45.2442], [178.7, -42.0721], [178.8, -68], [178.9, -67.9605], [179, -67.9201], [179.1, -67.8789], [179.2, -67.8368], [179.3, -67.794], [179.4, -67.7504], [179.5, -67.706], [179.6, -67.6609], [179.7, -67.6151], [179.8, -67.5686], [179.9, -67.5215], [180, -67.4736], [180.1, -67.4252], [180.2, -67.3762], [180.3, -67.3265], [180.4, -67.2763], [180.5, -67.2256], [180.6, -67.1743], [180.7, -67.1225], [180.8, -67.0703], [180.9, -67.0175], [181, -66.9643], [181.1, -66.9107], [181.2, -66.8566], [181.3, -66.8021], [181.4, -66.7472], [181.5, -66.692], [181.6, -66.6364], [181.7, -66.5804], [181.8, -66.5242], [181.9, -66.4676], [182, -66.4107], [182.1, -66.3535], [182.2, -66.2961], [182.3, -66.2384], [182.4, -66.1805], [182.5, -66.1223], [182.6, -66.064], [182.7, -66.0054], [182.8, -65.9466], [182.9, -65.8877], [183, -65.8286], [183.1, -65.7693], [183.2, -65.7099], [183.3, -65.6504], [183.4, -65.5908], [183.5, -65.531], [183.6, -65.4711], [183.7, -65.4112], [183.8, -65.3512], [183.9, -65.2911], [184, -65.2309], [184.1, -65.1708], [184.2, -65.1105], [184.3, -65.0503], [184.4, -64.99], [184.5, -64.9297], [184.6, -64.8694], [184.7, -64.8091], [184.8, -64.7488], [184.9, -64.6886], [185, -64.6283], [185.1, -64.5681], [185.2, -64.508], [185.3, -64.4478], [185.4, -64.3878], [185.5, -64.3278], [185.6, -64.2679], [185.7, -64.208], [185.8, -64.1483], [185.9, -64.0886], [186, -64.029], [186.1, -63.9695], [186.2, -63.9101], [186.3, -63.8508], [186.4, -63.7916], [186.5, -63.7326], [186.6, -63.6736], [186.7, -63.6148], [186.8, -63.5561], [186.9, -63.4976], [187, -63.4392], [187.1, -63.3809], [187.2, -63.3228], [187.3, -63.2648], [187.4, -63.207], [187.5, -63.1494], [187.6, -63.0919], [187.7, -63.0345], [187.8, -62.9773], [187.9, -62.9203], [188, -62.8635], [188.1, -62.8068], [188.2, -62.7503], [188.3, -62.694], [188.4, -62.6379], [188.5, -62.5819], [188.6, -62.5261], [188.7, -62.4705], [188.8, -62.4151], [188.9, -62.3599], [189, -62.3049], [189.1, -62.25], [189.2, -62.1953], [189.3, -62.1409], [189.4, -62.0866], [189.5, -62.0325], [189.6, -61.9786], [189.7, -61.9249], [189.8, -61.8714], [189.9, -61.8181], [190, -61.7649], [190.1, -61.712], [190.2, -61.6593], [190.3, -61.6067], [190.4, -61.5544], [190.5, -61.5022], [190.6, -61.4503], [190.7, -61.3985], [190.8, -61.3469], [190.9, -61.2955], [191, -61.2443], [191.1, -61.1933], [191.2, -61.1425], [191.3, -61.0919], [191.4, -61.0414], [191.5, -60.9912], [191.6, -60.9411], [191.7, -60.8912], [191.8, -60.8415], [191.9, -60.7919], [192, -60.7426], [192.1, -60.6934], [192.2, -60.6444], [192.3, -60.5956], [192.4, -60.5469], [192.5, -60.4984], [192.6, -60.4501], [192.7, -60.402], [192.8, -60.354], [192.9, -60.3061], [193, -60.2585], [193.1, -60.211], [193.2, -60.1636], [193.3, -60.1164], [193.4, -60.0693], [193.5, -60.0224], [193.6, -59.9757], [193.7, -59.929], [193.8, -59.8825], [193.9, -59.8362], [194, -59.79], [194.1, -59.7439], [194.2, -59.6979], [194.3, -59.6521], [194.4, -59.6064], [194.5, -59.5608], [194.6, -59.5153], [194.7, -59.4699], [194.8, -59.4246], [194.9, -59.3795], [195, -59.3344], [195.1, -59.2894], [195.2, -59.2445], [195.3, -59.1997], [195.4, -59.155], [195.5, -59.1103], [195.6, -59.0658], [195.7, -59.0213], [195.8, -58.9768], [195.9, -58.9325], [196, -58.8882], [196.1, -58.8439], [196.2, -58.7997], [196.3, -58.7555], [196.4, -58.7113], [196.5, -58.6672], [196.6, -58.6231], [196.7, -58.579], [196.8, -58.535], [196.9, -58.4909], [197, -58.4469], [197.1, -58.4028], [197.2, -58.3587], [197.3, -58.3146], [197.4, -58.2705], [197.5, -58.2264], [197.6, -58.1822], [197.7, -58.138], [197.8, -58.0937], [197.9, -58.0493], [198, -58.0049], [198.1, -57.9604], [198.2, -57.9158], [198.3, -57.8711], [198.4, -57.8263], [198.5, -57.7814], [198.6, -57.7364], [198.7, -57.6913], [198.8, -57.646], [198.9, -57.6005], [199, -57.5549], [199.1, -57.5091], [199.2, -57.4631], [199.3, -57.4169], [199.4, -57.3705], [199.5, -57.3239], [199.6, -57.2771], [199.7, -57.23], [199.8, -57.1826], [199.9, -57.1349], [200, -57.0869], [200.1, -57.0387], [200.2, -56.99], [200.3, -56.9411], [200.4, -56.8917], [200.5, -56.842], [200.6, -56.7919], [200.7, -56.7413], [200.8, -56.6903], [200.9, -56.6388], [201, -56.5868], [201.1, -56.5343], [201.2, -56.4812], [201.3, -56.4275], [201.4, -56.3732], [201.5, -56.3183], [201.6, -56.2627], [201.7, -56.2064], [201.8, -56.1493], [201.9, -56.0915], [202, -56.0328], [202.1, -55.9732], [202.2, -55.9127], [202.3, -55.8512], [202.4, -55.7887], [202.5, -55.7251], [202.6, -55.6604], [202.7, -55.5944], [202.8, -55.5272], [202.9, -55.4586], [203, -55.3886], [203.1, -55.317], [203.2, -55.2439], [203.3, -55.169], [203.4, -55.0923], [203.5, -55.0137], [203.6, -54.933], [203.7, -54.85], [203.8, -54.7648], [203.9, -54.6769], [204, -54.5864], [204.1, -54.493], [204.2, -54.3964], [204.3, -54.2964], [204.4, -54.1928], [204.5, -54.0852], [204.6, -53.9734], [204.7, -53.8568], [204.8, -53.7351], [204.9, -53.6077], [205, -53.4742], [205.1, -53.3338], [205.2, -53.1859], [205.3, -53.0295], [205.4, -52.8636], [205.5, -52.687], [205.6, -52.4982], [205.7, -52.2955], [205.8, -52.0767], [205.9, -51.8392], [206, -51.5796], [206.1, -51.2936], [206.2, -50.9754], [206.3, -50.6175], [206.4, -50.2089], [206.5, -49.7341], [206.6, -49.1691], [206.7, -48.4742], [206.8, -47.5774], [206.9, -46.3256], [207, -44.297], [207.1, -39.4217], [207.2, -68], [207.3, -67.9616], [207.4, -67.9222], [207.5, -67.8821], [207.6, -67.841], [207.7, -67.7992], [207.8, -67.7566], [207.9, -67.7132], [208, -67.669], [208.1, -67.6241], [208.2, -67.5785], [208.3, -67.5322], [208.4, -67.4853], [208.5, -67.4377], [208.6, -67.3895], [208.7, -67.3407], [208.8, -67.2913], [208.9, -67.2413], [209, -67.1908], [209.1, -67.1397], [209.2, -67.0882], [209.3, -67.0361], [209.4, -66.9836], [209.5, -66.9307], [209.6, -66.8772], [209.7, -66.8234], [209.8, -66.7692], [209.9, -66.7145], [210, -66.6595], [210.1, -66.6042], [210.2, -66.5485], [210.3, -66.4925], [210.4, -66.4361], [210.5, -66.3795], [210.6, -66.3226], [210.7, -66.2654], [210.8, -66.2079], [210.9, -66.1502], [211, -66.0923], [211.1, -66.0342], [211.2, -65.9759], [211.3, -65.9174], [211.4, -65.8587], [211.5, -65.7998], [211.6, -65.7408], [211.7, -65.6817], [211.8, -65.6224], [211.9, -65.563], [212, -65.5035], [212.1, -65.4438], [212.2, -65.3841], [212.3, -65.3244], [212.4, -65.2645], [212.5, -65.2046], [212.6, -65.1447], [212.7, -65.0847], [212.8, -65.0247], [212.9, -64.9646], [213, -64.9046], [213.1, -64.8445], [213.2, -64.7845], [213.3, -64.7244], [213.4, -64.6644], [213.5, -64.6044], [213.6, -64.5444], [213.7, -64.4845], [213.8, -64.4246], [213.9, -64.3648], [214, -64.305], [214.1, -64.2453], [214.2, -64.1857], [214.3, -64.1262], [214.4, -64.0667], [214.5, -64.0073], [214.6, -63.9481], [214.7, -63.8889], [214.8, -63.8298], [214.9, -63.7709], [215, -63.712], [215.1, -63.6533], [215.2, -63.5947], [215.3, -63.5363], [215.4, -63.4779], [215.5, -63.4197], [215.6, -63.3617], [215.7, -63.3038], [215.8, -63.246], [215.9, -63.1884], [216, -63.1309], [216.1, -63.0736], [216.2, -63.0165], [216.3, -62.9595], [216.4, -62.9027], [216.5, -62.8461], [216.6, -62.7896], [216.7, -62.7333], [216.8, -62.6771], [216.9, -62.6212], [217, -62.5654], [217.1, -62.5098], [217.2, -62.4544], [217.3, -62.3992], [217.4, -62.3441], [217.5, -62.2893], [217.6, -62.2346], [217.7, -62.1801], [217.8, -62.1258], [217.9, -62.0717], [218, -62.0178], [218.1, -61.9641], [218.2, -61.9105], [218.3, -61.8572], [218.4, -61.8041], [218.5, -61.7511], [218.6, -61.6983], [218.7, -61.6458], [218.8, -61.5934], [218.9, -61.5412], [219, -61.4892], [219.1, -61.4374], [219.2, -61.3857], [219.3, -61.3343], [219.4, -61.2831], [219.5, -61.232], [219.6, -61.1812], [219.7, -61.1305], [219.8, -61.08], [219.9, -61.0297], [220, -60.9796], [220.1, -60.9296], [220.2, -60.8799], [220.3, -60.8303], [220.4, -60.7809], [220.5, -60.7317], [220.6, -60.6826], [220.7, -60.6338], [220.8, -60.5851], [220.9, -60.5365], [221, -60.4882], [221.1, -60.44], [221.2, -60.3919], [221.3, -60.3441], [221.4, -60.2964], [221.5, -60.2488], [221.6, -60.2014], [221.7, -60.1542], [221.8, -60.1071], [221.9, -60.0601], [222, -60.0133], [222.1, -59.9667], [222.2, -59.9202], [222.3, -59.8738], [222.4, -59.8276], [222.5, -59.7814], [222.6, -59.7355], [222.7, -59.6896], [222.8, -59.6439], [222.9, -59.5982], [223, -59.5527], [223.1, -59.5073], [223.2, -59.4621], [223.3, -59.4169], [223.4, -59.3718], [223.5, -59.3268], [223.6, -59.2819], [223.7, -59.2371], [223.8, -59.1924], [223.9, -59.1478], [224, -59.1032], [224.1, -59.0587], [224.2, -59.0143], [224.3, -58.97], [224.4, -58.9257], [224.5, -58.8814], [224.6, -58.8372], [224.7, -58.7931], [224.8, -58.749], [224.9, -58.7049], [225, -58.6609], [225.1, -58.6168], [225.2, -58.5728], [225.3, -58.5288], [225.4, -58.4849], [225.5, -58.4409], [225.6, -58.3969], [225.7, -58.3529], [225.8, -58.3088], [225.9, -58.2648], [226, -58.2207], [226.1, -58.1766], [226.2, -58.1324], [226.3, -58.0882], [226.4, -58.0439], [226.5, -57.9995], [226.6, -57.9551], [226.7, -57.9105], [226.8, -57.8659], [226.9, -57.8212], [227, -57.7763], [227.1, -57.7313], [227.2, -57.6862], [227.3, -57.641], [227.4, -57.5956], [227.5, -57.55], [227.6, -57.5042], [227.7, -57.4583], [227.8, -57.4122], [227.9, -57.3658], [228, -57.3192], [228.1, -57.2724], [228.2, -57.2253], [228.3, -57.178], [228.4, -57.1303], [228.5, -57.0824], [228.6, -57.0341], [228.7, -56.9855], [228.8, -56.9366], [228.9, -56.8873], [229, -56.8376], [229.1, -56.7875], [229.2, -56.7369], [229.3, -56.6859], [229.4, -56.6344], [229.5, -56.5825], [229.6, -56.5299], [229.7, -56.4769], [229.8, -56.4232], [229.9, -56.3689], [230, -56.314], [230.1, -56.2584], [230.2, -56.2021], [230.3, -56.145], [230.4, -56.0871], [230.5, -56.0284], [230.6, -55.9688], [230.7, -55.9083], [230.8, -55.8468], [230.9, -55.7843], [231, -55.7207], [231.1, -55.6559], [231.2, -55.59], [231.3, -55.5227], [231.4, -55.4541], [231.5, -55.384], [231.6, -55.3124], [231.7, -55.2392], [231.8, -55.1643], [231.9, -55.0875], [232, -55.0088], [232.1, -54.928], [232.2, -54.845], [232.3, -54.7596], [232.4, -54.6717], [232.5, -54.581], [232.6, -54.4875], [232.7, -54.3908], [232.8, -54.2906], [232.9, -54.1869], [233, -54.0791], [233.1, -53.967], [233.2, -53.8502], [233.3, -53.7282], [233.4, -53.6006], [233.5, -53.4668], [233.6, -53.3261], [233.7, -53.1777], [233.8, -53.0209], [233.9, -52.8545], [234, -52.6773], [234.1, -52.4879], [234.2, -52.2845], [234.3, -52.0649], [234.4, -51.8263], [234.5, -51.5655], [234.6, -51.278], [234.7, -50.9581], [234.8, -50.5978], [234.9, -50.1863], [235, -49.7077], [235.1, -49.1372], [235.2, -48.4342], [235.3, -47.5241], [235.4, -46.247], [235.5, -44.1538], [235.6, -38.9293], [235.7, -68], [235.8, -67.9618], [235.9, -67.9228], [236, -67.8828], [236.1, -67.8421], [236.2, -67.8005], [236.3, -67.7581], [236.4, -67.7149], [236.5, -67.671], [236.6, -67.6263], [236.7, -67.5809], [236.8, -67.5348], [236.9, -67.4881], [237, -67.4407], [237.1, -67.3927], [237.2, -67.3441], [237.3, -67.2949], [237.4, -67.2451], [237.5, -67.1948], [237.6, -67.1439], [237.7, -67.0925], [237.8, -67.0407], [237.9, -66.9883], [238, -66.9355], [238.1, -66.8823], [238.2, -66.8286], [238.3, -66.7745], [238.4, -66.72], [238.5, -66.6652], [238.6, -66.6099], [238.7, -66.5544], [238.8, -66.4985], [238.9, -66.4423], [239, -66.3858], [239.1, -66.329], [239.2, -66.2719], [239.3, -66.2146], [239.4, -66.157], [239.5, -66.0992], [239.6, -66.0412], [239.7, -65.983], [239.8, -65.9246], [239.9, -65.866], [240, -65.8072], [240.1, -65.7483], [240.2, -65.6892], [240.3, -65.6301], [240.4, -65.5707], [240.5, -65.5113], [240.6, -65.4518], [240.7, -65.3922], [240.8, -65.3325], [240.9, -65.2727], [241, -65.2129], [241.1, -65.153], [241.2, -65.0931], [241.3, -65.0331], [241.4, -64.9731], [241.5, -64.9131], [241.6, -64.8531], [241.7, -64.7931], [241.8, -64.7331], [241.9, -64.6732], [242, -64.6132], [242.1, -64.5533], [242.2, -64.4934], [242.3, -64.4336], [242.4, -64.3738], [242.5, -64.3141], [242.6, -64.2544], [242.7, -64.1948], [242.8, -64.1353], [242.9, -64.0759], [243, -64.0165], [243.1, -63.9573], [243.2, -63.8981], [243.3, -63.8391], [243.4, -63.7802], [243.5, -63.7214], [243.6, -63.6627], [243.7, -63.6041], [243.8, -63.5456], [243.9, -63.4873], [244, -63.4291], [244.1, -63.3711], [244.2, -63.3132], [244.3, -63.2555], [244.4, -63.1979], [244.5, -63.1404], [244.6, -63.0831], [244.7, -63.026], [244.8, -62.969], [244.9, -62.9122], [245, -62.8556], [245.1, -62.7991], [245.2, -62.7428], [245.3, -62.6867], [245.4, -62.6307], [245.5, -62.575], [245.6, -62.5194], [245.7, -62.464], [245.8, -62.4087], [245.9, -62.3537], [246, -62.2988], [246.1, -62.2441], [246.2, -62.1897], [246.3, -62.1354], [246.4, -62.0812], [246.5, -62.0273], [246.6, -61.9736], [246.7, -61.92], [246.8, -61.8667], [246.9, -61.8135], [247, -61.7606], [247.1, -61.7078], [247.2, -61.6552], [247.3, -61.6028], [247.4, -61.5506], [247.5, -61.4986], [247.6, -61.4468], [247.7, -61.3952], [247.8, -61.3437], [247.9, -61.2925], [248, -61.2414], [248.1, -61.1905], [248.2, -61.1399], [248.3, -61.0894], [248.4, -61.039], [248.5, -60.9889], [248.6, -60.939], [248.7, -60.8892], [248.8, -60.8396], [248.9, -60.7902], [249, -60.741], [249.1, -60.6919], [249.2, -60.643], [249.3, -60.5943], [249.4, -60.5458], [249.5, -60.4974], [249.6, -60.4492], [249.7, -60.4012], [249.8, -60.3533], [249.9, -60.3056], [250, -60.258], [250.1, -60.2106], [250.2, -60.1633], [250.3, -60.1162], [250.4, -60.0693], [250.5, -60.0225], [250.6, -59.9758], [250.7, -59.9293], [250.8, -59.8829], [250.9, -59.8366], [251, -59.7905], [251.1, -59.7445], [251.2, -59.6987], [251.3, -59.6529], [251.4, -59.6073], [251.5, -59.5618], [251.6, -59.5164], [251.7, -59.4711], [251.8, -59.4259], [251.9, -59.3808], [252, -59.3359], [252.1, -59.291], [252.2, -59.2462], [252.3, -59.2015], [252.4, -59.1568], [252.5, -59.1123], [252.6, -59.0678], [252.7, -59.0234], [252.8, -58.979], [252.9, -58.9347], [253, -58.8905], [253.1, -58.8463], [253.2, -58.8022], [253.3, -58.7581], [253.4, -58.714], [253.5, -58.67], [253.6, -58.626], [253.7, -58.582], [253.8, -58.538], [253.9, -58.494], [254, -58.4501], [254.1, -58.4061], [254.2, -58.3621], [254.3, -58.3181], [254.4, -58.2741], [254.5, -58.23], [254.6, -58.1859], [254.7, -58.1417], [254.8, -58.0975], [254.9, -58.0533], [255, -58.0089], [255.1, -57.9645], [255.2, -57.92], [255.3, -57.8754], [255.4, -57.8307], [255.5, -57.7859], [255.6, -57.741], [255.7, -57.6959], [255.8, -57.6507], [255.9, -57.6054], [256, -57.5598], [256.1, -57.5141], [256.2, -57.4683], [256.3, -57.4222], [256.4, -57.3759], [256.5, -57.3294], [256.6, -57.2826], [256.7, -57.2356], [256.8, -57.1883], [256.9, -57.1408], [257, -57.0929], [257.1, -57.0447], [257.2, -56.9962], [257.3, -56.9474], [257.4, -56.8982], [257.5, -56.8486], [257.6, -56.7986], [257.7, -56.7481], [257.8, -56.6972], [257.9, -56.6459], [258, -56.594], [258.1, -56.5416], [258.2, -56.4887], [258.3, -56.4352], [258.4, -56.3811], [258.5, -56.3263], [258.6, -56.2709], [258.7, -56.2147], [258.8, -56.1578], [258.9, -56.1002], [259, -56.0417], [259.1, -55.9823], [259.2, -55.922], [259.3, -55.8607], [259.4, -55.7985], [259.5, -55.7351], [259.6, -55.6706], [259.7, -55.6049], [259.8, -55.538], [259.9, -55.4697], [260, -55.4], [260.1, -55.3287], [260.2, -55.2559], [260.3, -55.1814], [260.4, -55.1051], [260.5, -55.0268], [260.6, -54.9465], [260.7, -54.864], [260.8, -54.7792], [260.9, -54.6919], [261, -54.6019], [261.1, -54.509], [261.2, -54.4131], [261.3, -54.3138], [261.4, -54.2109], [261.5, -54.104], [261.6, -53.993], [261.7, -53.8773], [261.8, -53.7566], [261.9, -53.6303], [262, -53.4979], [262.1, -53.3589], [262.2, -53.2124], [262.3, -53.0576], [262.4, -52.8935], [262.5, -52.7189], [262.6, -52.5324], [262.7, -52.3324], [262.8, -52.1167], [262.9, -51.8828], [263, -51.6275], [263.1, -51.3466], [263.2, -51.0346], [263.3, -50.6845], [263.4, -50.2859], [263.5, -49.8244], [263.6, -49.2778], [263.7, -48.6102], [263.8, -47.7572], [263.9, -46.5871], [264, -44.7576], [264.1, -40.8236], [264.2, -68], [264.3, -67.961], [264.4, -67.9211], [264.5, -67.8804], [264.6, -67.8388], [264.7, -67.7965], [264.8, -67.7533], [264.9, -67.7094], [265, -67.6647], [265.1, -67.6194], [265.2, -67.5733], [265.3, -67.5266], [265.4, -67.4792], [265.5, -67.4311], [265.6, -67.3825], [265.7, -67.3332], [265.8, -67.2834], [265.9, -67.233], [266, -67.1821], [266.1, -67.1307], [266.2, -67.0787], [266.3, -67.0263], [266.4, -66.9734], [266.5, -66.9201], [266.6, -66.8663], [266.7, -66.8122], [266.8, -66.7576], [266.9, -66.7026], [267, -66.6473], [267.1, -66.5917], [267.2, -66.5357], [267.3, -66.4793], [267.4, -66.4227], [267.5, -66.3658], [267.6, -66.3086], [267.7, -66.2512], [267.8, -66.1935], [267.9, -66.1355], [268, -66.0774], [268.1, -66.019], [268.2, -65.9605], [268.3, -65.9017], [268.4, -65.8428], [268.5, -65.7837], [268.6, -65.7245], [268.7, -65.6652], [268.8, -65.6057], [268.9, -65.5461], [269, -65.4864], [269.1, -65.4266], [269.2, -65.3668], [269.3, -65.3068], [269.4, -65.2468], [269.5, -65.1868], [269.6, -65.1267], [269.7, -65.0665], [269.8, -65.0064], [269.9, -64.9462], [270, -64.886], [270.1, -64.8258], [270.2, -64.7657], [270.3, -64.7055], [270.4, -64.6454], [270.5, -64.5853], [270.6, -64.5252], [270.7, -64.4652], [270.8, -64.4052], [270.9, -64.3453], [271, -64.2854], [271.1, -64.2257], [271.2, -64.166], [271.3, -64.1063], [271.4, -64.0468], [271.5, -63.9874], [271.6, -63.928], [271.7, -63.8688], [271.8, -63.8097], [271.9, -63.7507], [272, -63.6918], [272.1, -63.633], [272.2, -63.5744], [272.3, -63.5159], [272.4, -63.4575], [272.5, -63.3993], [272.6, -63.3412], [272.7, -63.2832], [272.8, -63.2255], [272.9, -63.1678], [273, -63.1103], [273.1, -63.053], [273.2, -62.9959], [273.3, -62.9389], [273.4, -62.882], [273.5, -62.8254], [273.6, -62.7689], [273.7, -62.7126], [273.8, -62.6564], [273.9, -62.6005], [274, -62.5447], [274.1, -62.4891], [274.2, -62.4337], [274.3, -62.3785], [274.4, -62.3234], [274.5, -62.2686], [274.6, -62.2139], [274.7, -62.1594], [274.8, -62.1051], [274.9, -62.0511], [275, -61.9971], [275.1, -61.9434], [275.2, -61.8899], [275.3, -61.8366], [275.4, -61.7834], [275.5, -61.7305], [275.6, -61.6778], [275.7, -61.6252], [275.8, -61.5728], [275.9, -61.5207], [276, -61.4687], [276.1, -61.4169], [276.2, -61.3653], [276.3, -61.3139], [276.4, -61.2627], [276.5, -61.2116], [276.6, -61.1608], [276.7, -61.1101], [276.8, -61.0597], [276.9, -61.0094], [277, -60.9593], [277.1, -60.9094], [277.2, -60.8596], [277.3, -60.8101], [277.4, -60.7607], [277.5, -60.7115], [277.6, -60.6625], [277.7, -60.6136], [277.8, -60.565], [277.9, -60.5165], [278, -60.4681], [278.1, -60.4199], [278.2, -60.3719], [278.3, -60.3241], [278.4, -60.2764], [278.5, -60.2289], [278.6, -60.1815], [278.7, -60.1343], [278.8, -60.0872], [278.9, -60.0403], [279, -59.9935], [279.1, -59.9469], [279.2, -59.9004], [279.3, -59.854], [279.4, -59.8078], [279.5, -59.7617], [279.6, -59.7157], [279.7, -59.6698], [279.8, -59.6241], [279.9, -59.5785], [280, -59.533], [280.1, -59.4876], [280.2, -59.4423], [280.3, -59.3972], [280.4, -59.3521], [280.5, -59.3071], [280.6, -59.2622], [280.7, -59.2174], [280.8, -59.1727], [280.9, -59.1281], [281, -59.0835], [281.1, -59.039], [281.2, -58.9946], [281.3, -58.9502], [281.4, -58.9059], [281.5, -58.8617], [281.6, -58.8175], [281.7, -58.7733], [281.8, -58.7292], [281.9, -58.6851], [282, -58.641], [282.1, -58.5969], [282.2, -58.5529], [282.3, -58.5089], [282.4, -58.4649], [282.5, -58.4208], [282.6, -58.3768], [282.7, -58.3328], [282.8, -58.2887], [282.9, -58.2446], [283, -58.2004], [283.1, -58.1563], [283.2, -58.112], [283.3, -58.0677], [283.4, -58.0234], [283.5, -57.9789], [283.6, -57.9344], [283.7, -57.8898], [283.8, -57.8451], [283.9, -57.8003], [284, -57.7553], [284.1, -57.7103], [284.2, -57.6651], [284.3, -57.6197], [284.4, -57.5742], [284.5, -57.5285], [284.6, -57.4826], [284.7, -57.4366], [284.8, -57.3903], [284.9, -57.3438], [285, -57.2971], [285.1, -57.2501], [285.2, -57.2029], [285.3, -57.1553], [285.4, -57.1075], [285.5, -57.0594], [285.6, -57.011], [285.7, -56.9622], [285.8, -56.913], [285.9, -56.8635], [286, -56.8136], [286.1, -56.7632], [286.2, -56.7124], [286.3, -56.6612], [286.4, -56.6094], [286.5, -56.5572], [286.6, -56.5044], [286.7, -56.451], [286.8, -56.397], [286.9, -56.3424], [287, -56.2871], [287.1, -56.2311], [287.2, -56.1744], [287.3, -56.1169], [287.4, -56.0586], [287.5, -55.9995], [287.6, -55.9394], [287.7, -55.8784], [287.8, -55.8164], [287.9, -55.7533], [288, -55.6891], [288.1, -55.6237], [288.2, -55.5571], [288.3, -55.4891], [288.4, -55.4198], [288.5, -55.349], [288.6, -55.2765], [288.7, -55.2025], [288.8, -55.1266], [288.9, -55.0489], [289, -54.9691], [289.1, -54.8872], [289.2, -54.8031], [289.3, -54.7164], [289.4, -54.6271], [289.5, -54.5351], [289.6, -54.4399], [289.7, -54.3415], [289.8, -54.2396], [289.9, -54.1339], [290, -54.024], [290.1, -53.9096], [290.2, -53.7902], [290.3, -53.6655], [290.4, -53.5348], [290.5, -53.3976], [290.6, -53.2532], [290.7, -53.1007], [290.8, -52.9393], [290.9, -52.7676], [291, -52.5845], [291.1, -52.3884], [291.2, -52.1771], [291.3, -51.9484], [291.4, -51.6993], [291.5, -51.4257], [291.6, -51.1228], [291.7, -50.7839], [291.8, -50.3997], [291.9, -49.957], [292, -49.4363], [292.1, -48.8063], [292.2, -48.0126], [292.3, -46.9487], [292.4, -45.3589], [292.5, -42.3392], [292.6, -68], [292.7, -67.9603], [292.8, -67.9197], [292.9, -67.8783], [293, -67.8361], [293.1, -67.793], [293.2, -67.7492], [293.3, -67.7047], [293.4, -67.6594], [293.5, -67.6135], [293.6, -67.5668], [293.7, -67.5195], [293.8, -67.4715], [293.9, -67.4229], [294, -67.3737], [294.1, -67.3239], [294.2, -67.2736], [294.3, -67.2227], [294.4, -67.1713], [294.5, -67.1194], [294.6, -67.0669], [294.7, -67.0141], [294.8, -66.9607], [294.9, -66.9069], [295, -66.8528], [295.1, -66.7982], [295.2, -66.7432], [295.3, -66.6878], [295.4, -66.6321], [295.5, -66.576], [295.6, -66.5197], [295.7, -66.463], [295.8, -66.406], [295.9, -66.3487], [296, -66.2912], [296.1, -66.2334], [296.2, -66.1754], [296.3, -66.1172], [296.4, -66.0587], [296.5, -66.0001], [296.6, -65.9412], [296.7, -65.8822], [296.8, -65.823], [296.9, -65.7637], [297, -65.7042], [297.1, -65.6446], [297.2, -65.5849], [297.3, -65.5251], [297.4, -65.4651], [297.5, -65.4051], [297.6, -65.3451], [297.7, -65.2849], [297.8, -65.2247], [297.9, -65.1645], [298, -65.1042], [298.1, -65.0439], [298.2, -64.9835], [298.3, -64.9232], [298.4, -64.8629], [298.5, -64.8025], [298.6, -64.7422], [298.7, -64.6819], [298.8, -64.6216], [298.9, -64.5614], [299, -64.5012], [299.1, -64.441], [299.2, -64.381], [299.3, -64.3209], [299.4, -64.261], [299.5, -64.2011], [299.6, -64.1413], [299.7, -64.0816], [299.8, -64.022], [299.9, -63.9625], [300, -63.903], [300.1, -63.8437], [300.2, -63.7845], [300.3, -63.7255], [300.4, -63.6665], [300.5, -63.6077], [300.6, -63.549], [300.7, -63.4904], [300.8, -63.432], [300.9, -63.3737], [301, -63.3156], [301.1, -63.2576], [301.2, -63.1998], [301.3, -63.1421], [301.4, -63.0846], [301.5, -63.0273], [301.6, -62.9701], [301.7, -62.9131], [301.8, -62.8562], [301.9, -62.7995], [302, -62.743], [302.1, -62.6867], [302.2, -62.6306], [302.3, -62.5746], [302.4, -62.5188], [302.5, -62.4632], [302.6, -62.4078], [302.7, -62.3526], [302.8, -62.2976], [302.9, -62.2427], [303, -62.1881], [303.1, -62.1336], [303.2, -62.0793], [303.3, -62.0252], [303.4, -61.9713], [303.5, -61.9176], [303.6, -61.8641], [303.7, -61.8108], [303.8, -61.7577], [303.9, -61.7048], [304, -61.652], [304.1, -61.5995], [304.2, -61.5472], [304.3, -61.495], [304.4, -61.443], [304.5, -61.3913], [304.6, -61.3397], [304.7, -61.2883], [304.8, -61.2371], [304.9, -61.1861], [305, -61.1353], [305.1, -61.0847], [305.2, -61.0342], [305.3, -60.984], [305.4, -60.9339], [305.5, -60.884], [305.6, -60.8343], [305.7, -60.7848], [305.8, -60.7355], [305.9, -60.6863], [306, -60.6373], [306.1, -60.5885], [306.2, -60.5398], [306.3, -60.4913], [306.4, -60.443], [306.5, -60.3949], [306.6, -60.3469], [306.7, -60.2991], [306.8, -60.2514], [306.9, -60.2039], [307, -60.1566], [307.1, -60.1094], [307.2, -60.0623], [307.3, -60.0154], [307.4, -59.9686], [307.5, -59.922], [307.6, -59.8755], [307.7, -59.8292], [307.8, -59.783], [307.9, -59.7369], [308, -59.6909], [308.1, -59.6451], [308.2, -59.5994], [308.3, -59.5538], [308.4, -59.5083], [308.5, -59.4629], [308.6, -59.4177], [308.7, -59.3725], [308.8, -59.3274], [308.9, -59.2824], [309, -59.2375], [309.1, -59.1927], [309.2, -59.148], [309.3, -59.1034], [309.4, -59.0588], [309.5, -59.0143], [309.6, -58.9699], [309.7, -58.9255], [309.8, -58.8812], [309.9, -58.8369], [310, -58.7927], [310.1, -58.7485], [310.2, -58.7043], [310.3, -58.6602], [310.4, -58.6161], [310.5, -58.572], [310.6, -58.5279], [310.7, -58.4839], [310.8, -58.4398], [310.9, -58.3957], [311, -58.3516], [311.1, -58.3075], [311.2, -58.2634], [311.3, -58.2192], [311.4, -58.175], [311.5, -58.1307], [311.6, -58.0864], [311.7, -58.0421], [311.8, -57.9976], [311.9, -57.9531], [312, -57.9085], [312.1, -57.8638], [312.2, -57.819], [312.3, -57.774], [312.4, -57.729], [312.5, -57.6838], [312.6, -57.6384], [312.7, -57.593], [312.8, -57.5473], [312.9, -57.5015], [313, -57.4554], [313.1, -57.4092], [313.2, -57.3628], [313.3, -57.3161], [313.4, -57.2692], [313.5, -57.222], [313.6, -57.1746], [313.7, -57.1268], [313.8, -57.0788], [313.9, -57.0305], [314, -56.9818], [314.1, -56.9327], [314.2, -56.8833], [314.3, -56.8335], [314.4, -56.7833], [314.5, -56.7327], [314.6, -56.6816], [314.7, -56.63], [314.8, -56.5779], [314.9, -56.5252], [315, -56.472], [315.1, -56.4183], [315.2, -56.3639], [315.3, -56.3088], [315.4, -56.2531], [315.5, -56.1966], [315.6, -56.1394], [315.7, -56.0814], [315.8, -56.0225], [315.9, -55.9628], [316, -55.9021], [316.1, -55.8405], [316.2, -55.7778], [316.3, -55.714], [316.4, -55.649], [316.5, -55.5828], [316.6, -55.5154], [316.7, -55.4465], [316.8, -55.3762], [316.9, -55.3044], [317, -55.2309], [317.1, -55.1558], [317.2, -55.0787], [317.3, -54.9997], [317.4, -54.9186], [317.5, -54.8353], [317.6, -54.7496], [317.7, -54.6613], [317.8, -54.5702], [317.9, -54.4763], [318, -54.3791], [318.1, -54.2785], [318.2, -54.1742], [318.3, -54.0659], [318.4, -53.9532], [318.5, -53.8357], [318.6, -53.713], [318.7, -53.5847], [318.8, -53.45], [318.9, -53.3083], [319, -53.1589], [319.1, -53.0009], [319.2, -52.8332], [319.3, -52.6545], [319.4, -52.4634], [319.5, -52.2581], [319.6, -52.0362], [319.7, -51.7951], [319.8, -51.5311], [319.9, -51.2399], [320, -50.9153], [320.1, -50.5492], [320.2, -50.1303], [320.3, -49.6416], [320.4, -49.0571], [320.5, -48.3331], [320.6, -47.3884], [320.7, -46.0441], [320.8, -43.7727], [320.9, -37.4499], [321, -68], [321.1, -67.9625], [321.2, -67.9241], [321.3, -67.8849], [321.4, -67.8447], [321.5, -67.8038], [321.6, -67.762], [321.7, -67.7194], [321.8, -67.6761], [321.9, -67.632], [322, -67.5872], [322.1, -67.5417], [322.2, -67.4955], [322.3, -67.4487], [322.4, -67.4012], [322.5, -67.3531], [322.6, -67.3044], [322.7, -67.2551], [322.8, -67.2053], [322.9, -67.1549], [323, -67.104], [323.1, -67.0525], [323.2, -67.0006], [323.3, -66.9482], [323.4, -66.8954], [323.5, -66.8422], [323.6, -66.7885], [323.7, -66.7344], [323.8, -66.6799], [323.9, -66.6251], [324, -66.5699], [324.1, -66.5143], [324.2, -66.4585], [324.3, -66.4023], [324.4, -66.3458], [324.5, -66.2891], [324.6, -66.2321], [324.7, -66.1748], [324.8, -66.1173], [324.9, -66.0596], [325, -66.0016], [325.1, -65.9435], [325.2, -65.8851], [325.3, -65.8266], [325.4, -65.768], [325.5, -65.7092], [325.6, -65.6502], [325.7, -65.5911], [325.8, -65.5319], [325.9, -65.4726], [326, -65.4132], [326.1, -65.3537], [326.2, -65.2941], [326.3, -65.2344], [326.4, -65.1747], [326.5, -65.115], [326.6, -65.0552], [326.7, -64.9954], [326.8, -64.9355], [326.9, -64.8757], [327, -64.8158], [327.1, -64.756], [327.2, -64.6961], [327.3, -64.6363], [327.4, -64.5765], [327.5, -64.5167], [327.6, -64.457], [327.7, -64.3973], [327.8, -64.3377], [327.9, -64.2781], [328, -64.2187], [328.1, -64.1592], [328.2, -64.0999], [328.3, -64.0406], [328.4, -63.9815], [328.5, -63.9224], [328.6, -63.8634], [328.7, -63.8046], [328.8, -63.7458], [328.9, -63.6872], [329, -63.6286], [329.1, -63.5702], [329.2, -63.512], [329.3, -63.4538], [329.4, -63.3958], [329.5, -63.338], [329.6, -63.2803], [329.7, -63.2227], [329.8, -63.1653], [329.9, -63.108], [330, -63.0509], [330.1, -62.9939], [330.2, -62.9371], [330.3, -62.8805], [330.4, -62.8241], [330.5, -62.7678], [330.6, -62.7117], [330.7, -62.6557], [330.8, -62.5999], [330.9, -62.5444], [331, -62.4889], [331.1, -62.4337], [331.2, -62.3787], [331.3, -62.3238], [331.4, -62.2691], [331.5, -62.2146], [331.6, -62.1603], [331.7, -62.1062], [331.8, -62.0522], [331.9, -61.9985], [332, -61.9449], [332.1, -61.8916], [332.2, -61.8384], [332.3, -61.7854], [332.4, -61.7326], [332.5, -61.68], [332.6, -61.6276], [332.7, -61.5754], [332.8, -61.5233], [332.9, -61.4715], [333, -61.4198], [333.1, -61.3684], [333.2, -61.3171], [333.3, -61.266], [333.4, -61.2151], [333.5, -61.1644], [333.6, -61.1139], [333.7, -61.0635], [333.8, -61.0133], [333.9, -60.9634], [334, -60.9136], [334.1, -60.864], [334.2, -60.8145], [334.3, -60.7653], [334.4, -60.7162], [334.5, -60.6673], [334.6, -60.6185], [334.7, -60.5699], [334.8, -60.5215], [334.9, -60.4733], [335, -60.4252], [335.1, -60.3773], [335.2, -60.3296], [335.3, -60.282], [335.4, -60.2346], [335.5, -60.1873], [335.6, -60.1402], [335.7, -60.0932], [335.8, -60.0464], [335.9, -59.9997], [336, -59.9531], [336.1, -59.9067], [336.2, -59.8605], [336.3, -59.8143], [336.4, -59.7683], [336.5, -59.7224], [336.6, -59.6767], [336.7, -59.631], [336.8, -59.5855], [336.9, -59.5401], [337, -59.4948], [337.1, -59.4496], [337.2, -59.4045], [337.3, -59.3595], [337.4, -59.3146], [337.5, -59.2698], [337.6, -59.2251], [337.7, -59.1805], [337.8, -59.1359], [337.9, -59.0915], [338, -59.0471], [338.1, -59.0027], [338.2, -58.9584], [338.3, -58.9142], [338.4, -58.8701], [338.5, -58.8259], [338.6, -58.7819], [338.7, -58.7378], [338.8, -58.6938], [338.9, -58.6498], [339, -58.6059], [339.1, -58.5619], [339.2, -58.518], [339.3, -58.4741], [339.4, -58.4301], [339.5, -58.3862], [339.6, -58.3422], [339.7, -58.2983], [339.8, -58.2543], [339.9, -58.2102], [340, -58.1661], [340.1, -58.122], [340.2, -58.0778], [340.3, -58.0336], [340.4, -57.9892], [340.5, -57.9448], [340.6, -57.9003], [340.7, -57.8557], [340.8, -57.811], [340.9, -57.7662], [341, -57.7212], [341.1, -57.6761], [341.2, -57.6309], [341.3, -57.5855], [341.4, -57.54], [341.5, -57.4942], [341.6, -57.4483], [341.7, -57.4022], [341.8, -57.3558], [341.9, -57.3092], [342, -57.2624], [342.1, -57.2153], [342.2, -57.1679], [342.3, -57.1203], [342.4, -57.0723], [342.5, -57.0241], [342.6, -56.9755], [342.7, -56.9265], [342.8, -56.8772], [342.9, -56.8274], [343, -56.7773], [343.1, -56.7267], [343.2, -56.6756], [343.3, -56.6241], [343.4, -56.5721], [343.5, -56.5195], [343.6, -56.4663], [343.7, -56.4126], [343.8, -56.3583], [343.9, -56.3033], [344, -56.2476], [344.1, -56.1911], [344.2, -56.134], [344.3, -56.076], [344.4, -56.0172], [344.5, -55.9574], [344.6, -55.8968], [344.7, -55.8352], [344.8, -55.7725], [344.9, -55.7087], [345, -55.6437], [345.1, -55.5776], [345.2, -55.5101], [345.3, -55.4413], [345.4, -55.371], [345.5, -55.2991], [345.6, -55.2257], [345.7, -55.1504], [345.8, -55.0734], [345.9, -54.9943], [346, -54.9132], [346.1, -54.8298], [346.2, -54.744], [346.3, -54.6557], [346.4, -54.5646], [346.5, -54.4705], [346.6, -54.3732], [346.7, -54.2725], [346.8, -54.1681], [346.9, -54.0597], [347, -53.9468], [347.1, -53.8292], [347.2, -53.7063], [347.3, -53.5777], [347.4, -53.4427], [347.5, -53.3008], [347.6, -53.1511], [347.7, -52.9927], [347.8, -52.8245], [347.9, -52.6454], [348, -52.4537], [348.1, -52.2477], [348.2, -52.0251], [348.3, -51.783], [348.4, -51.518], [348.5, -51.2254], [348.6, -50.8991], [348.7, -50.531], [348.8, -50.1093], [348.9, -49.6169], [349, -49.0272], [349.1, -48.2953], [349.2, -47.3374], [349.3, -45.9669], [349.4, -43.6234], [349.5, -36.7902], [349.6, -68], [349.7, -67.963], [349.8, -67.925], [349.9, -67.8862], [350, -67.8465], [350.1, -67.8059], [350.2, -67.7646], [350.3, -67.7224], [350.4, -67.6795], [350.5, -67.6358], [350.6, -67.5913], [350.7, -67.5462], [350.8, -67.5004], [350.9, -67.4539], [351, -67.4067], [351.1, -67.359], [351.2, -67.3106], [351.3, -67.2616], [351.4, -67.2121], [351.5, -67.162], [351.6, -67.1114], [351.7, -67.0603], [351.8, -67.0087], [351.9, -66.9566], [352, -66.904], [352.1, -66.851], [352.2, -66.7976], [352.3, -66.7438], [352.4, -66.6896], [352.5, -66.635], [352.6, -66.58], [352.7, -66.5247], [352.8, -66.469], [352.9, -66.4131], [353, -66.3568], [353.1, -66.3003], [353.2, -66.2435], [353.3, -66.1864], [353.4, -66.1291], [353.5, -66.0716], [353.6, -66.0138], [353.7, -65.9558], [353.8, -65.8977], [353.9, -65.8393], [354, -65.7808], [354.1, -65.7222], [354.2, -65.6634], [354.3, -65.6044], [354.4, -65.5453], [354.5, -65.4862], [354.6, -65.4269], [354.7, -65.3675], [354.8, -65.3081], [354.9, -65.2485], [355, -65.189], [355.1, -65.1293], [355.2, -65.0696], [355.3, -65.0099], [355.4, -64.9502], [355.5, -64.8904], [355.6, -64.8307], [355.7, -64.7709], [355.8, -64.7111], [355.9, -64.6514], [356, -64.5917], [356.1, -64.532], [356.2, -64.4723], [356.3, -64.4127], [356.4, -64.3532], [356.5, -64.2937], [356.6, -64.2342], [356.7, -64.1749], [356.8, -64.1156], [356.9, -64.0564], [357, -63.9973], [357.1, -63.9382], [357.2, -63.8793], [357.3, -63.8205], [357.4, -63.7618], [357.5, -63.7032], [357.6, -63.6447], [357.7, -63.5863], [357.8, -63.5281], [357.9, -63.47], [358, -63.412], [358.1, -63.3542], [358.2, -63.2965], [358.3, -63.2389], [358.4, -63.1815], [358.5, -63.1243], [358.6, -63.0672], [358.7, -63.0102], [358.8, -62.9535], [358.9, -62.8968], [359, -62.8404], [359.1, -62.7841], [359.2, -62.728], [359.3, -62.6721], [359.4, -62.6163], [359.5, -62.5607], [359.6, -62.5053], [359.7, -62.45], [359.8, -62.395], [359.9, -62.3401], [360, -62.2854], [360.1, -62.2309], [360.2, -62.1766], [360.3, -62.1225], [360.4, -62.0685], [360.5, -62.0148], [360.6, -61.9612], [360.7, -61.9078], [360.8, -61.8546], [360.9, -61.8016], [361, -61.7488], [361.1, -61.6962], [361.2, -61.6438], [361.3, -61.5915], [361.4, -61.5395], [361.5, -61.4876], [361.6, -61.4359], [361.7, -61.3845], [361.8, -61.3332], [361.9, -61.2821], [362, -61.2311], [362.1, -61.1804], [362.2, -61.1299], [362.3, -61.0795], [362.4, -61.0293], [362.5, -60.9793], [362.6, -60.9295], [362.7, -60.8799], [362.8, -60.8304], [362.9, -60.7811], [363, -60.732], [363.1, -60.6831], [363.2, -60.6343], [363.3, -60.5857], [363.4, -60.5373], [363.5, -60.4891], [363.6, -60.441], [363.7, -60.393], [363.8, -60.3453], [363.9, -60.2977], [364, -60.2502], [364.1, -60.2029], [364.2, -60.1558], [364.3, -60.1088], [364.4, -60.0619], [364.5, -60.0152], [364.6, -59.9687], [364.7, -59.9223], [364.8, -59.876], [364.9, -59.8298], [365, -59.7838], [365.1, -59.7379], [365.2, -59.6921], [365.3, -59.6465], [365.4, -59.601], [365.5, -59.5556], [365.6, -59.5103], [365.7, -59.4651], [365.8, -59.42], [365.9, -59.375], [366, -59.3301], [366.1, -59.2853], [366.2, -59.2406], [366.3, -59.1959], [366.4, -59.1514], [366.5, -59.1069], [366.6, -59.0625], [366.7, -59.0182], [366.8, -58.9739], [366.9, -58.9297], [367, -58.8855], [367.1, -58.8414], [367.2, -58.7974], [367.3, -58.7533], [367.4, -58.7093], [367.5, -58.6654], [367.6, -58.6214], [367.7, -58.5775], [367.8, -58.5336], [367.9, -58.4897], [368, -58.4458], [368.1, -58.4019], [368.2, -58.358], [368.3, -58.314], [368.4, -58.2701], [368.5, -58.2261], [368.6, -58.182], [368.7, -58.1379], [368.8, -58.0938], [368.9, -58.0496], [369, -58.0053], [369.1, -57.9609], [369.2, -57.9165], [369.3, -57.872], [369.4, -57.8273], [369.5, -57.7826], [369.6, -57.7377], [369.7, -57.6927], [369.8, -57.6475], [369.9, -57.6022], [370, -57.5567], [370.1, -57.5111], [370.2, -57.4653], [370.3, -57.4192], [370.4, -57.373], [370.5, -57.3265], [370.6, -57.2798], [370.7, -57.2328], [370.8, -57.1856], [370.9, -57.1381], [371, -57.0903], [371.1, -57.0421], [371.2, -56.9937], [371.3, -56.9449], [371.4, -56.8957], [371.5, -56.8461], [371.6, -56.7962], [371.7, -56.7458], [371.8, -56.6949], [371.9, -56.6436], [372, -56.5918], [372.1, -56.5394], [372.2, -56.4865], [372.3, -56.433], [372.4, -56.3789], [372.5, -56.3242], [372.6, -56.2688], [372.7, -56.2127], [372.8, -56.1558], [372.9, -56.0982], [373, -56.0397], [373.1, -55.9803], [373.2, -55.9201], [373.3, -55.8588], [373.4, -55.7966], [373.5, -55.7332], [373.6, -55.6688], [373.7, -55.6031], [373.8, -55.5362], [373.9, -55.4679], [374, -55.3982], [374.1, -55.327], [374.2, -55.2542], [374.3, -55.1796], [374.4, -55.1033], [374.5, -55.0251], [374.6, -54.9448], [374.7, -54.8623], [374.8, -54.7775], [374.9, -54.6902], [375, -54.6002], [375.1, -54.5073], [375.2, -54.4113], [375.3, -54.312], [375.4, -54.2091], [375.5, -54.1022], [375.6, -53.9911], [375.7, -53.8754], [375.8, -53.7547], [375.9, -53.6284], [376, -53.496], [376.1, -53.3568], [376.2, -53.2103], [376.3, -53.0554], [376.4, -52.8912], [376.5, -52.7165], [376.6, -52.5299], [376.7, -52.3298], [376.8, -52.1139], [376.9, -51.8798], [377, -51.6242], [377.1, -51.343], [377.2, -51.0307], [377.3, -50.6801], [377.4, -50.2809], [377.5, -49.8186], [377.6, -49.2709], [377.7, -48.6016], [377.8, -47.746], [377.9, -46.5711], [378, -44.73], [378.1, -40.7466], [378.2, -68], [378.3, -67.9611], [378.4, -67.9213], [378.5, -67.8806], [378.6, -67.8391], [378.7, -67.7968], [378.8, -67.7537], [378.9, -67.7099], [379, -67.6653], [379.1, -67.62], [379.2, -67.574], [379.3, -67.5273], [379.4, -67.4799], [379.5, -67.4319], [379.6, -67.3834], [379.7, -67.3342], [379.8, -67.2844], [379.9, -67.2341], [380, -67.1832], [380.1, -67.1318], [380.2, -67.0799], [380.3, -67.0276], [380.4, -66.9747], [380.5, -66.9214], [380.6, -66.8677], [380.7, -66.8136], [380.8, -66.7591], [380.9, -66.7042], [381, -66.6489], [381.1, -66.5932], [381.2, -66.5373], [381.3, -66.481], [381.4, -66.4244], [381.5, -66.3675], [381.6, -66.3104], [381.7, -66.253], [381.8, -66.1953], [381.9, -66.1374], [382, -66.0793], [382.1, -66.0209], [382.2, -65.9624], [382.3, -65.9037], [382.4, -65.8448], [382.5, -65.7858], [382.6, -65.7266], [382.7, -65.6673], [382.8, -65.6078], [382.9, -65.5482], [383, -65.4886], [383.1, -65.4288], [383.2, -65.369], [383.3, -65.309], [383.4, -65.2491], [383.5, -65.189], [383.6, -65.1289], [383.7, -65.0688], [383.8, -65.0087], [383.9, -64.9485], [384, -64.8884], [384.1, -64.8282], [384.2, -64.768], [384.3, -64.7079], [384.4, -64.6478], [384.5, -64.5877], [384.6, -64.5276], [384.7, -64.4676], [384.8, -64.4077], [384.9, -64.3478], [385, -64.2879], [385.1, -64.2282], [385.2, -64.1685], [385.3, -64.1089], [385.4, -64.0493], [385.5, -63.9899], [385.6, -63.9306], [385.7, -63.8714], [385.8, -63.8122], [385.9, -63.7532], [386, -63.6944], [386.1, -63.6356], [386.2, -63.577], [386.3, -63.5185], [386.4, -63.4601], [386.5, -63.4019], [386.6, -63.3438], [386.7, -63.2858], [386.8, -63.2281], [386.9, -63.1704], [387, -63.1129], [387.1, -63.0556], [387.2, -62.9985], [387.3, -62.9415], [387.4, -62.8846], [387.5, -62.828], [387.6, -62.7715], [387.7, -62.7152], [387.8, -62.6591], [387.9, -62.6031], [388, -62.5473], [388.1, -62.4917], [388.2, -62.4363], [388.3, -62.3811], [388.4, -62.3261], [388.5, -62.2712], [388.6, -62.2165], [388.7, -62.1621], [388.8, -62.1078], [388.9, -62.0537], [389, -61.9998], [389.1, -61.946], [389.2, -61.8925], [389.3, -61.8392], [389.4, -61.7861], [389.5, -61.7331], [389.6, -61.6804], [389.7, -61.6278], [389.8, -61.5754], [389.9, -61.5232], [390, -61.4713], [390.1, -61.4195], [390.2, -61.3679], [390.3, -61.3165], [390.4, -61.2652], [390.5, -61.2142], [390.6, -61.1634], [390.7, -61.1127], [390.8, -61.0622], [390.9, -61.012], [391, -60.9619], [391.1, -60.9119], [391.2, -60.8622], [391.3, -60.8126], [391.4, -60.7633], [391.5, -60.7141], [391.6, -60.665], [391.7, -60.6162], [391.8, -60.5675], [391.9, -60.519], [392, -60.4707], [392.1, -60.4225], [392.2, -60.3745], [392.3, -60.3266], [392.4, -60.2789], [392.5, -60.2314], [392.6, -60.184], [392.7, -60.1368], [392.8, -60.0897], [392.9, -60.0428], [393, -59.996], [393.1, -59.9494], [393.2, -59.9029], [393.3, -59.8565], [393.4, -59.8103], [393.5, -59.7642], [393.6, -59.7182], [393.7, -59.6723], [393.8, -59.6266], [393.9, -59.581], [394, -59.5355], [394.1, -59.4901], [394.2, -59.4448], [394.3, -59.3997], [394.4, -59.3546], [394.5, -59.3096], [394.6, -59.2647], [394.7, -59.2199], [394.8, -59.1752], [394.9, -59.1306], [395, -59.086], [395.1, -59.0415], [395.2, -58.9971], [395.3, -58.9527], [395.4, -58.9084], [395.5, -58.8642], [395.6, -58.82], [395.7, -58.7758], [395.8, -58.7317], [395.9, -58.6876], [396, -58.6435], [396.1, -58.5995], [396.2, -58.5554], [396.3, -58.5114], [396.4, -58.4674], [396.5, -58.4234], [396.6, -58.3793], [396.7, -58.3353], [396.8, -58.2912], [396.9, -58.2471], [397, -58.203], [397.1, -58.1588], [397.2, -58.1146], [397.3, -58.0703], [397.4, -58.026], [397.5, -57.9815], [397.6, -57.937], [397.7, -57.8924], [397.8, -57.8477], [397.9, -57.8029], [398, -57.758], [398.1, -57.7129], [398.2, -57.6677], [398.3, -57.6224], [398.4, -57.5769], [398.5, -57.5312], [398.6, -57.4854], [398.7, -57.4393], [398.8, -57.3931], [398.9, -57.3466], [399, -57.2999], [399.1, -57.2529], [399.2, -57.2057], [399.3, -57.1582], [399.4, -57.1104], [399.5, -57.0623], [399.6, -57.0139], [399.7, -56.9652], [399.8, -56.916], [399.9, -56.8665], [400, -56.8166], [400.1, -56.7663], [400.2, -56.7156], [400.3, -56.6643], [400.4, -56.6126], [400.5, -56.5604], [400.6, -56.5076], [400.7, -56.4543], [400.8, -56.4003], [400.9, -56.3458], [401, -56.2905], [401.1, -56.2346], [401.2, -56.1779], [401.3, -56.1205], [401.4, -56.0622], [401.5, -56.0031], [401.6, -55.9431], [401.7, -55.8822], [401.8, -55.8202], [401.9, -55.7572], [402, -55.6931], [402.1, -55.6278], [402.2, -55.5613], [402.3, -55.4934], [402.4, -55.4241], [402.5, -55.3534], [402.6, -55.2811], [402.7, -55.2071], [402.8, -55.1314], [402.9, -55.0538], [403, -54.9742], [403.1, -54.8924], [403.2, -54.8084], [403.3, -54.7219], [403.4, -54.6328], [403.5, -54.5409], [403.6, -54.446], [403.7, -54.3478], [403.8, -54.2461], [403.9, -54.1406], [404, -54.031], [404.1, -53.9169], [404.2, -53.7979], [404.3, -53.6735], [404.4, -53.5433], [404.5, -53.4065], [404.6, -53.2626], [404.7, -53.1106], [404.8, -52.9497], [404.9, -52.7788], [405, -52.5965], [405.1, -52.4012], [405.2, -52.191], [405.3, -51.9635], [405.4, -51.7157], [405.5, -51.4438], [405.6, -51.143], [405.7, -50.8066], [405.8, -50.4255], [405.9, -49.9871], [406, -49.4721], [406.1, -48.8502], [406.2, -48.0692], [406.3, -47.0276], [406.4, -45.4852], [406.5, -42.6233], [406.6, -30.5207], [406.7, -68], [406.8, -67.9707], [406.9, -67.9404], [407, -67.909], [407.1, -67.8766], [407.2, -67.8432], [407.3, -67.8088], [407.4, -67.7735], [407.5, -67.7373], [407.6, -67.7002], [407.7, -67.6623], [407.8, -67.6235], [407.9, -67.5839], [408, -67.5435], [408.1, -67.5023], [408.2, -67.4603], [408.3, -67.4176], [408.4, -67.3742], [408.5, -67.3301], [408.6, -67.2854], [408.7, -67.24], [408.8, -67.1939], [408.9, -67.1473], [409, -67.1], [409.1, -67.0522], [409.2, -67.0039], [409.3, -66.9549], [409.4, -66.9055], [409.5, -66.8556], [409.6, -66.8052], [409.7, -66.7543], [409.8, -66.703], [409.9, -66.6512], [410, -66.5991], [410.1, -66.5465], [410.2, -66.4935], [410.3, -66.4402], [410.4, -66.3865], [410.5, -66.3325], [410.6, -66.2782], [410.7, -66.2235], [410.8, -66.1686], [410.9, -66.1134], [411, -66.0579], [411.1, -66.0022], [411.2, -65.9462], [411.3, -65.89], [411.4, -65.8335], [411.5, -65.7769], [411.6, -65.7201], [411.7, -65.6631], [411.8, -65.6059], [411.9, -65.5486], [412, -65.4912], [412.1, -65.4336], [412.2, -65.3759], [412.3, -65.318], [412.4, -65.2601], [412.5, -65.2021], [412.6, -65.144], [412.7, -65.0858], [412.8, -65.0276], [412.9, -64.9693], [413, -64.911], [413.1, -64.8526], [413.2, -64.7942], [413.3, -64.7358], [413.4, -64.6774], [413.5, -64.619], [413.6, -64.5605], [413.7, -64.5021], [413.8, -64.4437], [413.9, -64.3854], [414, -64.327], [414.1, -64.2687], [414.2, -64.2105], [414.3, -64.1523], [414.4, -64.0942], [414.5, -64.0361], [414.6, -63.9781], [414.7, -63.9202], [414.8, -63.8623], [414.9, -63.8046], [415, -63.7469], [415.1, -63.6893], [415.2, -63.6319], [415.3, -63.5745], [415.4, -63.5173], [415.5, -63.4601], [415.6, -63.4031], [415.7, -63.3462], [415.8, -63.2895], [415.9, -63.2328], [416, -63.1763], [416.1, -63.12], [416.2, -63.0638], [416.3, -63.0077], [416.4, -62.9518], [416.5, -62.896], [416.6, -62.8404], [416.7, -62.7849], [416.8, -62.7296], [416.9, -62.6744], [417, -62.6194], [417.1, -62.5646], [417.2, -62.5099], [417.3, -62.4554], [417.4, -62.4011], [417.5, -62.3469], [417.6, -62.293], [417.7, -62.2391], [417.8, -62.1855], [417.9, -62.132], [418, -62.0788], [418.1, -62.0257], [418.2, -61.9727], [418.3, -61.92], [418.4, -61.8674], [418.5, -61.815], [418.6, -61.7628], [418.7, -61.7108], [418.8, -61.6589], [418.9, -61.6073], [419, -61.5558], [419.1, -61.5045], [419.2, -61.4534], [419.3, -61.4024], [419.4, -61.3517], [419.5, -61.3011], [419.6, -61.2507], [419.7, -61.2005], [419.8, -61.1504], [419.9, -61.1005], [420, -61.0508], [420.1, -61.0013], [420.2, -60.952], [420.3, -60.9028], [420.4, -60.8538], [420.5, -60.805], [420.6, -60.7563], [420.7, -60.7079], [420.8, -60.6595], [420.9, -60.6114], [421, -60.5634], [421.1, -60.5156], [421.2, -60.4679], [421.3, -60.4204], [421.4, -60.373], [421.5, -60.3258], [421.6, -60.2788], [421.7, -60.2319], [421.8, -60.1851], [421.9, -60.1385], [422, -60.0921], [422.1, -60.0458], [422.2, -59.9996], [422.3, -59.9535], [422.4, -59.9076], [422.5, -59.8618], [422.6, -59.8162], [422.7, -59.7707], [422.8, -59.7253], [422.9, -59.68], [423, -59.6348], [423.1, -59.5897], [423.2, -59.5448], [423.3, -59.5], [423.4, -59.4552], [423.5, -59.4106], [423.6, -59.366], [423.7, -59.3216], [423.8, -59.2772], [423.9, -59.233], [424, -59.1888], [424.1, -59.1446], [424.2, -59.1006], [424.3, -59.0566], [424.4, -59.0127], [424.5, -58.9688], [424.6, -58.925], [424.7, -58.8813], [424.8, -58.8376], [424.9, -58.7939], [425, -58.7503], [425.1, -58.7067], [425.2, -58.6631], [425.3, -58.6196], [425.4, -58.5761], [425.5, -58.5325], [425.6, -58.489], [425.7, -58.4455], [425.8, -58.402], [425.9, -58.3584], [426, -58.3149], [426.1, -58.2713], [426.2, -58.2276], [426.3, -58.184], [426.4, -58.1403], [426.5, -58.0965], [426.6, -58.0526], [426.7, -58.0087], [426.8, -57.9648], [426.9, -57.9207], [427, -57.8765], [427.1, -57.8322], [427.2, -57.7879], [427.3, -57.7434], [427.4, -57.6987], [427.5, -57.6539], [427.6, -57.609], [427.7, -57.5639], [427.8, -57.5186], [427.9, -57.4732], [428, -57.4275], [428.1, -57.3816], [428.2, -57.3356], [428.3, -57.2892], [428.4, -57.2427], [428.5, -57.1958], [428.6, -57.1487], [428.7, -57.1013], [428.8, -57.0536], [428.9, -57.0055], [429, -56.9572], [429.1, -56.9084], [429.2, -56.8593], [429.3, -56.8097], [429.4, -56.7598], [429.5, -56.7094], [429.6, -56.6585], [429.7, -56.6072], [429.8, -56.5553], [429.9, -56.5029], [430, -56.4499], [430.1, -56.3963], [430.2, -56.3421], [430.3, -56.2872], [430.4, -56.2317], [430.5, -56.1754], [430.6, -56.1183], [430.7, -56.0604], [430.8, -56.0017], [430.9, -55.9421], [431, -55.8815], [431.1, -55.82], [431.2, -55.7573], [431.3, -55.6936], [431.4, -55.6287], [431.5, -55.5626], [431.6, -55.4951], [431.7, -55.4263], [431.8, -55.356], [431.9, -55.2841], [432, -55.2106], [432.1, -55.1353], [432.2, -55.0582], [432.3, -54.9791], [432.4, -54.8978], [432.5, -54.8143], [432.6, -54.7284], [432.7, -54.6399], [432.8, -54.5485], [432.9, -54.4542], [433, -54.3567], [433.1, -54.2557], [433.2, -54.1509], [433.3, -54.0421], [433.4, -53.9288], [433.5, -53.8107], [433.6, -53.6872], [433.7, -53.558], [433.8, -53.4223], [433.9, -53.2796], [434, -53.1289], [434.1, -52.9695], [434.2, -52.8002], [434.3, -52.6197], [434.4, -52.4264], [434.5, -52.2185], [434.6, -51.9937], [434.7, -51.749], [434.8, -51.4809], [434.9, -51.1845], [435, -50.8535], [435.1, -50.4794], [435.2, -50.0499], [435.3, -49.5469], [435.4, -48.9422], [435.5, -48.1875], [435.6, -47.1908], [435.7, -45.7421], [435.8, -43.1723], [435.9, -34.4358], [436, -68], [436.1, -67.9649], [436.2, -67.9289], [436.3, -67.892], [436.4, -67.8541], [436.5, -67.8154], [436.6, -67.7758], [436.7, -67.7354], [436.8, -67.6942], [436.9, -67.6522], [437, -67.6094], [437.1, -67.5659], [437.2, -67.5216], [437.3, -67.4767], [437.4, -67.431], [437.5, -67.3848], [437.6, -67.3378], [437.7, -67.2903], [437.8, -67.2421], [437.9, -67.1934], [438, -67.1441], [438.1, -67.0943], [438.2, -67.0439], [438.3, -66.9931], [438.4, -66.9417], [438.5, -66.8899], [438.6, -66.8376], [438.7, -66.7849], [438.8, -66.7318], [438.9, -66.6783], [439, -66.6243], [439.1, -66.57], [439.2, -66.5154], [439.3, -66.4604], [439.4, -66.4051], [439.5, -66.3495], [439.6, -66.2936], [439.7, -66.2373], [439.8, -66.1809], [439.9, -66.1241], [440, -66.0672], [440.1, -66.01], [440.2, -65.9526], [440.3, -65.895], [440.4, -65.8372], [440.5, -65.7792], [440.6, -65.721], [440.7, -65.6627], [440.8, -65.6043], [440.9, -65.5457], [441, -65.487], [441.1, -65.4282], [441.2, -65.3693], [441.3, -65.3103], [441.4, -65.2512], [441.5, -65.1921], [441.6, -65.1329], [441.7, -65.0736], [441.8, -65.0143], [441.9, -64.955], [442, -64.8956], [442.1, -64.8363], [442.2, -64.7769], [442.3, -64.7175], [442.4, -64.6581], [442.5, -64.5988], [442.6, -64.5395], [442.7, -64.4802], [442.8, -64.4209], [442.9, -64.3617], [443, -64.3025], [443.1, -64.2434], [443.2, -64.1843], [443.3, -64.1254], [443.4, -64.0665], [443.5, -64.0076], [443.6, -63.9489], [443.7, -63.8903], [443.8, -63.8317], [443.9, -63.7733], [444, -63.7149], [444.1, -63.6567], [444.2, -63.5986], [444.3, -63.5406], [444.4, -63.4827], [444.5, -63.425], [444.6, -63.3674], [444.7, -63.3099], [444.8, -63.2526], [444.9, -63.1954], [445, -63.1384], [445.1, -63.0815], [445.2, -63.0248], [445.3, -62.9682], [445.4, -62.9118], [445.5, -62.8555], [445.6, -62.7994], [445.7, -62.7435], [445.8, -62.6877], [445.9, -62.6321], [446, -62.5767], [446.1, -62.5214], [446.2, -62.4664], [446.3, -62.4115], [446.4, -62.3568], [446.5, -62.3022], [446.6, -62.2479], [446.7, -62.1937], [446.8, -62.1397], [446.9, -62.0859], [447, -62.0323], [447.1, -61.9788], [447.2, -61.9256], [447.3, -61.8725], [447.4, -61.8196], [447.5, -61.767], [447.6, -61.7145], [447.7, -61.6621], [447.8, -61.61], [447.9, -61.5581], [448, -61.5063], [448.1, -61.4548], [448.2, -61.4034], [448.3, -61.3522], [448.4, -61.3012], [448.5, -61.2504], [448.6, -61.1997], [448.7, -61.1493], [448.8, -61.099], [448.9, -61.0489], [449, -60.999], [449.1, -60.9493], [449.2, -60.8997], [449.3, -60.8503], [449.4, -60.8011], [449.5, -60.7521], [449.6, -60.7033], [449.7, -60.6546], [449.8, -60.6061], [449.9, -60.5577], [450, -60.5095], [450.1, -60.4615], [450.2, -60.4137], [450.3, -60.366], [450.4, -60.3185], [450.5, -60.2711], [450.6, -60.2239], [450.7, -60.1768], [450.8, -60.1299], [450.9, -60.0831], [451, -60.0365], [451.1, -59.99], [451.2, -59.9436], [451.3, -59.8974], [451.4, -59.8513], [451.5, -59.8054], [451.6, -59.7596], [451.7, -59.7139], [451.8, -59.6683], [451.9, -59.6228], [452, -59.5775], [452.1, -59.5323], [452.2, -59.4871], [452.3, -59.4421], [452.4, -59.3972], [452.5, -59.3524], [452.6, -59.3076], [452.7, -59.263], [452.8, -59.2185], [452.9, -59.174], [453, -59.1296], [453.1, -59.0853], [453.2, -59.041], [453.3, -58.9968], [453.4, -58.9527], [453.5, -58.9087], [453.6, -58.8646], [453.7, -58.8207], [453.8, -58.7767], [453.9, -58.7328], [454, -58.689], [454.1, -58.6451], [454.2, -58.6013], [454.3, -58.5575], [454.4, -58.5137], [454.5, -58.4699], [454.6, -58.4261], [454.7, -58.3823], [454.8, -58.3385], [454.9, -58.2946], [455, -58.2508], [455.1, -58.2069], [455.2, -58.1629], [455.3, -58.1189], [455.4, -58.0748], [455.5, -58.0307], [455.6, -57.9865], [455.7, -57.9422], [455.8, -57.8978], [455.9, -57.8534], [456, -57.8088], [456.1, -57.7641], [456.2, -57.7192], [456.3, -57.6743], [456.4, -57.6292], [456.5, -57.5839], [456.6, -57.5384], [456.7, -57.4928], [456.8, -57.447], [456.9, -57.401], [457, -57.3547], [457.1, -57.3083], [457.2, -57.2616], [457.3, -57.2146], [457.4, -57.1673], [457.5, -57.1198], [457.6, -57.072], [457.7, -57.0238], [457.8, -56.9753], [457.9, -56.9265], [458, -56.8773], [458.1, -56.8276], [458.2, -56.7776], [458.3, -56.7271], [458.4, -56.6762], [458.5, -56.6248], [458.6, -56.5729], [458.7, -56.5204], [458.8, -56.4674], [458.9, -56.4138], [459, -56.3596], [459.1, -56.3047], [459.2, -56.2491], [459.3, -56.1928], [459.4, -56.1358], [459.5, -56.078], [459.6, -56.0193], [459.7, -55.9597], [459.8, -55.8992], [459.9, -55.8377], [460, -55.7752], [460.1, -55.7116], [460.2, -55.6468], [460.3, -55.5808], [460.4, -55.5135], [460.5, -55.4448], [460.6, -55.3747], [460.7, -55.303], [460.8, -55.2298], [460.9, -55.1547], [461, -55.0779], [461.1, -54.9991], [461.2, -54.9182], [461.3, -54.835], [461.4, -54.7495], [461.5, -54.6614], [461.6, -54.5706], [461.7, -54.4768], [461.8, -54.3799], [461.9, -54.2795], [462, -54.1754], [462.1, -54.0674], [462.2, -53.9549], [462.3, -53.8377], [462.4, -53.7153], [462.5, -53.5873], [462.6, -53.4529], [462.7, -53.3116], [462.8, -53.1626], [462.9, -53.005], [463, -52.8377], [463.1, -52.6595], [463.2, -52.469], [463.3, -52.2642], [463.4, -52.043], [463.5, -51.8027], [463.6, -51.5397], [463.7, -51.2495], [463.8, -50.9263], [463.9, -50.5619], [464, -50.1451], [464.1, -49.6592], [464.2, -49.0787], [464.3, -48.3606], [464.4, -47.4256], [464.5, -46.1003], [464.6, -43.8802], [464.7, -37.8952], [464.8, -68], [464.9, -67.9624], [465, -67.924], [465.1, -67.8846], [465.2, -67.8444], [465.3, -67.8034], [465.4, -67.7615], [465.5, -67.7189], [465.6, -67.6755], [465.7, -67.6314], [465.8, -67.5865], [465.9, -67.5409], [466, -67.4947], [466.1, -67.4478], [466.2, -67.4002], [466.3, -67.3521], [466.4, -67.3033], [466.5, -67.254], [466.6, -67.2041], [466.7, -67.1536], [466.8, -67.1027], [466.9, -67.0512], [467, -66.9992], [467.1, -66.9468], [467.2, -66.8939], [467.3, -66.8406], [467.4, -66.7869], [467.5, -66.7327], [467.6, -66.6782], [467.7, -66.6233], [467.8, -66.5681], [467.9, -66.5125], [468, -66.4566], [468.1, -66.4004], [468.2, -66.3439], [468.3, -66.2871], [468.4, -66.2301], [468.5, -66.1728], [468.6, -66.1152], [468.7, -66.0575], [468.8, -65.9995], [468.9, -65.9413], [469, -65.883], [469.1, -65.8244], [469.2, -65.7657], [469.3, -65.7069], [469.4, -65.6479], [469.5, -65.5888], [469.6, -65.5295], [469.7, -65.4702], [469.8, -65.4108], [469.9, -65.3512], [470, -65.2916], [470.1, -65.232], [470.2, -65.1722], [470.3, -65.1125], [470.4, -65.0527], [470.5, -64.9928], [470.6, -64.933], [470.7, -64.8731], [470.8, -64.8132], [470.9, -64.7534], [471, -64.6935], [471.1, -64.6337], [471.2, -64.5738], [471.3, -64.5141], [471.4, -64.4543], [471.5, -64.3946], [471.6, -64.335], [471.7, -64.2754], [471.8, -64.2159], [471.9, -64.1565], [472, -64.0972], [472.1, -64.0379], [472.2, -63.9787], [472.3, -63.9196], [472.4, -63.8606], [472.5, -63.8018], [472.6, -63.743], [472.7, -63.6844], [472.8, -63.6258], [472.9, -63.5674], [473, -63.5092], [473.1, -63.451], [473.2, -63.393], [473.3, -63.3352], [473.4, -63.2774], [473.5, -63.2199], [473.6, -63.1624], [473.7, -63.1052], [473.8, -63.0481], [473.9, -62.9911], [474, -62.9343], [474.1, -62.8777], [474.2, -62.8212], [474.3, -62.7649], [474.4, -62.7088], [474.5, -62.6529], [474.6, -62.5971], [474.7, -62.5415], [474.8, -62.4861], [474.9, -62.4309], [475, -62.3758], [475.1, -62.3209], [475.2, -62.2663], [475.3, -62.2118], [475.4, -62.1575], [475.5, -62.1033], [475.6, -62.0494], [475.7, -61.9957], [475.8, -61.9421], [475.9, -61.8887], [476, -61.8356], [476.1, -61.7826], [476.2, -61.7298], [476.3, -61.6772], [476.4, -61.6248], [476.5, -61.5725], [476.6, -61.5205], [476.7, -61.4687], [476.8, -61.417], [476.9, -61.3656], [477, -61.3143], [477.1, -61.2632], [477.2, -61.2123], [477.3, -61.1616], [477.4, -61.1111], [477.5, -61.0607], [477.6, -61.0106], [477.7, -60.9606], [477.8, -60.9108], [477.9, -60.8612], [478, -60.8117], [478.1, -60.7625], [478.2, -60.7134], [478.3, -60.6645], [478.4, -60.6158], [478.5, -60.5672], [478.6, -60.5188], [478.7, -60.4706], [478.8, -60.4225], [478.9, -60.3746], [479, -60.3269], [479.1, -60.2793], [479.2, -60.2318], [479.3, -60.1846], [479.4, -60.1374], [479.5, -60.0905], [479.6, -60.0436], [479.7, -59.997], [479.8, -59.9504], [479.9, -59.904], [480, -59.8577], [480.1, -59.8116], [480.2, -59.7656], [480.3, -59.7197], [480.4, -59.674], [480.5, -59.6283], [480.6, -59.5828], [480.7, -59.5374], [480.8, -59.4921], [480.9, -59.4469], [481, -59.4018], [481.1, -59.3568], [481.2, -59.3119], [481.3, -59.2671], [481.4, -59.2224], [481.5, -59.1778], [481.6, -59.1332], [481.7, -59.0888], [481.8, -59.0444], [481.9, -59], [482, -58.9558], [482.1, -58.9115], [482.2, -58.8674], [482.3, -58.8232], [482.4, -58.7792], [482.5, -58.7351], [482.6, -58.6911], [482.7, -58.6471], [482.8, -58.6032], [482.9, -58.5592], [483, -58.5153], [483.1, -58.4713], [483.2, -58.4274], [483.3, -58.3835], [483.4, -58.3395], [483.5, -58.2955], [483.6, -58.2515], [483.7, -58.2075], [483.8, -58.1634], [483.9, -58.1192], [484, -58.075], [484.1, -58.0308], [484.2, -57.9864], [484.3, -57.942], [484.4, -57.8975], [484.5, -57.8529], [484.6, -57.8082], [484.7, -57.7633], [484.8, -57.7184], [484.9, -57.6733], [485, -57.628], [485.1, -57.5826], [485.2, -57.537], [485.3, -57.4913], [485.4, -57.4453], [485.5, -57.3992], [485.6, -57.3528], [485.7, -57.3062], [485.8, -57.2593], [485.9, -57.2122], [486, -57.1649], [486.1, -57.1172], [486.2, -57.0692], [486.3, -57.0209], [486.4, -56.9723], [486.5, -56.9233], [486.6, -56.8739], [486.7, -56.8241], [486.8, -56.774], [486.9, -56.7233], [487, -56.6723], [487.1, -56.6207], [487.2, -56.5686], [487.3, -56.516], [487.4, -56.4628], [487.5, -56.409], [487.6, -56.3546], [487.7, -56.2996], [487.8, -56.2438], [487.9, -56.1874], [488, -56.1301], [488.1, -56.0721], [488.2, -56.0132], [488.3, -55.9534], [488.4, -55.8927], [488.5, -55.831], [488.6, -55.7682], [488.7, -55.7044], [488.8, -55.6394], [488.9, -55.5731], [489, -55.5055], [489.1, -55.4366], [489.2, -55.3662], [489.3, -55.2943], [489.4, -55.2207], [489.5, -55.1453], [489.6, -55.0681], [489.7, -54.9889], [489.8, -54.9077], [489.9, -54.8241], [490, -54.7382], [490.1, -54.6496], [490.2, -54.5583], [490.3, -54.464], [490.4, -54.3665], [490.5, -54.2656], [490.6, -54.1609], [490.7, -54.0521], [490.8, -53.939], [490.9, -53.821], [491, -53.6977], [491.1, -53.5687], [491.2, -53.4333], [491.3, -53.2909], [491.4, -53.1406], [491.5, -52.9816], [491.6, -52.8127], [491.7, -52.6328], [491.8, -52.4402], [491.9, -52.2331], [492, -52.0092], [492.1, -51.7657], [492.2, -51.499], [492.3, -51.2043], [492.4, -50.8755], [492.5, -50.5041], [492.6, -50.0782], [492.7, -49.5802], [492.8, -48.9825], [492.9, -48.2386], [493, -47.2603], [493.1, -45.8492], [493.2, -43.39], [493.3, -35.6475], [493.4, -68], [493.5, -67.9637], [493.6, -67.9265], [493.7, -67.8884], [493.8, -67.8494], [493.9, -67.8095], [494, -67.7688], [494.1, -67.7273], [494.2, -67.685], [494.3, -67.642], [494.4, -67.5982], [494.5, -67.5536], [494.6, -67.5084], [494.7, -67.4625], [494.8, -67.4159], [494.9, -67.3687], [495, -67.3209], [495.1, -67.2725], [495.2, -67.2235], [495.3, -67.1739], [495.4, -67.1238], [495.5, -67.0731], [495.6, -67.022], [495.7, -66.9704], [495.8, -66.9183], [495.9, -66.8657], [496, -66.8127], [496.1, -66.7593], [496.2, -66.7055], [496.3, -66.6513], [496.4, -66.5967], [496.5, -66.5418], [496.6, -66.4866], [496.7, -66.431], [496.8, -66.3751], [496.9, -66.3189], [497, -66.2624], [497.1, -66.2057], [497.2, -66.1487], [497.3, -66.0914], [497.4, -66.034], [497.5, -65.9763], [497.6, -65.9184], [497.7, -65.8604], [497.8, -65.8021], [497.9, -65.7437], [498, -65.6851], [498.1, -65.6264], [498.2, -65.5676], [498.3, -65.5087], [498.4, -65.4496], [498.5, -65.3904], [498.6, -65.3312], [498.7, -65.2719], [498.8, -65.2125], [498.9, -65.153], [499, -65.0935], [499.1, -65.034], [499.2, -64.9744], [499.3, -64.9148], [499.4, -64.8552], [499.5, -64.7956], [499.6, -64.736], [499.7, -64.6764], [499.8, -64.6168], [499.9, -64.5572], [500, -64.4977]])
+
+plt.figure()
+plt.plot(data.T[0,:], data.T[1,:])
+plt.xlabel('ms')
+plt.ylabel('mV')
+plt.title('AdEx Neuron')
+plt.show()
@@ -0,0 +1,13 @@
+#!/usr/bin/env python
+
+import numpy as np
+import matplotlib.pyplot as plt
+
+data = np.array([[0, -65], [0.1, -65], [0.2, -65], [0.3, -65], [0.4, -65], [0.5, -65], [0.6, -65], [0.7, -65], [0.8, -65], [0.9, -65], [1, -65], [1.1, -65], [1.2, -65], [1.3, -65], [1.4, -65], [1.5, -65], [1.6, -65], [1.7, -65], [1.8, -65], [1.9, -65], [2, -65], [2.1, -65], [2.2, -65], [2.3, -65], [2.4, -65], [2.5, -65], [2.6, -65], [2.7, -65], [2.8, -65], [2.9, -65], [3, -65], [3.1, -65], [3.2, -65], [3.3, -65], [3.4, -65], [3.5, -65], [3.6, -65], [3.7, -65], [3.8, -65], [3.9, -65], [4, -65], [4.1, -65], [4.2, -65], [4.3, -65], [4.4, -65], [4.5, -65], [4.6, -65], [4.7, -65], [4.8, -65], [4.9, -65], [5, -65], [5.1, -65], [5.2, -65], [5.3, -65], [5.4, -65], [5.5, -65], [5.6, -65], [5.7, -65], [5.8, -65], [5.9, -65], [6, -65], [6.1, -65], [6.2, -65], [6.3, -65], [6.4, -65], [6.5, -65], [6.6, -65], [6.7, -65], [6.8, -65], [6.9, -65], [7, -65], [7.1, -65], [7.2, -65], [7.3, -65], [7.4, -65], [7.5, -65], [7.6, -65], [7.7, -65], [7.8, -65], [7.9, -65], [8, -65], [8.1, -65], [8.2, -65], [8.3, -65], [8.4, -65], [8.5, -65], [8.6, -65], [8.7, -65], [8.8, -65], [8.9, -65], [9, -65], [9.1, -65], [9.2, -65], [9.3, -65], [9.4, -65], [9.5, -65], [9.6, -65], [9.7, -65], [9.8, -65], [9.9, -65], [10, -65], [10.1, -65], [10.2, -65], [10.3, -65], [10.4, -65], [10.5, -65], [10.6, -65], [10.7, -65], [10.8, -65], [10.9, -65], [11, -65], [11.1, -65], [11.2, -65], [11.3, -65], [11.4, -65], [11.5, -65], [11.6, -65], [11.7, -65], [11.8, -65], [11.9, -65], [12, -65], [12.1, -65], [12.2, -65], [12.3, -65], [12.4, -65], [12.5, -65], [12.6, -65], [12.7, -65], [12.8, -65], [12.9, -65], [13, -65], [13.1, -65], [13.2, -65], [13.3, -65], [13.4, -65], [13.5, -65], [13.6, -65], [13.7, -65], [13.8, -65], [13.9, -65], [14, -65], [14.1, -65], [14.2, -65], [14.3, -65], [14.4, -65], [14.5, -65], [14.6, -65], [14.7, -65], [14.8, -65], [14.9, -65], [15, -65], [15.1, -65], [15.2, -65], [15.3, -65], [15.4, -65], [15.5, -65], [15.6, -65], [15.7, -65], [15.8, -65], [15.9, -65], [16, -65], [16.1, -65], [16.2, -65], [16.3, -65], [16.4, -65], [16.5, -65], [16.6, -65], [16.7, -65], [16.8, -65], [16.9, -65], [17, -65], [17.1, -65], [17.2, -65], [17.3, -65], [17.4, -65], [17.5, -65], [17.6, -65], [17.7, -65], [17.8, -65], [17.9, -65], [18, -65], [18.1, -65], [18.2, -65], [18.3, -65], [18.4, -65], [18.5, -65], [18.6, -65], [18.7, -65], [18.8, -65], [18.9, -65], [19, -65], [19.1, -65], [19.2, -65], [19.3, -65], [19.4, -65], [19.5, -65], [19.6, -65], [19.7, -65], [19.8, -65], [19.9, -65], [20, -64.85], [20.1, -64.5544], [20.2, -64.2629], [20.3, -63.9755], [20.4, -63.6918], [20.5, -63.4118], [20.6, -63.1352], [20.7, -62.8619], [20.8, -62.5917], [20.9, -62.3245], [21, -62.0601], [21.1, -61.7984], [21.2, -61.5392], [21.3, -61.2825], [21.4, -61.028], [21.5, -60.7756], [21.6, -60.5253], [21.7, -60.277], [21.8, -60.0304], [21.9, -59.7855], [22, -59.5423], [22.1, -59.3005], [22.2, -59.06], [22.3, -58.8209], [22.4, -58.5829], [22.5, -58.346], [22.6, -58.1101], [22.7, -57.8751], [22.8, -57.6409], [22.9, -57.4074], [23, -57.1745], [23.1, -56.9421], [23.2, -56.7102], [23.3, -56.4785], [23.4, -56.2472], [23.5, -56.016], [23.6, -55.7848], [23.7, -55.5536], [23.8, -55.3223], [23.9, -55.0908], [24, -54.859], [24.1, -54.6268], [24.2, -54.3941], [24.3, -54.1608], [24.4, -53.9268], [24.5, -53.692], [24.6, -53.4564], [24.7, -53.2197], [24.8, -52.9819], [24.9, -52.743], [25, -52.5027], [25.1, -52.2609], [25.2, -52.0177], [25.3, -51.7727], [25.4, -51.5259], [25.5, -51.2772], [25.6, -51.0265], [25.7, -50.7735], [25.8, -50.5182], [25.9, -50.2604], [26, -50], [26.1, -49.7367], [26.2, -49.4705], [26.3, -49.2011], [26.4, -48.9284], [26.5, -48.6522], [26.6, -48.3722], [26.7, -48.0883], [26.8, -47.8002], [26.9, -47.5078], [27, -47.2107], [27.1, -46.9088], [27.2, -46.6016], [27.3, -46.2891], [27.4, -45.9708], [27.5, -45.6464], [27.6, -45.3157], [27.7, -44.9782], [27.8, -44.6335], [27.9, -44.2814], [28, -43.9212], [28.1, -43.5526], [28.2, -43.1752], [28.3, -42.7882], [28.4, -42.3913], [28.5, -41.9838], [28.6, -41.5651], [28.7, -41.1345], [28.8, -40.6912], [28.9, -40.2344], [29, -39.7633], [29.1, -39.277], [29.2, -38.7744], [29.3, -38.2544], [29.4, -37.7159], [29.5, -37.1576], [29.6, -36.5781], [29.7, -35.9757], [29.8, -35.3489], [29.9, -34.6958], [30, -34.0143], [30.1, -33.3022], [30.2, -32.557], [30.3, -31.776], [30.4, -30.9561], [30.5, -30.0939], [30.6, -68], [30.7, -67.7701], [30.8, -67.5433], [30.9, -67.3197], [31, -67.099], [31.1, -66.8811], [31.2, -66.6659], [31.3, -66.4534], [31.4, -66.2434], [31.5, -66.0358], [31.6, -65.8305], [31.7, -65.6274], [31.8, -65.4265], [31.9, -65.2276], [32, -65.0307], [32.1, -64.8357], [32.2, -64.6426], [32.3, -64.4512], [32.4, -64.2615], [32.5, -64.0734], [32.6, -63.8869], [32.7, -63.7019], [32.8, -63.5183], [32.9, -63.336], [33, -63.1552], [33.1, -62.9755], [33.2, -62.7971], [33.3, -62.6199], [33.4, -62.4438], [33.5, -62.2687], [33.6, -62.0946], [33.7, -61.9216], [33.8, -61.7494], [33.9, -61.5782], [34, -61.4077], [34.1, -61.2381], [34.2, -61.0693], [34.3, -60.9011], [34.4, -60.7336], [34.5, -60.5668], [34.6, -60.4006], [34.7, -60.2349], [34.8, -60.0697], [34.9, -59.9051], [35, -59.7408], [35.1, -59.577], [35.2, -59.4136], [35.3, -59.2505], [35.4, -59.0877], [35.5, -58.9252], [35.6, -58.7629], [35.7, -58.6009], [35.8, -58.439], [35.9, -58.2772], [36, -58.1155], [36.1, -57.9539], [36.2, -57.7923], [36.3, -57.6307], [36.4, -57.4691], [36.5, -57.3074], [36.6, -57.1456], [36.7, -56.9836], [36.8, -56.8214], [36.9, -56.659], [37, -56.4964], [37.1, -56.3335], [37.2, -56.1702], [37.3, -56.0066], [37.4, -55.8425], [37.5, -55.678], [37.6, -55.513], [37.7, -55.3475], [37.8, -55.1814], [37.9, -55.0146], [38, -54.8473], [38.1, -54.6792], [38.2, -54.5103], [38.3, -54.3407], [38.4, -54.1702], [38.5, -53.9988], [38.6, -53.8265], [38.7, -53.6532], [38.8, -53.4788], [38.9, -53.3034], [39, -53.1267], [39.1, -52.9489], [39.2, -52.7697], [39.3, -52.5893], [39.4, -52.4074], [39.5, -52.224], [39.6, -52.0391], [39.7, -51.8526], [39.8, -51.6645], [39.9, -51.4745], [40, -51.2827], [40.1, -51.089], [40.2, -50.8933], [40.3, -50.6955], [40.4, -50.4955], [40.5, -50.2932], [40.6, -50.0885], [40.7, -49.8814], [40.8, -49.6716], [40.9, -49.4592], [41, -49.2439], [41.1, -49.0256], [41.2, -48.8043], [41.3, -48.5797], [41.4, -48.3518], [41.5, -48.1204], [41.6, -47.8852], [41.7, -47.6463], [41.8, -47.4033], [41.9, -47.1562], [42, -46.9046], [42.1, -46.6485], [42.2, -46.3875], [42.3, -46.1216], [42.4, -45.8503], [42.5, -45.5736], [42.6, -45.291], [42.7, -45.0024], [42.8, -44.7074], [42.9, -44.4057], [43, -44.0969], [43.1, -43.7808], [43.2, -43.4569], [43.3, -43.1248], [43.4, -42.7841], [43.5, -42.4343], [43.6, -42.0749], [43.7, -41.7054], [43.8, -41.3251], [43.9, -40.9336], [44, -40.5301], [44.1, -40.114], [44.2, -39.6844], [44.3, -39.2405], [44.4, -38.7814], [44.5, -38.3063], [44.6, -37.8139], [44.7, -37.3032], [44.8, -36.773], [44.9, -36.2218], [45, -35.6483], [45.1, -35.0508], [45.2, -34.4274], [45.3, -33.7764], [45.4, -33.0955], [45.5, -32.3824], [45.6, -31.6344], [45.7, -30.8486], [45.8, -30.0218], [45.9, -68], [46, -67.8091], [46.1, -67.6203], [46.2, -67.4334], [46.3, -67.2484], [46.4, -67.0652], [46.5, -66.8838], [46.6, -66.704], [46.7, -66.5259], [46.8, -66.3494], [46.9, -66.1743], [47, -66.0008], [47.1, -65.8286], [47.2, -65.6578], [47.3, -65.4883], [47.4, -65.32], [47.5, -65.153], [47.6, -64.9872], [47.7, -64.8224], [47.8, -64.6588], [47.9, -64.4962], [48, -64.3347], [48.1, -64.1741], [48.2, -64.0144], [48.3, -63.8557], [48.4, -63.6978], [48.5, -63.5408], [48.6, -63.3845], [48.7, -63.229], [48.8, -63.0743], [48.9, -62.9203], [49, -62.7669], [49.1, -62.6142], [49.2, -62.4622], [49.3, -62.3107], [49.4, -62.1598], [49.5, -62.0094], [49.6, -61.8595], [49.7, -61.7102], [49.8, -61.5613], [49.9, -61.4128], [50, -61.2647], [50.1, -61.117], [50.2, -60.9697], [50.3, -60.8227], [50.4, -60.6761], [50.5, -60.5297], [50.6, -60.3836], [50.7, -60.2377], [50.8, -60.0921], [50.9, -59.9466], [51, -59.8014], [51.1, -59.6562], [51.2, -59.5112], [51.3, -59.3663], [51.4, -59.2215], [51.5, -59.0768], [51.6, -58.932], [51.7, -58.7873], [51.8, -58.6426], [51.9, -58.4978], [52, -58.353], [52.1, -58.2081], [52.2, -58.0631], [52.3, -57.9179], [52.4, -57.7726], [52.5, -57.6271], [52.6, -57.4814], [52.7, -57.3355], [52.8, -57.1893], [52.9, -57.0428], [53, -56.896], [53.1, -56.7489], [53.2, -56.6014], [53.3, -56.4535], [53.4, -56.3052], [53.5, -56.1564], [53.6, -56.0072], [53.7, -55.8575], [53.8, -55.7072], [53.9, -55.5563], [54, -55.4048], [54.1, -55.2527], [54.2, -55.0999], [54.3, -54.9464], [54.4, -54.7921], [54.5, -54.6371], [54.6, -54.4813], [54.7, -54.3246], [54.8, -54.1669], [54.9, -54.0084], [55, -53.8489], [55.1, -53.6883], [55.2, -53.5267], [55.3, -53.364], [55.4, -53.2001], [55.5, -53.035], [55.6, -52.8686], [55.7, -52.7009], [55.8, -52.5319], [55.9, -52.3614], [56, -52.1894], [56.1, -52.0159], [56.2, -51.8408], [56.3, -51.664], [56.4, -51.4855], [56.5, -51.3051], [56.6, -51.1229], [56.7, -50.9387], [56.8, -50.7525], [56.9, -50.5641], [57, -50.3735], [57.1, -50.1807], [57.2, -49.9854], [57.3, -49.7877], [57.4, -49.5873], [57.5, -49.3843], [57.6, -49.1785], [57.7, -48.9697], [57.8, -48.7579], [57.9, -48.5429], [58, -48.3246], [58.1, -48.1029], [58.2, -47.8775], [58.3, -47.6484], [58.4, -47.4154], [58.5, -47.1783], [58.6, -46.9369], [58.7, -46.6911], [58.8, -46.4406], [58.9, -46.1853], [59, -45.9249], [59.1, -45.6591], [59.2, -45.3877], [59.3, -45.1105], [59.4, -44.8272], [59.5, -44.5375], [59.6, -44.241], [59.7, -43.9375], [59.8, -43.6265], [59.9, -43.3077], [60, -42.9806], [60.1, -42.645], [60.2, -42.3002], [60.3, -41.9458], [60.4, -41.5813], [60.5, -41.2061], [60.6, -40.8195], [60.7, -40.421], [60.8, -40.0098], [60.9, -39.5852], [61, -39.1463], [61.1, -38.6923], [61.2, -38.2222], [61.3, -37.7349], [61.4, -37.2294], [61.5, -36.7043], [61.6, -36.1585], [61.7, -35.5903], [61.8, -34.9982], [61.9, -34.3804], [62, -33.7351], [62.1, -33.06], [62.2, -32.3529], [62.3, -31.6111], [62.4, -30.8317], [62.5, -30.0116], [62.6, -68], [62.7, -67.8163], [62.8, -67.6344], [62.9, -67.4543], [63, -67.2758], [63.1, -67.099], [63.2, -66.9237], [63.3, -66.75], [63.4, -66.5777], [63.5, -66.4069], [63.6, -66.2374], [63.7, -66.0692], [63.8, -65.9023], [63.9, -65.7366], [64, -65.5721], [64.1, -65.4087], [64.2, -65.2464], [64.3, -65.0852], [64.4, -64.925], [64.5, -64.7658], [64.6, -64.6076], [64.7, -64.4503], [64.8, -64.2938], [64.9, -64.1382], [65, -63.9834], [65.1, -63.8294], [65.2, -63.6762], [65.3, -63.5237], [65.4, -63.3719], [65.5, -63.2208], [65.6, -63.0703], [65.7, -62.9205], [65.8, -62.7712], [65.9, -62.6225], [66, -62.4744], [66.1, -62.3267], [66.2, -62.1796], [66.3, -62.0329], [66.4, -61.8867], [66.5, -61.7409], [66.6, -61.5955], [66.7, -61.4505], [66.8, -61.3058], [66.9, -61.1615], [67, -61.0174], [67.1, -60.8737], [67.2, -60.7302], [67.3, -60.587], [67.4, -60.444], [67.5, -60.3012], [67.6, -60.1585], [67.7, -60.0161], [67.8, -59.8737], [67.9, -59.7315], [68, -59.5894], [68.1, -59.4474], [68.2, -59.3054], [68.3, -59.1634], [68.4, -59.0215], [68.5, -58.8795], [68.6, -58.7375], [68.7, -58.5955], [68.8, -58.4534], [68.9, -58.3111], [69, -58.1688], [69.1, -58.0263], [69.2, -57.8837], [69.3, -57.7408], [69.4, -57.5978], [69.5, -57.4545], [69.6, -57.3109], [69.7, -57.1671], [69.8, -57.0229], [69.9, -56.8784], [70, -56.7336], [70.1, -56.5883], [70.2, -56.4427], [70.3, -56.2965], [70.4, -56.15], [70.5, -56.0029], [70.6, -55.8553], [70.7, -55.7071], [70.8, -55.5584], [70.9, -55.409], [71, -55.259], [71.1, -55.1083], [71.2, -54.9569], [71.3, -54.8047], [71.4, -54.6518], [71.5, -54.498], [71.6, -54.3433], [71.7, -54.1878], [71.8, -54.0313], [71.9, -53.8739], [72, -53.7154], [72.1, -53.5558], [72.2, -53.3952], [72.3, -53.2333], [72.4, -53.0703], [72.5, -52.906], [72.6, -52.7405], [72.7, -52.5735], [72.8, -52.4052], [72.9, -52.2353], [73, -52.064], [73.1, -51.891], [73.2, -51.7165], [73.3, -51.5401], [73.4, -51.362], [73.5, -51.1821], [73.6, -51.0002], [73.7, -50.8163], [73.8, -50.6303], [73.9, -50.4421], [74, -50.2517], [74.1, -50.059], [74.2, -49.8637], [74.3, -49.666], [74.4, -49.4656], [74.5, -49.2624], [74.6, -49.0564], [74.7, -48.8474], [74.8, -48.6353], [74.9, -48.4199], [75, -48.2012], [75.1, -47.9789], [75.2, -47.753], [75.3, -47.5233], [75.4, -47.2895], [75.5, -47.0516], [75.6, -46.8094], [75.7, -46.5626], [75.8, -46.311], [75.9, -46.0545], [76, -45.7928], [76.1, -45.5257], [76.2, -45.2529], [76.3, -44.9741], [76.4, -44.689], [76.5, -44.3975], [76.6, -44.099], [76.7, -43.7933], [76.8, -43.4801], [76.9, -43.1588], [77, -42.8292], [77.1, -42.4907], [77.2, -42.143], [77.3, -41.7854], [77.4, -41.4175], [77.5, -41.0386], [77.6, -40.6482], [77.7, -40.2455], [77.8, -39.8298], [77.9, -39.4005], [78, -38.9565], [78.1, -38.497], [78.2, -38.021], [78.3, -37.5275], [78.4, -37.0152], [78.5, -36.4829], [78.6, -35.9292], [78.7, -35.3527], [78.8, -34.7515], [78.9, -34.124], [79, -33.4681], [79.1, -32.7816], [79.2, -32.0621], [79.3, -31.3068], [79.4, -30.5128], [79.5, -68], [79.6, -67.8162], [79.7, -67.6342], [79.8, -67.4539], [79.9, -67.2753], [80, -67.0984], [80.1, -66.9231], [80.2, -66.7492], [80.3, -66.5768], [80.4, -66.4059], [80.5, -66.2363], [80.6, -66.068], [80.7, -65.901], [80.8, -65.7352], [80.9, -65.5706], [81, -65.4072], [81.1, -65.2448], [81.2, -65.0835], [81.3, -64.9233], [81.4, -64.764], [81.5, -64.6057], [81.6, -64.4483], [81.7, -64.2917], [81.8, -64.1361], [81.9, -63.9812], [82, -63.8272], [82.1, -63.6739], [82.2, -63.5213], [82.3, -63.3695], [82.4, -63.2183], [82.5, -63.0677], [82.6, -62.9178], [82.7, -62.7685], [82.8, -62.6197], [82.9, -62.4715], [83, -62.3238], [83.1, -62.1767], [83.2, -62.0299], [83.3, -61.8836], [83.4, -61.7378], [83.5, -61.5923], [83.6, -61.4473], [83.7, -61.3025], [83.8, -61.1581], [83.9, -61.0141], [84, -60.8703], [84.1, -60.7267], [84.2, -60.5835], [84.3, -60.4404], [84.4, -60.2976], [84.5, -60.1549], [84.6, -60.0124], [84.7, -59.87], [84.8, -59.7277], [84.9, -59.5856], [85, -59.4435], [85.1, -59.3015], [85.2, -59.1594], [85.3, -59.0175], [85.4, -58.8754], [85.5, -58.7334], [85.6, -58.5913], [85.7, -58.4491], [85.8, -58.3069], [85.9, -58.1645], [86, -58.022], [86.1, -57.8792], [86.2, -57.7364], [86.3, -57.5932], [86.4, -57.4499], [86.5, -57.3063], [86.6, -57.1624], [86.7, -57.0182], [86.8, -56.8736], [86.9, -56.7287], [87, -56.5834], [87.1, -56.4377], [87.2, -56.2916], [87.3, -56.145], [87.4, -55.9978], [87.5, -55.8502], [87.6, -55.702], [87.7, -55.5532], [87.8, -55.4037], [87.9, -55.2537], [88, -55.1029], [88.1, -54.9514], [88.2, -54.7992], [88.3, -54.6462], [88.4, -54.4923], [88.5, -54.3376], [88.6, -54.182], [88.7, -54.0255], [88.8, -53.8679], [88.9, -53.7094], [89, -53.5497], [89.1, -53.389], [89.2, -53.2271], [89.3, -53.064], [89.4, -52.8997], [89.5, -52.734], [89.6, -52.567], [89.7, -52.3985], [89.8, -52.2286], [89.9, -52.0572], [90, -51.8841], [90.1, -51.7094], [90.2, -51.533], [90.3, -51.3548], [90.4, -51.1748], [90.5, -50.9928], [90.6, -50.8088], [90.7, -50.6227], [90.8, -50.4344], [90.9, -50.2438], [91, -50.0509], [91.1, -49.8556], [91.2, -49.6577], [91.3, -49.4572], [91.4, -49.2539], [91.5, -49.0477], [91.6, -48.8385], [91.7, -48.6263], [91.8, -48.4107], [91.9, -48.1918], [92, -47.9694], [92.1, -47.7433], [92.2, -47.5134], [92.3, -47.2794], [92.4, -47.0413], [92.5, -46.7989], [92.6, -46.5518], [92.7, -46.3001], [92.8, -46.0433], [92.9, -45.7813], [93, -45.5139], [93.1, -45.2408], [93.2, -44.9618], [93.3, -44.6764], [93.4, -44.3845], [93.5, -44.0857], [93.6, -43.7797], [93.7, -43.4661], [93.8, -43.1445], [93.9, -42.8145], [94, -42.4756], [94.1, -42.1274], [94.2, -41.7693], [94.3, -41.4009], [94.4, -41.0215], [94.5, -40.6305], [94.6, -40.2273], [94.7, -39.811], [94.8, -39.381], [94.9, -38.9363], [95, -38.4761], [95.1, -37.9993], [95.2, -37.5049], [95.3, -36.9918], [95.4, -36.4585], [95.5, -35.9038], [95.6, -35.3262], [95.7, -34.7239], [95.8, -34.0951], [95.9, -33.4379], [96, -32.7499], [96.1, -32.0288], [96.2, -31.2718], [96.3, -30.476], [96.4, -68], [96.5, -67.8162], [96.6, -67.6343], [96.7, -67.4541], [96.8, -67.2756], [96.9, -67.0987], [97, -66.9234], [97.1, -66.7497], [97.2, -66.5773], [97.3, -66.4064], [97.4, -66.2369], [97.5, -66.0687], [97.6, -65.9017], [97.7, -65.736], [97.8, -65.5714], [97.9, -65.408], [98, -65.2457], [98.1, -65.0845], [98.2, -64.9242], [98.3, -64.765], [98.4, -64.6067], [98.5, -64.4494], [98.6, -64.2929], [98.7, -64.1373], [98.8, -63.9824], [98.9, -63.8284], [99, -63.6752], [99.1, -63.5226], [99.2, -63.3708], [99.3, -63.2197], [99.4, -63.0692], [99.5, -62.9193], [99.6, -62.77], [99.7, -62.6213], [99.8, -62.4731], [99.9, -62.3254], [100, -62.1783], [100.1, -62.0316], [100.2, -61.8853], [100.3, -61.7395], [100.4, -61.5941], [100.5, -61.449], [100.6, -61.3043], [100.7, -61.16], [100.8, -61.0159], [100.9, -60.8722], [101, -60.7287], [101.1, -60.5854], [101.2, -60.4424], [101.3, -60.2996], [101.4, -60.1569], [101.5, -60.0144], [101.6, -59.8721], [101.7, -59.7298], [101.8, -59.5877], [101.9, -59.4456], [102, -59.3036], [102.1, -59.1617], [102.2, -59.0197], [102.3, -58.8777], [102.4, -58.7357], [102.5, -58.5936], [102.6, -58.4515], [102.7, -58.3092], [102.8, -58.1669], [102.9, -58.0244], [103, -57.8817], [103.1, -57.7388], [103.2, -57.5957], [103.3, -57.4524], [103.4, -57.3088], [103.5, -57.165], [103.6, -57.0208], [103.7, -56.8763], [103.8, -56.7314], [103.9, -56.5861], [104, -56.4405], [104.1, -56.2943], [104.2, -56.1477], [104.3, -56.0006], [104.4, -55.853], [104.5, -55.7048], [104.6, -55.5561], [104.7, -55.4067], [104.8, -55.2566], [104.9, -55.1059], [105, -54.9545], [105.1, -54.8023], [105.2, -54.6493], [105.3, -54.4955], [105.4, -54.3408], [105.5, -54.1852], [105.6, -54.0287], [105.7, -53.8712], [105.8, -53.7127], [105.9, -53.5531], [106, -53.3924], [106.1, -53.2306], [106.2, -53.0675], [106.3, -52.9032], [106.4, -52.7376], [106.5, -52.5706], [106.6, -52.4022], [106.7, -52.2323], [106.8, -52.0609], [106.9, -51.888], [107, -51.7133], [107.1, -51.537], [107.2, -51.3588], [107.3, -51.1788], [107.4, -50.9969], [107.5, -50.8129], [107.6, -50.6269], [107.7, -50.4387], [107.8, -50.2482], [107.9, -50.0554], [108, -49.8601], [108.1, -49.6623], [108.2, -49.4618], [108.3, -49.2586], [108.4, -49.0525], [108.5, -48.8434], [108.6, -48.6313], [108.7, -48.4158], [108.8, -48.197], [108.9, -47.9747], [109, -47.7487], [109.1, -47.5189], [109.2, -47.285], [109.3, -47.047], [109.4, -46.8047], [109.5, -46.5578], [109.6, -46.3061], [109.7, -46.0495], [109.8, -45.7877], [109.9, -45.5204], [110, -45.2475], [110.1, -44.9686], [110.2, -44.6834], [110.3, -44.3917], [110.4, -44.0931], [110.5, -43.7873], [110.6, -43.4738], [110.7, -43.1524], [110.8, -42.8226], [110.9, -42.484], [111, -42.136], [111.1, -41.7782], [111.2, -41.4101], [111.3, -41.031], [111.4, -40.6403], [111.5, -40.2374], [111.6, -39.8214], [111.7, -39.3918], [111.8, -38.9475], [111.9, -38.4877], [112, -38.0113], [112.1, -37.5174], [112.2, -37.0047], [112.3, -36.472], [112.4, -35.9179], [112.5, -35.3409], [112.6, -34.7392], [112.7, -34.1111], [112.8, -33.4546], [112.9, -32.7675], [113, -32.0472], [113.1, -31.2912], [113.2, -30.4963], [113.3, -68], [113.4, -67.8162], [113.5, -67.6342], [113.6, -67.454], [113.7, -67.2755], [113.8, -67.0986], [113.9, -66.9232], [114, -66.7494], [114.1, -66.5771], [114.2, -66.4061], [114.3, -66.2366], [114.4, -66.0683], [114.5, -65.9013], [114.6, -65.7356], [114.7, -65.571], [114.8, -65.4075], [114.9, -65.2452], [115, -65.0839], [115.1, -64.9237], [115.2, -64.7644], [115.3, -64.6061], [115.4, -64.4487], [115.5, -64.2922], [115.6, -64.1366], [115.7, -63.9818], [115.8, -63.8277], [115.9, -63.6745], [116, -63.5219], [116.1, -63.3701], [116.2, -63.2189], [116.3, -63.0684], [116.4, -62.9185], [116.5, -62.7692], [116.6, -62.6204], [116.7, -62.4722], [116.8, -62.3246], [116.9, -62.1774], [117, -62.0307], [117.1, -61.8844], [117.2, -61.7386], [117.3, -61.5931], [117.4, -61.4481], [117.5, -61.3033], [117.6, -61.159], [117.7, -61.0149], [117.8, -60.8711], [117.9, -60.7276], [118, -60.5843], [118.1, -60.4413], [118.2, -60.2984], [118.3, -60.1558], [118.4, -60.0133], [118.5, -59.8709], [118.6, -59.7287], [118.7, -59.5865], [118.8, -59.4444], [118.9, -59.3024], [119, -59.1604], [119.1, -59.0184], [119.2, -58.8765], [119.3, -58.7344], [119.4, -58.5923], [119.5, -58.4502], [119.6, -58.3079], [119.7, -58.1656], [119.8, -58.023], [119.9, -57.8803], [120, -57.7375], [120.1, -57.5944], [120.2, -57.451], [120.3, -57.3074], [120.4, -57.1636], [120.5, -57.0194], [120.6, -56.8748], [120.7, -56.7299], [120.8, -56.5846], [120.9, -56.439], [121, -56.2928], [121.1, -56.1462], [121.2, -55.9991], [121.3, -55.8514], [121.4, -55.7032], [121.5, -55.5545], [121.6, -55.405], [121.7, -55.255], [121.8, -55.1042], [121.9, -54.9528], [122, -54.8006], [122.1, -54.6476], [122.2, -54.4937], [122.3, -54.339], [122.4, -54.1834], [122.5, -54.0269], [122.6, -53.8694], [122.7, -53.7109], [122.8, -53.5512], [122.9, -53.3905], [123, -53.2287], [123.1, -53.0656], [123.2, -52.9012], [123.3, -52.7356], [123.4, -52.5686], [123.5, -52.4002], [123.6, -52.2303], [123.7, -52.0589], [123.8, -51.8858], [123.9, -51.7112], [124, -51.5348], [124.1, -51.3566], [124.2, -51.1766], [124.3, -50.9946], [124.4, -50.8106], [124.5, -50.6245], [124.6, -50.4363], [124.7, -50.2458], [124.8, -50.0529], [124.9, -49.8576], [125, -49.6598], [125.1, -49.4592], [125.2, -49.256], [125.3, -49.0498], [125.4, -48.8407], [125.5, -48.6285], [125.6, -48.413], [125.7, -48.1941], [125.8, -47.9718], [125.9, -47.7457], [126, -47.5158], [126.1, -47.2819], [126.2, -47.0439], [126.3, -46.8015], [126.4, -46.5545], [126.5, -46.3028], [126.6, -46.0461], [126.7, -45.7842], [126.8, -45.5168], [126.9, -45.2438], [127, -44.9648], [127.1, -44.6795], [127.2, -44.3877], [127.3, -44.089], [127.4, -43.7831], [127.5, -43.4695], [127.6, -43.148], [127.7, -42.8181], [127.8, -42.4793], [127.9, -42.1312], [128, -41.7733], [128.1, -41.405], [128.2, -41.0257], [128.3, -40.6349], [128.4, -40.2318], [128.5, -39.8157], [128.6, -39.3858], [128.7, -38.9413], [128.8, -38.4812], [128.9, -38.0047], [129, -37.5105], [129.1, -36.9976], [129.2, -36.4646], [129.3, -35.9101], [129.4, -35.3327], [129.5, -34.7307], [129.6, -34.1022], [129.7, -33.4453], [129.8, -32.7577], [129.9, -32.037], [130, -31.2805], [130.1, -30.4851], [130.2, -68], [130.3, -67.8162], [130.4, -67.6343], [130.5, -67.4541], [130.6, -67.2755], [130.7, -67.0987], [130.8, -66.9233], [130.9, -66.7496], [131, -66.5772], [131.1, -66.4063], [131.2, -66.2367], [131.3, -66.0685], [131.4, -65.9015], [131.5, -65.7358], [131.6, -65.5712], [131.7, -65.4078], [131.8, -65.2455], [131.9, -65.0842], [132, -64.924], [132.1, -64.7648], [132.2, -64.6065], [132.3, -64.4491], [132.4, -64.2926], [132.5, -64.137], [132.6, -63.9821], [132.7, -63.8281], [132.8, -63.6749], [132.9, -63.5223], [133, -63.3705], [133.1, -63.2193], [133.2, -63.0688], [133.3, -62.9189], [133.4, -62.7696], [133.5, -62.6209], [133.6, -62.4727], [133.7, -62.3251], [133.8, -62.1779], [133.9, -62.0312], [134, -61.8849], [134.1, -61.7391], [134.2, -61.5937], [134.3, -61.4486], [134.4, -61.3039], [134.5, -61.1595], [134.6, -61.0155], [134.7, -60.8717], [134.8, -60.7282], [134.9, -60.5849], [135, -60.4419], [135.1, -60.2991], [135.2, -60.1564], [135.3, -60.0139], [135.4, -59.8716], [135.5, -59.7293], [135.6, -59.5872], [135.7, -59.4451], [135.8, -59.3031], [135.9, -59.1611], [136, -59.0191], [136.1, -58.8771], [136.2, -58.7351], [136.3, -58.5931], [136.4, -58.4509], [136.5, -58.3087], [136.6, -58.1663], [136.7, -58.0238], [136.8, -57.8811], [136.9, -57.7382], [137, -57.5951], [137.1, -57.4518], [137.2, -57.3082], [137.3, -57.1643], [137.4, -57.0202], [137.5, -56.8756], [137.6, -56.7307], [137.7, -56.5855], [137.8, -56.4398], [137.9, -56.2937], [138, -56.147], [138.1, -55.9999], [138.2, -55.8523], [138.3, -55.7041], [138.4, -55.5553], [138.5, -55.4059], [138.6, -55.2559], [138.7, -55.1052], [138.8, -54.9537], [138.9, -54.8015], [139, -54.6485], [139.1, -54.4947], [139.2, -54.34], [139.3, -54.1844], [139.4, -54.0279], [139.5, -53.8704], [139.6, -53.7119], [139.7, -53.5523], [139.8, -53.3916], [139.9, -53.2297], [140, -53.0666], [140.1, -52.9023], [140.2, -52.7367], [140.3, -52.5697], [140.4, -52.4013], [140.5, -52.2314], [140.6, -52.06], [140.7, -51.887], [140.8, -51.7124], [140.9, -51.536], [141, -51.3578], [141.1, -51.1778], [141.2, -50.9959], [141.3, -50.8119], [141.4, -50.6258], [141.5, -50.4376], [141.6, -50.2471], [141.7, -50.0543], [141.8, -49.859], [141.9, -49.6612], [142, -49.4607], [142.1, -49.2574], [142.2, -49.0513], [142.3, -48.8422], [142.4, -48.63], [142.5, -48.4146], [142.6, -48.1957], [142.7, -47.9734], [142.8, -47.7474], [142.9, -47.5175], [143, -47.2836], [143.1, -47.0456], [143.2, -46.8032], [143.3, -46.5563], [143.4, -46.3046], [143.5, -46.048], [143.6, -45.7861], [143.7, -45.5188], [143.8, -45.2459], [143.9, -44.9669], [144, -44.6817], [144.1, -44.3899], [144.2, -44.0913], [144.3, -43.7854], [144.4, -43.4719], [144.5, -43.1505], [144.6, -42.8206], [144.7, -42.4819], [144.8, -42.1339], [144.9, -41.776], [145, -41.4078], [145.1, -41.0286], [145.2, -40.6379], [145.3, -40.2349], [145.4, -39.8189], [145.5, -39.3891], [145.6, -38.9447], [145.7, -38.4848], [145.8, -38.0084], [145.9, -37.5143], [146, -37.0015], [146.1, -36.4687], [146.2, -35.9144], [146.3, -35.3372], [146.4, -34.7354], [146.5, -34.1072], [146.6, -33.4505], [146.7, -32.7631], [146.8, -32.0427], [146.9, -31.2864], [147, -30.4913], [147.1, -68], [147.2, -67.8162], [147.3, -67.6342], [147.4, -67.454], [147.5, -67.2755], [147.6, -67.0986], [147.7, -66.9233], [147.8, -66.7495], [147.9, -66.5771], [148, -66.4062], [148.1, -66.2366], [148.2, -66.0684], [148.3, -65.9014], [148.4, -65.7357], [148.5, -65.5711], [148.6, -65.4077], [148.7, -65.2453], [148.8, -65.0841], [148.9, -64.9238], [149, -64.7646], [149.1, -64.6063], [149.2, -64.4489], [149.3, -64.2924], [149.4, -64.1368], [149.5, -63.9819], [149.6, -63.8279], [149.7, -63.6746], [149.8, -63.5221], [149.9, -63.3703], [150, -63.2191], [150.1, -63.0686], [150.2, -62.9187], [150.3, -62.7694], [150.4, -62.6206], [150.5, -62.4725], [150.6, -62.3248], [150.7, -62.1776], [150.8, -62.0309], [150.9, -61.8846], [151, -61.7388], [151.1, -61.5934], [151.2, -61.4483], [151.3, -61.3036], [151.4, -61.1592], [151.5, -61.0151], [151.6, -60.8714], [151.7, -60.7279], [151.8, -60.5846], [151.9, -60.4416], [152, -60.2987], [152.1, -60.1561], [152.2, -60.0136], [152.3, -59.8712], [152.4, -59.729], [152.5, -59.5868], [152.6, -59.4447], [152.7, -59.3027], [152.8, -59.1607], [152.9, -59.0188], [153, -58.8768], [153.1, -58.7347], [153.2, -58.5927], [153.3, -58.4505], [153.4, -58.3083], [153.5, -58.1659], [153.6, -58.0234], [153.7, -57.8807], [153.8, -57.7378], [153.9, -57.5947], [154, -57.4514], [154.1, -57.3078], [154.2, -57.1639], [154.3, -57.0197], [154.4, -56.8752], [154.5, -56.7303], [154.6, -56.585], [154.7, -56.4393], [154.8, -56.2932], [154.9, -56.1466], [155, -55.9995], [155.1, -55.8518], [155.2, -55.7036], [155.3, -55.5549], [155.4, -55.4054], [155.5, -55.2554], [155.6, -55.1046], [155.7, -54.9532], [155.8, -54.801], [155.9, -54.648], [156, -54.4942], [156.1, -54.3395], [156.2, -54.1839], [156.3, -54.0273], [156.4, -53.8698], [156.5, -53.7113], [156.6, -53.5517], [156.7, -53.391], [156.8, -53.2291], [156.9, -53.066], [157, -52.9017], [157.1, -52.7361], [157.2, -52.5691], [157.3, -52.4007], [157.4, -52.2308], [157.5, -52.0594], [157.6, -51.8864], [157.7, -51.7117], [157.8, -51.5353], [157.9, -51.3572], [158, -51.1771], [158.1, -50.9952], [158.2, -50.8112], [158.3, -50.6251], [158.4, -50.4369], [158.5, -50.2464], [158.6, -50.0535], [158.7, -49.8582], [158.8, -49.6604], [158.9, -49.4599], [159, -49.2566], [159.1, -49.0505], [159.2, -48.8414], [159.3, -48.6292], [159.4, -48.4137], [159.5, -48.1949], [159.6, -47.9725], [159.7, -47.7464], [159.8, -47.5166], [159.9, -47.2827], [160, -47.0447], [160.1, -46.8023], [160.2, -46.5553], [160.3, -46.3036], [160.4, -46.0469], [160.5, -45.7851], [160.6, -45.5177], [160.7, -45.2447], [160.8, -44.9657], [160.9, -44.6805], [161, -44.3887], [161.1, -44.09], [161.2, -43.7841], [161.3, -43.4706], [161.4, -43.1491], [161.5, -42.8192], [161.6, -42.4805], [161.7, -42.1324], [161.8, -41.7745], [161.9, -41.4063], [162, -41.027], [162.1, -40.6362], [162.2, -40.2331], [162.3, -39.8171], [162.4, -39.3873], [162.5, -38.9428], [162.6, -38.4828], [162.7, -38.0063], [162.8, -37.5122], [162.9, -36.9993], [163, -36.4664], [163.1, -35.912], [163.2, -35.3347], [163.3, -34.7328], [163.4, -34.1044], [163.5, -33.4476], [163.6, -32.7601], [163.7, -32.0395], [163.8, -31.2831], [163.9, -30.4878], [164, -68], [164.1, -67.8162], [164.2, -67.6343], [164.3, -67.454], [164.4, -67.2755], [164.5, -67.0986], [164.6, -66.9233], [164.7, -66.7495], [164.8, -66.5772], [164.9, -66.4063], [165, -66.2367], [165.1, -66.0685], [165.2, -65.9015], [165.3, -65.7357], [165.4, -65.5712], [165.5, -65.4077], [165.6, -65.2454], [165.7, -65.0842], [165.8, -64.9239], [165.9, -64.7647], [166, -64.6064], [166.1, -64.449], [166.2, -64.2925], [166.3, -64.1369], [166.4, -63.9821], [166.5, -63.828], [166.6, -63.6748], [166.7, -63.5222], [166.8, -63.3704], [166.9, -63.2192], [167, -63.0687], [167.1, -62.9188], [167.2, -62.7695], [167.3, -62.6208], [167.4, -62.4726], [167.5, -62.3249], [167.6, -62.1778], [167.7, -62.031], [167.8, -61.8848], [167.9, -61.739], [168, -61.5935], [168.1, -61.4485], [168.2, -61.3038], [168.3, -61.1594], [168.4, -61.0153], [168.5, -60.8716], [168.6, -60.728], [168.7, -60.5848], [168.8, -60.4417], [168.9, -60.2989], [169, -60.1563], [169.1, -60.0138], [169.2, -59.8714], [169.3, -59.7292], [169.4, -59.587], [169.5, -59.4449], [169.6, -59.3029], [169.7, -59.1609], [169.8, -59.019], [169.9, -58.877], [170, -58.735], [170.1, -58.5929], [170.2, -58.4507], [170.3, -58.3085], [170.4, -58.1661], [170.5, -58.0236], [170.6, -57.8809], [170.7, -57.738], [170.8, -57.5949], [170.9, -57.4516], [171, -57.308], [171.1, -57.1641], [171.2, -57.02], [171.3, -56.8754], [171.4, -56.7305], [171.5, -56.5853], [171.6, -56.4396], [171.7, -56.2934], [171.8, -56.1468], [171.9, -55.9997], [172, -55.8521], [172.1, -55.7039], [172.2, -55.5551], [172.3, -55.4057], [172.4, -55.2557], [172.5, -55.1049], [172.6, -54.9535], [172.7, -54.8013], [172.8, -54.6483], [172.9, -54.4944], [173, -54.3398], [173.1, -54.1842], [173.2, -54.0277], [173.3, -53.8701], [173.4, -53.7116], [173.5, -53.552], [173.6, -53.3913], [173.7, -53.2294], [173.8, -53.0664], [173.9, -52.902], [174, -52.7364], [174.1, -52.5694], [174.2, -52.401], [174.3, -52.2311], [174.4, -52.0597], [174.5, -51.8867], [174.6, -51.7121], [174.7, -51.5357], [174.8, -51.3575], [174.9, -51.1775], [175, -50.9955], [175.1, -50.8116], [175.2, -50.6255], [175.3, -50.4373], [175.4, -50.2468], [175.5, -50.0539], [175.6, -49.8587], [175.7, -49.6608], [175.8, -49.4603], [175.9, -49.2571], [176, -49.051], [176.1, -48.8419], [176.2, -48.6296], [176.3, -48.4142], [176.4, -48.1953], [176.5, -47.973], [176.6, -47.7469], [176.7, -47.5171], [176.8, -47.2832], [176.9, -47.0452], [177, -46.8028], [177.1, -46.5559], [177.2, -46.3042], [177.3, -46.0475], [177.4, -45.7857], [177.5, -45.5183], [177.6, -45.2453], [177.7, -44.9664], [177.8, -44.6812], [177.9, -44.3894], [178, -44.0907], [178.1, -43.7848], [178.2, -43.4713], [178.3, -43.1499], [178.4, -42.82], [178.5, -42.4813], [178.6, -42.1332], [178.7, -41.7754], [178.8, -41.4071], [178.9, -41.0279], [179, -40.6371], [179.1, -40.2341], [179.2, -39.8181], [179.3, -39.3883], [179.4, -38.9439], [179.5, -38.4839], [179.6, -38.0074], [179.7, -37.5134], [179.8, -37.0005], [179.9, -36.4677], [180, -35.9134], [180.1, -35.3361], [180.2, -34.7342], [180.3, -34.1059], [180.4, -33.4492], [180.5, -32.7618], [180.6, -32.0413], [180.7, -31.2849], [180.8, -30.4898], [180.9, -68], [181, -67.8162], [181.1, -67.6342], [181.2, -67.454], [181.3, -67.2755], [181.4, -67.0986], [181.5, -66.9233], [181.6, -66.7495], [181.7, -66.5772], [181.8, -66.4062], [181.9, -66.2367], [182, -66.0684], [182.1, -65.9014], [182.2, -65.7357], [182.3, -65.5711], [182.4, -65.4077], [182.5, -65.2454], [182.6, -65.0841], [182.7, -64.9239], [182.8, -64.7646], [182.9, -64.6063], [183, -64.4489], [183.1, -64.2924], [183.2, -64.1368], [183.3, -63.982], [183.4, -63.828], [183.5, -63.6747], [183.6, -63.5221], [183.7, -63.3703], [183.8, -63.2191], [183.9, -63.0686], [184, -62.9187], [184.1, -62.7694], [184.2, -62.6207], [184.3, -62.4725], [184.4, -62.3248], [184.5, -62.1777], [184.6, -62.031], [184.7, -61.8847], [184.8, -61.7389], [184.9, -61.5934], [185, -61.4484], [185.1, -61.3037], [185.2, -61.1593], [185.3, -61.0152], [185.4, -60.8715], [185.5, -60.7279], [185.6, -60.5847], [185.7, -60.4416], [185.8, -60.2988], [185.9, -60.1561], [186, -60.0137], [186.1, -59.8713], [186.2, -59.7291], [186.3, -59.5869], [186.4, -59.4448], [186.5, -59.3028], [186.6, -59.1608], [186.7, -59.0188], [186.8, -58.8769], [186.9, -58.7348], [187, -58.5928], [187.1, -58.4506], [187.2, -58.3084], [187.3, -58.166], [187.4, -58.0235], [187.5, -57.8808], [187.6, -57.7379], [187.7, -57.5948], [187.8, -57.4515], [187.9, -57.3079], [188, -57.164], [188.1, -57.0198], [188.2, -56.8753], [188.3, -56.7304], [188.4, -56.5851], [188.5, -56.4394], [188.6, -56.2933], [188.7, -56.1467], [188.8, -55.9996], [188.9, -55.8519], [189, -55.7038], [189.1, -55.555], [189.2, -55.4056], [189.3, -55.2555], [189.4, -55.1048], [189.5, -54.9533], [189.6, -54.8011], [189.7, -54.6481], [189.8, -54.4943], [189.9, -54.3396], [190, -54.184], [190.1, -54.0275], [190.2, -53.87], [190.3, -53.7114], [190.4, -53.5518], [190.5, -53.3911], [190.6, -53.2293], [190.7, -53.0662], [190.8, -52.9019], [190.9, -52.7362], [191, -52.5692], [191.1, -52.4008], [191.2, -52.2309], [191.3, -52.0595], [191.4, -51.8865], [191.5, -51.7119], [191.6, -51.5355], [191.7, -51.3573], [191.8, -51.1773], [191.9, -50.9953], [192, -50.8114], [192.1, -50.6253], [192.2, -50.4371], [192.3, -50.2466], [192.4, -50.0537], [192.5, -49.8584], [192.6, -49.6606], [192.7, -49.4601], [192.8, -49.2568], [192.9, -49.0507], [193, -48.8416], [193.1, -48.6294], [193.2, -48.4139], [193.3, -48.1951], [193.4, -47.9727], [193.5, -47.7467], [193.6, -47.5168], [193.7, -47.2829], [193.8, -47.0449], [193.9, -46.8025], [194, -46.5556], [194.1, -46.3039], [194.2, -46.0472], [194.3, -45.7853], [194.4, -45.518], [194.5, -45.245], [194.6, -44.966], [194.7, -44.6808], [194.8, -44.389], [194.9, -44.0903], [195, -43.7844], [195.1, -43.4709], [195.2, -43.1494], [195.3, -42.8196], [195.4, -42.4808], [195.5, -42.1328], [195.6, -41.7749], [195.7, -41.4066], [195.8, -41.0274], [195.9, -40.6366], [196, -40.2336], [196.1, -39.8175], [196.2, -39.3877], [196.3, -38.9433], [196.4, -38.4833], [196.5, -38.0068], [196.6, -37.5127], [196.7, -36.9999], [196.8, -36.467], [196.9, -35.9126], [197, -35.3354], [197.1, -34.7335], [197.2, -34.1051], [197.3, -33.4483], [197.4, -32.7609], [197.5, -32.0403], [197.6, -31.2839], [197.7, -30.4887], [197.8, -68], [197.9, -67.8162], [198, -67.6343], [198.1, -67.454], [198.2, -67.2755], [198.3, -67.0986], [198.4, -66.9233], [198.5, -66.7495], [198.6, -66.5772], [198.7, -66.4062], [198.8, -66.2367], [198.9, -66.0684], [199, -65.9015], [199.1, -65.7357], [199.2, -65.5712], [199.3, -65.4077], [199.4, -65.2454], [199.5, -65.0841], [199.6, -64.9239], [199.7, -64.7647], [199.8, -64.6064], [199.9, -64.449], [200, -64.2925], [200.1, -64.1368], [200.2, -63.982], [200.3, -63.828], [200.4, -63.6747], [200.5, -63.5222], [200.6, -63.3703], [200.7, -63.2192], [200.8, -63.0687], [200.9, -62.9188], [201, -62.7695], [201.1, -62.6207], [201.2, -62.4726], [201.3, -62.3249], [201.4, -62.1777], [201.5, -62.031], [201.6, -61.8848], [201.7, -61.7389], [201.8, -61.5935], [201.9, -61.4484], [202, -61.3037], [202.1, -61.1593], [202.2, -61.0153], [202.3, -60.8715], [202.4, -60.728], [202.5, -60.5847], [202.6, -60.4417], [202.7, -60.2989], [202.8, -60.1562], [202.9, -60.0137], [203, -59.8714], [203.1, -59.7291], [203.2, -59.587], [203.3, -59.4449], [203.4, -59.3029], [203.5, -59.1609], [203.6, -59.0189], [203.7, -58.8769], [203.8, -58.7349], [203.9, -58.5928], [204, -58.4507], [204.1, -58.3084], [204.2, -58.1661], [204.3, -58.0235], [204.4, -57.8808], [204.5, -57.738], [204.6, -57.5949], [204.7, -57.4516], [204.8, -57.308], [204.9, -57.1641], [205, -57.0199], [205.1, -56.8754], [205.2, -56.7305], [205.3, -56.5852], [205.4, -56.4395], [205.5, -56.2934], [205.6, -56.1468], [205.7, -55.9997], [205.8, -55.852], [205.9, -55.7038], [206, -55.5551], [206.1, -55.4057], [206.2, -55.2556], [206.3, -55.1049], [206.4, -54.9534], [206.5, -54.8012], [206.6, -54.6482], [206.7, -54.4944], [206.8, -54.3397], [206.9, -54.1841], [207, -54.0276], [207.1, -53.8701], [207.2, -53.7115], [207.3, -53.5519], [207.4, -53.3912], [207.5, -53.2294], [207.6, -53.0663], [207.7, -52.902], [207.8, -52.7363], [207.9, -52.5693], [208, -52.4009], [208.1, -52.231], [208.2, -52.0596], [208.3, -51.8866], [208.4, -51.712], [208.5, -51.5356], [208.6, -51.3574], [208.7, -51.1774], [208.8, -50.9955], [208.9, -50.8115], [209, -50.6254], [209.1, -50.4372], [209.2, -50.2467], [209.3, -50.0538], [209.4, -49.8585], [209.5, -49.6607], [209.6, -49.4602], [209.7, -49.257], [209.8, -49.0508], [209.9, -48.8417], [210, -48.6295], [210.1, -48.4141], [210.2, -48.1952], [210.3, -47.9729], [210.4, -47.7468], [210.5, -47.517], [210.6, -47.2831], [210.7, -47.0451], [210.8, -46.8027], [210.9, -46.5557], [211, -46.304], [211.1, -46.0474], [211.2, -45.7855], [211.3, -45.5182], [211.4, -45.2452], [211.5, -44.9662], [211.6, -44.681], [211.7, -44.3892], [211.8, -44.0905], [211.9, -43.7846], [212, -43.4712], [212.1, -43.1497], [212.2, -42.8198], [212.3, -42.4811], [212.4, -42.133], [212.5, -41.7752], [212.6, -41.4069], [212.7, -41.0277], [212.8, -40.6369], [212.9, -40.2339], [213, -39.8178], [213.1, -39.388], [213.2, -38.9436], [213.3, -38.4836], [213.4, -38.0072], [213.5, -37.5131], [213.6, -37.0002], [213.7, -36.4674], [213.8, -35.913], [213.9, -35.3358], [214, -34.7339], [214.1, -34.1056], [214.2, -33.4488], [214.3, -32.7614], [214.4, -32.0408], [214.5, -31.2845], [214.6, -30.4893], [214.7, -68], [214.8, -67.8162], [214.9, -67.6342], [215, -67.454], [215.1, -67.2755], [215.2, -67.0986], [215.3, -66.9233], [215.4, -66.7495], [215.5, -66.5772], [215.6, -66.4062], [215.7, -66.2367], [215.8, -66.0684], [215.9, -65.9015], [216, -65.7357], [216.1, -65.5711], [216.2, -65.4077], [216.3, -65.2454], [216.4, -65.0841], [216.5, -64.9239], [216.6, -64.7646], [216.7, -64.6063], [216.8, -64.449], [216.9, -64.2925], [217, -64.1368], [217.1, -63.982], [217.2, -63.828], [217.3, -63.6747], [217.4, -63.5222], [217.5, -63.3703], [217.6, -63.2192], [217.7, -63.0687], [217.8, -62.9188], [217.9, -62.7695], [218, -62.6207], [218.1, -62.4725], [218.2, -62.3249], [218.3, -62.1777], [218.4, -62.031], [218.5, -61.8847], [218.6, -61.7389], [218.7, -61.5935], [218.8, -61.4484], [218.9, -61.3037], [219, -61.1593], [219.1, -61.0153], [219.2, -60.8715], [219.3, -60.728], [219.4, -60.5847], [219.5, -60.4417], [219.6, -60.2988], [219.7, -60.1562], [219.8, -60.0137], [219.9, -59.8713], [220, -59.7291], [220.1, -59.5869], [220.2, -59.4449], [220.3, -59.3028], [220.4, -59.1609], [220.5, -59.0189], [220.6, -58.8769], [220.7, -58.7349], [220.8, -58.5928], [220.9, -58.4506], [221, -58.3084], [221.1, -58.166], [221.2, -58.0235], [221.3, -57.8808], [221.4, -57.7379], [221.5, -57.5948], [221.6, -57.4515], [221.7, -57.3079], [221.8, -57.164], [221.9, -57.0199], [222, -56.8753], [222.1, -56.7304], [222.2, -56.5852], [222.3, -56.4395], [222.4, -56.2933], [222.5, -56.1467], [222.6, -55.9996], [222.7, -55.852], [222.8, -55.7038], [222.9, -55.555], [223, -55.4056], [223.1, -55.2556], [223.2, -55.1048], [223.3, -54.9534], [223.4, -54.8011], [223.5, -54.6481], [223.6, -54.4943], [223.7, -54.3396], [223.8, -54.1841], [223.9, -54.0275], [224, -53.87], [224.1, -53.7115], [224.2, -53.5519], [224.3, -53.3912], [224.4, -53.2293], [224.5, -53.0662], [224.6, -52.9019], [224.7, -52.7363], [224.8, -52.5693], [224.9, -52.4009], [225, -52.231], [225.1, -52.0596], [225.2, -51.8866], [225.3, -51.7119], [225.4, -51.5355], [225.5, -51.3574], [225.6, -51.1773], [225.7, -50.9954], [225.8, -50.8114], [225.9, -50.6254], [226, -50.4371], [226.1, -50.2466], [226.2, -50.0538], [226.3, -49.8585], [226.4, -49.6606], [226.5, -49.4601], [226.6, -49.2569], [226.7, -49.0508], [226.8, -48.8417], [226.9, -48.6294], [227, -48.414], [227.1, -48.1951], [227.2, -47.9728], [227.3, -47.7467], [227.4, -47.5169], [227.5, -47.283], [227.6, -47.045], [227.7, -46.8026], [227.8, -46.5556], [227.9, -46.3039], [228, -46.0473], [228.1, -45.7854], [228.2, -45.5181], [228.3, -45.2451], [228.4, -44.9661], [228.5, -44.6809], [228.6, -44.3891], [228.7, -44.0904], [228.8, -43.7845], [228.9, -43.471], [229, -43.1495], [229.1, -42.8197], [229.2, -42.4809], [229.3, -42.1329], [229.4, -41.775], [229.5, -41.4068], [229.6, -41.0276], [229.7, -40.6368], [229.8, -40.2337], [229.9, -39.8177], [230, -39.3878], [230.1, -38.9434], [230.2, -38.4835], [230.3, -38.007], [230.4, -37.5129], [230.5, -37], [230.6, -36.4671], [230.7, -35.9128], [230.8, -35.3355], [230.9, -34.7336], [231, -34.1053], [231.1, -33.4485], [231.2, -32.7611], [231.3, -32.0405], [231.4, -31.2842], [231.5, -30.489], [231.6, -68], [231.7, -67.8162], [231.8, -67.6343], [231.9, -67.454], [232, -67.2755], [232.1, -67.0986], [232.2, -66.9233], [232.3, -66.7495], [232.4, -66.5772], [232.5, -66.4062], [232.6, -66.2367], [232.7, -66.0684], [232.8, -65.9015], [232.9, -65.7357], [233, -65.5711], [233.1, -65.4077], [233.2, -65.2454], [233.3, -65.0841], [233.4, -64.9239], [233.5, -64.7646], [233.6, -64.6063], [233.7, -64.449], [233.8, -64.2925], [233.9, -64.1368], [234, -63.982], [234.1, -63.828], [234.2, -63.6747], [234.3, -63.5222], [234.4, -63.3703], [234.5, -63.2192], [234.6, -63.0687], [234.7, -62.9188], [234.8, -62.7695], [234.9, -62.6207], [235, -62.4726], [235.1, -62.3249], [235.2, -62.1777], [235.3, -62.031], [235.4, -61.8847], [235.5, -61.7389], [235.6, -61.5935], [235.7, -61.4484], [235.8, -61.3037], [235.9, -61.1593], [236, -61.0153], [236.1, -60.8715], [236.2, -60.728], [236.3, -60.5847], [236.4, -60.4417], [236.5, -60.2988], [236.6, -60.1562], [236.7, -60.0137], [236.8, -59.8713], [236.9, -59.7291], [237, -59.587], [237.1, -59.4449], [237.2, -59.3029], [237.3, -59.1609], [237.4, -59.0189], [237.5, -58.8769], [237.6, -58.7349], [237.7, -58.5928], [237.8, -58.4507], [237.9, -58.3084], [238, -58.166], [238.1, -58.0235], [238.2, -57.8808], [238.3, -57.738], [238.4, -57.5949], [238.5, -57.4515], [238.6, -57.3079], [238.7, -57.1641], [238.8, -57.0199], [238.9, -56.8754], [239, -56.7305], [239.1, -56.5852], [239.2, -56.4395], [239.3, -56.2934], [239.4, -56.1468], [239.5, -55.9996], [239.6, -55.852], [239.7, -55.7038], [239.8, -55.555], [239.9, -55.4056], [240, -55.2556], [240.1, -55.1048], [240.2, -54.9534], [240.3, -54.8012], [240.4, -54.6482], [240.5, -54.4944], [240.6, -54.3397], [240.7, -54.1841], [240.8, -54.0276], [240.9, -53.87], [241, -53.7115], [241.1, -53.5519], [241.2, -53.3912], [241.3, -53.2293], [241.4, -53.0663], [241.5, -52.9019], [241.6, -52.7363], [241.7, -52.5693], [241.8, -52.4009], [241.9, -52.231], [242, -52.0596], [242.1, -51.8866], [242.2, -51.712], [242.3, -51.5356], [242.4, -51.3574], [242.5, -51.1774], [242.6, -50.9954], [242.7, -50.8115], [242.8, -50.6254], [242.9, -50.4372], [243, -50.2467], [243.1, -50.0538], [243.2, -49.8585], [243.3, -49.6607], [243.4, -49.4602], [243.5, -49.2569], [243.6, -49.0508], [243.7, -48.8417], [243.8, -48.6295], [243.9, -48.414], [244, -48.1952], [244.1, -47.9728], [244.2, -47.7468], [244.3, -47.5169], [244.4, -47.2831], [244.5, -47.045], [244.6, -46.8026], [244.7, -46.5557], [244.8, -46.304], [244.9, -46.0473], [245, -45.7855], [245.1, -45.5182], [245.2, -45.2451], [245.3, -44.9662], [245.4, -44.6809], [245.5, -44.3892], [245.6, -44.0905], [245.7, -43.7846], [245.8, -43.4711], [245.9, -43.1496], [246, -42.8197], [246.1, -42.481], [246.2, -42.133], [246.3, -41.7751], [246.4, -41.4068], [246.5, -41.0276], [246.6, -40.6368], [246.7, -40.2338], [246.8, -39.8178], [246.9, -39.3879], [247, -38.9435], [247.1, -38.4836], [247.2, -38.0071], [247.3, -37.513], [247.4, -37.0002], [247.5, -36.4673], [247.6, -35.9129], [247.7, -35.3357], [247.8, -34.7338], [247.9, -34.1055], [248, -33.4487], [248.1, -32.7613], [248.2, -32.0407], [248.3, -31.2843], [248.4, -30.4891], [248.5, -68], [248.6, -67.8162], [248.7, -67.6342], [248.8, -67.454], [248.9, -67.2755], [249, -67.0986], [249.1, -66.9233], [249.2, -66.7495], [249.3, -66.5772], [249.4, -66.4062], [249.5, -66.2367], [249.6, -66.0684], [249.7, -65.9015], [249.8, -65.7357], [249.9, -65.5711], [250, -65.4077], [250.1, -65.2454], [250.2, -65.0841], [250.3, -64.9239], [250.4, -64.7646], [250.5, -64.6063], [250.6, -64.449], [250.7, -64.2925], [250.8, -64.1368], [250.9, -63.982], [251, -63.828], [251.1, -63.6747], [251.2, -63.5222], [251.3, -63.3703], [251.4, -63.2192], [251.5, -63.0687], [251.6, -62.9188], [251.7, -62.7695], [251.8, -62.6207], [251.9, -62.4725], [252, -62.3249], [252.1, -62.1777], [252.2, -62.031], [252.3, -61.8847], [252.4, -61.7389], [252.5, -61.5935], [252.6, -61.4484], [252.7, -61.3037], [252.8, -61.1593], [252.9, -61.0153], [253, -60.8715], [253.1, -60.728], [253.2, -60.5847], [253.3, -60.4417], [253.4, -60.2988], [253.5, -60.1562], [253.6, -60.0137], [253.7, -59.8713], [253.8, -59.7291], [253.9, -59.5869], [254, -59.4449], [254.1, -59.3028], [254.2, -59.1609], [254.3, -59.0189], [254.4, -58.8769], [254.5, -58.7349], [254.6, -58.5928], [254.7, -58.4506], [254.8, -58.3084], [254.9, -58.166], [255, -58.0235], [255.1, -57.8808], [255.2, -57.7379], [255.3, -57.5949], [255.4, -57.4515], [255.5, -57.3079], [255.6, -57.1641], [255.7, -57.0199], [255.8, -56.8753], [255.9, -56.7305], [256, -56.5852], [256.1, -56.4395], [256.2, -56.2933], [256.3, -56.1467], [256.4, -55.9996], [256.5, -55.852], [256.6, -55.7038], [256.7, -55.555], [256.8, -55.4056], [256.9, -55.2556], [257, -55.1048], [257.1, -54.9534], [257.2, -54.8012], [257.3, -54.6482], [257.4, -54.4943], [257.5, -54.3397], [257.6, -54.1841], [257.7, -54.0275], [257.8, -53.87], [257.9, -53.7115], [258, -53.5519], [258.1, -53.3912], [258.2, -53.2293], [258.3, -53.0663], [258.4, -52.9019], [258.5, -52.7363], [258.6, -52.5693], [258.7, -52.4009], [258.8, -52.231], [258.9, -52.0596], [259, -51.8866], [259.1, -51.7119], [259.2, -51.5356], [259.3, -51.3574], [259.4, -51.1774], [259.5, -50.9954], [259.6, -50.8114], [259.7, -50.6254], [259.8, -50.4371], [259.9, -50.2466], [260, -50.0538], [260.1, -49.8585], [260.2, -49.6607], [260.3, -49.4602], [260.4, -49.2569], [260.5, -49.0508], [260.6, -48.8417], [260.7, -48.6295], [260.8, -48.414], [260.9, -48.1952], [261, -47.9728], [261.1, -47.7468], [261.2, -47.5169], [261.3, -47.283], [261.4, -47.045], [261.5, -46.8026], [261.6, -46.5557], [261.7, -46.304], [261.8, -46.0473], [261.9, -45.7854], [262, -45.5181], [262.1, -45.2451], [262.2, -44.9661], [262.3, -44.6809], [262.4, -44.3891], [262.5, -44.0905], [262.6, -43.7846], [262.7, -43.4711], [262.8, -43.1496], [262.9, -42.8197], [263, -42.481], [263.1, -42.1329], [263.2, -41.775], [263.3, -41.4068], [263.4, -41.0276], [263.5, -40.6368], [263.6, -40.2337], [263.7, -39.8177], [263.8, -39.3879], [263.9, -38.9435], [264, -38.4835], [264.1, -38.007], [264.2, -37.5129], [264.3, -37.0001], [264.4, -36.4672], [264.5, -35.9129], [264.6, -35.3356], [264.7, -34.7337], [264.8, -34.1054], [264.9, -33.4486], [265, -32.7612], [265.1, -32.0406], [265.2, -31.2843], [265.3, -30.489], [265.4, -68], [265.5, -67.8162], [265.6, -67.6342], [265.7, -67.454], [265.8, -67.2755], [265.9, -67.0986], [266, -66.9233], [266.1, -66.7495], [266.2, -66.5772], [266.3, -66.4062], [266.4, -66.2367], [266.5, -66.0684], [266.6, -65.9015], [266.7, -65.7357], [266.8, -65.5711], [266.9, -65.4077], [267, -65.2454], [267.1, -65.0841], [267.2, -64.9239], [267.3, -64.7646], [267.4, -64.6063], [267.5, -64.449], [267.6, -64.2925], [267.7, -64.1368], [267.8, -63.982], [267.9, -63.828], [268, -63.6747], [268.1, -63.5222], [268.2, -63.3703], [268.3, -63.2192], [268.4, -63.0687], [268.5, -62.9188], [268.6, -62.7695], [268.7, -62.6207], [268.8, -62.4725], [268.9, -62.3249], [269, -62.1777], [269.1, -62.031], [269.2, -61.8847], [269.3, -61.7389], [269.4, -61.5935], [269.5, -61.4484], [269.6, -61.3037], [269.7, -61.1593], [269.8, -61.0153], [269.9, -60.8715], [270, -60.728], [270.1, -60.5847], [270.2, -60.4417], [270.3, -60.2988], [270.4, -60.1562], [270.5, -60.0137], [270.6, -59.8713], [270.7, -59.7291], [270.8, -59.5869], [270.9, -59.4449], [271, -59.3029], [271.1, -59.1609], [271.2, -59.0189], [271.3, -58.8769], [271.4, -58.7349], [271.5, -58.5928], [271.6, -58.4507], [271.7, -58.3084], [271.8, -58.166], [271.9, -58.0235], [272, -57.8808], [272.1, -57.7379], [272.2, -57.5949], [272.3, -57.4515], [272.4, -57.3079], [272.5, -57.1641], [272.6, -57.0199], [272.7, -56.8753], [272.8, -56.7305], [272.9, -56.5852], [273, -56.4395], [273.1, -56.2934], [273.2, -56.1467], [273.3, -55.9996], [273.4, -55.852], [273.5, -55.7038], [273.6, -55.555], [273.7, -55.4056], [273.8, -55.2556], [273.9, -55.1048], [274, -54.9534], [274.1, -54.8012], [274.2, -54.6482], [274.3, -54.4943], [274.4, -54.3397], [274.5, -54.1841], [274.6, -54.0275], [274.7, -53.87], [274.8, -53.7115], [274.9, -53.5519], [275, -53.3912], [275.1, -53.2293], [275.2, -53.0663], [275.3, -52.9019], [275.4, -52.7363], [275.5, -52.5693], [275.6, -52.4009], [275.7, -52.231], [275.8, -52.0596], [275.9, -51.8866], [276, -51.7119], [276.1, -51.5356], [276.2, -51.3574], [276.3, -51.1774], [276.4, -50.9954], [276.5, -50.8114], [276.6, -50.6254], [276.7, -50.4371], [276.8, -50.2467], [276.9, -50.0538], [277, -49.8585], [277.1, -49.6607], [277.2, -49.4602], [277.3, -49.2569], [277.4, -49.0508], [277.5, -48.8417], [277.6, -48.6295], [277.7, -48.414], [277.8, -48.1952], [277.9, -47.9728], [278, -47.7468], [278.1, -47.5169], [278.2, -47.283], [278.3, -47.045], [278.4, -46.8026], [278.5, -46.5557], [278.6, -46.304], [278.7, -46.0473], [278.8, -45.7854], [278.9, -45.5181], [279, -45.2451], [279.1, -44.9662], [279.2, -44.6809], [279.3, -44.3891], [279.4, -44.0905], [279.5, -43.7846], [279.6, -43.4711], [279.7, -43.1496], [279.8, -42.8197], [279.9, -42.481], [280, -42.1329], [280.1, -41.7751], [280.2, -41.4068], [280.3, -41.0276], [280.4, -40.6368], [280.5, -40.2338], [280.6, -39.8177], [280.7, -39.3879], [280.8, -38.9435], [280.9, -38.4835], [281, -38.0071], [281.1, -37.513], [281.2, -37.0001], [281.3, -36.4672], [281.4, -35.9129], [281.5, -35.3356], [281.6, -34.7338], [281.7, -34.1054], [281.8, -33.4487], [281.9, -32.7612], [282, -32.0407], [282.1, -31.2843], [282.2, -30.4891], [282.3, -68], [282.4, -67.8162], [282.5, -67.6342], [282.6, -67.454], [282.7, -67.2755], [282.8, -67.0986], [282.9, -66.9233], [283, -66.7495], [283.1, -66.5772], [283.2, -66.4062], [283.3, -66.2367], [283.4, -66.0684], [283.5, -65.9015], [283.6, -65.7357], [283.7, -65.5711], [283.8, -65.4077], [283.9, -65.2454], [284, -65.0841], [284.1, -64.9239], [284.2, -64.7646], [284.3, -64.6063], [284.4, -64.449], [284.5, -64.2925], [284.6, -64.1368], [284.7, -63.982], [284.8, -63.828], [284.9, -63.6747], [285, -63.5222], [285.1, -63.3703], [285.2, -63.2192], [285.3, -63.0687], [285.4, -62.9188], [285.5, -62.7695], [285.6, -62.6207], [285.7, -62.4725], [285.8, -62.3249], [285.9, -62.1777], [286, -62.031], [286.1, -61.8847], [286.2, -61.7389], [286.3, -61.5935], [286.4, -61.4484], [286.5, -61.3037], [286.6, -61.1593], [286.7, -61.0153], [286.8, -60.8715], [286.9, -60.728], [287, -60.5847], [287.1, -60.4417], [287.2, -60.2988], [287.3, -60.1562], [287.4, -60.0137], [287.5, -59.8713], [287.6, -59.7291], [287.7, -59.5869], [287.8, -59.4449], [287.9, -59.3029], [288, -59.1609], [288.1, -59.0189], [288.2, -58.8769], [288.3, -58.7349], [288.4, -58.5928], [288.5, -58.4507], [288.6, -58.3084], [288.7, -58.166], [288.8, -58.0235], [288.9, -57.8808], [289, -57.7379], [289.1, -57.5949], [289.2, -57.4515], [289.3, -57.3079], [289.4, -57.1641], [289.5, -57.0199], [289.6, -56.8753], [289.7, -56.7305], [289.8, -56.5852], [289.9, -56.4395], [290, -56.2933], [290.1, -56.1467], [290.2, -55.9996], [290.3, -55.852], [290.4, -55.7038], [290.5, -55.555], [290.6, -55.4056], [290.7, -55.2556], [290.8, -55.1048], [290.9, -54.9534], [291, -54.8012], [291.1, -54.6482], [291.2, -54.4943], [291.3, -54.3397], [291.4, -54.1841], [291.5, -54.0275], [291.6, -53.87], [291.7, -53.7115], [291.8, -53.5519], [291.9, -53.3912], [292, -53.2293], [292.1, -53.0663], [292.2, -52.9019], [292.3, -52.7363], [292.4, -52.5693], [292.5, -52.4009], [292.6, -52.231], [292.7, -52.0596], [292.8, -51.8866], [292.9, -51.7119], [293, -51.5356], [293.1, -51.3574], [293.2, -51.1774], [293.3, -50.9954], [293.4, -50.8114], [293.5, -50.6254], [293.6, -50.4371], [293.7, -50.2466], [293.8, -50.0538], [293.9, -49.8585], [294, -49.6607], [294.1, -49.4602], [294.2, -49.2569], [294.3, -49.0508], [294.4, -48.8417], [294.5, -48.6295], [294.6, -48.414], [294.7, -48.1952], [294.8, -47.9728], [294.9, -47.7468], [295, -47.5169], [295.1, -47.283], [295.2, -47.045], [295.3, -46.8026], [295.4, -46.5557], [295.5, -46.304], [295.6, -46.0473], [295.7, -45.7854], [295.8, -45.5181], [295.9, -45.2451], [296, -44.9661], [296.1, -44.6809], [296.2, -44.3891], [296.3, -44.0905], [296.4, -43.7846], [296.5, -43.4711], [296.6, -43.1496], [296.7, -42.8197], [296.8, -42.481], [296.9, -42.1329], [297, -41.7751], [297.1, -41.4068], [297.2, -41.0276], [297.3, -40.6368], [297.4, -40.2338], [297.5, -39.8177], [297.6, -39.3879], [297.7, -38.9435], [297.8, -38.4835], [297.9, -38.007], [298, -37.513], [298.1, -37.0001], [298.2, -36.4672], [298.3, -35.9129], [298.4, -35.3356], [298.5, -34.7337], [298.6, -34.1054], [298.7, -33.4486], [298.8, -32.7612], [298.9, -32.0406], [299, -31.2843], [299.1, -30.4891], [299.2, -68], [299.3, -67.8162], [299.4, -67.6342], [299.5, -67.454], [299.6, -67.2755], [299.7, -67.0986], [299.8, -66.9233], [299.9, -66.7495], [300, -66.5772], [300.1, -66.4062], [300.2, -66.2367], [300.3, -66.0684], [300.4, -65.9015], [300.5, -65.7357], [300.6, -65.5711], [300.7, -65.4077], [300.8, -65.2454], [300.9, -65.0841], [301, -64.9239], [301.1, -64.7646], [301.2, -64.6063], [301.3, -64.449], [301.4, -64.2925], [301.5, -64.1368], [301.6, -63.982], [301.7, -63.828], [301.8, -63.6747], [301.9, -63.5222], [302, -63.3703], [302.1, -63.2192], [302.2, -63.0687], [302.3, -62.9188], [302.4, -62.7695], [302.5, -62.6207], [302.6, -62.4725], [302.7, -62.3249], [302.8, -62.1777], [302.9, -62.031], [303, -61.8847], [303.1, -61.7389], [303.2, -61.5935], [303.3, -61.4484], [303.4, -61.3037], [303.5, -61.1593], [303.6, -61.0153], [303.7, -60.8715], [303.8, -60.728], [303.9, -60.5847], [304, -60.4417], [304.1, -60.2988], [304.2, -60.1562], [304.3, -60.0137], [304.4, -59.8713], [304.5, -59.7291], [304.6, -59.5869], [304.7, -59.4449], [304.8, -59.3029], [304.9, -59.1609], [305, -59.0189], [305.1, -58.8769], [305.2, -58.7349], [305.3, -58.5928], [305.4, -58.4507], [305.5, -58.3084], [305.6, -58.166], [305.7, -58.0235], [305.8, -57.8808], [305.9, -57.7379], [306, -57.5949], [306.1, -57.4515], [306.2, -57.3079], [306.3, -57.1641], [306.4, -57.0199], [306.5, -56.8753], [306.6, -56.7305], [306.7, -56.5852], [306.8, -56.4395], [306.9, -56.2934], [307, -56.1467], [307.1, -55.9996], [307.2, -55.852], [307.3, -55.7038], [307.4, -55.555], [307.5, -55.4056], [307.6, -55.2556], [307.7, -55.1048], [307.8, -54.9534], [307.9, -54.8012], [308, -54.6482], [308.1, -54.4943], [308.2, -54.3397], [308.3, -54.1841], [308.4, -54.0275], [308.5, -53.87], [308.6, -53.7115], [308.7, -53.5519], [308.8, -53.3912], [308.9, -53.2293], [309, -53.0663], [309.1, -52.9019], [309.2, -52.7363], [309.3, -52.5693], [309.4, -52.4009], [309.5, -52.231], [309.6, -52.0596], [309.7, -51.8866], [309.8, -51.7119], [309.9, -51.5356], [310, -51.3574], [310.1, -51.1774], [310.2, -50.9954], [310.3, -50.8114], [310.4, -50.6254], [310.5, -50.4371], [310.6, -50.2466], [310.7, -50.0538], [310.8, -49.8585], [310.9, -49.6607], [311, -49.4602], [311.1, -49.2569], [311.2, -49.0508], [311.3, -48.8417], [311.4, -48.6295], [311.5, -48.414], [311.6, -48.1952], [311.7, -47.9728], [311.8, -47.7468], [311.9, -47.5169], [312, -47.283], [312.1, -47.045], [312.2, -46.8026], [312.3, -46.5557], [312.4, -46.304], [312.5, -46.0473], [312.6, -45.7854], [312.7, -45.5181], [312.8, -45.2451], [312.9, -44.9662], [313, -44.6809], [313.1, -44.3891], [313.2, -44.0905], [313.3, -43.7846], [313.4, -43.4711], [313.5, -43.1496], [313.6, -42.8197], [313.7, -42.481], [313.8, -42.1329], [313.9, -41.7751], [314, -41.4068], [314.1, -41.0276], [314.2, -40.6368], [314.3, -40.2338], [314.4, -39.8177], [314.5, -39.3879], [314.6, -38.9435], [314.7, -38.4835], [314.8, -38.007], [314.9, -37.513], [315, -37.0001], [315.1, -36.4672], [315.2, -35.9129], [315.3, -35.3356], [315.4, -34.7337], [315.5, -34.1054], [315.6, -33.4486], [315.7, -32.7612], [315.8, -32.0407], [315.9, -31.2843], [316, -30.4891], [316.1, -68], [316.2, -67.8162], [316.3, -67.6342], [316.4, -67.454], [316.5, -67.2755], [316.6, -67.0986], [316.7, -66.9233], [316.8, -66.7495], [316.9, -66.5772], [317, -66.4062], [317.1, -66.2367], [317.2, -66.0684], [317.3, -65.9015], [317.4, -65.7357], [317.5, -65.5711], [317.6, -65.4077], [317.7, -65.2454], [317.8, -65.0841], [317.9, -64.9239], [318, -64.7646], [318.1, -64.6063], [318.2, -64.449], [318.3, -64.2925], [318.4, -64.1368], [318.5, -63.982], [318.6, -63.828], [318.7, -63.6747], [318.8, -63.5222], [318.9, -63.3703], [319, -63.2192], [319.1, -63.0687], [319.2, -62.9188], [319.3, -62.7695], [319.4, -62.6207], [319.5, -62.4725], [319.6, -62.3249], [319.7, -62.1777], [319.8, -62.031], [319.9, -61.8847], [320, -61.7389], [320.1, -61.5935], [320.2, -61.4484], [320.3, -61.3037], [320.4, -61.1593], [320.5, -61.0153], [320.6, -60.8715], [320.7, -60.728], [320.8, -60.5847], [320.9, -60.4417], [321, -60.2988], [321.1, -60.1562], [321.2, -60.0137], [321.3, -59.8713], [321.4, -59.7291], [321.5, -59.5869], [321.6, -59.4449], [321.7, -59.3029], [321.8, -59.1609], [321.9, -59.0189], [322, -58.8769], [322.1, -58.7349], [322.2, -58.5928], [322.3, -58.4507], [322.4, -58.3084], [322.5, -58.166], [322.6, -58.0235], [322.7, -57.8808], [322.8, -57.7379], [322.9, -57.5949], [323, -57.4515], [323.1, -57.3079], [323.2, -57.1641], [323.3, -57.0199], [323.4, -56.8753], [323.5, -56.7305], [323.6, -56.5852], [323.7, -56.4395], [323.8, -56.2934], [323.9, -56.1467], [324, -55.9996], [324.1, -55.852], [324.2, -55.7038], [324.3, -55.555], [324.4, -55.4056], [324.5, -55.2556], [324.6, -55.1048], [324.7, -54.9534], [324.8, -54.8012], [324.9, -54.6482], [325, -54.4943], [325.1, -54.3397], [325.2, -54.1841], [325.3, -54.0275], [325.4, -53.87], [325.5, -53.7115], [325.6, -53.5519], [325.7, -53.3912], [325.8, -53.2293], [325.9, -53.0663], [326, -52.9019], [326.1, -52.7363], [326.2, -52.5693], [326.3, -52.4009], [326.4, -52.231], [326.5, -52.0596], [326.6, -51.8866], [326.7, -51.7119], [326.8, -51.5356], [326.9, -51.3574], [327, -51.1774], [327.1, -50.9954], [327.2, -50.8114], [327.3, -50.6254], [327.4, -50.4371], [327.5, -50.2466], [327.6, -50.0538], [327.7, -49.8585], [327.8, -49.6607], [327.9, -49.4602], [328, -49.2569], [328.1, -49.0508], [328.2, -48.8417], [328.3, -48.6295], [328.4, -48.414], [328.5, -48.1952], [328.6, -47.9728], [328.7, -47.7468], [328.8, -47.5169], [328.9, -47.283], [329, -47.045], [329.1, -46.8026], [329.2, -46.5557], [329.3, -46.304], [329.4, -46.0473], [329.5, -45.7854], [329.6, -45.5181], [329.7, -45.2451], [329.8, -44.9662], [329.9, -44.6809], [330, -44.3891], [330.1, -44.0905], [330.2, -43.7846], [330.3, -43.4711], [330.4, -43.1496], [330.5, -42.8197], [330.6, -42.481], [330.7, -42.1329], [330.8, -41.7751], [330.9, -41.4068], [331, -41.0276], [331.1, -40.6368], [331.2, -40.2338], [331.3, -39.8177], [331.4, -39.3879], [331.5, -38.9435], [331.6, -38.4835], [331.7, -38.007], [331.8, -37.513], [331.9, -37.0001], [332, -36.4672], [332.1, -35.9129], [332.2, -35.3356], [332.3, -34.7337], [332.4, -34.1054], [332.5, -33.4486], [332.6, -32.7612], [332.7, -32.0406], [332.8, -31.2843], [332.9, -30.4891], [333, -68], [333.1, -67.8162], [333.2, -67.6342], [333.3, -67.454], [333.4, -67.2755], [333.5, -67.0986], [333.6, -66.9233], [333.7, -66.7495], [333.8, -66.5772], [333.9, -66.4062], [334, -66.2367], [334.1, -66.0684], [334.2, -65.9015], [334.3, -65.7357], [334.4, -65.5711], [334.5, -65.4077], [334.6, -65.2454], [334.7, -65.0841], [334.8, -64.9239], [334.9, -64.7646], [335, -64.6063], [335.1, -64.449], [335.2, -64.2925], [335.3, -64.1368], [335.4, -63.982], [335.5, -63.828], [335.6, -63.6747], [335.7, -63.5222], [335.8, -63.3703], [335.9, -63.2192], [336, -63.0687], [336.1, -62.9188], [336.2, -62.7695], [336.3, -62.6207], [336.4, -62.4725], [336.5, -62.3249], [336.6, -62.1777], [336.7, -62.031], [336.8, -61.8847], [336.9, -61.7389], [337, -61.5935], [337.1, -61.4484], [337.2, -61.3037], [337.3, -61.1593], [337.4, -61.0153], [337.5, -60.8715], [337.6, -60.728], [337.7, -60.5847], [337.8, -60.4417], [337.9, -60.2988], [338, -60.1562], [338.1, -60.0137], [338.2, -59.8713], [338.3, -59.7291], [338.4, -59.5869], [338.5, -59.4449], [338.6, -59.3029], [338.7, -59.1609], [338.8, -59.0189], [338.9, -58.8769], [339, -58.7349], [339.1, -58.5928], [339.2, -58.4507], [339.3, -58.3084], [339.4, -58.166], [339.5, -58.0235], [339.6, -57.8808], [339.7, -57.7379], [339.8, -57.5949], [339.9, -57.4515], [340, -57.3079], [340.1, -57.1641], [340.2, -57.0199], [340.3, -56.8753], [340.4, -56.7305], [340.5, -56.5852], [340.6, -56.4395], [340.7, -56.2934], [340.8, -56.1467], [340.9, -55.9996], [341, -55.852], [341.1, -55.7038], [341.2, -55.555], [341.3, -55.4056], [341.4, -55.2556], [341.5, -55.1048], [341.6, -54.9534], [341.7, -54.8012], [341.8, -54.6482], [341.9, -54.4943], [342, -54.3397], [342.1, -54.1841], [342.2, -54.0275], [342.3, -53.87], [342.4, -53.7115], [342.5, -53.5519], [342.6, -53.3912], [342.7, -53.2293], [342.8, -53.0663], [342.9, -52.9019], [343, -52.7363], [343.1, -52.5693], [343.2, -52.4009], [343.3, -52.231], [343.4, -52.0596], [343.5, -51.8866], [343.6, -51.7119], [343.7, -51.5356], [343.8, -51.3574], [343.9, -51.1774], [344, -50.9954], [344.1, -50.8114], [344.2, -50.6254], [344.3, -50.4371], [344.4, -50.2466], [344.5, -50.0538], [344.6, -49.8585], [344.7, -49.6607], [344.8, -49.4602], [344.9, -49.2569], [345, -49.0508], [345.1, -48.8417], [345.2, -48.6295], [345.3, -48.414], [345.4, -48.1952], [345.5, -47.9728], [345.6, -47.7468], [345.7, -47.5169], [345.8, -47.283], [345.9, -47.045], [346, -46.8026], [346.1, -46.5557], [346.2, -46.304], [346.3, -46.0473], [346.4, -45.7854], [346.5, -45.5181], [346.6, -45.2451], [346.7, -44.9662], [346.8, -44.6809], [346.9, -44.3891], [347, -44.0905], [347.1, -43.7846], [347.2, -43.4711], [347.3, -43.1496], [347.4, -42.8197], [347.5, -42.481], [347.6, -42.1329], [347.7, -41.7751], [347.8, -41.4068], [347.9, -41.0276], [348, -40.6368], [348.1, -40.2338], [348.2, -39.8177], [348.3, -39.3879], [348.4, -38.9435], [348.5, -38.4835], [348.6, -38.007], [348.7, -37.513], [348.8, -37.0001], [348.9, -36.4672], [349, -35.9129], [349.1, -35.3356], [349.2, -34.7337], [349.3, -34.1054], [349.4, -33.4486], [349.5, -32.7612], [349.6, -32.0407], [349.7, -31.2843], [349.8, -30.4891], [349.9, -68], [350, -67.8162], [350.1, -67.6342], [350.2, -67.454], [350.3, -67.2755], [350.4, -67.0986], [350.5, -66.9233], [350.6, -66.7495], [350.7, -66.5772], [350.8, -66.4062], [350.9, -66.2367], [351, -66.0684], [351.1, -65.9015], [351.2, -65.7357], [351.3, -65.5711], [351.4, -65.4077], [351.5, -65.2454], [351.6, -65.0841], [351.7, -64.9239], [351.8, -64.7646], [351.9, -64.6063], [352, -64.449], [352.1, -64.2925], [352.2, -64.1368], [352.3, -63.982], [352.4, -63.828], [352.5, -63.6747], [352.6, -63.5222], [352.7, -63.3703], [352.8, -63.2192], [352.9, -63.0687], [353, -62.9188], [353.1, -62.7695], [353.2, -62.6207], [353.3, -62.4725], [353.4, -62.3249], [353.5, -62.1777], [353.6, -62.031], [353.7, -61.8847], [353.8, -61.7389], [353.9, -61.5935], [354, -61.4484], [354.1, -61.3037], [354.2, -61.1593], [354.3, -61.0153], [354.4, -60.8715], [354.5, -60.728], [354.6, -60.5847], [354.7, -60.4417], [354.8, -60.2988], [354.9, -60.1562], [355, -60.0137], [355.1, -59.8713], [355.2, -59.7291], [355.3, -59.5869], [355.4, -59.4449], [355.5, -59.3029], [355.6, -59.1609], [355.7, -59.0189], [355.8, -58.8769], [355.9, -58.7349], [356, -58.5928], [356.1, -58.4507], [356.2, -58.3084], [356.3, -58.166], [356.4, -58.0235], [356.5, -57.8808], [356.6, -57.7379], [356.7, -57.5949], [356.8, -57.4515], [356.9, -57.3079], [357, -57.1641], [357.1, -57.0199], [357.2, -56.8753], [357.3, -56.7305], [357.4, -56.5852], [357.5, -56.4395], [357.6, -56.2934], [357.7, -56.1467], [357.8, -55.9996], [357.9, -55.852], [358, -55.7038], [358.1, -55.555], [358.2, -55.4056], [358.3, -55.2556], [358.4, -55.1048], [358.5, -54.9534], [358.6, -54.8012], [358.7, -54.6482], [358.8, -54.4943], [358.9, -54.3397], [359, -54.1841], [359.1, -54.0275], [359.2, -53.87], [359.3, -53.7115], [359.4, -53.5519], [359.5, -53.3912], [359.6, -53.2293], [359.7, -53.0663], [359.8, -52.9019], [359.9, -52.7363], [360, -52.5693], [360.1, -52.4009], [360.2, -52.231], [360.3, -52.0596], [360.4, -51.8866], [360.5, -51.7119], [360.6, -51.5356], [360.7, -51.3574], [360.8, -51.1774], [360.9, -50.9954], [361, -50.8114], [361.1, -50.6254], [361.2, -50.4371], [361.3, -50.2466], [361.4, -50.0538], [361.5, -49.8585], [361.6, -49.6607], [361.7, -49.4602], [361.8, -49.2569], [361.9, -49.0508], [362, -48.8417], [362.1, -48.6295], [362.2, -48.414], [362.3, -48.1952], [362.4, -47.9728], [362.5, -47.7468], [362.6, -47.5169], [362.7, -47.283], [362.8, -47.045], [362.9, -46.8026], [363, -46.5557], [363.1, -46.304], [363.2, -46.0473], [363.3, -45.7854], [363.4, -45.5181], [363.5, -45.2451], [363.6, -44.9662], [363.7, -44.6809], [363.8, -44.3891], [363.9, -44.0905], [364, -43.7846], [364.1, -43.4711], [364.2, -43.1496], [364.3, -42.8197], [364.4, -42.481], [364.5, -42.1329], [364.6, -41.7751], [364.7, -41.4068], [364.8, -41.0276], [364.9, -40.6368], [365, -40.2338], [365.1, -39.8177], [365.2, -39.3879], [365.3, -38.9435], [365.4, -38.4835], [365.5, -38.007], [365.6, -37.513], [365.7, -37.0001], [365.8, -36.4672], [365.9, -35.9129], [366, -35.3356], [366.1, -34.7337], [366.2, -34.1054], [366.3, -33.4486], [366.4, -32.7612], [366.5, -32.0407], [366.6, -31.2843], [366.7, -30.4891], [366.8, -68], [366.9, -67.8162], [367, -67.6342], [367.1, -67.454], [367.2, -67.2755], [367.3, -67.0986], [367.4, -66.9233], [367.5, -66.7495], [367.6, -66.5772], [367.7, -66.4062], [367.8, -66.2367], [367.9, -66.0684], [368, -65.9015], [368.1, -65.7357], [368.2, -65.5711], [368.3, -65.4077], [368.4, -65.2454], [368.5, -65.0841], [368.6, -64.9239], [368.7, -64.7646], [368.8, -64.6063], [368.9, -64.449], [369, -64.2925], [369.1, -64.1368], [369.2, -63.982], [369.3, -63.828], [369.4, -63.6747], [369.5, -63.5222], [369.6, -63.3703], [369.7, -63.2192], [369.8, -63.0687], [369.9, -62.9188], [370, -62.7695], [370.1, -62.6207], [370.2, -62.4725], [370.3, -62.3249], [370.4, -62.1777], [370.5, -62.031], [370.6, -61.8847], [370.7, -61.7389], [370.8, -61.5935], [370.9, -61.4484], [371, -61.3037], [371.1, -61.1593], [371.2, -61.0153], [371.3, -60.8715], [371.4, -60.728], [371.5, -60.5847], [371.6, -60.4417], [371.7, -60.2988], [371.8, -60.1562], [371.9, -60.0137], [372, -59.8713], [372.1, -59.7291], [372.2, -59.5869], [372.3, -59.4449], [372.4, -59.3029], [372.5, -59.1609], [372.6, -59.0189], [372.7, -58.8769], [372.8, -58.7349], [372.9, -58.5928], [373, -58.4507], [373.1, -58.3084], [373.2, -58.166], [373.3, -58.0235], [373.4, -57.8808], [373.5, -57.7379], [373.6, -57.5949], [373.7, -57.4515], [373.8, -57.3079], [373.9, -57.1641], [374, -57.0199], [374.1, -56.8753], [374.2, -56.7305], [374.3, -56.5852], [374.4, -56.4395], [374.5, -56.2934], [374.6, -56.1467], [374.7, -55.9996], [374.8, -55.852], [374.9, -55.7038], [375, -55.555], [375.1, -55.4056], [375.2, -55.2556], [375.3, -55.1048], [375.4, -54.9534], [375.5, -54.8012], [375.6, -54.6482], [375.7, -54.4943], [375.8, -54.3397], [375.9, -54.1841], [376, -54.0275], [376.1, -53.87], [376.2, -53.7115], [376.3, -53.5519], [376.4, -53.3912], [376.5, -53.2293], [376.6, -53.0663], [376.7, -52.9019], [376.8, -52.7363], [376.9, -52.5693], [377, -52.4009], [377.1, -52.231], [377.2, -52.0596], [377.3, -51.8866], [377.4, -51.7119], [377.5, -51.5356], [377.6, -51.3574], [377.7, -51.1774], [377.8, -50.9954], [377.9, -50.8114], [378, -50.6254], [378.1, -50.4371], [378.2, -50.2466], [378.3, -50.0538], [378.4, -49.8585], [378.5, -49.6607], [378.6, -49.4602], [378.7, -49.2569], [378.8, -49.0508], [378.9, -48.8417], [379, -48.6295], [379.1, -48.414], [379.2, -48.1952], [379.3, -47.9728], [379.4, -47.7468], [379.5, -47.5169], [379.6, -47.283], [379.7, -47.045], [379.8, -46.8026], [379.9, -46.5557], [380, -46.304], [380.1, -46.0473], [380.2, -45.7854], [380.3, -45.5181], [380.4, -45.2451], [380.5, -44.9662], [380.6, -44.6809], [380.7, -44.3891], [380.8, -44.0905], [380.9, -43.7846], [381, -43.4711], [381.1, -43.1496], [381.2, -42.8197], [381.3, -42.481], [381.4, -42.1329], [381.5, -41.7751], [381.6, -41.4068], [381.7, -41.0276], [381.8, -40.6368], [381.9, -40.2338], [382, -39.8177], [382.1, -39.3879], [382.2, -38.9435], [382.3, -38.4835], [382.4, -38.007], [382.5, -37.513], [382.6, -37.0001], [382.7, -36.4672], [382.8, -35.9129], [382.9, -35.3356], [383, -34.7337], [383.1, -34.1054], [383.2, -33.4486], [383.3, -32.7612], [383.4, -32.0407], [383.5, -31.2843], [383.6, -30.4891], [383.7, -68], [383.8, -67.8162], [383.9, -67.6342], [384, -67.454], [384.1, -67.2755], [384.2, -67.0986], [384.3, -66.9233], [384.4, -66.7495], [384.5, -66.5772], [384.6, -66.4062], [384.7, -66.2367], [384.8, -66.0684], [384.9, -65.9015], [385, -65.7357], [385.1, -65.5711], [385.2, -65.4077], [385.3, -65.2454], [385.4, -65.0841], [385.5, -64.9239], [385.6, -64.7646], [385.7, -64.6063], [385.8, -64.449], [385.9, -64.2925], [386, -64.1368], [386.1, -63.982], [386.2, -63.828], [386.3, -63.6747], [386.4, -63.5222], [386.5, -63.3703], [386.6, -63.2192], [386.7, -63.0687], [386.8, -62.9188], [386.9, -62.7695], [387, -62.6207], [387.1, -62.4725], [387.2, -62.3249], [387.3, -62.1777], [387.4, -62.031], [387.5, -61.8847], [387.6, -61.7389], [387.7, -61.5935], [387.8, -61.4484], [387.9, -61.3037], [388, -61.1593], [388.1, -61.0153], [388.2, -60.8715], [388.3, -60.728], [388.4, -60.5847], [388.5, -60.4417], [388.6, -60.2988], [388.7, -60.1562], [388.8, -60.0137], [388.9, -59.8713], [389, -59.7291], [389.1, -59.5869], [389.2, -59.4449], [389.3, -59.3029], [389.4, -59.1609], [389.5, -59.0189], [389.6, -58.8769], [389.7, -58.7349], [389.8, -58.5928], [389.9, -58.4507], [390, -58.3084], [390.1, -58.166], [390.2, -58.0235], [390.3, -57.8808], [390.4, -57.7379], [390.5, -57.5949], [390.6, -57.4515], [390.7, -57.3079], [390.8, -57.1641], [390.9, -57.0199], [391, -56.8753], [391.1, -56.7305], [391.2, -56.5852], [391.3, -56.4395], [391.4, -56.2934], [391.5, -56.1467], [391.6, -55.9996], [391.7, -55.852], [391.8, -55.7038], [391.9, -55.555], [392, -55.4056], [392.1, -55.2556], [392.2, -55.1048], [392.3, -54.9534], [392.4, -54.8012], [392.5, -54.6482], [392.6, -54.4943], [392.7, -54.3397], [392.8, -54.1841], [392.9, -54.0275], [393, -53.87], [393.1, -53.7115], [393.2, -53.5519], [393.3, -53.3912], [393.4, -53.2293], [393.5, -53.0663], [393.6, -52.9019], [393.7, -52.7363], [393.8, -52.5693], [393.9, -52.4009], [394, -52.231], [394.1, -52.0596], [394.2, -51.8866], [394.3, -51.7119], [394.4, -51.5356], [394.5, -51.3574], [394.6, -51.1774], [394.7, -50.9954], [394.8, -50.8114], [394.9, -50.6254], [395, -50.4371], [395.1, -50.2466], [395.2, -50.0538], [395.3, -49.8585], [395.4, -49.6607], [395.5, -49.4602], [395.6, -49.2569], [395.7, -49.0508], [395.8, -48.8417], [395.9, -48.6295], [396, -48.414], [396.1, -48.1952], [396.2, -47.9728], [396.3, -47.7468], [396.4, -47.5169], [396.5, -47.283], [396.6, -47.045], [396.7, -46.8026], [396.8, -46.5557], [396.9, -46.304], [397, -46.0473], [397.1, -45.7854], [397.2, -45.5181], [397.3, -45.2451], [397.4, -44.9662], [397.5, -44.6809], [397.6, -44.3891], [397.7, -44.0905], [397.8, -43.7846], [397.9, -43.4711], [398, -43.1496], [398.1, -42.8197], [398.2, -42.481], [398.3, -42.1329], [398.4, -41.7751], [398.5, -41.4068], [398.6, -41.0276], [398.7, -40.6368], [398.8, -40.2338], [398.9, -39.8177], [399, -39.3879], [399.1, -38.9435], [399.2, -38.4835], [399.3, -38.007], [399.4, -37.513], [399.5, -37.0001], [399.6, -36.4672], [399.7, -35.9129], [399.8, -35.3356], [399.9, -34.7337], [400, -34.1054], [400.1, -33.4486], [400.2, -32.7612], [400.3, -32.0407], [400.4, -31.2843], [400.5, -30.4891], [400.6, -68], [400.7, -67.8162], [400.8, -67.6342], [400.9, -67.454], [401, -67.2755], [401.1, -67.0986], [401.2, -66.9233], [401.3, -66.7495], [401.4, -66.5772], [401.5, -66.4062], [401.6, -66.2367], [401.7, -66.0684], [401.8, -65.9015], [401.9, -65.7357], [402, -65.5711], [402.1, -65.4077], [402.2, -65.2454], [402.3, -65.0841], [402.4, -64.9239], [402.5, -64.7646], [402.6, -64.6063], [402.7, -64.449], [402.8, -64.2925], [402.9, -64.1368], [403, -63.982], [403.1, -63.828], [403.2, -63.6747], [403.3, -63.5222], [403.4, -63.3703], [403.5, -63.2192], [403.6, -63.0687], [403.7, -62.9188], [403.8, -62.7695], [403.9, -62.6207], [404, -62.4725], [404.1, -62.3249], [404.2, -62.1777], [404.3, -62.031], [404.4, -61.8847], [404.5, -61.7389], [404.6, -61.5935], [404.7, -61.4484], [404.8, -61.3037], [404.9, -61.1593], [405, -61.0153], [405.1, -60.8715], [405.2, -60.728], [405.3, -60.5847], [405.4, -60.4417], [405.5, -60.2988], [405.6, -60.1562], [405.7, -60.0137], [405.8, -59.8713], [405.9, -59.7291], [406, -59.5869], [406.1, -59.4449], [406.2, -59.3029], [406.3, -59.1609], [406.4, -59.0189], [406.5, -58.8769], [406.6, -58.7349], [406.7, -58.5928], [406.8, -58.4507], [406.9, -58.3084], [407, -58.166], [407.1, -58.0235], [407.2, -57.8808], [407.3, -57.7379], [407.4, -57.5949], [407.5, -57.4515], [407.6, -57.3079], [407.7, -57.1641], [407.8, -57.0199], [407.9, -56.8753], [408, -56.7305], [408.1, -56.5852], [408.2, -56.4395], [408.3, -56.2934], [408.4, -56.1467], [408.5, -55.9996], [408.6, -55.852], [408.7, -55.7038], [408.8, -55.555], [408.9, -55.4056], [409, -55.2556], [409.1, -55.1048], [409.2, -54.9534], [409.3, -54.8012], [409.4, -54.6482], [409.5, -54.4943], [409.6, -54.3397], [409.7, -54.1841], [409.8, -54.0275], [409.9, -53.87], [410, -53.7115], [410.1, -53.5519], [410.2, -53.3912], [410.3, -53.2293], [410.4, -53.0663], [410.5, -52.9019], [410.6, -52.7363], [410.7, -52.5693], [410.8, -52.4009], [410.9, -52.231], [411, -52.0596], [411.1, -51.8866], [411.2, -51.7119], [411.3, -51.5356], [411.4, -51.3574], [411.5, -51.1774], [411.6, -50.9954], [411.7, -50.8114], [411.8, -50.6254], [411.9, -50.4371], [412, -50.2466], [412.1, -50.0538], [412.2, -49.8585], [412.3, -49.6607], [412.4, -49.4602], [412.5, -49.2569], [412.6, -49.0508], [412.7, -48.8417], [412.8, -48.6295], [412.9, -48.414], [413, -48.1952], [413.1, -47.9728], [413.2, -47.7468], [413.3, -47.5169], [413.4, -47.283], [413.5, -47.045], [413.6, -46.8026], [413.7, -46.5557], [413.8, -46.304], [413.9, -46.0473], [414, -45.7854], [414.1, -45.5181], [414.2, -45.2451], [414.3, -44.9662], [414.4, -44.6809], [414.5, -44.3891], [414.6, -44.0905], [414.7, -43.7846], [414.8, -43.4711], [414.9, -43.1496], [415, -42.8197], [415.1, -42.481], [415.2, -42.1329], [415.3, -41.7751], [415.4, -41.4068], [415.5, -41.0276], [415.6, -40.6368], [415.7, -40.2338], [415.8, -39.8177], [415.9, -39.3879], [416, -38.9435], [416.1, -38.4835], [416.2, -38.007], [416.3, -37.513], [416.4, -37.0001], [416.5, -36.4672], [416.6, -35.9129], [416.7, -35.3356], [416.8, -34.7337], [416.9, -34.1054], [417, -33.4486], [417.1, -32.7612], [417.2, -32.0407], [417.3, -31.2843], [417.4, -30.4891], [417.5, -68], [417.6, -67.8162], [417.7, -67.6342], [417.8, -67.454], [417.9, -67.2755], [418, -67.0986], [418.1, -66.9233], [418.2, -66.7495], [418.3, -66.5772], [418.4, -66.4062], [418.5, -66.2367], [418.6, -66.0684], [418.7, -65.9015], [418.8, -65.7357], [418.9, -65.5711], [419, -65.4077], [419.1, -65.2454], [419.2, -65.0841], [419.3, -64.9239], [419.4, -64.7646], [419.5, -64.6063], [419.6, -64.449], [419.7, -64.2925], [419.8, -64.1368], [419.9, -63.982], [420, -63.828], [420.1, -63.6747], [420.2, -63.5222], [420.3, -63.3703], [420.4, -63.2192], [420.5, -63.0687], [420.6, -62.9188], [420.7, -62.7695], [420.8, -62.6207], [420.9, -62.4725], [421, -62.3249], [421.1, -62.1777], [421.2, -62.031], [421.3, -61.8847], [421.4, -61.7389], [421.5, -61.5935], [421.6, -61.4484], [421.7, -61.3037], [421.8, -61.1593], [421.9, -61.0153], [422, -60.8715], [422.1, -60.728], [422.2, -60.5847], [422.3, -60.4417], [422.4, -60.2988], [422.5, -60.1562], [422.6, -60.0137], [422.7, -59.8713], [422.8, -59.7291], [422.9, -59.5869], [423, -59.4449], [423.1, -59.3029], [423.2, -59.1609], [423.3, -59.0189], [423.4, -58.8769], [423.5, -58.7349], [423.6, -58.5928], [423.7, -58.4507], [423.8, -58.3084], [423.9, -58.166], [424, -58.0235], [424.1, -57.8808], [424.2, -57.7379], [424.3, -57.5949], [424.4, -57.4515], [424.5, -57.3079], [424.6, -57.1641], [424.7, -57.0199], [424.8, -56.8753], [424.9, -56.7305], [425, -56.5852], [425.1, -56.4395], [425.2, -56.2934], [425.3, -56.1467], [425.4, -55.9996], [425.5, -55.852], [425.6, -55.7038], [425.7, -55.555], [425.8, -55.4056], [425.9, -55.2556], [426, -55.1048], [426.1, -54.9534], [426.2, -54.8012], [426.3, -54.6482], [426.4, -54.4943], [426.5, -54.3397], [426.6, -54.1841], [426.7, -54.0275], [426.8, -53.87], [426.9, -53.7115], [427, -53.5519], [427.1, -53.3912], [427.2, -53.2293], [427.3, -53.0663], [427.4, -52.9019], [427.5, -52.7363], [427.6, -52.5693], [427.7, -52.4009], [427.8, -52.231], [427.9, -52.0596], [428, -51.8866], [428.1, -51.7119], [428.2, -51.5356], [428.3, -51.3574], [428.4, -51.1774], [428.5, -50.9954], [428.6, -50.8114], [428.7, -50.6254], [428.8, -50.4371], [428.9, -50.2466], [429, -50.0538], [429.1, -49.8585], [429.2, -49.6607], [429.3, -49.4602], [429.4, -49.2569], [429.5, -49.0508], [429.6, -48.8417], [429.7, -48.6295], [429.8, -48.414], [429.9, -48.1952], [430, -47.9728], [430.1, -47.7468], [430.2, -47.5169], [430.3, -47.283], [430.4, -47.045], [430.5, -46.8026], [430.6, -46.5557], [430.7, -46.304], [430.8, -46.0473], [430.9, -45.7854], [431, -45.5181], [431.1, -45.2451], [431.2, -44.9662], [431.3, -44.6809], [431.4, -44.3891], [431.5, -44.0905], [431.6, -43.7846], [431.7, -43.4711], [431.8, -43.1496], [431.9, -42.8197], [432, -42.481], [432.1, -42.1329], [432.2, -41.7751], [432.3, -41.4068], [432.4, -41.0276], [432.5, -40.6368], [432.6, -40.2338], [432.7, -39.8177], [432.8, -39.3879], [432.9, -38.9435], [433, -38.4835], [433.1, -38.007], [433.2, -37.513], [433.3, -37.0001], [433.4, -36.4672], [433.5, -35.9129], [433.6, -35.3356], [433.7, -34.7337], [433.8, -34.1054], [433.9, -33.4486], [434, -32.7612], [434.1, -32.0407], [434.2, -31.2843], [434.3, -30.4891], [434.4, -68], [434.5, -67.8162], [434.6, -67.6342], [434.7, -67.454], [434.8, -67.2755], [434.9, -67.0986], [435, -66.9233], [435.1, -66.7495], [435.2, -66.5772], [435.3, -66.4062], [435.4, -66.2367], [435.5, -66.0684], [435.6, -65.9015], [435.7, -65.7357], [435.8, -65.5711], [435.9, -65.4077], [436, -65.2454], [436.1, -65.0841], [436.2, -64.9239], [436.3, -64.7646], [436.4, -64.6063], [436.5, -64.449], [436.6, -64.2925], [436.7, -64.1368], [436.8, -63.982], [436.9, -63.828], [437, -63.6747], [437.1, -63.5222], [437.2, -63.3703], [437.3, -63.2192], [437.4, -63.0687], [437.5, -62.9188], [437.6, -62.7695], [437.7, -62.6207], [437.8, -62.4725], [437.9, -62.3249], [438, -62.1777], [438.1, -62.031], [438.2, -61.8847], [438.3, -61.7389], [438.4, -61.5935], [438.5, -61.4484], [438.6, -61.3037], [438.7, -61.1593], [438.8, -61.0153], [438.9, -60.8715], [439, -60.728], [439.1, -60.5847], [439.2, -60.4417], [439.3, -60.2988], [439.4, -60.1562], [439.5, -60.0137], [439.6, -59.8713], [439.7, -59.7291], [439.8, -59.5869], [439.9, -59.4449], [440, -59.3029], [440.1, -59.1609], [440.2, -59.0189], [440.3, -58.8769], [440.4, -58.7349], [440.5, -58.5928], [440.6, -58.4507], [440.7, -58.3084], [440.8, -58.166], [440.9, -58.0235], [441, -57.8808], [441.1, -57.7379], [441.2, -57.5949], [441.3, -57.4515], [441.4, -57.3079], [441.5, -57.1641], [441.6, -57.0199], [441.7, -56.8753], [441.8, -56.7305], [441.9, -56.5852], [442, -56.4395], [442.1, -56.2934], [442.2, -56.1467], [442.3, -55.9996], [442.4, -55.852], [442.5, -55.7038], [442.6, -55.555], [442.7, -55.4056], [442.8, -55.2556], [442.9, -55.1048], [443, -54.9534], [443.1, -54.8012], [443.2, -54.6482], [443.3, -54.4943], [443.4, -54.3397], [443.5, -54.1841], [443.6, -54.0275], [443.7, -53.87], [443.8, -53.7115], [443.9, -53.5519], [444, -53.3912], [444.1, -53.2293], [444.2, -53.0663], [444.3, -52.9019], [444.4, -52.7363], [444.5, -52.5693], [444.6, -52.4009], [444.7, -52.231], [444.8, -52.0596], [444.9, -51.8866], [445, -51.7119], [445.1, -51.5356], [445.2, -51.3574], [445.3, -51.1774], [445.4, -50.9954], [445.5, -50.8114], [445.6, -50.6254], [445.7, -50.4371], [445.8, -50.2466], [445.9, -50.0538], [446, -49.8585], [446.1, -49.6607], [446.2, -49.4602], [446.3, -49.2569], [446.4, -49.0508], [446.5, -48.8417], [446.6, -48.6295], [446.7, -48.414], [446.8, -48.1952], [446.9, -47.9728], [447, -47.7468], [447.1, -47.5169], [447.2, -47.283], [447.3, -47.045], [447.4, -46.8026], [447.5, -46.5557], [447.6, -46.304], [447.7, -46.0473], [447.8, -45.7854], [447.9, -45.5181], [448, -45.2451], [448.1, -44.9662], [448.2, -44.6809], [448.3, -44.3891], [448.4, -44.0905], [448.5, -43.7846], [448.6, -43.4711], [448.7, -43.1496], [448.8, -42.8197], [448.9, -42.481], [449, -42.1329], [449.1, -41.7751], [449.2, -41.4068], [449.3, -41.0276], [449.4, -40.6368], [449.5, -40.2338], [449.6, -39.8177], [449.7, -39.3879], [449.8, -38.9435], [449.9, -38.4835], [450, -38.007], [450.1, -37.513], [450.2, -37.0001], [450.3, -36.4672], [450.4, -35.9129], [450.5, -35.3356], [450.6, -34.7337], [450.7, -34.1054], [450.8, -33.4486], [450.9, -32.7612], [451, -32.0407], [451.1, -31.2843], [451.2, -30.4891], [451.3, -68], [451.4, -67.8162], [451.5, -67.6342], [451.6, -67.454], [451.7, -67.2755], [451.8, -67.0986], [451.9, -66.9233], [452, -66.7495], [452.1, -66.5772], [452.2, -66.4062], [452.3, -66.2367], [452.4, -66.0684], [452.5, -65.9015], [452.6, -65.7357], [452.7, -65.5711], [452.8, -65.4077], [452.9, -65.2454], [453, -65.0841], [453.1, -64.9239], [453.2, -64.7646], [453.3, -64.6063], [453.4, -64.449], [453.5, -64.2925], [453.6, -64.1368], [453.7, -63.982], [453.8, -63.828], [453.9, -63.6747], [454, -63.5222], [454.1, -63.3703], [454.2, -63.2192], [454.3, -63.0687], [454.4, -62.9188], [454.5, -62.7695], [454.6, -62.6207], [454.7, -62.4725], [454.8, -62.3249], [454.9, -62.1777], [455, -62.031], [455.1, -61.8847], [455.2, -61.7389], [455.3, -61.5935], [455.4, -61.4484], [455.5, -61.3037], [455.6, -61.1593], [455.7, -61.0153], [455.8, -60.8715], [455.9, -60.728], [456, -60.5847], [456.1, -60.4417], [456.2, -60.2988], [456.3, -60.1562], [456.4, -60.0137], [456.5, -59.8713], [456.6, -59.7291], [456.7, -59.5869], [456.8, -59.4449], [456.9, -59.3029], [457, -59.1609], [457.1, -59.0189], [457.2, -58.8769], [457.3, -58.7349], [457.4, -58.5928], [457.5, -58.4507], [457.6, -58.3084], [457.7, -58.166], [457.8, -58.0235], [457.9, -57.8808], [458, -57.7379], [458.1, -57.5949], [458.2, -57.4515], [458.3, -57.3079], [458.4, -57.1641], [458.5, -57.0199], [458.6, -56.8753], [458.7, -56.7305], [458.8, -56.5852], [458.9, -56.4395], [459, -56.2934], [459.1, -56.1467], [459.2, -55.9996], [459.3, -55.852], [459.4, -55.7038], [459.5, -55.555], [459.6, -55.4056], [459.7, -55.2556], [459.8, -55.1048], [459.9, -54.9534], [460, -54.8012], [460.1, -54.6482], [460.2, -54.4943], [460.3, -54.3397], [460.4, -54.1841], [460.5, -54.0275], [460.6, -53.87], [460.7, -53.7115], [460.8, -53.5519], [460.9, -53.3912], [461, -53.2293], [461.1, -53.0663], [461.2, -52.9019], [461.3, -52.7363], [461.4, -52.5693], [461.5, -52.4009], [461.6, -52.231], [461.7, -52.0596], [461.8, -51.8866], [461.9, -51.7119], [462, -51.5356], [462.1, -51.3574], [462.2, -51.1774], [462.3, -50.9954], [462.4, -50.8114], [462.5, -50.6254], [462.6, -50.4371], [462.7, -50.2466], [462.8, -50.0538], [462.9, -49.8585], [463, -49.6607], [463.1, -49.4602], [463.2, -49.2569], [463.3, -49.0508], [463.4, -48.8417], [463.5, -48.6295], [463.6, -48.414], [463.7, -48.1952], [463.8, -47.9728], [463.9, -47.7468], [464, -47.5169], [464.1, -47.283], [464.2, -47.045], [464.3, -46.8026], [464.4, -46.5557], [464.5, -46.304], [464.6, -46.0473], [464.7, -45.7854], [464.8, -45.5181], [464.9, -45.2451], [465, -44.9662], [465.1, -44.6809], [465.2, -44.3891], [465.3, -44.0905], [465.4, -43.7846], [465.5, -43.4711], [465.6, -43.1496], [465.7, -42.8197], [465.8, -42.481], [465.9, -42.1329], [466, -41.7751], [466.1, -41.4068], [466.2, -41.0276], [466.3, -40.6368], [466.4, -40.2338], [466.5, -39.8177], [466.6, -39.3879], [466.7, -38.9435], [466.8, -38.4835], [466.9, -38.007], [467, -37.513], [467.1, -37.0001], [467.2, -36.4672], [467.3, -35.9129], [467.4, -35.3356], [467.5, -34.7337], [467.6, -34.1054], [467.7, -33.4486], [467.8, -32.7612], [467.9, -32.0407], [468, -31.2843], [468.1, -30.4891], [468.2, -68], [468.3, -67.8162], [468.4, -67.6342], [468.5, -67.454], [468.6, -67.2755], [468.7, -67.0986], [468.8, -66.9233], [468.9, -66.7495], [469, -66.5772], [469.1, -66.4062], [469.2, -66.2367], [469.3, -66.0684], [469.4, -65.9015], [469.5, -65.7357], [469.6, -65.5711], [469.7, -65.4077], [469.8, -65.2454], [469.9, -65.0841], [470, -64.9239], [470.1, -64.7646], [470.2, -64.6063], [470.3, -64.449], [470.4, -64.2925], [470.5, -64.1368], [470.6, -63.982], [470.7, -63.828], [470.8, -63.6747], [470.9, -63.5222], [471, -63.3703], [471.1, -63.2192], [471.2, -63.0687], [471.3, -62.9188], [471.4, -62.7695], [471.5, -62.6207], [471.6, -62.4725], [471.7, -62.3249], [471.8, -62.1777], [471.9, -62.031], [472, -61.8847], [472.1, -61.7389], [472.2, -61.5935], [472.3, -61.4484], [472.4, -61.3037], [472.5, -61.1593], [472.6, -61.0153], [472.7, -60.8715], [472.8, -60.728], [472.9, -60.5847], [473, -60.4417], [473.1, -60.2988], [473.2, -60.1562], [473.3, -60.0137], [473.4, -59.8713], [473.5, -59.7291], [473.6, -59.5869], [473.7, -59.4449], [473.8, -59.3029], [473.9, -59.1609], [474, -59.0189], [474.1, -58.8769], [474.2, -58.7349], [474.3, -58.5928], [474.4, -58.4507], [474.5, -58.3084], [474.6, -58.166], [474.7, -58.0235], [474.8, -57.8808], [474.9, -57.7379], [475, -57.5949], [475.1, -57.4515], [475.2, -57.3079], [475.3, -57.1641], [475.4, -57.0199], [475.5, -56.8753], [475.6, -56.7305], [475.7, -56.5852], [475.8, -56.4395], [475.9, -56.2934], [476, -56.1467], [476.1, -55.9996], [476.2, -55.852], [476.3, -55.7038], [476.4, -55.555], [476.5, -55.4056], [476.6, -55.2556], [476.7, -55.1048], [476.8, -54.9534], [476.9, -54.8012], [477, -54.6482], [477.1, -54.4943], [477.2, -54.3397], [477.3, -54.1841], [477.4, -54.0275], [477.5, -53.87], [477.6, -53.7115], [477.7, -53.5519], [477.8, -53.3912], [477.9, -53.2293], [478, -53.0663], [478.1, -52.9019], [478.2, -52.7363], [478.3, -52.5693], [478.4, -52.4009], [478.5, -52.231], [478.6, -52.0596], [478.7, -51.8866], [478.8, -51.7119], [478.9, -51.5356], [479, -51.3574], [479.1, -51.1774], [479.2, -50.9954], [479.3, -50.8114], [479.4, -50.6254], [479.5, -50.4371], [479.6, -50.2466], [479.7, -50.0538], [479.8, -49.8585], [479.9, -49.6607], [480, -49.4602], [480.1, -49.2569], [480.2, -49.0508], [480.3, -48.8417], [480.4, -48.6295], [480.5, -48.414], [480.6, -48.1952], [480.7, -47.9728], [480.8, -47.7468], [480.9, -47.5169], [481, -47.283], [481.1, -47.045], [481.2, -46.8026], [481.3, -46.5557], [481.4, -46.304], [481.5, -46.0473], [481.6, -45.7854], [481.7, -45.5181], [481.8, -45.2451], [481.9, -44.9662], [482, -44.6809], [482.1, -44.3891], [482.2, -44.0905], [482.3, -43.7846], [482.4, -43.4711], [482.5, -43.1496], [482.6, -42.8197], [482.7, -42.481], [482.8, -42.1329], [482.9, -41.7751], [483, -41.4068], [483.1, -41.0276], [483.2, -40.6368], [483.3, -40.2338], [483.4, -39.8177], [483.5, -39.3879], [483.6, -38.9435], [483.7, -38.4835], [483.8, -38.007], [483.9, -37.513], [484, -37.0001], [484.1, -36.4672], [484.2, -35.9129], [484.3, -35.3356], [484.4, -34.7337], [484.5, -34.1054], [484.6, -33.4486], [484.7, -32.7612], [484.8, -32.0407], [484.9, -31.2843], [485, -30.4891], [485.1, -68], [485.2, -67.8162], [485.3, -67.6342], [485.4, -67.454], [485.5, -67.2755], [485.6, -67.0986], [485.7, -66.9233], [485.8, -66.7495], [485.9, -66.5772], [486, -66.4062], [486.1, -66.2367], [486.2, -66.0684], [486.3, -65.9015], [486.4, -65.7357], [486.5, -65.5711], [486.6, -65.4077], [486.7, -65.2454], [486.8, -65.0841], [486.9, -64.9239], [487, -64.7646], [487.1, -64.6063], [487.2, -64.449], [487.3, -64.2925], [487.4, -64.1368], [487.5, -63.982], [487.6, -63.828], [487.7, -63.6747], [487.8, -63.5222], [487.9, -63.3703], [488, -63.2192], [488.1, -63.0687], [488.2, -62.9188], [488.3, -62.7695], [488.4, -62.6207], [488.5, -62.4725], [488.6, -62.3249], [488.7, -62.1777], [488.8, -62.031], [488.9, -61.8847], [489, -61.7389], [489.1, -61.5935], [489.2, -61.4484], [489.3, -61.3037], [489.4, -61.1593], [489.5, -61.0153], [489.6, -60.8715], [489.7, -60.728], [489.8, -60.5847], [489.9, -60.4417], [490, -60.2988], [490.1, -60.1562], [490.2, -60.0137], [490.3, -59.8713], [490.4, -59.7291], [490.5, -59.5869], [490.6, -59.4449], [490.7, -59.3029], [490.8, -59.1609], [490.9, -59.0189], [491, -58.8769], [491.1, -58.7349], [491.2, -58.5928], [491.3, -58.4507], [491.4, -58.3084], [491.5, -58.166], [491.6, -58.0235], [491.7, -57.8808], [491.8, -57.7379], [491.9, -57.5949], [492, -57.4515], [492.1, -57.3079], [492.2, -57.1641], [492.3, -57.0199], [492.4, -56.8753], [492.5, -56.7305], [492.6, -56.5852], [492.7, -56.4395], [492.8, -56.2934], [492.9, -56.1467], [493, -55.9996], [493.1, -55.852], [493.2, -55.7038], [493.3, -55.555], [493.4, -55.4056], [493.5, -55.2556], [493.6, -55.1048], [493.7, -54.9534], [493.8, -54.8012], [493.9, -54.6482], [494, -54.4943], [494.1, -54.3397], [494.2, -54.1841], [494.3, -54.0275], [494.4, -53.87], [494.5, -53.7115], [494.6, -53.5519], [494.7, -53.3912], [494.8, -53.2293], [494.9, -53.0663], [495, -52.9019], [495.1, -52.7363], [495.2, -52.5693], [495.3, -52.4009], [495.4, -52.231], [495.5, -52.0596], [495.6, -51.8866], [495.7, -51.7119], [495.8, -51.5356], [495.9, -51.3574], [496, -51.1774], [496.1, -50.9954], [496.2, -50.8114], [496.3, -50.6254], [496.4, -50.4371], [496.5, -50.2466], [496.6, -50.0538], [496.7, -49.8585], [496.8, -49.6607], [496.9, -49.4602], [497, -49.2569], [497.1, -49.0508], [497.2, -48.8417], [497.3, -48.6295], [497.4, -48.414], [497.5, -48.1952], [497.6, -47.9728], [497.7, -47.7468], [497.8, -47.5169], [497.9, -47.283], [498, -47.045], [498.1, -46.8026], [498.2, -46.5557], [498.3, -46.304], [498.4, -46.0473], [498.5, -45.7854], [498.6, -45.5181], [498.7, -45.2451], [498.8, -44.9662], [498.9, -44.6809], [499, -44.3891], [499.1, -44.0905], [499.2, -43.7846], [499.3, -43.4711], [499.4, -43.1496], [499.5, -42.8197], [499.6, -42.481], [499.7, -42.1329], [499.8, -41.7751], [499.9, -41.4068], [500, -41.0276]])
+
+plt.figure()
+plt.plot(data.T[0,:], data.T[1,:])
+plt.xlabel('ms')
+plt.ylabel('mV')
+plt.title('Quadratic AdEx Neuron')
+plt.show()
@@ -0,0 +1,13 @@
+#!/usr/bin/env python
+
+import numpy as np
+import matplotlib.pyplot as plt
+
+data = np.array([[0, 0], [0.1, 0.104483], [0.2, 0.218626], [0.3, 0.342851], [0.4, 0.47709], [0.5, 0.62053], [0.6, 0.771356], [0.7, 0.926569], [0.8, 1.08202], [0.9, 1.23277], [1, 1.37372], [1.1, 1.5005], [1.2, 1.61017], [1.3, 1.70149], [1.4, 1.77487], [1.5, 1.83191], [1.6, 1.87483], [1.7, 1.90607], [1.8, 1.92792], [1.9, 1.94243], [2, 1.95126], [2.1, 1.95578], [2.2, 1.95704], [2.3, 1.95585], [2.4, 1.95282], [2.5, 1.94843], [2.6, 1.94301], [2.7, 1.93684], [2.8, 1.93009], [2.9, 1.92293], [3, 1.91545], [3.1, 1.90773], [3.2, 1.89985], [3.3, 1.89183], [3.4, 1.88372], [3.5, 1.87554], [3.6, 1.86731], [3.7, 1.85904], [3.8, 1.85075], [3.9, 1.84245], [4, 1.83413], [4.1, 1.8258], [4.2, 1.81748], [4.3, 1.80915], [4.4, 1.80083], [4.5, 1.7925], [4.6, 1.78419], [4.7, 1.77588], [4.8, 1.76757], [4.9, 1.75927], [5, 1.75098], [5.1, 1.74269], [5.2, 1.73441], [5.3, 1.72613], [5.4, 1.71786], [5.5, 1.7096], [5.6, 1.70134], [5.7, 1.69309], [5.8, 1.68484], [5.9, 1.6766], [6, 1.66836], [6.1, 1.66012], [6.2, 1.65189], [6.3, 1.64366], [6.4, 1.63543], [6.5, 1.62721], [6.6, 1.61898], [6.7, 1.61076], [6.8, 1.60253], [6.9, 1.59431], [7, 1.58609], [7.1, 1.57786], [7.2, 1.56964], [7.3, 1.56141], [7.4, 1.55317], [7.5, 1.54494], [7.6, 1.5367], [7.7, 1.52845], [7.8, 1.5202], [7.9, 1.51194], [8, 1.50368], [8.1, 1.49541], [8.2, 1.48713], [8.3, 1.47883], [8.4, 1.47053], [8.5, 1.46222], [8.6, 1.4539], [8.7, 1.44556], [8.8, 1.43721], [8.9, 1.42884], [9, 1.42046], [9.1, 1.41206], [9.2, 1.40364], [9.3, 1.3952], [9.4, 1.38674], [9.5, 1.37825], [9.6, 1.36975], [9.7, 1.36122], [9.8, 1.35266], [9.9, 1.34407], [10, 1.33546], [10.1, 1.32681], [10.2, 1.31813], [10.3, 1.30941], [10.4, 1.30066], [10.5, 1.29187], [10.6, 1.28304], [10.7, 1.27416], [10.8, 1.26524], [10.9, 1.25627], [11, 1.24725], [11.1, 1.23818], [11.2, 1.22904], [11.3, 1.21985], [11.4, 1.2106], [11.5, 1.20128], [11.6, 1.19189], [11.7, 1.18243], [11.8, 1.17289], [11.9, 1.16326], [12, 1.15355], [12.1, 1.14375], [12.2, 1.13385], [12.3, 1.12385], [12.4, 1.11374], [12.5, 1.10352], [12.6, 1.09318], [12.7, 1.0827], [12.8, 1.07209], [12.9, 1.06134], [13, 1.05043], [13.1, 1.03936], [13.2, 1.02812], [13.3, 1.01669], [13.4, 1.00507], [13.5, 0.993232], [13.6, 0.981175], [13.7, 0.968879], [13.8, 0.956328], [13.9, 0.943503], [14, 0.930386], [14.1, 0.916955], [14.2, 0.903186], [14.3, 0.889054], [14.4, 0.87453], [14.5, 0.859584], [14.6, 0.844182], [14.7, 0.828286], [14.8, 0.811854], [14.9, 0.794842], [15, 0.777197], [15.1, 0.758863], [15.2, 0.739778], [15.3, 0.71987], [15.4, 0.69906], [15.5, 0.677261], [15.6, 0.654373], [15.7, 0.630284], [15.8, 0.604869], [15.9, 0.577984], [16, 0.549468], [16.1, 0.51914], [16.2, 0.486792], [16.3, 0.452189], [16.4, 0.415065], [16.5, 0.375118], [16.6, 0.332006], [16.7, 0.285346], [16.8, 0.234704], [16.9, 0.179604], [17, 0.119519], [17.1, 0.0538831], [17.2, -0.0178942], [17.3, -0.0964058], [17.4, -0.182204], [17.5, -0.275735], [17.6, -0.377252], [17.7, -0.486695], [17.8, -0.603547], [17.9, -0.726693], [18, -0.854304], [18.1, -0.98382], [18.2, -1.11206], [18.3, -1.23553], [18.4, -1.35082], [18.5, -1.45509], [18.6, -1.54643], [18.7, -1.62397], [18.8, -1.68788], [18.9, -1.73907], [19, -1.77895], [19.1, -1.80915], [19.2, -1.83128], [19.3, -1.84684], [19.4, -1.85714], [19.5, -1.86329], [19.6, -1.86617], [19.7, -1.86652], [19.8, -1.8649], [19.9, -1.86176], [20, -1.85744], [20.1, -1.85222], [20.2, -1.84631], [20.3, -1.83985], [20.4, -1.83299], [20.5, -1.8258], [20.6, -1.81837], [20.7, -1.81075], [20.8, -1.80298], [20.9, -1.7951], [21, -1.78713], [21.1, -1.7791], [21.2, -1.77101], [21.3, -1.76289], [21.4, -1.75474], [21.5, -1.74656], [21.6, -1.73837], [21.7, -1.73017], [21.8, -1.72196], [21.9, -1.71375], [22, -1.70553], [22.1, -1.6973], [22.2, -1.68908], [22.3, -1.68086], [22.4, -1.67264], [22.5, -1.66441], [22.6, -1.65619], [22.7, -1.64797], [22.8, -1.63975], [22.9, -1.63153], [23, -1.62331], [23.1, -1.61509], [23.2, -1.60688], [23.3, -1.59866], [23.4, -1.59044], [23.5, -1.58221], [23.6, -1.57399], [23.7, -1.56577], [23.8, -1.55754], [23.9, -1.5493], [24, -1.54107], [24.1, -1.53283], [24.2, -1.52458], [24.3, -1.51633], [24.4, -1.50807], [24.5, -1.4998], [24.6, -1.49152], [24.7, -1.48324], [24.8, -1.47494], [24.9, -1.46664], [25, -1.45832], [25.1, -1.44999], [25.2, -1.44164], [25.3, -1.43329], [25.4, -1.42491], [25.5, -1.41652], [25.6, -1.40811], [25.7, -1.39968], [25.8, -1.39123], [25.9, -1.38276], [26, -1.37427], [26.1, -1.36575], [26.2, -1.35721], [26.3, -1.34864], [26.4, -1.34004], [26.5, -1.33141], [26.6, -1.32275], [26.7, -1.31405], [26.8, -1.30532], [26.9, -1.29655], [27, -1.28774], [27.1, -1.27888], [27.2, -1.26999], [27.3, -1.26104], [27.4, -1.25205], [27.5, -1.243], [27.6, -1.2339], [27.7, -1.22475], [27.8, -1.21553], [27.9, -1.20624], [28, -1.19689], [28.1, -1.18747], [28.2, -1.17797], [28.3, -1.16839], [28.4, -1.15872], [28.5, -1.14897], [28.6, -1.13913], [28.7, -1.12918], [28.8, -1.11913], [28.9, -1.10897], [29, -1.09869], [29.1, -1.08828], [29.2, -1.07775], [29.3, -1.06707], [29.4, -1.05625], [29.5, -1.04527], [29.6, -1.03411], [29.7, -1.02279], [29.8, -1.01127], [29.9, -0.999547], [30, -0.98761], [30.1, -0.975443], [30.2, -0.96303], [30.3, -0.950353], [30.4, -0.937394], [30.5, -0.924133], [30.6, -0.910546], [30.7, -0.89661], [30.8, -0.882298], [30.9, -0.867581], [31, -0.852426], [31.1, -0.836797], [31.2, -0.820655], [31.3, -0.803958], [31.4, -0.786655], [31.5, -0.768695], [31.6, -0.750018], [31.7, -0.730556], [31.8, -0.710236], [31.9, -0.688974], [32, -0.666678], [32.1, -0.643242], [32.2, -0.618548], [32.3, -0.592463], [32.4, -0.564835], [32.5, -0.535494], [32.6, -0.504247], [32.7, -0.470873], [32.8, -0.435124], [32.9, -0.396717], [33, -0.355333], [33.1, -0.310609], [33.2, -0.262139], [33.3, -0.209471], [33.4, -0.152103], [33.5, -0.089489], [33.6, -0.02105], [33.7, 0.0538104], [33.8, 0.135672], [33.9, 0.225047], [34, 0.322305], [34.1, 0.427568], [34.2, 0.540581], [34.3, 0.660562], [34.4, 0.786074], [34.5, 0.914939], [34.6, 1.04428], [34.7, 1.17073], [34.8, 1.29076], [34.9, 1.40119], [35, 1.49958], [35.1, 1.58449], [35.2, 1.65557], [35.3, 1.71337], [35.4, 1.75907], [35.5, 1.79421], [35.6, 1.82043], [35.7, 1.83931], [35.8, 1.85225], [35.9, 1.86048], [36, 1.865], [36.1, 1.86661], [36.2, 1.86598], [36.3, 1.86359], [36.4, 1.85986], [36.5, 1.85509], [36.6, 1.84953], [36.7, 1.84334], [36.8, 1.83668], [36.9, 1.82965], [37, 1.82234], [37.1, 1.81482], [37.2, 1.80712], [37.3, 1.7993], [37.4, 1.79137], [37.5, 1.78337], [37.6, 1.77531], [37.7, 1.76721], [37.8, 1.75907], [37.9, 1.75091], [38, 1.74273], [38.1, 1.73453], [38.2, 1.72633], [38.3, 1.71811], [38.4, 1.70989], [38.5, 1.70167], [38.6, 1.69345], [38.7, 1.68523], [38.8, 1.67701], [38.9, 1.66878], [39, 1.66056], [39.1, 1.65234], [39.2, 1.64412], [39.3, 1.6359], [39.4, 1.62768], [39.5, 1.61946], [39.6, 1.61124], [39.7, 1.60302], [39.8, 1.5948], [39.9, 1.58658], [40, 1.57836], [40.1, 1.57014], [40.2, 1.56191], [40.3, 1.55368], [40.4, 1.54545], [40.5, 1.53721], [40.6, 1.52896], [40.7, 1.52071], [40.8, 1.51246], [40.9, 1.50419], [41, 1.49592], [41.1, 1.48764], [41.2, 1.47935], [41.3, 1.47105], [41.4, 1.46274], [41.5, 1.45442], [41.6, 1.44608], [41.7, 1.43773], [41.8, 1.42936], [41.9, 1.42098], [42, 1.41258], [42.1, 1.40416], [42.2, 1.39573], [42.3, 1.38727], [42.4, 1.37879], [42.5, 1.37028], [42.6, 1.36175], [42.7, 1.3532], [42.8, 1.34461], [42.9, 1.336], [43, 1.32735], [43.1, 1.31868], [43.2, 1.30996], [43.3, 1.30121], [43.4, 1.29242], [43.5, 1.28359], [43.6, 1.27472], [43.7, 1.2658], [43.8, 1.25684], [43.9, 1.24782], [44, 1.23875], [44.1, 1.22962], [44.2, 1.22043], [44.3, 1.21118], [44.4, 1.20187], [44.5, 1.19248], [44.6, 1.18302], [44.7, 1.17349], [44.8, 1.16387], [44.9, 1.15417], [45, 1.14437], [45.1, 1.13448], [45.2, 1.12448], [45.3, 1.11438], [45.4, 1.10417], [45.5, 1.09383], [45.6, 1.08336], [45.7, 1.07276], [45.8, 1.06202], [45.9, 1.05112], [46, 1.04006], [46.1, 1.02883], [46.2, 1.01741], [46.3, 1.0058], [46.4, 0.993981], [46.5, 0.981939], [46.6, 0.969658], [46.7, 0.957124], [46.8, 0.944317], [46.9, 0.931219], [47, 0.917808], [47.1, 0.904061], [47.2, 0.889952], [47.3, 0.875454], [47.4, 0.860536], [47.5, 0.845163], [47.6, 0.829299], [47.7, 0.812903], [47.8, 0.795928], [47.9, 0.778325], [48, 0.760036], [48.1, 0.741], [48.2, 0.721146], [48.3, 0.700396], [48.4, 0.678662], [48.5, 0.655845], [48.6, 0.631835], [48.7, 0.606507], [48.8, 0.579719], [48.9, 0.551311], [49, 0.521102], [49.1, 0.488887], [49.2, 0.454434], [49.3, 0.417477], [49.4, 0.377716], [49.5, 0.334815], [49.6, 0.288389], [49.7, 0.238011], [49.8, 0.183206], [49.9, 0.12345], [50, 0.0581805], [50.1, -0.0131934], [50.2, -0.0912651], [50.3, -0.17659], [50.4, -0.269626], [50.5, -0.370639], [50.6, -0.479594], [50.7, -0.596007], [50.8, -0.718803], [50.9, -0.846202], [51, -0.975686], [51.1, -1.10411], [51.2, -1.22798], [51.3, -1.34388], [51.4, -1.44891], [51.5, -1.54109], [51.6, -1.61951], [51.7, -1.68425], [51.8, -1.7362], [51.9, -1.77675], [52, -1.80751], [52.1, -1.8301], [52.2, -1.84603], [52.3, -1.85663], [52.4, -1.86301], [52.5, -1.86607], [52.6, -1.86656], [52.7, -1.86505], [52.8, -1.86199], [52.9, -1.85774], [53, -1.85257], [53.1, -1.8467], [53.2, -1.84027], [53.3, -1.83343], [53.4, -1.82626], [53.5, -1.81884], [53.6, -1.81123], [53.7, -1.80347], [53.8, -1.79559], [53.9, -1.78763], [54, -1.7796], [54.1, -1.77152], [54.2, -1.7634], [54.3, -1.75525], [54.4, -1.74708], [54.5, -1.73889], [54.6, -1.73069], [54.7, -1.72248], [54.8, -1.71426], [54.9, -1.70604], [55, -1.69782], [55.1, -1.6896], [55.2, -1.68137], [55.3, -1.67315], [55.4, -1.66493], [55.5, -1.65671], [55.6, -1.64849], [55.7, -1.64027], [55.8, -1.63205], [55.9, -1.62383], [56, -1.61561], [56.1, -1.60739], [56.2, -1.59917], [56.3, -1.59095], [56.4, -1.58273], [56.5, -1.57451], [56.6, -1.56628], [56.7, -1.55805], [56.8, -1.54982], [56.9, -1.54158], [57, -1.53334], [57.1, -1.5251], [57.2, -1.51684], [57.3, -1.50859], [57.4, -1.50032], [57.5, -1.49204], [57.6, -1.48376], [57.7, -1.47546], [57.8, -1.46716], [57.9, -1.45884], [58, -1.45051], [58.1, -1.44217], [58.2, -1.43381], [58.3, -1.42544], [58.4, -1.41705], [58.5, -1.40864], [58.6, -1.40021], [58.7, -1.39176], [58.8, -1.3833], [58.9, -1.3748], [59, -1.36629], [59.1, -1.35775], [59.2, -1.34918], [59.3, -1.34058], [59.4, -1.33195], [59.5, -1.32329], [59.6, -1.3146], [59.7, -1.30587], [59.8, -1.2971], [59.9, -1.28829], [60, -1.27944], [60.1, -1.27055], [60.2, -1.26161], [60.3, -1.25262], [60.4, -1.24357], [60.5, -1.23448], [60.6, -1.22532], [60.7, -1.21611], [60.8, -1.20683], [60.9, -1.19748], [61, -1.18806], [61.1, -1.17857], [61.2, -1.16899], [61.3, -1.15933], [61.4, -1.14959], [61.5, -1.13975], [61.6, -1.12981], [61.7, -1.11976], [61.8, -1.10961], [61.9, -1.09934], [62, -1.08894], [62.1, -1.07841], [62.2, -1.06775], [62.3, -1.05693], [62.4, -1.04596], [62.5, -1.03482], [62.6, -1.0235], [62.7, -1.012], [62.8, -1.00029], [62.9, -0.988367], [63, -0.976215], [63.1, -0.963817], [63.2, -0.951158], [63.3, -0.938217], [63.4, -0.924975], [63.5, -0.91141], [63.6, -0.897497], [63.7, -0.883209], [63.8, -0.868518], [63.9, -0.853391], [64, -0.837793], [64.1, -0.821685], [64.2, -0.805024], [64.3, -0.787761], [64.4, -0.769844], [64.5, -0.751213], [64.6, -0.731803], [64.7, -0.711539], [64.8, -0.690339], [64.9, -0.668111], [65, -0.64475], [65.1, -0.620139], [65.2, -0.594145], [65.3, -0.566619], [65.4, -0.537391], [65.5, -0.50627], [65.6, -0.473037], [65.7, -0.437445], [65.8, -0.399214], [65.9, -0.358026], [66, -0.313524], [66.1, -0.265302], [66.2, -0.212912], [66.3, -0.155855], [66.4, -0.0935872], [66.5, -0.0255316], [66.6, 0.048908], [66.7, 0.130314], [66.8, 0.219204], [66.9, 0.31596], [67, 0.420723], [67.1, 0.533266], [67.2, 0.652845], [67.3, 0.778065], [67.4, 0.906797], [67.5, 1.03621], [67.6, 1.16294], [67.7, 1.28347], [67.8, 1.39459], [67.9, 1.49379], [68, 1.57957], [68.1, 1.65151], [68.2, 1.71011], [68.3, 1.75653], [68.4, 1.79228], [68.5, 1.81901], [68.6, 1.83831], [68.7, 1.85159], [68.8, 1.86008], [68.9, 1.86481], [69, 1.86658], [69.1, 1.86607], [69.2, 1.86379], [69.3, 1.86013], [69.4, 1.85542], [69.5, 1.8499], [69.6, 1.84374], [69.7, 1.83711], [69.8, 1.8301], [69.9, 1.82281], [70, 1.81529], [70.1, 1.80761], [70.2, 1.79979], [70.3, 1.79187], [70.4, 1.78388], [70.5, 1.77582], [70.6, 1.76772], [70.7, 1.75958], [70.8, 1.75142], [70.9, 1.74324], [71, 1.73505], [71.1, 1.72684], [71.2, 1.71863], [71.3, 1.71041], [71.4, 1.70219], [71.5, 1.69397], [71.6, 1.68574], [71.7, 1.67752], [71.8, 1.6693], [71.9, 1.66108], [72, 1.65286], [72.1, 1.64464], [72.2, 1.63642], [72.3, 1.6282], [72.4, 1.61998], [72.5, 1.61176], [72.6, 1.60354], [72.7, 1.59532], [72.8, 1.5871], [72.9, 1.57888], [73, 1.57065], [73.1, 1.56243], [73.2, 1.5542], [73.3, 1.54596], [73.4, 1.53772], [73.5, 1.52948], [73.6, 1.52123], [73.7, 1.51298], [73.8, 1.50471], [73.9, 1.49644], [74, 1.48816], [74.1, 1.47987], [74.2, 1.47157], [74.3, 1.46326], [74.4, 1.45494], [74.5, 1.4466], [74.6, 1.43825], [74.7, 1.42989], [74.8, 1.42151], [74.9, 1.41311], [75, 1.40469], [75.1, 1.39626], [75.2, 1.3878], [75.3, 1.37932], [75.4, 1.37082], [75.5, 1.36229], [75.6, 1.35373], [75.7, 1.34515], [75.8, 1.33654], [75.9, 1.3279], [76, 1.31922], [76.1, 1.31051], [76.2, 1.30176], [76.3, 1.29298], [76.4, 1.28415], [76.5, 1.27528], [76.6, 1.26636], [76.7, 1.2574], [76.8, 1.24839], [76.9, 1.23932], [77, 1.23019], [77.1, 1.22101], [77.2, 1.21177], [77.3, 1.20246], [77.4, 1.19307], [77.5, 1.18362], [77.6, 1.17409], [77.7, 1.16448], [77.8, 1.15478], [77.9, 1.14499], [78, 1.1351], [78.1, 1.12512], [78.2, 1.11502], [78.3, 1.10481], [78.4, 1.09448], [78.5, 1.08403], [78.6, 1.07343], [78.7, 1.0627], [78.8, 1.05181], [78.9, 1.04076], [79, 1.02954], [79.1, 1.01814], [79.2, 1.00654], [79.3, 0.99473], [79.4, 0.982702], [79.5, 0.970437], [79.6, 0.957919], [79.7, 0.94513], [79.8, 0.932051], [79.9, 0.91866], [80, 0.904935], [80.1, 0.89085], [80.2, 0.876377], [80.3, 0.861486], [80.4, 0.846143], [80.5, 0.830311], [80.6, 0.813949], [80.7, 0.797012], [80.8, 0.77945], [80.9, 0.761206], [81, 0.742219], [81.1, 0.722418], [81.2, 0.701727], [81.3, 0.680057], [81.4, 0.657312], [81.5, 0.633381], [81.6, 0.608139], [81.7, 0.581447], [81.8, 0.553146], [81.9, 0.523056], [82, 0.490974], [82.1, 0.456669], [82.2, 0.419877], [82.3, 0.380303], [82.4, 0.337609], [82.5, 0.291417], [82.6, 0.241301], [82.7, 0.186788], [82.8, 0.12736], [82.9, 0.0624537], [83, -0.00851921], [83.1, -0.0861532], [83.2, -0.171008], [83.3, -0.263549], [83.4, -0.364058], [83.5, -0.472523], [83.6, -0.588492], [83.7, -0.710932], [83.8, -0.838109], [83.9, -0.967549], [84, -1.09614], [84.1, -1.2204], [84.2, -1.33689], [84.3, -1.44267], [84.4, -1.5357], [84.5, -1.61499], [84.6, -1.68057], [84.7, -1.73329], [84.8, -1.77451], [84.9, -1.80583], [85, -1.82889], [85.1, -1.8452], [85.2, -1.8561], [85.3, -1.86271], [85.4, -1.86596], [85.5, -1.86659], [85.6, -1.86519], [85.7, -1.86222], [85.8, -1.85804], [85.9, -1.85292], [86, -1.84708], [86.1, -1.84069], [86.2, -1.83387], [86.3, -1.82672], [86.4, -1.81931], [86.5, -1.81171], [86.6, -1.80396], [86.7, -1.79609], [86.8, -1.78813], [86.9, -1.78011], [87, -1.77203], [87.1, -1.76391], [87.2, -1.75576], [87.3, -1.74759], [87.4, -1.7394], [87.5, -1.7312], [87.6, -1.72299], [87.7, -1.71478], [87.8, -1.70656], [87.9, -1.69834], [88, -1.69011], [88.1, -1.68189], [88.2, -1.67367], [88.3, -1.66545], [88.4, -1.65722], [88.5, -1.649], [88.6, -1.64078], [88.7, -1.63256], [88.8, -1.62435], [88.9, -1.61613], [89, -1.60791], [89.1, -1.59969], [89.2, -1.59147], [89.3, -1.58325], [89.4, -1.57502], [89.5, -1.5668], [89.6, -1.55857], [89.7, -1.55034], [89.8, -1.5421], [89.9, -1.53386], [90, -1.52562], [90.1, -1.51736], [90.2, -1.5091], [90.3, -1.50084], [90.4, -1.49256], [90.5, -1.48428], [90.6, -1.47599], [90.7, -1.46768], [90.8, -1.45936], [90.9, -1.45104], [91, -1.44269], [91.1, -1.43434], [91.2, -1.42596], [91.3, -1.41757], [91.4, -1.40917], [91.5, -1.40074], [91.6, -1.3923], [91.7, -1.38383], [91.8, -1.37534], [91.9, -1.36682], [92, -1.35828], [92.1, -1.34972], [92.2, -1.34112], [92.3, -1.33249], [92.4, -1.32384], [92.5, -1.31514], [92.6, -1.30642], [92.7, -1.29765], [92.8, -1.28885], [92.9, -1.28], [93, -1.27111], [93.1, -1.26217], [93.2, -1.25318], [93.3, -1.24414], [93.4, -1.23505], [93.5, -1.2259], [93.6, -1.21669], [93.7, -1.20741], [93.8, -1.19807], [93.9, -1.18865], [94, -1.17916], [94.1, -1.1696], [94.2, -1.15994], [94.3, -1.1502], [94.4, -1.14037], [94.5, -1.13044], [94.6, -1.1204], [94.7, -1.11025], [94.8, -1.09999], [94.9, -1.0896], [95, -1.07908], [95.1, -1.06842], [95.2, -1.05762], [95.3, -1.04665], [95.4, -1.03553], [95.5, -1.02422], [95.6, -1.01273], [95.7, -1.00103], [95.8, -0.989122], [95.9, -0.976985], [96, -0.964604], [96.1, -0.951961], [96.2, -0.939039], [96.3, -0.925816], [96.4, -0.912272], [96.5, -0.898381], [96.6, -0.884118], [96.7, -0.869453], [96.8, -0.854355], [96.9, -0.838787], [97, -0.822713], [97.1, -0.806087], [97.2, -0.788864], [97.3, -0.77099], [97.4, -0.752406], [97.5, -0.733046], [97.6, -0.712839], [97.7, -0.6917], [97.8, -0.669539], [97.9, -0.646253], [98, -0.621724], [98.1, -0.595821], [98.2, -0.568396], [98.3, -0.539281], [98.4, -0.508284], [98.5, -0.475191], [98.6, -0.439755], [98.7, -0.401699], [98.8, -0.360707], [98.9, -0.316424], [99, -0.268449], [99.1, -0.216335], [99.2, -0.159586], [99.3, -0.0976626], [99.4, -0.029988], [99.5, 0.0440332], [99.6, 0.124985], [99.7, 0.213392], [99.8, 0.309647], [99.9, 0.413909], [100, 0.525979], [100.1, 0.645149], [100.2, 0.77007], [100.3, 0.898659], [100.4, 1.02812], [100.5, 1.15512], [100.6, 1.27615], [100.7, 1.38794], [100.8, 1.48794], [100.9, 1.57459], [101, 1.64739], [101.1, 1.7068], [101.2, 1.75394], [101.3, 1.79032], [101.4, 1.81757], [101.5, 1.83729], [101.6, 1.85091], [101.7, 1.85967], [101.8, 1.86461], [101.9, 1.86655], [102, 1.86616], [102.1, 1.86397], [102.2, 1.86039], [102.3, 1.85574], [102.4, 1.85026], [102.5, 1.84415], [102.6, 1.83754], [102.7, 1.83055], [102.8, 1.82328], [102.9, 1.81577], [103, 1.8081], [103.1, 1.80029], [103.2, 1.79237], [103.3, 1.78438], [103.4, 1.77633], [103.5, 1.76823], [103.6, 1.7601], [103.7, 1.75194], [103.8, 1.74376], [103.9, 1.73556], [104, 1.72736], [104.1, 1.71914], [104.2, 1.71093], [104.3, 1.70271], [104.4, 1.69448], [104.5, 1.68626], [104.6, 1.67804], [104.7, 1.66982], [104.8, 1.66159], [104.9, 1.65337], [105, 1.64515], [105.1, 1.63693], [105.2, 1.62871], [105.3, 1.62049], [105.4, 1.61228], [105.5, 1.60406], [105.6, 1.59584], [105.7, 1.58762], [105.8, 1.57939], [105.9, 1.57117], [106, 1.56294], [106.1, 1.55471], [106.2, 1.54648], [106.3, 1.53824], [106.4, 1.53], [106.5, 1.52175], [106.6, 1.51349], [106.7, 1.50523], [106.8, 1.49696], [106.9, 1.48868], [107, 1.48039], [107.1, 1.4721], [107.2, 1.46379], [107.3, 1.45546], [107.4, 1.44713], [107.5, 1.43878], [107.6, 1.43042], [107.7, 1.42204], [107.8, 1.41364], [107.9, 1.40522], [108, 1.39679], [108.1, 1.38833], [108.2, 1.37985], [108.3, 1.37135], [108.4, 1.36282], [108.5, 1.35427], [108.6, 1.34569], [108.7, 1.33708], [108.8, 1.32844], [108.9, 1.31977], [109, 1.31106], [109.1, 1.30231], [109.2, 1.29353], [109.3, 1.28471], [109.4, 1.27584], [109.5, 1.26693], [109.6, 1.25796], [109.7, 1.24895], [109.8, 1.23989], [109.9, 1.23077], [110, 1.22159], [110.1, 1.21235], [110.2, 1.20304], [110.3, 1.19367], [110.4, 1.18422], [110.5, 1.17469], [110.6, 1.16508], [110.7, 1.15539], [110.8, 1.14561], [110.9, 1.13573], [111, 1.12575], [111.1, 1.11566], [111.2, 1.10546], [111.3, 1.09513], [111.4, 1.08469], [111.5, 1.0741], [111.6, 1.06338], [111.7, 1.0525], [111.8, 1.04146], [111.9, 1.03025], [112, 1.01886], [112.1, 1.00727], [112.2, 0.995478], [112.3, 0.983464], [112.4, 0.971215], [112.5, 0.958713], [112.6, 0.945942], [112.7, 0.932881], [112.8, 0.919511], [112.9, 0.905807], [113, 0.891746], [113.1, 0.877298], [113.2, 0.862434], [113.3, 0.847121], [113.4, 0.831321], [113.5, 0.814993], [113.6, 0.798094], [113.7, 0.780573], [113.8, 0.762374], [113.9, 0.743435], [114, 0.723688], [114.1, 0.703054], [114.2, 0.681449], [114.3, 0.658774], [114.4, 0.634921], [114.5, 0.609766], [114.6, 0.583169], [114.7, 0.554974], [114.8, 0.525003], [114.9, 0.493052], [115, 0.458894], [115.1, 0.422267], [115.2, 0.382876], [115.3, 0.340389], [115.4, 0.294429], [115.5, 0.244573], [115.6, 0.190352], [115.7, 0.131248], [115.8, 0.0667029], [115.9, -0.00387131], [116, -0.0810698], [116.1, -0.165456], [116.2, -0.257503], [116.3, -0.357509], [116.4, -0.465482], [116.5, -0.581003], [116.6, -0.70308], [116.7, -0.830024], [116.8, -0.959408], [116.9, -1.08815], [117, -1.21279], [117.1, -1.32986], [117.2, -1.43639], [117.3, -1.53026], [117.4, -1.61042], [117.5, -1.67684], [117.6, -1.73033], [117.7, -1.77223], [117.8, -1.80412], [117.9, -1.82765], [118, -1.84435], [118.1, -1.85555], [118.2, -1.8624], [118.3, -1.86584], [118.4, -1.86662], [118.5, -1.86533], [118.6, -1.86245], [118.7, -1.85833], [118.8, -1.85326], [118.9, -1.84747], [119, -1.8411], [119.1, -1.83431], [119.2, -1.82717], [119.3, -1.81978], [119.4, -1.81219], [119.5, -1.80445], [119.6, -1.79659], [119.7, -1.78864], [119.8, -1.78061], [119.9, -1.77254], [120, -1.76442], [120.1, -1.75628], [120.2, -1.7481], [120.3, -1.73992], [120.4, -1.73172], [120.5, -1.72351], [120.6, -1.71529], [120.7, -1.70708], [120.8, -1.69885], [120.9, -1.69063], [121, -1.68241], [121.1, -1.67418], [121.2, -1.66596], [121.3, -1.65774], [121.4, -1.64952], [121.5, -1.6413], [121.6, -1.63308], [121.7, -1.62486], [121.8, -1.61664], [121.9, -1.60842], [122, -1.60021], [122.1, -1.59199], [122.2, -1.58376], [122.3, -1.57554], [122.4, -1.56732], [122.5, -1.55909], [122.6, -1.55086], [122.7, -1.54262], [122.8, -1.53438], [122.9, -1.52613], [123, -1.51788], [123.1, -1.50962], [123.2, -1.50136], [123.3, -1.49308], [123.4, -1.4848], [123.5, -1.47651], [123.6, -1.4682], [123.7, -1.45989], [123.8, -1.45156], [123.9, -1.44322], [124, -1.43486], [124.1, -1.42649], [124.2, -1.4181], [124.3, -1.4097], [124.4, -1.40127], [124.5, -1.39283], [124.6, -1.38436], [124.7, -1.37587], [124.8, -1.36736], [124.9, -1.35882], [125, -1.35026], [125.1, -1.34166], [125.2, -1.33304], [125.3, -1.32438], [125.4, -1.31569], [125.5, -1.30697], [125.6, -1.2982], [125.7, -1.2894], [125.8, -1.28056], [125.9, -1.27167], [126, -1.26273], [126.1, -1.25375], [126.2, -1.24471], [126.3, -1.23562], [126.4, -1.22648], [126.5, -1.21727], [126.6, -1.208], [126.7, -1.19866], [126.8, -1.18925], [126.9, -1.17976], [127, -1.1702], [127.1, -1.16055], [127.2, -1.15082], [127.3, -1.14099], [127.4, -1.13106], [127.5, -1.12103], [127.6, -1.11089], [127.7, -1.10063], [127.8, -1.09025], [127.9, -1.07974], [128, -1.0691], [128.1, -1.0583], [128.2, -1.04735], [128.3, -1.03623], [128.4, -1.02494], [128.5, -1.01345], [128.6, -1.00177], [128.7, -0.989877], [128.8, -0.977754], [128.9, -0.965389], [129, -0.952763], [129.1, -0.939859], [129.2, -0.926656], [129.3, -0.913132], [129.4, -0.899264], [129.5, -0.885025], [129.6, -0.870387], [129.7, -0.855316], [129.8, -0.83978], [129.9, -0.823738], [130, -0.807149], [130.1, -0.789964], [130.2, -0.772133], [130.3, -0.753595], [130.4, -0.734287], [130.5, -0.714134], [130.6, -0.693057], [130.7, -0.670963], [130.8, -0.647751], [130.9, -0.623304], [131, -0.597491], [131.1, -0.570167], [131.2, -0.541163], [131.3, -0.510291], [131.4, -0.477336], [131.5, -0.442055], [131.6, -0.404172], [131.7, -0.363375], [131.8, -0.31931], [131.9, -0.271579], [132, -0.219739], [132.1, -0.163297], [132.2, -0.101715], [132.3, -0.0344194], [132.4, 0.0391856], [132.5, 0.119686], [132.6, 0.207612], [132.7, 0.303366], [132.8, 0.407126], [132.9, 0.51872], [133, 0.637477], [133.1, 0.76209], [133.2, 0.890524], [133.3, 1.02002], [133.4, 1.14729], [133.5, 1.26879], [133.6, 1.38124], [133.7, 1.48204], [133.8, 1.56955], [133.9, 1.64322], [134, 1.70345], [134.1, 1.75131], [134.2, 1.78832], [134.3, 1.8161], [134.4, 1.83624], [134.5, 1.85021], [134.6, 1.85924], [134.7, 1.86439], [134.8, 1.8665], [134.9, 1.86624], [135, 1.86416], [135.1, 1.86065], [135.2, 1.85606], [135.3, 1.85063], [135.4, 1.84455], [135.5, 1.83797], [135.6, 1.831], [135.7, 1.82374], [135.8, 1.81625], [135.9, 1.80858], [136, 1.80078], [136.1, 1.79287], [136.2, 1.78489], [136.3, 1.77684], [136.4, 1.76874], [136.5, 1.76061], [136.6, 1.75245], [136.7, 1.74427], [136.8, 1.73608], [136.9, 1.72787], [137, 1.71966], [137.1, 1.71144], [137.2, 1.70322], [137.3, 1.695], [137.4, 1.68678], [137.5, 1.67855], [137.6, 1.67033], [137.7, 1.66211], [137.8, 1.65389], [137.9, 1.64567], [138, 1.63745], [138.1, 1.62923], [138.2, 1.62101], [138.3, 1.61279], [138.4, 1.60457], [138.5, 1.59635], [138.6, 1.58813], [138.7, 1.57991], [138.8, 1.57169], [138.9, 1.56346], [139, 1.55523], [139.1, 1.547], [139.2, 1.53876], [139.3, 1.53052], [139.4, 1.52227], [139.5, 1.51401], [139.6, 1.50575], [139.7, 1.49748], [139.8, 1.4892], [139.9, 1.48091], [140, 1.47262], [140.1, 1.46431], [140.2, 1.45599], [140.3, 1.44765], [140.4, 1.4393], [140.5, 1.43094], [140.6, 1.42256], [140.7, 1.41417], [140.8, 1.40575], [140.9, 1.39732], [141, 1.38886], [141.1, 1.38039], [141.2, 1.37189], [141.3, 1.36336], [141.4, 1.35481], [141.5, 1.34623], [141.6, 1.33762], [141.7, 1.32898], [141.8, 1.32031], [141.9, 1.31161], [142, 1.30286], [142.1, 1.29408], [142.2, 1.28526], [142.3, 1.2764], [142.4, 1.26749], [142.5, 1.25853], [142.6, 1.24952], [142.7, 1.24046], [142.8, 1.23134], [142.9, 1.22217], [143, 1.21293], [143.1, 1.20363], [143.2, 1.19426], [143.3, 1.18481], [143.4, 1.17529], [143.5, 1.16569], [143.6, 1.156], [143.7, 1.14622], [143.8, 1.13635], [143.9, 1.12638], [144, 1.11629], [144.1, 1.1061], [144.2, 1.09579], [144.3, 1.08535], [144.4, 1.07477], [144.5, 1.06406], [144.6, 1.05319], [144.7, 1.04216], [144.8, 1.03096], [144.9, 1.01958], [145, 1.00801], [145.1, 0.996225], [145.2, 0.984226], [145.3, 0.971991], [145.4, 0.959506], [145.5, 0.946752], [145.6, 0.933711], [145.7, 0.92036], [145.8, 0.906678], [145.9, 0.89264], [146, 0.878217], [146.1, 0.863381], [146.2, 0.848096], [146.3, 0.832328], [146.4, 0.816035], [146.5, 0.799173], [146.6, 0.781693], [146.7, 0.763538], [146.8, 0.744647], [146.9, 0.724953], [147, 0.704378], [147.1, 0.682837], [147.2, 0.660232], [147.3, 0.636456], [147.4, 0.611387], [147.5, 0.584885], [147.6, 0.556796], [147.7, 0.526941], [147.8, 0.495122], [147.9, 0.461109], [148, 0.424645], [148.1, 0.385438], [148.2, 0.343156], [148.3, 0.297426], [148.4, 0.247828], [148.5, 0.193895], [148.6, 0.135114], [148.7, 0.0709283], [148.8, 0.000750458], [148.9, -0.0760148], [149, -0.159934], [149.1, -0.251489], [149.2, -0.350991], [149.3, -0.458471], [149.4, -0.57354], [149.5, -0.695247], [149.6, -0.82195], [149.7, -0.951265], [149.8, -1.08015], [149.9, -1.20515], [150, -1.32279], [150.1, -1.43005], [150.2, -1.52476], [150.3, -1.60579], [150.4, -1.67306], [150.5, -1.72733], [150.6, -1.76991], [150.7, -1.80238], [150.8, -1.82639], [150.9, -1.84347], [151, -1.85499], [151.1, -1.86208], [151.2, -1.86571], [151.3, -1.86664], [151.4, -1.86546], [151.5, -1.86267], [151.6, -1.85862], [151.7, -1.85361], [151.8, -1.84785], [151.9, -1.84152], [152, -1.83474], [152.1, -1.82763], [152.2, -1.82025], [152.3, -1.81268], [152.4, -1.80494], [152.5, -1.79709], [152.6, -1.78914], [152.7, -1.78112], [152.8, -1.77305], [152.9, -1.76493], [153, -1.75679], [153.1, -1.74862], [153.2, -1.74043], [153.3, -1.73223], [153.4, -1.72402], [153.5, -1.71581], [153.6, -1.70759], [153.7, -1.69937], [153.8, -1.69115], [153.9, -1.68292], [154, -1.6747], [154.1, -1.66648], [154.2, -1.65826], [154.3, -1.65004], [154.4, -1.64182], [154.5, -1.6336], [154.6, -1.62538], [154.7, -1.61716], [154.8, -1.60894], [154.9, -1.60072], [155, -1.5925], [155.1, -1.58428], [155.2, -1.57606], [155.3, -1.56783], [155.4, -1.5596], [155.5, -1.55137], [155.6, -1.54314], [155.7, -1.5349], [155.8, -1.52665], [155.9, -1.5184], [156, -1.51014], [156.1, -1.50188], [156.2, -1.4936], [156.3, -1.48532], [156.4, -1.47703], [156.5, -1.46872], [156.6, -1.46041], [156.7, -1.45208], [156.8, -1.44374], [156.9, -1.43539], [157, -1.42702], [157.1, -1.41863], [157.2, -1.41023], [157.3, -1.4018], [157.4, -1.39336], [157.5, -1.38489], [157.6, -1.37641], [157.7, -1.36789], [157.8, -1.35936], [157.9, -1.35079], [158, -1.3422], [158.1, -1.33358], [158.2, -1.32493], [158.3, -1.31624], [158.4, -1.30751], [158.5, -1.29875], [158.6, -1.28995], [158.7, -1.28111], [158.8, -1.27223], [158.9, -1.2633], [159, -1.25431], [159.1, -1.24528], [159.2, -1.2362], [159.3, -1.22705], [159.4, -1.21785], [159.5, -1.20858], [159.6, -1.19925], [159.7, -1.18984], [159.8, -1.18036], [159.9, -1.1708], [160, -1.16116], [160.1, -1.15143], [160.2, -1.14161], [160.3, -1.13169], [160.4, -1.12167], [160.5, -1.11153], [160.6, -1.10128], [160.7, -1.09091], [160.8, -1.08041], [160.9, -1.06977], [161, -1.05898], [161.1, -1.04804], [161.2, -1.03693], [161.3, -1.02565], [161.4, -1.01418], [161.5, -1.00251], [161.6, -0.990631], [161.7, -0.978523], [161.8, -0.966173], [161.9, -0.953564], [162, -0.940678], [162.1, -0.927494], [162.2, -0.913992], [162.3, -0.900146], [162.4, -0.885931], [162.5, -0.871318], [162.6, -0.856276], [162.7, -0.84077], [162.8, -0.824761], [162.9, -0.808208], [163, -0.791062], [163.1, -0.773273], [163.2, -0.754781], [163.3, -0.735523], [163.4, -0.715426], [163.5, -0.69441], [163.6, -0.672383], [163.7, -0.649244], [163.8, -0.624878], [163.9, -0.599156], [164, -0.571931], [164.1, -0.543037], [164.2, -0.512289], [164.3, -0.479471], [164.4, -0.444344], [164.5, -0.406634], [164.6, -0.36603], [164.7, -0.322181], [164.8, -0.274693], [164.9, -0.223125], [165, -0.166988], [165.1, -0.105745], [165.2, -0.0388259], [165.3, 0.0343653], [165.4, 0.114416], [165.5, 0.201862], [165.6, 0.297116], [165.7, 0.400374], [165.8, 0.51149], [165.9, 0.629828], [166, 0.754125], [166.1, 0.882393], [166.2, 1.01192], [166.3, 1.13942], [166.4, 1.26139], [166.5, 1.3745], [166.6, 1.47609], [166.7, 1.56446], [166.8, 1.639], [166.9, 1.70004], [167, 1.74864], [167.1, 1.78628], [167.2, 1.81459], [167.3, 1.83517], [167.4, 1.84949], [167.5, 1.8588], [167.6, 1.86417], [167.7, 1.86644], [167.8, 1.86632], [167.9, 1.86433], [168, 1.86091], [168.1, 1.85638], [168.2, 1.85099], [168.3, 1.84494], [168.4, 1.83839], [168.5, 1.83145], [168.6, 1.8242], [168.7, 1.81673], [168.8, 1.80907], [168.9, 1.80127], [169, 1.79337], [169.1, 1.78539], [169.2, 1.77734], [169.3, 1.76925], [169.4, 1.76112], [169.5, 1.75296], [169.6, 1.74478], [169.7, 1.73659], [169.8, 1.72839], [169.9, 1.72018], [170, 1.71196], [170.1, 1.70374], [170.2, 1.69552], [170.3, 1.68729], [170.4, 1.67907], [170.5, 1.67085], [170.6, 1.66263], [170.7, 1.6544], [170.8, 1.64618], [170.9, 1.63796], [171, 1.62975], [171.1, 1.62153], [171.2, 1.61331], [171.3, 1.60509], [171.4, 1.59687], [171.5, 1.58865], [171.6, 1.58043], [171.7, 1.5722], [171.8, 1.56398], [171.9, 1.55575], [172, 1.54751], [172.1, 1.53928], [172.2, 1.53103], [172.3, 1.52279], [172.4, 1.51453], [172.5, 1.50627], [172.6, 1.498], [172.7, 1.48972], [172.8, 1.48144], [172.9, 1.47314], [173, 1.46483], [173.1, 1.45651], [173.2, 1.44818], [173.3, 1.43983], [173.4, 1.43147], [173.5, 1.42309], [173.6, 1.41469], [173.7, 1.40628], [173.8, 1.39785], [173.9, 1.38939], [174, 1.38092], [174.1, 1.37242], [174.2, 1.3639], [174.3, 1.35535], [174.4, 1.34677], [174.5, 1.33817], [174.6, 1.32953], [174.7, 1.32086], [174.8, 1.31215], [174.9, 1.30341], [175, 1.29464], [175.1, 1.28582], [175.2, 1.27695], [175.3, 1.26805], [175.4, 1.25909], [175.5, 1.25009], [175.6, 1.24103], [175.7, 1.23192], [175.8, 1.22275], [175.9, 1.21351], [176, 1.20422], [176.1, 1.19485], [176.2, 1.18541], [176.3, 1.17589], [176.4, 1.1663], [176.5, 1.15661], [176.6, 1.14684], [176.7, 1.13697], [176.8, 1.12701], [176.9, 1.11693], [177, 1.10674], [177.1, 1.09644], [177.2, 1.08601], [177.3, 1.07544], [177.4, 1.06473], [177.5, 1.05387], [177.6, 1.04286], [177.7, 1.03167], [177.8, 1.0203], [177.9, 1.00874], [178, 0.996972], [178.1, 0.984986], [178.2, 0.972767], [178.3, 0.960298], [178.4, 0.947562], [178.5, 0.934539], [178.6, 0.921208], [178.7, 0.907548], [178.8, 0.893533], [178.9, 0.879135], [179, 0.864325], [179.1, 0.84907], [179.2, 0.833334], [179.3, 0.817075], [179.4, 0.80025], [179.5, 0.78281], [179.6, 0.764699], [179.7, 0.745857], [179.8, 0.726215], [179.9, 0.705698], [180, 0.68422], [180.1, 0.661685], [180.2, 0.637986], [180.3, 0.613002], [180.4, 0.586595], [180.5, 0.55861], [180.6, 0.528872], [180.7, 0.497182], [180.8, 0.463315], [180.9, 0.427013], [181, 0.387988], [181.1, 0.345909], [181.2, 0.300408], [181.3, 0.251066], [181.4, 0.19742], [181.5, 0.13896], [181.6, 0.0751302], [181.7, 0.00534622], [181.8, -0.070988], [181.9, -0.154443], [182, -0.245507], [182.1, -0.344505], [182.2, -0.45149], [182.3, -0.566104], [182.4, -0.687435], [182.5, -0.813886], [182.6, -0.943121], [182.7, -1.07213], [182.8, -1.19748], [182.9, -1.31568], [183, -1.42367], [183.1, -1.51921], [183.2, -1.60111], [183.3, -1.66923], [183.4, -1.72428], [183.5, -1.76755], [183.6, -1.80061], [183.7, -1.8251], [183.8, -1.84258], [183.9, -1.8544], [184, -1.86175], [184.1, -1.86557], [184.2, -1.86665], [184.3, -1.86559], [184.4, -1.86288], [184.5, -1.85891], [184.6, -1.85395], [184.7, -1.84823], [184.8, -1.84193], [184.9, -1.83518], [185, -1.82809], [185.1, -1.82072], [185.2, -1.81316], [185.3, -1.80543], [185.4, -1.79758], [185.5, -1.78964], [185.6, -1.78163], [185.7, -1.77356], [185.8, -1.76544], [185.9, -1.7573], [186, -1.74913], [186.1, -1.74095], [186.2, -1.73275], [186.3, -1.72454], [186.4, -1.71633], [186.5, -1.70811], [186.6, -1.69989], [186.7, -1.69166], [186.8, -1.68344], [186.9, -1.67522], [187, -1.667], [187.1, -1.65877], [187.2, -1.65055], [187.3, -1.64233], [187.4, -1.63411], [187.5, -1.62589], [187.6, -1.61768], [187.7, -1.60946], [187.8, -1.60124], [187.9, -1.59302], [188, -1.5848], [188.1, -1.57657], [188.2, -1.56835], [188.3, -1.56012], [188.4, -1.55189], [188.5, -1.54365], [188.6, -1.53541], [188.7, -1.52717], [188.8, -1.51892], [188.9, -1.51066], [189, -1.5024], [189.1, -1.49412], [189.2, -1.48584], [189.3, -1.47755], [189.4, -1.46925], [189.5, -1.46093], [189.6, -1.45261], [189.7, -1.44427], [189.8, -1.43591], [189.9, -1.42754], [190, -1.41916], [190.1, -1.41075], [190.2, -1.40233], [190.3, -1.39389], [190.4, -1.38543], [190.5, -1.37694], [190.6, -1.36843], [190.7, -1.35989], [190.8, -1.35133], [190.9, -1.34274], [191, -1.33412], [191.1, -1.32547], [191.2, -1.31678], [191.3, -1.30806], [191.4, -1.29931], [191.5, -1.29051], [191.6, -1.28167], [191.7, -1.27279], [191.8, -1.26386], [191.9, -1.25488], [192, -1.24585], [192.1, -1.23677], [192.2, -1.22763], [192.3, -1.21843], [192.4, -1.20916], [192.5, -1.19983], [192.6, -1.19043], [192.7, -1.18096], [192.8, -1.17141], [192.9, -1.16177], [193, -1.15205], [193.1, -1.14223], [193.2, -1.13232], [193.3, -1.1223], [193.4, -1.11217], [193.5, -1.10193], [193.6, -1.09157], [193.7, -1.08107], [193.8, -1.07044], [193.9, -1.05966], [194, -1.04873], [194.1, -1.03764], [194.2, -1.02636], [194.3, -1.01491], [194.4, -1.00325], [194.5, -0.991383], [194.6, -0.97929], [194.7, -0.966956], [194.8, -0.954364], [194.9, -0.941496], [195, -0.928332], [195.1, -0.91485], [195.2, -0.901026], [195.3, -0.886835], [195.4, -0.872249], [195.5, -0.857234], [195.6, -0.841758], [195.7, -0.825782], [195.8, -0.809264], [195.9, -0.792158], [196, -0.77441], [196.1, -0.755965], [196.2, -0.736757], [196.3, -0.716715], [196.4, -0.695759], [196.5, -0.673798], [196.6, -0.650732], [196.7, -0.626447], [196.8, -0.600814], [196.9, -0.573688], [197, -0.544905], [197.1, -0.514279], [197.2, -0.481598], [197.3, -0.446624], [197.4, -0.409084], [197.5, -0.368672], [197.6, -0.325038], [197.7, -0.277792], [197.8, -0.226494], [197.9, -0.170658], [198, -0.109753], [198.1, -0.0432076], [198.2, 0.0295721], [198.3, 0.109175], [198.4, 0.196143], [198.5, 0.290898], [198.6, 0.393653], [198.7, 0.504288], [198.8, 0.622203], [198.9, 0.746177], [199, 0.874268], [199.1, 1.00381], [199.2, 1.13154], [199.3, 1.25396], [199.4, 1.36771], [199.5, 1.47009], [199.6, 1.55932], [199.7, 1.63472], [199.8, 1.69659], [199.9, 1.74593], [200, 1.78421], [200.1, 1.81306], [200.2, 1.83408], [200.3, 1.84875], [200.4, 1.85834], [200.5, 1.86393], [200.6, 1.86638], [200.7, 1.86639], [200.8, 1.8645], [200.9, 1.86116], [201, 1.85669], [201.1, 1.85135], [201.2, 1.84534], [201.3, 1.83882], [201.4, 1.83189], [201.5, 1.82467], [201.6, 1.8172], [201.7, 1.80955], [201.8, 1.80177], [201.9, 1.79387], [202, 1.78589], [202.1, 1.77785], [202.2, 1.76976], [202.3, 1.76163], [202.4, 1.75348], [202.5, 1.7453], [202.6, 1.73711], [202.7, 1.7289], [202.8, 1.72069], [202.9, 1.71248], [203, 1.70426], [203.1, 1.69603], [203.2, 1.68781], [203.3, 1.67959], [203.4, 1.67136], [203.5, 1.66314], [203.6, 1.65492], [203.7, 1.6467], [203.8, 1.63848], [203.9, 1.63026], [204, 1.62204], [204.1, 1.61382], [204.2, 1.60561], [204.3, 1.59739], [204.4, 1.58917], [204.5, 1.58094], [204.6, 1.57272], [204.7, 1.56449], [204.8, 1.55626], [204.9, 1.54803], [205, 1.53979], [205.1, 1.53155], [205.2, 1.5233], [205.3, 1.51505], [205.4, 1.50679], [205.5, 1.49852], [205.6, 1.49024], [205.7, 1.48196], [205.8, 1.47366], [205.9, 1.46535], [206, 1.45703], [206.1, 1.4487], [206.2, 1.44035], [206.3, 1.43199], [206.4, 1.42362], [206.5, 1.41522], [206.6, 1.40681], [206.7, 1.39838], [206.8, 1.38993], [206.9, 1.38145], [207, 1.37296], [207.1, 1.36443], [207.2, 1.35589], [207.3, 1.34731], [207.4, 1.33871], [207.5, 1.33007], [207.6, 1.3214], [207.7, 1.3127], [207.8, 1.30396], [207.9, 1.29519], [208, 1.28637], [208.1, 1.27751], [208.2, 1.26861], [208.3, 1.25966], [208.4, 1.25066], [208.5, 1.2416], [208.6, 1.23249], [208.7, 1.22332], [208.8, 1.2141], [208.9, 1.2048], [209, 1.19544], [209.1, 1.186], [209.2, 1.17649], [209.3, 1.1669], [209.4, 1.15722], [209.5, 1.14746], [209.6, 1.1376], [209.7, 1.12763], [209.8, 1.11757], [209.9, 1.10739], [210, 1.09709], [210.1, 1.08667], [210.2, 1.07611], [210.3, 1.06541], [210.4, 1.05456], [210.5, 1.04355], [210.6, 1.03238], [210.7, 1.02102], [210.8, 1.00947], [210.9, 0.997717], [211, 0.985746], [211.1, 0.973542], [211.2, 0.961089], [211.3, 0.94837], [211.4, 0.935365], [211.5, 0.922055], [211.6, 0.908416], [211.7, 0.894424], [211.8, 0.880051], [211.9, 0.865268], [212, 0.850042], [212.1, 0.834337], [212.2, 0.818112], [212.3, 0.801325], [212.4, 0.783924], [212.5, 0.765858], [212.6, 0.747063], [212.7, 0.727474], [212.8, 0.707014], [212.9, 0.685599], [213, 0.663134], [213.1, 0.639512], [213.2, 0.614612], [213.3, 0.588298], [213.4, 0.560417], [213.5, 0.530795], [213.6, 0.499234], [213.7, 0.465511], [213.8, 0.42937], [213.9, 0.390525], [214, 0.348649], [214.1, 0.303374], [214.2, 0.254287], [214.3, 0.200926], [214.4, 0.142784], [214.5, 0.0793085], [214.6, 0.00991614], [214.7, -0.0659894], [214.8, -0.148981], [214.9, -0.239555], [215, -0.33805], [215.1, -0.444539], [215.2, -0.558694], [215.3, -0.679643], [215.4, -0.805833], [215.5, -0.934976], [215.6, -1.0641], [215.7, -1.18978], [215.8, -1.30853], [215.9, -1.41723], [216, -1.5136], [216.1, -1.59638], [216.2, -1.66535], [216.3, -1.72119], [216.4, -1.76515], [216.5, -1.7988], [216.6, -1.82379], [216.7, -1.84166], [216.8, -1.85381], [216.9, -1.8614], [217, -1.86542], [217.1, -1.86665], [217.2, -1.86571], [217.3, -1.8631], [217.4, -1.85919], [217.5, -1.85428], [217.6, -1.84861], [217.7, -1.84234], [217.8, -1.83562], [217.9, -1.82854], [218, -1.82119], [218.1, -1.81364], [218.2, -1.80592], [218.3, -1.79808], [218.4, -1.79014], [218.5, -1.78213], [218.6, -1.77406], [218.7, -1.76595], [218.8, -1.75781], [218.9, -1.74965], [219, -1.74146], [219.1, -1.73326], [219.2, -1.72506], [219.3, -1.71684], [219.4, -1.70862], [219.5, -1.7004], [219.6, -1.69218], [219.7, -1.68396], [219.8, -1.67573], [219.9, -1.66751], [220, -1.65929], [220.1, -1.65107], [220.2, -1.64285], [220.3, -1.63463], [220.4, -1.62641], [220.5, -1.61819], [220.6, -1.60997], [220.7, -1.60175], [220.8, -1.59353], [220.9, -1.58531], [221, -1.57709], [221.1, -1.56887], [221.2, -1.56064], [221.3, -1.55241], [221.4, -1.54417], [221.5, -1.53593], [221.6, -1.52769], [221.7, -1.51944], [221.8, -1.51118], [221.9, -1.50292], [222, -1.49464], [222.1, -1.48636], [222.2, -1.47807], [222.3, -1.46977], [222.4, -1.46146], [222.5, -1.45313], [222.6, -1.44479], [222.7, -1.43644], [222.8, -1.42807], [222.9, -1.41968], [223, -1.41128], [223.1, -1.40286], [223.2, -1.39442], [223.3, -1.38596], [223.4, -1.37747], [223.5, -1.36897], [223.6, -1.36043], [223.7, -1.35187], [223.8, -1.34328], [223.9, -1.33466], [224, -1.32601], [224.1, -1.31733], [224.2, -1.30861], [224.3, -1.29986], [224.4, -1.29106], [224.5, -1.28223], [224.6, -1.27335], [224.7, -1.26442], [224.8, -1.25545], [224.9, -1.24642], [225, -1.23734], [225.1, -1.2282], [225.2, -1.21901], [225.3, -1.20975], [225.4, -1.20042], [225.5, -1.19103], [225.6, -1.18156], [225.7, -1.17201], [225.8, -1.16238], [225.9, -1.15266], [226, -1.14285], [226.1, -1.13294], [226.2, -1.12293], [226.3, -1.11281], [226.4, -1.10258], [226.5, -1.09222], [226.6, -1.08174], [226.7, -1.07111], [226.8, -1.06035], [226.9, -1.04942], [227, -1.03834], [227.1, -1.02708], [227.2, -1.01563], [227.3, -1.00399], [227.4, -0.992135], [227.5, -0.980057], [227.6, -0.967738], [227.7, -0.955163], [227.8, -0.942313], [227.9, -0.929168], [228, -0.915706], [228.1, -0.901905], [228.2, -0.887738], [228.3, -0.873177], [228.4, -0.858191], [228.5, -0.842745], [228.6, -0.826801], [228.7, -0.810319], [228.8, -0.79325], [228.9, -0.775545], [229, -0.757145], [229.1, -0.737987], [229.2, -0.718], [229.3, -0.697104], [229.4, -0.675209], [229.5, -0.652216], [229.6, -0.628011], [229.7, -0.602466], [229.8, -0.575439], [229.9, -0.546765], [230, -0.51626], [230.1, -0.483716], [230.2, -0.448893], [230.3, -0.411523], [230.4, -0.371301], [230.5, -0.327881], [230.6, -0.280874], [230.7, -0.229844], [230.8, -0.174309], [230.9, -0.113739], [231, -0.0475647], [231.1, 0.0248058], [231.2, 0.103964], [231.3, 0.190454], [231.4, 0.284711], [231.5, 0.386964], [231.6, 0.497116], [231.7, 0.614602], [231.8, 0.738244], [231.9, 0.866148], [232, 0.995687], [232.1, 1.12364], [232.2, 1.24649], [232.3, 1.36088], [232.4, 1.46403], [232.5, 1.55412], [232.6, 1.63039], [232.7, 1.69308], [232.8, 1.74317], [232.9, 1.7821], [233, 1.81149], [233.1, 1.83296], [233.2, 1.84799], [233.3, 1.85787], [233.4, 1.86368], [233.5, 1.8663], [233.6, 1.86645], [233.7, 1.86467], [233.8, 1.86141], [233.9, 1.857], [234, 1.85171], [234.1, 1.84573], [234.2, 1.83924], [234.3, 1.83234], [234.4, 1.82513], [234.5, 1.81768], [234.6, 1.81004], [234.7, 1.80226], [234.8, 1.79437], [234.9, 1.7864], [235, 1.77836], [235.1, 1.77027], [235.2, 1.76214], [235.3, 1.75399], [235.4, 1.74581], [235.5, 1.73762], [235.6, 1.72942], [235.7, 1.72121], [235.8, 1.71299], [235.9, 1.70477], [236, 1.69655], [236.1, 1.68833], [236.2, 1.6801], [236.3, 1.67188], [236.4, 1.66366], [236.5, 1.65544], [236.6, 1.64722], [236.7, 1.639], [236.8, 1.63078], [236.9, 1.62256], [237, 1.61434], [237.1, 1.60612], [237.2, 1.5979], [237.3, 1.58968], [237.4, 1.58146], [237.5, 1.57324], [237.6, 1.56501], [237.7, 1.55678], [237.8, 1.54855], [237.9, 1.54031], [238, 1.53207], [238.1, 1.52382], [238.2, 1.51557], [238.3, 1.50731], [238.4, 1.49904], [238.5, 1.49076], [238.6, 1.48248], [238.7, 1.47418], [238.8, 1.46587], [238.9, 1.45756], [239, 1.44922], [239.1, 1.44088], [239.2, 1.43252], [239.3, 1.42414], [239.4, 1.41575], [239.5, 1.40734], [239.6, 1.39891], [239.7, 1.39046], [239.8, 1.38198], [239.9, 1.37349], [240, 1.36497], [240.1, 1.35642], [240.2, 1.34785], [240.3, 1.33925], [240.4, 1.33062], [240.5, 1.32195], [240.6, 1.31325], [240.7, 1.30451], [240.8, 1.29574], [240.9, 1.28693], [241, 1.27807], [241.1, 1.26917], [241.2, 1.26022], [241.3, 1.25122], [241.4, 1.24217], [241.5, 1.23307], [241.6, 1.2239], [241.7, 1.21468], [241.8, 1.20539], [241.9, 1.19603], [242, 1.1866], [242.1, 1.17709], [242.2, 1.16751], [242.3, 1.15783], [242.4, 1.14807], [242.5, 1.13822], [242.6, 1.12826], [242.7, 1.1182], [242.8, 1.10803], [242.9, 1.09774], [243, 1.08732], [243.1, 1.07678], [243.2, 1.06609], [243.3, 1.05525], [243.4, 1.04425], [243.5, 1.03308], [243.6, 1.02174], [243.7, 1.0102], [243.8, 0.998461], [243.9, 0.986504], [244, 0.974315], [244.1, 0.961879], [244.2, 0.949177], [244.3, 0.936191], [244.4, 0.922901], [244.5, 0.909283], [244.6, 0.895314], [244.7, 0.880966], [244.8, 0.86621], [244.9, 0.851012], [245, 0.835338], [245.1, 0.819148], [245.2, 0.802397], [245.3, 0.785036], [245.4, 0.767013], [245.5, 0.748266], [245.6, 0.728729], [245.7, 0.708326], [245.8, 0.686974], [245.9, 0.664578], [246, 0.641032], [246.1, 0.616216], [246.2, 0.589995], [246.3, 0.562218], [246.4, 0.532711], [246.5, 0.501278], [246.6, 0.467697], [246.7, 0.431717], [246.8, 0.393051], [246.9, 0.351375], [247, 0.306326], [247.1, 0.257491], [247.2, 0.204413], [247.3, 0.146587], [247.4, 0.0834635], [247.5, 0.0144603], [247.6, -0.0610187], [247.7, -0.14355], [247.8, -0.233636], [247.9, -0.331627], [248, -0.437618], [248.1, -0.551312], [248.2, -0.671871], [248.3, -0.797792], [248.4, -0.926831], [248.5, -1.05605], [248.6, -1.18206], [248.7, -1.30133], [248.8, -1.41075], [248.9, -1.50794], [249, -1.59159], [249.1, -1.66141], [249.2, -1.71804], [249.3, -1.76271], [249.4, -1.79696], [249.5, -1.82244], [249.6, -1.84072], [249.7, -1.85319], [249.8, -1.86104], [249.9, -1.86526], [250, -1.86664], [250.1, -1.86582], [250.2, -1.8633], [250.3, -1.85946], [250.4, -1.85461], [250.5, -1.84898], [250.6, -1.84275], [250.7, -1.83605], [250.8, -1.82899], [250.9, -1.82166], [251, -1.81412], [251.1, -1.80641], [251.2, -1.79857], [251.3, -1.79064], [251.4, -1.78264], [251.5, -1.77457], [251.6, -1.76646], [251.7, -1.75832], [251.8, -1.75016], [251.9, -1.74198], [252, -1.73378], [252.1, -1.72557], [252.2, -1.71736], [252.3, -1.70914], [252.4, -1.70092], [252.5, -1.6927], [252.6, -1.68447], [252.7, -1.67625], [252.8, -1.66803], [252.9, -1.65981], [253, -1.65159], [253.1, -1.64337], [253.2, -1.63515], [253.3, -1.62693], [253.4, -1.61871], [253.5, -1.61049], [253.6, -1.60227], [253.7, -1.59405], [253.8, -1.58583], [253.9, -1.57761], [254, -1.56938], [254.1, -1.56116], [254.2, -1.55292], [254.3, -1.54469], [254.4, -1.53645], [254.5, -1.52821], [254.6, -1.51996], [254.7, -1.5117], [254.8, -1.50343], [254.9, -1.49516], [255, -1.48688], [255.1, -1.47859], [255.2, -1.47029], [255.3, -1.46198], [255.4, -1.45365], [255.5, -1.44531], [255.6, -1.43696], [255.7, -1.4286], [255.8, -1.42021], [255.9, -1.41181], [256, -1.40339], [256.1, -1.39495], [256.2, -1.38649], [256.3, -1.37801], [256.4, -1.3695], [256.5, -1.36097], [256.6, -1.35241], [256.7, -1.34382], [256.8, -1.33521], [256.9, -1.32656], [257, -1.31788], [257.1, -1.30916], [257.2, -1.30041], [257.3, -1.29162], [257.4, -1.28278], [257.5, -1.2739], [257.6, -1.26498], [257.7, -1.25601], [257.8, -1.24699], [257.9, -1.23791], [258, -1.22878], [258.1, -1.21959], [258.2, -1.21033], [258.3, -1.20101], [258.4, -1.19162], [258.5, -1.18215], [258.6, -1.17261], [258.7, -1.16298], [258.8, -1.15327], [258.9, -1.14347], [259, -1.13357], [259.1, -1.12356], [259.2, -1.11345], [259.3, -1.10322], [259.4, -1.09287], [259.5, -1.0824], [259.6, -1.07178], [259.7, -1.06103], [259.8, -1.05011], [259.9, -1.03904], [260, -1.02779], [260.1, -1.01636], [260.2, -1.00473], [260.3, -0.992886], [260.4, -0.980822], [260.5, -0.96852], [260.6, -0.955961], [260.7, -0.943128], [260.8, -0.930002], [260.9, -0.916562], [261, -0.902783], [261.1, -0.888639], [261.2, -0.874104], [261.3, -0.859145], [261.4, -0.843729], [261.5, -0.827818], [261.6, -0.811371], [261.7, -0.794341], [261.8, -0.776677], [261.9, -0.758322], [262, -0.739214], [262.1, -0.719281], [262.2, -0.698445], [262.3, -0.676615], [262.4, -0.653694], [262.5, -0.629569], [262.6, -0.604113], [262.7, -0.577183], [262.8, -0.548618], [262.9, -0.518234], [263, -0.485824], [263.1, -0.451152], [263.2, -0.413951], [263.3, -0.373918], [263.4, -0.330709], [263.5, -0.28394], [263.6, -0.233177], [263.7, -0.17794], [263.8, -0.117702], [263.9, -0.0518974], [264, 0.0200663], [264.1, 0.0987811], [264.2, 0.184797], [264.3, 0.278556], [264.4, 0.380305], [264.5, 0.489972], [264.6, 0.607025], [264.7, 0.730329], [264.8, 0.858035], [264.9, 0.987561], [265, 1.11571], [265.1, 1.23899], [265.2, 1.354], [265.3, 1.45792], [265.4, 1.54886], [265.5, 1.62601], [265.6, 1.68953], [265.7, 1.74037], [265.8, 1.77995], [265.9, 1.80989], [266, 1.83181], [266.1, 1.84721], [266.2, 1.85738], [266.3, 1.86341], [266.4, 1.86622], [266.5, 1.8665], [266.6, 1.86483], [266.7, 1.86165], [266.8, 1.8573], [266.9, 1.85206], [267, 1.84613], [267.1, 1.83966], [267.2, 1.83278], [267.3, 1.82559], [267.4, 1.81815], [267.5, 1.81052], [267.6, 1.80275], [267.7, 1.79487], [267.8, 1.7869], [267.9, 1.77886], [268, 1.77078], [268.1, 1.76265], [268.2, 1.7545], [268.3, 1.74633], [268.4, 1.73814], [268.5, 1.72993], [268.6, 1.72172], [268.7, 1.71351], [268.8, 1.70529], [268.9, 1.69707], [269, 1.68884], [269.1, 1.68062], [269.2, 1.6724], [269.3, 1.66418], [269.4, 1.65595], [269.5, 1.64773], [269.6, 1.63951], [269.7, 1.63129], [269.8, 1.62308], [269.9, 1.61486], [270, 1.60664], [270.1, 1.59842], [270.2, 1.5902], [270.3, 1.58198], [270.4, 1.57375], [270.5, 1.56553], [270.6, 1.5573], [270.7, 1.54907], [270.8, 1.54083], [270.9, 1.53259], [271, 1.52434], [271.1, 1.51609], [271.2, 1.50783], [271.3, 1.49956], [271.4, 1.49128], [271.5, 1.483], [271.6, 1.4747], [271.7, 1.4664], [271.8, 1.45808], [271.9, 1.44975], [272, 1.4414], [272.1, 1.43304], [272.2, 1.42467], [272.3, 1.41628], [272.4, 1.40787], [272.5, 1.39944], [272.6, 1.39099], [272.7, 1.38252], [272.8, 1.37402], [272.9, 1.36551], [273, 1.35696], [273.1, 1.34839], [273.2, 1.33979], [273.3, 1.33116], [273.4, 1.3225], [273.5, 1.3138], [273.6, 1.30506], [273.7, 1.29629], [273.8, 1.28748], [273.9, 1.27863], [274, 1.26973], [274.1, 1.26078], [274.2, 1.25179], [274.3, 1.24274], [274.4, 1.23364], [274.5, 1.22448], [274.6, 1.21526], [274.7, 1.20597], [274.8, 1.19662], [274.9, 1.18719], [275, 1.17769], [275.1, 1.16811], [275.2, 1.15844], [275.3, 1.14869], [275.4, 1.13884], [275.5, 1.12889], [275.6, 1.11884], [275.7, 1.10867], [275.8, 1.09839], [275.9, 1.08798], [276, 1.07744], [276.1, 1.06676], [276.2, 1.05593], [276.3, 1.04495], [276.4, 1.03379], [276.5, 1.02246], [276.6, 1.01093], [276.7, 0.999205], [276.8, 0.987262], [276.9, 0.975088], [277, 0.962667], [277.1, 0.949983], [277.2, 0.937015], [277.3, 0.923745], [277.4, 0.910148], [277.5, 0.896202], [277.6, 0.881879], [277.7, 0.867149], [277.8, 0.851981], [277.9, 0.836338], [278, 0.820181], [278.1, 0.803466], [278.2, 0.786146], [278.3, 0.768166], [278.4, 0.749466], [278.5, 0.729981], [278.6, 0.709635], [278.7, 0.688345], [278.8, 0.666017], [278.9, 0.642547], [279, 0.617814], [279.1, 0.591687], [279.2, 0.564012], [279.3, 0.534619], [279.4, 0.503313], [279.5, 0.469874], [279.6, 0.434053], [279.7, 0.395564], [279.8, 0.354088], [279.9, 0.309262], [280, 0.260678], [280.1, 0.207881], [280.2, 0.150369], [280.3, 0.0875953], [280.4, 0.018979], [280.5, -0.0560759], [280.6, -0.138148], [280.7, -0.227747], [280.8, -0.325236], [280.9, -0.430729], [281, -0.543956], [281.1, -0.664122], [281.2, -0.789764], [281.3, -0.918686], [281.4, -1.04799], [281.5, -1.1743], [281.6, -1.2941], [281.7, -1.40422], [281.8, -1.50223], [281.9, -1.58674], [282, -1.65743], [282.1, -1.71485], [282.2, -1.76023], [282.3, -1.79508], [282.4, -1.82107], [282.5, -1.83976], [282.6, -1.85255], [282.7, -1.86066], [282.8, -1.86508], [282.9, -1.86662], [283, -1.86593], [283.1, -1.8635], [283.2, -1.85974], [283.3, -1.85494], [283.4, -1.84936], [283.5, -1.84315], [283.6, -1.83648], [283.7, -1.82945], [283.8, -1.82213], [283.9, -1.8146], [284, -1.8069], [284.1, -1.79907], [284.2, -1.79114], [284.3, -1.78314], [284.4, -1.77508], [284.5, -1.76697], [284.6, -1.75884], [284.7, -1.75067], [284.8, -1.74249], [284.9, -1.73429], [285, -1.72609], [285.1, -1.71787], [285.2, -1.70966], [285.3, -1.70144], [285.4, -1.69321], [285.5, -1.68499], [285.6, -1.67677], [285.7, -1.66854], [285.8, -1.66032], [285.9, -1.6521], [286, -1.64388], [286.1, -1.63566], [286.2, -1.62744], [286.3, -1.61922], [286.4, -1.61101], [286.5, -1.60279], [286.6, -1.59457], [286.7, -1.58635], [286.8, -1.57812], [286.9, -1.5699], [287, -1.56167], [287.1, -1.55344], [287.2, -1.54521], [287.3, -1.53697], [287.4, -1.52872], [287.5, -1.52047], [287.6, -1.51222], [287.7, -1.50395], [287.8, -1.49568], [287.9, -1.4874], [288, -1.47911], [288.1, -1.47081], [288.2, -1.4625], [288.3, -1.45418], [288.4, -1.44584], [288.5, -1.43749], [288.6, -1.42912], [288.7, -1.42074], [288.8, -1.41234], [288.9, -1.40392], [289, -1.39548], [289.1, -1.38702], [289.2, -1.37854], [289.3, -1.37004], [289.4, -1.36151], [289.5, -1.35295], [289.6, -1.34436], [289.7, -1.33575], [289.8, -1.3271], [289.9, -1.31842], [290, -1.30971], [290.1, -1.30096], [290.2, -1.29217], [290.3, -1.28334], [290.4, -1.27446], [290.5, -1.26554], [290.6, -1.25658], [290.7, -1.24756], [290.8, -1.23848], [290.9, -1.22936], [291, -1.22017], [291.1, -1.21092], [291.2, -1.2016], [291.3, -1.19221], [291.4, -1.18275], [291.5, -1.17321], [291.6, -1.16359], [291.7, -1.15388], [291.8, -1.14409], [291.9, -1.13419], [292, -1.12419], [292.1, -1.11409], [292.2, -1.10387], [292.3, -1.09353], [292.4, -1.08306], [292.5, -1.07246], [292.6, -1.06171], [292.7, -1.0508], [292.8, -1.03974], [292.9, -1.0285], [293, -1.01708], [293.1, -1.00546], [293.2, -0.993636], [293.3, -0.981587], [293.4, -0.9693], [293.5, -0.956758], [293.6, -0.943943], [293.7, -0.930836], [293.8, -0.917416], [293.9, -0.903658], [294, -0.889539], [294.1, -0.875029], [294.2, -0.860098], [294.3, -0.844712], [294.4, -0.828833], [294.5, -0.812421], [294.6, -0.795429], [294.7, -0.777806], [294.8, -0.759497], [294.9, -0.740438], [295, -0.720559], [295.1, -0.699782], [295.2, -0.678018], [295.3, -0.655168], [295.4, -0.631122], [295.5, -0.605754], [295.6, -0.578921], [295.7, -0.550464], [295.8, -0.5202], [295.9, -0.487924], [296, -0.453402], [296.1, -0.416368], [296.2, -0.376522], [296.3, -0.333524], [296.4, -0.28699], [296.5, -0.236492], [296.6, -0.181551], [296.7, -0.121643], [296.8, -0.0562058], [296.9, 0.0153534], [297, 0.0936273], [297.1, 0.17917], [297.2, 0.272433], [297.3, 0.373679], [297.4, 0.482858], [297.5, 0.599473], [297.6, 0.722431], [297.7, 0.84993], [297.8, 0.97943], [297.9, 1.10777], [298, 1.23146], [298.1, 1.34708], [298.2, 1.45176], [298.3, 1.54355], [298.4, 1.62157], [298.5, 1.68592], [298.6, 1.73753], [298.7, 1.77777], [298.8, 1.80827], [298.9, 1.83064], [299, 1.84641], [299.1, 1.85687], [299.2, 1.86314], [299.3, 1.86612], [299.4, 1.86654], [299.5, 1.86498], [299.6, 1.86188], [299.7, 1.8576], [299.8, 1.85241], [299.9, 1.84652], [300, 1.84008], [300.1, 1.83322], [300.2, 1.82605], [300.3, 1.81862], [300.4, 1.81101], [300.5, 1.80324], [300.6, 1.79537], [300.7, 1.7874], [300.8, 1.77937], [300.9, 1.77129], [301, 1.76317], [301.1, 1.75501], [301.2, 1.74684], [301.3, 1.73865], [301.4, 1.73045], [301.5, 1.72224], [301.6, 1.71402], [301.7, 1.7058], [301.8, 1.69758], [301.9, 1.68936], [302, 1.68114], [302.1, 1.67291], [302.2, 1.66469], [302.3, 1.65647], [302.4, 1.64825], [302.5, 1.64003], [302.6, 1.63181], [302.7, 1.62359], [302.8, 1.61537], [302.9, 1.60715], [303, 1.59894], [303.1, 1.59072], [303.2, 1.58249], [303.3, 1.57427], [303.4, 1.56604], [303.5, 1.55782], [303.6, 1.54958], [303.7, 1.54135], [303.8, 1.53311], [303.9, 1.52486], [304, 1.51661], [304.1, 1.50835], [304.2, 1.50008], [304.3, 1.4918], [304.4, 1.48352], [304.5, 1.47522], [304.6, 1.46692], [304.7, 1.4586], [304.8, 1.45027], [304.9, 1.44193], [305, 1.43357], [305.1, 1.4252], [305.2, 1.4168], [305.3, 1.4084], [305.4, 1.39997], [305.5, 1.39152], [305.6, 1.38305], [305.7, 1.37456], [305.8, 1.36604], [305.9, 1.3575], [306, 1.34893], [306.1, 1.34033], [306.2, 1.3317], [306.3, 1.32304], [306.4, 1.31435], [306.5, 1.30561], [306.6, 1.29685], [306.7, 1.28804], [306.8, 1.27919], [306.9, 1.27029], [307, 1.26135], [307.1, 1.25236], [307.2, 1.24331], [307.3, 1.23421], [307.4, 1.22506], [307.5, 1.21584], [307.6, 1.20656], [307.7, 1.19721], [307.8, 1.18779], [307.9, 1.17829], [308, 1.16871], [308.1, 1.15905], [308.2, 1.1493], [308.3, 1.13946], [308.4, 1.12952], [308.5, 1.11947], [308.6, 1.10931], [308.7, 1.09904], [308.8, 1.08864], [308.9, 1.07811], [309, 1.06744], [309.1, 1.05662], [309.2, 1.04564], [309.3, 1.0345], [309.4, 1.02317], [309.5, 1.01166], [309.6, 0.999948], [309.7, 0.988019], [309.8, 0.97586], [309.9, 0.963455], [310, 0.950788], [310.1, 0.937839], [310.2, 0.924588], [310.3, 0.911013], [310.4, 0.897089], [310.5, 0.88279], [310.6, 0.868087], [310.7, 0.852947], [310.8, 0.837335], [310.9, 0.821211], [311, 0.804533], [311.1, 0.787253], [311.2, 0.769316], [311.3, 0.750663], [311.4, 0.731229], [311.5, 0.71094], [311.6, 0.689712], [311.7, 0.667452], [311.8, 0.644057], [311.9, 0.619407], [312, 0.593372], [312.1, 0.565799], [312.2, 0.536519], [312.3, 0.50534], [312.4, 0.472042], [312.5, 0.436378], [312.6, 0.398066], [312.7, 0.356788], [312.8, 0.312184], [312.9, 0.263849], [313, 0.211331], [313.1, 0.15413], [313.2, 0.091704], [313.3, 0.0234723], [313.4, -0.0511608], [313.5, -0.132776], [313.6, -0.22189], [313.7, -0.318876], [313.8, -0.42387], [313.9, -0.536629], [314, -0.656394], [314.1, -0.781749], [314.2, -0.910544], [314.3, -1.03992], [314.4, -1.16653], [314.5, -1.28683], [314.6, -1.39764], [314.7, -1.49646], [314.8, -1.58184], [314.9, -1.65339], [315, -1.71162], [315.1, -1.7577], [315.2, -1.79317], [315.3, -1.81967], [315.4, -1.83877], [315.5, -1.8519], [315.6, -1.86027], [315.7, -1.8649], [315.8, -1.8666], [315.9, -1.86603], [316, -1.8637], [316.1, -1.86001], [316.2, -1.85527], [316.3, -1.84973], [316.4, -1.84356], [316.5, -1.83691], [316.6, -1.8299], [316.7, -1.8226], [316.8, -1.81507], [316.9, -1.80738], [317, -1.79956], [317.1, -1.79164], [317.2, -1.78364], [317.3, -1.77559], [317.4, -1.76749], [317.5, -1.75935], [317.6, -1.75119], [317.7, -1.743], [317.8, -1.73481], [317.9, -1.7266], [318, -1.71839], [318.1, -1.71017], [318.2, -1.70195], [318.3, -1.69373], [318.4, -1.68551], [318.5, -1.67728], [318.6, -1.66906], [318.7, -1.66084], [318.8, -1.65262], [318.9, -1.6444], [319, -1.63618], [319.1, -1.62796], [319.2, -1.61974], [319.3, -1.61152], [319.4, -1.6033], [319.5, -1.59508], [319.6, -1.58686], [319.7, -1.57864], [319.8, -1.57042], [319.9, -1.56219], [320, -1.55396], [320.1, -1.54572], [320.2, -1.53749], [320.3, -1.52924], [320.4, -1.52099], [320.5, -1.51274], [320.6, -1.50447], [320.7, -1.4962], [320.8, -1.48792], [320.9, -1.47963], [321, -1.47133], [321.1, -1.46302], [321.2, -1.4547], [321.3, -1.44636], [321.4, -1.43801], [321.5, -1.42965], [321.6, -1.42127], [321.7, -1.41287], [321.8, -1.40445], [321.9, -1.39601], [322, -1.38755], [322.1, -1.37907], [322.2, -1.37057], [322.3, -1.36204], [322.4, -1.35349], [322.5, -1.3449], [322.6, -1.33629], [322.7, -1.32765], [322.8, -1.31897], [322.9, -1.31026], [323, -1.30151], [323.1, -1.29272], [323.2, -1.28389], [323.3, -1.27502], [323.4, -1.26611], [323.5, -1.25714], [323.6, -1.24812], [323.7, -1.23906], [323.8, -1.22993], [323.9, -1.22075], [324, -1.2115], [324.1, -1.20219], [324.2, -1.1928], [324.3, -1.18335], [324.4, -1.17381], [324.5, -1.1642], [324.6, -1.1545], [324.7, -1.1447], [324.8, -1.13482], [324.9, -1.12482], [325, -1.11473], [325.1, -1.10451], [325.2, -1.09418], [325.3, -1.08372], [325.4, -1.07313], [325.5, -1.06239], [325.6, -1.05149], [325.7, -1.04044], [325.8, -1.02921], [325.9, -1.0178], [326, -1.0062], [326.1, -0.994386], [326.2, -0.982351], [326.3, -0.970079], [326.4, -0.957553], [326.5, -0.944756], [326.6, -0.931668], [326.7, -0.918268], [326.8, -0.904533], [326.9, -0.890437], [327, -0.875952], [327.1, -0.861049], [327.2, -0.845692], [327.3, -0.829846], [327.4, -0.813468], [327.5, -0.796514], [327.6, -0.778933], [327.7, -0.760668], [327.8, -0.741658], [327.9, -0.721833], [328, -0.701115], [328.1, -0.679416], [328.2, -0.656637], [328.3, -0.63267], [328.4, -0.607389], [328.5, -0.580652], [328.6, -0.552302], [328.7, -0.522158], [328.8, -0.490015], [328.9, -0.455641], [329, -0.418774], [329.1, -0.379114], [329.2, -0.336325], [329.3, -0.290025], [329.4, -0.239789], [329.5, -0.185142], [329.6, -0.125563], [329.7, -0.06049], [329.8, 0.0106671], [329.9, 0.0885022], [330, 0.173573], [330.1, 0.266342], [330.2, 0.367083], [330.3, 0.475773], [330.4, 0.591947], [330.5, 0.714552], [330.6, 0.841832], [330.7, 0.971294], [330.8, 1.09981], [330.9, 1.22389], [331, 1.34011], [331.1, 1.44555], [331.2, 1.53819], [331.3, 1.61708], [331.4, 1.68227], [331.5, 1.73464], [331.6, 1.77554], [331.7, 1.80661], [331.8, 1.82945], [331.9, 1.84559], [332, 1.85635], [332.1, 1.86285], [332.2, 1.86602], [332.3, 1.86658], [332.4, 1.86513], [332.5, 1.86212], [332.6, 1.8579], [332.7, 1.85276], [332.8, 1.8469], [332.9, 1.8405], [333, 1.83367], [333.1, 1.82651], [333.2, 1.8191], [333.3, 1.81149], [333.4, 1.80373], [333.5, 1.79586], [333.6, 1.7879], [333.7, 1.77988], [333.8, 1.7718], [333.9, 1.76368], [334, 1.75553], [334.1, 1.74735], [334.2, 1.73917], [334.3, 1.73097], [334.4, 1.72276], [334.5, 1.71454], [334.6, 1.70632], [334.7, 1.6981], [334.8, 1.68988], [334.9, 1.68165], [335, 1.67343], [335.1, 1.66521], [335.2, 1.65699], [335.3, 1.64877], [335.4, 1.64055], [335.5, 1.63233], [335.6, 1.62411], [335.7, 1.61589], [335.8, 1.60767], [335.9, 1.59945], [336, 1.59123], [336.1, 1.58301], [336.2, 1.57479], [336.3, 1.56656], [336.4, 1.55833], [336.5, 1.5501], [336.6, 1.54186], [336.7, 1.53362], [336.8, 1.52538], [336.9, 1.51712], [337, 1.50887], [337.1, 1.5006], [337.2, 1.49232], [337.3, 1.48404], [337.4, 1.47575], [337.5, 1.46744], [337.6, 1.45912], [337.7, 1.45079], [337.8, 1.44245], [337.9, 1.43409], [338, 1.42572], [338.1, 1.41733], [338.2, 1.40892], [338.3, 1.4005], [338.4, 1.39205], [338.5, 1.38358], [338.6, 1.37509], [338.7, 1.36658], [338.8, 1.35804], [338.9, 1.34947], [339, 1.34087], [339.1, 1.33224], [339.2, 1.32359], [339.3, 1.31489], [339.4, 1.30616], [339.5, 1.2974], [339.6, 1.28859], [339.7, 1.27974], [339.8, 1.27085], [339.9, 1.26191], [340, 1.25292], [340.1, 1.24388], [340.2, 1.23479], [340.3, 1.22563], [340.4, 1.21642], [340.5, 1.20714], [340.6, 1.1978], [340.7, 1.18838], [340.8, 1.17889], [340.9, 1.16932], [341, 1.15966], [341.1, 1.14992], [341.2, 1.14008], [341.3, 1.13015], [341.4, 1.12011], [341.5, 1.10996], [341.6, 1.09969], [341.7, 1.0893], [341.8, 1.07877], [341.9, 1.06811], [342, 1.0573], [342.1, 1.04633], [342.2, 1.0352], [342.3, 1.02389], [342.4, 1.01239], [342.5, 1.00069], [342.6, 0.988775], [342.7, 0.976631], [342.8, 0.964242], [342.9, 0.951591], [343, 0.938661], [343.1, 0.925429], [343.2, 0.911875], [343.3, 0.897974], [343.4, 0.8837], [343.5, 0.869023], [343.6, 0.853911], [343.7, 0.83833], [343.8, 0.82224], [343.9, 0.805598], [344, 0.788357], [344.1, 0.770463], [344.2, 0.751857], [344.3, 0.732474], [344.4, 0.712241], [344.5, 0.691074], [344.6, 0.668883], [344.7, 0.645562], [344.8, 0.620995], [344.9, 0.59505], [345, 0.567579], [345.1, 0.538412], [345.2, 0.507358], [345.3, 0.474201], [345.4, 0.438693], [345.5, 0.400557], [345.6, 0.359475], [345.7, 0.315091], [345.8, 0.267003], [345.9, 0.214762], [346, 0.157871], [346.1, 0.0957899], [346.2, 0.0279402], [346.3, -0.0462733], [346.4, -0.127434], [346.5, -0.216063], [346.6, -0.312549], [346.7, -0.417041], [346.8, -0.529329], [346.9, -0.648688], [347, -0.773748], [347.1, -0.902404], [347.2, -1.03184], [347.3, -1.15872], [347.4, -1.27953], [347.5, -1.39101], [347.6, -1.49064], [347.7, -1.57689], [347.8, -1.64929], [347.9, -1.70833], [348, -1.75514], [348.1, -1.79123], [348.2, -1.81824], [348.3, -1.83776], [348.4, -1.85122], [348.5, -1.85986], [348.6, -1.8647], [348.7, -1.86656], [348.8, -1.86612], [348.9, -1.86389], [349, -1.86027], [349.1, -1.85559], [349.2, -1.85009], [349.3, -1.84396], [349.4, -1.83734], [349.5, -1.83035], [349.6, -1.82306], [349.7, -1.81555], [349.8, -1.80787], [349.9, -1.80006], [350, -1.79214], [350.1, -1.78415], [350.2, -1.7761], [350.3, -1.768], [350.4, -1.75986], [350.5, -1.7517], [350.6, -1.74352], [350.7, -1.73532], [350.8, -1.72712], [350.9, -1.71891], [351, -1.71069], [351.1, -1.70247], [351.2, -1.69425], [351.3, -1.68602], [351.4, -1.6778], [351.5, -1.66958], [351.6, -1.66136], [351.7, -1.65313], [351.8, -1.64491], [351.9, -1.63669], [352, -1.62848], [352.1, -1.62026], [352.2, -1.61204], [352.3, -1.60382], [352.4, -1.5956], [352.5, -1.58738], [352.6, -1.57916], [352.7, -1.57093], [352.8, -1.56271], [352.9, -1.55448], [353, -1.54624], [353.1, -1.538], [353.2, -1.52976], [353.3, -1.52151], [353.4, -1.51326], [353.5, -1.50499], [353.6, -1.49672], [353.7, -1.48844], [353.8, -1.48015], [353.9, -1.47186], [354, -1.46355], [354.1, -1.45522], [354.2, -1.44689], [354.3, -1.43854], [354.4, -1.43017], [354.5, -1.42179], [354.6, -1.41339], [354.7, -1.40498], [354.8, -1.39654], [354.9, -1.38809], [355, -1.37961], [355.1, -1.37111], [355.2, -1.36258], [355.3, -1.35402], [355.4, -1.34544], [355.5, -1.33683], [355.6, -1.32819], [355.7, -1.31952], [355.8, -1.31081], [355.9, -1.30206], [356, -1.29328], [356.1, -1.28445], [356.2, -1.27558], [356.3, -1.26667], [356.4, -1.2577], [356.5, -1.24869], [356.6, -1.23963], [356.7, -1.23051], [356.8, -1.22132], [356.9, -1.21208], [357, -1.20277], [357.1, -1.19339], [357.2, -1.18394], [357.3, -1.17441], [357.4, -1.1648], [357.5, -1.15511], [357.6, -1.14532], [357.7, -1.13544], [357.8, -1.12546], [357.9, -1.11536], [358, -1.10516], [358.1, -1.09483], [358.2, -1.08438], [358.3, -1.0738], [358.4, -1.06306], [358.5, -1.05218], [358.6, -1.04114], [358.7, -1.02992], [358.8, -1.01853], [358.9, -1.00693], [359, -0.995134], [359.1, -0.983114], [359.2, -0.970857], [359.3, -0.958348], [359.4, -0.945568], [359.5, -0.932499], [359.6, -0.91912], [359.7, -0.905406], [359.8, -0.891334], [359.9, -0.876874], [360, -0.861998], [360.1, -0.846671], [360.2, -0.830856], [360.3, -0.814513], [360.4, -0.797597], [360.5, -0.780056], [360.6, -0.761837], [360.7, -0.742876], [360.8, -0.723104], [360.9, -0.702444], [361, -0.680809], [361.1, -0.658102], [361.2, -0.634213], [361.3, -0.609018], [361.4, -0.582377], [361.5, -0.554134], [361.6, -0.524108], [361.7, -0.492097], [361.8, -0.457871], [361.9, -0.421168], [362, -0.381693], [362.1, -0.339111], [362.2, -0.293045], [362.3, -0.243069], [362.4, -0.188714], [362.5, -0.129461], [362.6, -0.0647503], [362.7, 0.0060071], [362.8, 0.0834057], [362.9, 0.168007], [363, 0.260282], [363.1, 0.360519], [363.2, 0.468719], [363.3, 0.584446], [363.4, 0.706691], [363.5, 0.833744], [363.6, 0.963155], [363.7, 1.09183], [363.8, 1.2163], [363.9, 1.3331], [364, 1.43929], [364.1, 1.53277], [364.2, 1.61253], [364.3, 1.67856], [364.4, 1.7317], [364.5, 1.77328], [364.6, 1.80491], [364.7, 1.82823], [364.8, 1.84474], [364.9, 1.85581], [365, 1.86255], [365.1, 1.8659], [365.2, 1.86661], [365.3, 1.86527], [365.4, 1.86234], [365.5, 1.8582], [365.6, 1.85311], [365.7, 1.84729], [365.8, 1.84091], [365.9, 1.8341], [366, 1.82696], [366.1, 1.81957], [366.2, 1.81197], [366.3, 1.80423], [366.4, 1.79636], [366.5, 1.78841], [366.6, 1.78038], [366.7, 1.7723], [366.8, 1.76419], [366.9, 1.75604], [367, 1.74787], [367.1, 1.73968], [367.2, 1.73148], [367.3, 1.72327], [367.4, 1.71506], [367.5, 1.70684], [367.6, 1.69862], [367.7, 1.69039], [367.8, 1.68217], [367.9, 1.67395], [368, 1.66572], [368.1, 1.6575], [368.2, 1.64928], [368.3, 1.64106], [368.4, 1.63284], [368.5, 1.62462], [368.6, 1.61641], [368.7, 1.60819], [368.8, 1.59997], [368.9, 1.59175], [369, 1.58353], [369.1, 1.5753], [369.2, 1.56708], [369.3, 1.55885], [369.4, 1.55062], [369.5, 1.54238], [369.6, 1.53414], [369.7, 1.5259], [369.8, 1.51764], [369.9, 1.50938], [370, 1.50112], [370.1, 1.49284], [370.2, 1.48456], [370.3, 1.47627], [370.4, 1.46796], [370.5, 1.45965], [370.6, 1.45132], [370.7, 1.44298], [370.8, 1.43462], [370.9, 1.42625], [371, 1.41786], [371.1, 1.40945], [371.2, 1.40103], [371.3, 1.39258], [371.4, 1.38412], [371.5, 1.37563], [371.6, 1.36711], [371.7, 1.35857], [371.8, 1.35001], [371.9, 1.34141], [372, 1.33279], [372.1, 1.32413], [372.2, 1.31544], [372.3, 1.30671], [372.4, 1.29795], [372.5, 1.28915], [372.6, 1.2803], [372.7, 1.27141], [372.8, 1.26247], [372.9, 1.25349], [373, 1.24445], [373.1, 1.23536], [373.2, 1.22621], [373.3, 1.217], [373.4, 1.20773], [373.5, 1.19839], [373.6, 1.18897], [373.7, 1.17949], [373.8, 1.16992], [373.9, 1.16027], [374, 1.15053], [374.1, 1.1407], [374.2, 1.13077], [374.3, 1.12074], [374.4, 1.1106], [374.5, 1.10034], [374.6, 1.08995], [374.7, 1.07944], [374.8, 1.06879], [374.9, 1.05798], [375, 1.04703], [375.1, 1.03591], [375.2, 1.02461], [375.3, 1.01312], [375.4, 1.00143], [375.5, 0.98953], [375.6, 0.977401], [375.7, 0.965028], [375.8, 0.952394], [375.9, 0.939482], [376, 0.92627], [376.1, 0.912737], [376.2, 0.898858], [376.3, 0.884608], [376.4, 0.869957], [376.5, 0.854874], [376.6, 0.839323], [376.7, 0.823266], [376.8, 0.806661], [376.9, 0.789458], [377, 0.771607], [377.1, 0.753048], [377.2, 0.733716], [377.3, 0.713538], [377.4, 0.692433], [377.5, 0.670309], [377.6, 0.647062], [377.7, 0.622577], [377.8, 0.596723], [377.9, 0.569353], [378, 0.540298], [378.1, 0.509368], [378.2, 0.47635], [378.3, 0.440998], [378.4, 0.403035], [378.5, 0.362149], [378.6, 0.317983], [378.7, 0.270141], [378.8, 0.218175], [378.9, 0.161592], [379, 0.099853], [379.1, 0.0323831], [379.2, -0.0414131], [379.3, -0.122121], [379.4, -0.210268], [379.5, -0.306253], [379.6, -0.410244], [379.7, -0.522057], [379.8, -0.641005], [379.9, -0.765761], [380, -0.894267], [380.1, -1.02375], [380.2, -1.1509], [380.3, -1.27218], [380.4, -1.38433], [380.5, -1.48476], [380.6, -1.57188], [380.7, -1.64515], [380.8, -1.705], [380.9, -1.75253], [381, -1.78924], [381.1, -1.81678], [381.2, -1.83673], [381.3, -1.85053], [381.4, -1.85944], [381.5, -1.86449], [381.6, -1.86652], [381.7, -1.86621], [381.8, -1.86407], [381.9, -1.86053], [382, -1.85591], [382.1, -1.85046], [382.2, -1.84436], [382.3, -1.83777], [382.4, -1.8308], [382.5, -1.82353], [382.6, -1.81603], [382.7, -1.80836], [382.8, -1.80055], [382.9, -1.79264], [383, -1.78465], [383.1, -1.7766], [383.2, -1.76851], [383.3, -1.76037], [383.4, -1.75221], [383.5, -1.74403], [383.6, -1.73584], [383.7, -1.72763], [383.8, -1.71942], [383.9, -1.71121], [384, -1.70299], [384.1, -1.69476], [384.2, -1.68654], [384.3, -1.67832], [384.4, -1.67009], [384.5, -1.66187], [384.6, -1.65365], [384.7, -1.64543], [384.8, -1.63721], [384.9, -1.62899], [385, -1.62077], [385.1, -1.61255], [385.2, -1.60434], [385.3, -1.59612], [385.4, -1.5879], [385.5, -1.57967], [385.6, -1.57145], [385.7, -1.56322], [385.8, -1.55499], [385.9, -1.54676], [386, -1.53852], [386.1, -1.53028], [386.2, -1.52203], [386.3, -1.51377], [386.4, -1.50551], [386.5, -1.49724], [386.6, -1.48896], [386.7, -1.48068], [386.8, -1.47238], [386.9, -1.46407], [387, -1.45575], [387.1, -1.44741], [387.2, -1.43906], [387.3, -1.4307], [387.4, -1.42232], [387.5, -1.41392], [387.6, -1.40551], [387.7, -1.39707], [387.8, -1.38862], [387.9, -1.38014], [388, -1.37164], [388.1, -1.36311], [388.2, -1.35456], [388.3, -1.34598], [388.4, -1.33737], [388.5, -1.32873], [388.6, -1.32006], [388.7, -1.31135], [388.8, -1.30261], [388.9, -1.29383], [389, -1.28501], [389.1, -1.27614], [389.2, -1.26723], [389.3, -1.25827], [389.4, -1.24926], [389.5, -1.2402], [389.6, -1.23108], [389.7, -1.2219], [389.8, -1.21266], [389.9, -1.20336], [390, -1.19399], [390.1, -1.18454], [390.2, -1.17502], [390.3, -1.16541], [390.4, -1.15572], [390.5, -1.14594], [390.6, -1.13606], [390.7, -1.12609], [390.8, -1.116], [390.9, -1.1058], [391, -1.09549], [391.1, -1.08504], [391.2, -1.07446], [391.3, -1.06374], [391.4, -1.05287], [391.5, -1.04184], [391.6, -1.03063], [391.7, -1.01925], [391.8, -1.00767], [391.9, -0.995882], [392, -0.983875], [392.1, -0.971634], [392.2, -0.959141], [392.3, -0.946379], [392.4, -0.933329], [392.5, -0.91997], [392.6, -0.906278], [392.7, -0.892229], [392.8, -0.877794], [392.9, -0.862945], [393, -0.847648], [393.1, -0.831865], [393.2, -0.815556], [393.3, -0.798677], [393.4, -0.781178], [393.5, -0.763002], [393.6, -0.74409], [393.7, -0.724371], [393.8, -0.703769], [393.9, -0.682199], [394, -0.659562], [394.1, -0.63575], [394.2, -0.610641], [394.3, -0.584096], [394.4, -0.555958], [394.5, -0.52605], [394.6, -0.49417], [394.7, -0.460091], [394.8, -0.423552], [394.9, -0.384261], [395, -0.341885], [395.1, -0.296049], [395.2, -0.246332], [395.3, -0.192267], [395.4, -0.133338], [395.5, -0.0689867], [395.6, 0.00137332], [395.7, 0.0783377], [395.8, 0.162472], [395.9, 0.254253], [396, 0.353987], [396.1, 0.461694], [396.2, 0.576972], [396.3, 0.69885], [396.4, 0.825665], [396.5, 0.955013], [396.6, 1.08384], [396.7, 1.20867], [396.8, 1.32605], [396.9, 1.43298], [397, 1.5273], [397.1, 1.60793], [397.2, 1.67481], [397.3, 1.72872], [397.4, 1.77098], [397.5, 1.80319], [397.6, 1.82698], [397.7, 1.84388], [397.8, 1.85525], [397.9, 1.86223], [398, 1.86577], [398.1, 1.86663], [398.2, 1.8654], [398.3, 1.86257], [398.4, 1.85849], [398.5, 1.85345], [398.6, 1.84767], [398.7, 1.84133], [398.8, 1.83454], [398.9, 1.82742], [399, 1.82004], [399.1, 1.81245], [399.2, 1.80472], [399.3, 1.79686], [399.4, 1.78891], [399.5, 1.78089], [399.6, 1.77281], [399.7, 1.7647], [399.8, 1.75655], [399.9, 1.74838], [400, 1.7402], [400.1, 1.732], [400.2, 1.72379], [400.3, 1.71557], [400.4, 1.70735], [400.5, 1.69913], [400.6, 1.69091], [400.7, 1.68269], [400.8, 1.67446], [400.9, 1.66624], [401, 1.65802], [401.1, 1.6498], [401.2, 1.64158], [401.3, 1.63336], [401.4, 1.62514], [401.5, 1.61692], [401.6, 1.6087], [401.7, 1.60048], [401.8, 1.59226], [401.9, 1.58404], [402, 1.57582], [402.1, 1.56759], [402.2, 1.55937], [402.3, 1.55113], [402.4, 1.5429], [402.5, 1.53466], [402.6, 1.52641], [402.7, 1.51816], [402.8, 1.5099], [402.9, 1.50164], [403, 1.49336], [403.1, 1.48508], [403.2, 1.47679], [403.3, 1.46848], [403.4, 1.46017], [403.5, 1.45184], [403.6, 1.4435], [403.7, 1.43515], [403.8, 1.42677], [403.9, 1.41839], [404, 1.40998], [404.1, 1.40156], [404.2, 1.39311], [404.3, 1.38465], [404.4, 1.37616], [404.5, 1.36765], [404.6, 1.35911], [404.7, 1.35055], [404.8, 1.34195], [404.9, 1.33333], [405, 1.32467], [405.1, 1.31599], [405.2, 1.30726], [405.3, 1.2985], [405.4, 1.2897], [405.5, 1.28086], [405.6, 1.27197], [405.7, 1.26304], [405.8, 1.25405], [405.9, 1.24502], [406, 1.23593], [406.1, 1.22679], [406.2, 1.21758], [406.3, 1.20831], [406.4, 1.19898], [406.5, 1.18957], [406.6, 1.18009], [406.7, 1.17053], [406.8, 1.16088], [406.9, 1.15115], [407, 1.14132], [407.1, 1.1314], [407.2, 1.12137], [407.3, 1.11124], [407.4, 1.10098], [407.5, 1.09061], [407.6, 1.0801], [407.7, 1.06946], [407.8, 1.05867], [407.9, 1.04772], [408, 1.03661], [408.1, 1.02532], [408.2, 1.01385], [408.3, 1.00217], [408.4, 0.990284], [408.5, 0.978169], [408.6, 0.965812], [408.7, 0.953196], [408.8, 0.940301], [408.9, 0.927109], [409, 0.913596], [409.1, 0.89974], [409.2, 0.885515], [409.3, 0.87089], [409.4, 0.855835], [409.5, 0.840315], [409.6, 0.824291], [409.7, 0.807721], [409.8, 0.790557], [409.9, 0.772748], [410, 0.754236], [410.1, 0.734955], [410.2, 0.714832], [410.3, 0.693788], [410.4, 0.67173], [410.5, 0.648557], [410.6, 0.624154], [410.7, 0.59839], [410.8, 0.57112], [410.9, 0.542176], [411, 0.51137], [411.1, 0.47849], [411.2, 0.443292], [411.3, 0.405502], [411.4, 0.364809], [411.5, 0.320861], [411.6, 0.273262], [411.7, 0.221569], [411.8, 0.165292], [411.9, 0.103893], [412, 0.036801], [412.1, -0.0365803], [412.2, -0.116838], [412.3, -0.204504], [412.4, -0.299988], [412.5, -0.403478], [412.6, -0.514814], [412.7, -0.633345], [412.8, -0.757789], [412.9, -0.886134], [413, -1.01565], [413.1, -1.14305], [413.2, -1.2648], [413.3, -1.37761], [413.4, -1.47884], [413.5, -1.56681], [413.6, -1.64095], [413.7, -1.70161], [413.8, -1.74988], [413.9, -1.78722], [414, -1.81529], [414.1, -1.83567], [414.2, -1.84982], [414.3, -1.85901], [414.4, -1.86427], [414.5, -1.86647], [414.6, -1.86628], [414.7, -1.86425], [414.8, -1.86079], [414.9, -1.85623], [415, -1.85082], [415.1, -1.84476], [415.2, -1.8382], [415.3, -1.83124], [415.4, -1.82399], [415.5, -1.81651], [415.6, -1.80884], [415.7, -1.80105], [415.8, -1.79314], [415.9, -1.78516], [416, -1.77711], [416.1, -1.76901], [416.2, -1.76088], [416.3, -1.75273], [416.4, -1.74455], [416.5, -1.73635], [416.6, -1.72815], [416.7, -1.71994], [416.8, -1.71172], [416.9, -1.7035], [417, -1.69528], [417.1, -1.68706], [417.2, -1.67883], [417.3, -1.67061], [417.4, -1.66239], [417.5, -1.65417], [417.6, -1.64595], [417.7, -1.63773], [417.8, -1.62951], [417.9, -1.62129], [418, -1.61307], [418.1, -1.60485], [418.2, -1.59663], [418.3, -1.58841], [418.4, -1.58019], [418.5, -1.57197], [418.6, -1.56374], [418.7, -1.55551], [418.8, -1.54728], [418.9, -1.53904], [419, -1.5308], [419.1, -1.52255], [419.2, -1.51429], [419.3, -1.50603], [419.4, -1.49776], [419.5, -1.48948], [419.6, -1.4812], [419.7, -1.4729], [419.8, -1.46459], [419.9, -1.45627], [420, -1.44794], [420.1, -1.43959], [420.2, -1.43122], [420.3, -1.42285], [420.4, -1.41445], [420.5, -1.40604], [420.6, -1.3976], [420.7, -1.38915], [420.8, -1.38067], [420.9, -1.37217], [421, -1.36365], [421.1, -1.3551], [421.2, -1.34652], [421.3, -1.33792], [421.4, -1.32928], [421.5, -1.32061], [421.6, -1.3119], [421.7, -1.30316], [421.8, -1.29438], [421.9, -1.28556], [422, -1.2767], [422.1, -1.26779], [422.2, -1.25883], [422.3, -1.24983], [422.4, -1.24077], [422.5, -1.23165], [422.6, -1.22248], [422.7, -1.21325], [422.8, -1.20395], [422.9, -1.19458], [423, -1.18513], [423.1, -1.17562], [423.2, -1.16602], [423.3, -1.15633], [423.4, -1.14656], [423.5, -1.13669], [423.6, -1.12672], [423.7, -1.11664], [423.8, -1.10645], [423.9, -1.09614], [424, -1.0857], [424.1, -1.07513], [424.2, -1.06442], [424.3, -1.05356], [424.4, -1.04254], [424.5, -1.03134], [424.6, -1.01997], [424.7, -1.0084], [424.8, -0.996628], [424.9, -0.984636], [425, -0.97241], [425.1, -0.959934], [425.2, -0.947189], [425.3, -0.934158], [425.4, -0.920818], [425.5, -0.907148], [425.6, -0.893122], [425.7, -0.878713], [425.8, -0.863891], [425.9, -0.848622], [426, -0.832871], [426.1, -0.816597], [426.2, -0.799755], [426.3, -0.782296], [426.4, -0.764165], [426.5, -0.745301], [426.6, -0.725635], [426.7, -0.705091], [426.8, -0.683584], [426.9, -0.661017], [427, -0.637283], [427.1, -0.612259], [427.2, -0.585809], [427.3, -0.557776], [427.4, -0.527984], [427.5, -0.496235], [427.6, -0.462301], [427.7, -0.425925], [427.8, -0.386816], [427.9, -0.344644], [428, -0.299037], [428.1, -0.249578], [428.2, -0.1958], [428.3, -0.137193], [428.4, -0.0731993], [428.5, -0.00323439], [428.6, 0.0732979], [428.7, 0.156966], [428.8, 0.248256], [428.9, 0.347486], [429, 0.454699], [429.1, 0.569523], [429.2, 0.691028], [429.3, 0.817596], [429.4, 0.946869], [429.5, 1.07582], [429.6, 1.20101], [429.7, 1.31896], [429.8, 1.42661], [429.9, 1.52177], [430, 1.60327], [430.1, 1.671], [430.2, 1.72569], [430.3, 1.76864], [430.4, 1.80143], [430.5, 1.8257], [430.6, 1.84299], [430.7, 1.85467], [430.8, 1.8619], [430.9, 1.86564], [431, 1.86664], [431.1, 1.86553], [431.2, 1.86279], [431.3, 1.85878], [431.4, 1.85379], [431.5, 1.84805], [431.6, 1.84174], [431.7, 1.83498], [431.8, 1.82788], [431.9, 1.82051], [432, 1.81294], [432.1, 1.80521], [432.2, 1.79735], [432.3, 1.78941], [432.4, 1.78139], [432.5, 1.77332], [432.6, 1.76521], [432.7, 1.75706], [432.8, 1.7489], [432.9, 1.74071], [433, 1.73251], [433.1, 1.7243], [433.2, 1.71609], [433.3, 1.70787], [433.4, 1.69965], [433.5, 1.69143], [433.6, 1.6832], [433.7, 1.67498], [433.8, 1.66676], [433.9, 1.65854], [434, 1.65032], [434.1, 1.64209], [434.2, 1.63388], [434.3, 1.62566], [434.4, 1.61744], [434.5, 1.60922], [434.6, 1.601], [434.7, 1.59278], [434.8, 1.58456], [434.9, 1.57634], [435, 1.56811], [435.1, 1.55988], [435.2, 1.55165], [435.3, 1.54342], [435.4, 1.53518], [435.5, 1.52693], [435.6, 1.51868], [435.7, 1.51042], [435.8, 1.50216], [435.9, 1.49388], [436, 1.4856], [436.1, 1.47731], [436.2, 1.46901], [436.3, 1.46069], [436.4, 1.45237], [436.5, 1.44403], [436.6, 1.43567], [436.7, 1.4273], [436.8, 1.41891], [436.9, 1.41051], [437, 1.40209], [437.1, 1.39364], [437.2, 1.38518], [437.3, 1.37669], [437.4, 1.36818], [437.5, 1.35965], [437.6, 1.35108], [437.7, 1.34249], [437.8, 1.33387], [437.9, 1.32522], [438, 1.31653], [438.1, 1.30781], [438.2, 1.29905], [438.3, 1.29025], [438.4, 1.28141], [438.5, 1.27253], [438.6, 1.2636], [438.7, 1.25462], [438.8, 1.24559], [438.9, 1.2365], [439, 1.22736], [439.1, 1.21816], [439.2, 1.2089], [439.3, 1.19956], [439.4, 1.19016], [439.5, 1.18068], [439.6, 1.17113], [439.7, 1.16149], [439.8, 1.15176], [439.9, 1.14194], [440, 1.13203], [440.1, 1.12201], [440.2, 1.11188], [440.3, 1.10163], [440.4, 1.09126], [440.5, 1.08077], [440.6, 1.07013], [440.7, 1.05935], [440.8, 1.04841], [440.9, 1.03731], [441, 1.02604], [441.1, 1.01457], [441.2, 1.00291], [441.3, 0.991037], [441.4, 0.978937], [441.5, 0.966596], [441.6, 0.953996], [441.7, 0.94112], [441.8, 0.927947], [441.9, 0.914455], [442, 0.900621], [442.1, 0.88642], [442.2, 0.871821], [442.3, 0.856794], [442.4, 0.841304], [442.5, 0.825313], [442.6, 0.808778], [442.7, 0.791654], [442.8, 0.773887], [442.9, 0.755421], [443, 0.73619], [443.1, 0.716122], [443.2, 0.695138], [443.3, 0.673147], [443.4, 0.650048], [443.5, 0.625725], [443.6, 0.600051], [443.7, 0.57288], [443.8, 0.544046], [443.9, 0.513364], [444, 0.480621], [444.1, 0.445576], [444.2, 0.407958], [444.3, 0.367457], [444.4, 0.323725], [444.5, 0.276368], [444.6, 0.224946], [444.7, 0.168972], [444.8, 0.107911], [444.9, 0.0411941], [445, -0.0317747], [445.1, -0.111584], [445.2, -0.198771], [445.3, -0.293755], [445.4, -0.396743], [445.5, -0.507599], [445.6, -0.625709], [445.7, -0.749833], [445.8, -0.878006], [445.9, -1.00754], [446, -1.13517], [446.1, -1.25738], [446.2, -1.37084], [446.3, -1.47286], [446.4, -1.56169], [446.5, -1.6367], [446.6, -1.69818], [446.7, -1.74718], [446.8, -1.78517], [446.9, -1.81377], [447, -1.83458], [447.1, -1.84909], [447.2, -1.85855], [447.3, -1.86404], [447.4, -1.86641], [447.5, -1.86635], [447.6, -1.86442], [447.7, -1.86104], [447.8, -1.85655], [447.9, -1.85118], [448, -1.84516], [448.1, -1.83862], [448.2, -1.83169], [448.3, -1.82445], [448.4, -1.81698], [448.5, -1.80933], [448.6, -1.80154], [448.7, -1.79364], [448.8, -1.78566], [448.9, -1.77762], [449, -1.76952], [449.1, -1.7614], [449.2, -1.75324], [449.3, -1.74506], [449.4, -1.73687], [449.5, -1.72867], [449.6, -1.72045], [449.7, -1.71224], [449.8, -1.70402], [449.9, -1.6958], [450, -1.68757], [450.1, -1.67935], [450.2, -1.67113], [450.3, -1.6629], [450.4, -1.65468], [450.5, -1.64646], [450.6, -1.63824], [450.7, -1.63002], [450.8, -1.62181], [450.9, -1.61359], [451, -1.60537], [451.1, -1.59715], [451.2, -1.58893], [451.3, -1.58071], [451.4, -1.57248], [451.5, -1.56426], [451.6, -1.55603], [451.7, -1.54779], [451.8, -1.53956], [451.9, -1.53131], [452, -1.52307], [452.1, -1.51481], [452.2, -1.50655], [452.3, -1.49828], [452.4, -1.49], [452.5, -1.48172], [452.6, -1.47342], [452.7, -1.46511], [452.8, -1.45679], [452.9, -1.44846], [453, -1.44011], [453.1, -1.43175], [453.2, -1.42337], [453.3, -1.41498], [453.4, -1.40657], [453.5, -1.39813], [453.6, -1.38968], [453.7, -1.38121], [453.8, -1.37271], [453.9, -1.36419], [454, -1.35564], [454.1, -1.34706], [454.2, -1.33846], [454.3, -1.32982], [454.4, -1.32115], [454.5, -1.31245], [454.6, -1.30371], [454.7, -1.29493], [454.8, -1.28612], [454.9, -1.27726], [455, -1.26835], [455.1, -1.2594], [455.2, -1.25039], [455.3, -1.24134], [455.4, -1.23223], [455.5, -1.22306], [455.6, -1.21383], [455.7, -1.20453], [455.8, -1.19517], [455.9, -1.18573], [456, -1.17622], [456.1, -1.16662], [456.2, -1.15694], [456.3, -1.14717], [456.4, -1.13731], [456.5, -1.12734], [456.6, -1.11727], [456.7, -1.10709], [456.8, -1.09679], [456.9, -1.08636], [457, -1.0758], [457.1, -1.0651], [457.2, -1.05425], [457.3, -1.04323], [457.4, -1.03205], [457.5, -1.02069], [457.6, -1.00913], [457.7, -0.997374], [457.8, -0.985396], [457.9, -0.973185], [458, -0.960725], [458.1, -0.947998], [458.2, -0.934985], [458.3, -0.921666], [458.4, -0.908017], [458.5, -0.894014], [458.6, -0.87963], [458.7, -0.864835], [458.8, -0.849595], [458.9, -0.833875], [459, -0.817635], [459.1, -0.80083], [459.2, -0.783412], [459.3, -0.765325], [459.4, -0.746508], [459.5, -0.726895], [459.6, -0.706409], [459.7, -0.684965], [459.8, -0.662468], [459.9, -0.63881], [460, -0.613871], [460.1, -0.587515], [460.2, -0.559586], [460.3, -0.529911], [460.4, -0.498291], [460.5, -0.464501], [460.6, -0.428287], [460.7, -0.389359], [460.8, -0.34739], [460.9, -0.302011], [461, -0.252806], [461.1, -0.199315], [461.2, -0.141026], [461.3, -0.0773885], [461.4, -0.00781619], [461.5, 0.0682863], [461.6, 0.151491], [461.7, 0.24229], [461.8, 0.341017], [461.9, 0.447734], [462, 0.562101], [462.1, 0.683226], [462.2, 0.809538], [462.3, 0.938724], [462.4, 1.0678], [462.5, 1.19333], [462.6, 1.31182], [462.7, 1.4202], [462.8, 1.51619], [462.9, 1.59856], [463, 1.66714], [463.1, 1.72262], [463.2, 1.76626], [463.3, 1.79964], [463.4, 1.8244], [463.5, 1.84209], [463.6, 1.85408], [463.7, 1.86156], [463.8, 1.86549], [463.9, 1.86665], [464, 1.86566], [464.1, 1.863], [464.2, 1.85906], [464.3, 1.85413], [464.4, 1.84843], [464.5, 1.84215], [464.6, 1.83542], [464.7, 1.82833], [464.8, 1.82098], [464.9, 1.81342], [465, 1.80569], [465.1, 1.79785], [465.2, 1.78991], [465.3, 1.7819], [465.4, 1.77383], [465.5, 1.76572], [465.6, 1.75758], [465.7, 1.74941], [465.8, 1.74122], [465.9, 1.73303], [466, 1.72482], [466.1, 1.7166], [466.2, 1.70839], [466.3, 1.70017], [466.4, 1.69194], [466.5, 1.68372], [466.6, 1.6755], [466.7, 1.66727], [466.8, 1.65905], [466.9, 1.65083], [467, 1.64261], [467.1, 1.63439], [467.2, 1.62617], [467.3, 1.61795], [467.4, 1.60974], [467.5, 1.60152], [467.6, 1.5933], [467.7, 1.58508], [467.8, 1.57685], [467.9, 1.56863], [468, 1.5604], [468.1, 1.55217], [468.2, 1.54393], [468.3, 1.53569], [468.4, 1.52745], [468.5, 1.5192], [468.6, 1.51094], [468.7, 1.50268], [468.8, 1.4944], [468.9, 1.48612], [469, 1.47783], [469.1, 1.46953], [469.2, 1.46121], [469.3, 1.45289], [469.4, 1.44455], [469.5, 1.4362], [469.6, 1.42783], [469.7, 1.41944], [469.8, 1.41104], [469.9, 1.40262], [470, 1.39418], [470.1, 1.38571], [470.2, 1.37723], [470.3, 1.36872], [470.4, 1.36018], [470.5, 1.35162], [470.6, 1.34303], [470.7, 1.33441], [470.8, 1.32576], [470.9, 1.31708], [471, 1.30836], [471.1, 1.2996], [471.2, 1.29081], [471.3, 1.28197], [471.4, 1.27309], [471.5, 1.26416], [471.6, 1.25519], [471.7, 1.24616], [471.8, 1.23708], [471.9, 1.22794], [472, 1.21874], [472.1, 1.20948], [472.2, 1.20015], [472.3, 1.19075], [472.4, 1.18128], [472.5, 1.17173], [472.6, 1.1621], [472.7, 1.15238], [472.8, 1.14256], [472.9, 1.13265], [473, 1.12264], [473.1, 1.11252], [473.2, 1.10228], [473.3, 1.09192], [473.4, 1.08143], [473.5, 1.0708], [473.6, 1.06003], [473.7, 1.04911], [473.8, 1.03801], [473.9, 1.02675], [474, 1.0153], [474.1, 1.00365], [474.2, 0.991789], [474.3, 0.979704], [474.4, 0.967379], [474.5, 0.954796], [474.6, 0.941937], [474.7, 0.928783], [474.8, 0.915312], [474.9, 0.901501], [475, 0.887323], [475.1, 0.87275], [475.2, 0.857751], [475.3, 0.842291], [475.4, 0.826333], [475.5, 0.809834], [475.6, 0.792748], [475.7, 0.775023], [475.8, 0.756602], [475.9, 0.737421], [476, 0.717409], [476.1, 0.696485], [476.2, 0.67456], [476.3, 0.651534], [476.4, 0.627292], [476.5, 0.601706], [476.6, 0.574634], [476.7, 0.54591], [476.8, 0.515349], [476.9, 0.482742], [477, 0.44785], [477.1, 0.410402], [477.2, 0.370093], [477.3, 0.326574], [477.4, 0.279457], [477.5, 0.228304], [477.6, 0.172631], [477.7, 0.111907], [477.8, 0.0455626], [477.9, -0.026996], [478, -0.106359], [478.1, -0.193068], [478.2, -0.287554], [478.3, -0.390039], [478.4, -0.500413], [478.5, -0.618097], [478.6, -0.741893], [478.7, -0.869884], [478.8, -0.999424], [478.9, -1.12728], [479, -1.24993], [479.1, -1.36403], [479.2, -1.46682], [479.3, -1.55652], [479.4, -1.63239], [479.5, -1.6947], [479.6, -1.74445], [479.7, -1.78308], [479.8, -1.81222], [479.9, -1.83348], [480, -1.84834], [480.1, -1.85809], [480.2, -1.86379], [480.3, -1.86634], [480.4, -1.86642], [480.5, -1.86459], [480.6, -1.86129], [480.7, -1.85686], [480.8, -1.85154], [480.9, -1.84555], [481, -1.83904], [481.1, -1.83213], [481.2, -1.82491], [481.3, -1.81746], [481.4, -1.80982], [481.5, -1.80203], [481.6, -1.79414], [481.7, -1.78616], [481.8, -1.77812], [481.9, -1.77003], [482, -1.76191], [482.1, -1.75375], [482.2, -1.74558], [482.3, -1.73738], [482.4, -1.72918], [482.5, -1.72097], [482.6, -1.71275], [482.7, -1.70453], [482.8, -1.69631], [482.9, -1.68809], [483, -1.67987], [483.1, -1.67164], [483.2, -1.66342], [483.3, -1.6552], [483.4, -1.64698], [483.5, -1.63876], [483.6, -1.63054], [483.7, -1.62232], [483.8, -1.6141], [483.9, -1.60588], [484, -1.59767], [484.1, -1.58944], [484.2, -1.58122], [484.3, -1.573], [484.4, -1.56477], [484.5, -1.55654], [484.6, -1.54831], [484.7, -1.54007], [484.8, -1.53183], [484.9, -1.52358], [485, -1.51533], [485.1, -1.50707], [485.2, -1.4988], [485.3, -1.49052], [485.4, -1.48224], [485.5, -1.47394], [485.6, -1.46563], [485.7, -1.45731], [485.8, -1.44898], [485.9, -1.44064], [486, -1.43228], [486.1, -1.4239], [486.2, -1.41551], [486.3, -1.40709], [486.4, -1.39866], [486.5, -1.39021], [486.6, -1.38174], [486.7, -1.37324], [486.8, -1.36472], [486.9, -1.35618], [487, -1.3476], [487.1, -1.339], [487.2, -1.33037], [487.3, -1.3217], [487.4, -1.313], [487.5, -1.30426], [487.6, -1.29549], [487.7, -1.28667], [487.8, -1.27781], [487.9, -1.26891], [488, -1.25996], [488.1, -1.25096], [488.2, -1.24191], [488.3, -1.2328], [488.4, -1.22364], [488.5, -1.21441], [488.6, -1.20512], [488.7, -1.19576], [488.8, -1.18632], [488.9, -1.17682], [489, -1.16723], [489.1, -1.15755], [489.2, -1.14779], [489.3, -1.13793], [489.4, -1.12797], [489.5, -1.11791], [489.6, -1.10773], [489.7, -1.09744], [489.8, -1.08702], [489.9, -1.07647], [490, -1.06577], [490.1, -1.05493], [490.2, -1.04393], [490.3, -1.03276], [490.4, -1.02141], [490.5, -1.00987], [490.6, -0.998119], [490.7, -0.986155], [490.8, -0.973959], [490.9, -0.961515], [491, -0.948806], [491.1, -0.935811], [491.2, -0.922512], [491.3, -0.908884], [491.4, -0.894905], [491.5, -0.880545], [491.6, -0.865777], [491.7, -0.850566], [491.8, -0.834878], [491.9, -0.818672], [492, -0.801904], [492.1, -0.784525], [492.2, -0.766482], [492.3, -0.747713], [492.4, -0.728152], [492.5, -0.707723], [492.6, -0.686342], [492.7, -0.663914], [492.8, -0.640333], [492.9, -0.615478], [493, -0.589215], [493.1, -0.56139], [493.2, -0.53183], [493.3, -0.500339], [493.4, -0.466692], [493.5, -0.430638], [493.6, -0.39189], [493.7, -0.350122], [493.8, -0.304969], [493.9, -0.256018], [494, -0.20281], [494.1, -0.144839], [494.2, -0.0815542], [494.3, -0.0123722], [494.4, 0.0633028], [494.5, 0.146046], [494.6, 0.236356], [494.7, 0.334579], [494.8, 0.4408], [494.9, 0.554706], [495, 0.675445], [495.1, 0.801491], [495.2, 0.930579], [495.3, 1.05976], [495.4, 1.18561], [495.5, 1.30465], [495.6, 1.41374], [495.7, 1.51055], [495.8, 1.5938], [495.9, 1.66323], [496, 1.7195], [496.1, 1.76384], [496.2, 1.79781], [496.3, 1.82307], [496.4, 1.84116], [496.5, 1.85347], [496.6, 1.86121], [496.7, 1.86533], [496.8, 1.86664], [496.9, 1.86577], [497, 1.86321], [497.1, 1.85934], [497.2, 1.85446], [497.3, 1.84881], [497.4, 1.84256], [497.5, 1.83585], [497.6, 1.82879], [497.7, 1.82145], [497.8, 1.8139], [497.9, 1.80618], [498, 1.79835], [498.1, 1.79041], [498.2, 1.7824], [498.3, 1.77434], [498.4, 1.76623], [498.5, 1.75809], [498.6, 1.74992], [498.7, 1.74174], [498.8, 1.73354], [498.9, 1.72533], [499, 1.71712], [499.1, 1.7089], [499.2, 1.70068], [499.3, 1.69246], [499.4, 1.68424], [499.5, 1.67601], [499.6, 1.66779], [499.7, 1.65957], [499.8, 1.65135], [499.9, 1.64313], [500, 1.63491]])
+
+plt.figure()
+plt.plot(data.T[0,:], data.T[1,:])
+plt.xlabel('ms')
+plt.ylabel('mV')
+plt.title('FitzhughNagumoNeuron')
+plt.show()
@@ -0,0 +1,14 @@
+#!/usr/bin/env python
+
+import numpy as np
+import matplotlib.pyplot as plt
+
+data = np.array([[0, -70, -50], [0.1, -70, -50], [0.2, -70, -50], [0.3, -70, -50], [0.4, -70, -50], [0.5, -70, -50], [0.6, -70, -50], [0.7, -70, -50], [0.8, -70, -50], [0.9, -70, -50], [1, -70, -50], [1.1, -70, -50], [1.2, -70, -50], [1.3, -70, -50], [1.4, -70, -50], [1.5, -70, -50], [1.6, -70, -50], [1.7, -70, -50], [1.8, -70, -50], [1.9, -70, -50], [2, -70, -50], [2.1, -70, -50], [2.2, -70, -50], [2.3, -70, -50], [2.4, -70, -50], [2.5, -70, -50], [2.6, -70, -50], [2.7, -70, -50], [2.8, -70, -50], [2.9, -70, -50], [3, -70, -50], [3.1, -70, -50], [3.2, -70, -50], [3.3, -70, -50], [3.4, -70, -50], [3.5, -70, -50], [3.6, -70, -50], [3.7, -70, -50], [3.8, -70, -50], [3.9, -70, -50], [4, -70, -50], [4.1, -70, -50], [4.2, -70, -50], [4.3, -70, -50], [4.4, -70, -50], [4.5, -70, -50], [4.6, -70, -50], [4.7, -70, -50], [4.8, -70, -50], [4.9, -70, -50], [5, -70, -50], [5.1, -70, -50], [5.2, -70, -50], [5.3, -70, -50], [5.4, -70, -50], [5.5, -70, -50], [5.6, -70, -50], [5.7, -70, -50], [5.8, -70, -50], [5.9, -70, -50], [6, -70, -50], [6.1, -70, -50], [6.2, -70, -50], [6.3, -70, -50], [6.4, -70, -50], [6.5, -70, -50], [6.6, -70, -50], [6.7, -70, -50], [6.8, -70, -50], [6.9, -70, -50], [7, -70, -50], [7.1, -70, -50], [7.2, -70, -50], [7.3, -70, -50], [7.4, -70, -50], [7.5, -70, -50], [7.6, -70, -50], [7.7, -70, -50], [7.8, -70, -50], [7.9, -70, -50], [8, -70, -50], [8.1, -70, -50], [8.2, -70, -50], [8.3, -70, -50], [8.4, -70, -50], [8.5, -70, -50], [8.6, -70, -50], [8.7, -70, -50], [8.8, -70, -50], [8.9, -70, -50], [9, -70, -50], [9.1, -70, -50], [9.2, -70, -50], [9.3, -70, -50], [9.4, -70, -50], [9.5, -70, -50], [9.6, -70, -50], [9.7, -70, -50], [9.8, -70, -50], [9.9, -70, -50], [10, -70, -50], [10.1, -69.9, -50], [10.2, -69.701, -49.9999], [10.3, -69.503, -49.9997], [10.4, -69.306, -49.9994], [10.5, -69.1099, -49.999], [10.6, -68.9149, -49.9985], [10.7, -68.7208, -49.9979], [10.8, -68.5277, -49.9972], [10.9, -68.3355, -49.9965], [11, -68.1443, -49.9956], [11.1, -67.9541, -49.9946], [11.2, -67.7648, -49.9935], [11.3, -67.5764, -49.9924], [11.4, -67.389, -49.9911], [11.5, -67.2025, -49.9898], [11.6, -67.017, -49.9884], [11.7, -66.8324, -49.9868], [11.8, -66.6487, -49.9852], [11.9, -66.4659, -49.9835], [12, -66.284, -49.9817], [12.1, -66.103, -49.9798], [12.2, -65.923, -49.9779], [12.3, -65.7438, -49.9758], [12.4, -65.5655, -49.9737], [12.5, -65.3881, -49.9714], [12.6, -65.2116, -49.9691], [12.7, -65.036, -49.9667], [12.8, -64.8613, -49.9642], [12.9, -64.6874, -49.9616], [13, -64.5144, -49.959], [13.1, -64.3423, -49.9562], [13.2, -64.171, -49.9534], [13.3, -64.0006, -49.9505], [13.4, -63.831, -49.9475], [13.5, -63.6623, -49.9444], [13.6, -63.4944, -49.9413], [13.7, -63.3273, -49.938], [13.8, -63.1611, -49.9347], [13.9, -62.9957, -49.9313], [14, -62.8311, -49.9279], [14.1, -62.6674, -49.9243], [14.2, -62.5045, -49.9207], [14.3, -62.3423, -49.917], [14.4, -62.181, -49.9132], [14.5, -62.0205, -49.9093], [14.6, -61.8608, -49.9054], [14.7, -61.7019, -49.9014], [14.8, -61.5438, -49.8973], [14.9, -61.3865, -49.8931], [15, -61.2299, -49.8889], [15.1, -61.0742, -49.8846], [15.2, -60.9192, -49.8802], [15.3, -60.765, -49.8757], [15.4, -60.6116, -49.8712], [15.5, -60.4589, -49.8666], [15.6, -60.307, -49.8619], [15.7, -60.1558, -49.8572], [15.8, -60.0054, -49.8524], [15.9, -59.8558, -49.8475], [16, -59.7068, -49.8425], [16.1, -59.5587, -49.8375], [16.2, -59.4113, -49.8324], [16.3, -59.2646, -49.8273], [16.4, -59.1186, -49.822], [16.5, -58.9734, -49.8167], [16.6, -58.8289, -49.8114], [16.7, -58.6851, -49.8059], [16.8, -58.542, -49.8004], [16.9, -58.3997, -49.7949], [17, -58.258, -49.7892], [17.1, -58.1171, -49.7836], [17.2, -57.9769, -49.7778], [17.3, -57.8373, -49.772], [17.4, -57.6985, -49.7661], [17.5, -57.5603, -49.7601], [17.6, -57.4229, -49.7541], [17.7, -57.2861, -49.7481], [17.8, -57.15, -49.7419], [17.9, -57.0146, -49.7357], [18, -56.8799, -49.7295], [18.1, -56.7458, -49.7231], [18.2, -56.6124, -49.7168], [18.3, -56.4797, -49.7103], [18.4, -56.3476, -49.7038], [18.5, -56.2162, -49.6973], [18.6, -56.0855, -49.6906], [18.7, -55.9554, -49.684], [18.8, -55.8259, -49.6772], [18.9, -55.6971, -49.6704], [19, -55.5689, -49.6636], [19.1, -55.4414, -49.6567], [19.2, -55.3145, -49.6497], [19.3, -55.1883, -49.6427], [19.4, -55.0626, -49.6356], [19.5, -54.9376, -49.6285], [19.6, -54.8133, -49.6213], [19.7, -54.6895, -49.6141], [19.8, -54.5664, -49.6068], [19.9, -54.4438, -49.5994], [20, -54.3219, -49.592], [20.1, -54.2006, -49.5845], [20.2, -54.0799, -49.577], [20.3, -53.9598, -49.5695], [20.4, -53.8403, -49.5619], [20.5, -53.7214, -49.5542], [20.6, -53.6031, -49.5465], [20.7, -53.4854, -49.5387], [20.8, -53.3683, -49.5309], [20.9, -53.2517, -49.523], [21, -53.1357, -49.5151], [21.1, -53.0204, -49.5071], [21.2, -52.9055, -49.4991], [21.3, -52.7913, -49.491], [21.4, -52.6776, -49.4829], [21.5, -52.5645, -49.4747], [21.6, -52.452, -49.4665], [21.7, -52.34, -49.4583], [21.8, -52.2286, -49.4499], [21.9, -52.1177, -49.4416], [22, -52.0074, -49.4332], [22.1, -51.8976, -49.4247], [22.2, -51.7884, -49.4162], [22.3, -51.6798, -49.4077], [22.4, -51.5716, -49.3991], [22.5, -51.464, -49.3904], [22.6, -51.357, -49.3818], [22.7, -51.2505, -49.373], [22.8, -51.1445, -49.3643], [22.9, -51.039, -49.3555], [23, -50.9341, -49.3466], [23.1, -50.8297, -49.3377], [23.2, -50.7258, -49.3288], [23.3, -50.6224, -49.3198], [23.4, -50.5196, -49.3107], [23.5, -50.4172, -49.3017], [23.6, -50.3154, -49.2926], [23.7, -50.2141, -49.2834], [23.8, -50.1133, -49.2742], [23.9, -50.0129, -49.265], [24, -49.9131, -49.2557], [24.1, -49.8138, -49.2464], [24.2, -49.715, -49.237], [24.3, -49.6167, -49.2276], [24.4, -49.5188, -49.2182], [24.5, -49.4215, -49.2087], [24.6, -49.3246, -49.1992], [24.7, -49.2282, -49.1896], [24.8, -70, -49.18], [24.9, -68.8728, -49.1806], [25, -67.7706, -49.1805], [25.1, -66.693, -49.18], [25.2, -65.6395, -49.1789], [25.3, -64.6094, -49.1772], [25.4, -63.6025, -49.1751], [25.5, -62.6181, -49.1725], [25.6, -61.6559, -49.1694], [25.7, -60.7154, -49.1658], [25.8, -59.796, -49.1618], [25.9, -58.8975, -49.1573], [26, -58.0194, -49.1524], [26.1, -57.1612, -49.147], [26.2, -56.3226, -49.1412], [26.3, -55.5031, -49.135], [26.4, -54.7023, -49.1285], [26.5, -53.92, -49.1215], [26.6, -53.1556, -49.1141], [26.7, -52.4088, -49.1064], [26.8, -51.6792, -49.0983], [26.9, -50.9666, -49.0899], [27, -50.2705, -49.0811], [27.1, -49.5906, -49.072], [27.2, -70, -49.0626], [27.3, -68.9298, -49.0632], [27.4, -67.8842, -49.0634], [27.5, -66.8628, -49.063], [27.6, -65.865, -49.0621], [27.7, -64.8904, -49.0607], [27.8, -63.9385, -49.0589], [27.9, -63.0088, -49.0565], [28, -62.1008, -49.0538], [28.1, -61.2141, -49.0505], [28.2, -60.3483, -49.0469], [28.3, -59.5029, -49.0428], [28.4, -58.6775, -49.0383], [28.5, -57.8716, -49.0334], [28.6, -57.085, -49.0281], [28.7, -56.3171, -49.0224], [28.8, -55.5676, -49.0164], [28.9, -54.8361, -49.01], [29, -54.1222, -49.0032], [29.1, -53.4256, -48.9961], [29.2, -52.7458, -48.9886], [29.3, -52.0826, -48.9808], [29.4, -51.4356, -48.9727], [29.5, -50.8044, -48.9643], [29.6, -50.1888, -48.9556], [29.7, -49.5883, -48.9466], [29.8, -49.0028, -48.9373], [29.9, -70, -48.9277], [30, -68.9834, -48.9286], [30.1, -67.9911, -48.9289], [30.2, -67.0226, -48.9287], [30.3, -66.0774, -48.928], [30.4, -65.1549, -48.9269], [30.5, -64.2548, -48.9253], [30.6, -63.3765, -48.9233], [30.7, -62.5196, -48.9209], [30.8, -61.6836, -48.918], [30.9, -60.8682, -48.9147], [31, -60.0728, -48.911], [31.1, -59.297, -48.907], [31.2, -58.5405, -48.9025], [31.3, -57.8027, -48.8977], [31.4, -57.0834, -48.8925], [31.5, -56.3822, -48.887], [31.6, -55.6986, -48.8811], [31.7, -55.0322, -48.8749], [31.8, -54.3828, -48.8684], [31.9, -53.75, -48.8616], [32, -53.1333, -48.8544], [32.1, -52.5325, -48.847], [32.2, -51.9472, -48.8393], [32.3, -51.3771, -48.8313], [32.4, -50.8218, -48.823], [32.5, -50.2811, -48.8144], [32.6, -49.7547, -48.8056], [32.7, -49.2421, -48.7966], [32.8, -70, -48.7873], [32.9, -69.0336, -48.7883], [33, -68.0912, -48.7887], [33.1, -67.1721, -48.7888], [33.2, -66.276, -48.7883], [33.3, -65.4024, -48.7875], [33.4, -64.5507, -48.7862], [33.5, -63.7205, -48.7845], [33.6, -62.9114, -48.7823], [33.7, -62.1229, -48.7798], [33.8, -61.3545, -48.7769], [33.9, -60.6058, -48.7736], [34, -59.8765, -48.7699], [34.1, -59.1661, -48.7659], [34.2, -58.4741, -48.7616], [34.3, -57.8003, -48.7569], [34.4, -57.1442, -48.7519], [34.5, -56.5054, -48.7465], [34.6, -55.8835, -48.7409], [34.7, -55.2783, -48.7349], [34.8, -54.6893, -48.7287], [34.9, -54.1161, -48.7222], [35, -53.5585, -48.7154], [35.1, -53.0162, -48.7083], [35.2, -52.4886, -48.701], [35.3, -51.9757, -48.6934], [35.4, -51.477, -48.6855], [35.5, -50.9922, -48.6775], [35.6, -50.521, -48.6692], [35.7, -50.0632, -48.6607], [35.8, -49.6184, -48.6519], [35.9, -49.1863, -48.643], [36, -48.7667, -48.6338], [36.1, -70, -48.6245], [36.2, -69.0793, -48.6256], [36.3, -68.1822, -48.6263], [36.4, -67.3083, -48.6265], [36.5, -66.4569, -48.6264], [36.6, -65.6277, -48.6258], [36.7, -64.8201, -48.6247], [36.8, -64.0338, -48.6233], [36.9, -63.2682, -48.6215], [37, -62.5228, -48.6193], [37.1, -61.7973, -48.6168], [37.2, -61.0913, -48.6139], [37.3, -60.4042, -48.6107], [37.4, -59.7358, -48.6071], [37.5, -59.0855, -48.6032], [37.6, -58.4531, -48.599], [37.7, -57.838, -48.5944], [37.8, -57.24, -48.5896], [37.9, -56.6587, -48.5845], [38, -56.0937, -48.5791], [38.1, -55.5446, -48.5734], [38.2, -55.0111, -48.5675], [38.3, -54.4928, -48.5613], [38.4, -53.9895, -48.5549], [38.5, -53.5008, -48.5482], [38.6, -53.0264, -48.5413], [38.7, -52.5659, -48.5341], [38.8, -52.119, -48.5268], [38.9, -51.6856, -48.5192], [39, -51.2651, -48.5114], [39.1, -50.8575, -48.5034], [39.2, -50.4623, -48.4953], [39.3, -50.0793, -48.4869], [39.4, -49.7082, -48.4784], [39.5, -49.3488, -48.4697], [39.6, -49.0008, -48.4608], [39.7, -48.6639, -48.4518], [39.8, -70, -48.4426], [39.9, -69.1201, -48.4439], [40, -68.2635, -48.4448], [40.1, -67.4298, -48.4453], [40.2, -66.6184, -48.4453], [40.3, -65.8288, -48.445], [40.4, -65.0607, -48.4443], [40.5, -64.3134, -48.4432], [40.6, -63.5866, -48.4417], [40.7, -62.8798, -48.4399], [40.8, -62.1926, -48.4377], [40.9, -61.5246, -48.4352], [41, -60.8753, -48.4323], [41.1, -60.2443, -48.4292], [41.2, -59.6313, -48.4257], [41.3, -59.0358, -48.422], [41.4, -58.4574, -48.4179], [41.5, -57.8958, -48.4136], [41.6, -57.3507, -48.409], [41.7, -56.8215, -48.4041], [41.8, -56.3081, -48.399], [41.9, -55.81, -48.3936], [42, -55.3269, -48.388], [42.1, -54.8584, -48.3822], [42.2, -54.4043, -48.3761], [42.3, -53.9643, -48.3698], [42.4, -53.5379, -48.3633], [42.5, -53.125, -48.3566], [42.6, -52.7251, -48.3498], [42.7, -52.3381, -48.3427], [42.8, -51.9635, -48.3354], [42.9, -51.6012, -48.328], [43, -51.2509, -48.3204], [43.1, -50.9123, -48.3126], [43.2, -50.585, -48.3046], [43.3, -50.269, -48.2966], [43.4, -49.9638, -48.2883], [43.5, -49.6694, -48.2799], [43.6, -49.3853, -48.2714], [43.7, -49.1114, -48.2628], [43.8, -48.8474, -48.254], [43.9, -48.5932, -48.2451], [44, -48.3484, -48.2361], [44.1, -70, -48.227], [44.2, -69.1546, -48.2286], [44.3, -68.3323, -48.2297], [44.4, -67.5325, -48.2304], [44.5, -66.7549, -48.2308], [44.6, -65.9989, -48.2307], [44.7, -65.264, -48.2303], [44.8, -64.5498, -48.2295], [44.9, -63.8558, -48.2284], [45, -63.1816, -48.2269], [45.1, -62.5268, -48.2251], [45.2, -61.8909, -48.223], [45.3, -61.2735, -48.2206], [45.4, -60.6742, -48.2178], [45.5, -60.0926, -48.2148], [45.6, -59.5283, -48.2115], [45.7, -58.981, -48.2079], [45.8, -58.4502, -48.2041], [45.9, -57.9356, -48.2], [46, -57.4368, -48.1956], [46.1, -56.9535, -48.191], [46.2, -56.4853, -48.1862], [46.3, -56.0319, -48.1811], [46.4, -55.5929, -48.1758], [46.5, -55.1681, -48.1704], [46.6, -54.7571, -48.1647], [46.7, -54.3596, -48.1588], [46.8, -53.9752, -48.1527], [46.9, -53.6038, -48.1465], [47, -53.245, -48.14], [47.1, -52.8985, -48.1334], [47.2, -52.564, -48.1267], [47.3, -52.2413, -48.1197], [47.4, -51.93, -48.1127], [47.5, -51.63, -48.1054], [47.6, -51.341, -48.0981], [47.7, -51.0626, -48.0906], [47.8, -50.7947, -48.083], [47.9, -50.5371, -48.0752], [48, -50.2894, -48.0673], [48.1, -50.0515, -48.0594], [48.2, -49.8231, -48.0513], [48.3, -49.6039, -48.0431], [48.4, -49.3939, -48.0348], [48.5, -49.1927, -48.0264], [48.6, -49.0002, -48.0179], [48.7, -48.8161, -48.0094], [48.8, -48.6403, -48.0007], [48.9, -48.4725, -47.992], [49, -48.3125, -47.9832], [49.1, -48.1603, -47.9744], [49.2, -48.0155, -47.9654], [49.3, -70, -47.9564], [49.4, -69.1806, -47.9583], [49.5, -68.3842, -47.9597], [49.6, -67.6101, -47.9607], [49.7, -66.858, -47.9614], [49.8, -66.1273, -47.9617], [49.9, -65.4176, -47.9616], [50, -64.7283, -47.9612], [50.1, -64.0592, -47.9604], [50.2, -63.4096, -47.9593], [50.3, -62.7792, -47.9579], [50.4, -62.1676, -47.9562], [50.5, -61.5743, -47.9541], [50.6, -60.9989, -47.9518], [50.7, -60.4411, -47.9492], [50.8, -59.9004, -47.9464], [50.9, -59.3765, -47.9432], [51, -58.8689, -47.9399], [51.1, -58.3774, -47.9362], [51.2, -57.9016, -47.9324], [51.3, -57.441, -47.9283], [51.4, -56.9954, -47.924], [51.5, -56.5644, -47.9194], [51.6, -56.1478, -47.9147], [51.7, -55.745, -47.9097], [51.8, -55.356, -47.9046], [51.9, -54.9803, -47.8993], [52, -54.6176, -47.8938], [52.1, -54.2676, -47.8881], [52.2, -53.9301, -47.8823], [52.3, -53.6048, -47.8763], [52.4, -53.2913, -47.8701], [52.5, -52.9894, -47.8638], [52.6, -52.6989, -47.8574], [52.7, -52.4194, -47.8508], [52.8, -52.1508, -47.8441], [52.9, -51.8927, -47.8373], [53, -51.6449, -47.8303], [53.1, -51.4072, -47.8233], [53.2, -51.1793, -47.8161], [53.3, -50.961, -47.8088], [53.4, -50.7521, -47.8014], [53.5, -50.5524, -47.794], [53.6, -50.3616, -47.7864], [53.7, -50.1795, -47.7788], [53.8, -50.0059, -47.771], [53.9, -49.8406, -47.7632], [54, -49.6834, -47.7553], [54.1, -49.5341, -47.7474], [54.2, -49.3925, -47.7394], [54.3, -49.2585, -47.7313], [54.4, -49.1318, -47.7232], [54.5, -49.0122, -47.715], [54.6, -48.8997, -47.7068], [54.7, -48.7939, -47.6985], [54.8, -48.6948, -47.6901], [54.9, -48.6022, -47.6818], [55, -48.5159, -47.6734], [55.1, -48.4357, -47.665], [55.2, -48.3616, -47.6565], [55.3, -48.2932, -47.648], [55.4, -48.2306, -47.6395], [55.5, -48.1735, -47.631], [55.6, -48.1219, -47.6224], [55.7, -48.0755, -47.6138], [55.8, -48.0342, -47.6053], [55.9, -47.9979, -47.5967], [56, -47.9665, -47.5881], [56.1, -47.9399, -47.5794], [56.2, -47.9178, -47.5708], [56.3, -47.9002, -47.5622], [56.4, -47.887, -47.5536], [56.5, -47.8781, -47.545], [56.6, -47.8733, -47.5364], [56.7, -47.8725, -47.5278], [56.8, -47.8756, -47.5192], [56.9, -47.8825, -47.5106], [57, -47.8931, -47.5021], [57.1, -47.9073, -47.4935], [57.2, -47.925, -47.485], [57.3, -47.9461, -47.4765], [57.4, -47.9705, -47.468], [57.5, -47.998, -47.4595], [57.6, -48.0287, -47.4511], [57.7, -48.0624, -47.4426], [57.8, -48.0991, -47.4342], [57.9, -48.1386, -47.4259], [58, -48.1808, -47.4175], [58.1, -48.2257, -47.4092], [58.2, -48.2732, -47.4009], [58.3, -48.3232, -47.3927], [58.4, -48.3756, -47.3845], [58.5, -48.4304, -47.3763], [58.6, -48.4875, -47.3682], [58.7, -48.5468, -47.3601], [58.8, -48.6082, -47.352], [58.9, -48.6717, -47.344], [59, -48.7372, -47.336], [59.1, -48.8047, -47.328], [59.2, -48.874, -47.3201], [59.3, -48.9451, -47.3123], [59.4, -49.0179, -47.3044], [59.5, -49.0924, -47.2967], [59.6, -49.1686, -47.2889], [59.7, -49.2463, -47.2813], [59.8, -49.3255, -47.2736], [59.9, -49.4062, -47.266], [60, -49.4883, -47.2585], [60.1, -49.5717, -47.251], [60.2, -49.6564, -47.2436], [60.3, -49.7424, -47.2362], [60.4, -49.8295, -47.2288], [60.5, -49.9178, -47.2215], [60.6, -50.0072, -47.2143], [60.7, -50.0976, -47.2071], [60.8, -50.189, -47.2], [60.9, -50.2814, -47.1929], [61, -50.3747, -47.1859], [61.1, -50.4689, -47.1789], [61.2, -50.5639, -47.172], [61.3, -50.6597, -47.1651], [61.4, -50.7563, -47.1583], [61.5, -50.8535, -47.1516], [61.6, -50.9515, -47.1449], [61.7, -51.0501, -47.1382], [61.8, -51.1493, -47.1317], [61.9, -51.249, -47.1251], [62, -51.3493, -47.1187], [62.1, -51.4501, -47.1122], [62.2, -51.5514, -47.1059], [62.3, -51.6531, -47.0996], [62.4, -51.7552, -47.0933], [62.5, -51.8577, -47.0871], [62.6, -51.9606, -47.081], [62.7, -52.0637, -47.0749], [62.8, -52.1672, -47.0689], [62.9, -52.2709, -47.063], [63, -52.3748, -47.0571], [63.1, -52.479, -47.0512], [63.2, -52.5833, -47.0454], [63.3, -52.6879, -47.0397], [63.4, -52.7925, -47.0341], [63.5, -52.8972, -47.0284], [63.6, -53.0021, -47.0229], [63.7, -53.107, -47.0174], [63.8, -53.2119, -47.012], [63.9, -53.3169, -47.0066], [64, -53.4219, -47.0013], [64.1, -53.5269, -46.996], [64.2, -53.6318, -46.9908], [64.3, -53.7367, -46.9857], [64.4, -53.8415, -46.9806], [64.5, -53.9462, -46.9755], [64.6, -54.0507, -46.9706], [64.7, -54.1552, -46.9657], [64.8, -54.2595, -46.9608], [64.9, -54.3637, -46.956], [65, -54.4677, -46.9512], [65.1, -54.5714, -46.9466], [65.2, -54.675, -46.9419], [65.3, -54.7784, -46.9373], [65.4, -54.8815, -46.9328], [65.5, -54.9844, -46.9284], [65.6, -55.087, -46.924], [65.7, -55.1893, -46.9196], [65.8, -55.2913, -46.9153], [65.9, -55.3931, -46.9111], [66, -55.4945, -46.9069], [66.1, -55.5956, -46.9027], [66.2, -55.6963, -46.8987], [66.3, -55.7968, -46.8946], [66.4, -55.8968, -46.8907], [66.5, -55.9965, -46.8868], [66.6, -56.0958, -46.8829], [66.7, -56.1947, -46.8791], [66.8, -56.2932, -46.8753], [66.9, -56.3913, -46.8716], [67, -56.489, -46.868], [67.1, -56.5863, -46.8644], [67.2, -56.6831, -46.8608], [67.3, -56.7795, -46.8573], [67.4, -56.8754, -46.8539], [67.5, -56.9709, -46.8505], [67.6, -57.066, -46.8472], [67.7, -57.1605, -46.8439], [67.8, -57.2546, -46.8406], [67.9, -57.3482, -46.8375], [68, -57.4413, -46.8343], [68.1, -57.5339, -46.8312], [68.2, -57.626, -46.8282], [68.3, -57.7176, -46.8252], [68.4, -57.8086, -46.8223], [68.5, -57.8992, -46.8194], [68.6, -57.9892, -46.8165], [68.7, -58.0787, -46.8137], [68.8, -58.1677, -46.811], [68.9, -58.2561, -46.8083], [69, -58.344, -46.8056], [69.1, -58.4314, -46.803], [69.2, -58.5182, -46.8004], [69.3, -58.6044, -46.7979], [69.4, -58.6901, -46.7954], [69.5, -58.7752, -46.793], [69.6, -58.8598, -46.7906], [69.7, -58.9438, -46.7883], [69.8, -59.0272, -46.786], [69.9, -59.11, -46.7837], [70, -59.1923, -46.7815], [70.1, -59.274, -46.7794], [70.2, -59.3551, -46.7773], [70.3, -59.4356, -46.7752], [70.4, -59.5155, -46.7731], [70.5, -59.5949, -46.7711], [70.6, -59.6736, -46.7692], [70.7, -59.7518, -46.7673], [70.8, -59.8294, -46.7654], [70.9, -59.9063, -46.7636], [71, -59.9827, -46.7618], [71.1, -60.0585, -46.76], [71.2, -60.1337, -46.7583], [71.3, -60.2083, -46.7567], [71.4, -60.2823, -46.755], [71.5, -60.3556, -46.7534], [71.6, -60.4284, -46.7519], [71.7, -60.5006, -46.7504], [71.8, -60.5722, -46.7489], [71.9, -60.6431, -46.7474], [72, -60.7135, -46.746], [72.1, -60.7832, -46.7446], [72.2, -60.8524, -46.7433], [72.3, -60.9209, -46.742], [72.4, -60.9889, -46.7408], [72.5, -61.0562, -46.7395], [72.6, -61.1229, -46.7383], [72.7, -61.1891, -46.7372], [72.8, -61.2546, -46.736], [72.9, -61.3195, -46.735], [73, -61.3838, -46.7339], [73.1, -61.4475, -46.7329], [73.2, -61.5106, -46.7319], [73.3, -61.5731, -46.7309], [73.4, -61.635, -46.73], [73.5, -61.6963, -46.7291], [73.6, -61.7569, -46.7282], [73.7, -61.817, -46.7274], [73.8, -61.8765, -46.7266], [73.9, -61.9354, -46.7258], [74, -61.9937, -46.7251], [74.1, -62.0514, -46.7244], [74.2, -62.1085, -46.7237], [74.3, -62.165, -46.723], [74.4, -62.2209, -46.7224], [74.5, -62.2762, -46.7218], [74.6, -62.3309, -46.7212], [74.7, -62.3851, -46.7207], [74.8, -62.4386, -46.7202], [74.9, -62.4916, -46.7197], [75, -62.5439, -46.7192], [75.1, -62.5957, -46.7188], [75.2, -62.6469, -46.7184], [75.3, -62.6975, -46.718], [75.4, -62.7476, -46.7176], [75.5, -62.797, -46.7173], [75.6, -62.8459, -46.717], [75.7, -62.8942, -46.7167], [75.8, -62.942, -46.7165], [75.9, -62.9891, -46.7162], [76, -63.0357, -46.716], [76.1, -63.0818, -46.7158], [76.2, -63.1272, -46.7157], [76.3, -63.1721, -46.7155], [76.4, -63.2165, -46.7154], [76.5, -63.2602, -46.7153], [76.6, -63.3035, -46.7152], [76.7, -63.3461, -46.7152], [76.8, -63.3882, -46.7152], [76.9, -63.4298, -46.7151], [77, -63.4708, -46.7152], [77.1, -63.5112, -46.7152], [77.2, -63.5511, -46.7152], [77.3, -63.5905, -46.7153], [77.4, -63.6293, -46.7154], [77.5, -63.6676, -46.7155], [77.6, -63.7053, -46.7156], [77.7, -63.7425, -46.7158], [77.8, -63.7792, -46.7159], [77.9, -63.8153, -46.7161], [78, -63.8509, -46.7163], [78.1, -63.886, -46.7165], [78.2, -63.9205, -46.7168], [78.3, -63.9545, -46.717], [78.4, -63.988, -46.7173], [78.5, -64.021, -46.7176], [78.6, -64.0535, -46.7179], [78.7, -64.0854, -46.7182], [78.8, -64.1169, -46.7185], [78.9, -64.1478, -46.7189], [79, -64.1782, -46.7192], [79.1, -64.2081, -46.7196], [79.2, -64.2376, -46.72], [79.3, -64.2665, -46.7204], [79.4, -64.2949, -46.7208], [79.5, -64.3228, -46.7213], [79.6, -64.3502, -46.7217], [79.7, -64.3771, -46.7222], [79.8, -64.4036, -46.7227], [79.9, -64.4295, -46.7231], [80, -64.455, -46.7236], [80.1, -64.48, -46.7241], [80.2, -64.5045, -46.7247], [80.3, -64.5285, -46.7252], [80.4, -64.5521, -46.7257], [80.5, -64.5752, -46.7263], [80.6, -64.5978, -46.7269], [80.7, -64.6199, -46.7274], [80.8, -64.6416, -46.728], [80.9, -64.6628, -46.7286], [81, -64.6836, -46.7292], [81.1, -64.7039, -46.7299], [81.2, -64.7237, -46.7305], [81.3, -64.7431, -46.7311], [81.4, -64.762, -46.7318], [81.5, -64.7805, -46.7324], [81.6, -64.7985, -46.7331], [81.7, -64.8161, -46.7338], [81.8, -64.8333, -46.7344], [81.9, -64.85, -46.7351], [82, -64.8663, -46.7358], [82.1, -64.8821, -46.7365], [82.2, -64.8975, -46.7372], [82.3, -64.9125, -46.7379], [82.4, -64.927, -46.7387], [82.5, -64.9411, -46.7394], [82.6, -64.9548, -46.7401], [82.7, -64.9681, -46.7409], [82.8, -64.981, -46.7416], [82.9, -64.9934, -46.7424], [83, -65.0054, -46.7431], [83.1, -65.0171, -46.7439], [83.2, -65.0283, -46.7446], [83.3, -65.0391, -46.7454], [83.4, -65.0495, -46.7462], [83.5, -65.0595, -46.747], [83.6, -65.069, -46.7478], [83.7, -65.0782, -46.7485], [83.8, -65.087, -46.7493], [83.9, -65.0954, -46.7501], [84, -65.1035, -46.7509], [84.1, -65.1111, -46.7517], [84.2, -65.1183, -46.7525], [84.3, -65.1252, -46.7533], [84.4, -65.1317, -46.7542], [84.5, -65.1378, -46.755], [84.6, -65.1435, -46.7558], [84.7, -65.1488, -46.7566], [84.8, -65.1538, -46.7574], [84.9, -65.1584, -46.7582], [85, -65.1627, -46.7591], [85.1, -65.1665, -46.7599], [85.2, -65.17, -46.7607], [85.3, -65.1732, -46.7615], [85.4, -65.176, -46.7624], [85.5, -65.1784, -46.7632], [85.6, -65.1805, -46.764], [85.7, -65.1822, -46.7648], [85.8, -65.1836, -46.7657], [85.9, -65.1846, -46.7665], [86, -65.1853, -46.7673], [86.1, -65.1856, -46.7681], [86.2, -65.1856, -46.769], [86.3, -65.1852, -46.7698], [86.4, -65.1846, -46.7706], [86.5, -65.1835, -46.7714], [86.6, -65.1822, -46.7723], [86.7, -65.1805, -46.7731], [86.8, -65.1785, -46.7739], [86.9, -65.1762, -46.7747], [87, -65.1735, -46.7755], [87.1, -65.1705, -46.7763], [87.2, -65.1672, -46.7771], [87.3, -65.1636, -46.7779], [87.4, -65.1596, -46.7787], [87.5, -65.1554, -46.7795], [87.6, -65.1508, -46.7803], [87.7, -65.1459, -46.7811], [87.8, -65.1408, -46.7819], [87.9, -65.1353, -46.7827], [88, -65.1295, -46.7835], [88.1, -65.1234, -46.7843], [88.2, -65.117, -46.785], [88.3, -65.1103, -46.7858], [88.4, -65.1033, -46.7866], [88.5, -65.096, -46.7873], [88.6, -65.0885, -46.7881], [88.7, -65.0806, -46.7889], [88.8, -65.0724, -46.7896], [88.9, -65.064, -46.7903], [89, -65.0553, -46.7911], [89.1, -65.0463, -46.7918], [89.2, -65.037, -46.7926], [89.3, -65.0274, -46.7933], [89.4, -65.0176, -46.794], [89.5, -65.0075, -46.7947], [89.6, -64.9971, -46.7954], [89.7, -64.9864, -46.7961], [89.8, -64.9755, -46.7968], [89.9, -64.9643, -46.7975], [90, -64.9529, -46.7982], [90.1, -64.9411, -46.7988], [90.2, -64.9292, -46.7995], [90.3, -64.9169, -46.8002], [90.4, -64.9044, -46.8008], [90.5, -64.8917, -46.8015], [90.6, -64.8787, -46.8021], [90.7, -64.8654, -46.8028], [90.8, -64.8519, -46.8034], [90.9, -64.8381, -46.804], [91, -64.8241, -46.8046], [91.1, -64.8099, -46.8052], [91.2, -64.7954, -46.8058], [91.3, -64.7806, -46.8064], [91.4, -64.7657, -46.807], [91.5, -64.7504, -46.8076], [91.6, -64.735, -46.8081], [91.7, -64.7193, -46.8087], [91.8, -64.7034, -46.8092], [91.9, -64.6872, -46.8098], [92, -64.6709, -46.8103], [92.1, -64.6543, -46.8108], [92.2, -64.6374, -46.8113], [92.3, -64.6204, -46.8118], [92.4, -64.6031, -46.8123], [92.5, -64.5856, -46.8128], [92.6, -64.5679, -46.8133], [92.7, -64.5499, -46.8137], [92.8, -64.5318, -46.8142], [92.9, -64.5134, -46.8146], [93, -64.4948, -46.8151], [93.1, -64.476, -46.8155], [93.2, -64.457, -46.8159], [93.3, -64.4378, -46.8163], [93.4, -64.4184, -46.8167], [93.5, -64.3988, -46.8171], [93.6, -64.379, -46.8175], [93.7, -64.3589, -46.8179], [93.8, -64.3387, -46.8182], [93.9, -64.3183, -46.8186], [94, -64.2977, -46.8189], [94.1, -64.2768, -46.8192], [94.2, -64.2558, -46.8195], [94.3, -64.2346, -46.8198], [94.4, -64.2132, -46.8201], [94.5, -64.1917, -46.8204], [94.6, -64.1699, -46.8207], [94.7, -64.1479, -46.8209], [94.8, -64.1258, -46.8212], [94.9, -64.1034, -46.8214], [95, -64.0809, -46.8217], [95.1, -64.0582, -46.8219], [95.2, -64.0354, -46.8221], [95.3, -64.0123, -46.8223], [95.4, -63.9891, -46.8224], [95.5, -63.9657, -46.8226], [95.6, -63.9421, -46.8228], [95.7, -63.9184, -46.8229], [95.8, -63.8945, -46.823], [95.9, -63.8704, -46.8231], [96, -63.8461, -46.8233], [96.1, -63.8217, -46.8233], [96.2, -63.7971, -46.8234], [96.3, -63.7724, -46.8235], [96.4, -63.7475, -46.8236], [96.5, -63.7224, -46.8236], [96.6, -63.6972, -46.8236], [96.7, -63.6718, -46.8236], [96.8, -63.6462, -46.8237], [96.9, -63.6205, -46.8236], [97, -63.5947, -46.8236], [97.1, -63.5687, -46.8236], [97.2, -63.5425, -46.8235], [97.3, -63.5162, -46.8235], [97.4, -63.4897, -46.8234], [97.5, -63.4631, -46.8233], [97.6, -63.4364, -46.8232], [97.7, -63.4095, -46.8231], [97.8, -63.3824, -46.823], [97.9, -63.3552, -46.8229], [98, -63.3279, -46.8227], [98.1, -63.3004, -46.8225], [98.2, -63.2728, -46.8224], [98.3, -63.2451, -46.8222], [98.4, -63.2172, -46.822], [98.5, -63.1892, -46.8217], [98.6, -63.161, -46.8215], [98.7, -63.1327, -46.8213], [98.8, -63.1043, -46.821], [98.9, -63.0757, -46.8207], [99, -63.0471, -46.8204], [99.1, -63.0183, -46.8201], [99.2, -62.9893, -46.8198], [99.3, -62.9603, -46.8195], [99.4, -62.9311, -46.8191], [99.5, -62.9018, -46.8188], [99.6, -62.8723, -46.8184], [99.7, -62.8428, -46.818], [99.8, -62.8131, -46.8176], [99.9, -62.7833, -46.8172], [100, -62.7534, -46.8167], [100.1, -62.7234, -46.8163], [100.2, -62.6932, -46.8158], [100.3, -62.663, -46.8154], [100.4, -62.6326, -46.8149], [100.5, -62.6021, -46.8144], [100.6, -62.5715, -46.8138], [100.7, -62.5408, -46.8133], [100.8, -62.51, -46.8128], [100.9, -62.4791, -46.8122], [101, -62.448, -46.8116], [101.1, -62.4169, -46.811], [101.2, -62.3856, -46.8104], [101.3, -62.3543, -46.8098], [101.4, -62.3228, -46.8091], [101.5, -62.2913, -46.8085], [101.6, -62.2596, -46.8078], [101.7, -62.2279, -46.8071], [101.8, -62.196, -46.8064], [101.9, -62.1641, -46.8057], [102, -62.132, -46.805], [102.1, -62.0999, -46.8042], [102.2, -62.0676, -46.8035], [102.3, -62.0353, -46.8027], [102.4, -62.0029, -46.8019], [102.5, -61.9703, -46.8011], [102.6, -61.9377, -46.8003], [102.7, -61.905, -46.7994], [102.8, -61.8722, -46.7986], [102.9, -61.8393, -46.7977], [103, -61.8064, -46.7968], [103.1, -61.7733, -46.7959], [103.2, -61.7402, -46.795], [103.3, -61.707, -46.7941], [103.4, -61.6736, -46.7931], [103.5, -61.6403, -46.7922], [103.6, -61.6068, -46.7912], [103.7, -61.5732, -46.7902], [103.8, -61.5396, -46.7892], [103.9, -61.5059, -46.7881], [104, -61.4721, -46.7871], [104.1, -61.4382, -46.786], [104.2, -61.4043, -46.785], [104.3, -61.3702, -46.7839], [104.4, -61.3361, -46.7828], [104.5, -61.302, -46.7816], [104.6, -61.2677, -46.7805], [104.7, -61.2334, -46.7794], [104.8, -61.199, -46.7782], [104.9, -61.1646, -46.777], [105, -61.13, -46.7758], [105.1, -61.0954, -46.7746], [105.2, -61.0608, -46.7733], [105.3, -61.026, -46.7721], [105.4, -60.9912, -46.7708], [105.5, -60.9563, -46.7695], [105.6, -60.9214, -46.7682], [105.7, -60.8864, -46.7669], [105.8, -60.8514, -46.7656], [105.9, -60.8162, -46.7642], [106, -60.781, -46.7629], [106.1, -60.7458, -46.7615], [106.2, -60.7105, -46.7601], [106.3, -60.6751, -46.7587], [106.4, -60.6397, -46.7573], [106.5, -60.6042, -46.7558], [106.6, -60.5687, -46.7544], [106.7, -60.5331, -46.7529], [106.8, -60.4974, -46.7514], [106.9, -60.4617, -46.7499], [107, -60.426, -46.7483], [107.1, -60.3902, -46.7468], [107.2, -60.3543, -46.7452], [107.3, -60.3184, -46.7437], [107.4, -60.2824, -46.7421], [107.5, -60.2464, -46.7405], [107.6, -60.2103, -46.7388], [107.7, -60.1742, -46.7372], [107.8, -60.138, -46.7355], [107.9, -60.1018, -46.7339], [108, -60.0655, -46.7322], [108.1, -60.0292, -46.7305], [108.2, -59.9929, -46.7287], [108.3, -59.9565, -46.727], [108.4, -59.92, -46.7252], [108.5, -59.8835, -46.7235], [108.6, -59.847, -46.7217], [108.7, -59.8104, -46.7199], [108.8, -59.7738, -46.718], [108.9, -59.7371, -46.7162], [109, -59.7004, -46.7144], [109.1, -59.6637, -46.7125], [109.2, -59.6269, -46.7106], [109.3, -59.5901, -46.7087], [109.4, -59.5532, -46.7068], [109.5, -59.5163, -46.7048], [109.6, -59.4794, -46.7029], [109.7, -59.4425, -46.7009], [109.8, -59.4055, -46.6989], [109.9, -59.3684, -46.6969], [110, -59.3313, -46.6949], [110.1, -59.2942, -46.6928], [110.2, -59.2571, -46.6908], [110.3, -59.2199, -46.6887], [110.4, -59.1827, -46.6866], [110.5, -59.1455, -46.6845], [110.6, -59.1082, -46.6824], [110.7, -59.0709, -46.6803], [110.8, -59.0336, -46.6781], [110.9, -58.9963, -46.676], [111, -58.9589, -46.6738], [111.1, -58.9215, -46.6716], [111.2, -58.8841, -46.6693], [111.3, -58.8466, -46.6671], [111.4, -58.8091, -46.6649], [111.5, -58.7716, -46.6626], [111.6, -58.7341, -46.6603], [111.7, -58.6965, -46.658], [111.8, -58.6589, -46.6557], [111.9, -58.6213, -46.6534], [112, -58.5837, -46.651], [112.1, -58.546, -46.6486], [112.2, -58.5083, -46.6462], [112.3, -58.4706, -46.6438], [112.4, -58.4329, -46.6414], [112.5, -58.3952, -46.639], [112.6, -58.3574, -46.6365], [112.7, -58.3197, -46.6341], [112.8, -58.2819, -46.6316], [112.9, -58.244, -46.6291], [113, -58.2062, -46.6266], [113.1, -58.1684, -46.6241], [113.2, -58.1305, -46.6215], [113.3, -58.0926, -46.6189], [113.4, -58.0547, -46.6164], [113.5, -58.0168, -46.6138], [113.6, -57.9789, -46.6112], [113.7, -57.9409, -46.6085], [113.8, -57.903, -46.6059], [113.9, -57.865, -46.6032], [114, -57.827, -46.6005], [114.1, -57.789, -46.5978], [114.2, -57.751, -46.5951], [114.3, -57.713, -46.5924], [114.4, -57.675, -46.5897], [114.5, -57.637, -46.5869], [114.6, -57.5989, -46.5841], [114.7, -57.5609, -46.5813], [114.8, -57.5228, -46.5785], [114.9, -57.4847, -46.5757], [115, -57.4466, -46.5728], [115.1, -57.4085, -46.57], [115.2, -57.3704, -46.5671], [115.3, -57.3323, -46.5642], [115.4, -57.2942, -46.5613], [115.5, -57.2561, -46.5584], [115.6, -57.218, -46.5555], [115.7, -57.1799, -46.5525], [115.8, -57.1417, -46.5495], [115.9, -57.1036, -46.5465], [116, -57.0654, -46.5435], [116.1, -57.0273, -46.5405], [116.2, -56.9891, -46.5375], [116.3, -56.951, -46.5344], [116.4, -56.9128, -46.5314], [116.5, -56.8747, -46.5283], [116.6, -56.8365, -46.5252], [116.7, -56.7984, -46.5221], [116.8, -56.7602, -46.5189], [116.9, -56.722, -46.5158], [117, -56.6839, -46.5126], [117.1, -56.6457, -46.5095], [117.2, -56.6076, -46.5063], [117.3, -56.5694, -46.5031], [117.4, -56.5313, -46.4998], [117.5, -56.4931, -46.4966], [117.6, -56.4549, -46.4933], [117.7, -56.4168, -46.4901], [117.8, -56.3786, -46.4868], [117.9, -56.3405, -46.4835], [118, -56.3024, -46.4801], [118.1, -56.2642, -46.4768], [118.2, -56.2261, -46.4734], [118.3, -56.188, -46.4701], [118.4, -56.1498, -46.4667], [118.5, -56.1117, -46.4633], [118.6, -56.0736, -46.4599], [118.7, -56.0355, -46.4565], [118.8, -55.9974, -46.453], [118.9, -55.9593, -46.4495], [119, -55.9212, -46.4461], [119.1, -55.8831, -46.4426], [119.2, -55.8451, -46.4391], [119.3, -55.807, -46.4355], [119.4, -55.769, -46.432], [119.5, -55.7309, -46.4284], [119.6, -55.6929, -46.4249], [119.7, -55.6549, -46.4213], [119.8, -55.6168, -46.4177], [119.9, -55.5788, -46.4141], [120, -55.5408, -46.4104], [120.1, -55.5028, -46.4068], [120.2, -55.4649, -46.4031], [120.3, -55.4269, -46.3994], [120.4, -55.389, -46.3958], [120.5, -55.351, -46.392], [120.6, -55.3131, -46.3883], [120.7, -55.2752, -46.3846], [120.8, -55.2373, -46.3808], [120.9, -55.1994, -46.3771], [121, -55.1615, -46.3733], [121.1, -55.1236, -46.3695], [121.2, -55.0858, -46.3657], [121.3, -55.0479, -46.3618], [121.4, -55.0101, -46.358], [121.5, -54.9723, -46.3541], [121.6, -54.9345, -46.3502], [121.7, -54.8967, -46.3464], [121.8, -54.859, -46.3424], [121.9, -54.8212, -46.3385], [122, -54.7835, -46.3346], [122.1, -54.7458, -46.3306], [122.2, -54.7081, -46.3267], [122.3, -54.6704, -46.3227], [122.4, -54.6327, -46.3187], [122.5, -54.5951, -46.3147], [122.6, -54.5575, -46.3107], [122.7, -54.5198, -46.3066], [122.8, -54.4823, -46.3026], [122.9, -54.4447, -46.2985], [123, -54.4071, -46.2944], [123.1, -54.3696, -46.2903], [123.2, -54.3321, -46.2862], [123.3, -54.2946, -46.2821], [123.4, -54.2571, -46.2779], [123.5, -54.2196, -46.2738], [123.6, -54.1822, -46.2696], [123.7, -54.1448, -46.2654], [123.8, -54.1074, -46.2612], [123.9, -54.07, -46.257], [124, -54.0326, -46.2528], [124.1, -53.9953, -46.2485], [124.2, -53.958, -46.2443], [124.3, -53.9207, -46.24], [124.4, -53.8834, -46.2357], [124.5, -53.8461, -46.2314], [124.6, -53.8089, -46.2271], [124.7, -53.7717, -46.2228], [124.8, -53.7345, -46.2184], [124.9, -53.6974, -46.2141], [125, -53.6602, -46.2097], [125.1, -53.6231, -46.2053], [125.2, -53.586, -46.2009], [125.3, -53.549, -46.1965], [125.4, -53.5119, -46.1921], [125.5, -53.4749, -46.1876], [125.6, -53.4379, -46.1832], [125.7, -53.4009, -46.1787], [125.8, -53.364, -46.1742], [125.9, -53.3271, -46.1697], [126, -53.2902, -46.1652], [126.1, -53.2533, -46.1607], [126.2, -53.2165, -46.1561], [126.3, -53.1796, -46.1516], [126.4, -53.1428, -46.147], [126.5, -53.1061, -46.1424], [126.6, -53.0693, -46.1378], [126.7, -53.0326, -46.1332], [126.8, -52.9959, -46.1286], [126.9, -52.9593, -46.124], [127, -52.9226, -46.1193], [127.1, -52.886, -46.1146], [127.2, -52.8495, -46.11], [127.3, -52.8129, -46.1053], [127.4, -52.7764, -46.1006], [127.5, -52.7399, -46.0958], [127.6, -52.7034, -46.0911], [127.7, -52.667, -46.0864], [127.8, -52.6306, -46.0816], [127.9, -52.5942, -46.0768], [128, -52.5578, -46.072], [128.1, -52.5215, -46.0672], [128.2, -52.4852, -46.0624], [128.3, -52.4489, -46.0576], [128.4, -52.4127, -46.0528], [128.5, -52.3765, -46.0479], [128.6, -52.3403, -46.0431], [128.7, -52.3041, -46.0382], [128.8, -52.268, -46.0333], [128.9, -52.2319, -46.0284], [129, -52.1959, -46.0235], [129.1, -52.1598, -46.0185], [129.2, -52.1238, -46.0136], [129.3, -52.0879, -46.0086], [129.4, -52.0519, -46.0036], [129.5, -52.016, -45.9987], [129.6, -51.9802, -45.9937], [129.7, -51.9443, -45.9887], [129.8, -51.9085, -45.9836], [129.9, -51.8727, -45.9786], [130, -51.837, -45.9735], [130.1, -51.8012, -45.9685], [130.2, -51.7656, -45.9634], [130.3, -51.7299, -45.9583], [130.4, -51.6943, -45.9532], [130.5, -51.6587, -45.9481], [130.6, -51.6231, -45.943], [130.7, -51.5876, -45.9379], [130.8, -51.5521, -45.9327], [130.9, -51.5167, -45.9275], [131, -51.4812, -45.9224], [131.1, -51.4458, -45.9172], [131.2, -51.4105, -45.912], [131.3, -51.3752, -45.9068], [131.4, -51.3399, -45.9015], [131.5, -51.3046, -45.8963], [131.6, -51.2694, -45.891], [131.7, -51.2342, -45.8858], [131.8, -51.199, -45.8805], [131.9, -51.1639, -45.8752], [132, -51.1288, -45.8699], [132.1, -51.0937, -45.8646], [132.2, -51.0587, -45.8593], [132.3, -51.0237, -45.854], [132.4, -50.9888, -45.8486], [132.5, -50.9539, -45.8432], [132.6, -50.919, -45.8379], [132.7, -50.8841, -45.8325], [132.8, -50.8493, -45.8271], [132.9, -50.8145, -45.8217], [133, -50.7798, -45.8163], [133.1, -50.7451, -45.8108], [133.2, -50.7104, -45.8054], [133.3, -50.6758, -45.7999], [133.4, -50.6412, -45.7945], [133.5, -50.6066, -45.789], [133.6, -50.5721, -45.7835], [133.7, -50.5376, -45.778], [133.8, -50.5031, -45.7725], [133.9, -50.4687, -45.7669], [134, -50.4343, -45.7614], [134.1, -50.4, -45.7559], [134.2, -50.3657, -45.7503], [134.3, -50.3314, -45.7447], [134.4, -50.2971, -45.7391], [134.5, -50.2629, -45.7335], [134.6, -50.2288, -45.7279], [134.7, -50.1946, -45.7223], [134.8, -50.1605, -45.7167], [134.9, -50.1265, -45.711], [135, -50.0925, -45.7054], [135.1, -50.0585, -45.6997], [135.2, -50.0245, -45.694], [135.3, -49.9906, -45.6884], [135.4, -49.9568, -45.6827], [135.5, -49.9229, -45.6769], [135.6, -49.8891, -45.6712], [135.7, -49.8554, -45.6655], [135.8, -49.8216, -45.6598], [135.9, -49.788, -45.654], [136, -49.7543, -45.6482], [136.1, -49.7207, -45.6425], [136.2, -49.6871, -45.6367], [136.3, -49.6536, -45.6309], [136.4, -49.6201, -45.6251], [136.5, -49.5867, -45.6192], [136.6, -49.5532, -45.6134], [136.7, -49.5199, -45.6076], [136.8, -49.4865, -45.6017], [136.9, -49.4532, -45.5958], [137, -49.42, -45.59], [137.1, -49.3867, -45.5841], [137.2, -49.3535, -45.5782], [137.3, -49.3204, -45.5723], [137.4, -49.2873, -45.5664], [137.5, -49.2542, -45.5604], [137.6, -49.2212, -45.5545], [137.7, -49.1882, -45.5486], [137.8, -49.1552, -45.5426], [137.9, -49.1223, -45.5366], [138, -49.0894, -45.5306], [138.1, -49.0566, -45.5247], [138.2, -49.0238, -45.5186], [138.3, -48.991, -45.5126], [138.4, -48.9583, -45.5066], [138.5, -48.9256, -45.5006], [138.6, -48.893, -45.4945], [138.7, -48.8604, -45.4885], [138.8, -48.8278, -45.4824], [138.9, -48.7953, -45.4763], [139, -48.7628, -45.4703], [139.1, -48.7304, -45.4642], [139.2, -48.698, -45.4581], [139.3, -48.6656, -45.452], [139.4, -48.6333, -45.4458], [139.5, -48.601, -45.4397], [139.6, -48.5688, -45.4336], [139.7, -48.5366, -45.4274], [139.8, -48.5044, -45.4212], [139.9, -48.4723, -45.4151], [140, -48.4402, -45.4089], [140.1, -48.4082, -45.4027], [140.2, -48.3761, -45.3965], [140.3, -48.3442, -45.3903], [140.4, -48.3123, -45.384], [140.5, -48.2804, -45.3778], [140.6, -48.2485, -45.3716], [140.7, -48.2167, -45.3653], [140.8, -48.185, -45.3591], [140.9, -48.1532, -45.3528], [141, -48.1216, -45.3465], [141.1, -48.0899, -45.3402], [141.2, -48.0583, -45.3339], [141.3, -48.0268, -45.3276], [141.4, -47.9952, -45.3213], [141.5, -47.9638, -45.315], [141.6, -47.9323, -45.3086], [141.7, -47.9009, -45.3023], [141.8, -47.8696, -45.2959], [141.9, -47.8382, -45.2895], [142, -47.807, -45.2832], [142.1, -47.7757, -45.2768], [142.2, -47.7445, -45.2704], [142.3, -47.7134, -45.264], [142.4, -47.6823, -45.2576], [142.5, -47.6512, -45.2512], [142.6, -47.6202, -45.2447], [142.7, -47.5892, -45.2383], [142.8, -47.5582, -45.2318], [142.9, -47.5273, -45.2254], [143, -47.4964, -45.2189], [143.1, -47.4656, -45.2124], [143.2, -47.4348, -45.206], [143.3, -47.4041, -45.1995], [143.4, -47.3734, -45.193], [143.5, -47.3427, -45.1865], [143.6, -47.3121, -45.1799], [143.7, -47.2815, -45.1734], [143.8, -47.251, -45.1669], [143.9, -47.2205, -45.1603], [144, -47.19, -45.1538], [144.1, -47.1596, -45.1472], [144.2, -47.1292, -45.1406], [144.3, -47.0989, -45.1341], [144.4, -47.0686, -45.1275], [144.5, -47.0383, -45.1209], [144.6, -47.0081, -45.1143], [144.7, -46.978, -45.1076], [144.8, -46.9478, -45.101], [144.9, -46.9177, -45.0944], [145, -46.8877, -45.0878], [145.1, -46.8577, -45.0811], [145.2, -46.8277, -45.0744], [145.3, -46.7978, -45.0678], [145.4, -46.7679, -45.0611], [145.5, -46.7381, -45.0544], [145.6, -46.7083, -45.0477], [145.7, -46.6785, -45.041], [145.8, -46.6488, -45.0343], [145.9, -46.6192, -45.0276], [146, -46.5895, -45.0209], [146.1, -46.5599, -45.0142], [146.2, -46.5304, -45.0074], [146.3, -46.5009, -45.0007], [146.4, -46.4714, -44.9939], [146.5, -46.442, -44.9872], [146.6, -46.4126, -44.9804], [146.7, -46.3833, -44.9736], [146.8, -46.354, -44.9668], [146.9, -46.3247, -44.96], [147, -46.2955, -44.9532], [147.1, -46.2663, -44.9464], [147.2, -46.2372, -44.9396], [147.3, -46.2081, -44.9328], [147.4, -46.179, -44.926], [147.5, -46.15, -44.9191], [147.6, -46.121, -44.9123], [147.7, -46.0921, -44.9054], [147.8, -46.0632, -44.8985], [147.9, -46.0344, -44.8917], [148, -46.0056, -44.8848], [148.1, -45.9768, -44.8779], [148.2, -45.9481, -44.871], [148.3, -45.9194, -44.8641], [148.4, -45.8908, -44.8572], [148.5, -45.8622, -44.8503], [148.6, -45.8336, -44.8434], [148.7, -45.8051, -44.8364], [148.8, -45.7766, -44.8295], [148.9, -45.7482, -44.8226], [149, -45.7198, -44.8156], [149.1, -45.6915, -44.8086], [149.2, -45.6632, -44.8017], [149.3, -45.6349, -44.7947], [149.4, -45.6067, -44.7877], [149.5, -45.5785, -44.7807], [149.6, -45.5503, -44.7737], [149.7, -45.5222, -44.7667], [149.8, -45.4942, -44.7597], [149.9, -45.4662, -44.7527], [150, -45.4382, -44.7457], [150.1, -45.4103, -44.7387], [150.2, -45.3824, -44.7316], [150.3, -45.3545, -44.7246], [150.4, -45.3267, -44.7175], [150.5, -45.2989, -44.7105], [150.6, -45.2712, -44.7034], [150.7, -45.2435, -44.6963], [150.8, -45.2159, -44.6893], [150.9, -45.1883, -44.6822], [151, -45.1607, -44.6751], [151.1, -45.1332, -44.668], [151.2, -45.1057, -44.6609], [151.3, -45.0783, -44.6538], [151.4, -45.0509, -44.6467], [151.5, -45.0235, -44.6395], [151.6, -44.9962, -44.6324], [151.7, -44.9689, -44.6253], [151.8, -44.9417, -44.6181], [151.9, -44.9145, -44.611], [152, -44.8873, -44.6038], [152.1, -44.8602, -44.5966], [152.2, -44.8331, -44.5895], [152.3, -44.8061, -44.5823], [152.4, -44.7791, -44.5751], [152.5, -44.7522, -44.5679], [152.6, -44.7253, -44.5607], [152.7, -44.6984, -44.5535], [152.8, -44.6716, -44.5463], [152.9, -44.6448, -44.5391], [153, -44.6181, -44.5319], [153.1, -44.5914, -44.5247], [153.2, -44.5647, -44.5174], [153.3, -44.5381, -44.5102], [153.4, -44.5115, -44.5029], [153.5, -70, -44.4957], [153.6, -68.9185, -44.5009], [153.7, -67.8618, -44.5056], [153.8, -66.8293, -44.5098], [153.9, -65.8205, -44.5134], [154, -64.835, -44.5166], [154.1, -63.8722, -44.5192], [154.2, -62.9317, -44.5214], [154.3, -62.013, -44.5231], [154.4, -61.1157, -44.5244], [154.5, -60.2393, -44.5252], [154.6, -59.3835, -44.5256], [154.7, -58.5477, -44.5255], [154.8, -57.7315, -44.5251], [154.9, -56.9346, -44.5242], [155, -56.1565, -44.5229], [155.1, -55.3969, -44.5213], [155.2, -54.6554, -44.5193], [155.3, -53.9315, -44.5169], [155.4, -53.225, -44.5142], [155.5, -52.5354, -44.5111], [155.6, -51.8625, -44.5077], [155.7, -51.2058, -44.504], [155.8, -50.565, -44.4999], [155.9, -49.9398, -44.4955], [156, -49.3299, -44.4909], [156.1, -48.7349, -44.4859], [156.2, -48.1545, -44.4806], [156.3, -47.5885, -44.4751], [156.4, -47.0365, -44.4693], [156.5, -46.4982, -44.4632], [156.6, -45.9733, -44.4568], [156.7, -45.4616, -44.4502], [156.8, -44.9627, -44.4434], [156.9, -44.4765, -44.4363], [157, -70, -44.429], [157.1, -68.9712, -44.4343], [157.2, -67.9668, -44.4391], [157.3, -66.9862, -44.4434], [157.4, -66.0289, -44.4472], [157.5, -65.0946, -44.4505], [157.6, -64.1827, -44.4534], [157.7, -63.2926, -44.4558], [157.8, -62.4241, -44.4578], [157.9, -61.5765, -44.4593], [158, -60.7496, -44.4604], [158.1, -59.9428, -44.4611], [158.2, -59.1557, -44.4614], [158.3, -58.3879, -44.4614], [158.4, -57.639, -44.4609], [158.5, -56.9086, -44.4601], [158.6, -56.1964, -44.4589], [158.7, -55.5018, -44.4574], [158.8, -54.8247, -44.4555], [158.9, -54.1645, -44.4533], [159, -53.5209, -44.4507], [159.1, -52.8936, -44.4479], [159.2, -52.2823, -44.4447], [159.3, -51.6865, -44.4413], [159.4, -51.106, -44.4375], [159.5, -50.5405, -44.4335], [159.6, -49.9895, -44.4292], [159.7, -49.4529, -44.4247], [159.8, -48.9303, -44.4198], [159.9, -48.4214, -44.4147], [160, -47.9258, -44.4094], [160.1, -47.4434, -44.4039], [160.2, -46.9739, -44.3981], [160.3, -46.5169, -44.392], [160.4, -46.0722, -44.3858], [160.5, -45.6395, -44.3793], [160.6, -45.2186, -44.3727], [160.7, -44.8092, -44.3658], [160.8, -44.4111, -44.3587], [160.9, -70, -44.3515], [161, -69.0191, -44.3569], [161.1, -68.0623, -44.3618], [161.2, -67.1289, -44.3662], [161.3, -66.2186, -44.3702], [161.4, -65.3309, -44.3737], [161.5, -64.4652, -44.3768], [161.6, -63.6211, -44.3794], [161.7, -62.7982, -44.3816], [161.8, -61.9959, -44.3835], [161.9, -61.2139, -44.3849], [162, -60.4518, -44.3859], [162.1, -59.709, -44.3866], [162.2, -58.9853, -44.3868], [162.3, -58.2801, -44.3868], [162.4, -57.5931, -44.3863], [162.5, -56.924, -44.3856], [162.6, -56.2722, -44.3845], [162.7, -55.6375, -44.3831], [162.8, -55.0195, -44.3814], [162.9, -54.4178, -44.3793], [163, -53.8321, -44.377], [163.1, -53.262, -44.3744], [163.2, -52.7072, -44.3715], [163.3, -52.1674, -44.3684], [163.4, -51.6422, -44.365], [163.5, -51.1314, -44.3613], [163.6, -50.6345, -44.3574], [163.7, -50.1514, -44.3532], [163.8, -49.6817, -44.3488], [163.9, -49.2251, -44.3442], [164, -48.7814, -44.3394], [164.1, -48.3502, -44.3343], [164.2, -47.9313, -44.329], [164.3, -47.5244, -44.3236], [164.4, -47.1292, -44.3179], [164.5, -46.7456, -44.3121], [164.6, -46.3731, -44.306], [164.7, -46.0117, -44.2998], [164.8, -45.661, -44.2935], [164.9, -45.3209, -44.2869], [165, -44.991, -44.2802], [165.1, -44.6712, -44.2733], [165.2, -44.3612, -44.2663], [165.3, -70, -44.2592], [165.4, -69.0615, -44.2647], [165.5, -68.1468, -44.2697], [165.6, -67.2553, -44.2743], [165.7, -66.3866, -44.2784], [165.8, -65.5401, -44.2821], [165.9, -64.7153, -44.2854], [166, -63.9119, -44.2882], [166.1, -63.1294, -44.2907], [166.2, -62.3672, -44.2928], [166.3, -61.6251, -44.2945], [166.4, -60.9025, -44.2958], [166.5, -60.199, -44.2968], [166.6, -59.5142, -44.2974], [166.7, -58.8477, -44.2977], [166.8, -58.1992, -44.2977], [166.9, -57.5681, -44.2973], [167, -56.9543, -44.2967], [167.1, -56.3572, -44.2957], [167.2, -55.7765, -44.2944], [167.3, -55.2119, -44.2929], [167.4, -54.663, -44.2911], [167.5, -54.1294, -44.289], [167.6, -53.6109, -44.2866], [167.7, -53.1071, -44.284], [167.8, -52.6177, -44.2811], [167.9, -52.1423, -44.2781], [168, -51.6807, -44.2747], [168.1, -51.2326, -44.2712], [168.2, -50.7976, -44.2674], [168.3, -50.3755, -44.2634], [168.4, -49.9659, -44.2593], [168.5, -49.5687, -44.2549], [168.6, -49.1835, -44.2503], [168.7, -48.8101, -44.2456], [168.8, -48.4482, -44.2406], [168.9, -48.0975, -44.2355], [169, -47.7578, -44.2303], [169.1, -47.4289, -44.2248], [169.2, -47.1105, -44.2193], [169.3, -46.8023, -44.2135], [169.4, -46.5042, -44.2076], [169.5, -46.2159, -44.2016], [169.6, -45.9372, -44.1954], [169.7, -45.6679, -44.1891], [169.8, -45.4077, -44.1827], [169.9, -45.1565, -44.1762], [170, -44.9141, -44.1695], [170.1, -44.6801, -44.1628], [170.2, -44.4546, -44.1559], [170.3, -44.2372, -44.1489], [170.4, -70, -44.1418], [170.5, -69.0972, -44.1475], [170.6, -68.2179, -44.1526], [170.7, -67.3616, -44.1574], [170.8, -66.5278, -44.1617], [170.9, -65.716, -44.1656], [171, -64.9258, -44.1691], [171.1, -64.1566, -44.1722], [171.2, -63.408, -44.1749], [171.3, -62.6796, -44.1772], [171.4, -61.9709, -44.1792], [171.5, -61.2815, -44.1808], [171.6, -60.6111, -44.1821], [171.7, -59.9591, -44.1831], [171.8, -59.3252, -44.1837], [171.9, -58.7089, -44.184], [172, -58.11, -44.1841], [172.1, -57.528, -44.1838], [172.2, -56.9625, -44.1832], [172.3, -56.4133, -44.1824], [172.4, -55.8798, -44.1813], [172.5, -55.3619, -44.1799], [172.6, -54.8591, -44.1783], [172.7, -54.3711, -44.1764], [172.8, -53.8976, -44.1743], [172.9, -53.4382, -44.1719], [173, -52.9927, -44.1694], [173.1, -52.5607, -44.1666], [173.2, -52.142, -44.1636], [173.3, -51.7363, -44.1604], [173.4, -51.3431, -44.157], [173.5, -50.9624, -44.1534], [173.6, -50.5937, -44.1497], [173.7, -50.2369, -44.1457], [173.8, -49.8916, -44.1416], [173.9, -49.5577, -44.1373], [174, -49.2347, -44.1329], [174.1, -48.9226, -44.1283], [174.2, -48.621, -44.1236], [174.3, -48.3297, -44.1187], [174.4, -48.0485, -44.1137], [174.5, -47.7771, -44.1085], [174.6, -47.5153, -44.1032], [174.7, -47.263, -44.0978], [174.8, -47.0198, -44.0923], [174.9, -46.7856, -44.0866], [175, -46.5601, -44.0809], [175.1, -46.3432, -44.075], [175.2, -46.1346, -44.0691], [175.3, -45.9342, -44.063], [175.4, -45.7418, -44.0569], [175.5, -45.5572, -44.0507], [175.6, -45.3801, -44.0444], [175.7, -45.2105, -44.038], [175.8, -45.0482, -44.0315], [175.9, -44.8929, -44.0249], [176, -44.7445, -44.0183], [176.1, -44.6028, -44.0117], [176.2, -44.4677, -44.0049], [176.3, -44.3391, -43.9981], [176.4, -44.2167, -43.9913], [176.5, -44.1004, -43.9843], [176.6, -43.9901, -43.9774], [176.7, -70, -43.9704], [176.8, -69.1234, -43.9762], [176.9, -68.27, -43.9816], [177, -67.4395, -43.9865], [177.1, -66.6313, -43.991], [177.2, -65.8449, -43.9951], [177.3, -65.0799, -43.9989], [177.4, -64.3358, -44.0022], [177.5, -63.6121, -44.0052], [177.6, -62.9084, -44.0078], [177.7, -62.2242, -44.0101], [177.8, -61.5592, -44.012], [177.9, -60.9129, -44.0136], [178, -60.285, -44.0149], [178.1, -59.6749, -44.0159], [178.2, -59.0823, -44.0166], [178.3, -58.5069, -44.0169], [178.4, -57.9482, -44.017], [178.5, -57.406, -44.0169], [178.6, -56.8797, -44.0164], [178.7, -56.3691, -44.0157], [178.8, -55.8738, -44.0147], [178.9, -55.3935, -44.0135], [179, -54.9279, -44.0121], [179.1, -54.4766, -44.0104], [179.2, -54.0392, -44.0086], [179.3, -53.6156, -44.0065], [179.4, -53.2054, -44.0042], [179.5, -52.8082, -44.0017], [179.6, -52.4238, -43.999], [179.7, -52.0519, -43.9961], [179.8, -51.6923, -43.993], [179.9, -51.3445, -43.9898], [180, -51.0085, -43.9864], [180.1, -50.6838, -43.9828], [180.2, -50.3703, -43.9791], [180.3, -50.0677, -43.9752], [180.4, -49.7758, -43.9712], [180.5, -49.4942, -43.9671], [180.6, -49.2228, -43.9628], [180.7, -48.9613, -43.9584], [180.8, -48.7095, -43.9538], [180.9, -48.4672, -43.9492], [181, -48.2341, -43.9444], [181.1, -48.01, -43.9395], [181.2, -47.7948, -43.9345], [181.3, -47.5882, -43.9294], [181.4, -47.39, -43.9243], [181.5, -47.2, -43.919], [181.6, -47.0181, -43.9136], [181.7, -46.8439, -43.9082], [181.8, -46.6775, -43.9027], [181.9, -46.5184, -43.8971], [182, -46.3667, -43.8914], [182.1, -46.2221, -43.8856], [182.2, -46.0844, -43.8798], [182.3, -45.9535, -43.874], [182.4, -45.8292, -43.868], [182.5, -45.7113, -43.8621], [182.6, -45.5997, -43.856], [182.7, -45.4943, -43.8499], [182.8, -45.3948, -43.8438], [182.9, -45.3012, -43.8377], [183, -45.2133, -43.8314], [183.1, -45.1309, -43.8252], [183.2, -45.0539, -43.8189], [183.3, -44.9822, -43.8126], [183.4, -44.9157, -43.8063], [183.5, -44.8541, -43.7999], [183.6, -44.7975, -43.7935], [183.7, -44.7456, -43.7871], [183.8, -44.6983, -43.7807], [183.9, -44.6556, -43.7743], [184, -44.6172, -43.7678], [184.1, -44.5832, -43.7613], [184.2, -44.5533, -43.7549], [184.3, -44.5275, -43.7484], [184.4, -44.5057, -43.7419], [184.5, -44.4877, -43.7354], [184.6, -44.4734, -43.7289], [184.7, -44.4628, -43.7224], [184.8, -44.4558, -43.7159], [184.9, -44.4522, -43.7095], [185, -44.4519, -43.703], [185.1, -44.455, -43.6965], [185.2, -44.4612, -43.69], [185.3, -44.4705, -43.6836], [185.4, -44.4828, -43.6771], [185.5, -44.498, -43.6707], [185.6, -44.5161, -43.6643], [185.7, -44.5369, -43.6579], [185.8, -44.5604, -43.6515], [185.9, -44.5864, -43.6452], [186, -44.6151, -43.6388], [186.1, -44.6461, -43.6325], [186.2, -44.6795, -43.6262], [186.3, -44.7153, -43.6199], [186.4, -44.7532, -43.6137], [186.5, -44.7934, -43.6074], [186.6, -44.8356, -43.6012], [186.7, -44.8799, -43.5951], [186.8, -44.9261, -43.5889], [186.9, -44.9742, -43.5828], [187, -45.0242, -43.5767], [187.1, -45.076, -43.5707], [187.2, -45.1295, -43.5647], [187.3, -45.1847, -43.5587], [187.4, -45.2415, -43.5527], [187.5, -45.2998, -43.5468], [187.6, -45.3597, -43.541], [187.7, -45.421, -43.5351], [187.8, -45.4838, -43.5293], [187.9, -45.5478, -43.5235], [188, -45.6132, -43.5178], [188.1, -45.6799, -43.5121], [188.2, -45.7478, -43.5065], [188.3, -45.8168, -43.5008], [188.4, -45.887, -43.4953], [188.5, -45.9582, -43.4897], [188.6, -46.0305, -43.4843], [188.7, -46.1037, -43.4788], [188.8, -46.178, -43.4734], [188.9, -46.2531, -43.468], [189, -46.3291, -43.4627], [189.1, -46.406, -43.4574], [189.2, -46.4837, -43.4522], [189.3, -46.5621, -43.447], [189.4, -46.6413, -43.4419], [189.5, -46.7211, -43.4368], [189.6, -46.8016, -43.4317], [189.7, -46.8828, -43.4267], [189.8, -46.9645, -43.4218], [189.9, -47.0469, -43.4168], [190, -47.1297, -43.412], [190.1, -47.2131, -43.4071], [190.2, -47.2969, -43.4024], [190.3, -47.3812, -43.3976], [190.4, -47.4659, -43.393], [190.5, -47.551, -43.3883], [190.6, -47.6365, -43.3837], [190.7, -47.7223, -43.3792], [190.8, -47.8084, -43.3747], [190.9, -47.8948, -43.3702], [191, -47.9815, -43.3658], [191.1, -48.0684, -43.3615], [191.2, -48.1555, -43.3572], [191.3, -48.2429, -43.3529], [191.4, -48.3304, -43.3487], [191.5, -48.4181, -43.3446], [191.6, -48.5059, -43.3405], [191.7, -48.5938, -43.3364], [191.8, -48.6818, -43.3324], [191.9, -48.7699, -43.3284], [192, -48.8581, -43.3245], [192.1, -48.9462, -43.3206], [192.2, -49.0345, -43.3168], [192.3, -49.1227, -43.313], [192.4, -49.2109, -43.3093], [192.5, -49.299, -43.3056], [192.6, -49.3871, -43.302], [192.7, -49.4752, -43.2984], [192.8, -49.5632, -43.2949], [192.9, -49.6511, -43.2914], [193, -49.7389, -43.2879], [193.1, -49.8265, -43.2845], [193.2, -49.914, -43.2812], [193.3, -50.0014, -43.2779], [193.4, -50.0886, -43.2746], [193.5, -50.1757, -43.2714], [193.6, -50.2626, -43.2683], [193.7, -50.3492, -43.2651], [193.8, -50.4357, -43.2621], [193.9, -50.5219, -43.2591], [194, -50.6079, -43.2561], [194.1, -50.6937, -43.2532], [194.2, -50.7792, -43.2503], [194.3, -50.8644, -43.2474], [194.4, -50.9494, -43.2446], [194.5, -51.0341, -43.2419], [194.6, -51.1185, -43.2392], [194.7, -51.2026, -43.2365], [194.8, -51.2864, -43.2339], [194.9, -51.3699, -43.2314], [195, -51.4531, -43.2288], [195.1, -51.5359, -43.2263], [195.2, -51.6184, -43.2239], [195.3, -51.7005, -43.2215], [195.4, -51.7823, -43.2192], [195.5, -51.8638, -43.2169], [195.6, -51.9448, -43.2146], [195.7, -52.0255, -43.2124], [195.8, -52.1058, -43.2102], [195.9, -52.1857, -43.2081], [196, -52.2652, -43.206], [196.1, -52.3443, -43.2039], [196.2, -52.4231, -43.2019], [196.3, -52.5014, -43.1999], [196.4, -52.5793, -43.198], [196.5, -52.6567, -43.1961], [196.6, -52.7338, -43.1943], [196.7, -52.8104, -43.1925], [196.8, -52.8866, -43.1907], [196.9, -52.9624, -43.189], [197, -53.0377, -43.1873], [197.1, -53.1125, -43.1856], [197.2, -53.1869, -43.184], [197.3, -53.2609, -43.1825], [197.4, -53.3344, -43.1809], [197.5, -53.4075, -43.1794], [197.6, -53.48, -43.178], [197.7, -53.5522, -43.1765], [197.8, -53.6238, -43.1752], [197.9, -53.695, -43.1738], [198, -53.7657, -43.1725], [198.1, -53.8359, -43.1712], [198.2, -53.9057, -43.17], [198.3, -53.9749, -43.1688], [198.4, -54.0437, -43.1676], [198.5, -54.112, -43.1665], [198.6, -54.1798, -43.1654], [198.7, -54.2471, -43.1644], [198.8, -54.314, -43.1633], [198.9, -54.3803, -43.1624], [199, -54.4461, -43.1614], [199.1, -54.5115, -43.1605], [199.2, -54.5763, -43.1596], [199.3, -54.6407, -43.1587], [199.4, -54.7045, -43.1579], [199.5, -54.7679, -43.1571], [199.6, -54.8307, -43.1564], [199.7, -54.8931, -43.1556], [199.8, -54.9549, -43.1549], [199.9, -55.0163, -43.1543], [200, -55.0771, -43.1537], [200.1, -55.1375, -43.1531], [200.2, -55.1973, -43.1525], [200.3, -55.2566, -43.1519], [200.4, -55.3154, -43.1514], [200.5, -55.3738, -43.151], [200.6, -55.4316, -43.1505], [200.7, -55.4889, -43.1501], [200.8, -55.5457, -43.1497], [200.9, -55.602, -43.1493], [201, -55.6577, -43.149], [201.1, -55.713, -43.1487], [201.2, -55.7678, -43.1484], [201.3, -55.8221, -43.1482], [201.4, -55.8758, -43.1479], [201.5, -55.9291, -43.1477], [201.6, -55.9818, -43.1476], [201.7, -56.0341, -43.1474], [201.8, -56.0858, -43.1473], [201.9, -56.1371, -43.1472], [202, -56.1878, -43.1472], [202.1, -56.2381, -43.1471], [202.2, -56.2878, -43.1471], [202.3, -56.337, -43.1471], [202.4, -56.3858, -43.1471], [202.5, -56.434, -43.1472], [202.6, -56.4818, -43.1473], [202.7, -56.529, -43.1474], [202.8, -56.5758, -43.1475], [202.9, -56.6221, -43.1477], [203, -56.6678, -43.1478], [203.1, -56.7131, -43.148], [203.2, -56.7579, -43.1483], [203.3, -56.8022, -43.1485], [203.4, -56.846, -43.1488], [203.5, -56.8893, -43.1491], [203.6, -56.9322, -43.1494], [203.7, -56.9745, -43.1497], [203.8, -57.0164, -43.15], [203.9, -57.0578, -43.1504], [204, -57.0987, -43.1508], [204.1, -57.1391, -43.1512], [204.2, -57.1791, -43.1516], [204.3, -57.2185, -43.1521], [204.4, -57.2575, -43.1525], [204.5, -57.2961, -43.153], [204.6, -57.3341, -43.1535], [204.7, -57.3717, -43.1541], [204.8, -57.4088, -43.1546], [204.9, -57.4455, -43.1552], [205, -57.4817, -43.1557], [205.1, -57.5174, -43.1563], [205.2, -57.5526, -43.1569], [205.3, -57.5874, -43.1576], [205.4, -57.6218, -43.1582], [205.5, -57.6557, -43.1589], [205.6, -57.6891, -43.1595], [205.7, -57.7221, -43.1602], [205.8, -57.7546, -43.1609], [205.9, -57.7867, -43.1617], [206, -57.8183, -43.1624], [206.1, -57.8495, -43.1632], [206.2, -57.8802, -43.1639], [206.3, -57.9105, -43.1647], [206.4, -57.9403, -43.1655], [206.5, -57.9697, -43.1663], [206.6, -57.9987, -43.1672], [206.7, -58.0272, -43.168], [206.8, -58.0553, -43.1688], [206.9, -58.083, -43.1697], [207, -58.1102, -43.1706], [207.1, -58.137, -43.1715], [207.2, -58.1634, -43.1724], [207.3, -58.1894, -43.1733], [207.4, -58.2149, -43.1742], [207.5, -58.24, -43.1752], [207.6, -58.2647, -43.1761], [207.7, -58.289, -43.1771], [207.8, -58.3129, -43.178], [207.9, -58.3363, -43.179], [208, -58.3594, -43.18], [208.1, -58.382, -43.181], [208.2, -58.4042, -43.182], [208.3, -58.426, -43.1831], [208.4, -58.4475, -43.1841], [208.5, -58.4685, -43.1852], [208.6, -58.4891, -43.1862], [208.7, -58.5093, -43.1873], [208.8, -58.5291, -43.1883], [208.9, -58.5486, -43.1894], [209, -58.5676, -43.1905], [209.1, -58.5863, -43.1916], [209.2, -58.6045, -43.1927], [209.3, -58.6224, -43.1938], [209.4, -58.6399, -43.1949], [209.5, -58.657, -43.1961], [209.6, -58.6737, -43.1972], [209.7, -58.6901, -43.1984], [209.8, -58.7061, -43.1995], [209.9, -58.7217, -43.2007], [210, -58.7369, -43.2018], [210.1, -58.7518, -43.203], [210.2, -58.7663, -43.2042], [210.3, -58.7804, -43.2054], [210.4, -58.7942, -43.2065], [210.5, -58.8076, -43.2077], [210.6, -58.8206, -43.2089], [210.7, -58.8333, -43.2101], [210.8, -58.8456, -43.2113], [210.9, -58.8576, -43.2126], [211, -58.8692, -43.2138], [211.1, -58.8805, -43.215], [211.2, -58.8914, -43.2162], [211.3, -58.902, -43.2175], [211.4, -58.9123, -43.2187], [211.5, -58.9222, -43.2199], [211.6, -58.9317, -43.2212], [211.7, -58.9409, -43.2224], [211.8, -58.9498, -43.2237], [211.9, -58.9584, -43.2249], [212, -58.9666, -43.2262], [212.1, -58.9745, -43.2274], [212.2, -58.982, -43.2287], [212.3, -58.9892, -43.23], [212.4, -58.9962, -43.2312], [212.5, -59.0027, -43.2325], [212.6, -59.009, -43.2338], [212.7, -59.0149, -43.235], [212.8, -59.0206, -43.2363], [212.9, -59.0259, -43.2376], [213, -59.0309, -43.2389], [213.1, -59.0355, -43.2401], [213.2, -59.0399, -43.2414], [213.3, -59.044, -43.2427], [213.4, -59.0477, -43.244], [213.5, -59.0512, -43.2453], [213.6, -59.0544, -43.2465], [213.7, -59.0572, -43.2478], [213.8, -59.0598, -43.2491], [213.9, -59.062, -43.2504], [214, -59.064, -43.2517], [214.1, -59.0657, -43.2529], [214.2, -59.067, -43.2542], [214.3, -59.0681, -43.2555], [214.4, -59.0689, -43.2568], [214.5, -59.0694, -43.2581], [214.6, -59.0697, -43.2593], [214.7, -59.0696, -43.2606], [214.8, -59.0693, -43.2619], [214.9, -59.0687, -43.2632], [215, -59.0678, -43.2644], [215.1, -59.0666, -43.2657], [215.2, -59.0652, -43.267], [215.3, -59.0635, -43.2682], [215.4, -59.0615, -43.2695], [215.5, -59.0593, -43.2707], [215.6, -59.0568, -43.272], [215.7, -59.054, -43.2733], [215.8, -59.051, -43.2745], [215.9, -59.0477, -43.2758], [216, -59.0441, -43.277], [216.1, -59.0403, -43.2783], [216.2, -59.0362, -43.2795], [216.3, -59.0319, -43.2807], [216.4, -59.0273, -43.282], [216.5, -59.0225, -43.2832], [216.6, -59.0174, -43.2844], [216.7, -59.0121, -43.2856], [216.8, -59.0065, -43.2869], [216.9, -59.0007, -43.2881], [217, -58.9946, -43.2893], [217.1, -58.9883, -43.2905], [217.2, -58.9818, -43.2917], [217.3, -58.975, -43.2929], [217.4, -58.968, -43.2941], [217.5, -58.9608, -43.2953], [217.6, -58.9533, -43.2965], [217.7, -58.9456, -43.2976], [217.8, -58.9376, -43.2988], [217.9, -58.9295, -43.3], [218, -58.9211, -43.3011], [218.1, -58.9125, -43.3023], [218.2, -58.9036, -43.3034], [218.3, -58.8945, -43.3046], [218.4, -58.8853, -43.3057], [218.5, -58.8758, -43.3069], [218.6, -58.866, -43.308], [218.7, -58.8561, -43.3091], [218.8, -58.8459, -43.3102], [218.9, -58.8356, -43.3113], [219, -58.825, -43.3124], [219.1, -58.8142, -43.3135], [219.2, -58.8032, -43.3146], [219.3, -58.792, -43.3157], [219.4, -58.7806, -43.3168], [219.5, -58.769, -43.3179], [219.6, -58.7572, -43.3189], [219.7, -58.7452, -43.32], [219.8, -58.733, -43.321], [219.9, -58.7206, -43.3221], [220, -58.708, -43.3231], [220.1, -58.6952, -43.3241], [220.2, -58.6822, -43.3251], [220.3, -58.669, -43.3262], [220.4, -58.6556, -43.3272], [220.5, -58.642, -43.3282], [220.6, -58.6283, -43.3291], [220.7, -58.6143, -43.3301], [220.8, -58.6002, -43.3311], [220.9, -58.5859, -43.3321], [221, -58.5714, -43.333], [221.1, -58.5567, -43.334], [221.2, -58.5419, -43.3349], [221.3, -58.5268, -43.3358], [221.4, -58.5116, -43.3368], [221.5, -58.4962, -43.3377], [221.6, -58.4807, -43.3386], [221.7, -58.465, -43.3395], [221.8, -58.4491, -43.3404], [221.9, -58.433, -43.3413], [222, -58.4167, -43.3421], [222.1, -58.4003, -43.343], [222.2, -58.3837, -43.3438], [222.3, -58.367, -43.3447], [222.4, -58.3501, -43.3455], [222.5, -58.333, -43.3463], [222.6, -58.3158, -43.3472], [222.7, -58.2984, -43.348], [222.8, -58.2809, -43.3488], [222.9, -58.2631, -43.3495], [223, -58.2453, -43.3503], [223.1, -58.2273, -43.3511], [223.2, -58.2091, -43.3518], [223.3, -58.1908, -43.3526], [223.4, -58.1723, -43.3533], [223.5, -58.1537, -43.3541], [223.6, -58.1349, -43.3548], [223.7, -58.116, -43.3555], [223.8, -58.0969, -43.3562], [223.9, -58.0777, -43.3569], [224, -58.0583, -43.3575], [224.1, -58.0388, -43.3582], [224.2, -58.0192, -43.3589], [224.3, -57.9994, -43.3595], [224.4, -57.9794, -43.3602], [224.5, -57.9594, -43.3608], [224.6, -57.9392, -43.3614], [224.7, -57.9188, -43.362], [224.8, -57.8984, -43.3626], [224.9, -57.8778, -43.3632], [225, -57.857, -43.3637], [225.1, -57.8361, -43.3643], [225.2, -57.8151, -43.3648], [225.3, -57.794, -43.3654], [225.4, -57.7727, -43.3659], [225.5, -57.7514, -43.3664], [225.6, -57.7298, -43.3669], [225.7, -57.7082, -43.3674], [225.8, -57.6864, -43.3679], [225.9, -57.6646, -43.3684], [226, -57.6425, -43.3688], [226.1, -57.6204, -43.3693], [226.2, -57.5982, -43.3697], [226.3, -57.5758, -43.3701], [226.4, -57.5533, -43.3705], [226.5, -57.5307, -43.3709], [226.6, -57.508, -43.3713], [226.7, -57.4851, -43.3717], [226.8, -57.4622, -43.3721], [226.9, -57.4391, -43.3724], [227, -57.416, -43.3728], [227.1, -57.3927, -43.3731], [227.2, -57.3693, -43.3734], [227.3, -57.3458, -43.3737], [227.4, -57.3222, -43.374], [227.5, -57.2985, -43.3743], [227.6, -57.2746, -43.3746], [227.7, -57.2507, -43.3748], [227.8, -57.2267, -43.3751], [227.9, -57.2025, -43.3753], [228, -57.1783, -43.3755], [228.1, -57.154, -43.3757], [228.2, -57.1295, -43.3759], [228.3, -57.105, -43.3761], [228.4, -57.0804, -43.3763], [228.5, -57.0556, -43.3764], [228.6, -57.0308, -43.3766], [228.7, -57.0059, -43.3767], [228.8, -56.9808, -43.3768], [228.9, -56.9557, -43.3769], [229, -56.9305, -43.377], [229.1, -56.9052, -43.3771], [229.2, -56.8798, -43.3772], [229.3, -56.8544, -43.3772], [229.4, -56.8288, -43.3773], [229.5, -56.8031, -43.3773], [229.6, -56.7774, -43.3773], [229.7, -56.7515, -43.3773], [229.8, -56.7256, -43.3773], [229.9, -56.6996, -43.3773], [230, -56.6735, -43.3773], [230.1, -56.6474, -43.3772], [230.2, -56.6211, -43.3772], [230.3, -56.5948, -43.3771], [230.4, -56.5684, -43.377], [230.5, -56.5419, -43.3769], [230.6, -56.5153, -43.3768], [230.7, -56.4886, -43.3767], [230.8, -56.4619, -43.3765], [230.9, -56.4351, -43.3764], [231, -56.4082, -43.3762], [231.1, -56.3812, -43.376], [231.2, -56.3542, -43.3758], [231.3, -56.3271, -43.3756], [231.4, -56.2999, -43.3754], [231.5, -56.2727, -43.3752], [231.6, -56.2453, -43.3749], [231.7, -56.2179, -43.3747], [231.8, -56.1905, -43.3744], [231.9, -56.1629, -43.3741], [232, -56.1353, -43.3738], [232.1, -56.1077, -43.3735], [232.2, -56.0799, -43.3732], [232.3, -56.0521, -43.3728], [232.4, -56.0243, -43.3725], [232.5, -55.9963, -43.3721], [232.6, -55.9683, -43.3717], [232.7, -55.9403, -43.3713], [232.8, -55.9122, -43.3709], [232.9, -55.884, -43.3705], [233, -55.8557, -43.3701], [233.1, -55.8274, -43.3696], [233.2, -55.799, -43.3692], [233.3, -55.7706, -43.3687], [233.4, -55.7421, -43.3682], [233.5, -55.7136, -43.3677], [233.6, -55.685, -43.3672], [233.7, -55.6563, -43.3666], [233.8, -55.6276, -43.3661], [233.9, -55.5989, -43.3655], [234, -55.57, -43.365], [234.1, -55.5412, -43.3644], [234.2, -55.5123, -43.3638], [234.3, -55.4833, -43.3632], [234.4, -55.4542, -43.3625], [234.5, -55.4252, -43.3619], [234.6, -55.396, -43.3612], [234.7, -55.3669, -43.3606], [234.8, -55.3376, -43.3599], [234.9, -55.3083, -43.3592], [235, -55.279, -43.3585], [235.1, -55.2496, -43.3578], [235.2, -55.2202, -43.357], [235.3, -55.1908, -43.3563], [235.4, -55.1612, -43.3555], [235.5, -55.1317, -43.3547], [235.6, -55.1021, -43.3539], [235.7, -55.0725, -43.3531], [235.8, -55.0428, -43.3523], [235.9, -55.013, -43.3514], [236, -54.9833, -43.3506], [236.1, -54.9535, -43.3497], [236.2, -54.9236, -43.3488], [236.3, -54.8937, -43.3479], [236.4, -54.8638, -43.347], [236.5, -54.8338, -43.3461], [236.6, -54.8038, -43.3452], [236.7, -54.7738, -43.3442], [236.8, -54.7437, -43.3433], [236.9, -54.7135, -43.3423], [237, -54.6834, -43.3413], [237.1, -54.6532, -43.3403], [237.2, -54.623, -43.3393], [237.3, -54.5927, -43.3382], [237.4, -54.5624, -43.3372], [237.5, -54.5321, -43.3361], [237.6, -54.5017, -43.335], [237.7, -54.4713, -43.334], [237.8, -54.4409, -43.3328], [237.9, -54.4105, -43.3317], [238, -54.38, -43.3306], [238.1, -54.3494, -43.3294], [238.2, -54.3189, -43.3283], [238.3, -54.2883, -43.3271], [238.4, -54.2577, -43.3259], [238.5, -54.2271, -43.3247], [238.6, -54.1964, -43.3235], [238.7, -54.1657, -43.3223], [238.8, -54.135, -43.321], [238.9, -54.1043, -43.3198], [239, -54.0735, -43.3185], [239.1, -54.0427, -43.3172], [239.2, -54.0119, -43.3159], [239.3, -53.9811, -43.3146], [239.4, -53.9502, -43.3132], [239.5, -53.9193, -43.3119], [239.6, -53.8884, -43.3105], [239.7, -53.8575, -43.3092], [239.8, -53.8265, -43.3078], [239.9, -53.7955, -43.3064], [240, -53.7645, -43.305], [240.1, -53.7335, -43.3035], [240.2, -53.7025, -43.3021], [240.3, -53.6714, -43.3006], [240.4, -53.6404, -43.2992], [240.5, -53.6093, -43.2977], [240.6, -53.5781, -43.2962], [240.7, -53.547, -43.2947], [240.8, -53.5159, -43.2931], [240.9, -53.4847, -43.2916], [241, -53.4535, -43.29], [241.1, -53.4223, -43.2885], [241.2, -53.3911, -43.2869], [241.3, -53.3599, -43.2853], [241.4, -53.3286, -43.2837], [241.5, -53.2974, -43.282], [241.6, -53.2661, -43.2804], [241.7, -53.2348, -43.2787], [241.8, -53.2035, -43.2771], [241.9, -53.1722, -43.2754], [242, -53.1409, -43.2737], [242.1, -53.1095, -43.272], [242.2, -53.0782, -43.2703], [242.3, -53.0468, -43.2685], [242.4, -53.0155, -43.2668], [242.5, -52.9841, -43.265], [242.6, -52.9527, -43.2632], [242.7, -52.9213, -43.2614], [242.8, -52.8899, -43.2596], [242.9, -52.8584, -43.2578], [243, -52.827, -43.256], [243.1, -52.7956, -43.2541], [243.2, -52.7641, -43.2523], [243.3, -52.7327, -43.2504], [243.4, -52.7012, -43.2485], [243.5, -52.6698, -43.2466], [243.6, -52.6383, -43.2447], [243.7, -52.6068, -43.2427], [243.8, -52.5753, -43.2408], [243.9, -52.5438, -43.2388], [244, -52.5123, -43.2369], [244.1, -52.4808, -43.2349], [244.2, -52.4493, -43.2329], [244.3, -52.4178, -43.2308], [244.4, -52.3863, -43.2288], [244.5, -52.3548, -43.2268], [244.6, -52.3233, -43.2247], [244.7, -52.2918, -43.2227], [244.8, -52.2602, -43.2206], [244.9, -52.2287, -43.2185], [245, -52.1972, -43.2164], [245.1, -52.1657, -43.2142], [245.2, -52.1341, -43.2121], [245.3, -52.1026, -43.2099], [245.4, -52.0711, -43.2078], [245.5, -52.0396, -43.2056], [245.6, -52.008, -43.2034], [245.7, -51.9765, -43.2012], [245.8, -51.945, -43.199], [245.9, -51.9135, -43.1967], [246, -51.8819, -43.1945], [246.1, -51.8504, -43.1922], [246.2, -51.8189, -43.19], [246.3, -51.7874, -43.1877], [246.4, -51.7559, -43.1854], [246.5, -51.7243, -43.1831], [246.6, -51.6928, -43.1807], [246.7, -51.6613, -43.1784], [246.8, -51.6298, -43.176], [246.9, -51.5983, -43.1737], [247, -51.5668, -43.1713], [247.1, -51.5354, -43.1689], [247.2, -51.5039, -43.1665], [247.3, -51.4724, -43.1641], [247.4, -51.4409, -43.1616], [247.5, -51.4095, -43.1592], [247.6, -51.378, -43.1567], [247.7, -51.3466, -43.1543], [247.8, -51.3151, -43.1518], [247.9, -51.2837, -43.1493], [248, -51.2522, -43.1467], [248.1, -51.2208, -43.1442], [248.2, -51.1894, -43.1417], [248.3, -51.158, -43.1391], [248.4, -51.1266, -43.1366], [248.5, -51.0952, -43.134], [248.6, -51.0638, -43.1314], [248.7, -51.0324, -43.1288], [248.8, -51.0011, -43.1262], [248.9, -50.9697, -43.1235], [249, -50.9384, -43.1209], [249.1, -50.907, -43.1182], [249.2, -50.8757, -43.1156], [249.3, -50.8444, -43.1129], [249.4, -50.8131, -43.1102], [249.5, -50.7818, -43.1075], [249.6, -50.7505, -43.1047], [249.7, -50.7192, -43.102], [249.8, -50.688, -43.0993], [249.9, -50.6567, -43.0965], [250, -50.6255, -43.0937], [250.1, -50.5943, -43.0909], [250.2, -50.5631, -43.0881], [250.3, -50.5319, -43.0853], [250.4, -50.5007, -43.0825], [250.5, -50.4695, -43.0797], [250.6, -50.4384, -43.0768], [250.7, -50.4072, -43.0739], [250.8, -50.3761, -43.0711], [250.9, -50.345, -43.0682], [251, -50.3139, -43.0653], [251.1, -50.2828, -43.0624], [251.2, -50.2517, -43.0594], [251.3, -50.2207, -43.0565], [251.4, -50.1896, -43.0535], [251.5, -50.1586, -43.0506], [251.6, -50.1276, -43.0476], [251.7, -50.0966, -43.0446], [251.8, -50.0656, -43.0416], [251.9, -50.0346, -43.0386], [252, -50.0037, -43.0356], [252.1, -49.9728, -43.0325], [252.2, -49.9419, -43.0295], [252.3, -49.911, -43.0264], [252.4, -49.8801, -43.0233], [252.5, -49.8492, -43.0202], [252.6, -49.8184, -43.0171], [252.7, -49.7875, -43.014], [252.8, -49.7567, -43.0109], [252.9, -49.7259, -43.0078], [253, -49.6952, -43.0046], [253.1, -49.6644, -43.0014], [253.2, -49.6337, -42.9983], [253.3, -49.603, -42.9951], [253.4, -49.5723, -42.9919], [253.5, -49.5416, -42.9887], [253.6, -49.5109, -42.9854], [253.7, -49.4803, -42.9822], [253.8, -49.4497, -42.979], [253.9, -49.4191, -42.9757], [254, -49.3885, -42.9724], [254.1, -49.3579, -42.9691], [254.2, -49.3274, -42.9658], [254.3, -49.2969, -42.9625], [254.4, -49.2664, -42.9592], [254.5, -49.2359, -42.9559], [254.6, -49.2054, -42.9525], [254.7, -49.175, -42.9492], [254.8, -49.1446, -42.9458], [254.9, -49.1142, -42.9424], [255, -49.0838, -42.939], [255.1, -49.0535, -42.9356], [255.2, -49.0231, -42.9322], [255.3, -48.9928, -42.9288], [255.4, -48.9625, -42.9254], [255.5, -48.9323, -42.9219], [255.6, -48.902, -42.9185], [255.7, -48.8718, -42.915], [255.8, -48.8416, -42.9115], [255.9, -48.8115, -42.908], [256, -48.7813, -42.9045], [256.1, -48.7512, -42.901], [256.2, -48.7211, -42.8974], [256.3, -48.691, -42.8939], [256.4, -48.6609, -42.8903], [256.5, -48.6309, -42.8868], [256.6, -48.6009, -42.8832], [256.7, -48.5709, -42.8796], [256.8, -48.541, -42.876], [256.9, -48.511, -42.8724], [257, -48.4811, -42.8688], [257.1, -48.4512, -42.8651], [257.2, -48.4214, -42.8615], [257.3, -48.3915, -42.8578], [257.4, -48.3617, -42.8542], [257.5, -48.3319, -42.8505], [257.6, -48.3022, -42.8468], [257.7, -48.2724, -42.8431], [257.8, -48.2427, -42.8394], [257.9, -48.213, -42.8357], [258, -48.1834, -42.8319], [258.1, -48.1537, -42.8282], [258.2, -48.1241, -42.8244], [258.3, -48.0945, -42.8207], [258.4, -48.065, -42.8169], [258.5, -48.0354, -42.8131], [258.6, -48.0059, -42.8093], [258.7, -47.9765, -42.8055], [258.8, -47.947, -42.8017], [258.9, -47.9176, -42.7978], [259, -47.8882, -42.794], [259.1, -47.8588, -42.7901], [259.2, -47.8295, -42.7863], [259.3, -47.8001, -42.7824], [259.4, -47.7709, -42.7785], [259.5, -47.7416, -42.7746], [259.6, -47.7124, -42.7707], [259.7, -47.6831, -42.7668], [259.8, -47.654, -42.7628], [259.9, -47.6248, -42.7589], [260, -47.5957, -42.7549], [260.1, -47.5666, -42.751], [260.2, -47.5375, -42.747], [260.3, -47.5085, -42.743], [260.4, -47.4795, -42.739], [260.5, -47.4505, -42.735], [260.6, -47.4215, -42.731], [260.7, -47.3926, -42.727], [260.8, -47.3637, -42.723], [260.9, -47.3348, -42.7189], [261, -47.306, -42.7148], [261.1, -47.2772, -42.7108], [261.2, -47.2484, -42.7067], [261.3, -47.2196, -42.7026], [261.4, -47.1909, -42.6985], [261.5, -47.1622, -42.6944], [261.6, -47.1335, -42.6903], [261.7, -47.1049, -42.6862], [261.8, -47.0763, -42.682], [261.9, -47.0477, -42.6779], [262, -47.0191, -42.6737], [262.1, -46.9906, -42.6695], [262.2, -46.9621, -42.6654], [262.3, -46.9337, -42.6612], [262.4, -46.9052, -42.657], [262.5, -46.8768, -42.6528], [262.6, -46.8484, -42.6486], [262.7, -46.8201, -42.6443], [262.8, -46.7918, -42.6401], [262.9, -46.7635, -42.6358], [263, -46.7352, -42.6316], [263.1, -46.707, -42.6273], [263.2, -46.6788, -42.623], [263.3, -46.6507, -42.6187], [263.4, -46.6225, -42.6144], [263.5, -46.5944, -42.6101], [263.6, -46.5664, -42.6058], [263.7, -46.5383, -42.6015], [263.8, -46.5103, -42.5971], [263.9, -46.4823, -42.5928], [264, -46.4544, -42.5884], [264.1, -46.4265, -42.5841], [264.2, -46.3986, -42.5797], [264.3, -46.3707, -42.5753], [264.4, -46.3429, -42.5709], [264.5, -46.3151, -42.5665], [264.6, -46.2874, -42.5621], [264.7, -46.2596, -42.5577], [264.8, -46.2319, -42.5533], [264.9, -46.2043, -42.5488], [265, -46.1766, -42.5444], [265.1, -46.149, -42.5399], [265.2, -46.1215, -42.5354], [265.3, -46.0939, -42.5309], [265.4, -46.0664, -42.5265], [265.5, -46.0389, -42.522], [265.6, -46.0115, -42.5175], [265.7, -45.9841, -42.5129], [265.8, -45.9567, -42.5084], [265.9, -45.9294, -42.5039], [266, -45.902, -42.4993], [266.1, -45.8748, -42.4948], [266.2, -45.8475, -42.4902], [266.3, -45.8203, -42.4856], [266.4, -45.7931, -42.4811], [266.5, -45.7659, -42.4765], [266.6, -45.7388, -42.4719], [266.7, -45.7117, -42.4673], [266.8, -45.6847, -42.4627], [266.9, -45.6576, -42.458], [267, -45.6306, -42.4534], [267.1, -45.6037, -42.4488], [267.2, -45.5768, -42.4441], [267.3, -45.5499, -42.4394], [267.4, -45.523, -42.4348], [267.5, -45.4962, -42.4301], [267.6, -45.4694, -42.4254], [267.7, -45.4426, -42.4207], [267.8, -45.4159, -42.416], [267.9, -45.3892, -42.4113], [268, -45.3625, -42.4066], [268.1, -45.3359, -42.4019], [268.2, -45.3093, -42.3971], [268.3, -45.2827, -42.3924], [268.4, -45.2562, -42.3876], [268.5, -45.2297, -42.3828], [268.6, -45.2032, -42.3781], [268.7, -45.1768, -42.3733], [268.8, -45.1504, -42.3685], [268.9, -45.124, -42.3637], [269, -45.0977, -42.3589], [269.1, -45.0714, -42.3541], [269.2, -45.0451, -42.3493], [269.3, -45.0189, -42.3444], [269.4, -44.9927, -42.3396], [269.5, -44.9665, -42.3347], [269.6, -44.9403, -42.3299], [269.7, -44.9142, -42.325], [269.8, -44.8882, -42.3202], [269.9, -44.8621, -42.3153], [270, -44.8361, -42.3104], [270.1, -44.8102, -42.3055], [270.2, -44.7842, -42.3006], [270.3, -44.7583, -42.2957], [270.4, -44.7325, -42.2908], [270.5, -44.7066, -42.2858], [270.6, -44.6808, -42.2809], [270.7, -44.6551, -42.2759], [270.8, -44.6293, -42.271], [270.9, -44.6036, -42.266], [271, -44.578, -42.2611], [271.1, -44.5523, -42.2561], [271.2, -44.5267, -42.2511], [271.3, -44.5012, -42.2461], [271.4, -44.4756, -42.2411], [271.5, -44.4502, -42.2361], [271.6, -44.4247, -42.2311], [271.7, -44.3993, -42.2261], [271.8, -44.3739, -42.221], [271.9, -44.3485, -42.216], [272, -44.3232, -42.211], [272.1, -44.2979, -42.2059], [272.2, -44.2726, -42.2008], [272.3, -44.2474, -42.1958], [272.4, -44.2222, -42.1907], [272.5, -44.1971, -42.1856], [272.6, -44.1719, -42.1805], [272.7, -44.1468, -42.1754], [272.8, -44.1218, -42.1703], [272.9, -44.0968, -42.1652], [273, -44.0718, -42.1601], [273.1, -44.0468, -42.155], [273.2, -44.0219, -42.1498], [273.3, -43.997, -42.1447], [273.4, -43.9722, -42.1395], [273.5, -43.9474, -42.1344], [273.6, -43.9226, -42.1292], [273.7, -43.8978, -42.124], [273.8, -43.8731, -42.1189], [273.9, -43.8484, -42.1137], [274, -43.8238, -42.1085], [274.1, -43.7992, -42.1033], [274.2, -43.7746, -42.0981], [274.3, -43.7501, -42.0929], [274.4, -43.7255, -42.0876], [274.5, -43.7011, -42.0824], [274.6, -43.6766, -42.0772], [274.7, -43.6522, -42.0719], [274.8, -43.6278, -42.0667], [274.9, -43.6035, -42.0614], [275, -43.5792, -42.0562], [275.1, -43.5549, -42.0509], [275.2, -43.5307, -42.0456], [275.3, -43.5065, -42.0403], [275.4, -43.4823, -42.035], [275.5, -43.4582, -42.0297], [275.6, -43.4341, -42.0244], [275.7, -43.41, -42.0191], [275.8, -43.386, -42.0138], [275.9, -43.362, -42.0085], [276, -43.3381, -42.0032], [276.1, -43.3141, -41.9978], [276.2, -43.2902, -41.9925], [276.3, -43.2664, -41.9871], [276.4, -43.2425, -41.9818], [276.5, -43.2188, -41.9764], [276.6, -43.195, -41.971], [276.7, -43.1713, -41.9657], [276.8, -43.1476, -41.9603], [276.9, -43.1239, -41.9549], [277, -43.1003, -41.9495], [277.1, -43.0767, -41.9441], [277.2, -43.0532, -41.9387], [277.3, -43.0297, -41.9333], [277.4, -43.0062, -41.9278], [277.5, -42.9827, -41.9224], [277.6, -42.9593, -41.917], [277.7, -42.9359, -41.9115], [277.8, -42.9126, -41.9061], [277.9, -42.8893, -41.9006], [278, -42.866, -41.8952], [278.1, -42.8428, -41.8897], [278.2, -42.8196, -41.8842], [278.3, -42.7964, -41.8788], [278.4, -42.7732, -41.8733], [278.5, -42.7501, -41.8678], [278.6, -42.7271, -41.8623], [278.7, -42.704, -41.8568], [278.8, -42.681, -41.8513], [278.9, -42.658, -41.8458], [279, -42.6351, -41.8402], [279.1, -42.6122, -41.8347], [279.2, -42.5893, -41.8292], [279.3, -42.5665, -41.8237], [279.4, -42.5437, -41.8181], [279.5, -42.5209, -41.8126], [279.6, -42.4982, -41.807], [279.7, -42.4755, -41.8014], [279.8, -42.4528, -41.7959], [279.9, -42.4302, -41.7903], [280, -42.4076, -41.7847], [280.1, -42.3851, -41.7791], [280.2, -42.3625, -41.7736], [280.3, -42.34, -41.768], [280.4, -42.3176, -41.7624], [280.5, -42.2952, -41.7568], [280.6, -42.2728, -41.7511], [280.7, -42.2504, -41.7455], [280.8, -42.2281, -41.7399], [280.9, -42.2058, -41.7343], [281, -42.1835, -41.7286], [281.1, -42.1613, -41.723], [281.2, -42.1391, -41.7174], [281.3, -42.117, -41.7117], [281.4, -42.0948, -41.706], [281.5, -42.0728, -41.7004], [281.6, -42.0507, -41.6947], [281.7, -42.0287, -41.689], [281.8, -42.0067, -41.6834], [281.9, -41.9847, -41.6777], [282, -41.9628, -41.672], [282.1, -41.9409, -41.6663], [282.2, -41.9191, -41.6606], [282.3, -41.8973, -41.6549], [282.4, -41.8755, -41.6492], [282.5, -41.8537, -41.6435], [282.6, -41.832, -41.6378], [282.7, -41.8103, -41.632], [282.8, -41.7887, -41.6263], [282.9, -41.7671, -41.6206], [283, -41.7455, -41.6148], [283.1, -41.7239, -41.6091], [283.2, -41.7024, -41.6033], [283.3, -41.6809, -41.5976], [283.4, -41.6595, -41.5918], [283.5, -41.6381, -41.5861], [283.6, -41.6167, -41.5803], [283.7, -41.5953, -41.5745], [283.8, -41.574, -41.5687], [283.9, -70, -41.563], [284, -68.9092, -41.5711], [284.1, -67.8431, -41.5787], [284.2, -66.8014, -41.5858], [284.3, -65.7834, -41.5923], [284.4, -64.7888, -41.5984], [284.5, -63.8169, -41.6039], [284.6, -62.8674, -41.609], [284.7, -61.9398, -41.6136], [284.8, -61.0337, -41.6177], [284.9, -60.1485, -41.6214], [285, -59.2839, -41.6246], [285.1, -58.4394, -41.6274], [285.2, -57.6146, -41.6298], [285.3, -56.8092, -41.6318], [285.4, -56.0226, -41.6334], [285.5, -55.2546, -41.6345], [285.6, -54.5046, -41.6353], [285.7, -53.7725, -41.6358], [285.8, -53.0577, -41.6358], [285.9, -52.36, -41.6356], [286, -51.6789, -41.6349], [286.1, -51.0141, -41.634], [286.2, -50.3653, -41.6327], [286.3, -49.7322, -41.6311], [286.4, -49.1143, -41.6291], [286.5, -48.5115, -41.6269], [286.6, -47.9234, -41.6244], [286.7, -47.3496, -41.6216], [286.8, -46.7899, -41.6185], [286.9, -46.244, -41.6151], [287, -45.7115, -41.6115], [287.1, -45.1923, -41.6076], [287.2, -44.686, -41.6035], [287.3, -44.1924, -41.5991], [287.4, -43.7111, -41.5945], [287.5, -43.242, -41.5896], [287.6, -42.7847, -41.5846], [287.7, -42.3391, -41.5793], [287.8, -41.9048, -41.5737], [287.9, -70, -41.568], [288, -68.9616, -41.5762], [288.1, -67.9476, -41.5838], [288.2, -66.9575, -41.591], [288.3, -65.9908, -41.5976], [288.4, -65.0471, -41.6037], [288.5, -64.1259, -41.6094], [288.6, -63.2266, -41.6147], [288.7, -62.3489, -41.6194], [288.8, -61.4922, -41.6238], [288.9, -60.6562, -41.6277], [289, -59.8404, -41.6312], [289.1, -59.0444, -41.6343], [289.2, -58.2678, -41.6369], [289.3, -57.5101, -41.6392], [289.4, -56.771, -41.6412], [289.5, -56.0501, -41.6427], [289.6, -55.347, -41.6439], [289.7, -54.6613, -41.6448], [289.8, -53.9926, -41.6453], [289.9, -53.3406, -41.6455], [290, -52.705, -41.6454], [290.1, -52.0853, -41.6449], [290.2, -51.4813, -41.6442], [290.3, -50.8927, -41.6431], [290.4, -50.319, -41.6418], [290.5, -49.76, -41.6401], [290.6, -49.2154, -41.6382], [290.7, -48.6848, -41.6361], [290.8, -48.168, -41.6337], [290.9, -47.6646, -41.631], [291, -47.1745, -41.6281], [291.1, -46.6972, -41.6249], [291.2, -46.2325, -41.6215], [291.3, -45.7802, -41.6179], [291.4, -45.34, -41.614], [291.5, -44.9116, -41.61], [291.6, -44.4948, -41.6057], [291.7, -44.0893, -41.6013], [291.8, -43.6949, -41.5966], [291.9, -43.3113, -41.5918], [292, -42.9383, -41.5868], [292.1, -42.5757, -41.5815], [292.2, -42.2232, -41.5762], [292.3, -41.8806, -41.5706], [292.4, -70, -41.5649], [292.5, -69.0086, -41.5731], [292.6, -68.0412, -41.5808], [292.7, -67.0975, -41.588], [292.8, -66.1769, -41.5947], [292.9, -65.2789, -41.601], [293, -64.403, -41.6068], [293.1, -63.5488, -41.6121], [293.2, -62.7158, -41.6171], [293.3, -61.9036, -41.6216], [293.4, -61.1117, -41.6258], [293.5, -60.3397, -41.6295], [293.6, -59.5872, -41.6328], [293.7, -58.8538, -41.6358], [293.8, -58.139, -41.6384], [293.9, -57.4424, -41.6407], [294, -56.7638, -41.6426], [294.1, -56.1026, -41.6441], [294.2, -55.4586, -41.6454], [294.3, -54.8313, -41.6463], [294.4, -54.2203, -41.6469], [294.5, -53.6255, -41.6472], [294.6, -53.0463, -41.6473], [294.7, -52.4825, -41.647], [294.8, -51.9337, -41.6464], [294.9, -51.3997, -41.6456], [295, -50.88, -41.6446], [295.1, -50.3744, -41.6432], [295.2, -49.8826, -41.6416], [295.3, -49.4042, -41.6398], [295.4, -48.9391, -41.6378], [295.5, -48.4868, -41.6355], [295.6, -48.0472, -41.633], [295.7, -47.6199, -41.6303], [295.8, -47.2047, -41.6273], [295.9, -46.8012, -41.6242], [296, -46.4094, -41.6209], [296.1, -46.0288, -41.6174], [296.2, -45.6593, -41.6137], [296.3, -45.3006, -41.6098], [296.4, -44.9525, -41.6058], [296.5, -44.6147, -41.6016], [296.6, -44.287, -41.5972], [296.7, -43.9693, -41.5927], [296.8, -43.6611, -41.588], [296.9, -43.3625, -41.5831], [297, -43.073, -41.5782], [297.1, -42.7926, -41.5731], [297.2, -42.5211, -41.5678], [297.3, -42.2582, -41.5624], [297.4, -42.0037, -41.5569], [297.5, -41.7575, -41.5513], [297.6, -70, -41.5456], [297.7, -69.049, -41.5538], [297.8, -68.1219, -41.5615], [297.9, -67.2181, -41.5688], [298, -66.3371, -41.5756], [298.1, -65.4784, -41.582], [298.2, -64.6416, -41.5879], [298.3, -63.8262, -41.5935], [298.4, -63.0318, -41.5986], [298.5, -62.2578, -41.6033], [298.6, -61.5039, -41.6076], [298.7, -60.7696, -41.6116], [298.8, -60.0546, -41.6152], [298.9, -59.3583, -41.6184], [299, -58.6804, -41.6213], [299.1, -58.0206, -41.6238], [299.2, -57.3783, -41.6261], [299.3, -56.7533, -41.628], [299.4, -56.1451, -41.6296], [299.5, -55.5534, -41.6309], [299.6, -54.9778, -41.6319], [299.7, -54.4181, -41.6326], [299.8, -53.8738, -41.633], [299.9, -53.3446, -41.6332], [300, -52.8302, -41.6331], [300.1, -52.3302, -41.6327], [300.2, -51.8444, -41.6322], [300.3, -51.3724, -41.6313], [300.4, -50.9139, -41.6303], [300.5, -50.4687, -41.629], [300.6, -50.0365, -41.6275], [300.7, -49.6168, -41.6258], [300.8, -49.2096, -41.6238], [300.9, -48.8145, -41.6217], [301, -48.4312, -41.6194], [301.1, -48.0595, -41.6169], [301.2, -47.6991, -41.6142], [301.3, -47.3497, -41.6114], [301.4, -47.0112, -41.6084], [301.5, -46.6833, -41.6052], [301.6, -46.3657, -41.6018], [301.7, -46.0583, -41.5983], [301.8, -45.7607, -41.5947], [301.9, -45.4727, -41.5909], [302, -45.1943, -41.587], [302.1, -44.925, -41.5829], [302.2, -44.6648, -41.5787], [302.3, -44.4134, -41.5744], [302.4, -44.1706, -41.57], [302.5, -43.9362, -41.5655], [302.6, -43.71, -41.5608], [302.7, -43.4919, -41.5561], [302.8, -43.2817, -41.5512], [302.9, -43.0791, -41.5462], [303, -42.884, -41.5412], [303.1, -42.6962, -41.536], [303.2, -42.5156, -41.5308], [303.3, -42.342, -41.5255], [303.4, -42.1752, -41.5201], [303.5, -42.0151, -41.5146], [303.6, -41.8614, -41.5091], [303.7, -41.7142, -41.5035], [303.8, -41.5731, -41.4978], [303.9, -70, -41.492], [304, -69.0809, -41.5003], [304.1, -68.1854, -41.5081], [304.2, -67.3129, -41.5155], [304.3, -66.4631, -41.5224], [304.4, -65.6354, -41.5289], [304.5, -64.8294, -41.535], [304.6, -64.0445, -41.5407], [304.7, -63.2804, -41.5459], [304.8, -62.5365, -41.5509], [304.9, -61.8125, -41.5554], [305, -61.1079, -41.5596], [305.1, -60.4223, -41.5634], [305.2, -59.7553, -41.5668], [305.3, -59.1065, -41.57], [305.4, -58.4755, -41.5728], [305.5, -57.8618, -41.5753], [305.6, -57.2652, -41.5775], [305.7, -56.6853, -41.5794], [305.8, -56.1216, -41.5811], [305.9, -55.5739, -41.5824], [306, -55.0418, -41.5835], [306.1, -54.5249, -41.5843], [306.2, -54.0229, -41.5848], [306.3, -53.5355, -41.5851], [306.4, -53.0624, -41.5852], [306.5, -52.6032, -41.585], [306.6, -52.1577, -41.5846], [306.7, -51.7255, -41.584], [306.8, -51.3063, -41.5832], [306.9, -50.8999, -41.5821], [307, -50.506, -41.5809], [307.1, -50.1243, -41.5795], [307.2, -49.7545, -41.5779], [307.3, -49.3963, -41.5761], [307.4, -49.0495, -41.5741], [307.5, -48.7139, -41.572], [307.6, -48.3891, -41.5697], [307.7, -48.075, -41.5672], [307.8, -47.7713, -41.5646], [307.9, -47.4777, -41.5619], [308, -47.1941, -41.559], [308.1, -46.9202, -41.556], [308.2, -46.6558, -41.5528], [308.3, -46.4006, -41.5495], [308.4, -46.1545, -41.5461], [308.5, -45.9172, -41.5426], [308.6, -45.6886, -41.5389], [308.7, -45.4685, -41.5352], [308.8, -45.2565, -41.5313], [308.9, -45.0527, -41.5274], [309, -44.8567, -41.5233], [309.1, -44.6684, -41.5192], [309.2, -44.4876, -41.515], [309.3, -44.3141, -41.5106], [309.4, -44.1478, -41.5062], [309.5, -43.9885, -41.5018], [309.6, -43.836, -41.4972], [309.7, -43.6902, -41.4926], [309.8, -43.5508, -41.4879], [309.9, -43.4179, -41.4832], [310, -43.2911, -41.4784], [310.1, -43.1703, -41.4735], [310.2, -43.0555, -41.4686], [310.3, -42.9464, -41.4636], [310.4, -42.843, -41.4586], [310.5, -42.745, -41.4536], [310.6, -42.6524, -41.4485], [310.7, -42.5649, -41.4433], [310.8, -42.4826, -41.4381], [310.9, -42.4053, -41.4329], [311, -42.3327, -41.4277], [311.1, -42.2649, -41.4224], [311.2, -42.2017, -41.4171], [311.3, -42.143, -41.4118], [311.4, -42.0887, -41.4064], [311.5, -42.0386, -41.4011], [311.6, -41.9926, -41.3957], [311.7, -41.9507, -41.3903], [311.8, -41.9128, -41.3848], [311.9, -41.8787, -41.3794], [312, -41.8483, -41.3739], [312.1, -41.8216, -41.3685], [312.2, -41.7984, -41.363], [312.3, -41.7787, -41.3576], [312.4, -41.7624, -41.3521], [312.5, -41.7493, -41.3466], [312.6, -41.7394, -41.3412], [312.7, -41.7326, -41.3357], [312.8, -41.7288, -41.3302], [312.9, -41.7279, -41.3248], [313, -41.73, -41.3193], [313.1, -41.7347, -41.3138], [313.2, -41.7422, -41.3084], [313.3, -41.7523, -41.303], [313.4, -41.765, -41.2975], [313.5, -41.7801, -41.2921], [313.6, -41.7977, -41.2867], [313.7, -41.8175, -41.2814], [313.8, -41.8397, -41.276], [313.9, -41.864, -41.2706], [314, -41.8905, -41.2653], [314.1, -41.9191, -41.26], [314.2, -41.9497, -41.2547], [314.3, -41.9822, -41.2494], [314.4, -42.0166, -41.2442], [314.5, -42.0529, -41.239], [314.6, -42.0909, -41.2338], [314.7, -42.1307, -41.2286], [314.8, -42.1721, -41.2235], [314.9, -42.2152, -41.2183], [315, -42.2598, -41.2132], [315.1, -42.306, -41.2082], [315.2, -42.3536, -41.2031], [315.3, -42.4026, -41.1981], [315.4, -42.453, -41.1931], [315.5, -42.5047, -41.1882], [315.6, -42.5577, -41.1833], [315.7, -42.6119, -41.1784], [315.8, -42.6673, -41.1735], [315.9, -42.7239, -41.1687], [316, -42.7815, -41.1639], [316.1, -42.8403, -41.1591], [316.2, -42.9, -41.1544], [316.3, -42.9608, -41.1497], [316.4, -43.0224, -41.1451], [316.5, -43.085, -41.1405], [316.6, -43.1485, -41.1359], [316.7, -43.2129, -41.1313], [316.8, -43.278, -41.1268], [316.9, -43.3439, -41.1224], [317, -43.4105, -41.1179], [317.1, -43.4779, -41.1135], [317.2, -43.5459, -41.1092], [317.3, -43.6146, -41.1049], [317.4, -43.6838, -41.1006], [317.5, -43.7537, -41.0963], [317.6, -43.8241, -41.0921], [317.7, -43.8951, -41.088], [317.8, -43.9666, -41.0839], [317.9, -44.0385, -41.0798], [318, -44.1109, -41.0757], [318.1, -44.1837, -41.0717], [318.2, -44.2569, -41.0678], [318.3, -44.3305, -41.0639], [318.4, -44.4044, -41.06], [318.5, -44.4787, -41.0562], [318.6, -44.5532, -41.0524], [318.7, -44.6281, -41.0486], [318.8, -44.7032, -41.0449], [318.9, -44.7785, -41.0412], [319, -44.8541, -41.0376], [319.1, -44.9299, -41.034], [319.2, -45.0058, -41.0304], [319.3, -45.0819, -41.0269], [319.4, -45.1582, -41.0235], [319.5, -45.2346, -41.02], [319.6, -45.311, -41.0167], [319.7, -45.3876, -41.0133], [319.8, -45.4643, -41.01], [319.9, -45.541, -41.0068], [320, -45.6177, -41.0036], [320.1, -45.6945, -41.0004], [320.2, -45.7713, -40.9972], [320.3, -45.8481, -40.9942], [320.4, -45.9248, -40.9911], [320.5, -46.0016, -40.9881], [320.6, -46.0783, -40.9851], [320.7, -46.1549, -40.9822], [320.8, -46.2314, -40.9793], [320.9, -46.3079, -40.9765], [321, -46.3843, -40.9737], [321.1, -46.4605, -40.9709], [321.2, -46.5367, -40.9682], [321.3, -46.6127, -40.9655], [321.4, -46.6886, -40.9629], [321.5, -46.7643, -40.9603], [321.6, -46.8398, -40.9577], [321.7, -46.9152, -40.9552], [321.8, -46.9904, -40.9527], [321.9, -47.0654, -40.9503], [322, -47.1402, -40.9479], [322.1, -47.2147, -40.9455], [322.2, -47.2891, -40.9432], [322.3, -47.3632, -40.9409], [322.4, -47.4371, -40.9387], [322.5, -47.5108, -40.9365], [322.6, -47.5842, -40.9343], [322.7, -47.6573, -40.9322], [322.8, -47.7302, -40.9301], [322.9, -47.8028, -40.9281], [323, -47.8751, -40.9261], [323.1, -47.9471, -40.9241], [323.2, -48.0188, -40.9222], [323.3, -48.0902, -40.9203], [323.4, -48.1613, -40.9184], [323.5, -48.2321, -40.9166], [323.6, -48.3026, -40.9148], [323.7, -48.3728, -40.9131], [323.8, -48.4426, -40.9114], [323.9, -48.5121, -40.9097], [324, -48.5812, -40.9081], [324.1, -48.65, -40.9065], [324.2, -48.7185, -40.9049], [324.3, -48.7866, -40.9034], [324.4, -48.8543, -40.9019], [324.5, -48.9217, -40.9004], [324.6, -48.9887, -40.899], [324.7, -49.0553, -40.8976], [324.8, -49.1216, -40.8963], [324.9, -49.1875, -40.8949], [325, -49.253, -40.8937], [325.1, -49.3181, -40.8924], [325.2, -49.3828, -40.8912], [325.3, -49.4471, -40.89], [325.4, -49.5111, -40.8889], [325.5, -49.5746, -40.8877], [325.6, -49.6378, -40.8867], [325.7, -49.7005, -40.8856], [325.8, -49.7629, -40.8846], [325.9, -49.8248, -40.8836], [326, -49.8863, -40.8826], [326.1, -49.9474, -40.8817], [326.2, -50.0081, -40.8808], [326.3, -50.0684, -40.88], [326.4, -50.1283, -40.8791], [326.5, -50.1877, -40.8783], [326.6, -50.2467, -40.8776], [326.7, -50.3053, -40.8768], [326.8, -50.3635, -40.8761], [326.9, -50.4213, -40.8754], [327, -50.4786, -40.8748], [327.1, -50.5355, -40.8742], [327.2, -50.592, -40.8736], [327.3, -50.648, -40.873], [327.4, -50.7036, -40.8725], [327.5, -50.7588, -40.872], [327.6, -50.8136, -40.8715], [327.7, -50.8679, -40.871], [327.8, -50.9218, -40.8706], [327.9, -50.9752, -40.8702], [328, -51.0282, -40.8699], [328.1, -51.0808, -40.8695], [328.2, -51.133, -40.8692], [328.3, -51.1847, -40.8689], [328.4, -51.236, -40.8686], [328.5, -51.2868, -40.8684], [328.6, -51.3372, -40.8682], [328.7, -51.3872, -40.868], [328.8, -51.4367, -40.8678], [328.9, -51.4858, -40.8677], [329, -51.5345, -40.8676], [329.1, -51.5827, -40.8675], [329.2, -51.6305, -40.8674], [329.3, -51.6778, -40.8674], [329.4, -51.7248, -40.8674], [329.5, -51.7713, -40.8674], [329.6, -51.8173, -40.8674], [329.7, -51.8629, -40.8675], [329.8, -51.9081, -40.8675], [329.9, -51.9529, -40.8676], [330, -51.9972, -40.8678], [330.1, -52.0411, -40.8679], [330.2, -52.0845, -40.8681], [330.3, -52.1276, -40.8683], [330.4, -52.1702, -40.8685], [330.5, -52.2123, -40.8687], [330.6, -52.2541, -40.8689], [330.7, -52.2954, -40.8692], [330.8, -52.3363, -40.8695], [330.9, -52.3768, -40.8698], [331, -52.4168, -40.8701], [331.1, -52.4564, -40.8705], [331.2, -52.4956, -40.8708], [331.3, -52.5344, -40.8712], [331.4, -52.5727, -40.8716], [331.5, -52.6107, -40.8721], [331.6, -52.6482, -40.8725], [331.7, -52.6853, -40.873], [331.8, -52.722, -40.8734], [331.9, -52.7583, -40.8739], [332, -52.7941, -40.8745], [332.1, -52.8296, -40.875], [332.2, -52.8646, -40.8755], [332.3, -52.8992, -40.8761], [332.4, -52.9334, -40.8767], [332.5, -52.9672, -40.8773], [332.6, -53.0006, -40.8779], [332.7, -53.0336, -40.8785], [332.8, -53.0662, -40.8792], [332.9, -53.0984, -40.8798], [333, -53.1302, -40.8805], [333.1, -53.1616, -40.8812], [333.2, -53.1926, -40.8819], [333.3, -53.2232, -40.8826], [333.4, -53.2534, -40.8834], [333.5, -53.2832, -40.8841], [333.6, -53.3126, -40.8849], [333.7, -53.3417, -40.8857], [333.8, -53.3703, -40.8865], [333.9, -53.3986, -40.8873], [334, -53.4264, -40.8881], [334.1, -53.4539, -40.8889], [334.2, -53.481, -40.8898], [334.3, -53.5077, -40.8906], [334.4, -53.5341, -40.8915], [334.5, -53.56, -40.8924], [334.6, -53.5856, -40.8933], [334.7, -53.6108, -40.8942], [334.8, -53.6357, -40.8951], [334.9, -53.6601, -40.896], [335, -53.6842, -40.8969], [335.1, -53.708, -40.8979], [335.2, -53.7313, -40.8989], [335.3, -53.7543, -40.8998], [335.4, -53.777, -40.9008], [335.5, -53.7992, -40.9018], [335.6, -53.8211, -40.9028], [335.7, -53.8427, -40.9038], [335.8, -53.8639, -40.9048], [335.9, -53.8847, -40.9059], [336, -53.9052, -40.9069], [336.1, -53.9253, -40.908], [336.2, -53.9451, -40.909], [336.3, -53.9646, -40.9101], [336.4, -53.9836, -40.9112], [336.5, -54.0024, -40.9123], [336.6, -54.0208, -40.9133], [336.7, -54.0388, -40.9144], [336.8, -54.0566, -40.9156], [336.9, -54.0739, -40.9167], [337, -54.091, -40.9178], [337.1, -54.1077, -40.9189], [337.2, -54.1241, -40.9201], [337.3, -54.1401, -40.9212], [337.4, -54.1558, -40.9224], [337.5, -54.1712, -40.9235], [337.6, -54.1863, -40.9247], [337.7, -54.201, -40.9259], [337.8, -54.2154, -40.927], [337.9, -54.2295, -40.9282], [338, -54.2433, -40.9294], [338.1, -54.2567, -40.9306], [338.2, -54.2698, -40.9318], [338.3, -54.2827, -40.933], [338.4, -54.2952, -40.9342], [338.5, -54.3074, -40.9354], [338.6, -54.3193, -40.9367], [338.7, -54.3308, -40.9379], [338.8, -54.3421, -40.9391], [338.9, -54.3531, -40.9404], [339, -54.3637, -40.9416], [339.1, -54.3741, -40.9428], [339.2, -54.3842, -40.9441], [339.3, -54.3939, -40.9453], [339.4, -54.4034, -40.9466], [339.5, -54.4126, -40.9478], [339.6, -54.4215, -40.9491], [339.7, -54.43, -40.9504], [339.8, -54.4383, -40.9516], [339.9, -54.4464, -40.9529], [340, -54.4541, -40.9542], [340.1, -54.4615, -40.9554], [340.2, -54.4687, -40.9567], [340.3, -54.4756, -40.958], [340.4, -54.4822, -40.9593], [340.5, -54.4885, -40.9606], [340.6, -54.4945, -40.9618], [340.7, -54.5003, -40.9631], [340.8, -54.5058, -40.9644], [340.9, -54.511, -40.9657], [341, -54.516, -40.967], [341.1, -54.5207, -40.9683], [341.2, -54.5251, -40.9696], [341.3, -54.5293, -40.9709], [341.4, -54.5332, -40.9722], [341.5, -54.5368, -40.9735], [341.6, -54.5402, -40.9748], [341.7, -54.5433, -40.9761], [341.8, -54.5461, -40.9774], [341.9, -54.5487, -40.9786], [342, -54.5511, -40.9799], [342.1, -54.5532, -40.9812], [342.2, -54.555, -40.9825], [342.3, -54.5566, -40.9838], [342.4, -54.558, -40.9851], [342.5, -54.5591, -40.9864], [342.6, -54.5599, -40.9877], [342.7, -54.5606, -40.989], [342.8, -54.5609, -40.9903], [342.9, -54.5611, -40.9916], [343, -54.561, -40.9929], [343.1, -54.5606, -40.9942], [343.2, -54.56, -40.9954], [343.3, -54.5592, -40.9967], [343.4, -54.5582, -40.998], [343.5, -54.5569, -40.9993], [343.6, -54.5554, -41.0006], [343.7, -54.5537, -41.0018], [343.8, -54.5517, -41.0031], [343.9, -54.5495, -41.0044], [344, -54.5471, -41.0057], [344.1, -54.5445, -41.0069], [344.2, -54.5417, -41.0082], [344.3, -54.5386, -41.0094], [344.4, -54.5353, -41.0107], [344.5, -54.5318, -41.012], [344.6, -54.5281, -41.0132], [344.7, -54.5242, -41.0145], [344.8, -54.52, -41.0157], [344.9, -54.5157, -41.017], [345, -54.5111, -41.0182], [345.1, -54.5064, -41.0194], [345.2, -54.5014, -41.0207], [345.3, -54.4962, -41.0219], [345.4, -54.4908, -41.0231], [345.5, -54.4852, -41.0243], [345.6, -54.4794, -41.0255], [345.7, -54.4735, -41.0268], [345.8, -54.4673, -41.028], [345.9, -54.4609, -41.0292], [346, -54.4543, -41.0304], [346.1, -54.4476, -41.0316], [346.2, -54.4406, -41.0328], [346.3, -54.4335, -41.0339], [346.4, -54.4261, -41.0351], [346.5, -54.4186, -41.0363], [346.6, -54.4109, -41.0375], [346.7, -54.403, -41.0386], [346.8, -54.3949, -41.0398], [346.9, -54.3866, -41.0409], [347, -54.3782, -41.0421], [347.1, -54.3695, -41.0432], [347.2, -54.3607, -41.0444], [347.3, -54.3517, -41.0455], [347.4, -54.3425, -41.0466], [347.5, -54.3332, -41.0478], [347.6, -54.3237, -41.0489], [347.7, -54.314, -41.05], [347.8, -54.3041, -41.0511], [347.9, -54.2941, -41.0522], [348, -54.2839, -41.0533], [348.1, -54.2735, -41.0544], [348.2, -54.263, -41.0554], [348.3, -54.2523, -41.0565], [348.4, -54.2414, -41.0576], [348.5, -54.2304, -41.0586], [348.6, -54.2192, -41.0597], [348.7, -54.2078, -41.0607], [348.8, -54.1963, -41.0618], [348.9, -54.1846, -41.0628], [349, -54.1728, -41.0638], [349.1, -54.1608, -41.0649], [349.2, -54.1487, -41.0659], [349.3, -54.1364, -41.0669], [349.4, -54.1239, -41.0679], [349.5, -54.1113, -41.0689], [349.6, -54.0986, -41.0699], [349.7, -54.0857, -41.0708], [349.8, -54.0727, -41.0718], [349.9, -54.0595, -41.0728], [350, -54.0461, -41.0737], [350.1, -54.0326, -41.0747], [350.2, -54.019, -41.0756], [350.3, -54.0052, -41.0765], [350.4, -53.9913, -41.0774], [350.5, -53.9773, -41.0784], [350.6, -53.9631, -41.0793], [350.7, -53.9487, -41.0802], [350.8, -53.9343, -41.0811], [350.9, -53.9197, -41.0819], [351, -53.9049, -41.0828], [351.1, -53.8901, -41.0837], [351.2, -53.8751, -41.0845], [351.3, -53.8599, -41.0854], [351.4, -53.8446, -41.0862], [351.5, -53.8292, -41.0871], [351.6, -53.8137, -41.0879], [351.7, -53.7981, -41.0887], [351.8, -53.7823, -41.0895], [351.9, -53.7664, -41.0903], [352, -53.7503, -41.0911], [352.1, -53.7342, -41.0919], [352.2, -53.7179, -41.0926], [352.3, -53.7015, -41.0934], [352.4, -53.685, -41.0941], [352.5, -53.6684, -41.0949], [352.6, -53.6516, -41.0956], [352.7, -53.6347, -41.0964], [352.8, -53.6177, -41.0971], [352.9, -53.6006, -41.0978], [353, -53.5834, -41.0985], [353.1, -53.5661, -41.0992], [353.2, -53.5486, -41.0998], [353.3, -53.531, -41.1005], [353.4, -53.5134, -41.1012], [353.5, -53.4956, -41.1018], [353.6, -53.4777, -41.1025], [353.7, -53.4597, -41.1031], [353.8, -53.4416, -41.1037], [353.9, -53.4234, -41.1043], [354, -53.405, -41.1049], [354.1, -53.3866, -41.1055], [354.2, -53.3681, -41.1061], [354.3, -53.3495, -41.1067], [354.4, -53.3307, -41.1072], [354.5, -53.3119, -41.1078], [354.6, -53.293, -41.1083], [354.7, -53.2739, -41.1089], [354.8, -53.2548, -41.1094], [354.9, -53.2356, -41.1099], [355, -53.2162, -41.1104], [355.1, -53.1968, -41.1109], [355.2, -53.1773, -41.1114], [355.3, -53.1577, -41.1119], [355.4, -53.138, -41.1123], [355.5, -53.1182, -41.1128], [355.6, -53.0983, -41.1132], [355.7, -53.0783, -41.1136], [355.8, -53.0582, -41.1141], [355.9, -53.0381, -41.1145], [356, -53.0178, -41.1149], [356.1, -52.9975, -41.1153], [356.2, -52.9771, -41.1156], [356.3, -52.9566, -41.116], [356.4, -52.936, -41.1164], [356.5, -52.9153, -41.1167], [356.6, -52.8945, -41.117], [356.7, -52.8737, -41.1174], [356.8, -52.8528, -41.1177], [356.9, -52.8317, -41.118], [357, -52.8107, -41.1183], [357.1, -52.7895, -41.1186], [357.2, -52.7682, -41.1188], [357.3, -52.7469, -41.1191], [357.4, -52.7255, -41.1193], [357.5, -52.704, -41.1196], [357.6, -52.6825, -41.1198], [357.7, -52.6608, -41.12], [357.8, -52.6391, -41.1202], [357.9, -52.6174, -41.1204], [358, -52.5955, -41.1206], [358.1, -52.5736, -41.1208], [358.2, -52.5516, -41.1209], [358.3, -52.5295, -41.1211], [358.4, -52.5074, -41.1212], [358.5, -52.4852, -41.1214], [358.6, -52.4629, -41.1215], [358.7, -52.4406, -41.1216], [358.8, -52.4181, -41.1217], [358.9, -52.3957, -41.1217], [359, -52.3731, -41.1218], [359.1, -52.3505, -41.1219], [359.2, -52.3278, -41.1219], [359.3, -52.3051, -41.122], [359.4, -52.2823, -41.122], [359.5, -52.2594, -41.122], [359.6, -52.2365, -41.122], [359.7, -52.2135, -41.122], [359.8, -52.1905, -41.122], [359.9, -52.1674, -41.1219], [360, -52.1442, -41.1219], [360.1, -52.121, -41.1218], [360.2, -52.0977, -41.1218], [360.3, -52.0743, -41.1217], [360.4, -52.0509, -41.1216], [360.5, -52.0275, -41.1215], [360.6, -52.004, -41.1214], [360.7, -51.9804, -41.1213], [360.8, -51.9568, -41.1211], [360.9, -51.9331, -41.121], [361, -51.9094, -41.1208], [361.1, -51.8856, -41.1206], [361.2, -51.8618, -41.1205], [361.3, -51.8379, -41.1203], [361.4, -51.8139, -41.1201], [361.5, -51.7899, -41.1198], [361.6, -51.7659, -41.1196], [361.7, -51.7418, -41.1194], [361.8, -51.7177, -41.1191], [361.9, -51.6935, -41.1188], [362, -51.6693, -41.1186], [362.1, -51.645, -41.1183], [362.2, -51.6207, -41.118], [362.3, -51.5963, -41.1177], [362.4, -51.5719, -41.1173], [362.5, -51.5475, -41.117], [362.6, -51.523, -41.1166], [362.7, -51.4984, -41.1163], [362.8, -51.4738, -41.1159], [362.9, -51.4492, -41.1155], [363, -51.4245, -41.1151], [363.1, -51.3998, -41.1147], [363.2, -51.3751, -41.1143], [363.3, -51.3503, -41.1139], [363.4, -51.3254, -41.1134], [363.5, -51.3006, -41.113], [363.6, -51.2756, -41.1125], [363.7, -51.2507, -41.112], [363.8, -51.2257, -41.1115], [363.9, -51.2007, -41.111], [364, -51.1756, -41.1105], [364.1, -51.1505, -41.11], [364.2, -51.1254, -41.1094], [364.3, -51.1002, -41.1089], [364.4, -51.075, -41.1083], [364.5, -51.0498, -41.1077], [364.6, -51.0245, -41.1072], [364.7, -50.9992, -41.1066], [364.8, -50.9739, -41.1059], [364.9, -50.9485, -41.1053], [365, -50.9231, -41.1047], [365.1, -50.8977, -41.104], [365.2, -50.8722, -41.1034], [365.3, -50.8467, -41.1027], [365.4, -50.8212, -41.102], [365.5, -50.7957, -41.1013], [365.6, -50.7701, -41.1006], [365.7, -50.7445, -41.0999], [365.8, -50.7189, -41.0991], [365.9, -50.6932, -41.0984], [366, -50.6675, -41.0976], [366.1, -50.6418, -41.0969], [366.2, -50.616, -41.0961], [366.3, -50.5903, -41.0953], [366.4, -50.5645, -41.0945], [366.5, -50.5387, -41.0937], [366.6, -50.5128, -41.0928], [366.7, -50.4869, -41.092], [366.8, -50.461, -41.0911], [366.9, -50.4351, -41.0903], [367, -50.4092, -41.0894], [367.1, -50.3832, -41.0885], [367.2, -50.3573, -41.0876], [367.3, -50.3313, -41.0867], [367.4, -50.3052, -41.0858], [367.5, -50.2792, -41.0848], [367.6, -50.2531, -41.0839], [367.7, -50.227, -41.0829], [367.8, -50.2009, -41.0819], [367.9, -50.1748, -41.0809], [368, -50.1487, -41.0799], [368.1, -50.1225, -41.0789], [368.2, -50.0963, -41.0779], [368.3, -50.0701, -41.0769], [368.4, -50.0439, -41.0758], [368.5, -50.0177, -41.0748], [368.6, -49.9914, -41.0737], [368.7, -49.9652, -41.0726], [368.8, -49.9389, -41.0715], [368.9, -49.9126, -41.0704], [369, -49.8863, -41.0693], [369.1, -49.86, -41.0682], [369.2, -49.8336, -41.067], [369.3, -49.8073, -41.0659], [369.4, -49.7809, -41.0647], [369.5, -49.7545, -41.0635], [369.6, -49.7281, -41.0623], [369.7, -49.7017, -41.0611], [369.8, -49.6753, -41.0599], [369.9, -49.6489, -41.0587], [370, -49.6224, -41.0574], [370.1, -49.596, -41.0562], [370.2, -49.5695, -41.0549], [370.3, -49.543, -41.0536], [370.4, -49.5166, -41.0523], [370.5, -49.4901, -41.051], [370.6, -49.4636, -41.0497], [370.7, -49.4371, -41.0484], [370.8, -49.4105, -41.0471], [370.9, -49.384, -41.0457], [371, -49.3575, -41.0444], [371.1, -49.3309, -41.043], [371.2, -49.3044, -41.0416], [371.3, -49.2778, -41.0402], [371.4, -49.2513, -41.0388], [371.5, -49.2247, -41.0374], [371.6, -49.1981, -41.036], [371.7, -49.1715, -41.0345], [371.8, -49.1449, -41.0331], [371.9, -49.1183, -41.0316], [372, -49.0918, -41.0301], [372.1, -49.0651, -41.0286], [372.2, -49.0385, -41.0271], [372.3, -49.0119, -41.0256], [372.4, -48.9853, -41.0241], [372.5, -48.9587, -41.0225], [372.6, -48.9321, -41.021], [372.7, -48.9054, -41.0194], [372.8, -48.8788, -41.0179], [372.9, -48.8522, -41.0163], [373, -48.8255, -41.0147], [373.1, -48.7989, -41.0131], [373.2, -48.7723, -41.0115], [373.3, -48.7456, -41.0098], [373.4, -48.719, -41.0082], [373.5, -48.6924, -41.0065], [373.6, -48.6657, -41.0049], [373.7, -48.6391, -41.0032], [373.8, -48.6124, -41.0015], [373.9, -48.5858, -40.9998], [374, -48.5592, -40.9981], [374.1, -48.5325, -40.9964], [374.2, -48.5059, -40.9946], [374.3, -48.4793, -40.9929], [374.4, -48.4526, -40.9911], [374.5, -48.426, -40.9893], [374.6, -48.3994, -40.9876], [374.7, -48.3727, -40.9858], [374.8, -48.3461, -40.984], [374.9, -48.3195, -40.9821], [375, -48.2929, -40.9803], [375.1, -48.2663, -40.9785], [375.2, -48.2396, -40.9766], [375.3, -48.213, -40.9748], [375.4, -48.1864, -40.9729], [375.5, -48.1598, -40.971], [375.6, -48.1332, -40.9691], [375.7, -48.1067, -40.9672], [375.8, -48.0801, -40.9653], [375.9, -48.0535, -40.9633], [376, -48.0269, -40.9614], [376.1, -48.0003, -40.9595], [376.2, -47.9738, -40.9575], [376.3, -47.9472, -40.9555], [376.4, -47.9207, -40.9535], [376.5, -47.8941, -40.9515], [376.6, -47.8676, -40.9495], [376.7, -47.8411, -40.9475], [376.8, -47.8146, -40.9455], [376.9, -47.788, -40.9434], [377, -47.7615, -40.9414], [377.1, -47.735, -40.9393], [377.2, -47.7085, -40.9372], [377.3, -47.6821, -40.9351], [377.4, -47.6556, -40.933], [377.5, -47.6291, -40.9309], [377.6, -47.6027, -40.9288], [377.7, -47.5762, -40.9267], [377.8, -47.5498, -40.9245], [377.9, -47.5234, -40.9224], [378, -47.4969, -40.9202], [378.1, -47.4705, -40.918], [378.2, -47.4441, -40.9158], [378.3, -47.4177, -40.9136], [378.4, -47.3914, -40.9114], [378.5, -47.365, -40.9092], [378.6, -47.3386, -40.907], [378.7, -47.3123, -40.9047], [378.8, -47.286, -40.9025], [378.9, -47.2596, -40.9002], [379, -47.2333, -40.8979], [379.1, -47.207, -40.8956], [379.2, -47.1807, -40.8933], [379.3, -47.1545, -40.891], [379.4, -47.1282, -40.8887], [379.5, -47.102, -40.8864], [379.6, -47.0757, -40.8841], [379.7, -47.0495, -40.8817], [379.8, -47.0233, -40.8793], [379.9, -46.9971, -40.877], [380, -46.9709, -40.8746], [380.1, -46.9447, -40.8722], [380.2, -46.9186, -40.8698], [380.3, -46.8924, -40.8674], [380.4, -46.8663, -40.8649], [380.5, -46.8402, -40.8625], [380.6, -46.8141, -40.8601], [380.7, -46.788, -40.8576], [380.8, -46.7619, -40.8551], [380.9, -46.7359, -40.8526], [381, -46.7098, -40.8502], [381.1, -46.6838, -40.8477], [381.2, -46.6578, -40.8451], [381.3, -46.6318, -40.8426], [381.4, -46.6058, -40.8401], [381.5, -46.5799, -40.8375], [381.6, -46.5539, -40.835], [381.7, -46.528, -40.8324], [381.8, -46.5021, -40.8299], [381.9, -46.4762, -40.8273], [382, -46.4503, -40.8247], [382.1, -46.4244, -40.8221], [382.2, -46.3986, -40.8195], [382.3, -46.3727, -40.8168], [382.4, -46.3469, -40.8142], [382.5, -46.3211, -40.8116], [382.6, -46.2953, -40.8089], [382.7, -46.2696, -40.8062], [382.8, -46.2438, -40.8036], [382.9, -46.2181, -40.8009], [383, -46.1924, -40.7982], [383.1, -46.1667, -40.7955], [383.2, -46.141, -40.7927], [383.3, -46.1154, -40.79], [383.4, -46.0897, -40.7873], [383.5, -46.0641, -40.7845], [383.6, -46.0385, -40.7818], [383.7, -46.0129, -40.779], [383.8, -45.9874, -40.7762], [383.9, -45.9618, -40.7734], [384, -45.9363, -40.7706], [384.1, -45.9108, -40.7678], [384.2, -45.8853, -40.765], [384.3, -45.8598, -40.7622], [384.4, -45.8344, -40.7594], [384.5, -45.809, -40.7565], [384.6, -45.7835, -40.7537], [384.7, -45.7582, -40.7508], [384.8, -45.7328, -40.7479], [384.9, -45.7074, -40.745], [385, -45.6821, -40.7421], [385.1, -45.6568, -40.7392], [385.2, -45.6315, -40.7363], [385.3, -45.6063, -40.7334], [385.4, -45.581, -40.7304], [385.5, -45.5558, -40.7275], [385.6, -45.5306, -40.7245], [385.7, -45.5054, -40.7216], [385.8, -45.4802, -40.7186], [385.9, -45.4551, -40.7156], [386, -45.43, -40.7126], [386.1, -45.4049, -40.7096], [386.2, -45.3798, -40.7066], [386.3, -45.3548, -40.7036], [386.4, -45.3297, -40.7006], [386.5, -45.3047, -40.6975], [386.6, -45.2797, -40.6945], [386.7, -45.2548, -40.6914], [386.8, -45.2298, -40.6883], [386.9, -45.2049, -40.6853], [387, -45.18, -40.6822], [387.1, -45.1551, -40.6791], [387.2, -45.1303, -40.676], [387.3, -45.1054, -40.6729], [387.4, -45.0806, -40.6697], [387.5, -45.0558, -40.6666], [387.6, -45.0311, -40.6635], [387.7, -45.0063, -40.6603], [387.8, -44.9816, -40.6571], [387.9, -44.9569, -40.654], [388, -44.9322, -40.6508], [388.1, -44.9076, -40.6476], [388.2, -44.883, -40.6444], [388.3, -44.8584, -40.6412], [388.4, -44.8338, -40.638], [388.5, -44.8092, -40.6348], [388.6, -44.7847, -40.6315], [388.7, -44.7602, -40.6283], [388.8, -44.7357, -40.625], [388.9, -44.7113, -40.6218], [389, -44.6868, -40.6185], [389.1, -44.6624, -40.6152], [389.2, -44.638, -40.6119], [389.3, -44.6137, -40.6086], [389.4, -44.5893, -40.6053], [389.5, -44.565, -40.602], [389.6, -44.5407, -40.5987], [389.7, -44.5165, -40.5954], [389.8, -44.4922, -40.592], [389.9, -44.468, -40.5887], [390, -44.4438, -40.5853], [390.1, -44.4196, -40.5819], [390.2, -44.3955, -40.5786], [390.3, -44.3714, -40.5752], [390.4, -44.3473, -40.5718], [390.5, -44.3232, -40.5684], [390.6, -44.2992, -40.565], [390.7, -44.2752, -40.5615], [390.8, -44.2512, -40.5581], [390.9, -44.2272, -40.5547], [391, -44.2033, -40.5512], [391.1, -44.1794, -40.5478], [391.2, -44.1555, -40.5443], [391.3, -44.1316, -40.5408], [391.4, -44.1078, -40.5374], [391.5, -44.084, -40.5339], [391.6, -44.0602, -40.5304], [391.7, -44.0364, -40.5269], [391.8, -44.0127, -40.5234], [391.9, -43.989, -40.5198], [392, -43.9653, -40.5163], [392.1, -43.9416, -40.5128], [392.2, -43.918, -40.5092], [392.3, -43.8944, -40.5057], [392.4, -43.8708, -40.5021], [392.5, -43.8473, -40.4985], [392.6, -43.8238, -40.495], [392.7, -43.8003, -40.4914], [392.8, -43.7768, -40.4878], [392.9, -43.7533, -40.4842], [393, -43.7299, -40.4806], [393.1, -43.7065, -40.4769], [393.2, -43.6832, -40.4733], [393.3, -43.6598, -40.4697], [393.4, -43.6365, -40.466], [393.5, -43.6132, -40.4624], [393.6, -43.59, -40.4587], [393.7, -43.5667, -40.4551], [393.8, -43.5435, -40.4514], [393.9, -43.5203, -40.4477], [394, -43.4972, -40.444], [394.1, -43.4741, -40.4403], [394.2, -43.451, -40.4366], [394.3, -43.4279, -40.4329], [394.4, -43.4048, -40.4292], [394.5, -43.3818, -40.4254], [394.6, -43.3588, -40.4217], [394.7, -43.3359, -40.418], [394.8, -43.3129, -40.4142], [394.9, -43.29, -40.4104], [395, -43.2672, -40.4067], [395.1, -43.2443, -40.4029], [395.2, -43.2215, -40.3991], [395.3, -43.1987, -40.3953], [395.4, -43.1759, -40.3915], [395.5, -43.1532, -40.3877], [395.6, -43.1305, -40.3839], [395.7, -43.1078, -40.3801], [395.8, -43.0851, -40.3762], [395.9, -43.0625, -40.3724], [396, -43.0399, -40.3686], [396.1, -43.0173, -40.3647], [396.2, -42.9947, -40.3608], [396.3, -42.9722, -40.357], [396.4, -42.9497, -40.3531], [396.5, -42.9273, -40.3492], [396.6, -42.9048, -40.3453], [396.7, -42.8824, -40.3414], [396.8, -42.86, -40.3375], [396.9, -42.8377, -40.3336], [397, -42.8154, -40.3297], [397.1, -42.7931, -40.3258], [397.2, -42.7708, -40.3218], [397.3, -42.7485, -40.3179], [397.4, -42.7263, -40.314], [397.5, -42.7041, -40.31], [397.6, -42.682, -40.306], [397.7, -42.6599, -40.3021], [397.8, -42.6378, -40.2981], [397.9, -42.6157, -40.2941], [398, -42.5936, -40.2901], [398.1, -42.5716, -40.2861], [398.2, -42.5496, -40.2821], [398.3, -42.5277, -40.2781], [398.4, -42.5057, -40.2741], [398.5, -42.4838, -40.2701], [398.6, -42.462, -40.266], [398.7, -42.4401, -40.262], [398.8, -42.4183, -40.258], [398.9, -42.3965, -40.2539], [399, -42.3748, -40.2498], [399.1, -42.353, -40.2458], [399.2, -42.3313, -40.2417], [399.3, -42.3096, -40.2376], [399.4, -42.288, -40.2335], [399.5, -42.2664, -40.2294], [399.6, -42.2448, -40.2253], [399.7, -42.2232, -40.2212], [399.8, -42.2017, -40.2171], [399.9, -42.1802, -40.213], [400, -42.1587, -40.2089], [400.1, -42.1373, -40.2047], [400.2, -42.1158, -40.2006], [400.3, -42.0945, -40.1965], [400.4, -42.0731, -40.1923], [400.5, -42.0518, -40.1882], [400.6, -42.0305, -40.184], [400.7, -42.0092, -40.1798], [400.8, -41.9879, -40.1756], [400.9, -41.9667, -40.1715], [401, -41.9455, -40.1673], [401.1, -41.9244, -40.1631], [401.2, -41.9032, -40.1589], [401.3, -41.8821, -40.1546], [401.4, -41.8611, -40.1504], [401.5, -41.84, -40.1462], [401.6, -41.819, -40.142], [401.7, -41.798, -40.1377], [401.8, -41.7771, -40.1335], [401.9, -41.7561, -40.1293], [402, -41.7352, -40.125], [402.1, -41.7144, -40.1207], [402.2, -41.6935, -40.1165], [402.3, -41.6727, -40.1122], [402.4, -41.6519, -40.1079], [402.5, -41.6312, -40.1036], [402.6, -41.6104, -40.0993], [402.7, -41.5897, -40.095], [402.8, -41.5691, -40.0907], [402.9, -41.5484, -40.0864], [403, -41.5278, -40.0821], [403.1, -41.5072, -40.0778], [403.2, -41.4867, -40.0735], [403.3, -41.4662, -40.0691], [403.4, -41.4457, -40.0648], [403.5, -41.4252, -40.0605], [403.6, -41.4048, -40.0561], [403.7, -41.3843, -40.0517], [403.8, -41.364, -40.0474], [403.9, -41.3436, -40.043], [404, -41.3233, -40.0386], [404.1, -41.303, -40.0343], [404.2, -41.2827, -40.0299], [404.3, -41.2625, -40.0255], [404.4, -41.2423, -40.0211], [404.5, -41.2221, -40.0167], [404.6, -41.202, -40.0123], [404.7, -41.1818, -40.0079], [404.8, -41.1618, -40.0034], [404.9, -41.1417, -39.999], [405, -41.1217, -39.9946], [405.1, -41.1017, -39.9901], [405.2, -41.0817, -39.9857], [405.3, -41.0617, -39.9813], [405.4, -41.0418, -39.9768], [405.5, -41.0219, -39.9723], [405.6, -41.0021, -39.9679], [405.7, -40.9822, -39.9634], [405.8, -40.9624, -39.9589], [405.9, -40.9427, -39.9545], [406, -40.9229, -39.95], [406.1, -40.9032, -39.9455], [406.2, -40.8835, -39.941], [406.3, -40.8639, -39.9365], [406.4, -40.8442, -39.932], [406.5, -40.8246, -39.9275], [406.6, -40.8051, -39.9229], [406.7, -40.7855, -39.9184], [406.8, -40.766, -39.9139], [406.9, -40.7465, -39.9094], [407, -40.7271, -39.9048], [407.1, -40.7076, -39.9003], [407.2, -40.6882, -39.8957], [407.3, -40.6689, -39.8912], [407.4, -40.6495, -39.8866], [407.5, -40.6302, -39.8821], [407.6, -40.6109, -39.8775], [407.7, -40.5917, -39.8729], [407.8, -40.5725, -39.8683], [407.9, -40.5533, -39.8637], [408, -40.5341, -39.8592], [408.1, -40.515, -39.8546], [408.2, -40.4958, -39.85], [408.3, -40.4768, -39.8454], [408.4, -40.4577, -39.8407], [408.5, -40.4387, -39.8361], [408.6, -40.4197, -39.8315], [408.7, -40.4007, -39.8269], [408.8, -40.3818, -39.8223], [408.9, -40.3629, -39.8176], [409, -40.344, -39.813], [409.1, -40.3251, -39.8083], [409.2, -40.3063, -39.8037], [409.3, -40.2875, -39.799], [409.4, -40.2688, -39.7944], [409.5, -40.25, -39.7897], [409.6, -40.2313, -39.7851], [409.7, -40.2126, -39.7804], [409.8, -40.194, -39.7757], [409.9, -40.1754, -39.771], [410, -40.1568, -39.7663], [410.1, -40.1382, -39.7616], [410.2, -40.1197, -39.757], [410.3, -40.1011, -39.7523], [410.4, -40.0827, -39.7476], [410.5, -40.0642, -39.7428], [410.6, -40.0458, -39.7381], [410.7, -40.0274, -39.7334], [410.8, -40.009, -39.7287], [410.9, -39.9907, -39.724], [411, -39.9724, -39.7192], [411.1, -39.9541, -39.7145], [411.2, -39.9358, -39.7098], [411.3, -39.9176, -39.705], [411.4, -39.8994, -39.7003], [411.5, -39.8812, -39.6955], [411.6, -39.8631, -39.6908], [411.7, -39.845, -39.686], [411.8, -39.8269, -39.6812], [411.9, -39.8088, -39.6765], [412, -39.7908, -39.6717], [412.1, -39.7728, -39.6669], [412.2, -39.7548, -39.6621], [412.3, -39.7369, -39.6573], [412.4, -39.719, -39.6525], [412.5, -39.7011, -39.6478], [412.6, -39.6832, -39.643], [412.7, -39.6654, -39.6381], [412.8, -39.6476, -39.6333], [412.9, -39.6298, -39.6285], [413, -70, -39.6237], [413.1, -68.903, -39.6338], [413.2, -67.8309, -39.6433], [413.3, -66.7831, -39.6524], [413.4, -65.7591, -39.6608], [413.5, -64.7584, -39.6688], [413.6, -63.7807, -39.6762], [413.7, -62.8253, -39.6832], [413.8, -61.8918, -39.6897], [413.9, -60.9798, -39.6957], [414, -60.0889, -39.7013], [414.1, -59.2186, -39.7064], [414.2, -58.3684, -39.7111], [414.3, -57.538, -39.7154], [414.4, -56.7269, -39.7192], [414.5, -55.9348, -39.7226], [414.6, -55.1612, -39.7257], [414.7, -54.4058, -39.7284], [414.8, -53.6682, -39.7306], [414.9, -52.948, -39.7326], [415, -52.2449, -39.7341], [415.1, -51.5584, -39.7353], [415.2, -50.8884, -39.7362], [415.3, -50.2343, -39.7368], [415.4, -49.596, -39.737], [415.5, -48.9729, -39.7369], [415.6, -48.365, -39.7365], [415.7, -47.7717, -39.7358], [415.8, -47.1929, -39.7348], [415.9, -46.6281, -39.7335], [416, -46.0772, -39.7319], [416.1, -45.5398, -39.7301], [416.2, -45.0157, -39.728], [416.3, -44.5045, -39.7257], [416.4, -44.006, -39.7231], [416.5, -43.5199, -39.7202], [416.6, -43.046, -39.7171], [416.7, -42.584, -39.7138], [416.8, -42.1337, -39.7103], [416.9, -41.6948, -39.7066], [417, -41.267, -39.7026], [417.1, -40.8502, -39.6984], [417.2, -40.444, -39.694], [417.3, -40.0483, -39.6895], [417.4, -70, -39.6847], [417.5, -68.9552, -39.6948], [417.6, -67.9349, -39.7043], [417.7, -66.9386, -39.7133], [417.8, -65.9657, -39.7218], [417.9, -65.0159, -39.7298], [418, -64.0885, -39.7373], [418.1, -63.1831, -39.7444], [418.2, -62.2994, -39.751], [418.3, -61.4368, -39.7572], [418.4, -60.5948, -39.763], [418.5, -59.7731, -39.7683], [418.6, -58.9712, -39.7732], [418.7, -58.1888, -39.7777], [418.8, -57.4253, -39.7818], [418.9, -56.6805, -39.7856], [419, -55.9539, -39.7889], [419.1, -55.2451, -39.7919], [419.2, -54.5537, -39.7946], [419.3, -53.8795, -39.7969], [419.4, -53.222, -39.7989], [419.5, -52.5808, -39.8005], [419.6, -51.9557, -39.8019], [419.7, -51.3463, -39.8029], [419.8, -50.7523, -39.8036], [419.9, -50.1733, -39.804], [420, -49.609, -39.8042], [420.1, -49.0591, -39.804], [420.2, -48.5233, -39.8036], [420.3, -48.0013, -39.8029], [420.4, -47.4928, -39.802], [420.5, -46.9975, -39.8008], [420.6, -46.5151, -39.7994], [420.7, -46.0454, -39.7978], [420.8, -45.5881, -39.7959], [420.9, -45.143, -39.7938], [421, -44.7096, -39.7914], [421.1, -44.2879, -39.7889], [421.2, -43.8776, -39.7861], [421.3, -43.4783, -39.7832], [421.4, -43.0899, -39.78], [421.5, -42.7122, -39.7767], [421.6, -42.3449, -39.7732], [421.7, -41.9877, -39.7695], [421.8, -41.6405, -39.7656], [421.9, -41.3031, -39.7616], [422, -40.9752, -39.7574], [422.1, -40.6566, -39.7531], [422.2, -40.3471, -39.7486], [422.3, -40.0466, -39.7439], [422.4, -39.7548, -39.7391], [422.5, -70, -39.7342], [422.6, -69.0012, -39.7442], [422.7, -68.0266, -39.7537], [422.8, -67.0756, -39.7627], [422.9, -66.1478, -39.7713], [423, -65.2426, -39.7793], [423.1, -64.3597, -39.787], [423.2, -63.4985, -39.7941], [423.3, -62.6585, -39.8009], [423.4, -61.8393, -39.8072], [423.5, -61.0405, -39.8131], [423.6, -60.2617, -39.8186], [423.7, -59.5024, -39.8237], [423.8, -58.7622, -39.8285], [423.9, -58.0407, -39.8328], [424, -57.3375, -39.8368], [424.1, -56.6523, -39.8405], [424.2, -55.9845, -39.8438], [424.3, -55.334, -39.8468], [424.4, -54.7002, -39.8494], [424.5, -54.0829, -39.8518], [424.6, -53.4817, -39.8538], [424.7, -52.8962, -39.8556], [424.8, -52.3261, -39.857], [424.9, -51.7711, -39.8582], [425, -51.2308, -39.8591], [425.1, -50.705, -39.8597], [425.2, -50.1933, -39.86], [425.3, -49.6954, -39.8602], [425.4, -49.2111, -39.86], [425.5, -48.74, -39.8596], [425.6, -48.2818, -39.859], [425.7, -47.8363, -39.8582], [425.8, -47.4031, -39.8572], [425.9, -46.9821, -39.8559], [426, -46.5729, -39.8544], [426.1, -46.1754, -39.8528], [426.2, -45.7892, -39.8509], [426.3, -45.414, -39.8488], [426.4, -45.0498, -39.8466], [426.5, -44.6961, -39.8442], [426.6, -44.3528, -39.8416], [426.7, -44.0197, -39.8389], [426.8, -43.6965, -39.836], [426.9, -43.383, -39.8329], [427, -43.0789, -39.8297], [427.1, -42.7842, -39.8263], [427.2, -42.4986, -39.8228], [427.3, -42.2218, -39.8192], [427.4, -41.9537, -39.8154], [427.5, -41.6941, -39.8115], [427.6, -41.4428, -39.8075], [427.7, -41.1995, -39.8033], [427.8, -40.9643, -39.7991], [427.9, -40.7367, -39.7947], [428, -40.5167, -39.7902], [428.1, -40.3042, -39.7856], [428.2, -40.0988, -39.7809], [428.3, -39.9005, -39.7762], [428.4, -70, -39.7713], [428.5, -69.0401, -39.7813], [428.6, -68.104, -39.7908], [428.7, -67.1913, -39.7998], [428.8, -66.3015, -39.8084], [428.9, -65.4342, -39.8165], [429, -64.5887, -39.8242], [429.1, -63.7647, -39.8314], [429.2, -62.9617, -39.8383], [429.3, -62.1792, -39.8447], [429.4, -61.4169, -39.8507], [429.5, -60.6743, -39.8564], [429.6, -59.9509, -39.8617], [429.7, -59.2464, -39.8666], [429.8, -58.5603, -39.8712], [429.9, -57.8923, -39.8755], [430, -57.242, -39.8794], [430.1, -56.6089, -39.8829], [430.2, -55.9928, -39.8862], [430.3, -55.3932, -39.8892], [430.4, -54.8098, -39.8918], [430.5, -54.2423, -39.8942], [430.6, -53.6903, -39.8963], [430.7, -53.1534, -39.8981], [430.8, -52.6313, -39.8996], [430.9, -52.1238, -39.9009], [431, -51.6305, -39.902], [431.1, -51.1511, -39.9027], [431.2, -50.6852, -39.9033], [431.3, -50.2326, -39.9036], [431.4, -49.7931, -39.9037], [431.5, -49.3662, -39.9036], [431.6, -48.9518, -39.9033], [431.7, -48.5495, -39.9028], [431.8, -48.1592, -39.902], [431.9, -47.7804, -39.9011], [432, -47.413, -39.9], [432.1, -47.0568, -39.8987], [432.2, -46.7114, -39.8973], [432.3, -46.3766, -39.8956], [432.4, -46.0523, -39.8939], [432.5, -45.7381, -39.8919], [432.6, -45.4338, -39.8898], [432.7, -45.1393, -39.8876], [432.8, -44.8542, -39.8852], [432.9, -44.5785, -39.8826], [433, -44.3117, -39.88], [433.1, -44.0539, -39.8772], [433.2, -43.8047, -39.8743], [433.3, -43.564, -39.8713], [433.4, -43.3316, -39.8681], [433.5, -43.1072, -39.8648], [433.6, -42.8908, -39.8615], [433.7, -42.6821, -39.858], [433.8, -42.4809, -39.8544], [433.9, -42.2871, -39.8508], [434, -42.1005, -39.847], [434.1, -41.9209, -39.8432], [434.2, -41.7482, -39.8393], [434.3, -41.5822, -39.8353], [434.4, -41.4228, -39.8312], [434.5, -41.2697, -39.827], [434.6, -41.1229, -39.8228], [434.7, -40.9822, -39.8185], [434.8, -40.8475, -39.8141], [434.9, -40.7186, -39.8097], [435, -40.5954, -39.8052], [435.1, -40.4777, -39.8007], [435.2, -40.3654, -39.7961], [435.3, -40.2584, -39.7915], [435.4, -40.1566, -39.7868], [435.5, -40.0598, -39.7821], [435.6, -39.9679, -39.7773], [435.7, -39.8808, -39.7725], [435.8, -39.7984, -39.7676], [435.9, -70, -39.7627], [436, -69.0682, -39.7727], [436.1, -68.1601, -39.7823], [436.2, -67.2752, -39.7913], [436.3, -66.413, -39.8], [436.4, -65.573, -39.8081], [436.5, -64.7547, -39.8159], [436.6, -63.9577, -39.8233], [436.7, -63.1815, -39.8302], [436.8, -62.4257, -39.8368], [436.9, -61.6898, -39.843], [437, -60.9734, -39.8488], [437.1, -60.2761, -39.8542], [437.2, -59.5975, -39.8594], [437.3, -58.9371, -39.8641], [437.4, -58.2946, -39.8686], [437.5, -57.6696, -39.8727], [437.6, -57.0617, -39.8765], [437.7, -56.4705, -39.88], [437.8, -55.8957, -39.8832], [437.9, -55.3369, -39.8861], [438, -54.7938, -39.8888], [438.1, -54.266, -39.8911], [438.2, -53.7532, -39.8932], [438.3, -53.2551, -39.8951], [438.4, -52.7713, -39.8967], [438.5, -52.3015, -39.8981], [438.6, -51.8455, -39.8992], [438.7, -51.4029, -39.9001], [438.8, -50.9733, -39.9008], [438.9, -50.5567, -39.9013], [439, -50.1525, -39.9016], [439.1, -49.7606, -39.9017], [439.2, -49.3808, -39.9015], [439.3, -49.0126, -39.9012], [439.4, -48.6559, -39.9007], [439.5, -48.3104, -39.9001], [439.6, -47.9759, -39.8993], [439.7, -47.6521, -39.8983], [439.8, -47.3388, -39.8971], [439.9, -47.0357, -39.8958], [440, -46.7425, -39.8944], [440.1, -46.4592, -39.8928], [440.2, -46.1855, -39.891], [440.3, -45.921, -39.8892], [440.4, -45.6657, -39.8872], [440.5, -45.4193, -39.8851], [440.6, -45.1816, -39.8828], [440.7, -44.9525, -39.8805], [440.8, -44.7316, -39.878], [440.9, -44.5189, -39.8754], [441, -44.3141, -39.8728], [441.1, -44.1171, -39.87], [441.2, -43.9276, -39.8672], [441.3, -43.7456, -39.8642], [441.4, -43.5707, -39.8612], [441.5, -43.403, -39.8581], [441.6, -43.2421, -39.8549], [441.7, -43.0879, -39.8516], [441.8, -42.9403, -39.8482], [441.9, -42.7991, -39.8448], [442, -42.6642, -39.8414], [442.1, -42.5354, -39.8378], [442.2, -42.4125, -39.8342], [442.3, -42.2955, -39.8306], [442.4, -42.1841, -39.8268], [442.5, -42.0783, -39.8231], [442.6, -41.9779, -39.8193], [442.7, -41.8828, -39.8154], [442.8, -41.7928, -39.8115], [442.9, -41.7079, -39.8076], [443, -41.6278, -39.8036], [443.1, -41.5525, -39.7996], [443.2, -41.4819, -39.7956], [443.3, -41.4159, -39.7915], [443.4, -41.3542, -39.7874], [443.5, -41.2969, -39.7833], [443.6, -41.2438, -39.7791], [443.7, -41.1948, -39.775], [443.8, -41.1498, -39.7708], [443.9, -41.1087, -39.7666], [444, -41.0713, -39.7624], [444.1, -41.0377, -39.7581], [444.2, -41.0077, -39.7539], [444.3, -40.9812, -39.7496], [444.4, -40.9581, -39.7454], [444.5, -40.9384, -39.7411], [444.6, -40.9219, -39.7368], [444.7, -40.9085, -39.7325], [444.8, -40.8982, -39.7283], [444.9, -40.8909, -39.724], [445, -40.8865, -39.7197], [445.1, -40.885, -39.7154], [445.2, -40.8861, -39.7112], [445.3, -40.89, -39.7069], [445.4, -40.8965, -39.7026], [445.5, -40.9055, -39.6984], [445.6, -40.9169, -39.6941], [445.7, -40.9308, -39.6899], [445.8, -40.9469, -39.6857], [445.9, -40.9653, -39.6815], [446, -40.9859, -39.6773], [446.1, -41.0087, -39.6731], [446.2, -41.0335, -39.669], [446.3, -41.0603, -39.6648], [446.4, -41.089, -39.6607], [446.5, -41.1196, -39.6566], [446.6, -41.1521, -39.6525], [446.7, -41.1863, -39.6484], [446.8, -41.2223, -39.6444], [446.9, -41.2599, -39.6404], [447, -41.2991, -39.6364], [447.1, -41.3399, -39.6324], [447.2, -41.3822, -39.6284], [447.3, -41.426, -39.6245], [447.4, -41.4712, -39.6206], [447.5, -41.5177, -39.6167], [447.6, -41.5656, -39.6129], [447.7, -41.6147, -39.6091], [447.8, -41.6651, -39.6053], [447.9, -41.7167, -39.6015], [448, -41.7694, -39.5978], [448.1, -41.8233, -39.5941], [448.2, -41.8782, -39.5904], [448.3, -41.9341, -39.5868], [448.4, -41.991, -39.5832], [448.5, -42.0489, -39.5796], [448.6, -42.1077, -39.5761], [448.7, -42.1674, -39.5726], [448.8, -42.228, -39.5691], [448.9, -42.2893, -39.5657], [449, -42.3515, -39.5623], [449.1, -42.4143, -39.5589], [449.2, -42.4779, -39.5556], [449.3, -42.5422, -39.5523], [449.4, -42.6072, -39.549], [449.5, -42.6728, -39.5458], [449.6, -42.7389, -39.5426], [449.7, -42.8057, -39.5394], [449.8, -42.873, -39.5363], [449.9, -42.9408, -39.5332], [450, -43.0091, -39.5302], [450.1, -43.0778, -39.5272], [450.2, -43.147, -39.5242], [450.3, -43.2166, -39.5213], [450.4, -43.2866, -39.5184], [450.5, -43.3569, -39.5155], [450.6, -43.4277, -39.5127], [450.7, -43.4987, -39.5099], [450.8, -43.57, -39.5072], [450.9, -43.6416, -39.5045], [451, -43.7135, -39.5018], [451.1, -43.7856, -39.4992], [451.2, -43.8579, -39.4966], [451.3, -43.9304, -39.4941], [451.4, -44.0031, -39.4916], [451.5, -44.0759, -39.4891], [451.6, -44.1489, -39.4867], [451.7, -44.2221, -39.4843], [451.8, -44.2953, -39.4819], [451.9, -44.3686, -39.4796], [452, -44.442, -39.4773], [452.1, -44.5155, -39.4751], [452.2, -44.589, -39.4729], [452.3, -44.6625, -39.4707], [452.4, -44.7361, -39.4686], [452.5, -44.8097, -39.4665], [452.6, -44.8832, -39.4645], [452.7, -44.9567, -39.4625], [452.8, -45.0302, -39.4605], [452.9, -45.1036, -39.4586], [453, -45.177, -39.4567], [453.1, -45.2503, -39.4549], [453.2, -45.3235, -39.453], [453.3, -45.3966, -39.4513], [453.4, -45.4696, -39.4495], [453.5, -45.5425, -39.4478], [453.6, -45.6152, -39.4462], [453.7, -45.6878, -39.4446], [453.8, -45.7602, -39.443], [453.9, -45.8325, -39.4414], [454, -45.9046, -39.4399], [454.1, -45.9765, -39.4385], [454.2, -46.0483, -39.437], [454.3, -46.1198, -39.4356], [454.4, -46.1912, -39.4343], [454.5, -46.2623, -39.433], [454.6, -46.3332, -39.4317], [454.7, -46.4038, -39.4304], [454.8, -46.4742, -39.4292], [454.9, -46.5444, -39.428], [455, -46.6143, -39.4269], [455.1, -46.684, -39.4258], [455.2, -46.7534, -39.4247], [455.3, -46.8225, -39.4237], [455.4, -46.8914, -39.4227], [455.5, -46.9599, -39.4218], [455.6, -47.0282, -39.4208], [455.7, -47.0962, -39.4199], [455.8, -47.1638, -39.4191], [455.9, -47.2312, -39.4183], [456, -47.2983, -39.4175], [456.1, -47.365, -39.4167], [456.2, -47.4314, -39.416], [456.3, -47.4975, -39.4153], [456.4, -47.5632, -39.4147], [456.5, -47.6286, -39.4141], [456.6, -47.6937, -39.4135], [456.7, -47.7584, -39.4129], [456.8, -47.8228, -39.4124], [456.9, -47.8868, -39.4119], [457, -47.9505, -39.4115], [457.1, -48.0138, -39.4111], [457.2, -48.0768, -39.4107], [457.3, -48.1393, -39.4103], [457.4, -48.2015, -39.41], [457.5, -48.2634, -39.4097], [457.6, -48.3249, -39.4094], [457.7, -48.3859, -39.4092], [457.8, -48.4466, -39.409], [457.9, -48.507, -39.4088], [458, -48.5669, -39.4087], [458.1, -48.6265, -39.4086], [458.2, -48.6856, -39.4085], [458.3, -48.7444, -39.4084], [458.4, -48.8028, -39.4084], [458.5, -48.8608, -39.4084], [458.6, -48.9184, -39.4085], [458.7, -48.9755, -39.4085], [458.8, -49.0323, -39.4086], [458.9, -49.0887, -39.4087], [459, -49.1447, -39.4089], [459.1, -49.2003, -39.4091], [459.2, -49.2554, -39.4093], [459.3, -49.3102, -39.4095], [459.4, -49.3646, -39.4098], [459.5, -49.4185, -39.4101], [459.6, -49.4721, -39.4104], [459.7, -49.5252, -39.4107], [459.8, -49.5779, -39.4111], [459.9, -49.6302, -39.4115], [460, -49.6821, -39.4119], [460.1, -49.7336, -39.4123], [460.2, -49.7846, -39.4128], [460.3, -49.8353, -39.4133], [460.4, -49.8855, -39.4138], [460.5, -49.9353, -39.4143], [460.6, -49.9848, -39.4149], [460.7, -50.0337, -39.4155], [460.8, -50.0823, -39.4161], [460.9, -50.1305, -39.4167], [461, -50.1782, -39.4174], [461.1, -50.2255, -39.4181], [461.2, -50.2725, -39.4188], [461.3, -50.319, -39.4195], [461.4, -50.365, -39.4203], [461.5, -50.4107, -39.421], [461.6, -50.4559, -39.4218], [461.7, -50.5008, -39.4227], [461.8, -50.5452, -39.4235], [461.9, -50.5892, -39.4244], [462, -50.6328, -39.4252], [462.1, -50.676, -39.4261], [462.2, -50.7188, -39.4271], [462.3, -50.7611, -39.428], [462.4, -50.8031, -39.429], [462.5, -50.8446, -39.43], [462.6, -50.8857, -39.431], [462.7, -50.9265, -39.432], [462.8, -50.9668, -39.433], [462.9, -51.0067, -39.4341], [463, -51.0462, -39.4352], [463.1, -51.0853, -39.4363], [463.2, -51.124, -39.4374], [463.3, -51.1622, -39.4385], [463.4, -51.2001, -39.4397], [463.5, -51.2376, -39.4408], [463.6, -51.2747, -39.442], [463.7, -51.3113, -39.4432], [463.8, -51.3476, -39.4444], [463.9, -51.3835, -39.4457], [464, -51.419, -39.4469], [464.1, -51.4541, -39.4482], [464.2, -51.4888, -39.4495], [464.3, -51.5231, -39.4508], [464.4, -51.557, -39.4521], [464.5, -51.5905, -39.4534], [464.6, -51.6236, -39.4548], [464.7, -51.6563, -39.4562], [464.8, -51.6887, -39.4575], [464.9, -51.7206, -39.4589], [465, -51.7522, -39.4603], [465.1, -51.7834, -39.4618], [465.2, -51.8142, -39.4632], [465.3, -51.8446, -39.4646], [465.4, -51.8747, -39.4661], [465.5, -51.9044, -39.4676], [465.6, -51.9336, -39.4691], [465.7, -51.9626, -39.4706], [465.8, -51.9911, -39.4721], [465.9, -52.0193, -39.4736], [466, -52.0471, -39.4752], [466.1, -52.0745, -39.4767], [466.2, -52.1016, -39.4783], [466.3, -52.1283, -39.4799], [466.4, -52.1546, -39.4815], [466.5, -52.1805, -39.4831], [466.6, -52.2061, -39.4847], [466.7, -52.2314, -39.4863], [466.8, -52.2563, -39.4879], [466.9, -52.2808, -39.4896], [467, -52.305, -39.4912], [467.1, -52.3288, -39.4929], [467.2, -52.3522, -39.4946], [467.3, -52.3753, -39.4963], [467.4, -52.3981, -39.498], [467.5, -52.4205, -39.4997], [467.6, -52.4425, -39.5014], [467.7, -52.4642, -39.5031], [467.8, -52.4856, -39.5048], [467.9, -52.5066, -39.5066], [468, -52.5273, -39.5083], [468.1, -52.5477, -39.5101], [468.2, -52.5677, -39.5119], [468.3, -52.5873, -39.5136], [468.4, -52.6067, -39.5154], [468.5, -52.6257, -39.5172], [468.6, -52.6443, -39.519], [468.7, -52.6627, -39.5208], [468.8, -52.6807, -39.5226], [468.9, -52.6984, -39.5245], [469, -52.7157, -39.5263], [469.1, -52.7328, -39.5281], [469.2, -52.7495, -39.53], [469.3, -52.7659, -39.5318], [469.4, -52.782, -39.5337], [469.5, -52.7977, -39.5355], [469.6, -52.8132, -39.5374], [469.7, -52.8283, -39.5393], [469.8, -52.8431, -39.5411], [469.9, -52.8576, -39.543], [470, -52.8718, -39.5449], [470.1, -52.8857, -39.5468], [470.2, -52.8993, -39.5487], [470.3, -52.9126, -39.5506], [470.4, -52.9255, -39.5525], [470.5, -52.9382, -39.5544], [470.6, -52.9506, -39.5563], [470.7, -52.9627, -39.5583], [470.8, -52.9744, -39.5602], [470.9, -52.9859, -39.5621], [471, -52.9971, -39.5641], [471.1, -53.008, -39.566], [471.2, -53.0186, -39.5679], [471.3, -53.029, -39.5699], [471.4, -53.039, -39.5718], [471.5, -53.0488, -39.5738], [471.6, -53.0582, -39.5757], [471.7, -53.0674, -39.5777], [471.8, -53.0763, -39.5796], [471.9, -53.085, -39.5816], [472, -53.0933, -39.5836], [472.1, -53.1014, -39.5855], [472.2, -53.1092, -39.5875], [472.3, -53.1168, -39.5895], [472.4, -53.124, -39.5914], [472.5, -53.131, -39.5934], [472.6, -53.1377, -39.5954], [472.7, -53.1442, -39.5973], [472.8, -53.1504, -39.5993], [472.9, -53.1563, -39.6013], [473, -53.162, -39.6033], [473.1, -53.1674, -39.6052], [473.2, -53.1726, -39.6072], [473.3, -53.1775, -39.6092], [473.4, -53.1821, -39.6112], [473.5, -53.1865, -39.6132], [473.6, -53.1907, -39.6151], [473.7, -53.1945, -39.6171], [473.8, -53.1982, -39.6191], [473.9, -53.2016, -39.6211], [474, -53.2047, -39.6231], [474.1, -53.2076, -39.625], [474.2, -53.2103, -39.627], [474.3, -53.2127, -39.629], [474.4, -53.2149, -39.631], [474.5, -53.2168, -39.633], [474.6, -53.2185, -39.6349], [474.7, -53.22, -39.6369], [474.8, -53.2212, -39.6389], [474.9, -53.2222, -39.6408], [475, -53.223, -39.6428], [475.1, -53.2235, -39.6448], [475.2, -53.2238, -39.6467], [475.3, -53.2239, -39.6487], [475.4, -53.2238, -39.6507], [475.5, -53.2234, -39.6526], [475.6, -53.2228, -39.6546], [475.7, -53.222, -39.6565], [475.8, -53.221, -39.6585], [475.9, -53.2198, -39.6605], [476, -53.2183, -39.6624], [476.1, -53.2166, -39.6643], [476.2, -53.2147, -39.6663], [476.3, -53.2126, -39.6682], [476.4, -53.2103, -39.6702], [476.5, -53.2078, -39.6721], [476.6, -53.205, -39.674], [476.7, -53.2021, -39.676], [476.8, -53.199, -39.6779], [476.9, -53.1956, -39.6798], [477, -53.1921, -39.6817], [477.1, -53.1883, -39.6836], [477.2, -53.1844, -39.6855], [477.3, -53.1802, -39.6874], [477.4, -53.1759, -39.6893], [477.5, -53.1713, -39.6912], [477.6, -53.1666, -39.6931], [477.7, -53.1616, -39.695], [477.8, -53.1565, -39.6969], [477.9, -53.1512, -39.6988], [478, -53.1457, -39.7007], [478.1, -53.14, -39.7025], [478.2, -53.1341, -39.7044], [478.3, -53.128, -39.7062], [478.4, -53.1218, -39.7081], [478.5, -53.1153, -39.71], [478.6, -53.1087, -39.7118], [478.7, -53.1019, -39.7136], [478.8, -53.095, -39.7155], [478.9, -53.0878, -39.7173], [479, -53.0805, -39.7191], [479.1, -53.073, -39.7209], [479.2, -53.0653, -39.7228], [479.3, -53.0574, -39.7246], [479.4, -53.0494, -39.7264], [479.5, -53.0412, -39.7282], [479.6, -53.0328, -39.73], [479.7, -53.0243, -39.7317], [479.8, -53.0156, -39.7335], [479.9, -53.0067, -39.7353], [480, -52.9977, -39.737], [480.1, -52.9885, -39.7388], [480.2, -52.9791, -39.7406], [480.3, -52.9696, -39.7423], [480.4, -52.9599, -39.744], [480.5, -52.9501, -39.7458], [480.6, -52.9401, -39.7475], [480.7, -52.9299, -39.7492], [480.8, -52.9196, -39.7509], [480.9, -52.9092, -39.7526], [481, -52.8985, -39.7543], [481.1, -52.8878, -39.756], [481.2, -52.8769, -39.7577], [481.3, -52.8658, -39.7594], [481.4, -52.8546, -39.7611], [481.5, -52.8432, -39.7627], [481.6, -52.8317, -39.7644], [481.7, -52.82, -39.766], [481.8, -52.8082, -39.7677], [481.9, -52.7963, -39.7693], [482, -52.7842, -39.7709], [482.1, -52.772, -39.7725], [482.2, -52.7596, -39.7742], [482.3, -52.7471, -39.7758], [482.4, -52.7345, -39.7773], [482.5, -52.7217, -39.7789], [482.6, -52.7088, -39.7805], [482.7, -52.6957, -39.7821], [482.8, -52.6825, -39.7836], [482.9, -52.6692, -39.7852], [483, -52.6558, -39.7867], [483.1, -52.6422, -39.7883], [483.2, -52.6285, -39.7898], [483.3, -52.6147, -39.7913], [483.4, -52.6007, -39.7928], [483.5, -52.5866, -39.7943], [483.6, -52.5724, -39.7958], [483.7, -52.558, -39.7973], [483.8, -52.5436, -39.7988], [483.9, -52.529, -39.8003], [484, -52.5143, -39.8017], [484.1, -52.4995, -39.8032], [484.2, -52.4845, -39.8046], [484.3, -52.4694, -39.8061], [484.4, -52.4543, -39.8075], [484.5, -52.439, -39.8089], [484.6, -52.4235, -39.8103], [484.7, -52.408, -39.8117], [484.8, -52.3924, -39.8131], [484.9, -52.3766, -39.8145], [485, -52.3607, -39.8158], [485.1, -52.3447, -39.8172], [485.2, -52.3287, -39.8185], [485.3, -52.3125, -39.8199], [485.4, -52.2961, -39.8212], [485.5, -52.2797, -39.8225], [485.6, -52.2632, -39.8239], [485.7, -52.2466, -39.8252], [485.8, -52.2298, -39.8264], [485.9, -52.213, -39.8277], [486, -52.1961, -39.829], [486.1, -52.179, -39.8303], [486.2, -52.1619, -39.8315], [486.3, -52.1446, -39.8328], [486.4, -52.1273, -39.834], [486.5, -52.1098, -39.8352], [486.6, -52.0923, -39.8364], [486.7, -52.0747, -39.8376], [486.8, -52.0569, -39.8388], [486.9, -52.0391, -39.84], [487, -52.0212, -39.8412], [487.1, -52.0031, -39.8424], [487.2, -51.985, -39.8435], [487.3, -51.9668, -39.8447], [487.4, -51.9485, -39.8458], [487.5, -51.9301, -39.8469], [487.6, -51.9117, -39.848], [487.7, -51.8931, -39.8491], [487.8, -51.8745, -39.8502], [487.9, -51.8557, -39.8513], [488, -51.8369, -39.8524], [488.1, -51.818, -39.8534], [488.2, -51.799, -39.8545], [488.3, -51.7799, -39.8555], [488.4, -51.7607, -39.8566], [488.5, -51.7415, -39.8576], [488.6, -51.7222, -39.8586], [488.7, -51.7027, -39.8596], [488.8, -51.6833, -39.8606], [488.9, -51.6637, -39.8615], [489, -51.644, -39.8625], [489.1, -51.6243, -39.8635], [489.2, -51.6045, -39.8644], [489.3, -51.5846, -39.8653], [489.4, -51.5647, -39.8663], [489.5, -51.5446, -39.8672], [489.6, -51.5245, -39.8681], [489.7, -51.5043, -39.869], [489.8, -51.4841, -39.8698], [489.9, -51.4638, -39.8707], [490, -51.4434, -39.8716], [490.1, -51.4229, -39.8724], [490.2, -51.4024, -39.8732], [490.3, -51.3817, -39.8741], [490.4, -51.3611, -39.8749], [490.5, -51.3403, -39.8757], [490.6, -51.3195, -39.8765], [490.7, -51.2986, -39.8772], [490.8, -51.2777, -39.878], [490.9, -51.2567, -39.8788], [491, -51.2356, -39.8795], [491.1, -51.2144, -39.8802], [491.2, -51.1932, -39.881], [491.3, -51.172, -39.8817], [491.4, -51.1506, -39.8824], [491.5, -51.1292, -39.8831], [491.6, -51.1078, -39.8837], [491.7, -51.0863, -39.8844], [491.8, -51.0647, -39.885], [491.9, -51.0431, -39.8857], [492, -51.0214, -39.8863], [492.1, -50.9996, -39.8869], [492.2, -50.9778, -39.8875], [492.3, -50.9559, -39.8881], [492.4, -50.934, -39.8887], [492.5, -50.9121, -39.8893], [492.6, -50.89, -39.8899], [492.7, -50.8679, -39.8904], [492.8, -50.8458, -39.8909], [492.9, -50.8236, -39.8915], [493, -50.8014, -39.892], [493.1, -50.7791, -39.8925], [493.2, -50.7567, -39.893], [493.3, -50.7343, -39.8935], [493.4, -50.7119, -39.8939], [493.5, -50.6894, -39.8944], [493.6, -50.6668, -39.8948], [493.7, -50.6442, -39.8953], [493.8, -50.6216, -39.8957], [493.9, -50.5989, -39.8961], [494, -50.5762, -39.8965], [494.1, -50.5534, -39.8969], [494.2, -50.5305, -39.8972], [494.3, -50.5077, -39.8976], [494.4, -50.4848, -39.898], [494.5, -50.4618, -39.8983], [494.6, -50.4388, -39.8986], [494.7, -50.4157, -39.8989], [494.8, -50.3926, -39.8992], [494.9, -50.3695, -39.8995], [495, -50.3463, -39.8998], [495.1, -50.3231, -39.9001], [495.2, -50.2999, -39.9003], [495.3, -50.2766, -39.9006], [495.4, -50.2532, -39.9008], [495.5, -50.2298, -39.901], [495.6, -50.2064, -39.9012], [495.7, -50.183, -39.9014], [495.8, -50.1595, -39.9016], [495.9, -50.136, -39.9018], [496, -50.1124, -39.902], [496.1, -50.0888, -39.9021], [496.2, -50.0652, -39.9022], [496.3, -50.0415, -39.9024], [496.4, -50.0178, -39.9025], [496.5, -49.9941, -39.9026], [496.6, -49.9703, -39.9027], [496.7, -49.9465, -39.9027], [496.8, -49.9226, -39.9028], [496.9, -49.8988, -39.9029], [497, -49.8749, -39.9029], [497.1, -49.8509, -39.9029], [497.2, -49.827, -39.9029], [497.3, -49.803, -39.9029], [497.4, -49.779, -39.9029], [497.5, -49.7549, -39.9029], [497.6, -49.7308, -39.9029], [497.7, -49.7067, -39.9028], [497.8, -49.6826, -39.9028], [497.9, -49.6584, -39.9027], [498, -49.6342, -39.9026], [498.1, -49.61, -39.9026], [498.2, -49.5857, -39.9024], [498.3, -49.5615, -39.9023], [498.4, -49.5372, -39.9022], [498.5, -49.5129, -39.9021], [498.6, -49.4885, -39.9019], [498.7, -49.4641, -39.9017], [498.8, -49.4397, -39.9016], [498.9, -49.4153, -39.9014], [499, -49.3909, -39.9012], [499.1, -49.3664, -39.901], [499.2, -49.3419, -39.9008], [499.3, -49.3174, -39.9005], [499.4, -49.2929, -39.9003], [499.5, -49.2683, -39.9], [499.6, -49.2438, -39.8997], [499.7, -49.2192, -39.8995], [499.8, -49.1945, -39.8992], [499.9, -49.1699, -39.8988], [500, -49.1453, -39.8985]])
+
+plt.figure()
+plt.plot(data.T[0,:], data.T[1,:])
+plt.plot(data.T[0,:], data.T[2,:], '--')
+plt.xlabel('ms')
+plt.ylabel('mV')
+plt.title('Generalized Integrate and Fire Neuron type "tonic_bursting"')
+plt.show()
@@ -0,0 +1,13 @@
+#!/usr/bin/env python
+
+import numpy as np
+import matplotlib.pyplot as plt
+
+data = np.array([[0, -70], [0.1, -70], [0.2, -70], [0.3, -70], [0.4, -70], [0.5, -70], [0.6, -70], [0.7, -70], [0.8, -70], [0.9, -70], [1, -70], [1.1, -70], [1.2, -70], [1.3, -70], [1.4, -70], [1.5, -70], [1.6, -70], [1.7, -70], [1.8, -70], [1.9, -70], [2, -70], [2.1, -70], [2.2, -70], [2.3, -70], [2.4, -70], [2.5, -70], [2.6, -70], [2.7, -70], [2.8, -70], [2.9, -70], [3, -70], [3.1, -70], [3.2, -70], [3.3, -70], [3.4, -70], [3.5, -70], [3.6, -70], [3.7, -70], [3.8, -70], [3.9, -70], [4, -70], [4.1, -70], [4.2, -70], [4.3, -70], [4.4, -70], [4.5, -70], [4.6, -70], [4.7, -70], [4.8, -70], [4.9, -70], [5, -70], [5.1, -70], [5.2, -70], [5.3, -70], [5.4, -70], [5.5, -70], [5.6, -70], [5.7, -70], [5.8, -70], [5.9, -70], [6, -70], [6.1, -70], [6.2, -70], [6.3, -70], [6.4, -70], [6.5, -70], [6.6, -70], [6.7, -70], [6.8, -70], [6.9, -70], [7, -70], [7.1, -70], [7.2, -70], [7.3, -70], [7.4, -70], [7.5, -70], [7.6, -70], [7.7, -70], [7.8, -70], [7.9, -70], [8, -70], [8.1, -70], [8.2, -70], [8.3, -70], [8.4, -70], [8.5, -70], [8.6, -70], [8.7, -70], [8.8, -70], [8.9, -70], [9, -70], [9.1, -70], [9.2, -70], [9.3, -70], [9.4, -70], [9.5, -70], [9.6, -70], [9.7, -70], [9.8, -70], [9.9, -70], [10, -70], [10.1, -69.3], [10.2, -67.9733], [10.3, -66.7036], [10.4, -65.476], [10.5, -64.2775], [10.6, -63.0961], [10.7, -61.9206], [10.8, -60.74], [10.9, -59.5431], [11, -58.3179], [11.1, -57.0515], [11.2, -55.7293], [11.3, -54.3341], [11.4, -52.8454], [11.5, -51.2381], [11.6, -49.4802], [11.7, -47.5305], [11.8, -45.3343], [11.9, -42.8168], [12, -39.8728], [12.1, -36.3489], [12.2, -32.0119], [12.3, -26.4892], [12.4, -19.1471], [12.5, -8.81595], [12.6, 6.91329], [12.7, 30], [12.8, -64.4288], [12.9, -63.8654], [13, -63.3071], [13.1, -62.7514], [13.2, -62.1958], [13.3, -61.638], [13.4, -61.0754], [13.5, -60.5055], [13.6, -59.9256], [13.7, -59.3328], [13.8, -58.7239], [13.9, -58.0956], [14, -57.444], [14.1, -56.7647], [14.2, -56.0529], [14.3, -55.3027], [14.4, -54.5075], [14.5, -53.6591], [14.6, -52.748], [14.7, -51.7626], [14.8, -50.6883], [14.9, -49.5072], [15, -48.1966], [15.1, -46.7271], [15.2, -45.0602], [15.3, -43.1442], [15.4, -40.9083], [15.5, -38.2527], [15.6, -35.0321], [15.7, -31.0258], [15.8, -25.8837], [15.9, -19.0141], [16, -9.33653], [16.1, 5.34095], [16.2, 30], [16.3, -65.0111], [16.4, -65.0199], [16.5, -65.0262], [16.6, -65.0303], [16.7, -65.032], [16.8, -65.0316], [16.9, -65.029], [17, -65.0243], [17.1, -65.0175], [17.2, -65.0086], [17.3, -64.9978], [17.4, -64.985], [17.5, -64.9704], [17.6, -64.9539], [17.7, -64.9355], [17.8, -64.9154], [17.9, -64.8936], [18, -64.87], [18.1, -64.8447], [18.2, -64.8178], [18.3, -64.7893], [18.4, -64.7592], [18.5, -64.7276], [18.6, -64.6944], [18.7, -64.6596], [18.8, -64.6234], [18.9, -64.5858], [19, -64.5466], [19.1, -64.5061], [19.2, -64.4641], [19.3, -64.4207], [19.4, -64.376], [19.5, -64.3298], [19.6, -64.2823], [19.7, -64.2334], [19.8, -64.1832], [19.9, -64.1316], [20, -64.0786], [20.1, -64.0244], [20.2, -63.9687], [20.3, -63.9117], [20.4, -63.8534], [20.5, -63.7937], [20.6, -63.7326], [20.7, -63.6701], [20.8, -63.6063], [20.9, -63.541], [21, -63.4744], [21.1, -63.4062], [21.2, -63.3367], [21.3, -63.2656], [21.4, -63.1931], [21.5, -63.119], [21.6, -63.0434], [21.7, -62.9662], [21.8, -62.8873], [21.9, -62.8068], [22, -62.7246], [22.1, -62.6406], [22.2, -62.5549], [22.3, -62.4673], [22.4, -62.3778], [22.5, -62.2864], [22.6, -62.193], [22.7, -62.0974], [22.8, -61.9998], [22.9, -61.8998], [23, -61.7976], [23.1, -61.693], [23.2, -61.5859], [23.3, -61.4762], [23.4, -61.3637], [23.5, -61.2485], [23.6, -61.1303], [23.7, -61.009], [23.8, -60.8845], [23.9, -60.7566], [24, -60.6252], [24.1, -60.49], [24.2, -60.3509], [24.3, -60.2076], [24.4, -60.06], [24.5, -59.9077], [24.6, -59.7506], [24.7, -59.5882], [24.8, -59.4203], [24.9, -59.2466], [25, -59.0666], [25.1, -58.8799], [25.2, -58.6861], [25.3, -58.4846], [25.4, -58.2749], [25.5, -58.0564], [25.6, -57.8284], [25.7, -57.5901], [25.8, -57.3407], [25.9, -57.0792], [26, -56.8045], [26.1, -56.5154], [26.2, -56.2107], [26.3, -55.8887], [26.4, -55.5477], [26.5, -55.1857], [26.6, -54.8005], [26.7, -54.3893], [26.8, -53.9491], [26.9, -53.4764], [27, -52.9669], [27.1, -52.4156], [27.2, -51.8167], [27.3, -51.1631], [27.4, -50.4462], [27.5, -49.6556], [27.6, -48.7783], [27.7, -47.7982], [27.8, -46.6948], [27.9, -45.442], [28, -44.0054], [28.1, -42.3395], [28.2, -40.3822], [28.3, -38.047], [28.4, -35.2095], [28.5, -31.6838], [28.6, -27.181], [28.7, -21.2248], [28.8, -12.9748], [28.9, -0.802283], [29, 18.8829], [29.1, 30], [29.2, -65.3907], [29.3, -65.7695], [29.4, -66.1355], [29.5, -66.4881], [29.6, -66.8266], [29.7, -67.1506], [29.8, -67.4599], [29.9, -67.7541], [30, -68.0332], [30.1, -68.2972], [30.2, -68.5463], [30.3, -68.7806], [30.4, -69.0005], [30.5, -69.2062], [30.6, -69.3982], [30.7, -69.5769], [30.8, -69.7428], [30.9, -69.8963], [31, -70.0381], [31.1, -70.1686], [31.2, -70.2883], [31.3, -70.3978], [31.4, -70.4977], [31.5, -70.5884], [31.6, -70.6704], [31.7, -70.7443], [31.8, -70.8105], [31.9, -70.8695], [32, -70.9217], [32.1, -70.9676], [32.2, -71.0076], [32.3, -71.0419], [32.4, -71.0711], [32.5, -71.0954], [32.6, -71.1152], [32.7, -71.1307], [32.8, -71.1423], [32.9, -71.1502], [33, -71.1546], [33.1, -71.1559], [33.2, -71.1542], [33.3, -71.1497], [33.4, -71.1427], [33.5, -71.1332], [33.6, -71.1215], [33.7, -71.1077], [33.8, -71.092], [33.9, -71.0745], [34, -71.0553], [34.1, -71.0345], [34.2, -71.0123], [34.3, -70.9887], [34.4, -70.9638], [34.5, -70.9378], [34.6, -70.9106], [34.7, -70.8824], [34.8, -70.8533], [34.9, -70.8232], [35, -70.7923], [35.1, -70.7606], [35.2, -70.7281], [35.3, -70.695], [35.4, -70.6612], [35.5, -70.6268], [35.6, -70.5918], [35.7, -70.5563], [35.8, -70.5203], [35.9, -70.4837], [36, -70.4467], [36.1, -70.4093], [36.2, -70.3715], [36.3, -70.3333], [36.4, -70.2947], [36.5, -70.2558], [36.6, -70.2165], [36.7, -70.1769], [36.8, -70.137], [36.9, -70.0968], [37, -70.0563], [37.1, -70.0155], [37.2, -69.9745], [37.3, -69.9332], [37.4, -69.8917], [37.5, -69.85], [37.6, -69.808], [37.7, -69.7658], [37.8, -69.7233], [37.9, -69.6807], [38, -69.6379], [38.1, -69.5948], [38.2, -69.5516], [38.3, -69.5081], [38.4, -69.4645], [38.5, -69.4206], [38.6, -69.3766], [38.7, -69.3324], [38.8, -69.288], [38.9, -69.2434], [39, -69.1986], [39.1, -69.1537], [39.2, -69.1085], [39.3, -69.0632], [39.4, -69.0177], [39.5, -68.972], [39.6, -68.9262], [39.7, -68.8801], [39.8, -68.8339], [39.9, -68.7875], [40, -68.7409], [40.1, -68.6941], [40.2, -68.6471], [40.3, -68.5999], [40.4, -68.5526], [40.5, -68.505], [40.6, -68.4573], [40.7, -68.4093], [40.8, -68.3612], [40.9, -68.3129], [41, -68.2643], [41.1, -68.2156], [41.2, -68.1666], [41.3, -68.1174], [41.4, -68.0681], [41.5, -68.0185], [41.6, -67.9686], [41.7, -67.9186], [41.8, -67.8683], [41.9, -67.8178], [42, -67.7671], [42.1, -67.7161], [42.2, -67.6649], [42.3, -67.6134], [42.4, -67.5617], [42.5, -67.5098], [42.6, -67.4575], [42.7, -67.405], [42.8, -67.3523], [42.9, -67.2992], [43, -67.2459], [43.1, -67.1923], [43.2, -67.1385], [43.3, -67.0843], [43.4, -67.0298], [43.5, -66.975], [43.6, -66.9199], [43.7, -66.8645], [43.8, -66.8088], [43.9, -66.7527], [44, -66.6963], [44.1, -66.6395], [44.2, -66.5824], [44.3, -66.5249], [44.4, -66.4671], [44.5, -66.4089], [44.6, -66.3503], [44.7, -66.2913], [44.8, -66.2319], [44.9, -66.172], [45, -66.1118], [45.1, -66.0511], [45.2, -65.99], [45.3, -65.9285], [45.4, -65.8665], [45.5, -65.804], [45.6, -65.741], [45.7, -65.6775], [45.8, -65.6135], [45.9, -65.549], [46, -65.4839], [46.1, -65.4183], [46.2, -65.3522], [46.3, -65.2854], [46.4, -65.2181], [46.5, -65.1501], [46.6, -65.0815], [46.7, -65.0123], [46.8, -64.9424], [46.9, -64.8718], [47, -64.8006], [47.1, -64.7286], [47.2, -64.6558], [47.3, -64.5823], [47.4, -64.508], [47.5, -64.4329], [47.6, -64.3569], [47.7, -64.2801], [47.8, -64.2024], [47.9, -64.1238], [48, -64.0442], [48.1, -63.9636], [48.2, -63.8821], [48.3, -63.7994], [48.4, -63.7157], [48.5, -63.6309], [48.6, -63.5449], [48.7, -63.4577], [48.8, -63.3693], [48.9, -63.2795], [49, -63.1884], [49.1, -63.096], [49.2, -63.002], [49.3, -62.9066], [49.4, -62.8096], [49.5, -62.711], [49.6, -62.6107], [49.7, -62.5087], [49.8, -62.4048], [49.9, -62.2989], [50, -62.1911], [50.1, -62.0812], [50.2, -61.9691], [50.3, -61.8547], [50.4, -61.7379], [50.5, -61.6187], [50.6, -61.4967], [50.7, -61.3721], [50.8, -61.2445], [50.9, -61.1139], [51, -60.98], [51.1, -60.8428], [51.2, -60.702], [51.3, -60.5574], [51.4, -60.4089], [51.5, -60.2561], [51.6, -60.0988], [51.7, -59.9368], [51.8, -59.7698], [51.9, -59.5974], [52, -59.4192], [52.1, -59.235], [52.2, -59.0442], [52.3, -58.8465], [52.4, -58.6412], [52.5, -58.4279], [52.6, -58.206], [52.7, -57.9746], [52.8, -57.7332], [52.9, -57.4808], [53, -57.2164], [53.1, -56.9392], [53.2, -56.6477], [53.3, -56.3408], [53.4, -56.0169], [53.5, -55.6742], [53.6, -55.3108], [53.7, -54.9245], [53.8, -54.5125], [53.9, -54.072], [54, -53.5994], [54.1, -53.0905], [54.2, -52.5405], [54.3, -51.9435], [54.4, -51.2927], [54.5, -50.5796], [54.6, -49.794], [54.7, -48.9232], [54.8, -47.9516], [54.9, -46.859], [55, -45.6201], [55.1, -44.2014], [55.2, -42.5589], [55.3, -40.6324], [55.4, -38.3385], [55.5, -35.5575], [55.6, -32.1115], [55.7, -27.7251], [55.8, -21.9475], [55.9, -13.9892], [56, -2.33755], [56.1, 16.2905], [56.2, 30], [56.3, -65.3822], [56.4, -65.7528], [56.5, -66.111], [56.6, -66.4559], [56.7, -66.7872], [56.8, -67.1043], [56.9, -67.407], [57, -67.6951], [57.1, -67.9684], [57.2, -68.2272], [57.3, -68.4713], [57.4, -68.7011], [57.5, -68.9168], [57.6, -69.1187], [57.7, -69.3073], [57.8, -69.4829], [57.9, -69.646], [58, -69.797], [58.1, -69.9366], [58.2, -70.0651], [58.3, -70.1831], [58.4, -70.2911], [58.5, -70.3896], [58.6, -70.4792], [58.7, -70.5602], [58.8, -70.6333], [58.9, -70.6988], [59, -70.7572], [59.1, -70.809], [59.2, -70.8545], [59.3, -70.8941], [59.4, -70.9283], [59.5, -70.9573], [59.6, -70.9815], [59.7, -71.0012], [59.8, -71.0167], [59.9, -71.0283], [60, -71.0362], [60.1, -71.0407], [60.2, -71.0421], [60.3, -71.0404], [60.4, -71.0361], [60.5, -71.0291], [60.6, -71.0198], [60.7, -71.0082], [60.8, -70.9945], [60.9, -70.9789], [61, -70.9615], [61.1, -70.9424], [61.2, -70.9217], [61.3, -70.8996], [61.4, -70.8761], [61.5, -70.8513], [61.6, -70.8253], [61.7, -70.7982], [61.8, -70.7701], [61.9, -70.741], [62, -70.7109], [62.1, -70.68], [62.2, -70.6484], [62.3, -70.6159], [62.4, -70.5828], [62.5, -70.549], [62.6, -70.5145], [62.7, -70.4795], [62.8, -70.4439], [62.9, -70.4078], [63, -70.3712], [63.1, -70.3342], [63.2, -70.2967], [63.3, -70.2588], [63.4, -70.2204], [63.5, -70.1817], [63.6, -70.1427], [63.7, -70.1033], [63.8, -70.0635], [63.9, -70.0235], [64, -69.9831], [64.1, -69.9425], [64.2, -69.9015], [64.3, -69.8603], [64.4, -69.8189], [64.5, -69.7771], [64.6, -69.7352], [64.7, -69.693], [64.8, -69.6506], [64.9, -69.6079], [65, -69.565], [65.1, -69.5219], [65.2, -69.4786], [65.3, -69.4351], [65.4, -69.3914], [65.5, -69.3475], [65.6, -69.3033], [65.7, -69.259], [65.8, -69.2145], [65.9, -69.1698], [66, -69.1249], [66.1, -69.0798], [66.2, -69.0345], [66.3, -68.9891], [66.4, -68.9434], [66.5, -68.8975], [66.6, -68.8515], [66.7, -68.8053], [66.8, -68.7588], [66.9, -68.7122], [67, -68.6654], [67.1, -68.6184], [67.2, -68.5712], [67.3, -68.5238], [67.4, -68.4763], [67.5, -68.4285], [67.6, -68.3805], [67.7, -68.3323], [67.8, -68.2839], [67.9, -68.2353], [68, -68.1865], [68.1, -68.1374], [68.2, -68.0882], [68.3, -68.0387], [68.4, -67.989], [68.5, -67.9391], [68.6, -67.889], [68.7, -67.8386], [68.8, -67.788], [68.9, -67.7372], [69, -67.6861], [69.1, -67.6348], [69.2, -67.5832], [69.3, -67.5314], [69.4, -67.4793], [69.5, -67.4269], [69.6, -67.3743], [69.7, -67.3214], [69.8, -67.2682], [69.9, -67.2148], [70, -67.161], [70.1, -67.107], [70.2, -67.0527], [70.3, -66.998], [70.4, -66.9431], [70.5, -66.8878], [70.6, -66.8322], [70.7, -66.7763], [70.8, -66.7201], [70.9, -66.6635], [71, -66.6065], [71.1, -66.5492], [71.2, -66.4915], [71.3, -66.4335], [71.4, -66.3751], [71.5, -66.3162], [71.6, -66.257], [71.7, -66.1974], [71.8, -66.1374], [71.9, -66.0769], [72, -66.016], [72.1, -65.9546], [72.2, -65.8928], [72.3, -65.8305], [72.4, -65.7677], [72.5, -65.7045], [72.6, -65.6407], [72.7, -65.5764], [72.8, -65.5116], [72.9, -65.4463], [73, -65.3803], [73.1, -65.3139], [73.2, -65.2468], [73.3, -65.1791], [73.4, -65.1108], [73.5, -65.0418], [73.6, -64.9722], [73.7, -64.9019], [73.8, -64.831], [73.9, -64.7593], [74, -64.6869], [74.1, -64.6137], [74.2, -64.5397], [74.3, -64.465], [74.4, -64.3894], [74.5, -64.3129], [74.6, -64.2356], [74.7, -64.1574], [74.8, -64.0782], [74.9, -63.9981], [75, -63.917], [75.1, -63.8348], [75.2, -63.7515], [75.3, -63.6672], [75.4, -63.5817], [75.5, -63.495], [75.6, -63.4071], [75.7, -63.3179], [75.8, -63.2274], [75.9, -63.1356], [76, -63.0423], [76.1, -62.9475], [76.2, -62.8512], [76.3, -62.7533], [76.4, -62.6537], [76.5, -62.5524], [76.6, -62.4493], [76.7, -62.3443], [76.8, -62.2374], [76.9, -62.1284], [77, -62.0172], [77.1, -61.9038], [77.2, -61.7881], [77.3, -61.6699], [77.4, -61.5491], [77.5, -61.4256], [77.6, -61.2993], [77.7, -61.17], [77.8, -61.0376], [77.9, -60.9018], [78, -60.7625], [78.1, -60.6196], [78.2, -60.4728], [78.3, -60.3218], [78.4, -60.1665], [78.5, -60.0066], [78.6, -59.8418], [78.7, -59.6717], [78.8, -59.496], [78.9, -59.3145], [79, -59.1265], [79.1, -58.9318], [79.2, -58.7298], [79.3, -58.52], [79.4, -58.3019], [79.5, -58.0746], [79.6, -57.8376], [79.7, -57.5899], [79.8, -57.3308], [79.9, -57.0592], [80, -56.774], [80.1, -56.4739], [80.2, -56.1574], [80.3, -55.823], [80.4, -55.4687], [80.5, -55.0924], [80.6, -54.6918], [80.7, -54.2639], [80.8, -53.8054], [80.9, -53.3126], [81, -52.7808], [81.1, -52.2046], [81.2, -51.5778], [81.3, -50.8924], [81.4, -50.1392], [81.5, -49.3065], [81.6, -48.3801], [81.7, -47.3419], [81.8, -46.1691], [81.9, -44.8319], [82, -43.2913], [82.1, -41.4947], [82.2, -39.3699], [82.3, -36.8147], [82.4, -33.6795], [82.5, -29.7373], [82.6, -24.6254], [82.7, -17.7283], [82.8, -7.91496], [82.9, 7.13022], [83, 30], [83.1, -65.3813], [83.2, -65.7509], [83.3, -66.1081], [83.4, -66.4522], [83.5, -66.7826], [83.6, -67.0989], [83.7, -67.4008], [83.8, -67.6882], [83.9, -67.9609], [84, -68.219], [84.1, -68.4625], [84.2, -68.6918], [84.3, -68.907], [84.4, -69.1085], [84.5, -69.2966], [84.6, -69.4719], [84.7, -69.6346], [84.8, -69.7854], [84.9, -69.9247], [85, -70.0529], [85.1, -70.1707], [85.2, -70.2786], [85.3, -70.3769], [85.4, -70.4664], [85.5, -70.5473], [85.6, -70.6203], [85.7, -70.6857], [85.8, -70.7441], [85.9, -70.7958], [86, -70.8412], [86.1, -70.8808], [86.2, -70.9149], [86.3, -70.9439], [86.4, -70.9681], [86.5, -70.9878], [86.6, -71.0033], [86.7, -71.0148], [86.8, -71.0228], [86.9, -71.0273], [87, -71.0287], [87.1, -71.0271], [87.2, -71.0227], [87.3, -71.0158], [87.4, -71.0064], [87.5, -70.9949], [87.6, -70.9812], [87.7, -70.9656], [87.8, -70.9482], [87.9, -70.9291], [88, -70.9085], [88.1, -70.8863], [88.2, -70.8628], [88.3, -70.838], [88.4, -70.8121], [88.5, -70.785], [88.6, -70.7568], [88.7, -70.7277], [88.8, -70.6977], [88.9, -70.6668], [89, -70.6351], [89.1, -70.6027], [89.2, -70.5695], [89.3, -70.5357], [89.4, -70.5013], [89.5, -70.4663], [89.6, -70.4307], [89.7, -70.3946], [89.8, -70.358], [89.9, -70.3209], [90, -70.2834], [90.1, -70.2455], [90.2, -70.2071], [90.3, -70.1684], [90.4, -70.1293], [90.5, -70.0899], [90.6, -70.0502], [90.7, -70.0101], [90.8, -69.9697], [90.9, -69.929], [91, -69.8881], [91.1, -69.8469], [91.2, -69.8054], [91.3, -69.7636], [91.4, -69.7217], [91.5, -69.6794], [91.6, -69.637], [91.7, -69.5943], [91.8, -69.5514], [91.9, -69.5083], [92, -69.4649], [92.1, -69.4214], [92.2, -69.3776], [92.3, -69.3337], [92.4, -69.2895], [92.5, -69.2452], [92.6, -69.2006], [92.7, -69.1559], [92.8, -69.1109], [92.9, -69.0658], [93, -69.0205], [93.1, -68.975], [93.2, -68.9293], [93.3, -68.8834], [93.4, -68.8373], [93.5, -68.791], [93.6, -68.7445], [93.7, -68.6979], [93.8, -68.651], [93.9, -68.604], [94, -68.5567], [94.1, -68.5093], [94.2, -68.4617], [94.3, -68.4138], [94.4, -68.3658], [94.5, -68.3175], [94.6, -68.2691], [94.7, -68.2204], [94.8, -68.1715], [94.9, -68.1224], [95, -68.0731], [95.1, -68.0236], [95.2, -67.9739], [95.3, -67.9239], [95.4, -67.8737], [95.5, -67.8233], [95.6, -67.7726], [95.7, -67.7217], [95.8, -67.6705], [95.9, -67.6191], [96, -67.5675], [96.1, -67.5156], [96.2, -67.4634], [96.3, -67.411], [96.4, -67.3583], [96.5, -67.3053], [96.6, -67.2521], [96.7, -67.1985], [96.8, -67.1447], [96.9, -67.0906], [97, -67.0362], [97.1, -66.9814], [97.2, -66.9264], [97.3, -66.871], [97.4, -66.8153], [97.5, -66.7593], [97.6, -66.703], [97.7, -66.6463], [97.8, -66.5892], [97.9, -66.5318], [98, -66.474], [98.1, -66.4159], [98.2, -66.3573], [98.3, -66.2984], [98.4, -66.239], [98.5, -66.1793], [98.6, -66.1191], [98.7, -66.0585], [98.8, -65.9975], [98.9, -65.936], [99, -65.874], [99.1, -65.8116], [99.2, -65.7487], [99.3, -65.6853], [99.4, -65.6213], [99.5, -65.5569], [99.6, -65.4919], [99.7, -65.4264], [99.8, -65.3603], [99.9, -65.2936], [100, -65.2264], [100.1, -65.1585], [100.2, -65.09], [100.3, -65.0209], [100.4, -64.9511], [100.5, -64.8806], [100.6, -64.8094], [100.7, -64.7375], [100.8, -64.6648], [100.9, -64.5914], [101, -64.5172], [101.1, -64.4422], [101.2, -64.3664], [101.3, -64.2897], [101.4, -64.2121], [101.5, -64.1336], [101.6, -64.0541], [101.7, -63.9737], [101.8, -63.8922], [101.9, -63.8098], [102, -63.7262], [102.1, -63.6415], [102.2, -63.5557], [102.3, -63.4686], [102.4, -63.3803], [102.5, -63.2907], [102.6, -63.1998], [102.7, -63.1075], [102.8, -63.0138], [102.9, -62.9186], [103, -62.8218], [103.1, -62.7234], [103.2, -62.6233], [103.3, -62.5215], [103.4, -62.4178], [103.5, -62.3122], [103.6, -62.2047], [103.7, -62.095], [103.8, -61.9832], [103.9, -61.8691], [104, -61.7526], [104.1, -61.6337], [104.2, -61.5121], [104.3, -61.3878], [104.4, -61.2606], [104.5, -61.1303], [104.6, -60.9969], [104.7, -60.8601], [104.8, -60.7198], [104.9, -60.5757], [105, -60.4276], [105.1, -60.2754], [105.2, -60.1187], [105.3, -59.9573], [105.4, -59.7909], [105.5, -59.6192], [105.6, -59.4418], [105.7, -59.2584], [105.8, -59.0685], [105.9, -58.8716], [106, -58.6673], [106.1, -58.4551], [106.2, -58.2342], [106.3, -58.0041], [106.4, -57.7639], [106.5, -57.5129], [106.6, -57.2502], [106.7, -56.9746], [106.8, -56.685], [106.9, -56.3801], [107, -56.0584], [107.1, -55.7181], [107.2, -55.3575], [107.3, -54.9741], [107.4, -54.5656], [107.5, -54.1288], [107.6, -53.6604], [107.7, -53.1563], [107.8, -52.6117], [107.9, -52.021], [108, -51.3773], [108.1, -50.6726], [108.2, -49.8967], [108.3, -49.0374], [108.4, -48.0793], [108.5, -47.0031], [108.6, -45.7841], [108.7, -44.3902], [108.8, -42.7785], [108.9, -40.8916], [109, -38.6493], [109.1, -35.9375], [109.2, -32.5872], [109.3, -28.3385], [109.4, -22.7688], [109.5, -15.1454], [109.6, -4.08216], [109.7, 13.3756], [109.8, 30], [109.9, -65.3819], [110, -65.7522], [110.1, -66.11], [110.2, -66.4547], [110.3, -66.7857], [110.4, -67.1026], [110.5, -67.405], [110.6, -67.6929], [110.7, -67.966], [110.8, -68.2245], [110.9, -68.4685], [111, -68.6981], [111.1, -68.9137], [111.2, -69.1155], [111.3, -69.3039], [111.4, -69.4794], [111.5, -69.6423], [111.6, -69.7933], [111.7, -69.9328], [111.8, -70.0612], [111.9, -70.1791], [112, -70.2871], [112.1, -70.3856], [112.2, -70.4751], [112.3, -70.5561], [112.4, -70.6291], [112.5, -70.6946], [112.6, -70.753], [112.7, -70.8048], [112.8, -70.8502], [112.9, -70.8899], [113, -70.924], [113.1, -70.953], [113.2, -70.9772], [113.3, -70.9969], [113.4, -71.0124], [113.5, -71.024], [113.6, -71.0319], [113.7, -71.0364], [113.8, -71.0378], [113.9, -71.0362], [114, -71.0318], [114.1, -71.0248], [114.2, -71.0155], [114.3, -71.0039], [114.4, -70.9903], [114.5, -70.9747], [114.6, -70.9572], [114.7, -70.9381], [114.8, -70.9175], [114.9, -70.8953], [115, -70.8718], [115.1, -70.847], [115.2, -70.8211], [115.3, -70.794], [115.4, -70.7658], [115.5, -70.7367], [115.6, -70.7067], [115.7, -70.6758], [115.8, -70.6441], [115.9, -70.6117], [116, -70.5785], [116.1, -70.5447], [116.2, -70.5103], [116.3, -70.4753], [116.4, -70.4397], [116.5, -70.4036], [116.6, -70.367], [116.7, -70.3299], [116.8, -70.2924], [116.9, -70.2545], [117, -70.2162], [117.1, -70.1775], [117.2, -70.1384], [117.3, -70.099], [117.4, -70.0592], [117.5, -70.0192], [117.6, -69.9788], [117.7, -69.9382], [117.8, -69.8972], [117.9, -69.856], [118, -69.8145], [118.1, -69.7728], [118.2, -69.7308], [118.3, -69.6886], [118.4, -69.6462], [118.5, -69.6035], [118.6, -69.5606], [118.7, -69.5175], [118.8, -69.4742], [118.9, -69.4307], [119, -69.387], [119.1, -69.343], [119.2, -69.2989], [119.3, -69.2546], [119.4, -69.2101], [119.5, -69.1653], [119.6, -69.1204], [119.7, -69.0753], [119.8, -69.03], [119.9, -68.9845], [120, -68.9389], [120.1, -68.893], [120.2, -68.8469], [120.3, -68.8007], [120.4, -68.7543], [120.5, -68.7076], [120.6, -68.6608], [120.7, -68.6138], [120.8, -68.5666], [120.9, -68.5192], [121, -68.4716], [121.1, -68.4238], [121.2, -68.3758], [121.3, -68.3276], [121.4, -68.2791], [121.5, -68.2305], [121.6, -68.1817], [121.7, -68.1326], [121.8, -68.0834], [121.9, -68.0339], [122, -67.9842], [122.1, -67.9342], [122.2, -67.8841], [122.3, -67.8337], [122.4, -67.7831], [122.5, -67.7322], [122.6, -67.6811], [122.7, -67.6298], [122.8, -67.5782], [122.9, -67.5263], [123, -67.4742], [123.1, -67.4218], [123.2, -67.3692], [123.3, -67.3163], [123.4, -67.2631], [123.5, -67.2096], [123.6, -67.1558], [123.7, -67.1017], [123.8, -67.0474], [123.9, -66.9927], [124, -66.9377], [124.1, -66.8824], [124.2, -66.8268], [124.3, -66.7709], [124.4, -66.7146], [124.5, -66.658], [124.6, -66.601], [124.7, -66.5436], [124.8, -66.4859], [124.9, -66.4278], [125, -66.3694], [125.1, -66.3105], [125.2, -66.2513], [125.3, -66.1916], [125.4, -66.1315], [125.5, -66.071], [125.6, -66.01], [125.7, -65.9486], [125.8, -65.8868], [125.9, -65.8244], [126, -65.7616], [126.1, -65.6983], [126.2, -65.6345], [126.3, -65.5702], [126.4, -65.5053], [126.5, -65.4399], [126.6, -65.3739], [126.7, -65.3074], [126.8, -65.2402], [126.9, -65.1725], [127, -65.1041], [127.1, -65.0351], [127.2, -64.9654], [127.3, -64.8951], [127.4, -64.8241], [127.5, -64.7523], [127.6, -64.6798], [127.7, -64.6066], [127.8, -64.5325], [127.9, -64.4577], [128, -64.382], [128.1, -64.3055], [128.2, -64.2281], [128.3, -64.1498], [128.4, -64.0705], [128.5, -63.9903], [128.6, -63.909], [128.7, -63.8268], [128.8, -63.7434], [128.9, -63.659], [129, -63.5734], [129.1, -63.4866], [129.2, -63.3985], [129.3, -63.3092], [129.4, -63.2186], [129.5, -63.1266], [129.6, -63.0332], [129.7, -62.9382], [129.8, -62.8418], [129.9, -62.7437], [130, -62.644], [130.1, -62.5425], [130.2, -62.4392], [130.3, -62.334], [130.4, -62.2269], [130.5, -62.1177], [130.6, -62.0063], [130.7, -61.8927], [130.8, -61.7767], [130.9, -61.6583], [131, -61.5373], [131.1, -61.4135], [131.2, -61.2869], [131.3, -61.1573], [131.4, -61.0245], [131.5, -60.8885], [131.6, -60.7489], [131.7, -60.6056], [131.8, -60.4583], [131.9, -60.307], [132, -60.1512], [132.1, -59.9909], [132.2, -59.8255], [132.3, -59.6549], [132.4, -59.4787], [132.5, -59.2965], [132.6, -59.108], [132.7, -58.9126], [132.8, -58.7099], [132.9, -58.4993], [133, -58.2802], [133.1, -58.0521], [133.2, -57.8141], [133.3, -57.5654], [133.4, -57.3051], [133.5, -57.0322], [133.6, -56.7456], [133.7, -56.444], [133.8, -56.1258], [133.9, -55.7895], [134, -55.4332], [134.1, -55.0547], [134.2, -54.6516], [134.3, -54.2209], [134.4, -53.7593], [134.5, -53.2628], [134.6, -52.727], [134.7, -52.1463], [134.8, -51.5141], [134.9, -50.8226], [135, -50.0622], [135.1, -49.2211], [135.2, -48.2848], [135.3, -47.2346], [135.4, -46.0473], [135.5, -44.6923], [135.6, -43.1294], [135.7, -41.3046], [135.8, -39.1432], [135.9, -36.5393], [136, -33.3375], [136.1, -29.3007], [136.2, -24.0484], [136.3, -16.9301], [136.4, -6.73991], [136.5, 9.02208], [136.6, 30], [136.7, -65.3815], [136.8, -65.7513], [136.9, -66.1087], [137, -66.4529], [137.1, -66.7835], [137.2, -67.1], [137.3, -67.4021], [137.4, -67.6896], [137.5, -67.9624], [137.6, -68.2206], [137.7, -68.4643], [137.8, -68.6937], [137.9, -68.909], [138, -69.1106], [138.1, -69.2988], [138.2, -69.4741], [138.3, -69.6369], [138.4, -69.7878], [138.5, -69.9271], [138.6, -70.0554], [138.7, -70.1732], [138.8, -70.2811], [138.9, -70.3795], [139, -70.469], [139.1, -70.5499], [139.2, -70.6229], [139.3, -70.6884], [139.4, -70.7467], [139.5, -70.7985], [139.6, -70.8439], [139.7, -70.8835], [139.8, -70.9176], [139.9, -70.9466], [140, -70.9708], [140.1, -70.9905], [140.2, -71.006], [140.3, -71.0176], [140.4, -71.0255], [140.5, -71.03], [140.6, -71.0314], [140.7, -71.0298], [140.8, -71.0254], [140.9, -71.0185], [141, -71.0091], [141.1, -70.9976], [141.2, -70.9839], [141.3, -70.9683], [141.4, -70.9509], [141.5, -70.9318], [141.6, -70.9112], [141.7, -70.889], [141.8, -70.8655], [141.9, -70.8407], [142, -70.8148], [142.1, -70.7877], [142.2, -70.7595], [142.3, -70.7304], [142.4, -70.7004], [142.5, -70.6695], [142.6, -70.6378], [142.7, -70.6054], [142.8, -70.5722], [142.9, -70.5384], [143, -70.504], [143.1, -70.469], [143.2, -70.4334], [143.3, -70.3973], [143.4, -70.3607], [143.5, -70.3236], [143.6, -70.2861], [143.7, -70.2482], [143.8, -70.2098], [143.9, -70.1711], [144, -70.1321], [144.1, -70.0926], [144.2, -70.0529], [144.3, -70.0128], [144.4, -69.9724], [144.5, -69.9318], [144.6, -69.8908], [144.7, -69.8496], [144.8, -69.8081], [144.9, -69.7664], [145, -69.7244], [145.1, -69.6822], [145.2, -69.6397], [145.3, -69.5971], [145.4, -69.5542], [145.5, -69.511], [145.6, -69.4677], [145.7, -69.4242], [145.8, -69.3804], [145.9, -69.3365], [146, -69.2923], [146.1, -69.248], [146.2, -69.2034], [146.3, -69.1587], [146.4, -69.1138], [146.5, -69.0687], [146.6, -69.0233], [146.7, -68.9778], [146.8, -68.9321], [146.9, -68.8863], [147, -68.8402], [147.1, -68.7939], [147.2, -68.7475], [147.3, -68.7008], [147.4, -68.654], [147.5, -68.6069], [147.6, -68.5597], [147.7, -68.5123], [147.8, -68.4646], [147.9, -68.4168], [148, -68.3688], [148.1, -68.3205], [148.2, -68.2721], [148.3, -68.2234], [148.4, -68.1746], [148.5, -68.1255], [148.6, -68.0762], [148.7, -68.0267], [148.8, -67.977], [148.9, -67.927], [149, -67.8768], [149.1, -67.8264], [149.2, -67.7757], [149.3, -67.7248], [149.4, -67.6737], [149.5, -67.6223], [149.6, -67.5707], [149.7, -67.5188], [149.8, -67.4667], [149.9, -67.4142], [150, -67.3616], [150.1, -67.3086], [150.2, -67.2554], [150.3, -67.2018], [150.4, -67.148], [150.5, -67.0939], [150.6, -67.0395], [150.7, -66.9848], [150.8, -66.9298], [150.9, -66.8745], [151, -66.8188], [151.1, -66.7628], [151.2, -66.7065], [151.3, -66.6498], [151.4, -66.5927], [151.5, -66.5354], [151.6, -66.4776], [151.7, -66.4195], [151.8, -66.3609], [151.9, -66.302], [152, -66.2427], [152.1, -66.183], [152.2, -66.1228], [152.3, -66.0623], [152.4, -66.0012], [152.5, -65.9398], [152.6, -65.8778], [152.7, -65.8154], [152.8, -65.7526], [152.9, -65.6892], [153, -65.6253], [153.1, -65.5609], [153.2, -65.4959], [153.3, -65.4304], [153.4, -65.3644], [153.5, -65.2978], [153.6, -65.2305], [153.7, -65.1627], [153.8, -65.0942], [153.9, -65.0251], [154, -64.9554], [154.1, -64.8849], [154.2, -64.8138], [154.3, -64.7419], [154.4, -64.6693], [154.5, -64.596], [154.6, -64.5218], [154.7, -64.4469], [154.8, -64.3711], [154.9, -64.2944], [155, -64.2169], [155.1, -64.1384], [155.2, -64.059], [155.3, -63.9787], [155.4, -63.8973], [155.5, -63.8149], [155.6, -63.7314], [155.7, -63.6467], [155.8, -63.561], [155.9, -63.474], [156, -63.3858], [156.1, -63.2963], [156.2, -63.2055], [156.3, -63.1133], [156.4, -63.0196], [156.5, -62.9245], [156.6, -62.8278], [156.7, -62.7295], [156.8, -62.6295], [156.9, -62.5278], [157, -62.4242], [157.1, -62.3188], [157.2, -62.2113], [157.3, -62.1018], [157.4, -61.9901], [157.5, -61.8762], [157.6, -61.7599], [157.7, -61.6411], [157.8, -61.5197], [157.9, -61.3955], [158, -61.2685], [158.1, -61.1384], [158.2, -61.0052], [158.3, -60.8686], [158.4, -60.7285], [158.5, -60.5847], [158.6, -60.4369], [158.7, -60.2849], [158.8, -60.1285], [158.9, -59.9674], [159, -59.8013], [159.1, -59.63], [159.2, -59.4529], [159.3, -59.2699], [159.4, -59.0803], [159.5, -58.8839], [159.6, -58.6801], [159.7, -58.4684], [159.8, -58.2481], [159.9, -58.0185], [160, -57.779], [160.1, -57.5287], [160.2, -57.2667], [160.3, -56.9919], [160.4, -56.7032], [160.5, -56.3993], [160.6, -56.0787], [160.7, -55.7396], [160.8, -55.3803], [160.9, -54.9984], [161, -54.5915], [161.1, -54.1566], [161.2, -53.6902], [161.3, -53.1884], [161.4, -52.6465], [161.5, -52.0588], [161.6, -51.4186], [161.7, -50.7179], [161.8, -49.9467], [161.9, -49.0929], [162, -48.1414], [162.1, -47.0732], [162.2, -45.8638], [162.3, -44.4817], [162.4, -42.885], [162.5, -41.017], [162.6, -38.7995], [162.7, -36.1207], [162.8, -32.8161], [162.9, -28.6327], [163, -23.1612], [163.1, -15.6948], [163.2, -4.90483], [163.3, 12.0169], [163.4, 30], [163.5, -65.3818], [163.6, -65.7519], [163.7, -66.1096], [163.8, -66.4541], [163.9, -66.785], [164, -67.1018], [164.1, -67.4041], [164.2, -67.6918], [164.3, -67.9649], [164.4, -68.2233], [164.5, -68.4672], [164.6, -68.6967], [164.7, -68.9122], [164.8, -69.1139], [164.9, -69.3023], [165, -69.4777], [165.1, -69.6406], [165.2, -69.7916], [165.3, -69.931], [165.4, -70.0594], [165.5, -70.1773], [165.6, -70.2852], [165.7, -70.3837], [165.8, -70.4732], [165.9, -70.5542], [166, -70.6272], [166.1, -70.6927], [166.2, -70.751], [166.3, -70.8028], [166.4, -70.8483], [166.5, -70.8879], [166.6, -70.922], [166.7, -70.951], [166.8, -70.9752], [166.9, -70.9949], [167, -71.0104], [167.1, -71.022], [167.2, -71.0299], [167.3, -71.0344], [167.4, -71.0358], [167.5, -71.0342], [167.6, -71.0298], [167.7, -71.0228], [167.8, -71.0135], [167.9, -71.0019], [168, -70.9883], [168.1, -70.9727], [168.2, -70.9553], [168.3, -70.9362], [168.4, -70.9155], [168.5, -70.8934], [168.6, -70.8699], [168.7, -70.8451], [168.8, -70.8191], [168.9, -70.792], [169, -70.7639], [169.1, -70.7347], [169.2, -70.7047], [169.3, -70.6738], [169.4, -70.6421], [169.5, -70.6097], [169.6, -70.5766], [169.7, -70.5427], [169.8, -70.5083], [169.9, -70.4733], [170, -70.4377], [170.1, -70.4016], [170.2, -70.365], [170.3, -70.3279], [170.4, -70.2904], [170.5, -70.2525], [170.6, -70.2142], [170.7, -70.1755], [170.8, -70.1364], [170.9, -70.097], [171, -70.0572], [171.1, -70.0172], [171.2, -69.9768], [171.3, -69.9362], [171.4, -69.8952], [171.5, -69.854], [171.6, -69.8125], [171.7, -69.7708], [171.8, -69.7288], [171.9, -69.6866], [172, -69.6442], [172.1, -69.6015], [172.2, -69.5586], [172.3, -69.5155], [172.4, -69.4722], [172.5, -69.4287], [172.6, -69.3849], [172.7, -69.341], [172.8, -69.2968], [172.9, -69.2525], [173, -69.208], [173.1, -69.1633], [173.2, -69.1183], [173.3, -69.0732], [173.4, -69.0279], [173.5, -68.9824], [173.6, -68.9368], [173.7, -68.8909], [173.8, -68.8448], [173.9, -68.7986], [174, -68.7521], [174.1, -68.7055], [174.2, -68.6587], [174.3, -68.6116], [174.4, -68.5644], [174.5, -68.517], [174.6, -68.4694], [174.7, -68.4216], [174.8, -68.3736], [174.9, -68.3253], [175, -68.2769], [175.1, -68.2283], [175.2, -68.1794], [175.3, -68.1304], [175.4, -68.0811], [175.5, -68.0316], [175.6, -67.9819], [175.7, -67.932], [175.8, -67.8818], [175.9, -67.8314], [176, -67.7808], [176.1, -67.7299], [176.2, -67.6788], [176.3, -67.6274], [176.4, -67.5758], [176.5, -67.524], [176.6, -67.4718], [176.7, -67.4194], [176.8, -67.3668], [176.9, -67.3138], [177, -67.2606], [177.1, -67.2071], [177.2, -67.1534], [177.3, -67.0993], [177.4, -67.0449], [177.5, -66.9902], [177.6, -66.9352], [177.7, -66.8799], [177.8, -66.8243], [177.9, -66.7683], [178, -66.712], [178.1, -66.6554], [178.2, -66.5984], [178.3, -66.541], [178.4, -66.4833], [178.5, -66.4252], [178.6, -66.3667], [178.7, -66.3079], [178.8, -66.2486], [178.9, -66.1889], [179, -66.1288], [179.1, -66.0683], [179.2, -66.0073], [179.3, -65.9459], [179.4, -65.884], [179.5, -65.8216], [179.6, -65.7588], [179.7, -65.6955], [179.8, -65.6316], [179.9, -65.5673], [180, -65.5024], [180.1, -65.4369], [180.2, -65.3709], [180.3, -65.3044], [180.4, -65.2372], [180.5, -65.1694], [180.6, -65.101], [180.7, -65.032], [180.8, -64.9623], [180.9, -64.8919], [181, -64.8208], [181.1, -64.7491], [181.2, -64.6765], [181.3, -64.6032], [181.4, -64.5292], [181.5, -64.4543], [181.6, -64.3786], [181.7, -64.302], [181.8, -64.2246], [181.9, -64.1462], [182, -64.0669], [182.1, -63.9866], [182.2, -63.9054], [182.3, -63.823], [182.4, -63.7396], [182.5, -63.6551], [182.6, -63.5695], [182.7, -63.4826], [182.8, -63.3945], [182.9, -63.3052], [183, -63.2145], [183.1, -63.1224], [183.2, -63.0289], [183.3, -62.9339], [183.4, -62.8374], [183.5, -62.7393], [183.6, -62.6394], [183.7, -62.5379], [183.8, -62.4345], [183.9, -62.3293], [184, -62.222], [184.1, -62.1127], [184.2, -62.0013], [184.3, -61.8875], [184.4, -61.7715], [184.5, -61.6529], [184.6, -61.5317], [184.7, -61.4079], [184.8, -61.2811], [184.9, -61.1514], [185, -61.0185], [185.1, -60.8822], [185.2, -60.7425], [185.3, -60.599], [185.4, -60.4516], [185.5, -60.3001], [185.6, -60.1441], [185.7, -59.9835], [185.8, -59.8179], [185.9, -59.6471], [186, -59.4706], [186.1, -59.2882], [186.2, -59.0993], [186.3, -58.9036], [186.4, -58.7005], [186.5, -58.4896], [186.6, -58.2702], [186.7, -58.0416], [186.8, -57.8031], [186.9, -57.5539], [187, -57.2931], [187.1, -57.0196], [187.2, -56.7323], [187.3, -56.43], [187.4, -56.1111], [187.5, -55.7739], [187.6, -55.4167], [187.7, -55.0371], [187.8, -54.6328], [187.9, -54.2007], [188, -53.7377], [188.1, -53.2396], [188.2, -52.7018], [188.3, -52.1189], [188.4, -51.4843], [188.5, -50.7899], [188.6, -50.0261], [188.7, -49.1811], [188.8, -48.24], [188.9, -47.1843], [189, -45.9901], [189.1, -44.6267], [189.2, -43.0533], [189.3, -41.2151], [189.4, -39.0363], [189.5, -36.4092], [189.6, -33.1757], [189.7, -29.0938], [189.8, -23.7741], [189.9, -16.5492], [190, -6.17618], [190.1, 9.93681], [190.2, 30], [190.3, -65.3816], [190.4, -65.7515], [190.5, -66.109], [190.6, -66.4533], [190.7, -66.784], [190.8, -67.1005], [190.9, -67.4027], [191, -67.6903], [191.1, -67.9632], [191.2, -68.2214], [191.3, -68.4652], [191.4, -68.6946], [191.5, -68.91], [191.6, -69.1116], [191.7, -69.2999], [191.8, -69.4752], [191.9, -69.6381], [192, -69.7889], [192.1, -69.9283], [192.2, -70.0566], [192.3, -70.1745], [192.4, -70.2824], [192.5, -70.3808], [192.6, -70.4702], [192.7, -70.5512], [192.8, -70.6242], [192.9, -70.6897], [193, -70.7481], [193.1, -70.7998], [193.2, -70.8452], [193.3, -70.8848], [193.4, -70.919], [193.5, -70.9479], [193.6, -70.9721], [193.7, -70.9918], [193.8, -71.0073], [193.9, -71.0189], [194, -71.0268], [194.1, -71.0314], [194.2, -71.0327], [194.3, -71.0311], [194.4, -71.0267], [194.5, -71.0198], [194.6, -71.0105], [194.7, -70.9989], [194.8, -70.9852], [194.9, -70.9696], [195, -70.9522], [195.1, -70.9331], [195.2, -70.9125], [195.3, -70.8903], [195.4, -70.8668], [195.5, -70.8421], [195.6, -70.8161], [195.7, -70.789], [195.8, -70.7609], [195.9, -70.7317], [196, -70.7017], [196.1, -70.6708], [196.2, -70.6391], [196.3, -70.6067], [196.4, -70.5736], [196.5, -70.5397], [196.6, -70.5053], [196.7, -70.4703], [196.8, -70.4347], [196.9, -70.3986], [197, -70.362], [197.1, -70.3249], [197.2, -70.2874], [197.3, -70.2495], [197.4, -70.2112], [197.5, -70.1725], [197.6, -70.1334], [197.7, -70.094], [197.8, -70.0542], [197.9, -70.0141], [198, -69.9738], [198.1, -69.9331], [198.2, -69.8922], [198.3, -69.8509], [198.4, -69.8095], [198.5, -69.7677], [198.6, -69.7258], [198.7, -69.6835], [198.8, -69.6411], [198.9, -69.5984], [199, -69.5555], [199.1, -69.5124], [199.2, -69.4691], [199.3, -69.4255], [199.4, -69.3818], [199.5, -69.3378], [199.6, -69.2937], [199.7, -69.2494], [199.8, -69.2048], [199.9, -69.1601], [200, -69.1152], [200.1, -69.07], [200.2, -69.0247], [200.3, -68.9792], [200.4, -68.9335], [200.5, -68.8877], [200.6, -68.8416], [200.7, -68.7953], [200.8, -68.7489], [200.9, -68.7022], [201, -68.6554], [201.1, -68.6084], [201.2, -68.5611], [201.3, -68.5137], [201.4, -68.4661], [201.5, -68.4183], [201.6, -68.3702], [201.7, -68.322], [201.8, -68.2736], [201.9, -68.2249], [202, -68.1761], [202.1, -68.127], [202.2, -68.0777], [202.3, -68.0282], [202.4, -67.9785], [202.5, -67.9285], [202.6, -67.8783], [202.7, -67.8279], [202.8, -67.7773], [202.9, -67.7264], [203, -67.6753], [203.1, -67.6239], [203.2, -67.5723], [203.3, -67.5204], [203.4, -67.4682], [203.5, -67.4158], [203.6, -67.3631], [203.7, -67.3102], [203.8, -67.257], [203.9, -67.2035], [204, -67.1497], [204.1, -67.0956], [204.2, -67.0412], [204.3, -66.9865], [204.4, -66.9315], [204.5, -66.8761], [204.6, -66.8205], [204.7, -66.7645], [204.8, -66.7082], [204.9, -66.6515], [205, -66.5945], [205.1, -66.5371], [205.2, -66.4793], [205.3, -66.4212], [205.4, -66.3627], [205.5, -66.3038], [205.6, -66.2445], [205.7, -66.1848], [205.8, -66.1246], [205.9, -66.0641], [206, -66.0031], [206.1, -65.9416], [206.2, -65.8797], [206.3, -65.8173], [206.4, -65.7545], [206.5, -65.6911], [206.6, -65.6272], [206.7, -65.5628], [206.8, -65.4979], [206.9, -65.4324], [207, -65.3664], [207.1, -65.2998], [207.2, -65.2326], [207.3, -65.1647], [207.4, -65.0963], [207.5, -65.0272], [207.6, -64.9575], [207.7, -64.8871], [207.8, -64.8159], [207.9, -64.7441], [208, -64.6715], [208.1, -64.5982], [208.2, -64.5241], [208.3, -64.4491], [208.4, -64.3734], [208.5, -64.2967], [208.6, -64.2192], [208.7, -64.1408], [208.8, -64.0614], [208.9, -63.9811], [209, -63.8997], [209.1, -63.8173], [209.2, -63.7339], [209.3, -63.6493], [209.4, -63.5636], [209.5, -63.4766], [209.6, -63.3885], [209.7, -63.299], [209.8, -63.2082], [209.9, -63.1161], [210, -63.0225], [210.1, -62.9274], [210.2, -62.8307], [210.3, -62.7325], [210.4, -62.6325], [210.5, -62.5309], [210.6, -62.4274], [210.7, -62.322], [210.8, -62.2146], [210.9, -62.1051], [211, -61.9935], [211.1, -61.8796], [211.2, -61.7634], [211.3, -61.6447], [211.4, -61.5233], [211.5, -61.3993], [211.6, -61.2723], [211.7, -61.1424], [211.8, -61.0093], [211.9, -60.8728], [212, -60.7328], [212.1, -60.589], [212.2, -60.4414], [212.3, -60.2895], [212.4, -60.1333], [212.5, -59.9723], [212.6, -59.8064], [212.7, -59.6352], [212.8, -59.4583], [212.9, -59.2754], [213, -59.0861], [213.1, -58.8899], [213.2, -58.6863], [213.3, -58.4748], [213.4, -58.2548], [213.5, -58.0255], [213.6, -57.7863], [213.7, -57.5364], [213.8, -57.2747], [213.9, -57.0004], [214, -56.7121], [214.1, -56.4087], [214.2, -56.0885], [214.3, -55.7501], [214.4, -55.3914], [214.5, -55.0102], [214.6, -54.6041], [214.7, -54.17], [214.8, -53.7047], [214.9, -53.204], [215, -52.6634], [215.1, -52.0771], [215.2, -51.4386], [215.3, -50.7399], [215.4, -49.9709], [215.5, -49.1198], [215.6, -48.1715], [215.7, -47.1071], [215.8, -45.9024], [215.9, -44.526], [216, -42.9364], [216.1, -41.0776], [216.2, -38.8719], [216.3, -36.2091], [216.4, -32.9263], [216.5, -28.7742], [216.6, -23.3495], [216.7, -15.9579], [216.8, -5.29727], [216.9, 11.3723], [217, 30], [217.1, -65.3817], [217.2, -65.7518], [217.3, -66.1094], [217.4, -66.4539], [217.5, -66.7847], [217.6, -67.1014], [217.7, -67.4036], [217.8, -67.6913], [217.9, -67.9644], [218, -68.2227], [218.1, -68.4666], [218.2, -68.6961], [218.3, -68.9115], [218.4, -69.1132], [218.5, -69.3015], [218.6, -69.4769], [218.7, -69.6398], [218.8, -69.7907], [218.9, -69.9301], [219, -70.0585], [219.1, -70.1764], [219.2, -70.2843], [219.3, -70.3828], [219.4, -70.4722], [219.5, -70.5533], [219.6, -70.6263], [219.7, -70.6917], [219.8, -70.7501], [219.9, -70.8018], [220, -70.8473], [220.1, -70.8869], [220.2, -70.9211], [220.3, -70.95], [220.4, -70.9742], [220.5, -70.9939], [220.6, -71.0094], [220.7, -71.021], [220.8, -71.0289], [220.9, -71.0335], [221, -71.0348], [221.1, -71.0332], [221.2, -71.0288], [221.3, -71.0219], [221.4, -71.0126], [221.5, -71.001], [221.6, -70.9873], [221.7, -70.9717], [221.8, -70.9543], [221.9, -70.9352], [222, -70.9146], [222.1, -70.8924], [222.2, -70.8689], [222.3, -70.8441], [222.4, -70.8182], [222.5, -70.7911], [222.6, -70.7629], [222.7, -70.7338], [222.8, -70.7038], [222.9, -70.6729], [223, -70.6412], [223.1, -70.6088], [223.2, -70.5756], [223.3, -70.5418], [223.4, -70.5074], [223.5, -70.4724], [223.6, -70.4368], [223.7, -70.4007], [223.8, -70.3641], [223.9, -70.327], [224, -70.2895], [224.1, -70.2516], [224.2, -70.2132], [224.3, -70.1745], [224.4, -70.1355], [224.5, -70.096], [224.6, -70.0563], [224.7, -70.0162], [224.8, -69.9759], [224.9, -69.9352], [225, -69.8943], [225.1, -69.853], [225.2, -69.8116], [225.3, -69.7698], [225.4, -69.7279], [225.5, -69.6857], [225.6, -69.6432], [225.7, -69.6005], [225.8, -69.5576], [225.9, -69.5145], [226, -69.4712], [226.1, -69.4277], [226.2, -69.3839], [226.3, -69.34], [226.4, -69.2959], [226.5, -69.2515], [226.6, -69.207], [226.7, -69.1623], [226.8, -69.1174], [226.9, -69.0722], [227, -69.0269], [227.1, -68.9814], [227.2, -68.9358], [227.3, -68.8899], [227.4, -68.8438], [227.5, -68.7976], [227.6, -68.7511], [227.7, -68.7045], [227.8, -68.6576], [227.9, -68.6106], [228, -68.5634], [228.1, -68.516], [228.2, -68.4684], [228.3, -68.4205], [228.4, -68.3725], [228.5, -68.3243], [228.6, -68.2759], [228.7, -68.2272], [228.8, -68.1784], [228.9, -68.1293], [229, -68.0801], [229.1, -68.0306], [229.2, -67.9808], [229.3, -67.9309], [229.4, -67.8807], [229.5, -67.8303], [229.6, -67.7797], [229.7, -67.7288], [229.8, -67.6777], [229.9, -67.6263], [230, -67.5747], [230.1, -67.5228], [230.2, -67.4707], [230.3, -67.4183], [230.4, -67.3656], [230.5, -67.3127], [230.6, -67.2595], [230.7, -67.206], [230.8, -67.1522], [230.9, -67.0981], [231, -67.0438], [231.1, -66.9891], [231.2, -66.9341], [231.3, -66.8788], [231.4, -66.8231], [231.5, -66.7671], [231.6, -66.7108], [231.7, -66.6542], [231.8, -66.5972], [231.9, -66.5398], [232, -66.4821], [232.1, -66.424], [232.2, -66.3655], [232.3, -66.3066], [232.4, -66.2473], [232.5, -66.1876], [232.6, -66.1275], [232.7, -66.067], [232.8, -66.006], [232.9, -65.9445], [233, -65.8826], [233.1, -65.8203], [233.2, -65.7574], [233.3, -65.6941], [233.4, -65.6302], [233.5, -65.5659], [233.6, -65.501], [233.7, -65.4355], [233.8, -65.3695], [233.9, -65.3029], [234, -65.2358], [234.1, -65.168], [234.2, -65.0996], [234.3, -65.0305], [234.4, -64.9608], [234.5, -64.8904], [234.6, -64.8193], [234.7, -64.7475], [234.8, -64.675], [234.9, -64.6017], [235, -64.5276], [235.1, -64.4527], [235.2, -64.377], [235.3, -64.3004], [235.4, -64.2229], [235.5, -64.1445], [235.6, -64.0652], [235.7, -63.9849], [235.8, -63.9036], [235.9, -63.8213], [236, -63.7378], [236.1, -63.6533], [236.2, -63.5676], [236.3, -63.4808], [236.4, -63.3927], [236.5, -63.3033], [236.6, -63.2125], [236.7, -63.1204], [236.8, -63.0269], [236.9, -62.9319], [237, -62.8353], [237.1, -62.7372], [237.2, -62.6373], [237.3, -62.5357], [237.4, -62.4323], [237.5, -62.327], [237.6, -62.2197], [237.7, -62.1104], [237.8, -61.9989], [237.9, -61.8851], [238, -61.7689], [238.1, -61.6503], [238.2, -61.5291], [238.3, -61.4052], [238.4, -61.2784], [238.5, -61.1486], [238.6, -61.0156], [238.7, -60.8793], [238.8, -60.7395], [238.9, -60.5959], [239, -60.4484], [239.1, -60.2968], [239.2, -60.1407], [239.3, -59.98], [239.4, -59.8143], [239.5, -59.6434], [239.6, -59.4668], [239.7, -59.2842], [239.8, -59.0952], [239.9, -58.8994], [240, -58.6961], [240.1, -58.485], [240.2, -58.2654], [240.3, -58.0366], [240.4, -57.7979], [240.5, -57.5485], [240.6, -57.2874], [240.7, -57.0136], [240.8, -56.7261], [240.9, -56.4234], [241, -56.1041], [241.1, -55.7665], [241.2, -55.4088], [241.3, -55.0288], [241.4, -54.6239], [241.5, -54.1912], [241.6, -53.7274], [241.7, -53.2285], [241.8, -52.6899], [241.9, -52.106], [242, -51.4701], [242.1, -50.7744], [242.2, -50.009], [242.3, -49.1621], [242.4, -48.2188], [242.5, -47.1604], [242.6, -45.9629], [242.7, -44.5955], [242.8, -43.0171], [242.9, -41.1725], [243, -38.9854], [243.1, -36.3473], [243.2, -33.0986], [243.3, -28.9951], [243.4, -23.6431], [243.5, -16.367], [243.6, -5.90584], [243.7, 10.3771], [243.8, 30], [243.9, -65.3816], [244, -65.7516], [244.1, -66.1091], [244.2, -66.4535], [244.3, -66.7842], [244.4, -67.1008], [244.5, -67.403], [244.6, -67.6906], [244.7, -67.9635], [244.8, -68.2218], [244.9, -68.4656], [245, -68.6951], [245.1, -68.9104], [245.2, -69.1121], [245.3, -69.3004], [245.4, -69.4757], [245.5, -69.6386], [245.6, -69.7895], [245.7, -69.9288], [245.8, -70.0572], [245.9, -70.1751], [246, -70.283], [246.1, -70.3814], [246.2, -70.4709], [246.3, -70.5518], [246.4, -70.6248], [246.5, -70.6903], [246.6, -70.7487], [246.7, -70.8004], [246.8, -70.8459], [246.9, -70.8855], [247, -70.9196], [247.1, -70.9486], [247.2, -70.9728], [247.3, -70.9925], [247.4, -71.008], [247.5, -71.0195], [247.6, -71.0275], [247.7, -71.032], [247.8, -71.0334], [247.9, -71.0318], [248, -71.0274], [248.1, -71.0204], [248.2, -71.0111], [248.3, -70.9995], [248.4, -70.9859], [248.5, -70.9703], [248.6, -70.9529], [248.7, -70.9338], [248.8, -70.9131], [248.9, -70.891], [249, -70.8675], [249.1, -70.8427], [249.2, -70.8167], [249.3, -70.7896], [249.4, -70.7615], [249.5, -70.7324], [249.6, -70.7023], [249.7, -70.6715], [249.8, -70.6398], [249.9, -70.6073], [250, -70.5742], [250.1, -70.5404], [250.2, -70.5059], [250.3, -70.4709], [250.4, -70.4353], [250.5, -70.3992], [250.6, -70.3626], [250.7, -70.3256], [250.8, -70.2881], [250.9, -70.2501], [251, -70.2118], [251.1, -70.1731], [251.2, -70.134], [251.3, -70.0946], [251.4, -70.0548], [251.5, -70.0148], [251.6, -69.9744], [251.7, -69.9337], [251.8, -69.8928], [251.9, -69.8516], [252, -69.8101], [252.1, -69.7684], [252.2, -69.7264], [252.3, -69.6842], [252.4, -69.6417], [252.5, -69.5991], [252.6, -69.5562], [252.7, -69.5131], [252.8, -69.4697], [252.9, -69.4262], [253, -69.3825], [253.1, -69.3385], [253.2, -69.2944], [253.3, -69.25], [253.4, -69.2055], [253.5, -69.1608], [253.6, -69.1158], [253.7, -69.0707], [253.8, -69.0254], [253.9, -68.9799], [254, -68.9342], [254.1, -68.8883], [254.2, -68.8423], [254.3, -68.796], [254.4, -68.7496], [254.5, -68.7029], [254.6, -68.6561], [254.7, -68.6091], [254.8, -68.5618], [254.9, -68.5144], [255, -68.4668], [255.1, -68.419], [255.2, -68.3709], [255.3, -68.3227], [255.4, -68.2743], [255.5, -68.2256], [255.6, -68.1768], [255.7, -68.1277], [255.8, -68.0784], [255.9, -68.0289], [256, -67.9792], [256.1, -67.9292], [256.2, -67.8791], [256.3, -67.8287], [256.4, -67.778], [256.5, -67.7271], [256.6, -67.676], [256.7, -67.6246], [256.8, -67.573], [256.9, -67.5211], [257, -67.469], [257.1, -67.4166], [257.2, -67.3639], [257.3, -67.311], [257.4, -67.2577], [257.5, -67.2042], [257.6, -67.1504], [257.7, -67.0963], [257.8, -67.042], [257.9, -66.9873], [258, -66.9323], [258.1, -66.8769], [258.2, -66.8213], [258.3, -66.7653], [258.4, -66.709], [258.5, -66.6523], [258.6, -66.5953], [258.7, -66.5379], [258.8, -66.4802], [258.9, -66.422], [259, -66.3635], [259.1, -66.3046], [259.2, -66.2454], [259.3, -66.1856], [259.4, -66.1255], [259.5, -66.065], [259.6, -66.004], [259.7, -65.9425], [259.8, -65.8806], [259.9, -65.8182], [260, -65.7554], [260.1, -65.692], [260.2, -65.6281], [260.3, -65.5638], [260.4, -65.4988], [260.5, -65.4334], [260.6, -65.3673], [260.7, -65.3007], [260.8, -65.2335], [260.9, -65.1657], [261, -65.0973], [261.1, -65.0282], [261.2, -64.9585], [261.3, -64.8881], [261.4, -64.817], [261.5, -64.7451], [261.6, -64.6726], [261.7, -64.5992], [261.8, -64.5251], [261.9, -64.4502], [262, -64.3745], [262.1, -64.2979], [262.2, -64.2204], [262.3, -64.1419], [262.4, -64.0626], [262.5, -63.9823], [262.6, -63.9009], [262.7, -63.8185], [262.8, -63.7351], [262.9, -63.6505], [263, -63.5648], [263.1, -63.4779], [263.2, -63.3897], [263.3, -63.3003], [263.4, -63.2095], [263.5, -63.1174], [263.6, -63.0238], [263.7, -62.9287], [263.8, -62.8321], [263.9, -62.7339], [264, -62.634], [264.1, -62.5323], [264.2, -62.4289], [264.3, -62.3235], [264.4, -62.2162], [264.5, -62.1067], [264.6, -61.9952], [264.7, -61.8813], [264.8, -61.7651], [264.9, -61.6464], [265, -61.5251], [265.1, -61.4011], [265.2, -61.2742], [265.3, -61.1443], [265.4, -61.0112], [265.5, -60.8748], [265.6, -60.7348], [265.7, -60.5911], [265.8, -60.4435], [265.9, -60.2917], [266, -60.1356], [266.1, -59.9747], [266.2, -59.8088], [266.3, -59.6377], [266.4, -59.4609], [266.5, -59.2781], [266.6, -59.0889], [266.7, -58.8928], [266.8, -58.6893], [266.9, -58.478], [267, -58.258], [267.1, -58.0289], [267.2, -57.7899], [267.3, -57.5401], [267.4, -57.2786], [267.5, -57.0044], [267.6, -56.7164], [267.7, -56.4132], [267.8, -56.0933], [267.9, -55.7551], [268, -55.3967], [268.1, -55.0159], [268.2, -54.6101], [268.3, -54.1765], [268.4, -53.7116], [268.5, -53.2115], [268.6, -52.6715], [268.7, -52.086], [268.8, -51.4483], [268.9, -50.7504], [269, -49.9826], [269.1, -49.1328], [269.2, -48.186], [269.3, -47.1234], [269.4, -45.921], [269.5, -44.5473], [269.6, -42.9612], [269.7, -41.1067], [269.8, -38.9068], [269.9, -36.2515], [270, -32.9793], [270.1, -28.8421], [270.2, -23.4398], [270.3, -16.0838], [270.4, -5.4849], [270.5, 11.0649], [270.6, 30], [270.7, -65.3817], [270.8, -65.7517], [270.9, -66.1093], [271, -66.4538], [271.1, -66.7845], [271.2, -67.1012], [271.3, -67.4034], [271.4, -67.6911], [271.5, -67.9641], [271.6, -68.2224], [271.7, -68.4663], [271.8, -68.6958], [271.9, -68.9112], [272, -69.1129], [272.1, -69.3012], [272.2, -69.4766], [272.3, -69.6395], [272.4, -69.7904], [272.5, -69.9297], [272.6, -70.0581], [272.7, -70.176], [272.8, -70.2839], [272.9, -70.3823], [273, -70.4718], [273.1, -70.5528], [273.2, -70.6258], [273.3, -70.6913], [273.4, -70.7497], [273.5, -70.8014], [273.6, -70.8469], [273.7, -70.8865], [273.8, -70.9206], [273.9, -70.9496], [274, -70.9738], [274.1, -70.9935], [274.2, -71.009], [274.3, -71.0206], [274.4, -71.0285], [274.5, -71.033], [274.6, -71.0344], [274.7, -71.0328], [274.8, -71.0284], [274.9, -71.0214], [275, -71.0121], [275.1, -71.0005], [275.2, -70.9869], [275.3, -70.9713], [275.4, -70.9539], [275.5, -70.9348], [275.6, -70.9141], [275.7, -70.892], [275.8, -70.8685], [275.9, -70.8437], [276, -70.8177], [276.1, -70.7906], [276.2, -70.7625], [276.3, -70.7334], [276.4, -70.7033], [276.5, -70.6725], [276.6, -70.6408], [276.7, -70.6083], [276.8, -70.5752], [276.9, -70.5414], [277, -70.5069], [277.1, -70.4719], [277.2, -70.4363], [277.3, -70.4002], [277.4, -70.3636], [277.5, -70.3266], [277.6, -70.2891], [277.7, -70.2511], [277.8, -70.2128], [277.9, -70.1741], [278, -70.135], [278.1, -70.0956], [278.2, -70.0558], [278.3, -70.0158], [278.4, -69.9754], [278.5, -69.9348], [278.6, -69.8938], [278.7, -69.8526], [278.8, -69.8111], [278.9, -69.7694], [279, -69.7274], [279.1, -69.6852], [279.2, -69.6428], [279.3, -69.6001], [279.4, -69.5572], [279.5, -69.5141], [279.6, -69.4708], [279.7, -69.4272], [279.8, -69.3835], [279.9, -69.3395], [280, -69.2954], [280.1, -69.2511], [280.2, -69.2065], [280.3, -69.1618], [280.4, -69.1169], [280.5, -69.0718], [280.6, -69.0265], [280.7, -68.981], [280.8, -68.9353], [280.9, -68.8894], [281, -68.8433], [281.1, -68.7971], [281.2, -68.7506], [281.3, -68.704], [281.4, -68.6572], [281.5, -68.6101], [281.6, -68.5629], [281.7, -68.5155], [281.8, -68.4679], [281.9, -68.4201], [282, -68.372], [282.1, -68.3238], [282.2, -68.2754], [282.3, -68.2267], [282.4, -68.1779], [282.5, -68.1288], [282.6, -68.0796], [282.7, -68.0301], [282.8, -67.9803], [282.9, -67.9304], [283, -67.8802], [283.1, -67.8298], [283.2, -67.7792], [283.3, -67.7283], [283.4, -67.6772], [283.5, -67.6258], [283.6, -67.5742], [283.7, -67.5223], [283.8, -67.4702], [283.9, -67.4178], [284, -67.3651], [284.1, -67.3122], [284.2, -67.259], [284.3, -67.2055], [284.4, -67.1517], [284.5, -67.0976], [284.6, -67.0432], [284.7, -66.9885], [284.8, -66.9335], [284.9, -66.8782], [285, -66.8225], [285.1, -66.7666], [285.2, -66.7103], [285.3, -66.6536], [285.4, -66.5966], [285.5, -66.5392], [285.6, -66.4815], [285.7, -66.4234], [285.8, -66.3649], [285.9, -66.306], [286, -66.2467], [286.1, -66.187], [286.2, -66.1269], [286.3, -66.0663], [286.4, -66.0054], [286.5, -65.9439], [286.6, -65.882], [286.7, -65.8197], [286.8, -65.7568], [286.9, -65.6935], [287, -65.6296], [287.1, -65.5652], [287.2, -65.5003], [287.3, -65.4349], [287.4, -65.3688], [287.5, -65.3023], [287.6, -65.2351], [287.7, -65.1673], [287.8, -65.0989], [287.9, -65.0298], [288, -64.9601], [288.1, -64.8897], [288.2, -64.8186], [288.3, -64.7468], [288.4, -64.6742], [288.5, -64.6009], [288.6, -64.5268], [288.7, -64.4519], [288.8, -64.3762], [288.9, -64.2996], [289, -64.2221], [289.1, -64.1437], [289.2, -64.0644], [289.3, -63.9841], [289.4, -63.9028], [289.5, -63.8204], [289.6, -63.737], [289.7, -63.6525], [289.8, -63.5668], [289.9, -63.4799], [290, -63.3918], [290.1, -63.3023], [290.2, -63.2116], [290.3, -63.1195], [290.4, -63.026], [290.5, -62.9309], [290.6, -62.8343], [290.7, -62.7361], [290.8, -62.6363], [290.9, -62.5347], [291, -62.4312], [291.1, -62.3259], [291.2, -62.2186], [291.3, -62.1092], [291.4, -61.9977], [291.5, -61.8839], [291.6, -61.7678], [291.7, -61.6491], [291.8, -61.5279], [291.9, -61.4039], [292, -61.2771], [292.1, -61.1473], [292.2, -61.0143], [292.3, -60.8779], [292.4, -60.738], [292.5, -60.5944], [292.6, -60.4469], [292.7, -60.2952], [292.8, -60.1391], [292.9, -59.9784], [293, -59.8126], [293.1, -59.6416], [293.2, -59.465], [293.3, -59.2823], [293.4, -59.0933], [293.5, -58.8973], [293.6, -58.694], [293.7, -58.4828], [293.8, -58.2631], [293.9, -58.0342], [294, -57.7954], [294.1, -57.5459], [294.2, -57.2847], [294.3, -57.0108], [294.4, -56.7231], [294.5, -56.4202], [294.6, -56.1007], [294.7, -55.763], [294.8, -55.4051], [294.9, -55.0248], [295, -54.6196], [295.1, -54.1867], [295.2, -53.7225], [295.3, -53.2233], [295.4, -52.6842], [295.5, -52.0998], [295.6, -51.4634], [295.7, -50.767], [295.8, -50.0009], [295.9, -49.1531], [296, -48.2087], [296.1, -47.149], [296.2, -45.95], [296.3, -44.5806], [296.4, -42.9998], [296.5, -41.1522], [296.6, -38.9612], [296.7, -36.3178], [296.8, -33.0618], [296.9, -28.9479], [297, -23.5804], [297.1, -16.2798], [297.2, -5.77628], [297.3, 10.5885], [297.4, 30], [297.5, -65.3816], [297.6, -65.7516], [297.7, -66.1092], [297.8, -66.4536], [297.9, -66.7843], [298, -67.1009], [298.1, -67.4031], [298.2, -67.6907], [298.3, -67.9637], [298.4, -68.222], [298.5, -68.4658], [298.6, -68.6953], [298.7, -68.9107], [298.8, -69.1123], [298.9, -69.3006], [299, -69.476], [299.1, -69.6389], [299.2, -69.7897], [299.3, -69.9291], [299.4, -70.0575], [299.5, -70.1754], [299.6, -70.2832], [299.7, -70.3817], [299.8, -70.4711], [299.9, -70.5521], [300, -70.6251], [300.1, -70.6906], [300.2, -70.749], [300.3, -70.8007], [300.4, -70.8462], [300.5, -70.8858], [300.6, -70.9199], [300.7, -70.9489], [300.8, -70.9731], [300.9, -70.9928], [301, -71.0083], [301.1, -71.0199], [301.2, -71.0278], [301.3, -71.0323], [301.4, -71.0337], [301.5, -71.0321], [301.6, -71.0277], [301.7, -71.0208], [301.8, -71.0114], [301.9, -70.9998], [302, -70.9862], [302.1, -70.9706], [302.2, -70.9532], [302.3, -70.9341], [302.4, -70.9134], [302.5, -70.8913], [302.6, -70.8678], [302.7, -70.843], [302.8, -70.817], [302.9, -70.7899], [303, -70.7618], [303.1, -70.7327], [303.2, -70.7026], [303.3, -70.6718], [303.4, -70.6401], [303.5, -70.6076], [303.6, -70.5745], [303.7, -70.5407], [303.8, -70.5062], [303.9, -70.4712], [304, -70.4356], [304.1, -70.3995], [304.2, -70.3629], [304.3, -70.3259], [304.4, -70.2884], [304.5, -70.2504], [304.6, -70.2121], [304.7, -70.1734], [304.8, -70.1343], [304.9, -70.0949], [305, -70.0552], [305.1, -70.0151], [305.2, -69.9747], [305.3, -69.9341], [305.4, -69.8931], [305.5, -69.8519], [305.6, -69.8104], [305.7, -69.7687], [305.8, -69.7267], [305.9, -69.6845], [306, -69.6421], [306.1, -69.5994], [306.2, -69.5565], [306.3, -69.5134], [306.4, -69.47], [306.5, -69.4265], [306.6, -69.3828], [306.7, -69.3388], [306.8, -69.2947], [306.9, -69.2503], [307, -69.2058], [307.1, -69.1611], [307.2, -69.1162], [307.3, -69.071], [307.4, -69.0257], [307.5, -68.9802], [307.6, -68.9345], [307.7, -68.8887], [307.8, -68.8426], [307.9, -68.7963], [308, -68.7499], [308.1, -68.7032], [308.2, -68.6564], [308.3, -68.6094], [308.4, -68.5622], [308.5, -68.5147], [308.6, -68.4671], [308.7, -68.4193], [308.8, -68.3713], [308.9, -68.323], [309, -68.2746], [309.1, -68.226], [309.2, -68.1771], [309.3, -68.1281], [309.4, -68.0788], [309.5, -68.0293], [309.6, -67.9795], [309.7, -67.9296], [309.8, -67.8794], [309.9, -67.829], [310, -67.7784], [310.1, -67.7275], [310.2, -67.6764], [310.3, -67.625], [310.4, -67.5734], [310.5, -67.5215], [310.6, -67.4694], [310.7, -67.4169], [310.8, -67.3643], [310.9, -67.3113], [311, -67.2581], [311.1, -67.2046], [311.2, -67.1508], [311.3, -67.0967], [311.4, -67.0423], [311.5, -66.9876], [311.6, -66.9326], [311.7, -66.8773], [311.8, -66.8217], [311.9, -66.7657], [312, -66.7094], [312.1, -66.6527], [312.2, -66.5957], [312.3, -66.5383], [312.4, -66.4806], [312.5, -66.4225], [312.6, -66.364], [312.7, -66.3051], [312.8, -66.2458], [312.9, -66.1861], [313, -66.1259], [313.1, -66.0654], [313.2, -66.0044], [313.3, -65.9429], [313.4, -65.881], [313.5, -65.8187], [313.6, -65.7558], [313.7, -65.6925], [313.8, -65.6286], [313.9, -65.5642], [314, -65.4993], [314.1, -65.4338], [314.2, -65.3678], [314.3, -65.3012], [314.4, -65.234], [314.5, -65.1662], [314.6, -65.0978], [314.7, -65.0287], [314.8, -64.959], [314.9, -64.8886], [315, -64.8175], [315.1, -64.7456], [315.2, -64.6731], [315.3, -64.5998], [315.4, -64.5257], [315.5, -64.4507], [315.6, -64.375], [315.7, -64.2984], [315.8, -64.2209], [315.9, -64.1425], [316, -64.0631], [316.1, -63.9828], [316.2, -63.9015], [316.3, -63.8191], [316.4, -63.7357], [316.5, -63.6511], [316.6, -63.5654], [316.7, -63.4785], [316.8, -63.3904], [316.9, -63.3009], [317, -63.2102], [317.1, -63.118], [317.2, -63.0245], [317.3, -62.9294], [317.4, -62.8328], [317.5, -62.7346], [317.6, -62.6347], [317.7, -62.5331], [317.8, -62.4296], [317.9, -62.3242], [318, -62.2169], [318.1, -62.1075], [318.2, -61.9959], [318.3, -61.8821], [318.4, -61.7659], [318.5, -61.6472], [318.6, -61.526], [318.7, -61.402], [318.8, -61.2751], [318.9, -61.1452], [319, -61.0121], [319.1, -60.8757], [319.2, -60.7358], [319.3, -60.5922], [319.4, -60.4446], [319.5, -60.2928], [319.6, -60.1367], [319.7, -59.9758], [319.8, -59.81], [319.9, -59.6389], [320, -59.4622], [320.1, -59.2794], [320.2, -59.0902], [320.3, -58.8942], [320.4, -58.6908], [320.5, -58.4794], [320.6, -58.2596], [320.7, -58.0306], [320.8, -57.7916], [320.9, -57.5419], [321, -57.2805], [321.1, -57.0064], [321.2, -56.7184], [321.3, -56.4153], [321.4, -56.0956], [321.5, -55.7575], [321.6, -55.3993], [321.7, -55.0186], [321.8, -54.6131], [321.9, -54.1796], [322, -53.715], [322.1, -53.2151], [322.2, -52.6754], [322.3, -52.0902], [322.4, -51.4529], [322.5, -50.7555], [322.6, -49.9882], [322.7, -49.139], [322.8, -48.193], [322.9, -47.1313], [323, -45.9299], [323.1, -44.5576], [323.2, -42.9731], [323.3, -41.1207], [323.4, -38.9235], [323.5, -36.2719], [323.6, -33.0047], [323.7, -28.8746], [323.8, -23.4831], [323.9, -16.1442], [324, -5.57469], [324.1, 10.9179], [324.2, 30], [324.3, -65.3817], [324.4, -65.7517], [324.5, -66.1093], [324.6, -66.4537], [324.7, -66.7844], [324.8, -67.1011], [324.9, -67.4033], [325, -67.691], [325.1, -67.964], [325.2, -68.2223], [325.3, -68.4661], [325.4, -68.6956], [325.5, -68.911], [325.6, -69.1127], [325.7, -69.301], [325.8, -69.4764], [325.9, -69.6393], [326, -69.7902], [326.1, -69.9295], [326.2, -70.0579], [326.3, -70.1758], [326.4, -70.2837], [326.5, -70.3821], [326.6, -70.4716], [326.7, -70.5526], [326.8, -70.6256], [326.9, -70.6911], [327, -70.7495], [327.1, -70.8012], [327.2, -70.8467], [327.3, -70.8863], [327.4, -70.9204], [327.5, -70.9494], [327.6, -70.9736], [327.7, -70.9932], [327.8, -71.0088], [327.9, -71.0203], [328, -71.0283], [328.1, -71.0328], [328.2, -71.0342], [328.3, -71.0325], [328.4, -71.0282], [328.5, -71.0212], [328.6, -71.0119], [328.7, -71.0003], [328.8, -70.9867], [328.9, -70.9711], [329, -70.9537], [329.1, -70.9346], [329.2, -70.9139], [329.3, -70.8918], [329.4, -70.8683], [329.5, -70.8435], [329.6, -70.8175], [329.7, -70.7904], [329.8, -70.7623], [329.9, -70.7332], [330, -70.7031], [330.1, -70.6722], [330.2, -70.6406], [330.3, -70.6081], [330.4, -70.575], [330.5, -70.5412], [330.6, -70.5067], [330.7, -70.4717], [330.8, -70.4361], [330.9, -70.4], [331, -70.3634], [331.1, -70.3264], [331.2, -70.2888], [331.3, -70.2509], [331.4, -70.2126], [331.5, -70.1739], [331.6, -70.1348], [331.7, -70.0954], [331.8, -70.0556], [331.9, -70.0156], [332, -69.9752], [332.1, -69.9345], [332.2, -69.8936], [332.3, -69.8524], [332.4, -69.8109], [332.5, -69.7692], [332.6, -69.7272], [332.7, -69.685], [332.8, -69.6425], [332.9, -69.5999], [333, -69.557], [333.1, -69.5139], [333.2, -69.4705], [333.3, -69.427], [333.4, -69.3833], [333.5, -69.3393], [333.6, -69.2952], [333.7, -69.2508], [333.8, -69.2063], [333.9, -69.1616], [334, -69.1167], [334.1, -69.0715], [334.2, -69.0262], [334.3, -68.9807], [334.4, -68.9351], [334.5, -68.8892], [334.6, -68.8431], [334.7, -68.7969], [334.8, -68.7504], [334.9, -68.7038], [335, -68.6569], [335.1, -68.6099], [335.2, -68.5627], [335.3, -68.5153], [335.4, -68.4676], [335.5, -68.4198], [335.6, -68.3718], [335.7, -68.3236], [335.8, -68.2751], [335.9, -68.2265], [336, -68.1777], [336.1, -68.1286], [336.2, -68.0793], [336.3, -68.0298], [336.4, -67.9801], [336.5, -67.9301], [336.6, -67.88], [336.7, -67.8296], [336.8, -67.7789], [336.9, -67.728], [337, -67.6769], [337.1, -67.6256], [337.2, -67.5739], [337.3, -67.5221], [337.4, -67.4699], [337.5, -67.4175], [337.6, -67.3649], [337.7, -67.3119], [337.8, -67.2587], [337.9, -67.2052], [338, -67.1514], [338.1, -67.0973], [338.2, -67.0429], [338.3, -66.9882], [338.4, -66.9332], [338.5, -66.8779], [338.6, -66.8223], [338.7, -66.7663], [338.8, -66.71], [338.9, -66.6533], [339, -66.5963], [339.1, -66.5389], [339.2, -66.4812], [339.3, -66.4231], [339.4, -66.3646], [339.5, -66.3057], [339.6, -66.2464], [339.7, -66.1867], [339.8, -66.1266], [339.9, -66.066], [340, -66.0051], [340.1, -65.9436], [340.2, -65.8817], [340.3, -65.8193], [340.4, -65.7565], [340.5, -65.6931], [340.6, -65.6293], [340.7, -65.5649], [340.8, -65.5], [340.9, -65.4345], [341, -65.3685], [341.1, -65.3019], [341.2, -65.2347], [341.3, -65.1669], [341.4, -65.0985], [341.5, -65.0295], [341.6, -64.9597], [341.7, -64.8893], [341.8, -64.8182], [341.9, -64.7464], [342, -64.6739], [342.1, -64.6006], [342.2, -64.5265], [342.3, -64.4516], [342.4, -64.3758], [342.5, -64.2992], [342.6, -64.2217], [342.7, -64.1433], [342.8, -64.064], [342.9, -63.9837], [343, -63.9024], [343.1, -63.82], [343.2, -63.7366], [343.3, -63.652], [343.4, -63.5663], [343.5, -63.4795], [343.6, -63.3913], [343.7, -63.3019], [343.8, -63.2112], [343.9, -63.1191], [344, -63.0255], [344.1, -62.9305], [344.2, -62.8339], [344.3, -62.7357], [344.4, -62.6358], [344.5, -62.5342], [344.6, -62.4307], [344.7, -62.3254], [344.8, -62.2181], [344.9, -62.1087], [345, -61.9972], [345.1, -61.8834], [345.2, -61.7672], [345.3, -61.6485], [345.4, -61.5273], [345.5, -61.4033], [345.6, -61.2765], [345.7, -61.1466], [345.8, -61.0136], [345.9, -60.8772], [346, -60.7373], [346.1, -60.5937], [346.2, -60.4462], [346.3, -60.2945], [346.4, -60.1384], [346.5, -59.9776], [346.6, -59.8118], [346.7, -59.6408], [346.8, -59.4641], [346.9, -59.2814], [347, -59.0923], [347.1, -58.8964], [347.2, -58.693], [347.3, -58.4818], [347.4, -58.262], [347.5, -58.0331], [347.6, -57.7942], [347.7, -57.5446], [347.8, -57.2834], [347.9, -57.0094], [348, -56.7216], [348.1, -56.4187], [348.2, -56.0992], [348.3, -55.7613], [348.4, -55.4033], [348.5, -55.0229], [348.6, -54.6176], [348.7, -54.1845], [348.8, -53.7202], [348.9, -53.2208], [349, -52.6815], [349.1, -52.0968], [349.2, -51.4601], [349.3, -50.7634], [349.4, -49.997], [349.5, -49.1487], [349.6, -48.2038], [349.7, -47.1435], [349.8, -45.9438], [349.9, -44.5735], [350, -42.9916], [350.1, -41.1425], [350.2, -38.9496], [350.3, -36.3036], [350.4, -33.0442], [350.5, -28.9253], [350.6, -23.5504], [350.7, -16.238], [350.8, -5.71421], [350.9, 10.6899], [351, 30], [351.1, -65.3816], [351.2, -65.7516], [351.3, -66.1092], [351.4, -66.4536], [351.5, -66.7843], [351.6, -67.101], [351.7, -67.4032], [351.8, -67.6908], [351.9, -67.9638], [352, -68.2221], [352.1, -68.4659], [352.2, -68.6954], [352.3, -68.9108], [352.4, -69.1124], [352.5, -69.3007], [352.6, -69.4761], [352.7, -69.639], [352.8, -69.7899], [352.9, -69.9292], [353, -70.0576], [353.1, -70.1755], [353.2, -70.2834], [353.3, -70.3818], [353.4, -70.4713], [353.5, -70.5523], [353.6, -70.6253], [353.7, -70.6908], [353.8, -70.7491], [353.9, -70.8009], [354, -70.8463], [354.1, -70.8859], [354.2, -70.9201], [354.3, -70.949], [354.4, -70.9732], [354.5, -70.9929], [354.6, -71.0084], [354.7, -71.02], [354.8, -71.0279], [354.9, -71.0325], [355, -71.0338], [355.1, -71.0322], [355.2, -71.0278], [355.3, -71.0209], [355.4, -71.0116], [355.5, -71], [355.6, -70.9863], [355.7, -70.9707], [355.8, -70.9533], [355.9, -70.9342], [356, -70.9136], [356.1, -70.8914], [356.2, -70.8679], [356.3, -70.8431], [356.4, -70.8172], [356.5, -70.7901], [356.6, -70.7619], [356.7, -70.7328], [356.8, -70.7028], [356.9, -70.6719], [357, -70.6402], [357.1, -70.6078], [357.2, -70.5746], [357.3, -70.5408], [357.4, -70.5064], [357.5, -70.4714], [357.6, -70.4358], [357.7, -70.3997], [357.8, -70.3631], [357.9, -70.326], [358, -70.2885], [358.1, -70.2506], [358.2, -70.2123], [358.3, -70.1735], [358.4, -70.1345], [358.5, -70.0951], [358.6, -70.0553], [358.7, -70.0152], [358.8, -69.9749], [358.9, -69.9342], [359, -69.8933], [359.1, -69.852], [359.2, -69.8106], [359.3, -69.7688], [359.4, -69.7269], [359.5, -69.6847], [359.6, -69.6422], [359.7, -69.5995], [359.8, -69.5566], [359.9, -69.5135], [360, -69.4702], [360.1, -69.4267], [360.2, -69.3829], [360.3, -69.339], [360.4, -69.2948], [360.5, -69.2505], [360.6, -69.206], [360.7, -69.1612], [360.8, -69.1163], [360.9, -69.0712], [361, -69.0259], [361.1, -68.9804], [361.2, -68.9347], [361.3, -68.8888], [361.4, -68.8428], [361.5, -68.7965], [361.6, -68.75], [361.7, -68.7034], [361.8, -68.6566], [361.9, -68.6095], [362, -68.5623], [362.1, -68.5149], [362.2, -68.4673], [362.3, -68.4195], [362.4, -68.3714], [362.5, -68.3232], [362.6, -68.2748], [362.7, -68.2261], [362.8, -68.1773], [362.9, -68.1282], [363, -68.0789], [363.1, -68.0294], [363.2, -67.9797], [363.3, -67.9298], [363.4, -67.8796], [363.5, -67.8292], [363.6, -67.7785], [363.7, -67.7277], [363.8, -67.6765], [363.9, -67.6252], [364, -67.5735], [364.1, -67.5217], [364.2, -67.4695], [364.3, -67.4171], [364.4, -67.3645], [364.5, -67.3115], [364.6, -67.2583], [364.7, -67.2048], [364.8, -67.151], [364.9, -67.0969], [365, -67.0425], [365.1, -66.9878], [365.2, -66.9328], [365.3, -66.8775], [365.4, -66.8219], [365.5, -66.7659], [365.6, -66.7096], [365.7, -66.6529], [365.8, -66.5959], [365.9, -66.5385], [366, -66.4808], [366.1, -66.4227], [366.2, -66.3642], [366.3, -66.3053], [366.4, -66.246], [366.5, -66.1863], [366.6, -66.1261], [366.7, -66.0656], [366.8, -66.0046], [366.9, -65.9432], [367, -65.8812], [367.1, -65.8189], [367.2, -65.756], [367.3, -65.6927], [367.4, -65.6288], [367.5, -65.5644], [367.6, -65.4995], [367.7, -65.434], [367.8, -65.368], [367.9, -65.3014], [368, -65.2342], [368.1, -65.1664], [368.2, -65.098], [368.3, -65.0289], [368.4, -64.9592], [368.5, -64.8888], [368.6, -64.8177], [368.7, -64.7459], [368.8, -64.6733], [368.9, -64.6], [369, -64.5259], [369.1, -64.451], [369.2, -64.3752], [369.3, -64.2986], [369.4, -64.2212], [369.5, -64.1428], [369.6, -64.0634], [369.7, -63.9831], [369.8, -63.9018], [369.9, -63.8194], [370, -63.736], [370.1, -63.6514], [370.2, -63.5657], [370.3, -63.4788], [370.4, -63.3907], [370.5, -63.3012], [370.6, -63.2105], [370.7, -63.1184], [370.8, -63.0248], [370.9, -62.9297], [371, -62.8331], [371.1, -62.7349], [371.2, -62.635], [371.3, -62.5334], [371.4, -62.43], [371.5, -62.3246], [371.6, -62.2173], [371.7, -62.1079], [371.8, -61.9963], [371.9, -61.8825], [372, -61.7663], [372.1, -61.6476], [372.2, -61.5264], [372.3, -61.4024], [372.4, -61.2755], [372.5, -61.1456], [372.6, -61.0126], [372.7, -60.8762], [372.8, -60.7363], [372.9, -60.5926], [373, -60.4451], [373.1, -60.2933], [373.2, -60.1372], [373.3, -59.9764], [373.4, -59.8106], [373.5, -59.6395], [373.6, -59.4628], [373.7, -59.28], [373.8, -59.0909], [373.9, -58.8949], [374, -58.6915], [374.1, -58.4802], [374.2, -58.2603], [374.3, -58.0313], [374.4, -57.7924], [374.5, -57.5427], [374.6, -57.2814], [374.7, -57.0073], [374.8, -56.7194], [374.9, -56.4164], [375, -56.0967], [375.1, -55.7587], [375.2, -55.4005], [375.3, -55.0199], [375.4, -54.6145], [375.5, -54.1811], [375.6, -53.7166], [375.7, -53.2169], [375.8, -52.6773], [375.9, -52.0922], [376, -51.4551], [376.1, -50.758], [376.2, -49.9909], [376.3, -49.142], [376.4, -48.1963], [376.5, -47.1351], [376.6, -45.9342], [376.7, -44.5625], [376.8, -42.9788], [376.9, -41.1274], [377, -38.9315], [377.1, -36.2817], [377.2, -33.0168], [377.3, -28.8902], [377.4, -23.5038], [377.5, -16.1731], [377.6, -5.61767], [377.7, 10.8477], [377.8, 30], [377.9, -65.3817], [378, -65.7517], [378.1, -66.1092], [378.2, -66.4537], [378.3, -66.7844], [378.4, -67.1011], [378.5, -67.4033], [378.6, -67.6909], [378.7, -67.9639], [378.8, -68.2223], [378.9, -68.4661], [379, -68.6955], [379.1, -68.9109], [379.2, -69.1126], [379.3, -69.3009], [379.4, -69.4763], [379.5, -69.6392], [379.6, -69.7901], [379.7, -69.9295], [379.8, -70.0578], [379.9, -70.1757], [380, -70.2836], [380.1, -70.382], [380.2, -70.4715], [380.3, -70.5525], [380.4, -70.6255], [380.5, -70.691], [380.6, -70.7494], [380.7, -70.8011], [380.8, -70.8466], [380.9, -70.8862], [381, -70.9203], [381.1, -70.9493], [381.2, -70.9735], [381.3, -70.9931], [381.4, -71.0086], [381.5, -71.0202], [381.6, -71.0282], [381.7, -71.0327], [381.8, -71.0341], [381.9, -71.0324], [382, -71.0281], [382.1, -71.0211], [382.2, -71.0118], [382.3, -71.0002], [382.4, -70.9866], [382.5, -70.971], [382.6, -70.9536], [382.7, -70.9345], [382.8, -70.9138], [382.9, -70.8917], [383, -70.8682], [383.1, -70.8434], [383.2, -70.8174], [383.3, -70.7903], [383.4, -70.7622], [383.5, -70.7331], [383.6, -70.703], [383.7, -70.6721], [383.8, -70.6405], [383.9, -70.608], [384, -70.5749], [384.1, -70.5411], [384.2, -70.5066], [384.3, -70.4716], [384.4, -70.436], [384.5, -70.3999], [384.6, -70.3633], [384.7, -70.3263], [384.8, -70.2887], [384.9, -70.2508], [385, -70.2125], [385.1, -70.1738], [385.2, -70.1347], [385.3, -70.0953], [385.4, -70.0555], [385.5, -70.0155], [385.6, -69.9751], [385.7, -69.9344], [385.8, -69.8935], [385.9, -69.8523], [386, -69.8108], [386.1, -69.7691], [386.2, -69.7271], [386.3, -69.6849], [386.4, -69.6424], [386.5, -69.5998], [386.6, -69.5569], [386.7, -69.5138], [386.8, -69.4704], [386.9, -69.4269], [387, -69.3832], [387.1, -69.3392], [387.2, -69.2951], [387.3, -69.2507], [387.4, -69.2062], [387.5, -69.1615], [387.6, -69.1166], [387.7, -69.0714], [387.8, -69.0261], [387.9, -68.9806], [388, -68.9349], [388.1, -68.8891], [388.2, -68.843], [388.3, -68.7967], [388.4, -68.7503], [388.5, -68.7037], [388.6, -68.6568], [388.7, -68.6098], [388.8, -68.5626], [388.9, -68.5151], [389, -68.4675], [389.1, -68.4197], [389.2, -68.3717], [389.3, -68.3235], [389.4, -68.275], [389.5, -68.2264], [389.6, -68.1775], [389.7, -68.1285], [389.8, -68.0792], [389.9, -68.0297], [390, -67.98], [390.1, -67.93], [390.2, -67.8799], [390.3, -67.8294], [390.4, -67.7788], [390.5, -67.7279], [390.6, -67.6768], [390.7, -67.6254], [390.8, -67.5738], [390.9, -67.5219], [391, -67.4698], [391.1, -67.4174], [391.2, -67.3647], [391.3, -67.3118], [391.4, -67.2586], [391.5, -67.2051], [391.6, -67.1513], [391.7, -67.0972], [391.8, -67.0428], [391.9, -66.9881], [392, -66.9331], [392.1, -66.8778], [392.2, -66.8221], [392.3, -66.7662], [392.4, -66.7099], [392.5, -66.6532], [392.6, -66.5962], [392.7, -66.5388], [392.8, -66.4811], [392.9, -66.423], [393, -66.3645], [393.1, -66.3056], [393.2, -66.2463], [393.3, -66.1866], [393.4, -66.1265], [393.5, -66.0659], [393.6, -66.0049], [393.7, -65.9435], [393.8, -65.8816], [393.9, -65.8192], [394, -65.7563], [394.1, -65.693], [394.2, -65.6291], [394.3, -65.5648], [394.4, -65.4998], [394.5, -65.4344], [394.6, -65.3684], [394.7, -65.3018], [394.8, -65.2346], [394.9, -65.1668], [395, -65.0984], [395.1, -65.0293], [395.2, -64.9596], [395.3, -64.8892], [395.4, -64.8181], [395.5, -64.7463], [395.6, -64.6737], [395.7, -64.6004], [395.8, -64.5263], [395.9, -64.4514], [396, -64.3756], [396.1, -64.299], [396.2, -64.2216], [396.3, -64.1432], [396.4, -64.0638], [396.5, -63.9835], [396.6, -63.9022], [396.7, -63.8198], [396.8, -63.7364], [396.9, -63.6518], [397, -63.5661], [397.1, -63.4792], [397.2, -63.3911], [397.3, -63.3017], [397.4, -63.211], [397.5, -63.1188], [397.6, -63.0253], [397.7, -62.9302], [397.8, -62.8336], [397.9, -62.7354], [398, -62.6356], [398.1, -62.5339], [398.2, -62.4305], [398.3, -62.3252], [398.4, -62.2178], [398.5, -62.1084], [398.6, -61.9969], [398.7, -61.8831], [398.8, -61.7669], [398.9, -61.6483], [399, -61.527], [399.1, -61.403], [399.2, -61.2762], [399.3, -61.1463], [399.4, -61.0133], [399.5, -60.8769], [399.6, -60.737], [399.7, -60.5934], [399.8, -60.4458], [399.9, -60.2941], [400, -60.138], [400.1, -59.9772], [400.2, -59.8114], [400.3, -59.6404], [400.4, -59.4637], [400.5, -59.281], [400.6, -59.0919], [400.7, -58.8959], [400.8, -58.6926], [400.9, -58.4813], [401, -58.2615], [401.1, -58.0325], [401.2, -57.7937], [401.3, -57.544], [401.4, -57.2828], [401.5, -57.0088], [401.6, -56.7209], [401.7, -56.418], [401.8, -56.0984], [401.9, -55.7605], [402, -55.4024], [402.1, -55.022], [402.2, -54.6166], [402.3, -54.1835], [402.4, -53.7191], [402.5, -53.2196], [402.6, -52.6802], [402.7, -52.0954], [402.8, -51.4586], [402.9, -50.7617], [403, -49.9951], [403.1, -49.1467], [403.2, -48.2015], [403.3, -47.1409], [403.4, -45.9408], [403.5, -44.5701], [403.6, -42.9876], [403.7, -41.1379], [403.8, -38.944], [403.9, -36.2969], [404, -33.0358], [404.1, -28.9145], [404.2, -23.5361], [404.3, -16.218], [404.4, -5.68448], [404.5, 10.7385], [404.6, 30], [404.7, -65.3816], [404.8, -65.7517], [404.9, -66.1092], [405, -66.4536], [405.1, -66.7844], [405.2, -67.101], [405.3, -67.4032], [405.4, -67.6909], [405.5, -67.9638], [405.6, -68.2222], [405.7, -68.466], [405.8, -68.6954], [405.9, -68.9108], [406, -69.1125], [406.1, -69.3008], [406.2, -69.4762], [406.3, -69.6391], [406.4, -69.7899], [406.5, -69.9293], [406.6, -70.0577], [406.7, -70.1756], [406.8, -70.2835], [406.9, -70.3819], [407, -70.4714], [407.1, -70.5524], [407.2, -70.6254], [407.3, -70.6908], [407.4, -70.7492], [407.5, -70.8009], [407.6, -70.8464], [407.7, -70.886], [407.8, -70.9201], [407.9, -70.9491], [408, -70.9733], [408.1, -70.993], [408.2, -71.0085], [408.3, -71.0201], [408.4, -71.028], [408.5, -71.0325], [408.6, -71.0339], [408.7, -71.0323], [408.8, -71.0279], [408.9, -71.021], [409, -71.0116], [409.1, -71.0001], [409.2, -70.9864], [409.3, -70.9708], [409.4, -70.9534], [409.5, -70.9343], [409.6, -70.9136], [409.7, -70.8915], [409.8, -70.868], [409.9, -70.8432], [410, -70.8172], [410.1, -70.7901], [410.2, -70.762], [410.3, -70.7329], [410.4, -70.7029], [410.5, -70.672], [410.6, -70.6403], [410.7, -70.6079], [410.8, -70.5747], [410.9, -70.5409], [411, -70.5065], [411.1, -70.4714], [411.2, -70.4359], [411.3, -70.3998], [411.4, -70.3632], [411.5, -70.3261], [411.6, -70.2886], [411.7, -70.2507], [411.8, -70.2123], [411.9, -70.1736], [412, -70.1345], [412.1, -70.0951], [412.2, -70.0554], [412.3, -70.0153], [412.4, -69.9749], [412.5, -69.9343], [412.6, -69.8933], [412.7, -69.8521], [412.8, -69.8106], [412.9, -69.7689], [413, -69.7269], [413.1, -69.6847], [413.2, -69.6423], [413.3, -69.5996], [413.4, -69.5567], [413.5, -69.5136], [413.6, -69.4703], [413.7, -69.4267], [413.8, -69.383], [413.9, -69.3391], [414, -69.2949], [414.1, -69.2506], [414.2, -69.206], [414.3, -69.1613], [414.4, -69.1164], [414.5, -69.0713], [414.6, -69.026], [414.7, -68.9805], [414.8, -68.9348], [414.9, -68.8889], [415, -68.8428], [415.1, -68.7966], [415.2, -68.7501], [415.3, -68.7035], [415.4, -68.6566], [415.5, -68.6096], [415.6, -68.5624], [415.7, -68.515], [415.8, -68.4674], [415.9, -68.4195], [416, -68.3715], [416.1, -68.3233], [416.2, -68.2749], [416.3, -68.2262], [416.4, -68.1774], [416.5, -68.1283], [416.6, -68.079], [416.7, -68.0295], [416.8, -67.9798], [416.9, -67.9298], [417, -67.8797], [417.1, -67.8293], [417.2, -67.7786], [417.3, -67.7277], [417.4, -67.6766], [417.5, -67.6252], [417.6, -67.5736], [417.7, -67.5217], [417.8, -67.4696], [417.9, -67.4172], [418, -67.3645], [418.1, -67.3116], [418.2, -67.2584], [418.3, -67.2049], [418.4, -67.1511], [418.5, -67.097], [418.6, -67.0426], [418.7, -66.9879], [418.8, -66.9329], [418.9, -66.8776], [419, -66.8219], [419.1, -66.766], [419.2, -66.7096], [419.3, -66.653], [419.4, -66.596], [419.5, -66.5386], [419.6, -66.4809], [419.7, -66.4227], [419.8, -66.3642], [419.9, -66.3054], [420, -66.2461], [420.1, -66.1864], [420.2, -66.1262], [420.3, -66.0657], [420.4, -66.0047], [420.5, -65.9433], [420.6, -65.8813], [420.7, -65.819], [420.8, -65.7561], [420.9, -65.6928], [421, -65.6289], [421.1, -65.5645], [421.2, -65.4996], [421.3, -65.4342], [421.4, -65.3681], [421.5, -65.3015], [421.6, -65.2343], [421.7, -65.1665], [421.8, -65.0981], [421.9, -65.0291], [422, -64.9593], [422.1, -64.8889], [422.2, -64.8178], [422.3, -64.746], [422.4, -64.6734], [422.5, -64.6001], [422.6, -64.526], [422.7, -64.4511], [422.8, -64.3754], [422.9, -64.2988], [423, -64.2213], [423.1, -64.1429], [423.2, -64.0635], [423.3, -63.9832], [423.4, -63.9019], [423.5, -63.8195], [423.6, -63.7361], [423.7, -63.6515], [423.8, -63.5658], [423.9, -63.4789], [424, -63.3908], [424.1, -63.3014], [424.2, -63.2106], [424.3, -63.1185], [424.4, -63.0249], [424.5, -62.9299], [424.6, -62.8333], [424.7, -62.7351], [424.8, -62.6352], [424.9, -62.5336], [425, -62.4301], [425.1, -62.3248], [425.2, -62.2174], [425.3, -62.1081], [425.4, -61.9965], [425.5, -61.8827], [425.6, -61.7665], [425.7, -61.6478], [425.8, -61.5266], [425.9, -61.4026], [426, -61.2757], [426.1, -61.1458], [426.2, -61.0128], [426.3, -60.8764], [426.4, -60.7365], [426.5, -60.5929], [426.6, -60.4453], [426.7, -60.2936], [426.8, -60.1374], [426.9, -59.9766], [427, -59.8108], [427.1, -59.6398], [427.2, -59.463], [427.3, -59.2803], [427.4, -59.0912], [427.5, -58.8952], [427.6, -58.6918], [427.7, -58.4805], [427.8, -58.2607], [427.9, -58.0317], [428, -57.7928], [428.1, -57.5431], [428.2, -57.2818], [428.3, -57.0078], [428.4, -56.7199], [428.5, -56.4169], [428.6, -56.0972], [428.7, -55.7593], [428.8, -55.4011], [428.9, -55.0206], [429, -54.6151], [429.1, -54.1819], [429.2, -53.7174], [429.3, -53.2177], [429.4, -52.6782], [429.5, -52.0932], [429.6, -51.4562], [429.7, -50.7591], [429.8, -49.9922], [429.9, -49.1434], [430, -48.1979], [430.1, -47.1369], [430.2, -45.9362], [430.3, -44.5648], [430.4, -42.9815], [430.5, -41.1306], [430.6, -38.9354], [430.7, -36.2863], [430.8, -33.0227], [430.9, -28.8977], [431, -23.5138], [431.1, -16.1869], [431.2, -5.63825], [431.3, 10.814], [431.4, 30], [431.5, -65.3817], [431.6, -65.7517], [431.7, -66.1092], [431.8, -66.4537], [431.9, -66.7844], [432, -67.101], [432.1, -67.4033], [432.2, -67.6909], [432.3, -67.9639], [432.4, -68.2222], [432.5, -68.466], [432.6, -68.6955], [432.7, -68.9109], [432.8, -69.1126], [432.9, -69.3009], [433, -69.4763], [433.1, -69.6392], [433.2, -69.79], [433.3, -69.9294], [433.4, -70.0578], [433.5, -70.1757], [433.6, -70.2836], [433.7, -70.382], [433.8, -70.4715], [433.9, -70.5525], [434, -70.6255], [434.1, -70.6909], [434.2, -70.7493], [434.3, -70.801], [434.4, -70.8465], [434.5, -70.8861], [434.6, -70.9202], [434.7, -70.9492], [434.8, -70.9734], [434.9, -70.9931], [435, -71.0086], [435.1, -71.0202], [435.2, -71.0281], [435.3, -71.0327], [435.4, -71.034], [435.5, -71.0324], [435.6, -71.028], [435.7, -71.0211], [435.8, -71.0117], [435.9, -71.0002], [436, -70.9865], [436.1, -70.9709], [436.2, -70.9535], [436.3, -70.9344], [436.4, -70.9137], [436.5, -70.8916], [436.6, -70.8681], [436.7, -70.8433], [436.8, -70.8173], [436.9, -70.7903], [437, -70.7621], [437.1, -70.733], [437.2, -70.703], [437.3, -70.6721], [437.4, -70.6404], [437.5, -70.608], [437.6, -70.5748], [437.7, -70.541], [437.8, -70.5066], [437.9, -70.4715], [438, -70.436], [438.1, -70.3999], [438.2, -70.3633], [438.3, -70.3262], [438.4, -70.2887], [438.5, -70.2508], [438.6, -70.2124], [438.7, -70.1737], [438.8, -70.1347], [438.9, -70.0952], [439, -70.0555], [439.1, -70.0154], [439.2, -69.975], [439.3, -69.9344], [439.4, -69.8934], [439.5, -69.8522], [439.6, -69.8108], [439.7, -69.769], [439.8, -69.727], [439.9, -69.6848], [440, -69.6424], [440.1, -69.5997], [440.2, -69.5568], [440.3, -69.5137], [440.4, -69.4704], [440.5, -69.4268], [440.6, -69.3831], [440.7, -69.3392], [440.8, -69.295], [440.9, -69.2507], [441, -69.2062], [441.1, -69.1614], [441.2, -69.1165], [441.3, -69.0714], [441.4, -69.0261], [441.5, -68.9806], [441.6, -68.9349], [441.7, -68.889], [441.8, -68.843], [441.9, -68.7967], [442, -68.7502], [442.1, -68.7036], [442.2, -68.6568], [442.3, -68.6097], [442.4, -68.5625], [442.5, -68.5151], [442.6, -68.4675], [442.7, -68.4197], [442.8, -68.3716], [442.9, -68.3234], [443, -68.275], [443.1, -68.2263], [443.2, -68.1775], [443.3, -68.1284], [443.4, -68.0791], [443.5, -68.0296], [443.6, -67.9799], [443.7, -67.93], [443.8, -67.8798], [443.9, -67.8294], [444, -67.7787], [444.1, -67.7279], [444.2, -67.6767], [444.3, -67.6254], [444.4, -67.5738], [444.5, -67.5219], [444.6, -67.4697], [444.7, -67.4173], [444.8, -67.3647], [444.9, -67.3117], [445, -67.2585], [445.1, -67.205], [445.2, -67.1512], [445.3, -67.0971], [445.4, -67.0427], [445.5, -66.9881], [445.6, -66.933], [445.7, -66.8777], [445.8, -66.8221], [445.9, -66.7661], [446, -66.7098], [446.1, -66.6531], [446.2, -66.5961], [446.3, -66.5387], [446.4, -66.481], [446.5, -66.4229], [446.6, -66.3644], [446.7, -66.3055], [446.8, -66.2462], [446.9, -66.1865], [447, -66.1264], [447.1, -66.0658], [447.2, -66.0048], [447.3, -65.9434], [447.4, -65.8815], [447.5, -65.8191], [447.6, -65.7563], [447.7, -65.6929], [447.8, -65.6291], [447.9, -65.5647], [448, -65.4998], [448.1, -65.4343], [448.2, -65.3683], [448.3, -65.3017], [448.4, -65.2345], [448.5, -65.1667], [448.6, -65.0983], [448.7, -65.0292], [448.8, -64.9595], [448.9, -64.8891], [449, -64.818], [449.1, -64.7462], [449.2, -64.6736], [449.3, -64.6003], [449.4, -64.5262], [449.5, -64.4513], [449.6, -64.3756], [449.7, -64.299], [449.8, -64.2215], [449.9, -64.1431], [450, -64.0637], [450.1, -63.9834], [450.2, -63.9021], [450.3, -63.8197], [450.4, -63.7363], [450.5, -63.6518], [450.6, -63.566], [450.7, -63.4792], [450.8, -63.391], [450.9, -63.3016], [451, -63.2109], [451.1, -63.1187], [451.2, -63.0252], [451.3, -62.9301], [451.4, -62.8335], [451.5, -62.7353], [451.6, -62.6354], [451.7, -62.5338], [451.8, -62.4304], [451.9, -62.325], [452, -62.2177], [452.1, -62.1083], [452.2, -61.9968], [452.3, -61.883], [452.4, -61.7668], [452.5, -61.6481], [452.6, -61.5269], [452.7, -61.4029], [452.8, -61.276], [452.9, -61.1462], [453, -61.0131], [453.1, -60.8768], [453.2, -60.7369], [453.3, -60.5932], [453.4, -60.4457], [453.5, -60.294], [453.6, -60.1378], [453.7, -59.977], [453.8, -59.8113], [453.9, -59.6402], [454, -59.4635], [454.1, -59.2808], [454.2, -59.0917], [454.3, -58.8957], [454.4, -58.6923], [454.5, -58.481], [454.6, -58.2613], [454.7, -58.0323], [454.8, -57.7934], [454.9, -57.5438], [455, -57.2825], [455.1, -57.0085], [455.2, -56.7206], [455.3, -56.4176], [455.4, -56.098], [455.5, -55.7601], [455.6, -55.402], [455.7, -55.0216], [455.8, -54.6162], [455.9, -54.183], [456, -53.7186], [456.1, -53.219], [456.2, -52.6796], [456.3, -52.0947], [456.4, -51.4579], [456.5, -50.7609], [456.6, -49.9942], [456.7, -49.1457], [456.8, -48.2004], [456.9, -47.1397], [457, -45.9394], [457.1, -44.5685], [457.2, -42.9857], [457.3, -41.1356], [457.4, -38.9413], [457.5, -36.2936], [457.6, -33.0317], [457.7, -28.9093], [457.8, -23.5292], [457.9, -16.2084], [458, -5.67024], [458.1, 10.7617], [458.2, 30], [458.3, -65.3816], [458.4, -65.7517], [458.5, -66.1092], [458.6, -66.4536], [458.7, -66.7844], [458.8, -67.101], [458.9, -67.4032], [459, -67.6909], [459.1, -67.9638], [459.2, -68.2222], [459.3, -68.466], [459.4, -68.6954], [459.5, -68.9109], [459.6, -69.1125], [459.7, -69.3008], [459.8, -69.4762], [459.9, -69.6391], [460, -69.79], [460.1, -69.9293], [460.2, -70.0577], [460.3, -70.1756], [460.4, -70.2835], [460.5, -70.3819], [460.6, -70.4714], [460.7, -70.5524], [460.8, -70.6254], [460.9, -70.6909], [461, -70.7492], [461.1, -70.801], [461.2, -70.8464], [461.3, -70.886], [461.4, -70.9202], [461.5, -70.9491], [461.6, -70.9733], [461.7, -70.993], [461.8, -71.0085], [461.9, -71.0201], [462, -71.028], [462.1, -71.0326], [462.2, -71.0339], [462.3, -71.0323], [462.4, -71.0279], [462.5, -71.021], [462.6, -71.0117], [462.7, -71.0001], [462.8, -70.9864], [462.9, -70.9708], [463, -70.9534], [463.1, -70.9343], [463.2, -70.9137], [463.3, -70.8915], [463.4, -70.868], [463.5, -70.8433], [463.6, -70.8173], [463.7, -70.7902], [463.8, -70.762], [463.9, -70.7329], [464, -70.7029], [464.1, -70.672], [464.2, -70.6403], [464.3, -70.6079], [464.4, -70.5747], [464.5, -70.5409], [464.6, -70.5065], [464.7, -70.4715], [464.8, -70.4359], [464.9, -70.3998], [465, -70.3632], [465.1, -70.3261], [465.2, -70.2886], [465.3, -70.2507], [465.4, -70.2124], [465.5, -70.1736], [465.6, -70.1346], [465.7, -70.0952], [465.8, -70.0554], [465.9, -70.0153], [466, -69.975], [466.1, -69.9343], [466.2, -69.8934], [466.3, -69.8522], [466.4, -69.8107], [466.5, -69.7689], [466.6, -69.727], [466.7, -69.6848], [466.8, -69.6423], [466.9, -69.5996], [467, -69.5567], [467.1, -69.5136], [467.2, -69.4703], [467.3, -69.4268], [467.4, -69.383], [467.5, -69.3391], [467.6, -69.2949], [467.7, -69.2506], [467.8, -69.2061], [467.9, -69.1613], [468, -69.1164], [468.1, -69.0713], [468.2, -69.026], [468.3, -68.9805], [468.4, -68.9348], [468.5, -68.8889], [468.6, -68.8429], [468.7, -68.7966], [468.8, -68.7502], [468.9, -68.7035], [469, -68.6567], [469.1, -68.6097], [469.2, -68.5624], [469.3, -68.515], [469.4, -68.4674], [469.5, -68.4196], [469.6, -68.3715], [469.7, -68.3233], [469.8, -68.2749], [469.9, -68.2263], [470, -68.1774], [470.1, -68.1283], [470.2, -68.0791], [470.3, -68.0296], [470.4, -67.9798], [470.5, -67.9299], [470.6, -67.8797], [470.7, -67.8293], [470.8, -67.7787], [470.9, -67.7278], [471, -67.6767], [471.1, -67.6253], [471.2, -67.5737], [471.3, -67.5218], [471.4, -67.4696], [471.5, -67.4172], [471.6, -67.3646], [471.7, -67.3116], [471.8, -67.2584], [471.9, -67.2049], [472, -67.1511], [472.1, -67.097], [472.2, -67.0426], [472.3, -66.988], [472.4, -66.933], [472.5, -66.8776], [472.6, -66.822], [472.7, -66.766], [472.8, -66.7097], [472.9, -66.653], [473, -66.596], [473.1, -66.5386], [473.2, -66.4809], [473.3, -66.4228], [473.4, -66.3643], [473.5, -66.3054], [473.6, -66.2461], [473.7, -66.1864], [473.8, -66.1263], [473.9, -66.0657], [474, -66.0047], [474.1, -65.9433], [474.2, -65.8814], [474.3, -65.819], [474.4, -65.7562], [474.5, -65.6928], [474.6, -65.629], [474.7, -65.5646], [474.8, -65.4997], [474.9, -65.4342], [475, -65.3682], [475.1, -65.3016], [475.2, -65.2344], [475.3, -65.1666], [475.4, -65.0982], [475.5, -65.0291], [475.6, -64.9594], [475.7, -64.889], [475.8, -64.8179], [475.9, -64.7461], [476, -64.6735], [476.1, -64.6002], [476.2, -64.5261], [476.3, -64.4512], [476.4, -64.3754], [476.5, -64.2988], [476.6, -64.2213], [476.7, -64.1429], [476.8, -64.0636], [476.9, -63.9833], [477, -63.902], [477.1, -63.8196], [477.2, -63.7362], [477.3, -63.6516], [477.4, -63.5659], [477.5, -63.479], [477.6, -63.3909], [477.7, -63.3014], [477.8, -63.2107], [477.9, -63.1186], [478, -63.025], [478.1, -62.93], [478.2, -62.8334], [478.3, -62.7352], [478.4, -62.6353], [478.5, -62.5336], [478.6, -62.4302], [478.7, -62.3249], [478.8, -62.2175], [478.9, -62.1081], [479, -61.9966], [479.1, -61.8828], [479.2, -61.7666], [479.3, -61.6479], [479.4, -61.5267], [479.5, -61.4027], [479.6, -61.2758], [479.7, -61.1459], [479.8, -61.0129], [479.9, -60.8765], [480, -60.7366], [480.1, -60.593], [480.2, -60.4454], [480.3, -60.2937], [480.4, -60.1376], [480.5, -59.9767], [480.6, -59.811], [480.7, -59.6399], [480.8, -59.4632], [480.9, -59.2805], [481, -59.0913], [481.1, -58.8953], [481.2, -58.692], [481.3, -58.4807], [481.4, -58.2609], [481.5, -58.0319], [481.6, -57.793], [481.7, -57.5433], [481.8, -57.282], [481.9, -57.008], [482, -56.7201], [482.1, -56.4171], [482.2, -56.0975], [482.3, -55.7595], [482.4, -55.4014], [482.5, -55.0209], [482.6, -54.6154], [482.7, -54.1822], [482.8, -53.7177], [482.9, -53.2181], [483, -52.6786], [483.1, -52.0937], [483.2, -51.4567], [483.3, -50.7597], [483.4, -49.9928], [483.5, -49.1441], [483.6, -48.1987], [483.7, -47.1377], [483.8, -45.9372], [483.9, -44.566], [484, -42.9828], [484.1, -41.1322], [484.2, -38.9372], [484.3, -36.2886], [484.4, -33.0255], [484.5, -28.9013], [484.6, -23.5185], [484.7, -16.1935], [484.8, -5.6481], [484.9, 10.7979], [485, 30], [485.1, -65.3817], [485.2, -65.7517], [485.3, -66.1092], [485.4, -66.4536], [485.5, -66.7844], [485.6, -67.101], [485.7, -67.4033], [485.8, -67.6909], [485.9, -67.9639], [486, -68.2222], [486.1, -68.466], [486.2, -68.6955], [486.3, -68.9109], [486.4, -69.1126], [486.5, -69.3009], [486.6, -69.4762], [486.7, -69.6391], [486.8, -69.79], [486.9, -69.9294], [487, -70.0578], [487.1, -70.1756], [487.2, -70.2835], [487.3, -70.382], [487.4, -70.4714], [487.5, -70.5524], [487.6, -70.6254], [487.7, -70.6909], [487.8, -70.7493], [487.9, -70.801], [488, -70.8465], [488.1, -70.8861], [488.2, -70.9202], [488.3, -70.9492], [488.4, -70.9734], [488.5, -70.9931], [488.6, -71.0086], [488.7, -71.0202], [488.8, -71.0281], [488.9, -71.0326], [489, -71.034], [489.1, -71.0324], [489.2, -71.028], [489.3, -71.0211], [489.4, -71.0117], [489.5, -71.0001], [489.6, -70.9865], [489.7, -70.9709], [489.8, -70.9535], [489.9, -70.9344], [490, -70.9137], [490.1, -70.8916], [490.2, -70.8681], [490.3, -70.8433], [490.4, -70.8173], [490.5, -70.7902], [490.6, -70.7621], [490.7, -70.733], [490.8, -70.703], [490.9, -70.6721], [491, -70.6404], [491.1, -70.6079], [491.2, -70.5748], [491.3, -70.541], [491.4, -70.5065], [491.5, -70.4715], [491.6, -70.4359], [491.7, -70.3998], [491.8, -70.3632], [491.9, -70.3262], [492, -70.2887], [492.1, -70.2507], [492.2, -70.2124], [492.3, -70.1737], [492.4, -70.1346], [492.5, -70.0952], [492.6, -70.0555], [492.7, -70.0154], [492.8, -69.975], [492.9, -69.9344], [493, -69.8934], [493.1, -69.8522], [493.2, -69.8107], [493.3, -69.769], [493.4, -69.727], [493.5, -69.6848], [493.6, -69.6424], [493.7, -69.5997], [493.8, -69.5568], [493.9, -69.5137], [494, -69.4704], [494.1, -69.4268], [494.2, -69.3831], [494.3, -69.3391], [494.4, -69.295], [494.5, -69.2507], [494.6, -69.2061], [494.7, -69.1614], [494.8, -69.1165], [494.9, -69.0714], [495, -69.0261], [495.1, -68.9806], [495.2, -68.9349], [495.3, -68.889], [495.4, -68.8429], [495.5, -68.7967], [495.6, -68.7502], [495.7, -68.7036], [495.8, -68.6567], [495.9, -68.6097], [496, -68.5625], [496.1, -68.5151], [496.2, -68.4674], [496.3, -68.4196], [496.4, -68.3716], [496.5, -68.3234], [496.6, -68.275], [496.7, -68.2263], [496.8, -68.1775], [496.9, -68.1284], [497, -68.0791], [497.1, -68.0296], [497.2, -67.9799], [497.3, -67.9299], [497.4, -67.8798], [497.5, -67.8294], [497.6, -67.7787], [497.7, -67.7278], [497.8, -67.6767], [497.9, -67.6253], [498, -67.5737], [498.1, -67.5218], [498.2, -67.4697], [498.3, -67.4173], [498.4, -67.3646], [498.5, -67.3117], [498.6, -67.2585], [498.7, -67.205], [498.8, -67.1512], [498.9, -67.0971], [499, -67.0427], [499.1, -66.988], [499.2, -66.933], [499.3, -66.8777], [499.4, -66.8221], [499.5, -66.7661], [499.6, -66.7098], [499.7, -66.6531], [499.8, -66.5961], [499.9, -66.5387], [500, -66.481]])
+
+plt.figure()
+plt.plot(data.T[0,:], data.T[1,:])
+plt.xlabel('ms')
+plt.ylabel('mV')
+plt.title('Spike train of Izhikevich Neuron type "tonic_spiking"')
+plt.show()
@@ -0,0 +1,13 @@
+#!/usr/bin/env python
+
+import numpy as np
+import matplotlib.pyplot as plt
+
+data = np.array([[0, 0], [0.1, 0], [0.2, 0], [0.3, 0], [0.4, 0], [0.5, 0], [0.6, 0], [0.7, 0], [0.8, 0], [0.9, 0], [1, 0], [1.1, 0], [1.2, 0], [1.3, 0], [1.4, 0], [1.5, 0], [1.6, 0], [1.7, 0], [1.8, 0], [1.9, 0], [2, 0], [2.1, 0], [2.2, 0], [2.3, 0], [2.4, 0], [2.5, 0], [2.6, 0], [2.7, 0], [2.8, 0], [2.9, 0], [3, 0], [3.1, 0], [3.2, 0], [3.3, 0], [3.4, 0], [3.5, 0], [3.6, 0], [3.7, 0], [3.8, 0], [3.9, 0], [4, 0], [4.1, 0], [4.2, 0], [4.3, 0], [4.4, 0], [4.5, 0], [4.6, 0], [4.7, 0], [4.8, 0], [4.9, 0], [5, 0], [5.1, 0], [5.2, 0], [5.3, 0], [5.4, 0], [5.5, 0], [5.6, 0], [5.7, 0], [5.8, 0], [5.9, 0], [6, 0], [6.1, 0], [6.2, 0], [6.3, 0], [6.4, 0], [6.5, 0], [6.6, 0], [6.7, 0], [6.8, 0], [6.9, 0], [7, 0], [7.1, 0], [7.2, 0], [7.3, 0], [7.4, 0], [7.5, 0], [7.6, 0], [7.7, 0], [7.8, 0], [7.9, 0], [8, 0], [8.1, 0], [8.2, 0], [8.3, 0], [8.4, 0], [8.5, 0], [8.6, 0], [8.7, 0], [8.8, 0], [8.9, 0], [9, 0], [9.1, 0], [9.2, 0], [9.3, 0], [9.4, 0], [9.5, 0], [9.6, 0], [9.7, 0], [9.8, 0], [9.9, 0], [10, 0], [10.1, 0.125], [10.2, 0.372506], [10.3, 0.61755], [10.4, 0.860155], [10.5, 1.10035], [10.6, 1.33815], [10.7, 1.57358], [10.8, 1.80668], [10.9, 2.03745], [11, 2.26593], [11.1, 2.49213], [11.2, 2.71608], [11.3, 2.93781], [11.4, 3.15733], [11.5, 3.37466], [11.6, 3.58984], [11.7, 3.80287], [11.8, 4.01378], [11.9, 4.22259], [12, 4.42933], [12.1, 4.634], [12.2, 4.83665], [12.3, 5.03727], [12.4, 5.2359], [12.5, 5.43255], [12.6, 5.62725], [12.7, 5.82001], [12.8, 6.01085], [12.9, 6.19979], [13, 6.38685], [13.1, 6.57205], [13.2, 6.75541], [13.3, 6.93695], [13.4, 7.11667], [13.5, 7.29461], [13.6, 7.47078], [13.7, 7.6452], [13.8, 7.81788], [13.9, 7.98884], [14, 8.1581], [14.1, 8.32568], [14.2, 8.49159], [14.3, 8.65585], [14.4, 8.81847], [14.5, 8.97948], [14.6, 9.13888], [14.7, 9.2967], [14.8, 9.45295], [14.9, 9.60764], [15, 9.76079], [15.1, 9.91242], [15.2, 10.0625], [15.3, 10.2112], [15.4, 10.3583], [15.5, 10.504], [15.6, 10.6482], [15.7, 10.791], [15.8, 10.9324], [15.9, 11.0724], [16, 11.211], [16.1, 11.3482], [16.2, 11.484], [16.3, 11.6185], [16.4, 11.7516], [16.5, 11.8835], [16.6, 12.014], [16.7, 12.1432], [16.8, 12.2711], [16.9, 12.3978], [17, 12.5232], [17.1, 12.6473], [17.2, 12.7702], [17.3, 12.8919], [17.4, 13.0124], [17.5, 13.1316], [17.6, 13.2497], [17.7, 13.3666], [17.8, 13.4824], [17.9, 13.597], [18, 13.7105], [18.1, 13.8228], [18.2, 13.934], [18.3, 14.0441], [18.4, 14.1531], [18.5, 14.261], [18.6, 14.3679], [18.7, 14.4737], [18.8, 14.5784], [18.9, 14.6821], [19, 14.7848], [19.1, 14.8864], [19.2, 14.9871], [19.3, 15.0867], [19.4, 15.1853], [19.5, 15.283], [19.6, 15.3797], [19.7, 15.4754], [19.8, 15.5702], [19.9, 15.664], [20, 15.7569], [20.1, 15.8488], [20.2, 15.9399], [20.3, 16.03], [20.4, 16.1193], [20.5, 16.2077], [20.6, 16.2951], [20.7, 16.3818], [20.8, 16.4675], [20.9, 16.5524], [21, 16.6365], [21.1, 16.7197], [21.2, 16.8021], [21.3, 16.8836], [21.4, 16.9644], [21.5, 17.0443], [21.6, 17.1235], [21.7, 17.2019], [21.8, 17.2795], [21.9, 17.3563], [22, 17.4323], [22.1, 17.5076], [22.2, 17.5822], [22.3, 17.656], [22.4, 17.7291], [22.5, 17.8014], [22.6, 17.873], [22.7, 17.944], [22.8, 18.0142], [22.9, 18.0837], [23, 18.1525], [23.1, 18.2206], [23.2, 18.2881], [23.3, 18.3549], [23.4, 18.421], [23.5, 18.4864], [23.6, 18.5513], [23.7, 18.6154], [23.8, 18.6789], [23.9, 18.7418], [24, 18.8041], [24.1, 18.8658], [24.2, 18.9268], [24.3, 18.9872], [24.4, 19.047], [24.5, 19.1063], [24.6, 19.1649], [24.7, 19.223], [24.8, 19.2805], [24.9, 19.3374], [25, 19.3937], [25.1, 19.4495], [25.2, 19.5047], [25.3, 19.5594], [25.4, 19.6135], [25.5, 19.6671], [25.6, 19.7202], [25.7, 19.7727], [25.8, 19.8247], [25.9, 19.8762], [26, 19.9272], [26.1, 19.9777], [26.2, -5], [26.2, -5], [26.2, -5], [26.2, -5], [26.2, -5], [26.2, -5], [26.2, -5], [26.2, -5], [26.2, -5], [26.2, -5], [26.2, -5], [26.2, -5], [26.2, -5], [26.2, -5], [26.2, -5], [26.2, -5], [26.2, -5], [26.2, -5], [26.2, -5], [26.2, -5], [26.2, -5], [26.2, -5], [26.2, -5], [26.2, -5], [26.2, -5], [26.2, -5], [26.2, -5], [26.2, -5], [26.2, -5], [26.2, -5], [26.2, -5], [26.2, -5], [26.2, -5], [26.2, -5], [26.2, -5], [26.2, -5], [26.2, -5], [26.2, -5], [26.2, -5], [26.2, -5], [26.2, -5], [26.2, -5], [26.2, -5], [26.2, -5], [26.2, -5], [26.2, -5], [26.2, -5], [26.2, -5], [26.2, -5], [26.2, -5], [26.2, -5], [26.2, -5], [26.3, -4.7015], [26.4, -4.40597], [26.5, -4.11338], [26.6, -3.8237], [26.7, -3.53691], [26.8, -3.25296], [26.9, -2.97185], [27, -2.69353], [27.1, -2.41798], [27.2, -2.14517], [27.3, -1.87507], [27.4, -1.60767], [27.5, -1.34292], [27.6, -1.08081], [27.7, -0.821304], [27.8, -0.564382], [27.9, -0.310017], [28, -0.0581821], [28.1, 0.191147], [28.2, 0.437995], [28.3, 0.682387], [28.4, 0.924347], [28.5, 1.1639], [28.6, 1.40107], [28.7, 1.63588], [28.8, 1.86835], [28.9, 2.09851], [29, 2.32638], [29.1, 2.55198], [29.2, 2.77534], [29.3, 2.99648], [29.4, 3.21541], [29.5, 3.43217], [29.6, 3.64677], [29.7, 3.85923], [29.8, 4.06958], [29.9, 4.27784], [30, 4.48403], [30.1, 4.68816], [30.2, 4.89026], [30.3, 5.09036], [30.4, 5.28846], [30.5, 5.48459], [30.6, 5.67876], [30.7, 5.87101], [30.8, 6.06134], [30.9, 6.24978], [31, 6.43635], [31.1, 6.62106], [31.2, 6.80393], [31.3, 6.98498], [31.4, 7.16423], [31.5, 7.34169], [31.6, 7.51739], [31.7, 7.69135], [31.8, 7.86357], [31.9, 8.03407], [32, 8.20289], [32.1, 8.37002], [32.2, 8.53549], [32.3, 8.69931], [32.4, 8.8615], [32.5, 9.02208], [32.6, 9.18106], [32.7, 9.33846], [32.8, 9.49429], [32.9, 9.64857], [33, 9.80132], [33.1, 9.95254], [33.2, 10.1023], [33.3, 10.2505], [33.4, 10.3973], [33.5, 10.5426], [33.6, 10.6864], [33.7, 10.8288], [33.8, 10.9698], [33.9, 11.1094], [34, 11.2476], [34.1, 11.3845], [34.2, 11.5199], [34.3, 11.6541], [34.4, 11.7869], [34.5, 11.9183], [34.6, 12.0485], [34.7, 12.1774], [34.8, 12.305], [34.9, 12.4313], [35, 12.5563], [35.1, 12.6801], [35.2, 12.8027], [35.3, 12.9241], [35.4, 13.0442], [35.5, 13.1632], [35.6, 13.281], [35.7, 13.3976], [35.8, 13.513], [35.9, 13.6273], [36, 13.7405], [36.1, 13.8525], [36.2, 13.9634], [36.3, 14.0732], [36.4, 14.182], [36.5, 14.2896], [36.6, 14.3962], [36.7, 14.5017], [36.8, 14.6061], [36.9, 14.7096], [37, 14.8119], [37.1, 14.9133], [37.2, 15.0137], [37.3, 15.113], [37.4, 15.2114], [37.5, 15.3088], [37.6, 15.4052], [37.7, 15.5007], [37.8, 15.5952], [37.9, 15.6888], [38, 15.7815], [38.1, 15.8732], [38.2, 15.964], [38.3, 16.0539], [38.4, 16.1429], [38.5, 16.231], [38.6, 16.3183], [38.7, 16.4047], [38.8, 16.4902], [38.9, 16.5749], [39, 16.6587], [39.1, 16.7417], [39.2, 16.8239], [39.3, 16.9052], [39.4, 16.9858], [39.5, 17.0655], [39.6, 17.1445], [39.7, 17.2226], [39.8, 17.3], [39.9, 17.3766], [40, 17.4525], [40.1, 17.5276], [40.2, 17.6019], [40.3, 17.6755], [40.4, 17.7484], [40.5, 17.8206], [40.6, 17.892], [40.7, 17.9627], [40.8, 18.0327], [40.9, 18.1021], [41, 18.1707], [41.1, 18.2387], [41.2, 18.3059], [41.3, 18.3725], [41.4, 18.4385], [41.5, 18.5038], [41.6, 18.5684], [41.7, 18.6324], [41.8, 18.6958], [41.9, 18.7585], [42, 18.8206], [42.1, 18.8821], [42.2, 18.9429], [42.3, 19.0032], [42.4, 19.0629], [42.5, 19.122], [42.6, 19.1804], [42.7, 19.2383], [42.8, 19.2957], [42.9, 19.3524], [43, 19.4086], [43.1, 19.4643], [43.2, 19.5193], [43.3, 19.5739], [43.4, 19.6279], [43.5, 19.6813], [43.6, 19.7342], [43.7, 19.7866], [43.8, 19.8385], [43.9, 19.8899], [44, 19.9407], [44.1, 19.991], [44.2, -5], [44.2, -5], [44.2, -5], [44.2, -5], [44.2, -5], [44.2, -5], [44.2, -5], [44.2, -5], [44.2, -5], [44.2, -5], [44.2, -5], [44.2, -5], [44.2, -5], [44.2, -5], [44.2, -5], [44.2, -5], [44.2, -5], [44.2, -5], [44.2, -5], [44.2, -5], [44.2, -5], [44.2, -5], [44.2, -5], [44.2, -5], [44.2, -5], [44.2, -5], [44.2, -5], [44.2, -5], [44.2, -5], [44.2, -5], [44.2, -5], [44.2, -5], [44.2, -5], [44.2, -5], [44.2, -5], [44.2, -5], [44.2, -5], [44.2, -5], [44.2, -5], [44.2, -5], [44.2, -5], [44.2, -5], [44.2, -5], [44.2, -5], [44.2, -5], [44.2, -5], [44.2, -5], [44.2, -5], [44.2, -5], [44.2, -5], [44.2, -5], [44.2, -5], [44.3, -4.7015], [44.4, -4.40597], [44.5, -4.11338], [44.6, -3.8237], [44.7, -3.53691], [44.8, -3.25296], [44.9, -2.97185], [45, -2.69353], [45.1, -2.41798], [45.2, -2.14517], [45.3, -1.87507], [45.4, -1.60767], [45.5, -1.34292], [45.6, -1.08081], [45.7, -0.821304], [45.8, -0.564382], [45.9, -0.310017], [46, -0.0581821], [46.1, 0.191147], [46.2, 0.437995], [46.3, 0.682387], [46.4, 0.924347], [46.5, 1.1639], [46.6, 1.40107], [46.7, 1.63588], [46.8, 1.86835], [46.9, 2.09851], [47, 2.32638], [47.1, 2.55198], [47.2, 2.77534], [47.3, 2.99648], [47.4, 3.21541], [47.5, 3.43217], [47.6, 3.64677], [47.7, 3.85923], [47.8, 4.06958], [47.9, 4.27784], [48, 4.48403], [48.1, 4.68816], [48.2, 4.89026], [48.3, 5.09036], [48.4, 5.28846], [48.5, 5.48459], [48.6, 5.67876], [48.7, 5.87101], [48.8, 6.06134], [48.9, 6.24978], [49, 6.43635], [49.1, 6.62106], [49.2, 6.80393], [49.3, 6.98498], [49.4, 7.16423], [49.5, 7.34169], [49.6, 7.51739], [49.7, 7.69135], [49.8, 7.86357], [49.9, 8.03407], [50, 8.20289], [50.1, 8.37002], [50.2, 8.53549], [50.3, 8.69931], [50.4, 8.8615], [50.5, 9.02208], [50.6, 9.18106], [50.7, 9.33846], [50.8, 9.49429], [50.9, 9.64857], [51, 9.80132], [51.1, 9.95254], [51.2, 10.1023], [51.3, 10.2505], [51.4, 10.3973], [51.5, 10.5426], [51.6, 10.6864], [51.7, 10.8288], [51.8, 10.9698], [51.9, 11.1094], [52, 11.2476], [52.1, 11.3845], [52.2, 11.5199], [52.3, 11.6541], [52.4, 11.7869], [52.5, 11.9183], [52.6, 12.0485], [52.7, 12.1774], [52.8, 12.305], [52.9, 12.4313], [53, 12.5563], [53.1, 12.6801], [53.2, 12.8027], [53.3, 12.9241], [53.4, 13.0442], [53.5, 13.1632], [53.6, 13.281], [53.7, 13.3976], [53.8, 13.513], [53.9, 13.6273], [54, 13.7405], [54.1, 13.8525], [54.2, 13.9634], [54.3, 14.0732], [54.4, 14.182], [54.5, 14.2896], [54.6, 14.3962], [54.7, 14.5017], [54.8, 14.6061], [54.9, 14.7096], [55, 14.8119], [55.1, 14.9133], [55.2, 15.0137], [55.3, 15.113], [55.4, 15.2114], [55.5, 15.3088], [55.6, 15.4052], [55.7, 15.5007], [55.8, 15.5952], [55.9, 15.6888], [56, 15.7815], [56.1, 15.8732], [56.2, 15.964], [56.3, 16.0539], [56.4, 16.1429], [56.5, 16.231], [56.6, 16.3183], [56.7, 16.4047], [56.8, 16.4902], [56.9, 16.5749], [57, 16.6587], [57.1, 16.7417], [57.2, 16.8239], [57.3, 16.9052], [57.4, 16.9858], [57.5, 17.0655], [57.6, 17.1445], [57.7, 17.2226], [57.8, 17.3], [57.9, 17.3766], [58, 17.4525], [58.1, 17.5276], [58.2, 17.6019], [58.3, 17.6755], [58.4, 17.7484], [58.5, 17.8206], [58.6, 17.892], [58.7, 17.9627], [58.8, 18.0327], [58.9, 18.1021], [59, 18.1707], [59.1, 18.2387], [59.2, 18.3059], [59.3, 18.3725], [59.4, 18.4385], [59.5, 18.5038], [59.6, 18.5684], [59.7, 18.6324], [59.8, 18.6958], [59.9, 18.7585], [60, 18.8206], [60.1, 18.8821], [60.2, 18.9429], [60.3, 19.0032], [60.4, 19.0629], [60.5, 19.122], [60.6, 19.1804], [60.7, 19.2383], [60.8, 19.2957], [60.9, 19.3524], [61, 19.4086], [61.1, 19.4643], [61.2, 19.5193], [61.3, 19.5739], [61.4, 19.6279], [61.5, 19.6813], [61.6, 19.7342], [61.7, 19.7866], [61.8, 19.8385], [61.9, 19.8899], [62, 19.9407], [62.1, 19.991], [62.2, -5], [62.2, -5], [62.2, -5], [62.2, -5], [62.2, -5], [62.2, -5], [62.2, -5], [62.2, -5], [62.2, -5], [62.2, -5], [62.2, -5], [62.2, -5], [62.2, -5], [62.2, -5], [62.2, -5], [62.2, -5], [62.2, -5], [62.2, -5], [62.2, -5], [62.2, -5], [62.2, -5], [62.2, -5], [62.2, -5], [62.2, -5], [62.2, -5], [62.2, -5], [62.2, -5], [62.2, -5], [62.2, -5], [62.2, -5], [62.2, -5], [62.2, -5], [62.2, -5], [62.2, -5], [62.2, -5], [62.2, -5], [62.2, -5], [62.2, -5], [62.2, -5], [62.2, -5], [62.2, -5], [62.2, -5], [62.2, -5], [62.2, -5], [62.2, -5], [62.2, -5], [62.2, -5], [62.2, -5], [62.2, -5], [62.2, -5], [62.2, -5], [62.2, -5], [62.3, -4.7015], [62.4, -4.40597], [62.5, -4.11338], [62.6, -3.8237], [62.7, -3.53691], [62.8, -3.25296], [62.9, -2.97185], [63, -2.69353], [63.1, -2.41798], [63.2, -2.14517], [63.3, -1.87507], [63.4, -1.60767], [63.5, -1.34292], [63.6, -1.08081], [63.7, -0.821304], [63.8, -0.564382], [63.9, -0.310017], [64, -0.0581821], [64.1, 0.191147], [64.2, 0.437995], [64.3, 0.682387], [64.4, 0.924347], [64.5, 1.1639], [64.6, 1.40107], [64.7, 1.63588], [64.8, 1.86835], [64.9, 2.09851], [65, 2.32638], [65.1, 2.55198], [65.2, 2.77534], [65.3, 2.99648], [65.4, 3.21541], [65.5, 3.43217], [65.6, 3.64677], [65.7, 3.85923], [65.8, 4.06958], [65.9, 4.27784], [66, 4.48403], [66.1, 4.68816], [66.2, 4.89026], [66.3, 5.09036], [66.4, 5.28846], [66.5, 5.48459], [66.6, 5.67876], [66.7, 5.87101], [66.8, 6.06134], [66.9, 6.24978], [67, 6.43635], [67.1, 6.62106], [67.2, 6.80393], [67.3, 6.98498], [67.4, 7.16423], [67.5, 7.34169], [67.6, 7.51739], [67.7, 7.69135], [67.8, 7.86357], [67.9, 8.03407], [68, 8.20289], [68.1, 8.37002], [68.2, 8.53549], [68.3, 8.69931], [68.4, 8.8615], [68.5, 9.02208], [68.6, 9.18106], [68.7, 9.33846], [68.8, 9.49429], [68.9, 9.64857], [69, 9.80132], [69.1, 9.95254], [69.2, 10.1023], [69.3, 10.2505], [69.4, 10.3973], [69.5, 10.5426], [69.6, 10.6864], [69.7, 10.8288], [69.8, 10.9698], [69.9, 11.1094], [70, 11.2476], [70.1, 11.3845], [70.2, 11.5199], [70.3, 11.6541], [70.4, 11.7869], [70.5, 11.9183], [70.6, 12.0485], [70.7, 12.1774], [70.8, 12.305], [70.9, 12.4313], [71, 12.5563], [71.1, 12.6801], [71.2, 12.8027], [71.3, 12.9241], [71.4, 13.0442], [71.5, 13.1632], [71.6, 13.281], [71.7, 13.3976], [71.8, 13.513], [71.9, 13.6273], [72, 13.7405], [72.1, 13.8525], [72.2, 13.9634], [72.3, 14.0732], [72.4, 14.182], [72.5, 14.2896], [72.6, 14.3962], [72.7, 14.5017], [72.8, 14.6061], [72.9, 14.7096], [73, 14.8119], [73.1, 14.9133], [73.2, 15.0137], [73.3, 15.113], [73.4, 15.2114], [73.5, 15.3088], [73.6, 15.4052], [73.7, 15.5007], [73.8, 15.5952], [73.9, 15.6888], [74, 15.7815], [74.1, 15.8732], [74.2, 15.964], [74.3, 16.0539], [74.4, 16.1429], [74.5, 16.231], [74.6, 16.3183], [74.7, 16.4047], [74.8, 16.4902], [74.9, 16.5749], [75, 16.6587], [75.1, 16.7417], [75.2, 16.8239], [75.3, 16.9052], [75.4, 16.9858], [75.5, 17.0655], [75.6, 17.1445], [75.7, 17.2226], [75.8, 17.3], [75.9, 17.3766], [76, 17.4525], [76.1, 17.5276], [76.2, 17.6019], [76.3, 17.6755], [76.4, 17.7484], [76.5, 17.8206], [76.6, 17.892], [76.7, 17.9627], [76.8, 18.0327], [76.9, 18.1021], [77, 18.1707], [77.1, 18.2387], [77.2, 18.3059], [77.3, 18.3725], [77.4, 18.4385], [77.5, 18.5038], [77.6, 18.5684], [77.7, 18.6324], [77.8, 18.6958], [77.9, 18.7585], [78, 18.8206], [78.1, 18.8821], [78.2, 18.9429], [78.3, 19.0032], [78.4, 19.0629], [78.5, 19.122], [78.6, 19.1804], [78.7, 19.2383], [78.8, 19.2957], [78.9, 19.3524], [79, 19.4086], [79.1, 19.4643], [79.2, 19.5193], [79.3, 19.5739], [79.4, 19.6279], [79.5, 19.6813], [79.6, 19.7342], [79.7, 19.7866], [79.8, 19.8385], [79.9, 19.8899], [80, 19.9407], [80.1, 19.991], [80.2, -5], [80.2, -5], [80.2, -5], [80.2, -5], [80.2, -5], [80.2, -5], [80.2, -5], [80.2, -5], [80.2, -5], [80.2, -5], [80.2, -5], [80.2, -5], [80.2, -5], [80.2, -5], [80.2, -5], [80.2, -5], [80.2, -5], [80.2, -5], [80.2, -5], [80.2, -5], [80.2, -5], [80.2, -5], [80.2, -5], [80.2, -5], [80.2, -5], [80.2, -5], [80.2, -5], [80.2, -5], [80.2, -5], [80.2, -5], [80.2, -5], [80.2, -5], [80.2, -5], [80.2, -5], [80.2, -5], [80.2, -5], [80.2, -5], [80.2, -5], [80.2, -5], [80.2, -5], [80.2, -5], [80.2, -5], [80.2, -5], [80.2, -5], [80.2, -5], [80.2, -5], [80.2, -5], [80.2, -5], [80.2, -5], [80.2, -5], [80.2, -5], [80.2, -5], [80.3, -4.7015], [80.4, -4.40597], [80.5, -4.11338], [80.6, -3.8237], [80.7, -3.53691], [80.8, -3.25296], [80.9, -2.97185], [81, -2.69353], [81.1, -2.41798], [81.2, -2.14517], [81.3, -1.87507], [81.4, -1.60767], [81.5, -1.34292], [81.6, -1.08081], [81.7, -0.821304], [81.8, -0.564382], [81.9, -0.310017], [82, -0.0581821], [82.1, 0.191147], [82.2, 0.437995], [82.3, 0.682387], [82.4, 0.924347], [82.5, 1.1639], [82.6, 1.40107], [82.7, 1.63588], [82.8, 1.86835], [82.9, 2.09851], [83, 2.32638], [83.1, 2.55198], [83.2, 2.77534], [83.3, 2.99648], [83.4, 3.21541], [83.5, 3.43217], [83.6, 3.64677], [83.7, 3.85923], [83.8, 4.06958], [83.9, 4.27784], [84, 4.48403], [84.1, 4.68816], [84.2, 4.89026], [84.3, 5.09036], [84.4, 5.28846], [84.5, 5.48459], [84.6, 5.67876], [84.7, 5.87101], [84.8, 6.06134], [84.9, 6.24978], [85, 6.43635], [85.1, 6.62106], [85.2, 6.80393], [85.3, 6.98498], [85.4, 7.16423], [85.5, 7.34169], [85.6, 7.51739], [85.7, 7.69135], [85.8, 7.86357], [85.9, 8.03407], [86, 8.20289], [86.1, 8.37002], [86.2, 8.53549], [86.3, 8.69931], [86.4, 8.8615], [86.5, 9.02208], [86.6, 9.18106], [86.7, 9.33846], [86.8, 9.49429], [86.9, 9.64857], [87, 9.80132], [87.1, 9.95254], [87.2, 10.1023], [87.3, 10.2505], [87.4, 10.3973], [87.5, 10.5426], [87.6, 10.6864], [87.7, 10.8288], [87.8, 10.9698], [87.9, 11.1094], [88, 11.2476], [88.1, 11.3845], [88.2, 11.5199], [88.3, 11.6541], [88.4, 11.7869], [88.5, 11.9183], [88.6, 12.0485], [88.7, 12.1774], [88.8, 12.305], [88.9, 12.4313], [89, 12.5563], [89.1, 12.6801], [89.2, 12.8027], [89.3, 12.9241], [89.4, 13.0442], [89.5, 13.1632], [89.6, 13.281], [89.7, 13.3976], [89.8, 13.513], [89.9, 13.6273], [90, 13.7405], [90.1, 13.8525], [90.2, 13.9634], [90.3, 14.0732], [90.4, 14.182], [90.5, 14.2896], [90.6, 14.3962], [90.7, 14.5017], [90.8, 14.6061], [90.9, 14.7096], [91, 14.8119], [91.1, 14.9133], [91.2, 15.0137], [91.3, 15.113], [91.4, 15.2114], [91.5, 15.3088], [91.6, 15.4052], [91.7, 15.5007], [91.8, 15.5952], [91.9, 15.6888], [92, 15.7815], [92.1, 15.8732], [92.2, 15.964], [92.3, 16.0539], [92.4, 16.1429], [92.5, 16.231], [92.6, 16.3183], [92.7, 16.4047], [92.8, 16.4902], [92.9, 16.5749], [93, 16.6587], [93.1, 16.7417], [93.2, 16.8239], [93.3, 16.9052], [93.4, 16.9858], [93.5, 17.0655], [93.6, 17.1445], [93.7, 17.2226], [93.8, 17.3], [93.9, 17.3766], [94, 17.4525], [94.1, 17.5276], [94.2, 17.6019], [94.3, 17.6755], [94.4, 17.7484], [94.5, 17.8206], [94.6, 17.892], [94.7, 17.9627], [94.8, 18.0327], [94.9, 18.1021], [95, 18.1707], [95.1, 18.2387], [95.2, 18.3059], [95.3, 18.3725], [95.4, 18.4385], [95.5, 18.5038], [95.6, 18.5684], [95.7, 18.6324], [95.8, 18.6958], [95.9, 18.7585], [96, 18.8206], [96.1, 18.8821], [96.2, 18.9429], [96.3, 19.0032], [96.4, 19.0629], [96.5, 19.122], [96.6, 19.1804], [96.7, 19.2383], [96.8, 19.2957], [96.9, 19.3524], [97, 19.4086], [97.1, 19.4643], [97.2, 19.5193], [97.3, 19.5739], [97.4, 19.6279], [97.5, 19.6813], [97.6, 19.7342], [97.7, 19.7866], [97.8, 19.8385], [97.9, 19.8899], [98, 19.9407], [98.1, 19.991], [98.2, -5], [98.2, -5], [98.2, -5], [98.2, -5], [98.2, -5], [98.2, -5], [98.2, -5], [98.2, -5], [98.2, -5], [98.2, -5], [98.2, -5], [98.2, -5], [98.2, -5], [98.2, -5], [98.2, -5], [98.2, -5], [98.2, -5], [98.2, -5], [98.2, -5], [98.2, -5], [98.2, -5], [98.2, -5], [98.2, -5], [98.2, -5], [98.2, -5], [98.2, -5], [98.2, -5], [98.2, -5], [98.2, -5], [98.2, -5], [98.2, -5], [98.2, -5], [98.2, -5], [98.2, -5], [98.2, -5], [98.2, -5], [98.2, -5], [98.2, -5], [98.2, -5], [98.2, -5], [98.2, -5], [98.2, -5], [98.2, -5], [98.2, -5], [98.2, -5], [98.2, -5], [98.2, -5], [98.2, -5], [98.2, -5], [98.2, -5], [98.2, -5], [98.2, -5], [98.3, -4.7015], [98.4, -4.40597], [98.5, -4.11338], [98.6, -3.8237], [98.7, -3.53691], [98.8, -3.25296], [98.9, -2.97185], [99, -2.69353], [99.1, -2.41798], [99.2, -2.14517], [99.3, -1.87507], [99.4, -1.60767], [99.5, -1.34292], [99.6, -1.08081], [99.7, -0.821304], [99.8, -0.564382], [99.9, -0.310017], [100, -0.0581821], [100.1, 0.191147], [100.2, 0.437995], [100.3, 0.682387], [100.4, 0.924347], [100.5, 1.1639], [100.6, 1.40107], [100.7, 1.63588], [100.8, 1.86835], [100.9, 2.09851], [101, 2.32638], [101.1, 2.55198], [101.2, 2.77534], [101.3, 2.99648], [101.4, 3.21541], [101.5, 3.43217], [101.6, 3.64677], [101.7, 3.85923], [101.8, 4.06958], [101.9, 4.27784], [102, 4.48403], [102.1, 4.68816], [102.2, 4.89026], [102.3, 5.09036], [102.4, 5.28846], [102.5, 5.48459], [102.6, 5.67876], [102.7, 5.87101], [102.8, 6.06134], [102.9, 6.24978], [103, 6.43635], [103.1, 6.62106], [103.2, 6.80393], [103.3, 6.98498], [103.4, 7.16423], [103.5, 7.34169], [103.6, 7.51739], [103.7, 7.69135], [103.8, 7.86357], [103.9, 8.03407], [104, 8.20289], [104.1, 8.37002], [104.2, 8.53549], [104.3, 8.69931], [104.4, 8.8615], [104.5, 9.02208], [104.6, 9.18106], [104.7, 9.33846], [104.8, 9.49429], [104.9, 9.64857], [105, 9.80132], [105.1, 9.95254], [105.2, 10.1023], [105.3, 10.2505], [105.4, 10.3973], [105.5, 10.5426], [105.6, 10.6864], [105.7, 10.8288], [105.8, 10.9698], [105.9, 11.1094], [106, 11.2476], [106.1, 11.3845], [106.2, 11.5199], [106.3, 11.6541], [106.4, 11.7869], [106.5, 11.9183], [106.6, 12.0485], [106.7, 12.1774], [106.8, 12.305], [106.9, 12.4313], [107, 12.5563], [107.1, 12.6801], [107.2, 12.8027], [107.3, 12.9241], [107.4, 13.0442], [107.5, 13.1632], [107.6, 13.281], [107.7, 13.3976], [107.8, 13.513], [107.9, 13.6273], [108, 13.7405], [108.1, 13.8525], [108.2, 13.9634], [108.3, 14.0732], [108.4, 14.182], [108.5, 14.2896], [108.6, 14.3962], [108.7, 14.5017], [108.8, 14.6061], [108.9, 14.7096], [109, 14.8119], [109.1, 14.9133], [109.2, 15.0137], [109.3, 15.113], [109.4, 15.2114], [109.5, 15.3088], [109.6, 15.4052], [109.7, 15.5007], [109.8, 15.5952], [109.9, 15.6888], [110, 15.7815], [110.1, 15.8732], [110.2, 15.964], [110.3, 16.0539], [110.4, 16.1429], [110.5, 16.231], [110.6, 16.3183], [110.7, 16.4047], [110.8, 16.4902], [110.9, 16.5749], [111, 16.6587], [111.1, 16.7417], [111.2, 16.8239], [111.3, 16.9052], [111.4, 16.9858], [111.5, 17.0655], [111.6, 17.1445], [111.7, 17.2226], [111.8, 17.3], [111.9, 17.3766], [112, 17.4525], [112.1, 17.5276], [112.2, 17.6019], [112.3, 17.6755], [112.4, 17.7484], [112.5, 17.8206], [112.6, 17.892], [112.7, 17.9627], [112.8, 18.0327], [112.9, 18.1021], [113, 18.1707], [113.1, 18.2387], [113.2, 18.3059], [113.3, 18.3725], [113.4, 18.4385], [113.5, 18.5038], [113.6, 18.5684], [113.7, 18.6324], [113.8, 18.6958], [113.9, 18.7585], [114, 18.8206], [114.1, 18.8821], [114.2, 18.9429], [114.3, 19.0032], [114.4, 19.0629], [114.5, 19.122], [114.6, 19.1804], [114.7, 19.2383], [114.8, 19.2957], [114.9, 19.3524], [115, 19.4086], [115.1, 19.4643], [115.2, 19.5193], [115.3, 19.5739], [115.4, 19.6279], [115.5, 19.6813], [115.6, 19.7342], [115.7, 19.7866], [115.8, 19.8385], [115.9, 19.8899], [116, 19.9407], [116.1, 19.991], [116.2, -5], [116.2, -5], [116.2, -5], [116.2, -5], [116.2, -5], [116.2, -5], [116.2, -5], [116.2, -5], [116.2, -5], [116.2, -5], [116.2, -5], [116.2, -5], [116.2, -5], [116.2, -5], [116.2, -5], [116.2, -5], [116.2, -5], [116.2, -5], [116.2, -5], [116.2, -5], [116.2, -5], [116.2, -5], [116.2, -5], [116.2, -5], [116.2, -5], [116.2, -5], [116.2, -5], [116.2, -5], [116.2, -5], [116.2, -5], [116.2, -5], [116.2, -5], [116.2, -5], [116.2, -5], [116.2, -5], [116.2, -5], [116.2, -5], [116.2, -5], [116.2, -5], [116.2, -5], [116.2, -5], [116.2, -5], [116.2, -5], [116.2, -5], [116.2, -5], [116.2, -5], [116.2, -5], [116.2, -5], [116.2, -5], [116.2, -5], [116.2, -5], [116.2, -5], [116.3, -4.7015], [116.4, -4.40597], [116.5, -4.11338], [116.6, -3.8237], [116.7, -3.53691], [116.8, -3.25296], [116.9, -2.97185], [117, -2.69353], [117.1, -2.41798], [117.2, -2.14517], [117.3, -1.87507], [117.4, -1.60767], [117.5, -1.34292], [117.6, -1.08081], [117.7, -0.821304], [117.8, -0.564382], [117.9, -0.310017], [118, -0.0581821], [118.1, 0.191147], [118.2, 0.437995], [118.3, 0.682387], [118.4, 0.924347], [118.5, 1.1639], [118.6, 1.40107], [118.7, 1.63588], [118.8, 1.86835], [118.9, 2.09851], [119, 2.32638], [119.1, 2.55198], [119.2, 2.77534], [119.3, 2.99648], [119.4, 3.21541], [119.5, 3.43217], [119.6, 3.64677], [119.7, 3.85923], [119.8, 4.06958], [119.9, 4.27784], [120, 4.48403], [120.1, 4.68816], [120.2, 4.89026], [120.3, 5.09036], [120.4, 5.28846], [120.5, 5.48459], [120.6, 5.67876], [120.7, 5.87101], [120.8, 6.06134], [120.9, 6.24978], [121, 6.43635], [121.1, 6.62106], [121.2, 6.80393], [121.3, 6.98498], [121.4, 7.16423], [121.5, 7.34169], [121.6, 7.51739], [121.7, 7.69135], [121.8, 7.86357], [121.9, 8.03407], [122, 8.20289], [122.1, 8.37002], [122.2, 8.53549], [122.3, 8.69931], [122.4, 8.8615], [122.5, 9.02208], [122.6, 9.18106], [122.7, 9.33846], [122.8, 9.49429], [122.9, 9.64857], [123, 9.80132], [123.1, 9.95254], [123.2, 10.1023], [123.3, 10.2505], [123.4, 10.3973], [123.5, 10.5426], [123.6, 10.6864], [123.7, 10.8288], [123.8, 10.9698], [123.9, 11.1094], [124, 11.2476], [124.1, 11.3845], [124.2, 11.5199], [124.3, 11.6541], [124.4, 11.7869], [124.5, 11.9183], [124.6, 12.0485], [124.7, 12.1774], [124.8, 12.305], [124.9, 12.4313], [125, 12.5563], [125.1, 12.6801], [125.2, 12.8027], [125.3, 12.9241], [125.4, 13.0442], [125.5, 13.1632], [125.6, 13.281], [125.7, 13.3976], [125.8, 13.513], [125.9, 13.6273], [126, 13.7405], [126.1, 13.8525], [126.2, 13.9634], [126.3, 14.0732], [126.4, 14.182], [126.5, 14.2896], [126.6, 14.3962], [126.7, 14.5017], [126.8, 14.6061], [126.9, 14.7096], [127, 14.8119], [127.1, 14.9133], [127.2, 15.0137], [127.3, 15.113], [127.4, 15.2114], [127.5, 15.3088], [127.6, 15.4052], [127.7, 15.5007], [127.8, 15.5952], [127.9, 15.6888], [128, 15.7815], [128.1, 15.8732], [128.2, 15.964], [128.3, 16.0539], [128.4, 16.1429], [128.5, 16.231], [128.6, 16.3183], [128.7, 16.4047], [128.8, 16.4902], [128.9, 16.5749], [129, 16.6587], [129.1, 16.7417], [129.2, 16.8239], [129.3, 16.9052], [129.4, 16.9858], [129.5, 17.0655], [129.6, 17.1445], [129.7, 17.2226], [129.8, 17.3], [129.9, 17.3766], [130, 17.4525], [130.1, 17.5276], [130.2, 17.6019], [130.3, 17.6755], [130.4, 17.7484], [130.5, 17.8206], [130.6, 17.892], [130.7, 17.9627], [130.8, 18.0327], [130.9, 18.1021], [131, 18.1707], [131.1, 18.2387], [131.2, 18.3059], [131.3, 18.3725], [131.4, 18.4385], [131.5, 18.5038], [131.6, 18.5684], [131.7, 18.6324], [131.8, 18.6958], [131.9, 18.7585], [132, 18.8206], [132.1, 18.8821], [132.2, 18.9429], [132.3, 19.0032], [132.4, 19.0629], [132.5, 19.122], [132.6, 19.1804], [132.7, 19.2383], [132.8, 19.2957], [132.9, 19.3524], [133, 19.4086], [133.1, 19.4643], [133.2, 19.5193], [133.3, 19.5739], [133.4, 19.6279], [133.5, 19.6813], [133.6, 19.7342], [133.7, 19.7866], [133.8, 19.8385], [133.9, 19.8899], [134, 19.9407], [134.1, 19.991], [134.2, -5], [134.2, -5], [134.2, -5], [134.2, -5], [134.2, -5], [134.2, -5], [134.2, -5], [134.2, -5], [134.2, -5], [134.2, -5], [134.2, -5], [134.2, -5], [134.2, -5], [134.2, -5], [134.2, -5], [134.2, -5], [134.2, -5], [134.2, -5], [134.2, -5], [134.2, -5], [134.2, -5], [134.2, -5], [134.2, -5], [134.2, -5], [134.2, -5], [134.2, -5], [134.2, -5], [134.2, -5], [134.2, -5], [134.2, -5], [134.2, -5], [134.2, -5], [134.2, -5], [134.2, -5], [134.2, -5], [134.2, -5], [134.2, -5], [134.2, -5], [134.2, -5], [134.2, -5], [134.2, -5], [134.2, -5], [134.2, -5], [134.2, -5], [134.2, -5], [134.2, -5], [134.2, -5], [134.2, -5], [134.2, -5], [134.2, -5], [134.2, -5], [134.2, -5], [134.3, -4.7015], [134.4, -4.40597], [134.5, -4.11338], [134.6, -3.8237], [134.7, -3.53691], [134.8, -3.25296], [134.9, -2.97185], [135, -2.69353], [135.1, -2.41798], [135.2, -2.14517], [135.3, -1.87507], [135.4, -1.60767], [135.5, -1.34292], [135.6, -1.08081], [135.7, -0.821304], [135.8, -0.564382], [135.9, -0.310017], [136, -0.0581821], [136.1, 0.191147], [136.2, 0.437995], [136.3, 0.682387], [136.4, 0.924347], [136.5, 1.1639], [136.6, 1.40107], [136.7, 1.63588], [136.8, 1.86835], [136.9, 2.09851], [137, 2.32638], [137.1, 2.55198], [137.2, 2.77534], [137.3, 2.99648], [137.4, 3.21541], [137.5, 3.43217], [137.6, 3.64677], [137.7, 3.85923], [137.8, 4.06958], [137.9, 4.27784], [138, 4.48403], [138.1, 4.68816], [138.2, 4.89026], [138.3, 5.09036], [138.4, 5.28846], [138.5, 5.48459], [138.6, 5.67876], [138.7, 5.87101], [138.8, 6.06134], [138.9, 6.24978], [139, 6.43635], [139.1, 6.62106], [139.2, 6.80393], [139.3, 6.98498], [139.4, 7.16423], [139.5, 7.34169], [139.6, 7.51739], [139.7, 7.69135], [139.8, 7.86357], [139.9, 8.03407], [140, 8.20289], [140.1, 8.37002], [140.2, 8.53549], [140.3, 8.69931], [140.4, 8.8615], [140.5, 9.02208], [140.6, 9.18106], [140.7, 9.33846], [140.8, 9.49429], [140.9, 9.64857], [141, 9.80132], [141.1, 9.95254], [141.2, 10.1023], [141.3, 10.2505], [141.4, 10.3973], [141.5, 10.5426], [141.6, 10.6864], [141.7, 10.8288], [141.8, 10.9698], [141.9, 11.1094], [142, 11.2476], [142.1, 11.3845], [142.2, 11.5199], [142.3, 11.6541], [142.4, 11.7869], [142.5, 11.9183], [142.6, 12.0485], [142.7, 12.1774], [142.8, 12.305], [142.9, 12.4313], [143, 12.5563], [143.1, 12.6801], [143.2, 12.8027], [143.3, 12.9241], [143.4, 13.0442], [143.5, 13.1632], [143.6, 13.281], [143.7, 13.3976], [143.8, 13.513], [143.9, 13.6273], [144, 13.7405], [144.1, 13.8525], [144.2, 13.9634], [144.3, 14.0732], [144.4, 14.182], [144.5, 14.2896], [144.6, 14.3962], [144.7, 14.5017], [144.8, 14.6061], [144.9, 14.7096], [145, 14.8119], [145.1, 14.9133], [145.2, 15.0137], [145.3, 15.113], [145.4, 15.2114], [145.5, 15.3088], [145.6, 15.4052], [145.7, 15.5007], [145.8, 15.5952], [145.9, 15.6888], [146, 15.7815], [146.1, 15.8732], [146.2, 15.964], [146.3, 16.0539], [146.4, 16.1429], [146.5, 16.231], [146.6, 16.3183], [146.7, 16.4047], [146.8, 16.4902], [146.9, 16.5749], [147, 16.6587], [147.1, 16.7417], [147.2, 16.8239], [147.3, 16.9052], [147.4, 16.9858], [147.5, 17.0655], [147.6, 17.1445], [147.7, 17.2226], [147.8, 17.3], [147.9, 17.3766], [148, 17.4525], [148.1, 17.5276], [148.2, 17.6019], [148.3, 17.6755], [148.4, 17.7484], [148.5, 17.8206], [148.6, 17.892], [148.7, 17.9627], [148.8, 18.0327], [148.9, 18.1021], [149, 18.1707], [149.1, 18.2387], [149.2, 18.3059], [149.3, 18.3725], [149.4, 18.4385], [149.5, 18.5038], [149.6, 18.5684], [149.7, 18.6324], [149.8, 18.6958], [149.9, 18.7585], [150, 18.8206], [150.1, 18.8821], [150.2, 18.9429], [150.3, 19.0032], [150.4, 19.0629], [150.5, 19.122], [150.6, 19.1804], [150.7, 19.2383], [150.8, 19.2957], [150.9, 19.3524], [151, 19.4086], [151.1, 19.4643], [151.2, 19.5193], [151.3, 19.5739], [151.4, 19.6279], [151.5, 19.6813], [151.6, 19.7342], [151.7, 19.7866], [151.8, 19.8385], [151.9, 19.8899], [152, 19.9407], [152.1, 19.991], [152.2, -5], [152.2, -5], [152.2, -5], [152.2, -5], [152.2, -5], [152.2, -5], [152.2, -5], [152.2, -5], [152.2, -5], [152.2, -5], [152.2, -5], [152.2, -5], [152.2, -5], [152.2, -5], [152.2, -5], [152.2, -5], [152.2, -5], [152.2, -5], [152.2, -5], [152.2, -5], [152.2, -5], [152.2, -5], [152.2, -5], [152.2, -5], [152.2, -5], [152.2, -5], [152.2, -5], [152.2, -5], [152.2, -5], [152.2, -5], [152.2, -5], [152.2, -5], [152.2, -5], [152.2, -5], [152.2, -5], [152.2, -5], [152.2, -5], [152.2, -5], [152.2, -5], [152.2, -5], [152.2, -5], [152.2, -5], [152.2, -5], [152.2, -5], [152.2, -5], [152.2, -5], [152.2, -5], [152.2, -5], [152.2, -5], [152.2, -5], [152.2, -5], [152.2, -5], [152.3, -4.7015], [152.4, -4.40597], [152.5, -4.11338], [152.6, -3.8237], [152.7, -3.53691], [152.8, -3.25296], [152.9, -2.97185], [153, -2.69353], [153.1, -2.41798], [153.2, -2.14517], [153.3, -1.87507], [153.4, -1.60767], [153.5, -1.34292], [153.6, -1.08081], [153.7, -0.821304], [153.8, -0.564382], [153.9, -0.310017], [154, -0.0581821], [154.1, 0.191147], [154.2, 0.437995], [154.3, 0.682387], [154.4, 0.924347], [154.5, 1.1639], [154.6, 1.40107], [154.7, 1.63588], [154.8, 1.86835], [154.9, 2.09851], [155, 2.32638], [155.1, 2.55198], [155.2, 2.77534], [155.3, 2.99648], [155.4, 3.21541], [155.5, 3.43217], [155.6, 3.64677], [155.7, 3.85923], [155.8, 4.06958], [155.9, 4.27784], [156, 4.48403], [156.1, 4.68816], [156.2, 4.89026], [156.3, 5.09036], [156.4, 5.28846], [156.5, 5.48459], [156.6, 5.67876], [156.7, 5.87101], [156.8, 6.06134], [156.9, 6.24978], [157, 6.43635], [157.1, 6.62106], [157.2, 6.80393], [157.3, 6.98498], [157.4, 7.16423], [157.5, 7.34169], [157.6, 7.51739], [157.7, 7.69135], [157.8, 7.86357], [157.9, 8.03407], [158, 8.20289], [158.1, 8.37002], [158.2, 8.53549], [158.3, 8.69931], [158.4, 8.8615], [158.5, 9.02208], [158.6, 9.18106], [158.7, 9.33846], [158.8, 9.49429], [158.9, 9.64857], [159, 9.80132], [159.1, 9.95254], [159.2, 10.1023], [159.3, 10.2505], [159.4, 10.3973], [159.5, 10.5426], [159.6, 10.6864], [159.7, 10.8288], [159.8, 10.9698], [159.9, 11.1094], [160, 11.2476], [160.1, 11.3845], [160.2, 11.5199], [160.3, 11.6541], [160.4, 11.7869], [160.5, 11.9183], [160.6, 12.0485], [160.7, 12.1774], [160.8, 12.305], [160.9, 12.4313], [161, 12.5563], [161.1, 12.6801], [161.2, 12.8027], [161.3, 12.9241], [161.4, 13.0442], [161.5, 13.1632], [161.6, 13.281], [161.7, 13.3976], [161.8, 13.513], [161.9, 13.6273], [162, 13.7405], [162.1, 13.8525], [162.2, 13.9634], [162.3, 14.0732], [162.4, 14.182], [162.5, 14.2896], [162.6, 14.3962], [162.7, 14.5017], [162.8, 14.6061], [162.9, 14.7096], [163, 14.8119], [163.1, 14.9133], [163.2, 15.0137], [163.3, 15.113], [163.4, 15.2114], [163.5, 15.3088], [163.6, 15.4052], [163.7, 15.5007], [163.8, 15.5952], [163.9, 15.6888], [164, 15.7815], [164.1, 15.8732], [164.2, 15.964], [164.3, 16.0539], [164.4, 16.1429], [164.5, 16.231], [164.6, 16.3183], [164.7, 16.4047], [164.8, 16.4902], [164.9, 16.5749], [165, 16.6587], [165.1, 16.7417], [165.2, 16.8239], [165.3, 16.9052], [165.4, 16.9858], [165.5, 17.0655], [165.6, 17.1445], [165.7, 17.2226], [165.8, 17.3], [165.9, 17.3766], [166, 17.4525], [166.1, 17.5276], [166.2, 17.6019], [166.3, 17.6755], [166.4, 17.7484], [166.5, 17.8206], [166.6, 17.892], [166.7, 17.9627], [166.8, 18.0327], [166.9, 18.1021], [167, 18.1707], [167.1, 18.2387], [167.2, 18.3059], [167.3, 18.3725], [167.4, 18.4385], [167.5, 18.5038], [167.6, 18.5684], [167.7, 18.6324], [167.8, 18.6958], [167.9, 18.7585], [168, 18.8206], [168.1, 18.8821], [168.2, 18.9429], [168.3, 19.0032], [168.4, 19.0629], [168.5, 19.122], [168.6, 19.1804], [168.7, 19.2383], [168.8, 19.2957], [168.9, 19.3524], [169, 19.4086], [169.1, 19.4643], [169.2, 19.5193], [169.3, 19.5739], [169.4, 19.6279], [169.5, 19.6813], [169.6, 19.7342], [169.7, 19.7866], [169.8, 19.8385], [169.9, 19.8899], [170, 19.9407], [170.1, 19.991], [170.2, -5], [170.2, -5], [170.2, -5], [170.2, -5], [170.2, -5], [170.2, -5], [170.2, -5], [170.2, -5], [170.2, -5], [170.2, -5], [170.2, -5], [170.2, -5], [170.2, -5], [170.2, -5], [170.2, -5], [170.2, -5], [170.2, -5], [170.2, -5], [170.2, -5], [170.2, -5], [170.2, -5], [170.2, -5], [170.2, -5], [170.2, -5], [170.2, -5], [170.2, -5], [170.2, -5], [170.2, -5], [170.2, -5], [170.2, -5], [170.2, -5], [170.2, -5], [170.2, -5], [170.2, -5], [170.2, -5], [170.2, -5], [170.2, -5], [170.2, -5], [170.2, -5], [170.2, -5], [170.2, -5], [170.2, -5], [170.2, -5], [170.2, -5], [170.2, -5], [170.2, -5], [170.2, -5], [170.2, -5], [170.2, -5], [170.2, -5], [170.2, -5], [170.2, -5], [170.3, -4.7015], [170.4, -4.40597], [170.5, -4.11338], [170.6, -3.8237], [170.7, -3.53691], [170.8, -3.25296], [170.9, -2.97185], [171, -2.69353], [171.1, -2.41798], [171.2, -2.14517], [171.3, -1.87507], [171.4, -1.60767], [171.5, -1.34292], [171.6, -1.08081], [171.7, -0.821304], [171.8, -0.564382], [171.9, -0.310017], [172, -0.0581821], [172.1, 0.191147], [172.2, 0.437995], [172.3, 0.682387], [172.4, 0.924347], [172.5, 1.1639], [172.6, 1.40107], [172.7, 1.63588], [172.8, 1.86835], [172.9, 2.09851], [173, 2.32638], [173.1, 2.55198], [173.2, 2.77534], [173.3, 2.99648], [173.4, 3.21541], [173.5, 3.43217], [173.6, 3.64677], [173.7, 3.85923], [173.8, 4.06958], [173.9, 4.27784], [174, 4.48403], [174.1, 4.68816], [174.2, 4.89026], [174.3, 5.09036], [174.4, 5.28846], [174.5, 5.48459], [174.6, 5.67876], [174.7, 5.87101], [174.8, 6.06134], [174.9, 6.24978], [175, 6.43635], [175.1, 6.62106], [175.2, 6.80393], [175.3, 6.98498], [175.4, 7.16423], [175.5, 7.34169], [175.6, 7.51739], [175.7, 7.69135], [175.8, 7.86357], [175.9, 8.03407], [176, 8.20289], [176.1, 8.37002], [176.2, 8.53549], [176.3, 8.69931], [176.4, 8.8615], [176.5, 9.02208], [176.6, 9.18106], [176.7, 9.33846], [176.8, 9.49429], [176.9, 9.64857], [177, 9.80132], [177.1, 9.95254], [177.2, 10.1023], [177.3, 10.2505], [177.4, 10.3973], [177.5, 10.5426], [177.6, 10.6864], [177.7, 10.8288], [177.8, 10.9698], [177.9, 11.1094], [178, 11.2476], [178.1, 11.3845], [178.2, 11.5199], [178.3, 11.6541], [178.4, 11.7869], [178.5, 11.9183], [178.6, 12.0485], [178.7, 12.1774], [178.8, 12.305], [178.9, 12.4313], [179, 12.5563], [179.1, 12.6801], [179.2, 12.8027], [179.3, 12.9241], [179.4, 13.0442], [179.5, 13.1632], [179.6, 13.281], [179.7, 13.3976], [179.8, 13.513], [179.9, 13.6273], [180, 13.7405], [180.1, 13.8525], [180.2, 13.9634], [180.3, 14.0732], [180.4, 14.182], [180.5, 14.2896], [180.6, 14.3962], [180.7, 14.5017], [180.8, 14.6061], [180.9, 14.7096], [181, 14.8119], [181.1, 14.9133], [181.2, 15.0137], [181.3, 15.113], [181.4, 15.2114], [181.5, 15.3088], [181.6, 15.4052], [181.7, 15.5007], [181.8, 15.5952], [181.9, 15.6888], [182, 15.7815], [182.1, 15.8732], [182.2, 15.964], [182.3, 16.0539], [182.4, 16.1429], [182.5, 16.231], [182.6, 16.3183], [182.7, 16.4047], [182.8, 16.4902], [182.9, 16.5749], [183, 16.6587], [183.1, 16.7417], [183.2, 16.8239], [183.3, 16.9052], [183.4, 16.9858], [183.5, 17.0655], [183.6, 17.1445], [183.7, 17.2226], [183.8, 17.3], [183.9, 17.3766], [184, 17.4525], [184.1, 17.5276], [184.2, 17.6019], [184.3, 17.6755], [184.4, 17.7484], [184.5, 17.8206], [184.6, 17.892], [184.7, 17.9627], [184.8, 18.0327], [184.9, 18.1021], [185, 18.1707], [185.1, 18.2387], [185.2, 18.3059], [185.3, 18.3725], [185.4, 18.4385], [185.5, 18.5038], [185.6, 18.5684], [185.7, 18.6324], [185.8, 18.6958], [185.9, 18.7585], [186, 18.8206], [186.1, 18.8821], [186.2, 18.9429], [186.3, 19.0032], [186.4, 19.0629], [186.5, 19.122], [186.6, 19.1804], [186.7, 19.2383], [186.8, 19.2957], [186.9, 19.3524], [187, 19.4086], [187.1, 19.4643], [187.2, 19.5193], [187.3, 19.5739], [187.4, 19.6279], [187.5, 19.6813], [187.6, 19.7342], [187.7, 19.7866], [187.8, 19.8385], [187.9, 19.8899], [188, 19.9407], [188.1, 19.991], [188.2, -5], [188.2, -5], [188.2, -5], [188.2, -5], [188.2, -5], [188.2, -5], [188.2, -5], [188.2, -5], [188.2, -5], [188.2, -5], [188.2, -5], [188.2, -5], [188.2, -5], [188.2, -5], [188.2, -5], [188.2, -5], [188.2, -5], [188.2, -5], [188.2, -5], [188.2, -5], [188.2, -5], [188.2, -5], [188.2, -5], [188.2, -5], [188.2, -5], [188.2, -5], [188.2, -5], [188.2, -5], [188.2, -5], [188.2, -5], [188.2, -5], [188.2, -5], [188.2, -5], [188.2, -5], [188.2, -5], [188.2, -5], [188.2, -5], [188.2, -5], [188.2, -5], [188.2, -5], [188.2, -5], [188.2, -5], [188.2, -5], [188.2, -5], [188.2, -5], [188.2, -5], [188.2, -5], [188.2, -5], [188.2, -5], [188.2, -5], [188.2, -5], [188.2, -5], [188.3, -4.7015], [188.4, -4.40597], [188.5, -4.11338], [188.6, -3.8237], [188.7, -3.53691], [188.8, -3.25296], [188.9, -2.97185], [189, -2.69353], [189.1, -2.41798], [189.2, -2.14517], [189.3, -1.87507], [189.4, -1.60767], [189.5, -1.34292], [189.6, -1.08081], [189.7, -0.821304], [189.8, -0.564382], [189.9, -0.310017], [190, -0.0581821], [190.1, 0.191147], [190.2, 0.437995], [190.3, 0.682387], [190.4, 0.924347], [190.5, 1.1639], [190.6, 1.40107], [190.7, 1.63588], [190.8, 1.86835], [190.9, 2.09851], [191, 2.32638], [191.1, 2.55198], [191.2, 2.77534], [191.3, 2.99648], [191.4, 3.21541], [191.5, 3.43217], [191.6, 3.64677], [191.7, 3.85923], [191.8, 4.06958], [191.9, 4.27784], [192, 4.48403], [192.1, 4.68816], [192.2, 4.89026], [192.3, 5.09036], [192.4, 5.28846], [192.5, 5.48459], [192.6, 5.67876], [192.7, 5.87101], [192.8, 6.06134], [192.9, 6.24978], [193, 6.43635], [193.1, 6.62106], [193.2, 6.80393], [193.3, 6.98498], [193.4, 7.16423], [193.5, 7.34169], [193.6, 7.51739], [193.7, 7.69135], [193.8, 7.86357], [193.9, 8.03407], [194, 8.20289], [194.1, 8.37002], [194.2, 8.53549], [194.3, 8.69931], [194.4, 8.8615], [194.5, 9.02208], [194.6, 9.18106], [194.7, 9.33846], [194.8, 9.49429], [194.9, 9.64857], [195, 9.80132], [195.1, 9.95254], [195.2, 10.1023], [195.3, 10.2505], [195.4, 10.3973], [195.5, 10.5426], [195.6, 10.6864], [195.7, 10.8288], [195.8, 10.9698], [195.9, 11.1094], [196, 11.2476], [196.1, 11.3845], [196.2, 11.5199], [196.3, 11.6541], [196.4, 11.7869], [196.5, 11.9183], [196.6, 12.0485], [196.7, 12.1774], [196.8, 12.305], [196.9, 12.4313], [197, 12.5563], [197.1, 12.6801], [197.2, 12.8027], [197.3, 12.9241], [197.4, 13.0442], [197.5, 13.1632], [197.6, 13.281], [197.7, 13.3976], [197.8, 13.513], [197.9, 13.6273], [198, 13.7405], [198.1, 13.8525], [198.2, 13.9634], [198.3, 14.0732], [198.4, 14.182], [198.5, 14.2896], [198.6, 14.3962], [198.7, 14.5017], [198.8, 14.6061], [198.9, 14.7096], [199, 14.8119], [199.1, 14.9133], [199.2, 15.0137], [199.3, 15.113], [199.4, 15.2114], [199.5, 15.3088], [199.6, 15.4052], [199.7, 15.5007], [199.8, 15.5952], [199.9, 15.6888], [200, 15.7815], [200.1, 15.8732], [200.2, 15.964], [200.3, 16.0539], [200.4, 16.1429], [200.5, 16.231], [200.6, 16.3183], [200.7, 16.4047], [200.8, 16.4902], [200.9, 16.5749], [201, 16.6587], [201.1, 16.7417], [201.2, 16.8239], [201.3, 16.9052], [201.4, 16.9858], [201.5, 17.0655], [201.6, 17.1445], [201.7, 17.2226], [201.8, 17.3], [201.9, 17.3766], [202, 17.4525], [202.1, 17.5276], [202.2, 17.6019], [202.3, 17.6755], [202.4, 17.7484], [202.5, 17.8206], [202.6, 17.892], [202.7, 17.9627], [202.8, 18.0327], [202.9, 18.1021], [203, 18.1707], [203.1, 18.2387], [203.2, 18.3059], [203.3, 18.3725], [203.4, 18.4385], [203.5, 18.5038], [203.6, 18.5684], [203.7, 18.6324], [203.8, 18.6958], [203.9, 18.7585], [204, 18.8206], [204.1, 18.8821], [204.2, 18.9429], [204.3, 19.0032], [204.4, 19.0629], [204.5, 19.122], [204.6, 19.1804], [204.7, 19.2383], [204.8, 19.2957], [204.9, 19.3524], [205, 19.4086], [205.1, 19.4643], [205.2, 19.5193], [205.3, 19.5739], [205.4, 19.6279], [205.5, 19.6813], [205.6, 19.7342], [205.7, 19.7866], [205.8, 19.8385], [205.9, 19.8899], [206, 19.9407], [206.1, 19.991], [206.2, -5], [206.2, -5], [206.2, -5], [206.2, -5], [206.2, -5], [206.2, -5], [206.2, -5], [206.2, -5], [206.2, -5], [206.2, -5], [206.2, -5], [206.2, -5], [206.2, -5], [206.2, -5], [206.2, -5], [206.2, -5], [206.2, -5], [206.2, -5], [206.2, -5], [206.2, -5], [206.2, -5], [206.2, -5], [206.2, -5], [206.2, -5], [206.2, -5], [206.2, -5], [206.2, -5], [206.2, -5], [206.2, -5], [206.2, -5], [206.2, -5], [206.2, -5], [206.2, -5], [206.2, -5], [206.2, -5], [206.2, -5], [206.2, -5], [206.2, -5], [206.2, -5], [206.2, -5], [206.2, -5], [206.2, -5], [206.2, -5], [206.2, -5], [206.2, -5], [206.2, -5], [206.2, -5], [206.2, -5], [206.2, -5], [206.2, -5], [206.2, -5], [206.2, -5], [206.3, -4.7015], [206.4, -4.40597], [206.5, -4.11338], [206.6, -3.8237], [206.7, -3.53691], [206.8, -3.25296], [206.9, -2.97185], [207, -2.69353], [207.1, -2.41798], [207.2, -2.14517], [207.3, -1.87507], [207.4, -1.60767], [207.5, -1.34292], [207.6, -1.08081], [207.7, -0.821304], [207.8, -0.564382], [207.9, -0.310017], [208, -0.0581821], [208.1, 0.191147], [208.2, 0.437995], [208.3, 0.682387], [208.4, 0.924347], [208.5, 1.1639], [208.6, 1.40107], [208.7, 1.63588], [208.8, 1.86835], [208.9, 2.09851], [209, 2.32638], [209.1, 2.55198], [209.2, 2.77534], [209.3, 2.99648], [209.4, 3.21541], [209.5, 3.43217], [209.6, 3.64677], [209.7, 3.85923], [209.8, 4.06958], [209.9, 4.27784], [210, 4.48403], [210.1, 4.68816], [210.2, 4.89026], [210.3, 5.09036], [210.4, 5.28846], [210.5, 5.48459], [210.6, 5.67876], [210.7, 5.87101], [210.8, 6.06134], [210.9, 6.24978], [211, 6.43635], [211.1, 6.62106], [211.2, 6.80393], [211.3, 6.98498], [211.4, 7.16423], [211.5, 7.34169], [211.6, 7.51739], [211.7, 7.69135], [211.8, 7.86357], [211.9, 8.03407], [212, 8.20289], [212.1, 8.37002], [212.2, 8.53549], [212.3, 8.69931], [212.4, 8.8615], [212.5, 9.02208], [212.6, 9.18106], [212.7, 9.33846], [212.8, 9.49429], [212.9, 9.64857], [213, 9.80132], [213.1, 9.95254], [213.2, 10.1023], [213.3, 10.2505], [213.4, 10.3973], [213.5, 10.5426], [213.6, 10.6864], [213.7, 10.8288], [213.8, 10.9698], [213.9, 11.1094], [214, 11.2476], [214.1, 11.3845], [214.2, 11.5199], [214.3, 11.6541], [214.4, 11.7869], [214.5, 11.9183], [214.6, 12.0485], [214.7, 12.1774], [214.8, 12.305], [214.9, 12.4313], [215, 12.5563], [215.1, 12.6801], [215.2, 12.8027], [215.3, 12.9241], [215.4, 13.0442], [215.5, 13.1632], [215.6, 13.281], [215.7, 13.3976], [215.8, 13.513], [215.9, 13.6273], [216, 13.7405], [216.1, 13.8525], [216.2, 13.9634], [216.3, 14.0732], [216.4, 14.182], [216.5, 14.2896], [216.6, 14.3962], [216.7, 14.5017], [216.8, 14.6061], [216.9, 14.7096], [217, 14.8119], [217.1, 14.9133], [217.2, 15.0137], [217.3, 15.113], [217.4, 15.2114], [217.5, 15.3088], [217.6, 15.4052], [217.7, 15.5007], [217.8, 15.5952], [217.9, 15.6888], [218, 15.7815], [218.1, 15.8732], [218.2, 15.964], [218.3, 16.0539], [218.4, 16.1429], [218.5, 16.231], [218.6, 16.3183], [218.7, 16.4047], [218.8, 16.4902], [218.9, 16.5749], [219, 16.6587], [219.1, 16.7417], [219.2, 16.8239], [219.3, 16.9052], [219.4, 16.9858], [219.5, 17.0655], [219.6, 17.1445], [219.7, 17.2226], [219.8, 17.3], [219.9, 17.3766], [220, 17.4525], [220.1, 17.5276], [220.2, 17.6019], [220.3, 17.6755], [220.4, 17.7484], [220.5, 17.8206], [220.6, 17.892], [220.7, 17.9627], [220.8, 18.0327], [220.9, 18.1021], [221, 18.1707], [221.1, 18.2387], [221.2, 18.3059], [221.3, 18.3725], [221.4, 18.4385], [221.5, 18.5038], [221.6, 18.5684], [221.7, 18.6324], [221.8, 18.6958], [221.9, 18.7585], [222, 18.8206], [222.1, 18.8821], [222.2, 18.9429], [222.3, 19.0032], [222.4, 19.0629], [222.5, 19.122], [222.6, 19.1804], [222.7, 19.2383], [222.8, 19.2957], [222.9, 19.3524], [223, 19.4086], [223.1, 19.4643], [223.2, 19.5193], [223.3, 19.5739], [223.4, 19.6279], [223.5, 19.6813], [223.6, 19.7342], [223.7, 19.7866], [223.8, 19.8385], [223.9, 19.8899], [224, 19.9407], [224.1, 19.991], [224.2, -5], [224.2, -5], [224.2, -5], [224.2, -5], [224.2, -5], [224.2, -5], [224.2, -5], [224.2, -5], [224.2, -5], [224.2, -5], [224.2, -5], [224.2, -5], [224.2, -5], [224.2, -5], [224.2, -5], [224.2, -5], [224.2, -5], [224.2, -5], [224.2, -5], [224.2, -5], [224.2, -5], [224.2, -5], [224.2, -5], [224.2, -5], [224.2, -5], [224.2, -5], [224.2, -5], [224.2, -5], [224.2, -5], [224.2, -5], [224.2, -5], [224.2, -5], [224.2, -5], [224.2, -5], [224.2, -5], [224.2, -5], [224.2, -5], [224.2, -5], [224.2, -5], [224.2, -5], [224.2, -5], [224.2, -5], [224.2, -5], [224.2, -5], [224.2, -5], [224.2, -5], [224.2, -5], [224.2, -5], [224.2, -5], [224.2, -5], [224.2, -5], [224.2, -5], [224.3, -4.7015], [224.4, -4.40597], [224.5, -4.11338], [224.6, -3.8237], [224.7, -3.53691], [224.8, -3.25296], [224.9, -2.97185], [225, -2.69353], [225.1, -2.41798], [225.2, -2.14517], [225.3, -1.87507], [225.4, -1.60767], [225.5, -1.34292], [225.6, -1.08081], [225.7, -0.821304], [225.8, -0.564382], [225.9, -0.310017], [226, -0.0581821], [226.1, 0.191147], [226.2, 0.437995], [226.3, 0.682387], [226.4, 0.924347], [226.5, 1.1639], [226.6, 1.40107], [226.7, 1.63588], [226.8, 1.86835], [226.9, 2.09851], [227, 2.32638], [227.1, 2.55198], [227.2, 2.77534], [227.3, 2.99648], [227.4, 3.21541], [227.5, 3.43217], [227.6, 3.64677], [227.7, 3.85923], [227.8, 4.06958], [227.9, 4.27784], [228, 4.48403], [228.1, 4.68816], [228.2, 4.89026], [228.3, 5.09036], [228.4, 5.28846], [228.5, 5.48459], [228.6, 5.67876], [228.7, 5.87101], [228.8, 6.06134], [228.9, 6.24978], [229, 6.43635], [229.1, 6.62106], [229.2, 6.80393], [229.3, 6.98498], [229.4, 7.16423], [229.5, 7.34169], [229.6, 7.51739], [229.7, 7.69135], [229.8, 7.86357], [229.9, 8.03407], [230, 8.20289], [230.1, 8.37002], [230.2, 8.53549], [230.3, 8.69931], [230.4, 8.8615], [230.5, 9.02208], [230.6, 9.18106], [230.7, 9.33846], [230.8, 9.49429], [230.9, 9.64857], [231, 9.80132], [231.1, 9.95254], [231.2, 10.1023], [231.3, 10.2505], [231.4, 10.3973], [231.5, 10.5426], [231.6, 10.6864], [231.7, 10.8288], [231.8, 10.9698], [231.9, 11.1094], [232, 11.2476], [232.1, 11.3845], [232.2, 11.5199], [232.3, 11.6541], [232.4, 11.7869], [232.5, 11.9183], [232.6, 12.0485], [232.7, 12.1774], [232.8, 12.305], [232.9, 12.4313], [233, 12.5563], [233.1, 12.6801], [233.2, 12.8027], [233.3, 12.9241], [233.4, 13.0442], [233.5, 13.1632], [233.6, 13.281], [233.7, 13.3976], [233.8, 13.513], [233.9, 13.6273], [234, 13.7405], [234.1, 13.8525], [234.2, 13.9634], [234.3, 14.0732], [234.4, 14.182], [234.5, 14.2896], [234.6, 14.3962], [234.7, 14.5017], [234.8, 14.6061], [234.9, 14.7096], [235, 14.8119], [235.1, 14.9133], [235.2, 15.0137], [235.3, 15.113], [235.4, 15.2114], [235.5, 15.3088], [235.6, 15.4052], [235.7, 15.5007], [235.8, 15.5952], [235.9, 15.6888], [236, 15.7815], [236.1, 15.8732], [236.2, 15.964], [236.3, 16.0539], [236.4, 16.1429], [236.5, 16.231], [236.6, 16.3183], [236.7, 16.4047], [236.8, 16.4902], [236.9, 16.5749], [237, 16.6587], [237.1, 16.7417], [237.2, 16.8239], [237.3, 16.9052], [237.4, 16.9858], [237.5, 17.0655], [237.6, 17.1445], [237.7, 17.2226], [237.8, 17.3], [237.9, 17.3766], [238, 17.4525], [238.1, 17.5276], [238.2, 17.6019], [238.3, 17.6755], [238.4, 17.7484], [238.5, 17.8206], [238.6, 17.892], [238.7, 17.9627], [238.8, 18.0327], [238.9, 18.1021], [239, 18.1707], [239.1, 18.2387], [239.2, 18.3059], [239.3, 18.3725], [239.4, 18.4385], [239.5, 18.5038], [239.6, 18.5684], [239.7, 18.6324], [239.8, 18.6958], [239.9, 18.7585], [240, 18.8206], [240.1, 18.8821], [240.2, 18.9429], [240.3, 19.0032], [240.4, 19.0629], [240.5, 19.122], [240.6, 19.1804], [240.7, 19.2383], [240.8, 19.2957], [240.9, 19.3524], [241, 19.4086], [241.1, 19.4643], [241.2, 19.5193], [241.3, 19.5739], [241.4, 19.6279], [241.5, 19.6813], [241.6, 19.7342], [241.7, 19.7866], [241.8, 19.8385], [241.9, 19.8899], [242, 19.9407], [242.1, 19.991], [242.2, -5], [242.2, -5], [242.2, -5], [242.2, -5], [242.2, -5], [242.2, -5], [242.2, -5], [242.2, -5], [242.2, -5], [242.2, -5], [242.2, -5], [242.2, -5], [242.2, -5], [242.2, -5], [242.2, -5], [242.2, -5], [242.2, -5], [242.2, -5], [242.2, -5], [242.2, -5], [242.2, -5], [242.2, -5], [242.2, -5], [242.2, -5], [242.2, -5], [242.2, -5], [242.2, -5], [242.2, -5], [242.2, -5], [242.2, -5], [242.2, -5], [242.2, -5], [242.2, -5], [242.2, -5], [242.2, -5], [242.2, -5], [242.2, -5], [242.2, -5], [242.2, -5], [242.2, -5], [242.2, -5], [242.2, -5], [242.2, -5], [242.2, -5], [242.2, -5], [242.2, -5], [242.2, -5], [242.2, -5], [242.2, -5], [242.2, -5], [242.2, -5], [242.2, -5], [242.3, -4.7015], [242.4, -4.40597], [242.5, -4.11338], [242.6, -3.8237], [242.7, -3.53691], [242.8, -3.25296], [242.9, -2.97185], [243, -2.69353], [243.1, -2.41798], [243.2, -2.14517], [243.3, -1.87507], [243.4, -1.60767], [243.5, -1.34292], [243.6, -1.08081], [243.7, -0.821304], [243.8, -0.564382], [243.9, -0.310017], [244, -0.0581821], [244.1, 0.191147], [244.2, 0.437995], [244.3, 0.682387], [244.4, 0.924347], [244.5, 1.1639], [244.6, 1.40107], [244.7, 1.63588], [244.8, 1.86835], [244.9, 2.09851], [245, 2.32638], [245.1, 2.55198], [245.2, 2.77534], [245.3, 2.99648], [245.4, 3.21541], [245.5, 3.43217], [245.6, 3.64677], [245.7, 3.85923], [245.8, 4.06958], [245.9, 4.27784], [246, 4.48403], [246.1, 4.68816], [246.2, 4.89026], [246.3, 5.09036], [246.4, 5.28846], [246.5, 5.48459], [246.6, 5.67876], [246.7, 5.87101], [246.8, 6.06134], [246.9, 6.24978], [247, 6.43635], [247.1, 6.62106], [247.2, 6.80393], [247.3, 6.98498], [247.4, 7.16423], [247.5, 7.34169], [247.6, 7.51739], [247.7, 7.69135], [247.8, 7.86357], [247.9, 8.03407], [248, 8.20289], [248.1, 8.37002], [248.2, 8.53549], [248.3, 8.69931], [248.4, 8.8615], [248.5, 9.02208], [248.6, 9.18106], [248.7, 9.33846], [248.8, 9.49429], [248.9, 9.64857], [249, 9.80132], [249.1, 9.95254], [249.2, 10.1023], [249.3, 10.2505], [249.4, 10.3973], [249.5, 10.5426], [249.6, 10.6864], [249.7, 10.8288], [249.8, 10.9698], [249.9, 11.1094], [250, 11.2476], [250.1, 11.3845], [250.2, 11.5199], [250.3, 11.6541], [250.4, 11.7869], [250.5, 11.9183], [250.6, 12.0485], [250.7, 12.1774], [250.8, 12.305], [250.9, 12.4313], [251, 12.5563], [251.1, 12.6801], [251.2, 12.8027], [251.3, 12.9241], [251.4, 13.0442], [251.5, 13.1632], [251.6, 13.281], [251.7, 13.3976], [251.8, 13.513], [251.9, 13.6273], [252, 13.7405], [252.1, 13.8525], [252.2, 13.9634], [252.3, 14.0732], [252.4, 14.182], [252.5, 14.2896], [252.6, 14.3962], [252.7, 14.5017], [252.8, 14.6061], [252.9, 14.7096], [253, 14.8119], [253.1, 14.9133], [253.2, 15.0137], [253.3, 15.113], [253.4, 15.2114], [253.5, 15.3088], [253.6, 15.4052], [253.7, 15.5007], [253.8, 15.5952], [253.9, 15.6888], [254, 15.7815], [254.1, 15.8732], [254.2, 15.964], [254.3, 16.0539], [254.4, 16.1429], [254.5, 16.231], [254.6, 16.3183], [254.7, 16.4047], [254.8, 16.4902], [254.9, 16.5749], [255, 16.6587], [255.1, 16.7417], [255.2, 16.8239], [255.3, 16.9052], [255.4, 16.9858], [255.5, 17.0655], [255.6, 17.1445], [255.7, 17.2226], [255.8, 17.3], [255.9, 17.3766], [256, 17.4525], [256.1, 17.5276], [256.2, 17.6019], [256.3, 17.6755], [256.4, 17.7484], [256.5, 17.8206], [256.6, 17.892], [256.7, 17.9627], [256.8, 18.0327], [256.9, 18.1021], [257, 18.1707], [257.1, 18.2387], [257.2, 18.3059], [257.3, 18.3725], [257.4, 18.4385], [257.5, 18.5038], [257.6, 18.5684], [257.7, 18.6324], [257.8, 18.6958], [257.9, 18.7585], [258, 18.8206], [258.1, 18.8821], [258.2, 18.9429], [258.3, 19.0032], [258.4, 19.0629], [258.5, 19.122], [258.6, 19.1804], [258.7, 19.2383], [258.8, 19.2957], [258.9, 19.3524], [259, 19.4086], [259.1, 19.4643], [259.2, 19.5193], [259.3, 19.5739], [259.4, 19.6279], [259.5, 19.6813], [259.6, 19.7342], [259.7, 19.7866], [259.8, 19.8385], [259.9, 19.8899], [260, 19.9407], [260.1, 19.991], [260.2, -5], [260.2, -5], [260.2, -5], [260.2, -5], [260.2, -5], [260.2, -5], [260.2, -5], [260.2, -5], [260.2, -5], [260.2, -5], [260.2, -5], [260.2, -5], [260.2, -5], [260.2, -5], [260.2, -5], [260.2, -5], [260.2, -5], [260.2, -5], [260.2, -5], [260.2, -5], [260.2, -5], [260.2, -5], [260.2, -5], [260.2, -5], [260.2, -5], [260.2, -5], [260.2, -5], [260.2, -5], [260.2, -5], [260.2, -5], [260.2, -5], [260.2, -5], [260.2, -5], [260.2, -5], [260.2, -5], [260.2, -5], [260.2, -5], [260.2, -5], [260.2, -5], [260.2, -5], [260.2, -5], [260.2, -5], [260.2, -5], [260.2, -5], [260.2, -5], [260.2, -5], [260.2, -5], [260.2, -5], [260.2, -5], [260.2, -5], [260.2, -5], [260.2, -5], [260.3, -4.7015], [260.4, -4.40597], [260.5, -4.11338], [260.6, -3.8237], [260.7, -3.53691], [260.8, -3.25296], [260.9, -2.97185], [261, -2.69353], [261.1, -2.41798], [261.2, -2.14517], [261.3, -1.87507], [261.4, -1.60767], [261.5, -1.34292], [261.6, -1.08081], [261.7, -0.821304], [261.8, -0.564382], [261.9, -0.310017], [262, -0.0581821], [262.1, 0.191147], [262.2, 0.437995], [262.3, 0.682387], [262.4, 0.924347], [262.5, 1.1639], [262.6, 1.40107], [262.7, 1.63588], [262.8, 1.86835], [262.9, 2.09851], [263, 2.32638], [263.1, 2.55198], [263.2, 2.77534], [263.3, 2.99648], [263.4, 3.21541], [263.5, 3.43217], [263.6, 3.64677], [263.7, 3.85923], [263.8, 4.06958], [263.9, 4.27784], [264, 4.48403], [264.1, 4.68816], [264.2, 4.89026], [264.3, 5.09036], [264.4, 5.28846], [264.5, 5.48459], [264.6, 5.67876], [264.7, 5.87101], [264.8, 6.06134], [264.9, 6.24978], [265, 6.43635], [265.1, 6.62106], [265.2, 6.80393], [265.3, 6.98498], [265.4, 7.16423], [265.5, 7.34169], [265.6, 7.51739], [265.7, 7.69135], [265.8, 7.86357], [265.9, 8.03407], [266, 8.20289], [266.1, 8.37002], [266.2, 8.53549], [266.3, 8.69931], [266.4, 8.8615], [266.5, 9.02208], [266.6, 9.18106], [266.7, 9.33846], [266.8, 9.49429], [266.9, 9.64857], [267, 9.80132], [267.1, 9.95254], [267.2, 10.1023], [267.3, 10.2505], [267.4, 10.3973], [267.5, 10.5426], [267.6, 10.6864], [267.7, 10.8288], [267.8, 10.9698], [267.9, 11.1094], [268, 11.2476], [268.1, 11.3845], [268.2, 11.5199], [268.3, 11.6541], [268.4, 11.7869], [268.5, 11.9183], [268.6, 12.0485], [268.7, 12.1774], [268.8, 12.305], [268.9, 12.4313], [269, 12.5563], [269.1, 12.6801], [269.2, 12.8027], [269.3, 12.9241], [269.4, 13.0442], [269.5, 13.1632], [269.6, 13.281], [269.7, 13.3976], [269.8, 13.513], [269.9, 13.6273], [270, 13.7405], [270.1, 13.8525], [270.2, 13.9634], [270.3, 14.0732], [270.4, 14.182], [270.5, 14.2896], [270.6, 14.3962], [270.7, 14.5017], [270.8, 14.6061], [270.9, 14.7096], [271, 14.8119], [271.1, 14.9133], [271.2, 15.0137], [271.3, 15.113], [271.4, 15.2114], [271.5, 15.3088], [271.6, 15.4052], [271.7, 15.5007], [271.8, 15.5952], [271.9, 15.6888], [272, 15.7815], [272.1, 15.8732], [272.2, 15.964], [272.3, 16.0539], [272.4, 16.1429], [272.5, 16.231], [272.6, 16.3183], [272.7, 16.4047], [272.8, 16.4902], [272.9, 16.5749], [273, 16.6587], [273.1, 16.7417], [273.2, 16.8239], [273.3, 16.9052], [273.4, 16.9858], [273.5, 17.0655], [273.6, 17.1445], [273.7, 17.2226], [273.8, 17.3], [273.9, 17.3766], [274, 17.4525], [274.1, 17.5276], [274.2, 17.6019], [274.3, 17.6755], [274.4, 17.7484], [274.5, 17.8206], [274.6, 17.892], [274.7, 17.9627], [274.8, 18.0327], [274.9, 18.1021], [275, 18.1707], [275.1, 18.2387], [275.2, 18.3059], [275.3, 18.3725], [275.4, 18.4385], [275.5, 18.5038], [275.6, 18.5684], [275.7, 18.6324], [275.8, 18.6958], [275.9, 18.7585], [276, 18.8206], [276.1, 18.8821], [276.2, 18.9429], [276.3, 19.0032], [276.4, 19.0629], [276.5, 19.122], [276.6, 19.1804], [276.7, 19.2383], [276.8, 19.2957], [276.9, 19.3524], [277, 19.4086], [277.1, 19.4643], [277.2, 19.5193], [277.3, 19.5739], [277.4, 19.6279], [277.5, 19.6813], [277.6, 19.7342], [277.7, 19.7866], [277.8, 19.8385], [277.9, 19.8899], [278, 19.9407], [278.1, 19.991], [278.2, -5], [278.2, -5], [278.2, -5], [278.2, -5], [278.2, -5], [278.2, -5], [278.2, -5], [278.2, -5], [278.2, -5], [278.2, -5], [278.2, -5], [278.2, -5], [278.2, -5], [278.2, -5], [278.2, -5], [278.2, -5], [278.2, -5], [278.2, -5], [278.2, -5], [278.2, -5], [278.2, -5], [278.2, -5], [278.2, -5], [278.2, -5], [278.2, -5], [278.2, -5], [278.2, -5], [278.2, -5], [278.2, -5], [278.2, -5], [278.2, -5], [278.2, -5], [278.2, -5], [278.2, -5], [278.2, -5], [278.2, -5], [278.2, -5], [278.2, -5], [278.2, -5], [278.2, -5], [278.2, -5], [278.2, -5], [278.2, -5], [278.2, -5], [278.2, -5], [278.2, -5], [278.2, -5], [278.2, -5], [278.2, -5], [278.2, -5], [278.2, -5], [278.2, -5], [278.3, -4.7015], [278.4, -4.40597], [278.5, -4.11338], [278.6, -3.8237], [278.7, -3.53691], [278.8, -3.25296], [278.9, -2.97185], [279, -2.69353], [279.1, -2.41798], [279.2, -2.14517], [279.3, -1.87507], [279.4, -1.60767], [279.5, -1.34292], [279.6, -1.08081], [279.7, -0.821304], [279.8, -0.564382], [279.9, -0.310017], [280, -0.0581821], [280.1, 0.191147], [280.2, 0.437995], [280.3, 0.682387], [280.4, 0.924347], [280.5, 1.1639], [280.6, 1.40107], [280.7, 1.63588], [280.8, 1.86835], [280.9, 2.09851], [281, 2.32638], [281.1, 2.55198], [281.2, 2.77534], [281.3, 2.99648], [281.4, 3.21541], [281.5, 3.43217], [281.6, 3.64677], [281.7, 3.85923], [281.8, 4.06958], [281.9, 4.27784], [282, 4.48403], [282.1, 4.68816], [282.2, 4.89026], [282.3, 5.09036], [282.4, 5.28846], [282.5, 5.48459], [282.6, 5.67876], [282.7, 5.87101], [282.8, 6.06134], [282.9, 6.24978], [283, 6.43635], [283.1, 6.62106], [283.2, 6.80393], [283.3, 6.98498], [283.4, 7.16423], [283.5, 7.34169], [283.6, 7.51739], [283.7, 7.69135], [283.8, 7.86357], [283.9, 8.03407], [284, 8.20289], [284.1, 8.37002], [284.2, 8.53549], [284.3, 8.69931], [284.4, 8.8615], [284.5, 9.02208], [284.6, 9.18106], [284.7, 9.33846], [284.8, 9.49429], [284.9, 9.64857], [285, 9.80132], [285.1, 9.95254], [285.2, 10.1023], [285.3, 10.2505], [285.4, 10.3973], [285.5, 10.5426], [285.6, 10.6864], [285.7, 10.8288], [285.8, 10.9698], [285.9, 11.1094], [286, 11.2476], [286.1, 11.3845], [286.2, 11.5199], [286.3, 11.6541], [286.4, 11.7869], [286.5, 11.9183], [286.6, 12.0485], [286.7, 12.1774], [286.8, 12.305], [286.9, 12.4313], [287, 12.5563], [287.1, 12.6801], [287.2, 12.8027], [287.3, 12.9241], [287.4, 13.0442], [287.5, 13.1632], [287.6, 13.281], [287.7, 13.3976], [287.8, 13.513], [287.9, 13.6273], [288, 13.7405], [288.1, 13.8525], [288.2, 13.9634], [288.3, 14.0732], [288.4, 14.182], [288.5, 14.2896], [288.6, 14.3962], [288.7, 14.5017], [288.8, 14.6061], [288.9, 14.7096], [289, 14.8119], [289.1, 14.9133], [289.2, 15.0137], [289.3, 15.113], [289.4, 15.2114], [289.5, 15.3088], [289.6, 15.4052], [289.7, 15.5007], [289.8, 15.5952], [289.9, 15.6888], [290, 15.7815], [290.1, 15.8732], [290.2, 15.964], [290.3, 16.0539], [290.4, 16.1429], [290.5, 16.231], [290.6, 16.3183], [290.7, 16.4047], [290.8, 16.4902], [290.9, 16.5749], [291, 16.6587], [291.1, 16.7417], [291.2, 16.8239], [291.3, 16.9052], [291.4, 16.9858], [291.5, 17.0655], [291.6, 17.1445], [291.7, 17.2226], [291.8, 17.3], [291.9, 17.3766], [292, 17.4525], [292.1, 17.5276], [292.2, 17.6019], [292.3, 17.6755], [292.4, 17.7484], [292.5, 17.8206], [292.6, 17.892], [292.7, 17.9627], [292.8, 18.0327], [292.9, 18.1021], [293, 18.1707], [293.1, 18.2387], [293.2, 18.3059], [293.3, 18.3725], [293.4, 18.4385], [293.5, 18.5038], [293.6, 18.5684], [293.7, 18.6324], [293.8, 18.6958], [293.9, 18.7585], [294, 18.8206], [294.1, 18.8821], [294.2, 18.9429], [294.3, 19.0032], [294.4, 19.0629], [294.5, 19.122], [294.6, 19.1804], [294.7, 19.2383], [294.8, 19.2957], [294.9, 19.3524], [295, 19.4086], [295.1, 19.4643], [295.2, 19.5193], [295.3, 19.5739], [295.4, 19.6279], [295.5, 19.6813], [295.6, 19.7342], [295.7, 19.7866], [295.8, 19.8385], [295.9, 19.8899], [296, 19.9407], [296.1, 19.991], [296.2, -5], [296.2, -5], [296.2, -5], [296.2, -5], [296.2, -5], [296.2, -5], [296.2, -5], [296.2, -5], [296.2, -5], [296.2, -5], [296.2, -5], [296.2, -5], [296.2, -5], [296.2, -5], [296.2, -5], [296.2, -5], [296.2, -5], [296.2, -5], [296.2, -5], [296.2, -5], [296.2, -5], [296.2, -5], [296.2, -5], [296.2, -5], [296.2, -5], [296.2, -5], [296.2, -5], [296.2, -5], [296.2, -5], [296.2, -5], [296.2, -5], [296.2, -5], [296.2, -5], [296.2, -5], [296.2, -5], [296.2, -5], [296.2, -5], [296.2, -5], [296.2, -5], [296.2, -5], [296.2, -5], [296.2, -5], [296.2, -5], [296.2, -5], [296.2, -5], [296.2, -5], [296.2, -5], [296.2, -5], [296.2, -5], [296.2, -5], [296.2, -5], [296.2, -5], [296.3, -4.7015], [296.4, -4.40597], [296.5, -4.11338], [296.6, -3.8237], [296.7, -3.53691], [296.8, -3.25296], [296.9, -2.97185], [297, -2.69353], [297.1, -2.41798], [297.2, -2.14517], [297.3, -1.87507], [297.4, -1.60767], [297.5, -1.34292], [297.6, -1.08081], [297.7, -0.821304], [297.8, -0.564382], [297.9, -0.310017], [298, -0.0581821], [298.1, 0.191147], [298.2, 0.437995], [298.3, 0.682387], [298.4, 0.924347], [298.5, 1.1639], [298.6, 1.40107], [298.7, 1.63588], [298.8, 1.86835], [298.9, 2.09851], [299, 2.32638], [299.1, 2.55198], [299.2, 2.77534], [299.3, 2.99648], [299.4, 3.21541], [299.5, 3.43217], [299.6, 3.64677], [299.7, 3.85923], [299.8, 4.06958], [299.9, 4.27784], [300, 4.48403], [300.1, 4.68816], [300.2, 4.89026], [300.3, 5.09036], [300.4, 5.28846], [300.5, 5.48459], [300.6, 5.67876], [300.7, 5.87101], [300.8, 6.06134], [300.9, 6.24978], [301, 6.43635], [301.1, 6.62106], [301.2, 6.80393], [301.3, 6.98498], [301.4, 7.16423], [301.5, 7.34169], [301.6, 7.51739], [301.7, 7.69135], [301.8, 7.86357], [301.9, 8.03407], [302, 8.20289], [302.1, 8.37002], [302.2, 8.53549], [302.3, 8.69931], [302.4, 8.8615], [302.5, 9.02208], [302.6, 9.18106], [302.7, 9.33846], [302.8, 9.49429], [302.9, 9.64857], [303, 9.80132], [303.1, 9.95254], [303.2, 10.1023], [303.3, 10.2505], [303.4, 10.3973], [303.5, 10.5426], [303.6, 10.6864], [303.7, 10.8288], [303.8, 10.9698], [303.9, 11.1094], [304, 11.2476], [304.1, 11.3845], [304.2, 11.5199], [304.3, 11.6541], [304.4, 11.7869], [304.5, 11.9183], [304.6, 12.0485], [304.7, 12.1774], [304.8, 12.305], [304.9, 12.4313], [305, 12.5563], [305.1, 12.6801], [305.2, 12.8027], [305.3, 12.9241], [305.4, 13.0442], [305.5, 13.1632], [305.6, 13.281], [305.7, 13.3976], [305.8, 13.513], [305.9, 13.6273], [306, 13.7405], [306.1, 13.8525], [306.2, 13.9634], [306.3, 14.0732], [306.4, 14.182], [306.5, 14.2896], [306.6, 14.3962], [306.7, 14.5017], [306.8, 14.6061], [306.9, 14.7096], [307, 14.8119], [307.1, 14.9133], [307.2, 15.0137], [307.3, 15.113], [307.4, 15.2114], [307.5, 15.3088], [307.6, 15.4052], [307.7, 15.5007], [307.8, 15.5952], [307.9, 15.6888], [308, 15.7815], [308.1, 15.8732], [308.2, 15.964], [308.3, 16.0539], [308.4, 16.1429], [308.5, 16.231], [308.6, 16.3183], [308.7, 16.4047], [308.8, 16.4902], [308.9, 16.5749], [309, 16.6587], [309.1, 16.7417], [309.2, 16.8239], [309.3, 16.9052], [309.4, 16.9858], [309.5, 17.0655], [309.6, 17.1445], [309.7, 17.2226], [309.8, 17.3], [309.9, 17.3766], [310, 17.4525], [310.1, 17.5276], [310.2, 17.6019], [310.3, 17.6755], [310.4, 17.7484], [310.5, 17.8206], [310.6, 17.892], [310.7, 17.9627], [310.8, 18.0327], [310.9, 18.1021], [311, 18.1707], [311.1, 18.2387], [311.2, 18.3059], [311.3, 18.3725], [311.4, 18.4385], [311.5, 18.5038], [311.6, 18.5684], [311.7, 18.6324], [311.8, 18.6958], [311.9, 18.7585], [312, 18.8206], [312.1, 18.8821], [312.2, 18.9429], [312.3, 19.0032], [312.4, 19.0629], [312.5, 19.122], [312.6, 19.1804], [312.7, 19.2383], [312.8, 19.2957], [312.9, 19.3524], [313, 19.4086], [313.1, 19.4643], [313.2, 19.5193], [313.3, 19.5739], [313.4, 19.6279], [313.5, 19.6813], [313.6, 19.7342], [313.7, 19.7866], [313.8, 19.8385], [313.9, 19.8899], [314, 19.9407], [314.1, 19.991], [314.2, -5], [314.2, -5], [314.2, -5], [314.2, -5], [314.2, -5], [314.2, -5], [314.2, -5], [314.2, -5], [314.2, -5], [314.2, -5], [314.2, -5], [314.2, -5], [314.2, -5], [314.2, -5], [314.2, -5], [314.2, -5], [314.2, -5], [314.2, -5], [314.2, -5], [314.2, -5], [314.2, -5], [314.2, -5], [314.2, -5], [314.2, -5], [314.2, -5], [314.2, -5], [314.2, -5], [314.2, -5], [314.2, -5], [314.2, -5], [314.2, -5], [314.2, -5], [314.2, -5], [314.2, -5], [314.2, -5], [314.2, -5], [314.2, -5], [314.2, -5], [314.2, -5], [314.2, -5], [314.2, -5], [314.2, -5], [314.2, -5], [314.2, -5], [314.2, -5], [314.2, -5], [314.2, -5], [314.2, -5], [314.2, -5], [314.2, -5], [314.2, -5], [314.2, -5], [314.3, -4.7015], [314.4, -4.40597], [314.5, -4.11338], [314.6, -3.8237], [314.7, -3.53691], [314.8, -3.25296], [314.9, -2.97185], [315, -2.69353], [315.1, -2.41798], [315.2, -2.14517], [315.3, -1.87507], [315.4, -1.60767], [315.5, -1.34292], [315.6, -1.08081], [315.7, -0.821304], [315.8, -0.564382], [315.9, -0.310017], [316, -0.0581821], [316.1, 0.191147], [316.2, 0.437995], [316.3, 0.682387], [316.4, 0.924347], [316.5, 1.1639], [316.6, 1.40107], [316.7, 1.63588], [316.8, 1.86835], [316.9, 2.09851], [317, 2.32638], [317.1, 2.55198], [317.2, 2.77534], [317.3, 2.99648], [317.4, 3.21541], [317.5, 3.43217], [317.6, 3.64677], [317.7, 3.85923], [317.8, 4.06958], [317.9, 4.27784], [318, 4.48403], [318.1, 4.68816], [318.2, 4.89026], [318.3, 5.09036], [318.4, 5.28846], [318.5, 5.48459], [318.6, 5.67876], [318.7, 5.87101], [318.8, 6.06134], [318.9, 6.24978], [319, 6.43635], [319.1, 6.62106], [319.2, 6.80393], [319.3, 6.98498], [319.4, 7.16423], [319.5, 7.34169], [319.6, 7.51739], [319.7, 7.69135], [319.8, 7.86357], [319.9, 8.03407], [320, 8.20289], [320.1, 8.37002], [320.2, 8.53549], [320.3, 8.69931], [320.4, 8.8615], [320.5, 9.02208], [320.6, 9.18106], [320.7, 9.33846], [320.8, 9.49429], [320.9, 9.64857], [321, 9.80132], [321.1, 9.95254], [321.2, 10.1023], [321.3, 10.2505], [321.4, 10.3973], [321.5, 10.5426], [321.6, 10.6864], [321.7, 10.8288], [321.8, 10.9698], [321.9, 11.1094], [322, 11.2476], [322.1, 11.3845], [322.2, 11.5199], [322.3, 11.6541], [322.4, 11.7869], [322.5, 11.9183], [322.6, 12.0485], [322.7, 12.1774], [322.8, 12.305], [322.9, 12.4313], [323, 12.5563], [323.1, 12.6801], [323.2, 12.8027], [323.3, 12.9241], [323.4, 13.0442], [323.5, 13.1632], [323.6, 13.281], [323.7, 13.3976], [323.8, 13.513], [323.9, 13.6273], [324, 13.7405], [324.1, 13.8525], [324.2, 13.9634], [324.3, 14.0732], [324.4, 14.182], [324.5, 14.2896], [324.6, 14.3962], [324.7, 14.5017], [324.8, 14.6061], [324.9, 14.7096], [325, 14.8119], [325.1, 14.9133], [325.2, 15.0137], [325.3, 15.113], [325.4, 15.2114], [325.5, 15.3088], [325.6, 15.4052], [325.7, 15.5007], [325.8, 15.5952], [325.9, 15.6888], [326, 15.7815], [326.1, 15.8732], [326.2, 15.964], [326.3, 16.0539], [326.4, 16.1429], [326.5, 16.231], [326.6, 16.3183], [326.7, 16.4047], [326.8, 16.4902], [326.9, 16.5749], [327, 16.6587], [327.1, 16.7417], [327.2, 16.8239], [327.3, 16.9052], [327.4, 16.9858], [327.5, 17.0655], [327.6, 17.1445], [327.7, 17.2226], [327.8, 17.3], [327.9, 17.3766], [328, 17.4525], [328.1, 17.5276], [328.2, 17.6019], [328.3, 17.6755], [328.4, 17.7484], [328.5, 17.8206], [328.6, 17.892], [328.7, 17.9627], [328.8, 18.0327], [328.9, 18.1021], [329, 18.1707], [329.1, 18.2387], [329.2, 18.3059], [329.3, 18.3725], [329.4, 18.4385], [329.5, 18.5038], [329.6, 18.5684], [329.7, 18.6324], [329.8, 18.6958], [329.9, 18.7585], [330, 18.8206], [330.1, 18.8821], [330.2, 18.9429], [330.3, 19.0032], [330.4, 19.0629], [330.5, 19.122], [330.6, 19.1804], [330.7, 19.2383], [330.8, 19.2957], [330.9, 19.3524], [331, 19.4086], [331.1, 19.4643], [331.2, 19.5193], [331.3, 19.5739], [331.4, 19.6279], [331.5, 19.6813], [331.6, 19.7342], [331.7, 19.7866], [331.8, 19.8385], [331.9, 19.8899], [332, 19.9407], [332.1, 19.991], [332.2, -5], [332.2, -5], [332.2, -5], [332.2, -5], [332.2, -5], [332.2, -5], [332.2, -5], [332.2, -5], [332.2, -5], [332.2, -5], [332.2, -5], [332.2, -5], [332.2, -5], [332.2, -5], [332.2, -5], [332.2, -5], [332.2, -5], [332.2, -5], [332.2, -5], [332.2, -5], [332.2, -5], [332.2, -5], [332.2, -5], [332.2, -5], [332.2, -5], [332.2, -5], [332.2, -5], [332.2, -5], [332.2, -5], [332.2, -5], [332.2, -5], [332.2, -5], [332.2, -5], [332.2, -5], [332.2, -5], [332.2, -5], [332.2, -5], [332.2, -5], [332.2, -5], [332.2, -5], [332.2, -5], [332.2, -5], [332.2, -5], [332.2, -5], [332.2, -5], [332.2, -5], [332.2, -5], [332.2, -5], [332.2, -5], [332.2, -5], [332.2, -5], [332.2, -5], [332.3, -4.7015], [332.4, -4.40597], [332.5, -4.11338], [332.6, -3.8237], [332.7, -3.53691], [332.8, -3.25296], [332.9, -2.97185], [333, -2.69353], [333.1, -2.41798], [333.2, -2.14517], [333.3, -1.87507], [333.4, -1.60767], [333.5, -1.34292], [333.6, -1.08081], [333.7, -0.821304], [333.8, -0.564382], [333.9, -0.310017], [334, -0.0581821], [334.1, 0.191147], [334.2, 0.437995], [334.3, 0.682387], [334.4, 0.924347], [334.5, 1.1639], [334.6, 1.40107], [334.7, 1.63588], [334.8, 1.86835], [334.9, 2.09851], [335, 2.32638], [335.1, 2.55198], [335.2, 2.77534], [335.3, 2.99648], [335.4, 3.21541], [335.5, 3.43217], [335.6, 3.64677], [335.7, 3.85923], [335.8, 4.06958], [335.9, 4.27784], [336, 4.48403], [336.1, 4.68816], [336.2, 4.89026], [336.3, 5.09036], [336.4, 5.28846], [336.5, 5.48459], [336.6, 5.67876], [336.7, 5.87101], [336.8, 6.06134], [336.9, 6.24978], [337, 6.43635], [337.1, 6.62106], [337.2, 6.80393], [337.3, 6.98498], [337.4, 7.16423], [337.5, 7.34169], [337.6, 7.51739], [337.7, 7.69135], [337.8, 7.86357], [337.9, 8.03407], [338, 8.20289], [338.1, 8.37002], [338.2, 8.53549], [338.3, 8.69931], [338.4, 8.8615], [338.5, 9.02208], [338.6, 9.18106], [338.7, 9.33846], [338.8, 9.49429], [338.9, 9.64857], [339, 9.80132], [339.1, 9.95254], [339.2, 10.1023], [339.3, 10.2505], [339.4, 10.3973], [339.5, 10.5426], [339.6, 10.6864], [339.7, 10.8288], [339.8, 10.9698], [339.9, 11.1094], [340, 11.2476], [340.1, 11.3845], [340.2, 11.5199], [340.3, 11.6541], [340.4, 11.7869], [340.5, 11.9183], [340.6, 12.0485], [340.7, 12.1774], [340.8, 12.305], [340.9, 12.4313], [341, 12.5563], [341.1, 12.6801], [341.2, 12.8027], [341.3, 12.9241], [341.4, 13.0442], [341.5, 13.1632], [341.6, 13.281], [341.7, 13.3976], [341.8, 13.513], [341.9, 13.6273], [342, 13.7405], [342.1, 13.8525], [342.2, 13.9634], [342.3, 14.0732], [342.4, 14.182], [342.5, 14.2896], [342.6, 14.3962], [342.7, 14.5017], [342.8, 14.6061], [342.9, 14.7096], [343, 14.8119], [343.1, 14.9133], [343.2, 15.0137], [343.3, 15.113], [343.4, 15.2114], [343.5, 15.3088], [343.6, 15.4052], [343.7, 15.5007], [343.8, 15.5952], [343.9, 15.6888], [344, 15.7815], [344.1, 15.8732], [344.2, 15.964], [344.3, 16.0539], [344.4, 16.1429], [344.5, 16.231], [344.6, 16.3183], [344.7, 16.4047], [344.8, 16.4902], [344.9, 16.5749], [345, 16.6587], [345.1, 16.7417], [345.2, 16.8239], [345.3, 16.9052], [345.4, 16.9858], [345.5, 17.0655], [345.6, 17.1445], [345.7, 17.2226], [345.8, 17.3], [345.9, 17.3766], [346, 17.4525], [346.1, 17.5276], [346.2, 17.6019], [346.3, 17.6755], [346.4, 17.7484], [346.5, 17.8206], [346.6, 17.892], [346.7, 17.9627], [346.8, 18.0327], [346.9, 18.1021], [347, 18.1707], [347.1, 18.2387], [347.2, 18.3059], [347.3, 18.3725], [347.4, 18.4385], [347.5, 18.5038], [347.6, 18.5684], [347.7, 18.6324], [347.8, 18.6958], [347.9, 18.7585], [348, 18.8206], [348.1, 18.8821], [348.2, 18.9429], [348.3, 19.0032], [348.4, 19.0629], [348.5, 19.122], [348.6, 19.1804], [348.7, 19.2383], [348.8, 19.2957], [348.9, 19.3524], [349, 19.4086], [349.1, 19.4643], [349.2, 19.5193], [349.3, 19.5739], [349.4, 19.6279], [349.5, 19.6813], [349.6, 19.7342], [349.7, 19.7866], [349.8, 19.8385], [349.9, 19.8899], [350, 19.9407], [350.1, 19.991], [350.2, -5], [350.2, -5], [350.2, -5], [350.2, -5], [350.2, -5], [350.2, -5], [350.2, -5], [350.2, -5], [350.2, -5], [350.2, -5], [350.2, -5], [350.2, -5], [350.2, -5], [350.2, -5], [350.2, -5], [350.2, -5], [350.2, -5], [350.2, -5], [350.2, -5], [350.2, -5], [350.2, -5], [350.2, -5], [350.2, -5], [350.2, -5], [350.2, -5], [350.2, -5], [350.2, -5], [350.2, -5], [350.2, -5], [350.2, -5], [350.2, -5], [350.2, -5], [350.2, -5], [350.2, -5], [350.2, -5], [350.2, -5], [350.2, -5], [350.2, -5], [350.2, -5], [350.2, -5], [350.2, -5], [350.2, -5], [350.2, -5], [350.2, -5], [350.2, -5], [350.2, -5], [350.2, -5], [350.2, -5], [350.2, -5], [350.2, -5], [350.2, -5], [350.2, -5], [350.3, -4.7015], [350.4, -4.40597], [350.5, -4.11338], [350.6, -3.8237], [350.7, -3.53691], [350.8, -3.25296], [350.9, -2.97185], [351, -2.69353], [351.1, -2.41798], [351.2, -2.14517], [351.3, -1.87507], [351.4, -1.60767], [351.5, -1.34292], [351.6, -1.08081], [351.7, -0.821304], [351.8, -0.564382], [351.9, -0.310017], [352, -0.0581821], [352.1, 0.191147], [352.2, 0.437995], [352.3, 0.682387], [352.4, 0.924347], [352.5, 1.1639], [352.6, 1.40107], [352.7, 1.63588], [352.8, 1.86835], [352.9, 2.09851], [353, 2.32638], [353.1, 2.55198], [353.2, 2.77534], [353.3, 2.99648], [353.4, 3.21541], [353.5, 3.43217], [353.6, 3.64677], [353.7, 3.85923], [353.8, 4.06958], [353.9, 4.27784], [354, 4.48403], [354.1, 4.68816], [354.2, 4.89026], [354.3, 5.09036], [354.4, 5.28846], [354.5, 5.48459], [354.6, 5.67876], [354.7, 5.87101], [354.8, 6.06134], [354.9, 6.24978], [355, 6.43635], [355.1, 6.62106], [355.2, 6.80393], [355.3, 6.98498], [355.4, 7.16423], [355.5, 7.34169], [355.6, 7.51739], [355.7, 7.69135], [355.8, 7.86357], [355.9, 8.03407], [356, 8.20289], [356.1, 8.37002], [356.2, 8.53549], [356.3, 8.69931], [356.4, 8.8615], [356.5, 9.02208], [356.6, 9.18106], [356.7, 9.33846], [356.8, 9.49429], [356.9, 9.64857], [357, 9.80132], [357.1, 9.95254], [357.2, 10.1023], [357.3, 10.2505], [357.4, 10.3973], [357.5, 10.5426], [357.6, 10.6864], [357.7, 10.8288], [357.8, 10.9698], [357.9, 11.1094], [358, 11.2476], [358.1, 11.3845], [358.2, 11.5199], [358.3, 11.6541], [358.4, 11.7869], [358.5, 11.9183], [358.6, 12.0485], [358.7, 12.1774], [358.8, 12.305], [358.9, 12.4313], [359, 12.5563], [359.1, 12.6801], [359.2, 12.8027], [359.3, 12.9241], [359.4, 13.0442], [359.5, 13.1632], [359.6, 13.281], [359.7, 13.3976], [359.8, 13.513], [359.9, 13.6273], [360, 13.7405], [360.1, 13.8525], [360.2, 13.9634], [360.3, 14.0732], [360.4, 14.182], [360.5, 14.2896], [360.6, 14.3962], [360.7, 14.5017], [360.8, 14.6061], [360.9, 14.7096], [361, 14.8119], [361.1, 14.9133], [361.2, 15.0137], [361.3, 15.113], [361.4, 15.2114], [361.5, 15.3088], [361.6, 15.4052], [361.7, 15.5007], [361.8, 15.5952], [361.9, 15.6888], [362, 15.7815], [362.1, 15.8732], [362.2, 15.964], [362.3, 16.0539], [362.4, 16.1429], [362.5, 16.231], [362.6, 16.3183], [362.7, 16.4047], [362.8, 16.4902], [362.9, 16.5749], [363, 16.6587], [363.1, 16.7417], [363.2, 16.8239], [363.3, 16.9052], [363.4, 16.9858], [363.5, 17.0655], [363.6, 17.1445], [363.7, 17.2226], [363.8, 17.3], [363.9, 17.3766], [364, 17.4525], [364.1, 17.5276], [364.2, 17.6019], [364.3, 17.6755], [364.4, 17.7484], [364.5, 17.8206], [364.6, 17.892], [364.7, 17.9627], [364.8, 18.0327], [364.9, 18.1021], [365, 18.1707], [365.1, 18.2387], [365.2, 18.3059], [365.3, 18.3725], [365.4, 18.4385], [365.5, 18.5038], [365.6, 18.5684], [365.7, 18.6324], [365.8, 18.6958], [365.9, 18.7585], [366, 18.8206], [366.1, 18.8821], [366.2, 18.9429], [366.3, 19.0032], [366.4, 19.0629], [366.5, 19.122], [366.6, 19.1804], [366.7, 19.2383], [366.8, 19.2957], [366.9, 19.3524], [367, 19.4086], [367.1, 19.4643], [367.2, 19.5193], [367.3, 19.5739], [367.4, 19.6279], [367.5, 19.6813], [367.6, 19.7342], [367.7, 19.7866], [367.8, 19.8385], [367.9, 19.8899], [368, 19.9407], [368.1, 19.991], [368.2, -5], [368.2, -5], [368.2, -5], [368.2, -5], [368.2, -5], [368.2, -5], [368.2, -5], [368.2, -5], [368.2, -5], [368.2, -5], [368.2, -5], [368.2, -5], [368.2, -5], [368.2, -5], [368.2, -5], [368.2, -5], [368.2, -5], [368.2, -5], [368.2, -5], [368.2, -5], [368.2, -5], [368.2, -5], [368.2, -5], [368.2, -5], [368.2, -5], [368.2, -5], [368.2, -5], [368.2, -5], [368.2, -5], [368.2, -5], [368.2, -5], [368.2, -5], [368.2, -5], [368.2, -5], [368.2, -5], [368.2, -5], [368.2, -5], [368.2, -5], [368.2, -5], [368.2, -5], [368.2, -5], [368.2, -5], [368.2, -5], [368.2, -5], [368.2, -5], [368.2, -5], [368.2, -5], [368.2, -5], [368.2, -5], [368.2, -5], [368.2, -5], [368.2, -5], [368.3, -4.7015], [368.4, -4.40597], [368.5, -4.11338], [368.6, -3.8237], [368.7, -3.53691], [368.8, -3.25296], [368.9, -2.97185], [369, -2.69353], [369.1, -2.41798], [369.2, -2.14517], [369.3, -1.87507], [369.4, -1.60767], [369.5, -1.34292], [369.6, -1.08081], [369.7, -0.821304], [369.8, -0.564382], [369.9, -0.310017], [370, -0.0581821], [370.1, 0.191147], [370.2, 0.437995], [370.3, 0.682387], [370.4, 0.924347], [370.5, 1.1639], [370.6, 1.40107], [370.7, 1.63588], [370.8, 1.86835], [370.9, 2.09851], [371, 2.32638], [371.1, 2.55198], [371.2, 2.77534], [371.3, 2.99648], [371.4, 3.21541], [371.5, 3.43217], [371.6, 3.64677], [371.7, 3.85923], [371.8, 4.06958], [371.9, 4.27784], [372, 4.48403], [372.1, 4.68816], [372.2, 4.89026], [372.3, 5.09036], [372.4, 5.28846], [372.5, 5.48459], [372.6, 5.67876], [372.7, 5.87101], [372.8, 6.06134], [372.9, 6.24978], [373, 6.43635], [373.1, 6.62106], [373.2, 6.80393], [373.3, 6.98498], [373.4, 7.16423], [373.5, 7.34169], [373.6, 7.51739], [373.7, 7.69135], [373.8, 7.86357], [373.9, 8.03407], [374, 8.20289], [374.1, 8.37002], [374.2, 8.53549], [374.3, 8.69931], [374.4, 8.8615], [374.5, 9.02208], [374.6, 9.18106], [374.7, 9.33846], [374.8, 9.49429], [374.9, 9.64857], [375, 9.80132], [375.1, 9.95254], [375.2, 10.1023], [375.3, 10.2505], [375.4, 10.3973], [375.5, 10.5426], [375.6, 10.6864], [375.7, 10.8288], [375.8, 10.9698], [375.9, 11.1094], [376, 11.2476], [376.1, 11.3845], [376.2, 11.5199], [376.3, 11.6541], [376.4, 11.7869], [376.5, 11.9183], [376.6, 12.0485], [376.7, 12.1774], [376.8, 12.305], [376.9, 12.4313], [377, 12.5563], [377.1, 12.6801], [377.2, 12.8027], [377.3, 12.9241], [377.4, 13.0442], [377.5, 13.1632], [377.6, 13.281], [377.7, 13.3976], [377.8, 13.513], [377.9, 13.6273], [378, 13.7405], [378.1, 13.8525], [378.2, 13.9634], [378.3, 14.0732], [378.4, 14.182], [378.5, 14.2896], [378.6, 14.3962], [378.7, 14.5017], [378.8, 14.6061], [378.9, 14.7096], [379, 14.8119], [379.1, 14.9133], [379.2, 15.0137], [379.3, 15.113], [379.4, 15.2114], [379.5, 15.3088], [379.6, 15.4052], [379.7, 15.5007], [379.8, 15.5952], [379.9, 15.6888], [380, 15.7815], [380.1, 15.8732], [380.2, 15.964], [380.3, 16.0539], [380.4, 16.1429], [380.5, 16.231], [380.6, 16.3183], [380.7, 16.4047], [380.8, 16.4902], [380.9, 16.5749], [381, 16.6587], [381.1, 16.7417], [381.2, 16.8239], [381.3, 16.9052], [381.4, 16.9858], [381.5, 17.0655], [381.6, 17.1445], [381.7, 17.2226], [381.8, 17.3], [381.9, 17.3766], [382, 17.4525], [382.1, 17.5276], [382.2, 17.6019], [382.3, 17.6755], [382.4, 17.7484], [382.5, 17.8206], [382.6, 17.892], [382.7, 17.9627], [382.8, 18.0327], [382.9, 18.1021], [383, 18.1707], [383.1, 18.2387], [383.2, 18.3059], [383.3, 18.3725], [383.4, 18.4385], [383.5, 18.5038], [383.6, 18.5684], [383.7, 18.6324], [383.8, 18.6958], [383.9, 18.7585], [384, 18.8206], [384.1, 18.8821], [384.2, 18.9429], [384.3, 19.0032], [384.4, 19.0629], [384.5, 19.122], [384.6, 19.1804], [384.7, 19.2383], [384.8, 19.2957], [384.9, 19.3524], [385, 19.4086], [385.1, 19.4643], [385.2, 19.5193], [385.3, 19.5739], [385.4, 19.6279], [385.5, 19.6813], [385.6, 19.7342], [385.7, 19.7866], [385.8, 19.8385], [385.9, 19.8899], [386, 19.9407], [386.1, 19.991], [386.2, -5], [386.2, -5], [386.2, -5], [386.2, -5], [386.2, -5], [386.2, -5], [386.2, -5], [386.2, -5], [386.2, -5], [386.2, -5], [386.2, -5], [386.2, -5], [386.2, -5], [386.2, -5], [386.2, -5], [386.2, -5], [386.2, -5], [386.2, -5], [386.2, -5], [386.2, -5], [386.2, -5], [386.2, -5], [386.2, -5], [386.2, -5], [386.2, -5], [386.2, -5], [386.2, -5], [386.2, -5], [386.2, -5], [386.2, -5], [386.2, -5], [386.2, -5], [386.2, -5], [386.2, -5], [386.2, -5], [386.2, -5], [386.2, -5], [386.2, -5], [386.2, -5], [386.2, -5], [386.2, -5], [386.2, -5], [386.2, -5], [386.2, -5], [386.2, -5], [386.2, -5], [386.2, -5], [386.2, -5], [386.2, -5], [386.2, -5], [386.2, -5], [386.2, -5], [386.3, -4.7015], [386.4, -4.40597], [386.5, -4.11338], [386.6, -3.8237], [386.7, -3.53691], [386.8, -3.25296], [386.9, -2.97185], [387, -2.69353], [387.1, -2.41798], [387.2, -2.14517], [387.3, -1.87507], [387.4, -1.60767], [387.5, -1.34292], [387.6, -1.08081], [387.7, -0.821304], [387.8, -0.564382], [387.9, -0.310017], [388, -0.0581821], [388.1, 0.191147], [388.2, 0.437995], [388.3, 0.682387], [388.4, 0.924347], [388.5, 1.1639], [388.6, 1.40107], [388.7, 1.63588], [388.8, 1.86835], [388.9, 2.09851], [389, 2.32638], [389.1, 2.55198], [389.2, 2.77534], [389.3, 2.99648], [389.4, 3.21541], [389.5, 3.43217], [389.6, 3.64677], [389.7, 3.85923], [389.8, 4.06958], [389.9, 4.27784], [390, 4.48403], [390.1, 4.68816], [390.2, 4.89026], [390.3, 5.09036], [390.4, 5.28846], [390.5, 5.48459], [390.6, 5.67876], [390.7, 5.87101], [390.8, 6.06134], [390.9, 6.24978], [391, 6.43635], [391.1, 6.62106], [391.2, 6.80393], [391.3, 6.98498], [391.4, 7.16423], [391.5, 7.34169], [391.6, 7.51739], [391.7, 7.69135], [391.8, 7.86357], [391.9, 8.03407], [392, 8.20289], [392.1, 8.37002], [392.2, 8.53549], [392.3, 8.69931], [392.4, 8.8615], [392.5, 9.02208], [392.6, 9.18106], [392.7, 9.33846], [392.8, 9.49429], [392.9, 9.64857], [393, 9.80132], [393.1, 9.95254], [393.2, 10.1023], [393.3, 10.2505], [393.4, 10.3973], [393.5, 10.5426], [393.6, 10.6864], [393.7, 10.8288], [393.8, 10.9698], [393.9, 11.1094], [394, 11.2476], [394.1, 11.3845], [394.2, 11.5199], [394.3, 11.6541], [394.4, 11.7869], [394.5, 11.9183], [394.6, 12.0485], [394.7, 12.1774], [394.8, 12.305], [394.9, 12.4313], [395, 12.5563], [395.1, 12.6801], [395.2, 12.8027], [395.3, 12.9241], [395.4, 13.0442], [395.5, 13.1632], [395.6, 13.281], [395.7, 13.3976], [395.8, 13.513], [395.9, 13.6273], [396, 13.7405], [396.1, 13.8525], [396.2, 13.9634], [396.3, 14.0732], [396.4, 14.182], [396.5, 14.2896], [396.6, 14.3962], [396.7, 14.5017], [396.8, 14.6061], [396.9, 14.7096], [397, 14.8119], [397.1, 14.9133], [397.2, 15.0137], [397.3, 15.113], [397.4, 15.2114], [397.5, 15.3088], [397.6, 15.4052], [397.7, 15.5007], [397.8, 15.5952], [397.9, 15.6888], [398, 15.7815], [398.1, 15.8732], [398.2, 15.964], [398.3, 16.0539], [398.4, 16.1429], [398.5, 16.231], [398.6, 16.3183], [398.7, 16.4047], [398.8, 16.4902], [398.9, 16.5749], [399, 16.6587], [399.1, 16.7417], [399.2, 16.8239], [399.3, 16.9052], [399.4, 16.9858], [399.5, 17.0655], [399.6, 17.1445], [399.7, 17.2226], [399.8, 17.3], [399.9, 17.3766], [400, 17.4525], [400.1, 17.5276], [400.2, 17.6019], [400.3, 17.6755], [400.4, 17.7484], [400.5, 17.8206], [400.6, 17.892], [400.7, 17.9627], [400.8, 18.0327], [400.9, 18.1021], [401, 18.1707], [401.1, 18.2387], [401.2, 18.3059], [401.3, 18.3725], [401.4, 18.4385], [401.5, 18.5038], [401.6, 18.5684], [401.7, 18.6324], [401.8, 18.6958], [401.9, 18.7585], [402, 18.8206], [402.1, 18.8821], [402.2, 18.9429], [402.3, 19.0032], [402.4, 19.0629], [402.5, 19.122], [402.6, 19.1804], [402.7, 19.2383], [402.8, 19.2957], [402.9, 19.3524], [403, 19.4086], [403.1, 19.4643], [403.2, 19.5193], [403.3, 19.5739], [403.4, 19.6279], [403.5, 19.6813], [403.6, 19.7342], [403.7, 19.7866], [403.8, 19.8385], [403.9, 19.8899], [404, 19.9407], [404.1, 19.991], [404.2, -5], [404.2, -5], [404.2, -5], [404.2, -5], [404.2, -5], [404.2, -5], [404.2, -5], [404.2, -5], [404.2, -5], [404.2, -5], [404.2, -5], [404.2, -5], [404.2, -5], [404.2, -5], [404.2, -5], [404.2, -5], [404.2, -5], [404.2, -5], [404.2, -5], [404.2, -5], [404.2, -5], [404.2, -5], [404.2, -5], [404.2, -5], [404.2, -5], [404.2, -5], [404.2, -5], [404.2, -5], [404.2, -5], [404.2, -5], [404.2, -5], [404.2, -5], [404.2, -5], [404.2, -5], [404.2, -5], [404.2, -5], [404.2, -5], [404.2, -5], [404.2, -5], [404.2, -5], [404.2, -5], [404.2, -5], [404.2, -5], [404.2, -5], [404.2, -5], [404.2, -5], [404.2, -5], [404.2, -5], [404.2, -5], [404.2, -5], [404.2, -5], [404.2, -5], [404.3, -4.7015], [404.4, -4.40597], [404.5, -4.11338], [404.6, -3.8237], [404.7, -3.53691], [404.8, -3.25296], [404.9, -2.97185], [405, -2.69353], [405.1, -2.41798], [405.2, -2.14517], [405.3, -1.87507], [405.4, -1.60767], [405.5, -1.34292], [405.6, -1.08081], [405.7, -0.821304], [405.8, -0.564382], [405.9, -0.310017], [406, -0.0581821], [406.1, 0.191147], [406.2, 0.437995], [406.3, 0.682387], [406.4, 0.924347], [406.5, 1.1639], [406.6, 1.40107], [406.7, 1.63588], [406.8, 1.86835], [406.9, 2.09851], [407, 2.32638], [407.1, 2.55198], [407.2, 2.77534], [407.3, 2.99648], [407.4, 3.21541], [407.5, 3.43217], [407.6, 3.64677], [407.7, 3.85923], [407.8, 4.06958], [407.9, 4.27784], [408, 4.48403], [408.1, 4.68816], [408.2, 4.89026], [408.3, 5.09036], [408.4, 5.28846], [408.5, 5.48459], [408.6, 5.67876], [408.7, 5.87101], [408.8, 6.06134], [408.9, 6.24978], [409, 6.43635], [409.1, 6.62106], [409.2, 6.80393], [409.3, 6.98498], [409.4, 7.16423], [409.5, 7.34169], [409.6, 7.51739], [409.7, 7.69135], [409.8, 7.86357], [409.9, 8.03407], [410, 8.20289], [410.1, 8.37002], [410.2, 8.53549], [410.3, 8.69931], [410.4, 8.8615], [410.5, 9.02208], [410.6, 9.18106], [410.7, 9.33846], [410.8, 9.49429], [410.9, 9.64857], [411, 9.80132], [411.1, 9.95254], [411.2, 10.1023], [411.3, 10.2505], [411.4, 10.3973], [411.5, 10.5426], [411.6, 10.6864], [411.7, 10.8288], [411.8, 10.9698], [411.9, 11.1094], [412, 11.2476], [412.1, 11.3845], [412.2, 11.5199], [412.3, 11.6541], [412.4, 11.7869], [412.5, 11.9183], [412.6, 12.0485], [412.7, 12.1774], [412.8, 12.305], [412.9, 12.4313], [413, 12.5563], [413.1, 12.6801], [413.2, 12.8027], [413.3, 12.9241], [413.4, 13.0442], [413.5, 13.1632], [413.6, 13.281], [413.7, 13.3976], [413.8, 13.513], [413.9, 13.6273], [414, 13.7405], [414.1, 13.8525], [414.2, 13.9634], [414.3, 14.0732], [414.4, 14.182], [414.5, 14.2896], [414.6, 14.3962], [414.7, 14.5017], [414.8, 14.6061], [414.9, 14.7096], [415, 14.8119], [415.1, 14.9133], [415.2, 15.0137], [415.3, 15.113], [415.4, 15.2114], [415.5, 15.3088], [415.6, 15.4052], [415.7, 15.5007], [415.8, 15.5952], [415.9, 15.6888], [416, 15.7815], [416.1, 15.8732], [416.2, 15.964], [416.3, 16.0539], [416.4, 16.1429], [416.5, 16.231], [416.6, 16.3183], [416.7, 16.4047], [416.8, 16.4902], [416.9, 16.5749], [417, 16.6587], [417.1, 16.7417], [417.2, 16.8239], [417.3, 16.9052], [417.4, 16.9858], [417.5, 17.0655], [417.6, 17.1445], [417.7, 17.2226], [417.8, 17.3], [417.9, 17.3766], [418, 17.4525], [418.1, 17.5276], [418.2, 17.6019], [418.3, 17.6755], [418.4, 17.7484], [418.5, 17.8206], [418.6, 17.892], [418.7, 17.9627], [418.8, 18.0327], [418.9, 18.1021], [419, 18.1707], [419.1, 18.2387], [419.2, 18.3059], [419.3, 18.3725], [419.4, 18.4385], [419.5, 18.5038], [419.6, 18.5684], [419.7, 18.6324], [419.8, 18.6958], [419.9, 18.7585], [420, 18.8206], [420.1, 18.8821], [420.2, 18.9429], [420.3, 19.0032], [420.4, 19.0629], [420.5, 19.122], [420.6, 19.1804], [420.7, 19.2383], [420.8, 19.2957], [420.9, 19.3524], [421, 19.4086], [421.1, 19.4643], [421.2, 19.5193], [421.3, 19.5739], [421.4, 19.6279], [421.5, 19.6813], [421.6, 19.7342], [421.7, 19.7866], [421.8, 19.8385], [421.9, 19.8899], [422, 19.9407], [422.1, 19.991], [422.2, -5], [422.2, -5], [422.2, -5], [422.2, -5], [422.2, -5], [422.2, -5], [422.2, -5], [422.2, -5], [422.2, -5], [422.2, -5], [422.2, -5], [422.2, -5], [422.2, -5], [422.2, -5], [422.2, -5], [422.2, -5], [422.2, -5], [422.2, -5], [422.2, -5], [422.2, -5], [422.2, -5], [422.2, -5], [422.2, -5], [422.2, -5], [422.2, -5], [422.2, -5], [422.2, -5], [422.2, -5], [422.2, -5], [422.2, -5], [422.2, -5], [422.2, -5], [422.2, -5], [422.2, -5], [422.2, -5], [422.2, -5], [422.2, -5], [422.2, -5], [422.2, -5], [422.2, -5], [422.2, -5], [422.2, -5], [422.2, -5], [422.2, -5], [422.2, -5], [422.2, -5], [422.2, -5], [422.2, -5], [422.2, -5], [422.2, -5], [422.2, -5], [422.2, -5], [422.3, -4.7015], [422.4, -4.40597], [422.5, -4.11338], [422.6, -3.8237], [422.7, -3.53691], [422.8, -3.25296], [422.9, -2.97185], [423, -2.69353], [423.1, -2.41798], [423.2, -2.14517], [423.3, -1.87507], [423.4, -1.60767], [423.5, -1.34292], [423.6, -1.08081], [423.7, -0.821304], [423.8, -0.564382], [423.9, -0.310017], [424, -0.0581821], [424.1, 0.191147], [424.2, 0.437995], [424.3, 0.682387], [424.4, 0.924347], [424.5, 1.1639], [424.6, 1.40107], [424.7, 1.63588], [424.8, 1.86835], [424.9, 2.09851], [425, 2.32638], [425.1, 2.55198], [425.2, 2.77534], [425.3, 2.99648], [425.4, 3.21541], [425.5, 3.43217], [425.6, 3.64677], [425.7, 3.85923], [425.8, 4.06958], [425.9, 4.27784], [426, 4.48403], [426.1, 4.68816], [426.2, 4.89026], [426.3, 5.09036], [426.4, 5.28846], [426.5, 5.48459], [426.6, 5.67876], [426.7, 5.87101], [426.8, 6.06134], [426.9, 6.24978], [427, 6.43635], [427.1, 6.62106], [427.2, 6.80393], [427.3, 6.98498], [427.4, 7.16423], [427.5, 7.34169], [427.6, 7.51739], [427.7, 7.69135], [427.8, 7.86357], [427.9, 8.03407], [428, 8.20289], [428.1, 8.37002], [428.2, 8.53549], [428.3, 8.69931], [428.4, 8.8615], [428.5, 9.02208], [428.6, 9.18106], [428.7, 9.33846], [428.8, 9.49429], [428.9, 9.64857], [429, 9.80132], [429.1, 9.95254], [429.2, 10.1023], [429.3, 10.2505], [429.4, 10.3973], [429.5, 10.5426], [429.6, 10.6864], [429.7, 10.8288], [429.8, 10.9698], [429.9, 11.1094], [430, 11.2476], [430.1, 11.3845], [430.2, 11.5199], [430.3, 11.6541], [430.4, 11.7869], [430.5, 11.9183], [430.6, 12.0485], [430.7, 12.1774], [430.8, 12.305], [430.9, 12.4313], [431, 12.5563], [431.1, 12.6801], [431.2, 12.8027], [431.3, 12.9241], [431.4, 13.0442], [431.5, 13.1632], [431.6, 13.281], [431.7, 13.3976], [431.8, 13.513], [431.9, 13.6273], [432, 13.7405], [432.1, 13.8525], [432.2, 13.9634], [432.3, 14.0732], [432.4, 14.182], [432.5, 14.2896], [432.6, 14.3962], [432.7, 14.5017], [432.8, 14.6061], [432.9, 14.7096], [433, 14.8119], [433.1, 14.9133], [433.2, 15.0137], [433.3, 15.113], [433.4, 15.2114], [433.5, 15.3088], [433.6, 15.4052], [433.7, 15.5007], [433.8, 15.5952], [433.9, 15.6888], [434, 15.7815], [434.1, 15.8732], [434.2, 15.964], [434.3, 16.0539], [434.4, 16.1429], [434.5, 16.231], [434.6, 16.3183], [434.7, 16.4047], [434.8, 16.4902], [434.9, 16.5749], [435, 16.6587], [435.1, 16.7417], [435.2, 16.8239], [435.3, 16.9052], [435.4, 16.9858], [435.5, 17.0655], [435.6, 17.1445], [435.7, 17.2226], [435.8, 17.3], [435.9, 17.3766], [436, 17.4525], [436.1, 17.5276], [436.2, 17.6019], [436.3, 17.6755], [436.4, 17.7484], [436.5, 17.8206], [436.6, 17.892], [436.7, 17.9627], [436.8, 18.0327], [436.9, 18.1021], [437, 18.1707], [437.1, 18.2387], [437.2, 18.3059], [437.3, 18.3725], [437.4, 18.4385], [437.5, 18.5038], [437.6, 18.5684], [437.7, 18.6324], [437.8, 18.6958], [437.9, 18.7585], [438, 18.8206], [438.1, 18.8821], [438.2, 18.9429], [438.3, 19.0032], [438.4, 19.0629], [438.5, 19.122], [438.6, 19.1804], [438.7, 19.2383], [438.8, 19.2957], [438.9, 19.3524], [439, 19.4086], [439.1, 19.4643], [439.2, 19.5193], [439.3, 19.5739], [439.4, 19.6279], [439.5, 19.6813], [439.6, 19.7342], [439.7, 19.7866], [439.8, 19.8385], [439.9, 19.8899], [440, 19.9407], [440.1, 19.991], [440.2, -5], [440.2, -5], [440.2, -5], [440.2, -5], [440.2, -5], [440.2, -5], [440.2, -5], [440.2, -5], [440.2, -5], [440.2, -5], [440.2, -5], [440.2, -5], [440.2, -5], [440.2, -5], [440.2, -5], [440.2, -5], [440.2, -5], [440.2, -5], [440.2, -5], [440.2, -5], [440.2, -5], [440.2, -5], [440.2, -5], [440.2, -5], [440.2, -5], [440.2, -5], [440.2, -5], [440.2, -5], [440.2, -5], [440.2, -5], [440.2, -5], [440.2, -5], [440.2, -5], [440.2, -5], [440.2, -5], [440.2, -5], [440.2, -5], [440.2, -5], [440.2, -5], [440.2, -5], [440.2, -5], [440.2, -5], [440.2, -5], [440.2, -5], [440.2, -5], [440.2, -5], [440.2, -5], [440.2, -5], [440.2, -5], [440.2, -5], [440.2, -5], [440.2, -5], [440.3, -4.7015], [440.4, -4.40597], [440.5, -4.11338], [440.6, -3.8237], [440.7, -3.53691], [440.8, -3.25296], [440.9, -2.97185], [441, -2.69353], [441.1, -2.41798], [441.2, -2.14517], [441.3, -1.87507], [441.4, -1.60767], [441.5, -1.34292], [441.6, -1.08081], [441.7, -0.821304], [441.8, -0.564382], [441.9, -0.310017], [442, -0.0581821], [442.1, 0.191147], [442.2, 0.437995], [442.3, 0.682387], [442.4, 0.924347], [442.5, 1.1639], [442.6, 1.40107], [442.7, 1.63588], [442.8, 1.86835], [442.9, 2.09851], [443, 2.32638], [443.1, 2.55198], [443.2, 2.77534], [443.3, 2.99648], [443.4, 3.21541], [443.5, 3.43217], [443.6, 3.64677], [443.7, 3.85923], [443.8, 4.06958], [443.9, 4.27784], [444, 4.48403], [444.1, 4.68816], [444.2, 4.89026], [444.3, 5.09036], [444.4, 5.28846], [444.5, 5.48459], [444.6, 5.67876], [444.7, 5.87101], [444.8, 6.06134], [444.9, 6.24978], [445, 6.43635], [445.1, 6.62106], [445.2, 6.80393], [445.3, 6.98498], [445.4, 7.16423], [445.5, 7.34169], [445.6, 7.51739], [445.7, 7.69135], [445.8, 7.86357], [445.9, 8.03407], [446, 8.20289], [446.1, 8.37002], [446.2, 8.53549], [446.3, 8.69931], [446.4, 8.8615], [446.5, 9.02208], [446.6, 9.18106], [446.7, 9.33846], [446.8, 9.49429], [446.9, 9.64857], [447, 9.80132], [447.1, 9.95254], [447.2, 10.1023], [447.3, 10.2505], [447.4, 10.3973], [447.5, 10.5426], [447.6, 10.6864], [447.7, 10.8288], [447.8, 10.9698], [447.9, 11.1094], [448, 11.2476], [448.1, 11.3845], [448.2, 11.5199], [448.3, 11.6541], [448.4, 11.7869], [448.5, 11.9183], [448.6, 12.0485], [448.7, 12.1774], [448.8, 12.305], [448.9, 12.4313], [449, 12.5563], [449.1, 12.6801], [449.2, 12.8027], [449.3, 12.9241], [449.4, 13.0442], [449.5, 13.1632], [449.6, 13.281], [449.7, 13.3976], [449.8, 13.513], [449.9, 13.6273], [450, 13.7405], [450.1, 13.8525], [450.2, 13.9634], [450.3, 14.0732], [450.4, 14.182], [450.5, 14.2896], [450.6, 14.3962], [450.7, 14.5017], [450.8, 14.6061], [450.9, 14.7096], [451, 14.8119], [451.1, 14.9133], [451.2, 15.0137], [451.3, 15.113], [451.4, 15.2114], [451.5, 15.3088], [451.6, 15.4052], [451.7, 15.5007], [451.8, 15.5952], [451.9, 15.6888], [452, 15.7815], [452.1, 15.8732], [452.2, 15.964], [452.3, 16.0539], [452.4, 16.1429], [452.5, 16.231], [452.6, 16.3183], [452.7, 16.4047], [452.8, 16.4902], [452.9, 16.5749], [453, 16.6587], [453.1, 16.7417], [453.2, 16.8239], [453.3, 16.9052], [453.4, 16.9858], [453.5, 17.0655], [453.6, 17.1445], [453.7, 17.2226], [453.8, 17.3], [453.9, 17.3766], [454, 17.4525], [454.1, 17.5276], [454.2, 17.6019], [454.3, 17.6755], [454.4, 17.7484], [454.5, 17.8206], [454.6, 17.892], [454.7, 17.9627], [454.8, 18.0327], [454.9, 18.1021], [455, 18.1707], [455.1, 18.2387], [455.2, 18.3059], [455.3, 18.3725], [455.4, 18.4385], [455.5, 18.5038], [455.6, 18.5684], [455.7, 18.6324], [455.8, 18.6958], [455.9, 18.7585], [456, 18.8206], [456.1, 18.8821], [456.2, 18.9429], [456.3, 19.0032], [456.4, 19.0629], [456.5, 19.122], [456.6, 19.1804], [456.7, 19.2383], [456.8, 19.2957], [456.9, 19.3524], [457, 19.4086], [457.1, 19.4643], [457.2, 19.5193], [457.3, 19.5739], [457.4, 19.6279], [457.5, 19.6813], [457.6, 19.7342], [457.7, 19.7866], [457.8, 19.8385], [457.9, 19.8899], [458, 19.9407], [458.1, 19.991], [458.2, -5], [458.2, -5], [458.2, -5], [458.2, -5], [458.2, -5], [458.2, -5], [458.2, -5], [458.2, -5], [458.2, -5], [458.2, -5], [458.2, -5], [458.2, -5], [458.2, -5], [458.2, -5], [458.2, -5], [458.2, -5], [458.2, -5], [458.2, -5], [458.2, -5], [458.2, -5], [458.2, -5], [458.2, -5], [458.2, -5], [458.2, -5], [458.2, -5], [458.2, -5], [458.2, -5], [458.2, -5], [458.2, -5], [458.2, -5], [458.2, -5], [458.2, -5], [458.2, -5], [458.2, -5], [458.2, -5], [458.2, -5], [458.2, -5], [458.2, -5], [458.2, -5], [458.2, -5], [458.2, -5], [458.2, -5], [458.2, -5], [458.2, -5], [458.2, -5], [458.2, -5], [458.2, -5], [458.2, -5], [458.2, -5], [458.2, -5], [458.2, -5], [458.2, -5], [458.3, -4.7015], [458.4, -4.40597], [458.5, -4.11338], [458.6, -3.8237], [458.7, -3.53691], [458.8, -3.25296], [458.9, -2.97185], [459, -2.69353], [459.1, -2.41798], [459.2, -2.14517], [459.3, -1.87507], [459.4, -1.60767], [459.5, -1.34292], [459.6, -1.08081], [459.7, -0.821304], [459.8, -0.564382], [459.9, -0.310017], [460, -0.0581821], [460.1, 0.191147], [460.2, 0.437995], [460.3, 0.682387], [460.4, 0.924347], [460.5, 1.1639], [460.6, 1.40107], [460.7, 1.63588], [460.8, 1.86835], [460.9, 2.09851], [461, 2.32638], [461.1, 2.55198], [461.2, 2.77534], [461.3, 2.99648], [461.4, 3.21541], [461.5, 3.43217], [461.6, 3.64677], [461.7, 3.85923], [461.8, 4.06958], [461.9, 4.27784], [462, 4.48403], [462.1, 4.68816], [462.2, 4.89026], [462.3, 5.09036], [462.4, 5.28846], [462.5, 5.48459], [462.6, 5.67876], [462.7, 5.87101], [462.8, 6.06134], [462.9, 6.24978], [463, 6.43635], [463.1, 6.62106], [463.2, 6.80393], [463.3, 6.98498], [463.4, 7.16423], [463.5, 7.34169], [463.6, 7.51739], [463.7, 7.69135], [463.8, 7.86357], [463.9, 8.03407], [464, 8.20289], [464.1, 8.37002], [464.2, 8.53549], [464.3, 8.69931], [464.4, 8.8615], [464.5, 9.02208], [464.6, 9.18106], [464.7, 9.33846], [464.8, 9.49429], [464.9, 9.64857], [465, 9.80132], [465.1, 9.95254], [465.2, 10.1023], [465.3, 10.2505], [465.4, 10.3973], [465.5, 10.5426], [465.6, 10.6864], [465.7, 10.8288], [465.8, 10.9698], [465.9, 11.1094], [466, 11.2476], [466.1, 11.3845], [466.2, 11.5199], [466.3, 11.6541], [466.4, 11.7869], [466.5, 11.9183], [466.6, 12.0485], [466.7, 12.1774], [466.8, 12.305], [466.9, 12.4313], [467, 12.5563], [467.1, 12.6801], [467.2, 12.8027], [467.3, 12.9241], [467.4, 13.0442], [467.5, 13.1632], [467.6, 13.281], [467.7, 13.3976], [467.8, 13.513], [467.9, 13.6273], [468, 13.7405], [468.1, 13.8525], [468.2, 13.9634], [468.3, 14.0732], [468.4, 14.182], [468.5, 14.2896], [468.6, 14.3962], [468.7, 14.5017], [468.8, 14.6061], [468.9, 14.7096], [469, 14.8119], [469.1, 14.9133], [469.2, 15.0137], [469.3, 15.113], [469.4, 15.2114], [469.5, 15.3088], [469.6, 15.4052], [469.7, 15.5007], [469.8, 15.5952], [469.9, 15.6888], [470, 15.7815], [470.1, 15.8732], [470.2, 15.964], [470.3, 16.0539], [470.4, 16.1429], [470.5, 16.231], [470.6, 16.3183], [470.7, 16.4047], [470.8, 16.4902], [470.9, 16.5749], [471, 16.6587], [471.1, 16.7417], [471.2, 16.8239], [471.3, 16.9052], [471.4, 16.9858], [471.5, 17.0655], [471.6, 17.1445], [471.7, 17.2226], [471.8, 17.3], [471.9, 17.3766], [472, 17.4525], [472.1, 17.5276], [472.2, 17.6019], [472.3, 17.6755], [472.4, 17.7484], [472.5, 17.8206], [472.6, 17.892], [472.7, 17.9627], [472.8, 18.0327], [472.9, 18.1021], [473, 18.1707], [473.1, 18.2387], [473.2, 18.3059], [473.3, 18.3725], [473.4, 18.4385], [473.5, 18.5038], [473.6, 18.5684], [473.7, 18.6324], [473.8, 18.6958], [473.9, 18.7585], [474, 18.8206], [474.1, 18.8821], [474.2, 18.9429], [474.3, 19.0032], [474.4, 19.0629], [474.5, 19.122], [474.6, 19.1804], [474.7, 19.2383], [474.8, 19.2957], [474.9, 19.3524], [475, 19.4086], [475.1, 19.4643], [475.2, 19.5193], [475.3, 19.5739], [475.4, 19.6279], [475.5, 19.6813], [475.6, 19.7342], [475.7, 19.7866], [475.8, 19.8385], [475.9, 19.8899], [476, 19.9407], [476.1, 19.991], [476.2, -5], [476.2, -5], [476.2, -5], [476.2, -5], [476.2, -5], [476.2, -5], [476.2, -5], [476.2, -5], [476.2, -5], [476.2, -5], [476.2, -5], [476.2, -5], [476.2, -5], [476.2, -5], [476.2, -5], [476.2, -5], [476.2, -5], [476.2, -5], [476.2, -5], [476.2, -5], [476.2, -5], [476.2, -5], [476.2, -5], [476.2, -5], [476.2, -5], [476.2, -5], [476.2, -5], [476.2, -5], [476.2, -5], [476.2, -5], [476.2, -5], [476.2, -5], [476.2, -5], [476.2, -5], [476.2, -5], [476.2, -5], [476.2, -5], [476.2, -5], [476.2, -5], [476.2, -5], [476.2, -5], [476.2, -5], [476.2, -5], [476.2, -5], [476.2, -5], [476.2, -5], [476.2, -5], [476.2, -5], [476.2, -5], [476.2, -5], [476.2, -5], [476.2, -5], [476.3, -4.7015], [476.4, -4.40597], [476.5, -4.11338], [476.6, -3.8237], [476.7, -3.53691], [476.8, -3.25296], [476.9, -2.97185], [477, -2.69353], [477.1, -2.41798], [477.2, -2.14517], [477.3, -1.87507], [477.4, -1.60767], [477.5, -1.34292], [477.6, -1.08081], [477.7, -0.821304], [477.8, -0.564382], [477.9, -0.310017], [478, -0.0581821], [478.1, 0.191147], [478.2, 0.437995], [478.3, 0.682387], [478.4, 0.924347], [478.5, 1.1639], [478.6, 1.40107], [478.7, 1.63588], [478.8, 1.86835], [478.9, 2.09851], [479, 2.32638], [479.1, 2.55198], [479.2, 2.77534], [479.3, 2.99648], [479.4, 3.21541], [479.5, 3.43217], [479.6, 3.64677], [479.7, 3.85923], [479.8, 4.06958], [479.9, 4.27784], [480, 4.48403], [480.1, 4.68816], [480.2, 4.89026], [480.3, 5.09036], [480.4, 5.28846], [480.5, 5.48459], [480.6, 5.67876], [480.7, 5.87101], [480.8, 6.06134], [480.9, 6.24978], [481, 6.43635], [481.1, 6.62106], [481.2, 6.80393], [481.3, 6.98498], [481.4, 7.16423], [481.5, 7.34169], [481.6, 7.51739], [481.7, 7.69135], [481.8, 7.86357], [481.9, 8.03407], [482, 8.20289], [482.1, 8.37002], [482.2, 8.53549], [482.3, 8.69931], [482.4, 8.8615], [482.5, 9.02208], [482.6, 9.18106], [482.7, 9.33846], [482.8, 9.49429], [482.9, 9.64857], [483, 9.80132], [483.1, 9.95254], [483.2, 10.1023], [483.3, 10.2505], [483.4, 10.3973], [483.5, 10.5426], [483.6, 10.6864], [483.7, 10.8288], [483.8, 10.9698], [483.9, 11.1094], [484, 11.2476], [484.1, 11.3845], [484.2, 11.5199], [484.3, 11.6541], [484.4, 11.7869], [484.5, 11.9183], [484.6, 12.0485], [484.7, 12.1774], [484.8, 12.305], [484.9, 12.4313], [485, 12.5563], [485.1, 12.6801], [485.2, 12.8027], [485.3, 12.9241], [485.4, 13.0442], [485.5, 13.1632], [485.6, 13.281], [485.7, 13.3976], [485.8, 13.513], [485.9, 13.6273], [486, 13.7405], [486.1, 13.8525], [486.2, 13.9634], [486.3, 14.0732], [486.4, 14.182], [486.5, 14.2896], [486.6, 14.3962], [486.7, 14.5017], [486.8, 14.6061], [486.9, 14.7096], [487, 14.8119], [487.1, 14.9133], [487.2, 15.0137], [487.3, 15.113], [487.4, 15.2114], [487.5, 15.3088], [487.6, 15.4052], [487.7, 15.5007], [487.8, 15.5952], [487.9, 15.6888], [488, 15.7815], [488.1, 15.8732], [488.2, 15.964], [488.3, 16.0539], [488.4, 16.1429], [488.5, 16.231], [488.6, 16.3183], [488.7, 16.4047], [488.8, 16.4902], [488.9, 16.5749], [489, 16.6587], [489.1, 16.7417], [489.2, 16.8239], [489.3, 16.9052], [489.4, 16.9858], [489.5, 17.0655], [489.6, 17.1445], [489.7, 17.2226], [489.8, 17.3], [489.9, 17.3766], [490, 17.4525], [490.1, 17.5276], [490.2, 17.6019], [490.3, 17.6755], [490.4, 17.7484], [490.5, 17.8206], [490.6, 17.892], [490.7, 17.9627], [490.8, 18.0327], [490.9, 18.1021], [491, 18.1707], [491.1, 18.2387], [491.2, 18.3059], [491.3, 18.3725], [491.4, 18.4385], [491.5, 18.5038], [491.6, 18.5684], [491.7, 18.6324], [491.8, 18.6958], [491.9, 18.7585], [492, 18.8206], [492.1, 18.8821], [492.2, 18.9429], [492.3, 19.0032], [492.4, 19.0629], [492.5, 19.122], [492.6, 19.1804], [492.7, 19.2383], [492.8, 19.2957], [492.9, 19.3524], [493, 19.4086], [493.1, 19.4643], [493.2, 19.5193], [493.3, 19.5739], [493.4, 19.6279], [493.5, 19.6813], [493.6, 19.7342], [493.7, 19.7866], [493.8, 19.8385], [493.9, 19.8899], [494, 19.9407], [494.1, 19.991], [494.2, -5], [494.2, -5], [494.2, -5], [494.2, -5], [494.2, -5], [494.2, -5], [494.2, -5], [494.2, -5], [494.2, -5], [494.2, -5], [494.2, -5], [494.2, -5], [494.2, -5], [494.2, -5], [494.2, -5], [494.2, -5], [494.2, -5], [494.2, -5], [494.2, -5], [494.2, -5], [494.2, -5], [494.2, -5], [494.2, -5], [494.2, -5], [494.2, -5], [494.2, -5], [494.2, -5], [494.2, -5], [494.2, -5], [494.2, -5], [494.2, -5], [494.2, -5], [494.2, -5], [494.2, -5], [494.2, -5], [494.2, -5], [494.2, -5], [494.2, -5], [494.2, -5], [494.2, -5], [494.2, -5], [494.2, -5], [494.2, -5], [494.2, -5], [494.2, -5], [494.2, -5], [494.2, -5], [494.2, -5], [494.2, -5], [494.2, -5], [494.2, -5], [494.2, -5], [494.3, -4.7015], [494.4, -4.40597], [494.5, -4.11338], [494.6, -3.8237], [494.7, -3.53691], [494.8, -3.25296], [494.9, -2.97185], [495, -2.69353], [495.1, -2.41798], [495.2, -2.14517], [495.3, -1.87507], [495.4, -1.60767], [495.5, -1.34292], [495.6, -1.08081], [495.7, -0.821304], [495.8, -0.564382], [495.9, -0.310017], [496, -0.0581821], [496.1, 0.191147], [496.2, 0.437995], [496.3, 0.682387], [496.4, 0.924347], [496.5, 1.1639], [496.6, 1.40107], [496.7, 1.63588], [496.8, 1.86835], [496.9, 2.09851], [497, 2.32638], [497.1, 2.55198], [497.2, 2.77534], [497.3, 2.99648], [497.4, 3.21541], [497.5, 3.43217], [497.6, 3.64677], [497.7, 3.85923], [497.8, 4.06958], [497.9, 4.27784], [498, 4.48403], [498.1, 4.68816], [498.2, 4.89026], [498.3, 5.09036], [498.4, 5.28846], [498.5, 5.48459], [498.6, 5.67876], [498.7, 5.87101], [498.8, 6.06134], [498.9, 6.24978], [499, 6.43635], [499.1, 6.62106], [499.2, 6.80393], [499.3, 6.98498], [499.4, 7.16423], [499.5, 7.34169], [499.6, 7.51739], [499.7, 7.69135], [499.8, 7.86357], [499.9, 8.03407], [500, 8.20289]])
+
+plt.figure()
+plt.plot(data.T[0,:], data.T[1,:])
+plt.xlabel('ms')
+plt.ylabel('mV')
+plt.title('Leaky Integrate and Fire Neuron')
+plt.show()
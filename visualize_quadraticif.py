@@ -0,0 +1,13 @@
+#!/usr/bin/env python
+
+import numpy as np
+import matplotlib.pyplot as plt
+
+data = np.array([[0, 0], [0.1, 0], [0.2, 0], [0.3, 0], [0.4, 0], [0.5, 0], [0.6, 0], [0.7, 0], [0.8, 0], [0.9, 0], [1, 0], [1.1, 0], [1.2, 0], [1.3, 0], [1.4, 0], [1.5, 0], [1.6, 0], [1.7, 0], [1.8, 0], [1.9, 0], [2, 0], [2.1, 0], [2.2, 0], [2.3, 0], [2.4, 0], [2.5, 0], [2.6, 0], [2.7, 0], [2.8, 0], [2.9, 0], [3, 0], [3.1, 0], [3.2, 0], [3.3, 0], [3.4, 0], [3.5, 0], [3.6, 0], [3.7, 0], [3.8, 0], [3.9, 0], [4, 0], [4.1, 0], [4.2, 0], [4.3, 0], [4.4, 0], [4.5, 0], [4.6, 0], [4.7, 0], [4.8, 0], [4.9, 0], [5, 0], [5.1, 0], [5.2, 0], [5.3, 0], [5.4, 0], [5.5, 0], [5.6, 0], [5.7, 0], [5.8, 0], [5.9, 0], [6, 0], [6.1, 0], [6.2, 0], [6.3, 0], [6.4, 0], [6.5, 0], [6.6, 0], [6.7, 0], [6.8, 0], [6.9, 0], [7, 0], [7.1, 0], [7.2, 0], [7.3, 0], [7.4, 0], [7.5, 0], [7.6, 0], [7.7, 0], [7.8, 0], [7.9, 0], [8, 0], [8.1, 0], [8.2, 0], [8.3, 0], [8.4, 0], [8.5, 0], [8.6, 0], [8.7, 0], [8.8, 0], [8.9, 0], [9, 0], [9.1, 0], [9.2, 0], [9.3, 0], [9.4, 0], [9.5, 0], [9.6, 0], [9.7, 0], [9.8, 0], [9.9, 0], [10, 0], [10.1, 0.1], [10.2, 0.307097], [10.3, 0.521662], [10.4, 0.74403], [10.5, 0.974557], [10.6, 1.21362], [10.7, 1.46162], [10.8, 1.71897], [10.9, 1.98613], [11, 2.26358], [11.1, 2.55181], [11.2, 2.85138], [11.3, 3.16286], [11.4, 3.48686], [11.5, 3.82404], [11.6, 4.1751], [11.7, 4.5408], [11.8, 4.92193], [11.9, 5.31936], [12, 5.73402], [12.1, 6.1669], [12.2, 6.61909], [12.3, 7.09173], [12.4, 7.58609], [12.5, 8.10351], [12.6, 8.64547], [12.7, 9.21356], [12.8, 9.80951], [12.9, 10.4352], [13, 11.0927], [13.1, 11.7843], [13.2, 12.5124], [13.3, 13.2798], [13.4, 14.0893], [13.5, 14.9444], [13.6, 15.8487], [13.7, 16.8061], [13.8, 17.8212], [13.9, 18.899], [14, -5], [14, -5], [14, -5], [14, -5], [14, -5], [14, -5], [14, -5], [14, -5], [14, -5], [14, -5], [14, -5], [14, -5], [14, -5], [14, -5], [14, -5], [14, -5], [14, -5], [14, -5], [14, -5], [14, -5], [14, -5], [14, -5], [14, -5], [14, -5], [14, -5], [14, -5], [14, -5], [14, -5], [14, -5], [14, -5], [14, -5], [14, -5], [14, -5], [14, -5], [14, -5], [14, -5], [14, -5], [14, -5], [14, -5], [14, -5], [14, -5], [14, -5], [14, -5], [14, -5], [14, -5], [14, -5], [14, -5], [14, -5], [14, -5], [14, -5], [14, -5], [14, -5], [14.1, -4.9569], [14.2, -4.91258], [14.3, -4.867], [14.4, -4.82011], [14.5, -4.77188], [14.6, -4.72226], [14.7, -4.67121], [14.8, -4.61869], [14.9, -4.56465], [15, -4.50905], [15.1, -4.45182], [15.2, -4.39292], [15.3, -4.3323], [15.4, -4.26991], [15.5, -4.20567], [15.6, -4.13954], [15.7, -4.07144], [15.8, -4.00133], [15.9, -3.92912], [16, -3.85475], [16.1, -3.77814], [16.2, -3.69923], [16.3, -3.61793], [16.4, -3.53415], [16.5, -3.44782], [16.6, -3.35885], [16.7, -3.26714], [16.8, -3.1726], [16.9, -3.07513], [17, -2.97461], [17.1, -2.87095], [17.2, -2.76403], [17.3, -2.65373], [17.4, -2.53993], [17.5, -2.42249], [17.6, -2.30127], [17.7, -2.17615], [17.8, -2.04696], [17.9, -1.91356], [18, -1.77577], [18.1, -1.63343], [18.2, -1.48636], [18.3, -1.33437], [18.4, -1.17726], [18.5, -1.01482], [18.6, -0.846831], [18.7, -0.673069], [18.8, -0.493288], [18.9, -0.307233], [19, -0.114636], [19.1, 0.0847891], [19.2, 0.29134], [19.3, 0.505334], [19.4, 0.727106], [19.5, 0.95701], [19.6, 1.19542], [19.7, 1.44273], [19.8, 1.69937], [19.9, 1.96578], [20, 2.24244], [20.1, 2.52985], [20.2, 2.82855], [20.3, 3.13912], [20.4, 3.46216], [20.5, 3.79833], [20.6, 4.14833], [20.7, 4.5129], [20.8, 4.89285], [20.9, 5.28902], [21, 5.70236], [21.1, 6.13384], [21.2, 6.58454], [21.3, 7.05562], [21.4, 7.5483], [21.5, 8.06395], [21.6, 8.60402], [21.7, 9.17009], [21.8, 9.7639], [21.9, 10.3873], [22, 11.0424], [22.1, 11.7313], [22.2, 12.4566], [22.3, 13.2209], [22.4, 14.0272], [22.5, 14.8788], [22.6, 15.7792], [22.7, 16.7325], [22.8, 17.7432], [22.9, 18.8161], [23, 19.9568], [23.1, -5], [23.1, -5], [23.1, -5], [23.1, -5], [23.1, -5], [23.1, -5], [23.1, -5], [23.1, -5], [23.1, -5], [23.1, -5], [23.1, -5], [23.1, -5], [23.1, -5], [23.1, -5], [23.1, -5], [23.1, -5], [23.1, -5], [23.1, -5], [23.1, -5], [23.1, -5], [23.1, -5], [23.1, -5], [23.1, -5], [23.1, -5], [23.1, -5], [23.1, -5], [23.1, -5], [23.1, -5], [23.1, -5], [23.1, -5], [23.1, -5], [23.1, -5], [23.1, -5], [23.1, -5], [23.1, -5], [23.1, -5], [23.1, -5], [23.1, -5], [23.1, -5], [23.1, -5], [23.1, -5], [23.1, -5], [23.1, -5], [23.1, -5], [23.1, -5], [23.1, -5], [23.1, -5], [23.1, -5], [23.1, -5], [23.1, -5], [23.1, -5], [23.1, -5], [23.2, -4.9569], [23.3, -4.91258], [23.4, -4.867], [23.5, -4.82011], [23.6, -4.77188], [23.7, -4.72226], [23.8, -4.67121], [23.9, -4.61869], [24, -4.56465], [24.1, -4.50905], [24.2, -4.45182], [24.3, -4.39292], [24.4, -4.3323], [24.5, -4.26991], [24.6, -4.20567], [24.7, -4.13954], [24.8, -4.07144], [24.9, -4.00133], [25, -3.92912], [25.1, -3.85475], [25.2, -3.77814], [25.3, -3.69923], [25.4, -3.61793], [25.5, -3.53415], [25.6, -3.44782], [25.7, -3.35885], [25.8, -3.26714], [25.9, -3.1726], [26, -3.07513], [26.1, -2.97461], [26.2, -2.87095], [26.3, -2.76403], [26.4, -2.65373], [26.5, -2.53993], [26.6, -2.42249], [26.7, -2.30127], [26.8, -2.17615], [26.9, -2.04696], [27, -1.91356], [27.1, -1.77577], [27.2, -1.63343], [27.3, -1.48636], [27.4, -1.33437], [27.5, -1.17726], [27.6, -1.01482], [27.7, -0.846831], [27.8, -0.673069], [27.9, -0.493288], [28, -0.307233], [28.1, -0.114636], [28.2, 0.0847891], [28.3, 0.29134], [28.4, 0.505334], [28.5, 0.727106], [28.6, 0.95701], [28.7, 1.19542], [28.8, 1.44273], [28.9, 1.69937], [29, 1.96578], [29.1, 2.24244], [29.2, 2.52985], [29.3, 2.82855], [29.4, 3.13912], [29.5, 3.46216], [29.6, 3.79833], [29.7, 4.14833], [29.8, 4.5129], [29.9, 4.89285], [30, 5.28902], [30.1, 5.70236], [30.2, 6.13384], [30.3, 6.58454], [30.4, 7.05562], [30.5, 7.5483], [30.6, 8.06395], [30.7, 8.60402], [30.8, 9.17009], [30.9, 9.7639], [31, 10.3873], [31.1, 11.0424], [31.2, 11.7313], [31.3, 12.4566], [31.4, 13.2209], [31.5, 14.0272], [31.6, 14.8788], [31.7, 15.7792], [31.8, 16.7325], [31.9, 17.7432], [32, 18.8161], [32.1, 19.9568], [32.2, -5], [32.2, -5], [32.2, -5], [32.2, -5], [32.2, -5], [32.2, -5], [32.2, -5], [32.2, -5], [32.2, -5], [32.2, -5], [32.2, -5], [32.2, -5], [32.2, -5], [32.2, -5], [32.2, -5], [32.2, -5], [32.2, -5], [32.2, -5], [32.2, -5], [32.2, -5], [32.2, -5], [32.2, -5], [32.2, -5], [32.2, -5], [32.2, -5], [32.2, -5], [32.2, -5], [32.2, -5], [32.2, -5], [32.2, -5], [32.2, -5], [32.2, -5], [32.2, -5], [32.2, -5], [32.2, -5], [32.2, -5], [32.2, -5], [32.2, -5], [32.2, -5], [32.2, -5], [32.2, -5], [32.2, -5], [32.2, -5], [32.2, -5], [32.2, -5], [32.2, -5], [32.2, -5], [32.2, -5], [32.2, -5], [32.2, -5], [32.2, -5], [32.2, -5], [32.3, -4.9569], [32.4, -4.91258], [32.5, -4.867], [32.6, -4.82011], [32.7, -4.77188], [32.8, -4.72226], [32.9, -4.67121], [33, -4.61869], [33.1, -4.56465], [33.2, -4.50905], [33.3, -4.45182], [33.4, -4.39292], [33.5, -4.3323], [33.6, -4.26991], [33.7, -4.20567], [33.8, -4.13954], [33.9, -4.07144], [34, -4.00133], [34.1, -3.92912], [34.2, -3.85475], [34.3, -3.77814], [34.4, -3.69923], [34.5, -3.61793], [34.6, -3.53415], [34.7, -3.44782], [34.8, -3.35885], [34.9, -3.26714], [35, -3.1726], [35.1, -3.07513], [35.2, -2.97461], [35.3, -2.87095], [35.4, -2.76403], [35.5, -2.65373], [35.6, -2.53993], [35.7, -2.42249], [35.8, -2.30127], [35.9, -2.17615], [36, -2.04696], [36.1, -1.91356], [36.2, -1.77577], [36.3, -1.63343], [36.4, -1.48636], [36.5, -1.33437], [36.6, -1.17726], [36.7, -1.01482], [36.8, -0.846831], [36.9, -0.673069], [37, -0.493288], [37.1, -0.307233], [37.2, -0.114636], [37.3, 0.0847891], [37.4, 0.29134], [37.5, 0.505334], [37.6, 0.727106], [37.7, 0.95701], [37.8, 1.19542], [37.9, 1.44273], [38, 1.69937], [38.1, 1.96578], [38.2, 2.24244], [38.3, 2.52985], [38.4, 2.82855], [38.5, 3.13912], [38.6, 3.46216], [38.7, 3.79833], [38.8, 4.14833], [38.9, 4.5129], [39, 4.89285], [39.1, 5.28902], [39.2, 5.70236], [39.3, 6.13384], [39.4, 6.58454], [39.5, 7.05562], [39.6, 7.5483], [39.7, 8.06395], [39.8, 8.60402], [39.9, 9.17009], [40, 9.7639], [40.1, 10.3873], [40.2, 11.0424], [40.3, 11.7313], [40.4, 12.4566], [40.5, 13.2209], [40.6, 14.0272], [40.7, 14.8788], [40.8, 15.7792], [40.9, 16.7325], [41, 17.7432], [41.1, 18.8161], [41.2, 19.9568], [41.3, -5], [41.3, -5], [41.3, -5], [41.3, -5], [41.3, -5], [41.3, -5], [41.3, -5], [41.3, -5], [41.3, -5], [41.3, -5], [41.3, -5], [41.3, -5], [41.3, -5], [41.3, -5], [41.3, -5], [41.3, -5], [41.3, -5], [41.3, -5], [41.3, -5], [41.3, -5], [41.3, -5], [41.3, -5], [41.3, -5], [41.3, -5], [41.3, -5], [41.3, -5], [41.3, -5], [41.3, -5], [41.3, -5], [41.3, -5], [41.3, -5], [41.3, -5], [41.3, -5], [41.3, -5], [41.3, -5], [41.3, -5], [41.3, -5], [41.3, -5], [41.3, -5], [41.3, -5], [41.3, -5], [41.3, -5], [41.3, -5], [41.3, -5], [41.3, -5], [41.3, -5], [41.3, -5], [41.3, -5], [41.3, -5], [41.3, -5], [41.3, -5], [41.3, -5], [41.4, -4.9569], [41.5, -4.91258], [41.6, -4.867], [41.7, -4.82011], [41.8, -4.77188], [41.9, -4.72226], [42, -4.67121], [42.1, -4.61869], [42.2, -4.56465], [42.3, -4.50905], [42.4, -4.45182], [42.5, -4.39292], [42.6, -4.3323], [42.7, -4.26991], [42.8, -4.20567], [42.9, -4.13954], [43, -4.07144], [43.1, -4.00133], [43.2, -3.92912], [43.3, -3.85475], [43.4, -3.77814], [43.5, -3.69923], [43.6, -3.61793], [43.7, -3.53415], [43.8, -3.44782], [43.9, -3.35885], [44, -3.26714], [44.1, -3.1726], [44.2, -3.07513], [44.3, -2.97461], [44.4, -2.87095], [44.5, -2.76403], [44.6, -2.65373], [44.7, -2.53993], [44.8, -2.42249], [44.9, -2.30127], [45, -2.17615], [45.1, -2.04696], [45.2, -1.91356], [45.3, -1.77577], [45.4, -1.63343], [45.5, -1.48636], [45.6, -1.33437], [45.7, -1.17726], [45.8, -1.01482], [45.9, -0.846831], [46, -0.673069], [46.1, -0.493288], [46.2, -0.307233], [46.3, -0.114636], [46.4, 0.0847891], [46.5, 0.29134], [46.6, 0.505334], [46.7, 0.727106], [46.8, 0.95701], [46.9, 1.19542], [47, 1.44273], [47.1, 1.69937], [47.2, 1.96578], [47.3, 2.24244], [47.4, 2.52985], [47.5, 2.82855], [47.6, 3.13912], [47.7, 3.46216], [47.8, 3.79833], [47.9, 4.14833], [48, 4.5129], [48.1, 4.89285], [48.2, 5.28902], [48.3, 5.70236], [48.4, 6.13384], [48.5, 6.58454], [48.6, 7.05562], [48.7, 7.5483], [48.8, 8.06395], [48.9, 8.60402], [49, 9.17009], [49.1, 9.7639], [49.2, 10.3873], [49.3, 11.0424], [49.4, 11.7313], [49.5, 12.4566], [49.6, 13.2209], [49.7, 14.0272], [49.8, 14.8788], [49.9, 15.7792], [50, 16.7325], [50.1, 17.7432], [50.2, 18.8161], [50.3, 19.9568], [50.4, -5], [50.4, -5], [50.4, -5], [50.4, -5], [50.4, -5], [50.4, -5], [50.4, -5], [50.4, -5], [50.4, -5], [50.4, -5], [50.4, -5], [50.4, -5], [50.4, -5], [50.4, -5], [50.4, -5], [50.4, -5], [50.4, -5], [50.4, -5], [50.4, -5], [50.4, -5], [50.4, -5], [50.4, -5], [50.4, -5], [50.4, -5], [50.4, -5], [50.4, -5], [50.4, -5], [50.4, -5], [50.4, -5], [50.4, -5], [50.4, -5], [50.4, -5], [50.4, -5], [50.4, -5], [50.4, -5], [50.4, -5], [50.4, -5], [50.4, -5], [50.4, -5], [50.4, -5], [50.4, -5], [50.4, -5], [50.4, -5], [50.4, -5], [50.4, -5], [50.4, -5], [50.4, -5], [50.4, -5], [50.4, -5], [50.4, -5], [50.4, -5], [50.4, -5], [50.5, -4.9569], [50.6, -4.91258], [50.7, -4.867], [50.8, -4.82011], [50.9, -4.77188], [51, -4.72226], [51.1, -4.67121], [51.2, -4.61869], [51.3, -4.56465], [51.4, -4.50905], [51.5, -4.45182], [51.6, -4.39292], [51.7, -4.3323], [51.8, -4.26991], [51.9, -4.20567], [52, -4.13954], [52.1, -4.07144], [52.2, -4.00133], [52.3, -3.92912], [52.4, -3.85475], [52.5, -3.77814], [52.6, -3.69923], [52.7, -3.61793], [52.8, -3.53415], [52.9, -3.44782], [53, -3.35885], [53.1, -3.26714], [53.2, -3.1726], [53.3, -3.07513], [53.4, -2.97461], [53.5, -2.87095], [53.6, -2.76403], [53.7, -2.65373], [53.8, -2.53993], [53.9, -2.42249], [54, -2.30127], [54.1, -2.17615], [54.2, -2.04696], [54.3, -1.91356], [54.4, -1.77577], [54.5, -1.63343], [54.6, -1.48636], [54.7, -1.33437], [54.8, -1.17726], [54.9, -1.01482], [55, -0.846831], [55.1, -0.673069], [55.2, -0.493288], [55.3, -0.307233], [55.4, -0.114636], [55.5, 0.0847891], [55.6, 0.29134], [55.7, 0.505334], [55.8, 0.727106], [55.9, 0.95701], [56, 1.19542], [56.1, 1.44273], [56.2, 1.69937], [56.3, 1.96578], [56.4, 2.24244], [56.5, 2.52985], [56.6, 2.82855], [56.7, 3.13912], [56.8, 3.46216], [56.9, 3.79833], [57, 4.14833], [57.1, 4.5129], [57.2, 4.89285], [57.3, 5.28902], [57.4, 5.70236], [57.5, 6.13384], [57.6, 6.58454], [57.7, 7.05562], [57.8, 7.5483], [57.9, 8.06395], [58, 8.60402], [58.1, 9.17009], [58.2, 9.7639], [58.3, 10.3873], [58.4, 11.0424], [58.5, 11.7313], [58.6, 12.4566], [58.7, 13.2209], [58.8, 14.0272], [58.9, 14.8788], [59, 15.7792], [59.1, 16.7325], [59.2, 17.7432], [59.3, 18.8161], [59.4, 19.9568], [59.5, -5], [59.5, -5], [59.5, -5], [59.5, -5], [59.5, -5], [59.5, -5], [59.5, -5], [59.5, -5], [59.5, -5], [59.5, -5], [59.5, -5], [59.5, -5], [59.5, -5], [59.5, -5], [59.5, -5], [59.5, -5], [59.5, -5], [59.5, -5], [59.5, -5], [59.5, -5], [59.5, -5], [59.5, -5], [59.5, -5], [59.5, -5], [59.5, -5], [59.5, -5], [59.5, -5], [59.5, -5], [59.5, -5], [59.5, -5], [59.5, -5], [59.5, -5], [59.5, -5], [59.5, -5], [59.5, -5], [59.5, -5], [59.5, -5], [59.5, -5], [59.5, -5], [59.5, -5], [59.5, -5], [59.5, -5], [59.5, -5], [59.5, -5], [59.5, -5], [59.5, -5], [59.5, -5], [59.5, -5], [59.5, -5], [59.5, -5], [59.5, -5], [59.5, -5], [59.6, -4.9569], [59.7, -4.91258], [59.8, -4.867], [59.9, -4.82011], [60, -4.77188], [60.1, -4.72226], [60.2, -4.67121], [60.3, -4.61869], [60.4, -4.56465], [60.5, -4.50905], [60.6, -4.45182], [60.7, -4.39292], [60.8, -4.3323], [60.9, -4.26991], [61, -4.20567], [61.1, -4.13954], [61.2, -4.07144], [61.3, -4.00133], [61.4, -3.92912], [61.5, -3.85475], [61.6, -3.77814], [61.7, -3.69923], [61.8, -3.61793], [61.9, -3.53415], [62, -3.44782], [62.1, -3.35885], [62.2, -3.26714], [62.3, -3.1726], [62.4, -3.07513], [62.5, -2.97461], [62.6, -2.87095], [62.7, -2.76403], [62.8, -2.65373], [62.9, -2.53993], [63, -2.42249], [63.1, -2.30127], [63.2, -2.17615], [63.3, -2.04696], [63.4, -1.91356], [63.5, -1.77577], [63.6, -1.63343], [63.7, -1.48636], [63.8, -1.33437], [63.9, -1.17726], [64, -1.01482], [64.1, -0.846831], [64.2, -0.673069], [64.3, -0.493288], [64.4, -0.307233], [64.5, -0.114636], [64.6, 0.0847891], [64.7, 0.29134], [64.8, 0.505334], [64.9, 0.727106], [65, 0.95701], [65.1, 1.19542], [65.2, 1.44273], [65.3, 1.69937], [65.4, 1.96578], [65.5, 2.24244], [65.6, 2.52985], [65.7, 2.82855], [65.8, 3.13912], [65.9, 3.46216], [66, 3.79833], [66.1, 4.14833], [66.2, 4.5129], [66.3, 4.89285], [66.4, 5.28902], [66.5, 5.70236], [66.6, 6.13384], [66.7, 6.58454], [66.8, 7.05562], [66.9, 7.5483], [67, 8.06395], [67.1, 8.60402], [67.2, 9.17009], [67.3, 9.7639], [67.4, 10.3873], [67.5, 11.0424], [67.6, 11.7313], [67.7, 12.4566], [67.8, 13.2209], [67.9, 14.0272], [68, 14.8788], [68.1, 15.7792], [68.2, 16.7325], [68.3, 17.7432], [68.4, 18.8161], [68.5, 19.9568], [68.6, -5], [68.6, -5], [68.6, -5], [68.6, -5], [68.6, -5], [68.6, -5], [68.6, -5], [68.6, -5], [68.6, -5], [68.6, -5], [68.6, -5], [68.6, -5], [68.6, -5], [68.6, -5], [68.6, -5], [68.6, -5], [68.6, -5], [68.6, -5], [68.6, -5], [68.6, -5], [68.6, -5], [68.6, -5], [68.6, -5], [68.6, -5], [68.6, -5], [68.6, -5], [68.6, -5], [68.6, -5], [68.6, -5], [68.6, -5], [68.6, -5], [68.6, -5], [68.6, -5], [68.6, -5], [68.6, -5], [68.6, -5], [68.6, -5], [68.6, -5], [68.6, -5], [68.6, -5], [68.6, -5], [68.6, -5], [68.6, -5], [68.6, -5], [68.6, -5], [68.6, -5], [68.6, -5], [68.6, -5], [68.6, -5], [68.6, -5], [68.6, -5], [68.6, -5], [68.7, -4.9569], [68.8, -4.91258], [68.9, -4.867], [69, -4.82011], [69.1, -4.77188], [69.2, -4.72226], [69.3, -4.67121], [69.4, -4.61869], [69.5, -4.56465], [69.6, -4.50905], [69.7, -4.45182], [69.8, -4.39292], [69.9, -4.3323], [70, -4.26991], [70.1, -4.20567], [70.2, -4.13954], [70.3, -4.07144], [70.4, -4.00133], [70.5, -3.92912], [70.6, -3.85475], [70.7, -3.77814], [70.8, -3.69923], [70.9, -3.61793], [71, -3.53415], [71.1, -3.44782], [71.2, -3.35885], [71.3, -3.26714], [71.4, -3.1726], [71.5, -3.07513], [71.6, -2.97461], [71.7, -2.87095], [71.8, -2.76403], [71.9, -2.65373], [72, -2.53993], [72.1, -2.42249], [72.2, -2.30127], [72.3, -2.17615], [72.4, -2.04696], [72.5, -1.91356], [72.6, -1.77577], [72.7, -1.63343], [72.8, -1.48636], [72.9, -1.33437], [73, -1.17726], [73.1, -1.01482], [73.2, -0.846831], [73.3, -0.673069], [73.4, -0.493288], [73.5, -0.307233], [73.6, -0.114636], [73.7, 0.0847891], [73.8, 0.29134], [73.9, 0.505334], [74, 0.727106], [74.1, 0.95701], [74.2, 1.19542], [74.3, 1.44273], [74.4, 1.69937], [74.5, 1.96578], [74.6, 2.24244], [74.7, 2.52985], [74.8, 2.82855], [74.9, 3.13912], [75, 3.46216], [75.1, 3.79833], [75.2, 4.14833], [75.3, 4.5129], [75.4, 4.89285], [75.5, 5.28902], [75.6, 5.70236], [75.7, 6.13384], [75.8, 6.58454], [75.9, 7.05562], [76, 7.5483], [76.1, 8.06395], [76.2, 8.60402], [76.3, 9.17009], [76.4, 9.7639], [76.5, 10.3873], [76.6, 11.0424], [76.7, 11.7313], [76.8, 12.4566], [76.9, 13.2209], [77, 14.0272], [77.1, 14.8788], [77.2, 15.7792], [77.3, 16.7325], [77.4, 17.7432], [77.5, 18.8161], [77.6, 19.9568], [77.7, -5], [77.7, -5], [77.7, -5], [77.7, -5], [77.7, -5], [77.7, -5], [77.7, -5], [77.7, -5], [77.7, -5], [77.7, -5], [77.7, -5], [77.7, -5], [77.7, -5], [77.7, -5], [77.7, -5], [77.7, -5], [77.7, -5], [77.7, -5], [77.7, -5], [77.7, -5], [77.7, -5], [77.7, -5], [77.7, -5], [77.7, -5], [77.7, -5], [77.7, -5], [77.7, -5], [77.7, -5], [77.7, -5], [77.7, -5], [77.7, -5], [77.7, -5], [77.7, -5], [77.7, -5], [77.7, -5], [77.7, -5], [77.7, -5], [77.7, -5], [77.7, -5], [77.7, -5], [77.7, -5], [77.7, -5], [77.7, -5], [77.7, -5], [77.7, -5], [77.7, -5], [77.7, -5], [77.7, -5], [77.7, -5], [77.7, -5], [77.7, -5], [77.7, -5], [77.8, -4.9569], [77.9, -4.91258], [78, -4.867], [78.1, -4.82011], [78.2, -4.77188], [78.3, -4.72226], [78.4, -4.67121], [78.5, -4.61869], [78.6, -4.56465], [78.7, -4.50905], [78.8, -4.45182], [78.9, -4.39292], [79, -4.3323], [79.1, -4.26991], [79.2, -4.20567], [79.3, -4.13954], [79.4, -4.07144], [79.5, -4.00133], [79.6, -3.92912], [79.7, -3.85475], [79.8, -3.77814], [79.9, -3.69923], [80, -3.61793], [80.1, -3.53415], [80.2, -3.44782], [80.3, -3.35885], [80.4, -3.26714], [80.5, -3.1726], [80.6, -3.07513], [80.7, -2.97461], [80.8, -2.87095], [80.9, -2.76403], [81, -2.65373], [81.1, -2.53993], [81.2, -2.42249], [81.3, -2.30127], [81.4, -2.17615], [81.5, -2.04696], [81.6, -1.91356], [81.7, -1.77577], [81.8, -1.63343], [81.9, -1.48636], [82, -1.33437], [82.1, -1.17726], [82.2, -1.01482], [82.3, -0.846831], [82.4, -0.673069], [82.5, -0.493288], [82.6, -0.307233], [82.7, -0.114636], [82.8, 0.0847891], [82.9, 0.29134], [83, 0.505334], [83.1, 0.727106], [83.2, 0.95701], [83.3, 1.19542], [83.4, 1.44273], [83.5, 1.69937], [83.6, 1.96578], [83.7, 2.24244], [83.8, 2.52985], [83.9, 2.82855], [84, 3.13912], [84.1, 3.46216], [84.2, 3.79833], [84.3, 4.14833], [84.4, 4.5129], [84.5, 4.89285], [84.6, 5.28902], [84.7, 5.70236], [84.8, 6.13384], [84.9, 6.58454], [85, 7.05562], [85.1, 7.5483], [85.2, 8.06395], [85.3, 8.60402], [85.4, 9.17009], [85.5, 9.7639], [85.6, 10.3873], [85.7, 11.0424], [85.8, 11.7313], [85.9, 12.4566], [86, 13.2209], [86.1, 14.0272], [86.2, 14.8788], [86.3, 15.7792], [86.4, 16.7325], [86.5, 17.7432], [86.6, 18.8161], [86.7, 19.9568], [86.8, -5], [86.8, -5], [86.8, -5], [86.8, -5], [86.8, -5], [86.8, -5], [86.8, -5], [86.8, -5], [86.8, -5], [86.8, -5], [86.8, -5], [86.8, -5], [86.8, -5], [86.8, -5], [86.8, -5], [86.8, -5], [86.8, -5], [86.8, -5], [86.8, -5], [86.8, -5], [86.8, -5], [86.8, -5], [86.8, -5], [86.8, -5], [86.8, -5], [86.8, -5], [86.8, -5], [86.8, -5], [86.8, -5], [86.8, -5], [86.8, -5], [86.8, -5], [86.8, -5], [86.8, -5], [86.8, -5], [86.8, -5], [86.8, -5], [86.8, -5], [86.8, -5], [86.8, -5], [86.8, -5], [86.8, -5], [86.8, -5], [86.8, -5], [86.8, -5], [86.8, -5], [86.8, -5], [86.8, -5], [86.8, -5], [86.8, -5], [86.8, -5], [86.8, -5], [86.9, -4.9569], [87, -4.91258], [87.1, -4.867], [87.2, -4.82011], [87.3, -4.77188], [87.4, -4.72226], [87.5, -4.67121], [87.6, -4.61869], [87.7, -4.56465], [87.8, -4.50905], [87.9, -4.45182], [88, -4.39292], [88.1, -4.3323], [88.2, -4.26991], [88.3, -4.20567], [88.4, -4.13954], [88.5, -4.07144], [88.6, -4.00133], [88.7, -3.92912], [88.8, -3.85475], [88.9, -3.77814], [89, -3.69923], [89.1, -3.61793], [89.2, -3.53415], [89.3, -3.44782], [89.4, -3.35885], [89.5, -3.26714], [89.6, -3.1726], [89.7, -3.07513], [89.8, -2.97461], [89.9, -2.87095], [90, -2.76403], [90.1, -2.65373], [90.2, -2.53993], [90.3, -2.42249], [90.4, -2.30127], [90.5, -2.17615], [90.6, -2.04696], [90.7, -1.91356], [90.8, -1.77577], [90.9, -1.63343], [91, -1.48636], [91.1, -1.33437], [91.2, -1.17726], [91.3, -1.01482], [91.4, -0.846831], [91.5, -0.673069], [91.6, -0.493288], [91.7, -0.307233], [91.8, -0.114636], [91.9, 0.0847891], [92, 0.29134], [92.1, 0.505334], [92.2, 0.727106], [92.3, 0.95701], [92.4, 1.19542], [92.5, 1.44273], [92.6, 1.69937], [92.7, 1.96578], [92.8, 2.24244], [92.9, 2.52985], [93, 2.82855], [93.1, 3.13912], [93.2, 3.46216], [93.3, 3.79833], [93.4, 4.14833], [93.5, 4.5129], [93.6, 4.89285], [93.7, 5.28902], [93.8, 5.70236], [93.9, 6.13384], [94, 6.58454], [94.1, 7.05562], [94.2, 7.5483], [94.3, 8.06395], [94.4, 8.60402], [94.5, 9.17009], [94.6, 9.7639], [94.7, 10.3873], [94.8, 11.0424], [94.9, 11.7313], [95, 12.4566], [95.1, 13.2209], [95.2, 14.0272], [95.3, 14.8788], [95.4, 15.7792], [95.5, 16.7325], [95.6, 17.7432], [95.7, 18.8161], [95.8, 19.9568], [95.9, -5], [95.9, -5], [95.9, -5], [95.9, -5], [95.9, -5], [95.9, -5], [95.9, -5], [95.9, -5], [95.9, -5], [95.9, -5], [95.9, -5], [95.9, -5], [95.9, -5], [95.9, -5], [95.9, -5], [95.9, -5], [95.9, -5], [95.9, -5], [95.9, -5], [95.9, -5], [95.9, -5], [95.9, -5], [95.9, -5], [95.9, -5], [95.9, -5], [95.9, -5], [95.9, -5], [95.9, -5], [95.9, -5], [95.9, -5], [95.9, -5], [95.9, -5], [95.9, -5], [95.9, -5], [95.9, -5], [95.9, -5], [95.9, -5], [95.9, -5], [95.9, -5], [95.9, -5], [95.9, -5], [95.9, -5], [95.9, -5], [95.9, -5], [95.9, -5], [95.9, -5], [95.9, -5], [95.9, -5], [95.9, -5], [95.9, -5], [95.9, -5], [95.9, -5], [96, -4.9569], [96.1, -4.91258], [96.2, -4.867], [96.3, -4.82011], [96.4, -4.77188], [96.5, -4.72226], [96.6, -4.67121], [96.7, -4.61869], [96.8, -4.56465], [96.9, -4.50905], [97, -4.45182], [97.1, -4.39292], [97.2, -4.3323], [97.3, -4.26991], [97.4, -4.20567], [97.5, -4.13954], [97.6, -4.07144], [97.7, -4.00133], [97.8, -3.92912], [97.9, -3.85475], [98, -3.77814], [98.1, -3.69923], [98.2, -3.61793], [98.3, -3.53415], [98.4, -3.44782], [98.5, -3.35885], [98.6, -3.26714], [98.7, -3.1726], [98.8, -3.07513], [98.9, -2.97461], [99, -2.87095], [99.1, -2.76403], [99.2, -2.65373], [99.3, -2.53993], [99.4, -2.42249], [99.5, -2.30127], [99.6, -2.17615], [99.7, -2.04696], [99.8, -1.91356], [99.9, -1.77577], [100, -1.63343], [100.1, -1.48636], [100.2, -1.33437], [100.3, -1.17726], [100.4, -1.01482], [100.5, -0.846831], [100.6, -0.673069], [100.7, -0.493288], [100.8, -0.307233], [100.9, -0.114636], [101, 0.0847891], [101.1, 0.29134], [101.2, 0.505334], [101.3, 0.727106], [101.4, 0.95701], [101.5, 1.19542], [101.6, 1.44273], [101.7, 1.69937], [101.8, 1.96578], [101.9, 2.24244], [102, 2.52985], [102.1, 2.82855], [102.2, 3.13912], [102.3, 3.46216], [102.4, 3.79833], [102.5, 4.14833], [102.6, 4.5129], [102.7, 4.89285], [102.8, 5.28902], [102.9, 5.70236], [103, 6.13384], [103.1, 6.58454], [103.2, 7.05562], [103.3, 7.5483], [103.4, 8.06395], [103.5, 8.60402], [103.6, 9.17009], [103.7, 9.7639], [103.8, 10.3873], [103.9, 11.0424], [104, 11.7313], [104.1, 12.4566], [104.2, 13.2209], [104.3, 14.0272], [104.4, 14.8788], [104.5, 15.7792], [104.6, 16.7325], [104.7, 17.7432], [104.8, 18.8161], [104.9, 19.9568], [105, -5], [105, -5], [105, -5], [105, -5], [105, -5], [105, -5], [105, -5], [105, -5], [105, -5], [105, -5], [105, -5], [105, -5], [105, -5], [105, -5], [105, -5], [105, -5], [105, -5], [105, -5], [105, -5], [105, -5], [105, -5], [105, -5], [105, -5], [105, -5], [105, -5], [105, -5], [105, -5], [105, -5], [105, -5], [105, -5], [105, -5], [105, -5], [105, -5], [105, -5], [105, -5], [105, -5], [105, -5], [105, -5], [105, -5], [105, -5], [105, -5], [105, -5], [105, -5], [105, -5], [105, -5], [105, -5], [105, -5], [105, -5], [105, -5], [105, -5], [105, -5], [105, -5], [105.1, -4.9569], [105.2, -4.91258], [105.3, -4.867], [105.4, -4.82011], [105.5, -4.77188], [105.6, -4.72226], [105.7, -4.67121], [105.8, -4.61869], [105.9, -4.56465], [106, -4.50905], [106.1, -4.45182], [106.2, -4.39292], [106.3, -4.3323], [106.4, -4.26991], [106.5, -4.20567], [106.6, -4.13954], [106.7, -4.07144], [106.8, -4.00133], [106.9, -3.92912], [107, -3.85475], [107.1, -3.77814], [107.2, -3.69923], [107.3, -3.61793], [107.4, -3.53415], [107.5, -3.44782], [107.6, -3.35885], [107.7, -3.26714], [107.8, -3.1726], [107.9, -3.07513], [108, -2.97461], [108.1, -2.87095], [108.2, -2.76403], [108.3, -2.65373], [108.4, -2.53993], [108.5, -2.42249], [108.6, -2.30127], [108.7, -2.17615], [108.8, -2.04696], [108.9, -1.91356], [109, -1.77577], [109.1, -1.63343], [109.2, -1.48636], [109.3, -1.33437], [109.4, -1.17726], [109.5, -1.01482], [109.6, -0.846831], [109.7, -0.673069], [109.8, -0.493288], [109.9, -0.307233], [110, -0.114636], [110.1, 0.0847891], [110.2, 0.29134], [110.3, 0.505334], [110.4, 0.727106], [110.5, 0.95701], [110.6, 1.19542], [110.7, 1.44273], [110.8, 1.69937], [110.9, 1.96578], [111, 2.24244], [111.1, 2.52985], [111.2, 2.82855], [111.3, 3.13912], [111.4, 3.46216], [111.5, 3.79833], [111.6, 4.14833], [111.7, 4.5129], [111.8, 4.89285], [111.9, 5.28902], [112, 5.70236], [112.1, 6.13384], [112.2, 6.58454], [112.3, 7.05562], [112.4, 7.5483], [112.5, 8.06395], [112.6, 8.60402], [112.7, 9.17009], [112.8, 9.7639], [112.9, 10.3873], [113, 11.0424], [113.1, 11.7313], [113.2, 12.4566], [113.3, 13.2209], [113.4, 14.0272], [113.5, 14.8788], [113.6, 15.7792], [113.7, 16.7325], [113.8, 17.7432], [113.9, 18.8161], [114, 19.9568], [114.1, -5], [114.1, -5], [114.1, -5], [114.1, -5], [114.1, -5], [114.1, -5], [114.1, -5], [114.1, -5], [114.1, -5], [114.1, -5], [114.1, -5], [114.1, -5], [114.1, -5], [114.1, -5], [114.1, -5], [114.1, -5], [114.1, -5], [114.1, -5], [114.1, -5], [114.1, -5], [114.1, -5], [114.1, -5], [114.1, -5], [114.1, -5], [114.1, -5], [114.1, -5], [114.1, -5], [114.1, -5], [114.1, -5], [114.1, -5], [114.1, -5], [114.1, -5], [114.1, -5], [114.1, -5], [114.1, -5], [114.1, -5], [114.1, -5], [114.1, -5], [114.1, -5], [114.1, -5], [114.1, -5], [114.1, -5], [114.1, -5], [114.1, -5], [114.1, -5], [114.1, -5], [114.1, -5], [114.1, -5], [114.1, -5], [114.1, -5], [114.1, -5], [114.1, -5], [114.2, -4.9569], [114.3, -4.91258], [114.4, -4.867], [114.5, -4.82011], [114.6, -4.77188], [114.7, -4.72226], [114.8, -4.67121], [114.9, -4.61869], [115, -4.56465], [115.1, -4.50905], [115.2, -4.45182], [115.3, -4.39292], [115.4, -4.3323], [115.5, -4.26991], [115.6, -4.20567], [115.7, -4.13954], [115.8, -4.07144], [115.9, -4.00133], [116, -3.92912], [116.1, -3.85475], [116.2, -3.77814], [116.3, -3.69923], [116.4, -3.61793], [116.5, -3.53415], [116.6, -3.44782], [116.7, -3.35885], [116.8, -3.26714], [116.9, -3.1726], [117, -3.07513], [117.1, -2.97461], [117.2, -2.87095], [117.3, -2.76403], [117.4, -2.65373], [117.5, -2.53993], [117.6, -2.42249], [117.7, -2.30127], [117.8, -2.17615], [117.9, -2.04696], [118, -1.91356], [118.1, -1.77577], [118.2, -1.63343], [118.3, -1.48636], [118.4, -1.33437], [118.5, -1.17726], [118.6, -1.01482], [118.7, -0.846831], [118.8, -0.673069], [118.9, -0.493288], [119, -0.307233], [119.1, -0.114636], [119.2, 0.0847891], [119.3, 0.29134], [119.4, 0.505334], [119.5, 0.727106], [119.6, 0.95701], [119.7, 1.19542], [119.8, 1.44273], [119.9, 1.69937], [120, 1.96578], [120.1, 2.24244], [120.2, 2.52985], [120.3, 2.82855], [120.4, 3.13912], [120.5, 3.46216], [120.6, 3.79833], [120.7, 4.14833], [120.8, 4.5129], [120.9, 4.89285], [121, 5.28902], [121.1, 5.70236], [121.2, 6.13384], [121.3, 6.58454], [121.4, 7.05562], [121.5, 7.5483], [121.6, 8.06395], [121.7, 8.60402], [121.8, 9.17009], [121.9, 9.7639], [122, 10.3873], [122.1, 11.0424], [122.2, 11.7313], [122.3, 12.4566], [122.4, 13.2209], [122.5, 14.0272], [122.6, 14.8788], [122.7, 15.7792], [122.8, 16.7325], [122.9, 17.7432], [123, 18.8161], [123.1, 19.9568], [123.2, -5], [123.2, -5], [123.2, -5], [123.2, -5], [123.2, -5], [123.2, -5], [123.2, -5], [123.2, -5], [123.2, -5], [123.2, -5], [123.2, -5], [123.2, -5], [123.2, -5], [123.2, -5], [123.2, -5], [123.2, -5], [123.2, -5], [123.2, -5], [123.2, -5], [123.2, -5], [123.2, -5], [123.2, -5], [123.2, -5], [123.2, -5], [123.2, -5], [123.2, -5], [123.2, -5], [123.2, -5], [123.2, -5], [123.2, -5], [123.2, -5], [123.2, -5], [123.2, -5], [123.2, -5], [123.2, -5], [123.2, -5], [123.2, -5], [123.2, -5], [123.2, -5], [123.2, -5], [123.2, -5], [123.2, -5], [123.2, -5], [123.2, -5], [123.2, -5], [123.2, -5], [123.2, -5], [123.2, -5], [123.2, -5], [123.2, -5], [123.2, -5], [123.2, -5], [123.3, -4.9569], [123.4, -4.91258], [123.5, -4.867], [123.6, -4.82011], [123.7, -4.77188], [123.8, -4.72226], [123.9, -4.67121], [124, -4.61869], [124.1, -4.56465], [124.2, -4.50905], [124.3, -4.45182], [124.4, -4.39292], [124.5, -4.3323], [124.6, -4.26991], [124.7, -4.20567], [124.8, -4.13954], [124.9, -4.07144], [125, -4.00133], [125.1, -3.92912], [125.2, -3.85475], [125.3, -3.77814], [125.4, -3.69923], [125.5, -3.61793], [125.6, -3.53415], [125.7, -3.44782], [125.8, -3.35885], [125.9, -3.26714], [126, -3.1726], [126.1, -3.07513], [126.2, -2.97461], [126.3, -2.87095], [126.4, -2.76403], [126.5, -2.65373], [126.6, -2.53993], [126.7, -2.42249], [126.8, -2.30127], [126.9, -2.17615], [127, -2.04696], [127.1, -1.91356], [127.2, -1.77577], [127.3, -1.63343], [127.4, -1.48636], [127.5, -1.33437], [127.6, -1.17726], [127.7, -1.01482], [127.8, -0.846831], [127.9, -0.673069], [128, -0.493288], [128.1, -0.307233], [128.2, -0.114636], [128.3, 0.0847891], [128.4, 0.29134], [128.5, 0.505334], [128.6, 0.727106], [128.7, 0.95701], [128.8, 1.19542], [128.9, 1.44273], [129, 1.69937], [129.1, 1.96578], [129.2, 2.24244], [129.3, 2.52985], [129.4, 2.82855], [129.5, 3.13912], [129.6, 3.46216], [129.7, 3.79833], [129.8, 4.14833], [129.9, 4.5129], [130, 4.89285], [130.1, 5.28902], [130.2, 5.70236], [130.3, 6.13384], [130.4, 6.58454], [130.5, 7.05562], [130.6, 7.5483], [130.7, 8.06395], [130.8, 8.60402], [130.9, 9.17009], [131, 9.7639], [131.1, 10.3873], [131.2, 11.0424], [131.3, 11.7313], [131.4, 12.4566], [131.5, 13.2209], [131.6, 14.0272], [131.7, 14.8788], [131.8, 15.7792], [131.9, 16.7325], [132, 17.7432], [132.1, 18.8161], [132.2, 19.9568], [132.3, -5], [132.3, -5], [132.3, -5], [132.3, -5], [132.3, -5], [132.3, -5], [132.3, -5], [132.3, -5], [132.3, -5], [132.3, -5], [132.3, -5], [132.3, -5], [132.3, -5], [132.3, -5], [132.3, -5], [132.3, -5], [132.3, -5], [132.3, -5], [132.3, -5], [132.3, -5], [132.3, -5], [132.3, -5], [132.3, -5], [132.3, -5], [132.3, -5], [132.3, -5], [132.3, -5], [132.3, -5], [132.3, -5], [132.3, -5], [132.3, -5], [132.3, -5], [132.3, -5], [132.3, -5], [132.3, -5], [132.3, -5], [132.3, -5], [132.3, -5], [132.3, -5], [132.3, -5], [132.3, -5], [132.3, -5], [132.3, -5], [132.3, -5], [132.3, -5], [132.3, -5], [132.3, -5], [132.3, -5], [132.3, -5], [132.3, -5], [132.3, -5], [132.3, -5], [132.4, -4.9569], [132.5, -4.91258], [132.6, -4.867], [132.7, -4.82011], [132.8, -4.77188], [132.9, -4.72226], [133, -4.67121], [133.1, -4.61869], [133.2, -4.56465], [133.3, -4.50905], [133.4, -4.45182], [133.5, -4.39292], [133.6, -4.3323], [133.7, -4.26991], [133.8, -4.20567], [133.9, -4.13954], [134, -4.07144], [134.1, -4.00133], [134.2, -3.92912], [134.3, -3.85475], [134.4, -3.77814], [134.5, -3.69923], [134.6, -3.61793], [134.7, -3.53415], [134.8, -3.44782], [134.9, -3.35885], [135, -3.26714], [135.1, -3.1726], [135.2, -3.07513], [135.3, -2.97461], [135.4, -2.87095], [135.5, -2.76403], [135.6, -2.65373], [135.7, -2.53993], [135.8, -2.42249], [135.9, -2.30127], [136, -2.17615], [136.1, -2.04696], [136.2, -1.91356], [136.3, -1.77577], [136.4, -1.63343], [136.5, -1.48636], [136.6, -1.33437], [136.7, -1.17726], [136.8, -1.01482], [136.9, -0.846831], [137, -0.673069], [137.1, -0.493288], [137.2, -0.307233], [137.3, -0.114636], [137.4, 0.0847891], [137.5, 0.29134], [137.6, 0.505334], [137.7, 0.727106], [137.8, 0.95701], [137.9, 1.19542], [138, 1.44273], [138.1, 1.69937], [138.2, 1.96578], [138.3, 2.24244], [138.4, 2.52985], [138.5, 2.82855], [138.6, 3.13912], [138.7, 3.46216], [138.8, 3.79833], [138.9, 4.14833], [139, 4.5129], [139.1, 4.89285], [139.2, 5.28902], [139.3, 5.70236], [139.4, 6.13384], [139.5, 6.58454], [139.6, 7.05562], [139.7, 7.5483], [139.8, 8.06395], [139.9, 8.60402], [140, 9.17009], [140.1, 9.7639], [140.2, 10.3873], [140.3, 11.0424], [140.4, 11.7313], [140.5, 12.4566], [140.6, 13.2209], [140.7, 14.0272], [140.8, 14.8788], [140.9, 15.7792], [141, 16.7325], [141.1, 17.7432], [141.2, 18.8161], [141.3, 19.9568], [141.4, -5], [141.4, -5], [141.4, -5], [141.4, -5], [141.4, -5], [141.4, -5], [141.4, -5], [141.4, -5], [141.4, -5], [141.4, -5], [141.4, -5], [141.4, -5], [141.4, -5], [141.4, -5], [141.4, -5], [141.4, -5], [141.4, -5], [141.4, -5], [141.4, -5], [141.4, -5], [141.4, -5], [141.4, -5], [141.4, -5], [141.4, -5], [141.4, -5], [141.4, -5], [141.4, -5], [141.4, -5], [141.4, -5], [141.4, -5], [141.4, -5], [141.4, -5], [141.4, -5], [141.4, -5], [141.4, -5], [141.4, -5], [141.4, -5], [141.4, -5], [141.4, -5], [141.4, -5], [141.4, -5], [141.4, -5], [141.4, -5], [141.4, -5], [141.4, -5], [141.4, -5], [141.4, -5], [141.4, -5], [141.4, -5], [141.4, -5], [141.4, -5], [141.4, -5], [141.5, -4.9569], [141.6, -4.91258], [141.7, -4.867], [141.8, -4.82011], [141.9, -4.77188], [142, -4.72226], [142.1, -4.67121], [142.2, -4.61869], [142.3, -4.56465], [142.4, -4.50905], [142.5, -4.45182], [142.6, -4.39292], [142.7, -4.3323], [142.8, -4.26991], [142.9, -4.20567], [143, -4.13954], [143.1, -4.07144], [143.2, -4.00133], [143.3, -3.92912], [143.4, -3.85475], [143.5, -3.77814], [143.6, -3.69923], [143.7, -3.61793], [143.8, -3.53415], [143.9, -3.44782], [144, -3.35885], [144.1, -3.26714], [144.2, -3.1726], [144.3, -3.07513], [144.4, -2.97461], [144.5, -2.87095], [144.6, -2.76403], [144.7, -2.65373], [144.8, -2.53993], [144.9, -2.42249], [145, -2.30127], [145.1, -2.17615], [145.2, -2.04696], [145.3, -1.91356], [145.4, -1.77577], [145.5, -1.63343], [145.6, -1.48636], [145.7, -1.33437], [145.8, -1.17726], [145.9, -1.01482], [146, -0.846831], [146.1, -0.673069], [146.2, -0.493288], [146.3, -0.307233], [146.4, -0.114636], [146.5, 0.0847891], [146.6, 0.29134], [146.7, 0.505334], [146.8, 0.727106], [146.9, 0.95701], [147, 1.19542], [147.1, 1.44273], [147.2, 1.69937], [147.3, 1.96578], [147.4, 2.24244], [147.5, 2.52985], [147.6, 2.82855], [147.7, 3.13912], [147.8, 3.46216], [147.9, 3.79833], [148, 4.14833], [148.1, 4.5129], [148.2, 4.89285], [148.3, 5.28902], [148.4, 5.70236], [148.5, 6.13384], [148.6, 6.58454], [148.7, 7.05562], [148.8, 7.5483], [148.9, 8.06395], [149, 8.60402], [149.1, 9.17009], [149.2, 9.7639], [149.3, 10.3873], [149.4, 11.0424], [149.5, 11.7313], [149.6, 12.4566], [149.7, 13.2209], [149.8, 14.0272], [149.9, 14.8788], [150, 15.7792], [150.1, 16.7325], [150.2, 17.7432], [150.3, 18.8161], [150.4, 19.9568], [150.5, -5], [150.5, -5], [150.5, -5], [150.5, -5], [150.5, -5], [150.5, -5], [150.5, -5], [150.5, -5], [150.5, -5], [150.5, -5], [150.5, -5], [150.5, -5], [150.5, -5], [150.5, -5], [150.5, -5], [150.5, -5], [150.5, -5], [150.5, -5], [150.5, -5], [150.5, -5], [150.5, -5], [150.5, -5], [150.5, -5], [150.5, -5], [150.5, -5], [150.5, -5], [150.5, -5], [150.5, -5], [150.5, -5], [150.5, -5], [150.5, -5], [150.5, -5], [150.5, -5], [150.5, -5], [150.5, -5], [150.5, -5], [150.5, -5], [150.5, -5], [150.5, -5], [150.5, -5], [150.5, -5], [150.5, -5], [150.5, -5], [150.5, -5], [150.5, -5], [150.5, -5], [150.5, -5], [150.5, -5], [150.5, -5], [150.5, -5], [150.5, -5], [150.5, -5], [150.6, -4.9569], [150.7, -4.91258], [150.8, -4.867], [150.9, -4.82011], [151, -4.77188], [151.1, -4.72226], [151.2, -4.67121], [151.3, -4.61869], [151.4, -4.56465], [151.5, -4.50905], [151.6, -4.45182], [151.7, -4.39292], [151.8, -4.3323], [151.9, -4.26991], [152, -4.20567], [152.1, -4.13954], [152.2, -4.07144], [152.3, -4.00133], [152.4, -3.92912], [152.5, -3.85475], [152.6, -3.77814], [152.7, -3.69923], [152.8, -3.61793], [152.9, -3.53415], [153, -3.44782], [153.1, -3.35885], [153.2, -3.26714], [153.3, -3.1726], [153.4, -3.07513], [153.5, -2.97461], [153.6, -2.87095], [153.7, -2.76403], [153.8, -2.65373], [153.9, -2.53993], [154, -2.42249], [154.1, -2.30127], [154.2, -2.17615], [154.3, -2.04696], [154.4, -1.91356], [154.5, -1.77577], [154.6, -1.63343], [154.7, -1.48636], [154.8, -1.33437], [154.9, -1.17726], [155, -1.01482], [155.1, -0.846831], [155.2, -0.673069], [155.3, -0.493288], [155.4, -0.307233], [155.5, -0.114636], [155.6, 0.0847891], [155.7, 0.29134], [155.8, 0.505334], [155.9, 0.727106], [156, 0.95701], [156.1, 1.19542], [156.2, 1.44273], [156.3, 1.69937], [156.4, 1.96578], [156.5, 2.24244], [156.6, 2.52985], [156.7, 2.82855], [156.8, 3.13912], [156.9, 3.46216], [157, 3.79833], [157.1, 4.14833], [157.2, 4.5129], [157.3, 4.89285], [157.4, 5.28902], [157.5, 5.70236], [157.6, 6.13384], [157.7, 6.58454], [157.8, 7.05562], [157.9, 7.5483], [158, 8.06395], [158.1, 8.60402], [158.2, 9.17009], [158.3, 9.7639], [158.4, 10.3873], [158.5, 11.0424], [158.6, 11.7313], [158.7, 12.4566], [158.8, 13.2209], [158.9, 14.0272], [159, 14.8788], [159.1, 15.7792], [159.2, 16.7325], [159.3, 17.7432], [159.4, 18.8161], [159.5, 19.9568], [159.6, -5], [159.6, -5], [159.6, -5], [159.6, -5], [159.6, -5], [159.6, -5], [159.6, -5], [159.6, -5], [159.6, -5], [159.6, -5], [159.6, -5], [159.6, -5], [159.6, -5], [159.6, -5], [159.6, -5], [159.6, -5], [159.6, -5], [159.6, -5], [159.6, -5], [159.6, -5], [159.6, -5], [159.6, -5], [159.6, -5], [159.6, -5], [159.6, -5], [159.6, -5], [159.6, -5], [159.6, -5], [159.6, -5], [159.6, -5], [159.6, -5], [159.6, -5], [159.6, -5], [159.6, -5], [159.6, -5], [159.6, -5], [159.6, -5], [159.6, -5], [159.6, -5], [159.6, -5], [159.6, -5], [159.6, -5], [159.6, -5], [159.6, -5], [159.6, -5], [159.6, -5], [159.6, -5], [159.6, -5], [159.6, -5], [159.6, -5], [159.6, -5], [159.6, -5], [159.7, -4.9569], [159.8, -4.91258], [159.9, -4.867], [160, -4.82011], [160.1, -4.77188], [160.2, -4.72226], [160.3, -4.67121], [160.4, -4.61869], [160.5, -4.56465], [160.6, -4.50905], [160.7, -4.45182], [160.8, -4.39292], [160.9, -4.3323], [161, -4.26991], [161.1, -4.20567], [161.2, -4.13954], [161.3, -4.07144], [161.4, -4.00133], [161.5, -3.92912], [161.6, -3.85475], [161.7, -3.77814], [161.8, -3.69923], [161.9, -3.61793], [162, -3.53415], [162.1, -3.44782], [162.2, -3.35885], [162.3, -3.26714], [162.4, -3.1726], [162.5, -3.07513], [162.6, -2.97461], [162.7, -2.87095], [162.8, -2.76403], [162.9, -2.65373], [163, -2.53993], [163.1, -2.42249], [163.2, -2.30127], [163.3, -2.17615], [163.4, -2.04696], [163.5, -1.91356], [163.6, -1.77577], [163.7, -1.63343], [163.8, -1.48636], [163.9, -1.33437], [164, -1.17726], [164.1, -1.01482], [164.2, -0.846831], [164.3, -0.673069], [164.4, -0.493288], [164.5, -0.307233], [164.6, -0.114636], [164.7, 0.0847891], [164.8, 0.29134], [164.9, 0.505334], [165, 0.727106], [165.1, 0.95701], [165.2, 1.19542], [165.3, 1.44273], [165.4, 1.69937], [165.5, 1.96578], [165.6, 2.24244], [165.7, 2.52985], [165.8, 2.82855], [165.9, 3.13912], [166, 3.46216], [166.1, 3.79833], [166.2, 4.14833], [166.3, 4.5129], [166.4, 4.89285], [166.5, 5.28902], [166.6, 5.70236], [166.7, 6.13384], [166.8, 6.58454], [166.9, 7.05562], [167, 7.5483], [167.1, 8.06395], [167.2, 8.60402], [167.3, 9.17009], [167.4, 9.7639], [167.5, 10.3873], [167.6, 11.0424], [167.7, 11.7313], [167.8, 12.4566], [167.9, 13.2209], [168, 14.0272], [168.1, 14.8788], [168.2, 15.7792], [168.3, 16.7325], [168.4, 17.7432], [168.5, 18.8161], [168.6, 19.9568], [168.7, -5], [168.7, -5], [168.7, -5], [168.7, -5], [168.7, -5], [168.7, -5], [168.7, -5], [168.7, -5], [168.7, -5], [168.7, -5], [168.7, -5], [168.7, -5], [168.7, -5], [168.7, -5], [168.7, -5], [168.7, -5], [168.7, -5], [168.7, -5], [168.7, -5], [168.7, -5], [168.7, -5], [168.7, -5], [168.7, -5], [168.7, -5], [168.7, -5], [168.7, -5], [168.7, -5], [168.7, -5], [168.7, -5], [168.7, -5], [168.7, -5], [168.7, -5], [168.7, -5], [168.7, -5], [168.7, -5], [168.7, -5], [168.7, -5], [168.7, -5], [168.7, -5], [168.7, -5], [168.7, -5], [168.7, -5], [168.7, -5], [168.7, -5], [168.7, -5], [168.7, -5], [168.7, -5], [168.7, -5], [168.7, -5], [168.7, -5], [168.7, -5], [168.7, -5], [168.8, -4.9569], [168.9, -4.91258], [169, -4.867], [169.1, -4.82011], [169.2, -4.77188], [169.3, -4.72226], [169.4, -4.67121], [169.5, -4.61869], [169.6, -4.56465], [169.7, -4.50905], [169.8, -4.45182], [169.9, -4.39292], [170, -4.3323], [170.1, -4.26991], [170.2, -4.20567], [170.3, -4.13954], [170.4, -4.07144], [170.5, -4.00133], [170.6, -3.92912], [170.7, -3.85475], [170.8, -3.77814], [170.9, -3.69923], [171, -3.61793], [171.1, -3.53415], [171.2, -3.44782], [171.3, -3.35885], [171.4, -3.26714], [171.5, -3.1726], [171.6, -3.07513], [171.7, -2.97461], [171.8, -2.87095], [171.9, -2.76403], [172, -2.65373], [172.1, -2.53993], [172.2, -2.42249], [172.3, -2.30127], [172.4, -2.17615], [172.5, -2.04696], [172.6, -1.91356], [172.7, -1.77577], [172.8, -1.63343], [172.9, -1.48636], [173, -1.33437], [173.1, -1.17726], [173.2, -1.01482], [173.3, -0.846831], [173.4, -0.673069], [173.5, -0.493288], [173.6, -0.307233], [173.7, -0.114636], [173.8, 0.0847891], [173.9, 0.29134], [174, 0.505334], [174.1, 0.727106], [174.2, 0.95701], [174.3, 1.19542], [174.4, 1.44273], [174.5, 1.69937], [174.6, 1.96578], [174.7, 2.24244], [174.8, 2.52985], [174.9, 2.82855], [175, 3.13912], [175.1, 3.46216], [175.2, 3.79833], [175.3, 4.14833], [175.4, 4.5129], [175.5, 4.89285], [175.6, 5.28902], [175.7, 5.70236], [175.8, 6.13384], [175.9, 6.58454], [176, 7.05562], [176.1, 7.5483], [176.2, 8.06395], [176.3, 8.60402], [176.4, 9.17009], [176.5, 9.7639], [176.6, 10.3873], [176.7, 11.0424], [176.8, 11.7313], [176.9, 12.4566], [177, 13.2209], [177.1, 14.0272], [177.2, 14.8788], [177.3, 15.7792], [177.4, 16.7325], [177.5, 17.7432], [177.6, 18.8161], [177.7, 19.9568], [177.8, -5], [177.8, -5], [177.8, -5], [177.8, -5], [177.8, -5], [177.8, -5], [177.8, -5], [177.8, -5], [177.8, -5], [177.8, -5], [177.8, -5], [177.8, -5], [177.8, -5], [177.8, -5], [177.8, -5], [177.8, -5], [177.8, -5], [177.8, -5], [177.8, -5], [177.8, -5], [177.8, -5], [177.8, -5], [177.8, -5], [177.8, -5], [177.8, -5], [177.8, -5], [177.8, -5], [177.8, -5], [177.8, -5], [177.8, -5], [177.8, -5], [177.8, -5], [177.8, -5], [177.8, -5], [177.8, -5], [177.8, -5], [177.8, -5], [177.8, -5], [177.8, -5], [177.8, -5], [177.8, -5], [177.8, -5], [177.8, -5], [177.8, -5], [177.8, -5], [177.8, -5], [177.8, -5], [177.8, -5], [177.8, -5], [177.8, -5], [177.8, -5], [177.8, -5], [177.9, -4.9569], [178, -4.91258], [178.1, -4.867], [178.2, -4.82011], [178.3, -4.77188], [178.4, -4.72226], [178.5, -4.67121], [178.6, -4.61869], [178.7, -4.56465], [178.8, -4.50905], [178.9, -4.45182], [179, -4.39292], [179.1, -4.3323], [179.2, -4.26991], [179.3, -4.20567], [179.4, -4.13954], [179.5, -4.07144], [179.6, -4.00133], [179.7, -3.92912], [179.8, -3.85475], [179.9, -3.77814], [180, -3.69923], [180.1, -3.61793], [180.2, -3.53415], [180.3, -3.44782], [180.4, -3.35885], [180.5, -3.26714], [180.6, -3.1726], [180.7, -3.07513], [180.8, -2.97461], [180.9, -2.87095], [181, -2.76403], [181.1, -2.65373], [181.2, -2.53993], [181.3, -2.42249], [181.4, -2.30127], [181.5, -2.17615], [181.6, -2.04696], [181.7, -1.91356], [181.8, -1.77577], [181.9, -1.63343], [182, -1.48636], [182.1, -1.33437], [182.2, -1.17726], [182.3, -1.01482], [182.4, -0.846831], [182.5, -0.673069], [182.6, -0.493288], [182.7, -0.307233], [182.8, -0.114636], [182.9, 0.0847891], [183, 0.29134], [183.1, 0.505334], [183.2, 0.727106], [183.3, 0.95701], [183.4, 1.19542], [183.5, 1.44273], [183.6, 1.69937], [183.7, 1.96578], [183.8, 2.24244], [183.9, 2.52985], [184, 2.82855], [184.1, 3.13912], [184.2, 3.46216], [184.3, 3.79833], [184.4, 4.14833], [184.5, 4.5129], [184.6, 4.89285], [184.7, 5.28902], [184.8, 5.70236], [184.9, 6.13384], [185, 6.58454], [185.1, 7.05562], [185.2, 7.5483], [185.3, 8.06395], [185.4, 8.60402], [185.5, 9.17009], [185.6, 9.7639], [185.7, 10.3873], [185.8, 11.0424], [185.9, 11.7313], [186, 12.4566], [186.1, 13.2209], [186.2, 14.0272], [186.3, 14.8788], [186.4, 15.7792], [186.5, 16.7325], [186.6, 17.7432], [186.7, 18.8161], [186.8, 19.9568], [186.9, -5], [186.9, -5], [186.9, -5], [186.9, -5], [186.9, -5], [186.9, -5], [186.9, -5], [186.9, -5], [186.9, -5], [186.9, -5], [186.9, -5], [186.9, -5], [186.9, -5], [186.9, -5], [186.9, -5], [186.9, -5], [186.9, -5], [186.9, -5], [186.9, -5], [186.9, -5], [186.9, -5], [186.9, -5], [186.9, -5], [186.9, -5], [186.9, -5], [186.9, -5], [186.9, -5], [186.9, -5], [186.9, -5], [186.9, -5], [186.9, -5], [186.9, -5], [186.9, -5], [186.9, -5], [186.9, -5], [186.9, -5], [186.9, -5], [186.9, -5], [186.9, -5], [186.9, -5], [186.9, -5], [186.9, -5], [186.9, -5], [186.9, -5], [186.9, -5], [186.9, -5], [186.9, -5], [186.9, -5], [186.9, -5], [186.9, -5], [186.9, -5], [186.9, -5], [187, -4.9569], [187.1, -4.91258], [187.2, -4.867], [187.3, -4.82011], [187.4, -4.77188], [187.5, -4.72226], [187.6, -4.67121], [187.7, -4.61869], [187.8, -4.56465], [187.9, -4.50905], [188, -4.45182], [188.1, -4.39292], [188.2, -4.3323], [188.3, -4.26991], [188.4, -4.20567], [188.5, -4.13954], [188.6, -4.07144], [188.7, -4.00133], [188.8, -3.92912], [188.9, -3.85475], [189, -3.77814], [189.1, -3.69923], [189.2, -3.61793], [189.3, -3.53415], [189.4, -3.44782], [189.5, -3.35885], [189.6, -3.26714], [189.7, -3.1726], [189.8, -3.07513], [189.9, -2.97461], [190, -2.87095], [190.1, -2.76403], [190.2, -2.65373], [190.3, -2.53993], [190.4, -2.42249], [190.5, -2.30127], [190.6, -2.17615], [190.7, -2.04696], [190.8, -1.91356], [190.9, -1.77577], [191, -1.63343], [191.1, -1.48636], [191.2, -1.33437], [191.3, -1.17726], [191.4, -1.01482], [191.5, -0.846831], [191.6, -0.673069], [191.7, -0.493288], [191.8, -0.307233], [191.9, -0.114636], [192, 0.0847891], [192.1, 0.29134], [192.2, 0.505334], [192.3, 0.727106], [192.4, 0.95701], [192.5, 1.19542], [192.6, 1.44273], [192.7, 1.69937], [192.8, 1.96578], [192.9, 2.24244], [193, 2.52985], [193.1, 2.82855], [193.2, 3.13912], [193.3, 3.46216], [193.4, 3.79833], [193.5, 4.14833], [193.6, 4.5129], [193.7, 4.89285], [193.8, 5.28902], [193.9, 5.70236], [194, 6.13384], [194.1, 6.58454], [194.2, 7.05562], [194.3, 7.5483], [194.4, 8.06395], [194.5, 8.60402], [194.6, 9.17009], [194.7, 9.7639], [194.8, 10.3873], [194.9, 11.0424], [195, 11.7313], [195.1, 12.4566], [195.2, 13.2209], [195.3, 14.0272], [195.4, 14.8788], [195.5, 15.7792], [195.6, 16.7325], [195.7, 17.7432], [195.8, 18.8161], [195.9, 19.9568], [196, -5], [196, -5], [196, -5], [196, -5], [196, -5], [196, -5], [196, -5], [196, -5], [196, -5], [196, -5], [196, -5], [196, -5], [196, -5], [196, -5], [196, -5], [196, -5], [196, -5], [196, -5], [196, -5], [196, -5], [196, -5], [196, -5], [196, -5], [196, -5], [196, -5], [196, -5], [196, -5], [196, -5], [196, -5], [196, -5], [196, -5], [196, -5], [196, -5], [196, -5], [196, -5], [196, -5], [196, -5], [196, -5], [196, -5], [196, -5], [196, -5], [196, -5], [196, -5], [196, -5], [196, -5], [196, -5], [196, -5], [196, -5], [196, -5], [196, -5], [196, -5], [196, -5], [196.1, -4.9569], [196.2, -4.91258], [196.3, -4.867], [196.4, -4.82011], [196.5, -4.77188], [196.6, -4.72226], [196.7, -4.67121], [196.8, -4.61869], [196.9, -4.56465], [197, -4.50905], [197.1, -4.45182], [197.2, -4.39292], [197.3, -4.3323], [197.4, -4.26991], [197.5, -4.20567], [197.6, -4.13954], [197.7, -4.07144], [197.8, -4.00133], [197.9, -3.92912], [198, -3.85475], [198.1, -3.77814], [198.2, -3.69923], [198.3, -3.61793], [198.4, -3.53415], [198.5, -3.44782], [198.6, -3.35885], [198.7, -3.26714], [198.8, -3.1726], [198.9, -3.07513], [199, -2.97461], [199.1, -2.87095], [199.2, -2.76403], [199.3, -2.65373], [199.4, -2.53993], [199.5, -2.42249], [199.6, -2.30127], [199.7, -2.17615], [199.8, -2.04696], [199.9, -1.91356], [200, -1.77577], [200.1, -1.63343], [200.2, -1.48636], [200.3, -1.33437], [200.4, -1.17726], [200.5, -1.01482], [200.6, -0.846831], [200.7, -0.673069], [200.8, -0.493288], [200.9, -0.307233], [201, -0.114636], [201.1, 0.0847891], [201.2, 0.29134], [201.3, 0.505334], [201.4, 0.727106], [201.5, 0.95701], [201.6, 1.19542], [201.7, 1.44273], [201.8, 1.69937], [201.9, 1.96578], [202, 2.24244], [202.1, 2.52985], [202.2, 2.82855], [202.3, 3.13912], [202.4, 3.46216], [202.5, 3.79833], [202.6, 4.14833], [202.7, 4.5129], [202.8, 4.89285], [202.9, 5.28902], [203, 5.70236], [203.1, 6.13384], [203.2, 6.58454], [203.3, 7.05562], [203.4, 7.5483], [203.5, 8.06395], [203.6, 8.60402], [203.7, 9.17009], [203.8, 9.7639], [203.9, 10.3873], [204, 11.0424], [204.1, 11.7313], [204.2, 12.4566], [204.3, 13.2209], [204.4, 14.0272], [204.5, 14.8788], [204.6, 15.7792], [204.7, 16.7325], [204.8, 17.7432], [204.9, 18.8161], [205, 19.9568], [205.1, -5], [205.1, -5], [205.1, -5], [205.1, -5], [205.1, -5], [205.1, -5], [205.1, -5], [205.1, -5], [205.1, -5], [205.1, -5], [205.1, -5], [205.1, -5], [205.1, -5], [205.1, -5], [205.1, -5], [205.1, -5], [205.1, -5], [205.1, -5], [205.1, -5], [205.1, -5], [205.1, -5], [205.1, -5], [205.1, -5], [205.1, -5], [205.1, -5], [205.1, -5], [205.1, -5], [205.1, -5], [205.1, -5], [205.1, -5], [205.1, -5], [205.1, -5], [205.1, -5], [205.1, -5], [205.1, -5], [205.1, -5], [205.1, -5], [205.1, -5], [205.1, -5], [205.1, -5], [205.1, -5], [205.1, -5], [205.1, -5], [205.1, -5], [205.1, -5], [205.1, -5], [205.1, -5], [205.1, -5], [205.1, -5], [205.1, -5], [205.1, -5], [205.1, -5], [205.2, -4.9569], [205.3, -4.91258], [205.4, -4.867], [205.5, -4.82011], [205.6, -4.77188], [205.7, -4.72226], [205.8, -4.67121], [205.9, -4.61869], [206, -4.56465], [206.1, -4.50905], [206.2, -4.45182], [206.3, -4.39292], [206.4, -4.3323], [206.5, -4.26991], [206.6, -4.20567], [206.7, -4.13954], [206.8, -4.07144], [206.9, -4.00133], [207, -3.92912], [207.1, -3.85475], [207.2, -3.77814], [207.3, -3.69923], [207.4, -3.61793], [207.5, -3.53415], [207.6, -3.44782], [207.7, -3.35885], [207.8, -3.26714], [207.9, -3.1726], [208, -3.07513], [208.1, -2.97461], [208.2, -2.87095], [208.3, -2.76403], [208.4, -2.65373], [208.5, -2.53993], [208.6, -2.42249], [208.7, -2.30127], [208.8, -2.17615], [208.9, -2.04696], [209, -1.91356], [209.1, -1.77577], [209.2, -1.63343], [209.3, -1.48636], [209.4, -1.33437], [209.5, -1.17726], [209.6, -1.01482], [209.7, -0.846831], [209.8, -0.673069], [209.9, -0.493288], [210, -0.307233], [210.1, -0.114636], [210.2, 0.0847891], [210.3, 0.29134], [210.4, 0.505334], [210.5, 0.727106], [210.6, 0.95701], [210.7, 1.19542], [210.8, 1.44273], [210.9, 1.69937], [211, 1.96578], [211.1, 2.24244], [211.2, 2.52985], [211.3, 2.82855], [211.4, 3.13912], [211.5, 3.46216], [211.6, 3.79833], [211.7, 4.14833], [211.8, 4.5129], [211.9, 4.89285], [212, 5.28902], [212.1, 5.70236], [212.2, 6.13384], [212.3, 6.58454], [212.4, 7.05562], [212.5, 7.5483], [212.6, 8.06395], [212.7, 8.60402], [212.8, 9.17009], [212.9, 9.7639], [213, 10.3873], [213.1, 11.0424], [213.2, 11.7313], [213.3, 12.4566], [213.4, 13.2209], [213.5, 14.0272], [213.6, 14.8788], [213.7, 15.7792], [213.8, 16.7325], [213.9, 17.7432], [214, 18.8161], [214.1, 19.9568], [214.2, -5], [214.2, -5], [214.2, -5], [214.2, -5], [214.2, -5], [214.2, -5], [214.2, -5], [214.2, -5], [214.2, -5], [214.2, -5], [214.2, -5], [214.2, -5], [214.2, -5], [214.2, -5], [214.2, -5], [214.2, -5], [214.2, -5], [214.2, -5], [214.2, -5], [214.2, -5], [214.2, -5], [214.2, -5], [214.2, -5], [214.2, -5], [214.2, -5], [214.2, -5], [214.2, -5], [214.2, -5], [214.2, -5], [214.2, -5], [214.2, -5], [214.2, -5], [214.2, -5], [214.2, -5], [214.2, -5], [214.2, -5], [214.2, -5], [214.2, -5], [214.2, -5], [214.2, -5], [214.2, -5], [214.2, -5], [214.2, -5], [214.2, -5], [214.2, -5], [214.2, -5], [214.2, -5], [214.2, -5], [214.2, -5], [214.2, -5], [214.2, -5], [214.2, -5], [214.3, -4.9569], [214.4, -4.91258], [214.5, -4.867], [214.6, -4.82011], [214.7, -4.77188], [214.8, -4.72226], [214.9, -4.67121], [215, -4.61869], [215.1, -4.56465], [215.2, -4.50905], [215.3, -4.45182], [215.4, -4.39292], [215.5, -4.3323], [215.6, -4.26991], [215.7, -4.20567], [215.8, -4.13954], [215.9, -4.07144], [216, -4.00133], [216.1, -3.92912], [216.2, -3.85475], [216.3, -3.77814], [216.4, -3.69923], [216.5, -3.61793], [216.6, -3.53415], [216.7, -3.44782], [216.8, -3.35885], [216.9, -3.26714], [217, -3.1726], [217.1, -3.07513], [217.2, -2.97461], [217.3, -2.87095], [217.4, -2.76403], [217.5, -2.65373], [217.6, -2.53993], [217.7, -2.42249], [217.8, -2.30127], [217.9, -2.17615], [218, -2.04696], [218.1, -1.91356], [218.2, -1.77577], [218.3, -1.63343], [218.4, -1.48636], [218.5, -1.33437], [218.6, -1.17726], [218.7, -1.01482], [218.8, -0.846831], [218.9, -0.673069], [219, -0.493288], [219.1, -0.307233], [219.2, -0.114636], [219.3, 0.0847891], [219.4, 0.29134], [219.5, 0.505334], [219.6, 0.727106], [219.7, 0.95701], [219.8, 1.19542], [219.9, 1.44273], [220, 1.69937], [220.1, 1.96578], [220.2, 2.24244], [220.3, 2.52985], [220.4, 2.82855], [220.5, 3.13912], [220.6, 3.46216], [220.7, 3.79833], [220.8, 4.14833], [220.9, 4.5129], [221, 4.89285], [221.1, 5.28902], [221.2, 5.70236], [221.3, 6.13384], [221.4, 6.58454], [221.5, 7.05562], [221.6, 7.5483], [221.7, 8.06395], [221.8, 8.60402], [221.9, 9.17009], [222, 9.7639], [222.1, 10.3873], [222.2, 11.0424], [222.3, 11.7313], [222.4, 12.4566], [222.5, 13.2209], [222.6, 14.0272], [222.7, 14.8788], [222.8, 15.7792], [222.9, 16.7325], [223, 17.7432], [223.1, 18.8161], [223.2, 19.9568], [223.3, -5], [223.3, -5], [223.3, -5], [223.3, -5], [223.3, -5], [223.3, -5], [223.3, -5], [223.3, -5], [223.3, -5], [223.3, -5], [223.3, -5], [223.3, -5], [223.3, -5], [223.3, -5], [223.3, -5], [223.3, -5], [223.3, -5], [223.3, -5], [223.3, -5], [223.3, -5], [223.3, -5], [223.3, -5], [223.3, -5], [223.3, -5], [223.3, -5], [223.3, -5], [223.3, -5], [223.3, -5], [223.3, -5], [223.3, -5], [223.3, -5], [223.3, -5], [223.3, -5], [223.3, -5], [223.3, -5], [223.3, -5], [223.3, -5], [223.3, -5], [223.3, -5], [223.3, -5], [223.3, -5], [223.3, -5], [223.3, -5], [223.3, -5], [223.3, -5], [223.3, -5], [223.3, -5], [223.3, -5], [223.3, -5], [223.3, -5], [223.3, -5], [223.3, -5], [223.4, -4.9569], [223.5, -4.91258], [223.6, -4.867], [223.7, -4.82011], [223.8, -4.77188], [223.9, -4.72226], [224, -4.67121], [224.1, -4.61869], [224.2, -4.56465], [224.3, -4.50905], [224.4, -4.45182], [224.5, -4.39292], [224.6, -4.3323], [224.7, -4.26991], [224.8, -4.20567], [224.9, -4.13954], [225, -4.07144], [225.1, -4.00133], [225.2, -3.92912], [225.3, -3.85475], [225.4, -3.77814], [225.5, -3.69923], [225.6, -3.61793], [225.7, -3.53415], [225.8, -3.44782], [225.9, -3.35885], [226, -3.26714], [226.1, -3.1726], [226.2, -3.07513], [226.3, -2.97461], [226.4, -2.87095], [226.5, -2.76403], [226.6, -2.65373], [226.7, -2.53993], [226.8, -2.42249], [226.9, -2.30127], [227, -2.17615], [227.1, -2.04696], [227.2, -1.91356], [227.3, -1.77577], [227.4, -1.63343], [227.5, -1.48636], [227.6, -1.33437], [227.7, -1.17726], [227.8, -1.01482], [227.9, -0.846831], [228, -0.673069], [228.1, -0.493288], [228.2, -0.307233], [228.3, -0.114636], [228.4, 0.0847891], [228.5, 0.29134], [228.6, 0.505334], [228.7, 0.727106], [228.8, 0.95701], [228.9, 1.19542], [229, 1.44273], [229.1, 1.69937], [229.2, 1.96578], [229.3, 2.24244], [229.4, 2.52985], [229.5, 2.82855], [229.6, 3.13912], [229.7, 3.46216], [229.8, 3.79833], [229.9, 4.14833], [230, 4.5129], [230.1, 4.89285], [230.2, 5.28902], [230.3, 5.70236], [230.4, 6.13384], [230.5, 6.58454], [230.6, 7.05562], [230.7, 7.5483], [230.8, 8.06395], [230.9, 8.60402], [231, 9.17009], [231.1, 9.7639], [231.2, 10.3873], [231.3, 11.0424], [231.4, 11.7313], [231.5, 12.4566], [231.6, 13.2209], [231.7, 14.0272], [231.8, 14.8788], [231.9, 15.7792], [232, 16.7325], [232.1, 17.7432], [232.2, 18.8161], [232.3, 19.9568], [232.4, -5], [232.4, -5], [232.4, -5], [232.4, -5], [232.4, -5], [232.4, -5], [232.4, -5], [232.4, -5], [232.4, -5], [232.4, -5], [232.4, -5], [232.4, -5], [232.4, -5], [232.4, -5], [232.4, -5], [232.4, -5], [232.4, -5], [232.4, -5], [232.4, -5], [232.4, -5], [232.4, -5], [232.4, -5], [232.4, -5], [232.4, -5], [232.4, -5], [232.4, -5], [232.4, -5], [232.4, -5], [232.4, -5], [232.4, -5], [232.4, -5], [232.4, -5], [232.4, -5], [232.4, -5], [232.4, -5], [232.4, -5], [232.4, -5], [232.4, -5], [232.4, -5], [232.4, -5], [232.4, -5], [232.4, -5], [232.4, -5], [232.4, -5], [232.4, -5], [232.4, -5], [232.4, -5], [232.4, -5], [232.4, -5], [232.4, -5], [232.4, -5], [232.4, -5], [232.5, -4.9569], [232.6, -4.91258], [232.7, -4.867], [232.8, -4.82011], [232.9, -4.77188], [233, -4.72226], [233.1, -4.67121], [233.2, -4.61869], [233.3, -4.56465], [233.4, -4.50905], [233.5, -4.45182], [233.6, -4.39292], [233.7, -4.3323], [233.8, -4.26991], [233.9, -4.20567], [234, -4.13954], [234.1, -4.07144], [234.2, -4.00133], [234.3, -3.92912], [234.4, -3.85475], [234.5, -3.77814], [234.6, -3.69923], [234.7, -3.61793], [234.8, -3.53415], [234.9, -3.44782], [235, -3.35885], [235.1, -3.26714], [235.2, -3.1726], [235.3, -3.07513], [235.4, -2.97461], [235.5, -2.87095], [235.6, -2.76403], [235.7, -2.65373], [235.8, -2.53993], [235.9, -2.42249], [236, -2.30127], [236.1, -2.17615], [236.2, -2.04696], [236.3, -1.91356], [236.4, -1.77577], [236.5, -1.63343], [236.6, -1.48636], [236.7, -1.33437], [236.8, -1.17726], [236.9, -1.01482], [237, -0.846831], [237.1, -0.673069], [237.2, -0.493288], [237.3, -0.307233], [237.4, -0.114636], [237.5, 0.0847891], [237.6, 0.29134], [237.7, 0.505334], [237.8, 0.727106], [237.9, 0.95701], [238, 1.19542], [238.1, 1.44273], [238.2, 1.69937], [238.3, 1.96578], [238.4, 2.24244], [238.5, 2.52985], [238.6, 2.82855], [238.7, 3.13912], [238.8, 3.46216], [238.9, 3.79833], [239, 4.14833], [239.1, 4.5129], [239.2, 4.89285], [239.3, 5.28902], [239.4, 5.70236], [239.5, 6.13384], [239.6, 6.58454], [239.7, 7.05562], [239.8, 7.5483], [239.9, 8.06395], [240, 8.60402], [240.1, 9.17009], [240.2, 9.7639], [240.3, 10.3873], [240.4, 11.0424], [240.5, 11.7313], [240.6, 12.4566], [240.7, 13.2209], [240.8, 14.0272], [240.9, 14.8788], [241, 15.7792], [241.1, 16.7325], [241.2, 17.7432], [241.3, 18.8161], [241.4, 19.9568], [241.5, -5], [241.5, -5], [241.5, -5], [241.5, -5], [241.5, -5], [241.5, -5], [241.5, -5], [241.5, -5], [241.5, -5], [241.5, -5], [241.5, -5], [241.5, -5], [241.5, -5], [241.5, -5], [241.5, -5], [241.5, -5], [241.5, -5], [241.5, -5], [241.5, -5], [241.5, -5], [241.5, -5], [241.5, -5], [241.5, -5], [241.5, -5], [241.5, -5], [241.5, -5], [241.5, -5], [241.5, -5], [241.5, -5], [241.5, -5], [241.5, -5], [241.5, -5], [241.5, -5], [241.5, -5], [241.5, -5], [241.5, -5], [241.5, -5], [241.5, -5], [241.5, -5], [241.5, -5], [241.5, -5], [241.5, -5], [241.5, -5], [241.5, -5], [241.5, -5], [241.5, -5], [241.5, -5], [241.5, -5], [241.5, -5], [241.5, -5], [241.5, -5], [241.5, -5], [241.6, -4.9569], [241.7, -4.91258], [241.8, -4.867], [241.9, -4.82011], [242, -4.77188], [242.1, -4.72226], [242.2, -4.67121], [242.3, -4.61869], [242.4, -4.56465], [242.5, -4.50905], [242.6, -4.45182], [242.7, -4.39292], [242.8, -4.3323], [242.9, -4.26991], [243, -4.20567], [243.1, -4.13954], [243.2, -4.07144], [243.3, -4.00133], [243.4, -3.92912], [243.5, -3.85475], [243.6, -3.77814], [243.7, -3.69923], [243.8, -3.61793], [243.9, -3.53415], [244, -3.44782], [244.1, -3.35885], [244.2, -3.26714], [244.3, -3.1726], [244.4, -3.07513], [244.5, -2.97461], [244.6, -2.87095], [244.7, -2.76403], [244.8, -2.65373], [244.9, -2.53993], [245, -2.42249], [245.1, -2.30127], [245.2, -2.17615], [245.3, -2.04696], [245.4, -1.91356], [245.5, -1.77577], [245.6, -1.63343], [245.7, -1.48636], [245.8, -1.33437], [245.9, -1.17726], [246, -1.01482], [246.1, -0.846831], [246.2, -0.673069], [246.3, -0.493288], [246.4, -0.307233], [246.5, -0.114636], [246.6, 0.0847891], [246.7, 0.29134], [246.8, 0.505334], [246.9, 0.727106], [247, 0.95701], [247.1, 1.19542], [247.2, 1.44273], [247.3, 1.69937], [247.4, 1.96578], [247.5, 2.24244], [247.6, 2.52985], [247.7, 2.82855], [247.8, 3.13912], [247.9, 3.46216], [248, 3.79833], [248.1, 4.14833], [248.2, 4.5129], [248.3, 4.89285], [248.4, 5.28902], [248.5, 5.70236], [248.6, 6.13384], [248.7, 6.58454], [248.8, 7.05562], [248.9, 7.5483], [249, 8.06395], [249.1, 8.60402], [249.2, 9.17009], [249.3, 9.7639], [249.4, 10.3873], [249.5, 11.0424], [249.6, 11.7313], [249.7, 12.4566], [249.8, 13.2209], [249.9, 14.0272], [250, 14.8788], [250.1, 15.7792], [250.2, 16.7325], [250.3, 17.7432], [250.4, 18.8161], [250.5, 19.9568], [250.6, -5], [250.6, -5], [250.6, -5], [250.6, -5], [250.6, -5], [250.6, -5], [250.6, -5], [250.6, -5], [250.6, -5], [250.6, -5], [250.6, -5], [250.6, -5], [250.6, -5], [250.6, -5], [250.6, -5], [250.6, -5], [250.6, -5], [250.6, -5], [250.6, -5], [250.6, -5], [250.6, -5], [250.6, -5], [250.6, -5], [250.6, -5], [250.6, -5], [250.6, -5], [250.6, -5], [250.6, -5], [250.6, -5], [250.6, -5], [250.6, -5], [250.6, -5], [250.6, -5], [250.6, -5], [250.6, -5], [250.6, -5], [250.6, -5], [250.6, -5], [250.6, -5], [250.6, -5], [250.6, -5], [250.6, -5], [250.6, -5], [250.6, -5], [250.6, -5], [250.6, -5], [250.6, -5], [250.6, -5], [250.6, -5], [250.6, -5], [250.6, -5], [250.6, -5], [250.7, -4.9569], [250.8, -4.91258], [250.9, -4.867], [251, -4.82011], [251.1, -4.77188], [251.2, -4.72226], [251.3, -4.67121], [251.4, -4.61869], [251.5, -4.56465], [251.6, -4.50905], [251.7, -4.45182], [251.8, -4.39292], [251.9, -4.3323], [252, -4.26991], [252.1, -4.20567], [252.2, -4.13954], [252.3, -4.07144], [252.4, -4.00133], [252.5, -3.92912], [252.6, -3.85475], [252.7, -3.77814], [252.8, -3.69923], [252.9, -3.61793], [253, -3.53415], [253.1, -3.44782], [253.2, -3.35885], [253.3, -3.26714], [253.4, -3.1726], [253.5, -3.07513], [253.6, -2.97461], [253.7, -2.87095], [253.8, -2.76403], [253.9, -2.65373], [254, -2.53993], [254.1, -2.42249], [254.2, -2.30127], [254.3, -2.17615], [254.4, -2.04696], [254.5, -1.91356], [254.6, -1.77577], [254.7, -1.63343], [254.8, -1.48636], [254.9, -1.33437], [255, -1.17726], [255.1, -1.01482], [255.2, -0.846831], [255.3, -0.673069], [255.4, -0.493288], [255.5, -0.307233], [255.6, -0.114636], [255.7, 0.0847891], [255.8, 0.29134], [255.9, 0.505334], [256, 0.727106], [256.1, 0.95701], [256.2, 1.19542], [256.3, 1.44273], [256.4, 1.69937], [256.5, 1.96578], [256.6, 2.24244], [256.7, 2.52985], [256.8, 2.82855], [256.9, 3.13912], [257, 3.46216], [257.1, 3.79833], [257.2, 4.14833], [257.3, 4.5129], [257.4, 4.89285], [257.5, 5.28902], [257.6, 5.70236], [257.7, 6.13384], [257.8, 6.58454], [257.9, 7.05562], [258, 7.5483], [258.1, 8.06395], [258.2, 8.60402], [258.3, 9.17009], [258.4, 9.7639], [258.5, 10.3873], [258.6, 11.0424], [258.7, 11.7313], [258.8, 12.4566], [258.9, 13.2209], [259, 14.0272], [259.1, 14.8788], [259.2, 15.7792], [259.3, 16.7325], [259.4, 17.7432], [259.5, 18.8161], [259.6, 19.9568], [259.7, -5], [259.7, -5], [259.7, -5], [259.7, -5], [259.7, -5], [259.7, -5], [259.7, -5], [259.7, -5], [259.7, -5], [259.7, -5], [259.7, -5], [259.7, -5], [259.7, -5], [259.7, -5], [259.7, -5], [259.7, -5], [259.7, -5], [259.7, -5], [259.7, -5], [259.7, -5], [259.7, -5], [259.7, -5], [259.7, -5], [259.7, -5], [259.7, -5], [259.7, -5], [259.7, -5], [259.7, -5], [259.7, -5], [259.7, -5], [259.7, -5], [259.7, -5], [259.7, -5], [259.7, -5], [259.7, -5], [259.7, -5], [259.7, -5], [259.7, -5], [259.7, -5], [259.7, -5], [259.7, -5], [259.7, -5], [259.7, -5], [259.7, -5], [259.7, -5], [259.7, -5], [259.7, -5], [259.7, -5], [259.7, -5], [259.7, -5], [259.7, -5], [259.7, -5], [259.8, -4.9569], [259.9, -4.91258], [260, -4.867], [260.1, -4.82011], [260.2, -4.77188], [260.3, -4.72226], [260.4, -4.67121], [260.5, -4.61869], [260.6, -4.56465], [260.7, -4.50905], [260.8, -4.45182], [260.9, -4.39292], [261, -4.3323], [261.1, -4.26991], [261.2, -4.20567], [261.3, -4.13954], [261.4, -4.07144], [261.5, -4.00133], [261.6, -3.92912], [261.7, -3.85475], [261.8, -3.77814], [261.9, -3.69923], [262, -3.61793], [262.1, -3.53415], [262.2, -3.44782], [262.3, -3.35885], [262.4, -3.26714], [262.5, -3.1726], [262.6, -3.07513], [262.7, -2.97461], [262.8, -2.87095], [262.9, -2.76403], [263, -2.65373], [263.1, -2.53993], [263.2, -2.42249], [263.3, -2.30127], [263.4, -2.17615], [263.5, -2.04696], [263.6, -1.91356], [263.7, -1.77577], [263.8, -1.63343], [263.9, -1.48636], [264, -1.33437], [264.1, -1.17726], [264.2, -1.01482], [264.3, -0.846831], [264.4, -0.673069], [264.5, -0.493288], [264.6, -0.307233], [264.7, -0.114636], [264.8, 0.0847891], [264.9, 0.29134], [265, 0.505334], [265.1, 0.727106], [265.2, 0.95701], [265.3, 1.19542], [265.4, 1.44273], [265.5, 1.69937], [265.6, 1.96578], [265.7, 2.24244], [265.8, 2.52985], [265.9, 2.82855], [266, 3.13912], [266.1, 3.46216], [266.2, 3.79833], [266.3, 4.14833], [266.4, 4.5129], [266.5, 4.89285], [266.6, 5.28902], [266.7, 5.70236], [266.8, 6.13384], [266.9, 6.58454], [267, 7.05562], [267.1, 7.5483], [267.2, 8.06395], [267.3, 8.60402], [267.4, 9.17009], [267.5, 9.7639], [267.6, 10.3873], [267.7, 11.0424], [267.8, 11.7313], [267.9, 12.4566], [268, 13.2209], [268.1, 14.0272], [268.2, 14.8788], [268.3, 15.7792], [268.4, 16.7325], [268.5, 17.7432], [268.6, 18.8161], [268.7, 19.9568], [268.8, -5], [268.8, -5], [268.8, -5], [268.8, -5], [268.8, -5], [268.8, -5], [268.8, -5], [268.8, -5], [268.8, -5], [268.8, -5], [268.8, -5], [268.8, -5], [268.8, -5], [268.8, -5], [268.8, -5], [268.8, -5], [268.8, -5], [268.8, -5], [268.8, -5], [268.8, -5], [268.8, -5], [268.8, -5], [268.8, -5], [268.8, -5], [268.8, -5], [268.8, -5], [268.8, -5], [268.8, -5], [268.8, -5], [268.8, -5], [268.8, -5], [268.8, -5], [268.8, -5], [268.8, -5], [268.8, -5], [268.8, -5], [268.8, -5], [268.8, -5], [268.8, -5], [268.8, -5], [268.8, -5], [268.8, -5], [268.8, -5], [268.8, -5], [268.8, -5], [268.8, -5], [268.8, -5], [268.8, -5], [268.8, -5], [268.8, -5], [268.8, -5], [268.8, -5], [268.9, -4.9569], [269, -4.91258], [269.1, -4.867], [269.2, -4.82011], [269.3, -4.77188], [269.4, -4.72226], [269.5, -4.67121], [269.6, -4.61869], [269.7, -4.56465], [269.8, -4.50905], [269.9, -4.45182], [270, -4.39292], [270.1, -4.3323], [270.2, -4.26991], [270.3, -4.20567], [270.4, -4.13954], [270.5, -4.07144], [270.6, -4.00133], [270.7, -3.92912], [270.8, -3.85475], [270.9, -3.77814], [271, -3.69923], [271.1, -3.61793], [271.2, -3.53415], [271.3, -3.44782], [271.4, -3.35885], [271.5, -3.26714], [271.6, -3.1726], [271.7, -3.07513], [271.8, -2.97461], [271.9, -2.87095], [272, -2.76403], [272.1, -2.65373], [272.2, -2.53993], [272.3, -2.42249], [272.4, -2.30127], [272.5, -2.17615], [272.6, -2.04696], [272.7, -1.91356], [272.8, -1.77577], [272.9, -1.63343], [273, -1.48636], [273.1, -1.33437], [273.2, -1.17726], [273.3, -1.01482], [273.4, -0.846831], [273.5, -0.673069], [273.6, -0.493288], [273.7, -0.307233], [273.8, -0.114636], [273.9, 0.0847891], [274, 0.29134], [274.1, 0.505334], [274.2, 0.727106], [274.3, 0.95701], [274.4, 1.19542], [274.5, 1.44273], [274.6, 1.69937], [274.7, 1.96578], [274.8, 2.24244], [274.9, 2.52985], [275, 2.82855], [275.1, 3.13912], [275.2, 3.46216], [275.3, 3.79833], [275.4, 4.14833], [275.5, 4.5129], [275.6, 4.89285], [275.7, 5.28902], [275.8, 5.70236], [275.9, 6.13384], [276, 6.58454], [276.1, 7.05562], [276.2, 7.5483], [276.3, 8.06395], [276.4, 8.60402], [276.5, 9.17009], [276.6, 9.7639], [276.7, 10.3873], [276.8, 11.0424], [276.9, 11.7313], [277, 12.4566], [277.1, 13.2209], [277.2, 14.0272], [277.3, 14.8788], [277.4, 15.7792], [277.5, 16.7325], [277.6, 17.7432], [277.7, 18.8161], [277.8, 19.9568], [277.9, -5], [277.9, -5], [277.9, -5], [277.9, -5], [277.9, -5], [277.9, -5], [277.9, -5], [277.9, -5], [277.9, -5], [277.9, -5], [277.9, -5], [277.9, -5], [277.9, -5], [277.9, -5], [277.9, -5], [277.9, -5], [277.9, -5], [277.9, -5], [277.9, -5], [277.9, -5], [277.9, -5], [277.9, -5], [277.9, -5], [277.9, -5], [277.9, -5], [277.9, -5], [277.9, -5], [277.9, -5], [277.9, -5], [277.9, -5], [277.9, -5], [277.9, -5], [277.9, -5], [277.9, -5], [277.9, -5], [277.9, -5], [277.9, -5], [277.9, -5], [277.9, -5], [277.9, -5], [277.9, -5], [277.9, -5], [277.9, -5], [277.9, -5], [277.9, -5], [277.9, -5], [277.9, -5], [277.9, -5], [277.9, -5], [277.9, -5], [277.9, -5], [277.9, -5], [278, -4.9569], [278.1, -4.91258], [278.2, -4.867], [278.3, -4.82011], [278.4, -4.77188], [278.5, -4.72226], [278.6, -4.67121], [278.7, -4.61869], [278.8, -4.56465], [278.9, -4.50905], [279, -4.45182], [279.1, -4.39292], [279.2, -4.3323], [279.3, -4.26991], [279.4, -4.20567], [279.5, -4.13954], [279.6, -4.07144], [279.7, -4.00133], [279.8, -3.92912], [279.9, -3.85475], [280, -3.77814], [280.1, -3.69923], [280.2, -3.61793], [280.3, -3.53415], [280.4, -3.44782], [280.5, -3.35885], [280.6, -3.26714], [280.7, -3.1726], [280.8, -3.07513], [280.9, -2.97461], [281, -2.87095], [281.1, -2.76403], [281.2, -2.65373], [281.3, -2.53993], [281.4, -2.42249], [281.5, -2.30127], [281.6, -2.17615], [281.7, -2.04696], [281.8, -1.91356], [281.9, -1.77577], [282, -1.63343], [282.1, -1.48636], [282.2, -1.33437], [282.3, -1.17726], [282.4, -1.01482], [282.5, -0.846831], [282.6, -0.673069], [282.7, -0.493288], [282.8, -0.307233], [282.9, -0.114636], [283, 0.0847891], [283.1, 0.29134], [283.2, 0.505334], [283.3, 0.727106], [283.4, 0.95701], [283.5, 1.19542], [283.6, 1.44273], [283.7, 1.69937], [283.8, 1.96578], [283.9, 2.24244], [284, 2.52985], [284.1, 2.82855], [284.2, 3.13912], [284.3, 3.46216], [284.4, 3.79833], [284.5, 4.14833], [284.6, 4.5129], [284.7, 4.89285], [284.8, 5.28902], [284.9, 5.70236], [285, 6.13384], [285.1, 6.58454], [285.2, 7.05562], [285.3, 7.5483], [285.4, 8.06395], [285.5, 8.60402], [285.6, 9.17009], [285.7, 9.7639], [285.8, 10.3873], [285.9, 11.0424], [286, 11.7313], [286.1, 12.4566], [286.2, 13.2209], [286.3, 14.0272], [286.4, 14.8788], [286.5, 15.7792], [286.6, 16.7325], [286.7, 17.7432], [286.8, 18.8161], [286.9, 19.9568], [287, -5], [287, -5], [287, -5], [287, -5], [287, -5], [287, -5], [287, -5], [287, -5], [287, -5], [287, -5], [287, -5], [287, -5], [287, -5], [287, -5], [287, -5], [287, -5], [287, -5], [287, -5], [287, -5], [287, -5], [287, -5], [287, -5], [287, -5], [287, -5], [287, -5], [287, -5], [287, -5], [287, -5], [287, -5], [287, -5], [287, -5], [287, -5], [287, -5], [287, -5], [287, -5], [287, -5], [287, -5], [287, -5], [287, -5], [287, -5], [287, -5], [287, -5], [287, -5], [287, -5], [287, -5], [287, -5], [287, -5], [287, -5], [287, -5], [287, -5], [287, -5], [287, -5], [287.1, -4.9569], [287.2, -4.91258], [287.3, -4.867], [287.4, -4.82011], [287.5, -4.77188], [287.6, -4.72226], [287.7, -4.67121], [287.8, -4.61869], [287.9, -4.56465], [288, -4.50905], [288.1, -4.45182], [288.2, -4.39292], [288.3, -4.3323], [288.4, -4.26991], [288.5, -4.20567], [288.6, -4.13954], [288.7, -4.07144], [288.8, -4.00133], [288.9, -3.92912], [289, -3.85475], [289.1, -3.77814], [289.2, -3.69923], [289.3, -3.61793], [289.4, -3.53415], [289.5, -3.44782], [289.6, -3.35885], [289.7, -3.26714], [289.8, -3.1726], [289.9, -3.07513], [290, -2.97461], [290.1, -2.87095], [290.2, -2.76403], [290.3, -2.65373], [290.4, -2.53993], [290.5, -2.42249], [290.6, -2.30127], [290.7, -2.17615], [290.8, -2.04696], [290.9, -1.91356], [291, -1.77577], [291.1, -1.63343], [291.2, -1.48636], [291.3, -1.33437], [291.4, -1.17726], [291.5, -1.01482], [291.6, -0.846831], [291.7, -0.673069], [291.8, -0.493288], [291.9, -0.307233], [292, -0.114636], [292.1, 0.0847891], [292.2, 0.29134], [292.3, 0.505334], [292.4, 0.727106], [292.5, 0.95701], [292.6, 1.19542], [292.7, 1.44273], [292.8, 1.69937], [292.9, 1.96578], [293, 2.24244], [293.1, 2.52985], [293.2, 2.82855], [293.3, 3.13912], [293.4, 3.46216], [293.5, 3.79833], [293.6, 4.14833], [293.7, 4.5129], [293.8, 4.89285], [293.9, 5.28902], [294, 5.70236], [294.1, 6.13384], [294.2, 6.58454], [294.3, 7.05562], [294.4, 7.5483], [294.5, 8.06395], [294.6, 8.60402], [294.7, 9.17009], [294.8, 9.7639], [294.9, 10.3873], [295, 11.0424], [295.1, 11.7313], [295.2, 12.4566], [295.3, 13.2209], [295.4, 14.0272], [295.5, 14.8788], [295.6, 15.7792], [295.7, 16.7325], [295.8, 17.7432], [295.9, 18.8161], [296, 19.9568], [296.1, -5], [296.1, -5], [296.1, -5], [296.1, -5], [296.1, -5], [296.1, -5], [296.1, -5], [296.1, -5], [296.1, -5], [296.1, -5], [296.1, -5], [296.1, -5], [296.1, -5], [296.1, -5], [296.1, -5], [296.1, -5], [296.1, -5], [296.1, -5], [296.1, -5], [296.1, -5], [296.1, -5], [296.1, -5], [296.1, -5], [296.1, -5], [296.1, -5], [296.1, -5], [296.1, -5], [296.1, -5], [296.1, -5], [296.1, -5], [296.1, -5], [296.1, -5], [296.1, -5], [296.1, -5], [296.1, -5], [296.1, -5], [296.1, -5], [296.1, -5], [296.1, -5], [296.1, -5], [296.1, -5], [296.1, -5], [296.1, -5], [296.1, -5], [296.1, -5], [296.1, -5], [296.1, -5], [296.1, -5], [296.1, -5], [296.1, -5], [296.1, -5], [296.1, -5], [296.2, -4.9569], [296.3, -4.91258], [296.4, -4.867], [296.5, -4.82011], [296.6, -4.77188], [296.7, -4.72226], [296.8, -4.67121], [296.9, -4.61869], [297, -4.56465], [297.1, -4.50905], [297.2, -4.45182], [297.3, -4.39292], [297.4, -4.3323], [297.5, -4.26991], [297.6, -4.20567], [297.7, -4.13954], [297.8, -4.07144], [297.9, -4.00133], [298, -3.92912], [298.1, -3.85475], [298.2, -3.77814], [298.3, -3.69923], [298.4, -3.61793], [298.5, -3.53415], [298.6, -3.44782], [298.7, -3.35885], [298.8, -3.26714], [298.9, -3.1726], [299, -3.07513], [299.1, -2.97461], [299.2, -2.87095], [299.3, -2.76403], [299.4, -2.65373], [299.5, -2.53993], [299.6, -2.42249], [299.7, -2.30127], [299.8, -2.17615], [299.9, -2.04696], [300, -1.91356], [300.1, -1.77577], [300.2, -1.63343], [300.3, -1.48636], [300.4, -1.33437], [300.5, -1.17726], [300.6, -1.01482], [300.7, -0.846831], [300.8, -0.673069], [300.9, -0.493288], [301, -0.307233], [301.1, -0.114636], [301.2, 0.0847891], [301.3, 0.29134], [301.4, 0.505334], [301.5, 0.727106], [301.6, 0.95701], [301.7, 1.19542], [301.8, 1.44273], [301.9, 1.69937], [302, 1.96578], [302.1, 2.24244], [302.2, 2.52985], [302.3, 2.82855], [302.4, 3.13912], [302.5, 3.46216], [302.6, 3.79833], [302.7, 4.14833], [302.8, 4.5129], [302.9, 4.89285], [303, 5.28902], [303.1, 5.70236], [303.2, 6.13384], [303.3, 6.58454], [303.4, 7.05562], [303.5, 7.5483], [303.6, 8.06395], [303.7, 8.60402], [303.8, 9.17009], [303.9, 9.7639], [304, 10.3873], [304.1, 11.0424], [304.2, 11.7313], [304.3, 12.4566], [304.4, 13.2209], [304.5, 14.0272], [304.6, 14.8788], [304.7, 15.7792], [304.8, 16.7325], [304.9, 17.7432], [305, 18.8161], [305.1, 19.9568], [305.2, -5], [305.2, -5], [305.2, -5], [305.2, -5], [305.2, -5], [305.2, -5], [305.2, -5], [305.2, -5], [305.2, -5], [305.2, -5], [305.2, -5], [305.2, -5], [305.2, -5], [305.2, -5], [305.2, -5], [305.2, -5], [305.2, -5], [305.2, -5], [305.2, -5], [305.2, -5], [305.2, -5], [305.2, -5], [305.2, -5], [305.2, -5], [305.2, -5], [305.2, -5], [305.2, -5], [305.2, -5], [305.2, -5], [305.2, -5], [305.2, -5], [305.2, -5], [305.2, -5], [305.2, -5], [305.2, -5], [305.2, -5], [305.2, -5], [305.2, -5], [305.2, -5], [305.2, -5], [305.2, -5], [305.2, -5], [305.2, -5], [305.2, -5], [305.2, -5], [305.2, -5], [305.2, -5], [305.2, -5], [305.2, -5], [305.2, -5], [305.2, -5], [305.2, -5], [305.3, -4.9569], [305.4, -4.91258], [305.5, -4.867], [305.6, -4.82011], [305.7, -4.77188], [305.8, -4.72226], [305.9, -4.67121], [306, -4.61869], [306.1, -4.56465], [306.2, -4.50905], [306.3, -4.45182], [306.4, -4.39292], [306.5, -4.3323], [306.6, -4.26991], [306.7, -4.20567], [306.8, -4.13954], [306.9, -4.07144], [307, -4.00133], [307.1, -3.92912], [307.2, -3.85475], [307.3, -3.77814], [307.4, -3.69923], [307.5, -3.61793], [307.6, -3.53415], [307.7, -3.44782], [307.8, -3.35885], [307.9, -3.26714], [308, -3.1726], [308.1, -3.07513], [308.2, -2.97461], [308.3, -2.87095], [308.4, -2.76403], [308.5, -2.65373], [308.6, -2.53993], [308.7, -2.42249], [308.8, -2.30127], [308.9, -2.17615], [309, -2.04696], [309.1, -1.91356], [309.2, -1.77577], [309.3, -1.63343], [309.4, -1.48636], [309.5, -1.33437], [309.6, -1.17726], [309.7, -1.01482], [309.8, -0.846831], [309.9, -0.673069], [310, -0.493288], [310.1, -0.307233], [310.2, -0.114636], [310.3, 0.0847891], [310.4, 0.29134], [310.5, 0.505334], [310.6, 0.727106], [310.7, 0.95701], [310.8, 1.19542], [310.9, 1.44273], [311, 1.69937], [311.1, 1.96578], [311.2, 2.24244], [311.3, 2.52985], [311.4, 2.82855], [311.5, 3.13912], [311.6, 3.46216], [311.7, 3.79833], [311.8, 4.14833], [311.9, 4.5129], [312, 4.89285], [312.1, 5.28902], [312.2, 5.70236], [312.3, 6.13384], [312.4, 6.58454], [312.5, 7.05562], [312.6, 7.5483], [312.7, 8.06395], [312.8, 8.60402], [312.9, 9.17009], [313, 9.7639], [313.1, 10.3873], [313.2, 11.0424], [313.3, 11.7313], [313.4, 12.4566], [313.5, 13.2209], [313.6, 14.0272], [313.7, 14.8788], [313.8, 15.7792], [313.9, 16.7325], [314, 17.7432], [314.1, 18.8161], [314.2, 19.9568], [314.3, -5], [314.3, -5], [314.3, -5], [314.3, -5], [314.3, -5], [314.3, -5], [314.3, -5], [314.3, -5], [314.3, -5], [314.3, -5], [314.3, -5], [314.3, -5], [314.3, -5], [314.3, -5], [314.3, -5], [314.3, -5], [314.3, -5], [314.3, -5], [314.3, -5], [314.3, -5], [314.3, -5], [314.3, -5], [314.3, -5], [314.3, -5], [314.3, -5], [314.3, -5], [314.3, -5], [314.3, -5], [314.3, -5], [314.3, -5], [314.3, -5], [314.3, -5], [314.3, -5], [314.3, -5], [314.3, -5], [314.3, -5], [314.3, -5], [314.3, -5], [314.3, -5], [314.3, -5], [314.3, -5], [314.3, -5], [314.3, -5], [314.3, -5], [314.3, -5], [314.3, -5], [314.3, -5], [314.3, -5], [314.3, -5], [314.3, -5], [314.3, -5], [314.3, -5], [314.4, -4.9569], [314.5, -4.91258], [314.6, -4.867], [314.7, -4.82011], [314.8, -4.77188], [314.9, -4.72226], [315, -4.67121], [315.1, -4.61869], [315.2, -4.56465], [315.3, -4.50905], [315.4, -4.45182], [315.5, -4.39292], [315.6, -4.3323], [315.7, -4.26991], [315.8, -4.20567], [315.9, -4.13954], [316, -4.07144], [316.1, -4.00133], [316.2, -3.92912], [316.3, -3.85475], [316.4, -3.77814], [316.5, -3.69923], [316.6, -3.61793], [316.7, -3.53415], [316.8, -3.44782], [316.9, -3.35885], [317, -3.26714], [317.1, -3.1726], [317.2, -3.07513], [317.3, -2.97461], [317.4, -2.87095], [317.5, -2.76403], [317.6, -2.65373], [317.7, -2.53993], [317.8, -2.42249], [317.9, -2.30127], [318, -2.17615], [318.1, -2.04696], [318.2, -1.91356], [318.3, -1.77577], [318.4, -1.63343], [318.5, -1.48636], [318.6, -1.33437], [318.7, -1.17726], [318.8, -1.01482], [318.9, -0.846831], [319, -0.673069], [319.1, -0.493288], [319.2, -0.307233], [319.3, -0.114636], [319.4, 0.0847891], [319.5, 0.29134], [319.6, 0.505334], [319.7, 0.727106], [319.8, 0.95701], [319.9, 1.19542], [320, 1.44273], [320.1, 1.69937], [320.2, 1.96578], [320.3, 2.24244], [320.4, 2.52985], [320.5, 2.82855], [320.6, 3.13912], [320.7, 3.46216], [320.8, 3.79833], [320.9, 4.14833], [321, 4.5129], [321.1, 4.89285], [321.2, 5.28902], [321.3, 5.70236], [321.4, 6.13384], [321.5, 6.58454], [321.6, 7.05562], [321.7, 7.5483], [321.8, 8.06395], [321.9, 8.60402], [322, 9.17009], [322.1, 9.7639], [322.2, 10.3873], [322.3, 11.0424], [322.4, 11.7313], [322.5, 12.4566], [322.6, 13.2209], [322.7, 14.0272], [322.8, 14.8788], [322.9, 15.7792], [323, 16.7325], [323.1, 17.7432], [323.2, 18.8161], [323.3, 19.9568], [323.4, -5], [323.4, -5], [323.4, -5], [323.4, -5], [323.4, -5], [323.4, -5], [323.4, -5], [323.4, -5], [323.4, -5], [323.4, -5], [323.4, -5], [323.4, -5], [323.4, -5], [323.4, -5], [323.4, -5], [323.4, -5], [323.4, -5], [323.4, -5], [323.4, -5], [323.4, -5], [323.4, -5], [323.4, -5], [323.4, -5], [323.4, -5], [323.4, -5], [323.4, -5], [323.4, -5], [323.4, -5], [323.4, -5], [323.4, -5], [323.4, -5], [323.4, -5], [323.4, -5], [323.4, -5], [323.4, -5], [323.4, -5], [323.4, -5], [323.4, -5], [323.4, -5], [323.4, -5], [323.4, -5], [323.4, -5], [323.4, -5], [323.4, -5], [323.4, -5], [323.4, -5], [323.4, -5], [323.4, -5], [323.4, -5], [323.4, -5], [323.4, -5], [323.4, -5], [323.5, -4.9569], [323.6, -4.91258], [323.7, -4.867], [323.8, -4.82011], [323.9, -4.77188], [324, -4.72226], [324.1, -4.67121], [324.2, -4.61869], [324.3, -4.56465], [324.4, -4.50905], [324.5, -4.45182], [324.6, -4.39292], [324.7, -4.3323], [324.8, -4.26991], [324.9, -4.20567], [325, -4.13954], [325.1, -4.07144], [325.2, -4.00133], [325.3, -3.92912], [325.4, -3.85475], [325.5, -3.77814], [325.6, -3.69923], [325.7, -3.61793], [325.8, -3.53415], [325.9, -3.44782], [326, -3.35885], [326.1, -3.26714], [326.2, -3.1726], [326.3, -3.07513], [326.4, -2.97461], [326.5, -2.87095], [326.6, -2.76403], [326.7, -2.65373], [326.8, -2.53993], [326.9, -2.42249], [327, -2.30127], [327.1, -2.17615], [327.2, -2.04696], [327.3, -1.91356], [327.4, -1.77577], [327.5, -1.63343], [327.6, -1.48636], [327.7, -1.33437], [327.8, -1.17726], [327.9, -1.01482], [328, -0.846831], [328.1, -0.673069], [328.2, -0.493288], [328.3, -0.307233], [328.4, -0.114636], [328.5, 0.0847891], [328.6, 0.29134], [328.7, 0.505334], [328.8, 0.727106], [328.9, 0.95701], [329, 1.19542], [329.1, 1.44273], [329.2, 1.69937], [329.3, 1.96578], [329.4, 2.24244], [329.5, 2.52985], [329.6, 2.82855], [329.7, 3.13912], [329.8, 3.46216], [329.9, 3.79833], [330, 4.14833], [330.1, 4.5129], [330.2, 4.89285], [330.3, 5.28902], [330.4, 5.70236], [330.5, 6.13384], [330.6, 6.58454], [330.7, 7.05562], [330.8, 7.5483], [330.9, 8.06395], [331, 8.60402], [331.1, 9.17009], [331.2, 9.7639], [331.3, 10.3873], [331.4, 11.0424], [331.5, 11.7313], [331.6, 12.4566], [331.7, 13.2209], [331.8, 14.0272], [331.9, 14.8788], [332, 15.7792], [332.1, 16.7325], [332.2, 17.7432], [332.3, 18.8161], [332.4, 19.9568], [332.5, -5], [332.5, -5], [332.5, -5], [332.5, -5], [332.5, -5], [332.5, -5], [332.5, -5], [332.5, -5], [332.5, -5], [332.5, -5], [332.5, -5], [332.5, -5], [332.5, -5], [332.5, -5], [332.5, -5], [332.5, -5], [332.5, -5], [332.5, -5], [332.5, -5], [332.5, -5], [332.5, -5], [332.5, -5], [332.5, -5], [332.5, -5], [332.5, -5], [332.5, -5], [332.5, -5], [332.5, -5], [332.5, -5], [332.5, -5], [332.5, -5], [332.5, -5], [332.5, -5], [332.5, -5], [332.5, -5], [332.5, -5], [332.5, -5], [332.5, -5], [332.5, -5], [332.5, -5], [332.5, -5], [332.5, -5], [332.5, -5], [332.5, -5], [332.5, -5], [332.5, -5], [332.5, -5], [332.5, -5], [332.5, -5], [332.5, -5], [332.5, -5], [332.5, -5], [332.6, -4.9569], [332.7, -4.91258], [332.8, -4.867], [332.9, -4.82011], [333, -4.77188], [333.1, -4.72226], [333.2, -4.67121], [333.3, -4.61869], [333.4, -4.56465], [333.5, -4.50905], [333.6, -4.45182], [333.7, -4.39292], [333.8, -4.3323], [333.9, -4.26991], [334, -4.20567], [334.1, -4.13954], [334.2, -4.07144], [334.3, -4.00133], [334.4, -3.92912], [334.5, -3.85475], [334.6, -3.77814], [334.7, -3.69923], [334.8, -3.61793], [334.9, -3.53415], [335, -3.44782], [335.1, -3.35885], [335.2, -3.26714], [335.3, -3.1726], [335.4, -3.07513], [335.5, -2.97461], [335.6, -2.87095], [335.7, -2.76403], [335.8, -2.65373], [335.9, -2.53993], [336, -2.42249], [336.1, -2.30127], [336.2, -2.17615], [336.3, -2.04696], [336.4, -1.91356], [336.5, -1.77577], [336.6, -1.63343], [336.7, -1.48636], [336.8, -1.33437], [336.9, -1.17726], [337, -1.01482], [337.1, -0.846831], [337.2, -0.673069], [337.3, -0.493288], [337.4, -0.307233], [337.5, -0.114636], [337.6, 0.0847891], [337.7, 0.29134], [337.8, 0.505334], [337.9, 0.727106], [338, 0.95701], [338.1, 1.19542], [338.2, 1.44273], [338.3, 1.69937], [338.4, 1.96578], [338.5, 2.24244], [338.6, 2.52985], [338.7, 2.82855], [338.8, 3.13912], [338.9, 3.46216], [339, 3.79833], [339.1, 4.14833], [339.2, 4.5129], [339.3, 4.89285], [339.4, 5.28902], [339.5, 5.70236], [339.6, 6.13384], [339.7, 6.58454], [339.8, 7.05562], [339.9, 7.5483], [340, 8.06395], [340.1, 8.60402], [340.2, 9.17009], [340.3, 9.7639], [340.4, 10.3873], [340.5, 11.0424], [340.6, 11.7313], [340.7, 12.4566], [340.8, 13.2209], [340.9, 14.0272], [341, 14.8788], [341.1, 15.7792], [341.2, 16.7325], [341.3, 17.7432], [341.4, 18.8161], [341.5, 19.9568], [341.6, -5], [341.6, -5], [341.6, -5], [341.6, -5], [341.6, -5], [341.6, -5], [341.6, -5], [341.6, -5], [341.6, -5], [341.6, -5], [341.6, -5], [341.6, -5], [341.6, -5], [341.6, -5], [341.6, -5], [341.6, -5], [341.6, -5], [341.6, -5], [341.6, -5], [341.6, -5], [341.6, -5], [341.6, -5], [341.6, -5], [341.6, -5], [341.6, -5], [341.6, -5], [341.6, -5], [341.6, -5], [341.6, -5], [341.6, -5], [341.6, -5], [341.6, -5], [341.6, -5], [341.6, -5], [341.6, -5], [341.6, -5], [341.6, -5], [341.6, -5], [341.6, -5], [341.6, -5], [341.6, -5], [341.6, -5], [341.6, -5], [341.6, -5], [341.6, -5], [341.6, -5], [341.6, -5], [341.6, -5], [341.6, -5], [341.6, -5], [341.6, -5], [341.6, -5], [341.7, -4.9569], [341.8, -4.91258], [341.9, -4.867], [342, -4.82011], [342.1, -4.77188], [342.2, -4.72226], [342.3, -4.67121], [342.4, -4.61869], [342.5, -4.56465], [342.6, -4.50905], [342.7, -4.45182], [342.8, -4.39292], [342.9, -4.3323], [343, -4.26991], [343.1, -4.20567], [343.2, -4.13954], [343.3, -4.07144], [343.4, -4.00133], [343.5, -3.92912], [343.6, -3.85475], [343.7, -3.77814], [343.8, -3.69923], [343.9, -3.61793], [344, -3.53415], [344.1, -3.44782], [344.2, -3.35885], [344.3, -3.26714], [344.4, -3.1726], [344.5, -3.07513], [344.6, -2.97461], [344.7, -2.87095], [344.8, -2.76403], [344.9, -2.65373], [345, -2.53993], [345.1, -2.42249], [345.2, -2.30127], [345.3, -2.17615], [345.4, -2.04696], [345.5, -1.91356], [345.6, -1.77577], [345.7, -1.63343], [345.8, -1.48636], [345.9, -1.33437], [346, -1.17726], [346.1, -1.01482], [346.2, -0.846831], [346.3, -0.673069], [346.4, -0.493288], [346.5, -0.307233], [346.6, -0.114636], [346.7, 0.0847891], [346.8, 0.29134], [346.9, 0.505334], [347, 0.727106], [347.1, 0.95701], [347.2, 1.19542], [347.3, 1.44273], [347.4, 1.69937], [347.5, 1.96578], [347.6, 2.24244], [347.7, 2.52985], [347.8, 2.82855], [347.9, 3.13912], [348, 3.46216], [348.1, 3.79833], [348.2, 4.14833], [348.3, 4.5129], [348.4, 4.89285], [348.5, 5.28902], [348.6, 5.70236], [348.7, 6.13384], [348.8, 6.58454], [348.9, 7.05562], [349, 7.5483], [349.1, 8.06395], [349.2, 8.60402], [349.3, 9.17009], [349.4, 9.7639], [349.5, 10.3873], [349.6, 11.0424], [349.7, 11.7313], [349.8, 12.4566], [349.9, 13.2209], [350, 14.0272], [350.1, 14.8788], [350.2, 15.7792], [350.3, 16.7325], [350.4, 17.7432], [350.5, 18.8161], [350.6, 19.9568], [350.7, -5], [350.7, -5], [350.7, -5], [350.7, -5], [350.7, -5], [350.7, -5], [350.7, -5], [350.7, -5], [350.7, -5], [350.7, -5], [350.7, -5], [350.7, -5], [350.7, -5], [350.7, -5], [350.7, -5], [350.7, -5], [350.7, -5], [350.7, -5], [350.7, -5], [350.7, -5], [350.7, -5], [350.7, -5], [350.7, -5], [350.7, -5], [350.7, -5], [350.7, -5], [350.7, -5], [350.7, -5], [350.7, -5], [350.7, -5], [350.7, -5], [350.7, -5], [350.7, -5], [350.7, -5], [350.7, -5], [350.7, -5], [350.7, -5], [350.7, -5], [350.7, -5], [350.7, -5], [350.7, -5], [350.7, -5], [350.7, -5], [350.7, -5], [350.7, -5], [350.7, -5], [350.7, -5], [350.7, -5], [350.7, -5], [350.7, -5], [350.7, -5], [350.7, -5], [350.8, -4.9569], [350.9, -4.91258], [351, -4.867], [351.1, -4.82011], [351.2, -4.77188], [351.3, -4.72226], [351.4, -4.67121], [351.5, -4.61869], [351.6, -4.56465], [351.7, -4.50905], [351.8, -4.45182], [351.9, -4.39292], [352, -4.3323], [352.1, -4.26991], [352.2, -4.20567], [352.3, -4.13954], [352.4, -4.07144], [352.5, -4.00133], [352.6, -3.92912], [352.7, -3.85475], [352.8, -3.77814], [352.9, -3.69923], [353, -3.61793], [353.1, -3.53415], [353.2, -3.44782], [353.3, -3.35885], [353.4, -3.26714], [353.5, -3.1726], [353.6, -3.07513], [353.7, -2.97461], [353.8, -2.87095], [353.9, -2.76403], [354, -2.65373], [354.1, -2.53993], [354.2, -2.42249], [354.3, -2.30127], [354.4, -2.17615], [354.5, -2.04696], [354.6, -1.91356], [354.7, -1.77577], [354.8, -1.63343], [354.9, -1.48636], [355, -1.33437], [355.1, -1.17726], [355.2, -1.01482], [355.3, -0.846831], [355.4, -0.673069], [355.5, -0.493288], [355.6, -0.307233], [355.7, -0.114636], [355.8, 0.0847891], [355.9, 0.29134], [356, 0.505334], [356.1, 0.727106], [356.2, 0.95701], [356.3, 1.19542], [356.4, 1.44273], [356.5, 1.69937], [356.6, 1.96578], [356.7, 2.24244], [356.8, 2.52985], [356.9, 2.82855], [357, 3.13912], [357.1, 3.46216], [357.2, 3.79833], [357.3, 4.14833], [357.4, 4.5129], [357.5, 4.89285], [357.6, 5.28902], [357.7, 5.70236], [357.8, 6.13384], [357.9, 6.58454], [358, 7.05562], [358.1, 7.5483], [358.2, 8.06395], [358.3, 8.60402], [358.4, 9.17009], [358.5, 9.7639], [358.6, 10.3873], [358.7, 11.0424], [358.8, 11.7313], [358.9, 12.4566], [359, 13.2209], [359.1, 14.0272], [359.2, 14.8788], [359.3, 15.7792], [359.4, 16.7325], [359.5, 17.7432], [359.6, 18.8161], [359.7, 19.9568], [359.8, -5], [359.8, -5], [359.8, -5], [359.8, -5], [359.8, -5], [359.8, -5], [359.8, -5], [359.8, -5], [359.8, -5], [359.8, -5], [359.8, -5], [359.8, -5], [359.8, -5], [359.8, -5], [359.8, -5], [359.8, -5], [359.8, -5], [359.8, -5], [359.8, -5], [359.8, -5], [359.8, -5], [359.8, -5], [359.8, -5], [359.8, -5], [359.8, -5], [359.8, -5], [359.8, -5], [359.8, -5], [359.8, -5], [359.8, -5], [359.8, -5], [359.8, -5], [359.8, -5], [359.8, -5], [359.8, -5], [359.8, -5], [359.8, -5], [359.8, -5], [359.8, -5], [359.8, -5], [359.8, -5], [359.8, -5], [359.8, -5], [359.8, -5], [359.8, -5], [359.8, -5], [359.8, -5], [359.8, -5], [359.8, -5], [359.8, -5], [359.8, -5], [359.8, -5], [359.9, -4.9569], [360, -4.91258], [360.1, -4.867], [360.2, -4.82011], [360.3, -4.77188], [360.4, -4.72226], [360.5, -4.67121], [360.6, -4.61869], [360.7, -4.56465], [360.8, -4.50905], [360.9, -4.45182], [361, -4.39292], [361.1, -4.3323], [361.2, -4.26991], [361.3, -4.20567], [361.4, -4.13954], [361.5, -4.07144], [361.6, -4.00133], [361.7, -3.92912], [361.8, -3.85475], [361.9, -3.77814], [362, -3.69923], [362.1, -3.61793], [362.2, -3.53415], [362.3, -3.44782], [362.4, -3.35885], [362.5, -3.26714], [362.6, -3.1726], [362.7, -3.07513], [362.8, -2.97461], [362.9, -2.87095], [363, -2.76403], [363.1, -2.65373], [363.2, -2.53993], [363.3, -2.42249], [363.4, -2.30127], [363.5, -2.17615], [363.6, -2.04696], [363.7, -1.91356], [363.8, -1.77577], [363.9, -1.63343], [364, -1.48636], [364.1, -1.33437], [364.2, -1.17726], [364.3, -1.01482], [364.4, -0.846831], [364.5, -0.673069], [364.6, -0.493288], [364.7, -0.307233], [364.8, -0.114636], [364.9, 0.0847891], [365, 0.29134], [365.1, 0.505334], [365.2, 0.727106], [365.3, 0.95701], [365.4, 1.19542], [365.5, 1.44273], [365.6, 1.69937], [365.7, 1.96578], [365.8, 2.24244], [365.9, 2.52985], [366, 2.82855], [366.1, 3.13912], [366.2, 3.46216], [366.3, 3.79833], [366.4, 4.14833], [366.5, 4.5129], [366.6, 4.89285], [366.7, 5.28902], [366.8, 5.70236], [366.9, 6.13384], [367, 6.58454], [367.1, 7.05562], [367.2, 7.5483], [367.3, 8.06395], [367.4, 8.60402], [367.5, 9.17009], [367.6, 9.7639], [367.7, 10.3873], [367.8, 11.0424], [367.9, 11.7313], [368, 12.4566], [368.1, 13.2209], [368.2, 14.0272], [368.3, 14.8788], [368.4, 15.7792], [368.5, 16.7325], [368.6, 17.7432], [368.7, 18.8161], [368.8, 19.9568], [368.9, -5], [368.9, -5], [368.9, -5], [368.9, -5], [368.9, -5], [368.9, -5], [368.9, -5], [368.9, -5], [368.9, -5], [368.9, -5], [368.9, -5], [368.9, -5], [368.9, -5], [368.9, -5], [368.9, -5], [368.9, -5], [368.9, -5], [368.9, -5], [368.9, -5], [368.9, -5], [368.9, -5], [368.9, -5], [368.9, -5], [368.9, -5], [368.9, -5], [368.9, -5], [368.9, -5], [368.9, -5], [368.9, -5], [368.9, -5], [368.9, -5], [368.9, -5], [368.9, -5], [368.9, -5], [368.9, -5], [368.9, -5], [368.9, -5], [368.9, -5], [368.9, -5], [368.9, -5], [368.9, -5], [368.9, -5], [368.9, -5], [368.9, -5], [368.9, -5], [368.9, -5], [368.9, -5], [368.9, -5], [368.9, -5], [368.9, -5], [368.9, -5], [368.9, -5], [369, -4.9569], [369.1, -4.91258], [369.2, -4.867], [369.3, -4.82011], [369.4, -4.77188], [369.5, -4.72226], [369.6, -4.67121], [369.7, -4.61869], [369.8, -4.56465], [369.9, -4.50905], [370, -4.45182], [370.1, -4.39292], [370.2, -4.3323], [370.3, -4.26991], [370.4, -4.20567], [370.5, -4.13954], [370.6, -4.07144], [370.7, -4.00133], [370.8, -3.92912], [370.9, -3.85475], [371, -3.77814], [371.1, -3.69923], [371.2, -3.61793], [371.3, -3.53415], [371.4, -3.44782], [371.5, -3.35885], [371.6, -3.26714], [371.7, -3.1726], [371.8, -3.07513], [371.9, -2.97461], [372, -2.87095], [372.1, -2.76403], [372.2, -2.65373], [372.3, -2.53993], [372.4, -2.42249], [372.5, -2.30127], [372.6, -2.17615], [372.7, -2.04696], [372.8, -1.91356], [372.9, -1.77577], [373, -1.63343], [373.1, -1.48636], [373.2, -1.33437], [373.3, -1.17726], [373.4, -1.01482], [373.5, -0.846831], [373.6, -0.673069], [373.7, -0.493288], [373.8, -0.307233], [373.9, -0.114636], [374, 0.0847891], [374.1, 0.29134], [374.2, 0.505334], [374.3, 0.727106], [374.4, 0.95701], [374.5, 1.19542], [374.6, 1.44273], [374.7, 1.69937], [374.8, 1.96578], [374.9, 2.24244], [375, 2.52985], [375.1, 2.82855], [375.2, 3.13912], [375.3, 3.46216], [375.4, 3.79833], [375.5, 4.14833], [375.6, 4.5129], [375.7, 4.89285], [375.8, 5.28902], [375.9, 5.70236], [376, 6.13384], [376.1, 6.58454], [376.2, 7.05562], [376.3, 7.5483], [376.4, 8.06395], [376.5, 8.60402], [376.6, 9.17009], [376.7, 9.7639], [376.8, 10.3873], [376.9, 11.0424], [377, 11.7313], [377.1, 12.4566], [377.2, 13.2209], [377.3, 14.0272], [377.4, 14.8788], [377.5, 15.7792], [377.6, 16.7325], [377.7, 17.7432], [377.8, 18.8161], [377.9, 19.9568], [378, -5], [378, -5], [378, -5], [378, -5], [378, -5], [378, -5], [378, -5], [378, -5], [378, -5], [378, -5], [378, -5], [378, -5], [378, -5], [378, -5], [378, -5], [378, -5], [378, -5], [378, -5], [378, -5], [378, -5], [378, -5], [378, -5], [378, -5], [378, -5], [378, -5], [378, -5], [378, -5], [378, -5], [378, -5], [378, -5], [378, -5], [378, -5], [378, -5], [378, -5], [378, -5], [378, -5], [378, -5], [378, -5], [378, -5], [378, -5], [378, -5], [378, -5], [378, -5], [378, -5], [378, -5], [378, -5], [378, -5], [378, -5], [378, -5], [378, -5], [378, -5], [378, -5], [378.1, -4.9569], [378.2, -4.91258], [378.3, -4.867], [378.4, -4.82011], [378.5, -4.77188], [378.6, -4.72226], [378.7, -4.67121], [378.8, -4.61869], [378.9, -4.56465], [379, -4.50905], [379.1, -4.45182], [379.2, -4.39292], [379.3, -4.3323], [379.4, -4.26991], [379.5, -4.20567], [379.6, -4.13954], [379.7, -4.07144], [379.8, -4.00133], [379.9, -3.92912], [380, -3.85475], [380.1, -3.77814], [380.2, -3.69923], [380.3, -3.61793], [380.4, -3.53415], [380.5, -3.44782], [380.6, -3.35885], [380.7, -3.26714], [380.8, -3.1726], [380.9, -3.07513], [381, -2.97461], [381.1, -2.87095], [381.2, -2.76403], [381.3, -2.65373], [381.4, -2.53993], [381.5, -2.42249], [381.6, -2.30127], [381.7, -2.17615], [381.8, -2.04696], [381.9, -1.91356], [382, -1.77577], [382.1, -1.63343], [382.2, -1.48636], [382.3, -1.33437], [382.4, -1.17726], [382.5, -1.01482], [382.6, -0.846831], [382.7, -0.673069], [382.8, -0.493288], [382.9, -0.307233], [383, -0.114636], [383.1, 0.0847891], [383.2, 0.29134], [383.3, 0.505334], [383.4, 0.727106], [383.5, 0.95701], [383.6, 1.19542], [383.7, 1.44273], [383.8, 1.69937], [383.9, 1.96578], [384, 2.24244], [384.1, 2.52985], [384.2, 2.82855], [384.3, 3.13912], [384.4, 3.46216], [384.5, 3.79833], [384.6, 4.14833], [384.7, 4.5129], [384.8, 4.89285], [384.9, 5.28902], [385, 5.70236], [385.1, 6.13384], [385.2, 6.58454], [385.3, 7.05562], [385.4, 7.5483], [385.5, 8.06395], [385.6, 8.60402], [385.7, 9.17009], [385.8, 9.7639], [385.9, 10.3873], [386, 11.0424], [386.1, 11.7313], [386.2, 12.4566], [386.3, 13.2209], [386.4, 14.0272], [386.5, 14.8788], [386.6, 15.7792], [386.7, 16.7325], [386.8, 17.7432], [386.9, 18.8161], [387, 19.9568], [387.1, -5], [387.1, -5], [387.1, -5], [387.1, -5], [387.1, -5], [387.1, -5], [387.1, -5], [387.1, -5], [387.1, -5], [387.1, -5], [387.1, -5], [387.1, -5], [387.1, -5], [387.1, -5], [387.1, -5], [387.1, -5], [387.1, -5], [387.1, -5], [387.1, -5], [387.1, -5], [387.1, -5], [387.1, -5], [387.1, -5], [387.1, -5], [387.1, -5], [387.1, -5], [387.1, -5], [387.1, -5], [387.1, -5], [387.1, -5], [387.1, -5], [387.1, -5], [387.1, -5], [387.1, -5], [387.1, -5], [387.1, -5], [387.1, -5], [387.1, -5], [387.1, -5], [387.1, -5], [387.1, -5], [387.1, -5], [387.1, -5], [387.1, -5], [387.1, -5], [387.1, -5], [387.1, -5], [387.1, -5], [387.1, -5], [387.1, -5], [387.1, -5], [387.1, -5], [387.2, -4.9569], [387.3, -4.91258], [387.4, -4.867], [387.5, -4.82011], [387.6, -4.77188], [387.7, -4.72226], [387.8, -4.67121], [387.9, -4.61869], [388, -4.56465], [388.1, -4.50905], [388.2, -4.45182], [388.3, -4.39292], [388.4, -4.3323], [388.5, -4.26991], [388.6, -4.20567], [388.7, -4.13954], [388.8, -4.07144], [388.9, -4.00133], [389, -3.92912], [389.1, -3.85475], [389.2, -3.77814], [389.3, -3.69923], [389.4, -3.61793], [389.5, -3.53415], [389.6, -3.44782], [389.7, -3.35885], [389.8, -3.26714], [389.9, -3.1726], [390, -3.07513], [390.1, -2.97461], [390.2, -2.87095], [390.3, -2.76403], [390.4, -2.65373], [390.5, -2.53993], [390.6, -2.42249], [390.7, -2.30127], [390.8, -2.17615], [390.9, -2.04696], [391, -1.91356], [391.1, -1.77577], [391.2, -1.63343], [391.3, -1.48636], [391.4, -1.33437], [391.5, -1.17726], [391.6, -1.01482], [391.7, -0.846831], [391.8, -0.673069], [391.9, -0.493288], [392, -0.307233], [392.1, -0.114636], [392.2, 0.0847891], [392.3, 0.29134], [392.4, 0.505334], [392.5, 0.727106], [392.6, 0.95701], [392.7, 1.19542], [392.8, 1.44273], [392.9, 1.69937], [393, 1.96578], [393.1, 2.24244], [393.2, 2.52985], [393.3, 2.82855], [393.4, 3.13912], [393.5, 3.46216], [393.6, 3.79833], [393.7, 4.14833], [393.8, 4.5129], [393.9, 4.89285], [394, 5.28902], [394.1, 5.70236], [394.2, 6.13384], [394.3, 6.58454], [394.4, 7.05562], [394.5, 7.5483], [394.6, 8.06395], [394.7, 8.60402], [394.8, 9.17009], [394.9, 9.7639], [395, 10.3873], [395.1, 11.0424], [395.2, 11.7313], [395.3, 12.4566], [395.4, 13.2209], [395.5, 14.0272], [395.6, 14.8788], [395.7, 15.7792], [395.8, 16.7325], [395.9, 17.7432], [396, 18.8161], [396.1, 19.9568], [396.2, -5], [396.2, -5], [396.2, -5], [396.2, -5], [396.2, -5], [396.2, -5], [396.2, -5], [396.2, -5], [396.2, -5], [396.2, -5], [396.2, -5], [396.2, -5], [396.2, -5], [396.2, -5], [396.2, -5], [396.2, -5], [396.2, -5], [396.2, -5], [396.2, -5], [396.2, -5], [396.2, -5], [396.2, -5], [396.2, -5], [396.2, -5], [396.2, -5], [396.2, -5], [396.2, -5], [396.2, -5], [396.2, -5], [396.2, -5], [396.2, -5], [396.2, -5], [396.2, -5], [396.2, -5], [396.2, -5], [396.2, -5], [396.2, -5], [396.2, -5], [396.2, -5], [396.2, -5], [396.2, -5], [396.2, -5], [396.2, -5], [396.2, -5], [396.2, -5], [396.2, -5], [396.2, -5], [396.2, -5], [396.2, -5], [396.2, -5], [396.2, -5], [396.2, -5], [396.3, -4.9569], [396.4, -4.91258], [396.5, -4.867], [396.6, -4.82011], [396.7, -4.77188], [396.8, -4.72226], [396.9, -4.67121], [397, -4.61869], [397.1, -4.56465], [397.2, -4.50905], [397.3, -4.45182], [397.4, -4.39292], [397.5, -4.3323], [397.6, -4.26991], [397.7, -4.20567], [397.8, -4.13954], [397.9, -4.07144], [398, -4.00133], [398.1, -3.92912], [398.2, -3.85475], [398.3, -3.77814], [398.4, -3.69923], [398.5, -3.61793], [398.6, -3.53415], [398.7, -3.44782], [398.8, -3.35885], [398.9, -3.26714], [399, -3.1726], [399.1, -3.07513], [399.2, -2.97461], [399.3, -2.87095], [399.4, -2.76403], [399.5, -2.65373], [399.6, -2.53993], [399.7, -2.42249], [399.8, -2.30127], [399.9, -2.17615], [400, -2.04696], [400.1, -1.91356], [400.2, -1.77577], [400.3, -1.63343], [400.4, -1.48636], [400.5, -1.33437], [400.6, -1.17726], [400.7, -1.01482], [400.8, -0.846831], [400.9, -0.673069], [401, -0.493288], [401.1, -0.307233], [401.2, -0.114636], [401.3, 0.0847891], [401.4, 0.29134], [401.5, 0.505334], [401.6, 0.727106], [401.7, 0.95701], [401.8, 1.19542], [401.9, 1.44273], [402, 1.69937], [402.1, 1.96578], [402.2, 2.24244], [402.3, 2.52985], [402.4, 2.82855], [402.5, 3.13912], [402.6, 3.46216], [402.7, 3.79833], [402.8, 4.14833], [402.9, 4.5129], [403, 4.89285], [403.1, 5.28902], [403.2, 5.70236], [403.3, 6.13384], [403.4, 6.58454], [403.5, 7.05562], [403.6, 7.5483], [403.7, 8.06395], [403.8, 8.60402], [403.9, 9.17009], [404, 9.7639], [404.1, 10.3873], [404.2, 11.0424], [404.3, 11.7313], [404.4, 12.4566], [404.5, 13.2209], [404.6, 14.0272], [404.7, 14.8788], [404.8, 15.7792], [404.9, 16.7325], [405, 17.7432], [405.1, 18.8161], [405.2, 19.9568], [405.3, -5], [405.3, -5], [405.3, -5], [405.3, -5], [405.3, -5], [405.3, -5], [405.3, -5], [405.3, -5], [405.3, -5], [405.3, -5], [405.3, -5], [405.3, -5], [405.3, -5], [405.3, -5], [405.3, -5], [405.3, -5], [405.3, -5], [405.3, -5], [405.3, -5], [405.3, -5], [405.3, -5], [405.3, -5], [405.3, -5], [405.3, -5], [405.3, -5], [405.3, -5], [405.3, -5], [405.3, -5], [405.3, -5], [405.3, -5], [405.3, -5], [405.3, -5], [405.3, -5], [405.3, -5], [405.3, -5], [405.3, -5], [405.3, -5], [405.3, -5], [405.3, -5], [405.3, -5], [405.3, -5], [405.3, -5], [405.3, -5], [405.3, -5], [405.3, -5], [405.3, -5], [405.3, -5], [405.3, -5], [405.3, -5], [405.3, -5], [405.3, -5], [405.3, -5], [405.4, -4.9569], [405.5, -4.91258], [405.6, -4.867], [405.7, -4.82011], [405.8, -4.77188], [405.9, -4.72226], [406, -4.67121], [406.1, -4.61869], [406.2, -4.56465], [406.3, -4.50905], [406.4, -4.45182], [406.5, -4.39292], [406.6, -4.3323], [406.7, -4.26991], [406.8, -4.20567], [406.9, -4.13954], [407, -4.07144], [407.1, -4.00133], [407.2, -3.92912], [407.3, -3.85475], [407.4, -3.77814], [407.5, -3.69923], [407.6, -3.61793], [407.7, -3.53415], [407.8, -3.44782], [407.9, -3.35885], [408, -3.26714], [408.1, -3.1726], [408.2, -3.07513], [408.3, -2.97461], [408.4, -2.87095], [408.5, -2.76403], [408.6, -2.65373], [408.7, -2.53993], [408.8, -2.42249], [408.9, -2.30127], [409, -2.17615], [409.1, -2.04696], [409.2, -1.91356], [409.3, -1.77577], [409.4, -1.63343], [409.5, -1.48636], [409.6, -1.33437], [409.7, -1.17726], [409.8, -1.01482], [409.9, -0.846831], [410, -0.673069], [410.1, -0.493288], [410.2, -0.307233], [410.3, -0.114636], [410.4, 0.0847891], [410.5, 0.29134], [410.6, 0.505334], [410.7, 0.727106], [410.8, 0.95701], [410.9, 1.19542], [411, 1.44273], [411.1, 1.69937], [411.2, 1.96578], [411.3, 2.24244], [411.4, 2.52985], [411.5, 2.82855], [411.6, 3.13912], [411.7, 3.46216], [411.8, 3.79833], [411.9, 4.14833], [412, 4.5129], [412.1, 4.89285], [412.2, 5.28902], [412.3, 5.70236], [412.4, 6.13384], [412.5, 6.58454], [412.6, 7.05562], [412.7, 7.5483], [412.8, 8.06395], [412.9, 8.60402], [413, 9.17009], [413.1, 9.7639], [413.2, 10.3873], [413.3, 11.0424], [413.4, 11.7313], [413.5, 12.4566], [413.6, 13.2209], [413.7, 14.0272], [413.8, 14.8788], [413.9, 15.7792], [414, 16.7325], [414.1, 17.7432], [414.2, 18.8161], [414.3, 19.9568], [414.4, -5], [414.4, -5], [414.4, -5], [414.4, -5], [414.4, -5], [414.4, -5], [414.4, -5], [414.4, -5], [414.4, -5], [414.4, -5], [414.4, -5], [414.4, -5], [414.4, -5], [414.4, -5], [414.4, -5], [414.4, -5], [414.4, -5], [414.4, -5], [414.4, -5], [414.4, -5], [414.4, -5], [414.4, -5], [414.4, -5], [414.4, -5], [414.4, -5], [414.4, -5], [414.4, -5], [414.4, -5], [414.4, -5], [414.4, -5], [414.4, -5], [414.4, -5], [414.4, -5], [414.4, -5], [414.4, -5], [414.4, -5], [414.4, -5], [414.4, -5], [414.4, -5], [414.4, -5], [414.4, -5], [414.4, -5], [414.4, -5], [414.4, -5], [414.4, -5], [414.4, -5], [414.4, -5], [414.4, -5], [414.4, -5], [414.4, -5], [414.4, -5], [414.4, -5], [414.5, -4.9569], [414.6, -4.91258], [414.7, -4.867], [414.8, -4.82011], [414.9, -4.77188], [415, -4.72226], [415.1, -4.67121], [415.2, -4.61869], [415.3, -4.56465], [415.4, -4.50905], [415.5, -4.45182], [415.6, -4.39292], [415.7, -4.3323], [415.8, -4.26991], [415.9, -4.20567], [416, -4.13954], [416.1, -4.07144], [416.2, -4.00133], [416.3, -3.92912], [416.4, -3.85475], [416.5, -3.77814], [416.6, -3.69923], [416.7, -3.61793], [416.8, -3.53415], [416.9, -3.44782], [417, -3.35885], [417.1, -3.26714], [417.2, -3.1726], [417.3, -3.07513], [417.4, -2.97461], [417.5, -2.87095], [417.6, -2.76403], [417.7, -2.65373], [417.8, -2.53993], [417.9, -2.42249], [418, -2.30127], [418.1, -2.17615], [418.2, -2.04696], [418.3, -1.91356], [418.4, -1.77577], [418.5, -1.63343], [418.6, -1.48636], [418.7, -1.33437], [418.8, -1.17726], [418.9, -1.01482], [419, -0.846831], [419.1, -0.673069], [419.2, -0.493288], [419.3, -0.307233], [419.4, -0.114636], [419.5, 0.0847891], [419.6, 0.29134], [419.7, 0.505334], [419.8, 0.727106], [419.9, 0.95701], [420, 1.19542], [420.1, 1.44273], [420.2, 1.69937], [420.3, 1.96578], [420.4, 2.24244], [420.5, 2.52985], [420.6, 2.82855], [420.7, 3.13912], [420.8, 3.46216], [420.9, 3.79833], [421, 4.14833], [421.1, 4.5129], [421.2, 4.89285], [421.3, 5.28902], [421.4, 5.70236], [421.5, 6.13384], [421.6, 6.58454], [421.7, 7.05562], [421.8, 7.5483], [421.9, 8.06395], [422, 8.60402], [422.1, 9.17009], [422.2, 9.7639], [422.3, 10.3873], [422.4, 11.0424], [422.5, 11.7313], [422.6, 12.4566], [422.7, 13.2209], [422.8, 14.0272], [422.9, 14.8788], [423, 15.7792], [423.1, 16.7325], [423.2, 17.7432], [423.3, 18.8161], [423.4, 19.9568], [423.5, -5], [423.5, -5], [423.5, -5], [423.5, -5], [423.5, -5], [423.5, -5], [423.5, -5], [423.5, -5], [423.5, -5], [423.5, -5], [423.5, -5], [423.5, -5], [423.5, -5], [423.5, -5], [423.5, -5], [423.5, -5], [423.5, -5], [423.5, -5], [423.5, -5], [423.5, -5], [423.5, -5], [423.5, -5], [423.5, -5], [423.5, -5], [423.5, -5], [423.5, -5], [423.5, -5], [423.5, -5], [423.5, -5], [423.5, -5], [423.5, -5], [423.5, -5], [423.5, -5], [423.5, -5], [423.5, -5], [423.5, -5], [423.5, -5], [423.5, -5], [423.5, -5], [423.5, -5], [423.5, -5], [423.5, -5], [423.5, -5], [423.5, -5], [423.5, -5], [423.5, -5], [423.5, -5], [423.5, -5], [423.5, -5], [423.5, -5], [423.5, -5], [423.5, -5], [423.6, -4.9569], [423.7, -4.91258], [423.8, -4.867], [423.9, -4.82011], [424, -4.77188], [424.1, -4.72226], [424.2, -4.67121], [424.3, -4.61869], [424.4, -4.56465], [424.5, -4.50905], [424.6, -4.45182], [424.7, -4.39292], [424.8, -4.3323], [424.9, -4.26991], [425, -4.20567], [425.1, -4.13954], [425.2, -4.07144], [425.3, -4.00133], [425.4, -3.92912], [425.5, -3.85475], [425.6, -3.77814], [425.7, -3.69923], [425.8, -3.61793], [425.9, -3.53415], [426, -3.44782], [426.1, -3.35885], [426.2, -3.26714], [426.3, -3.1726], [426.4, -3.07513], [426.5, -2.97461], [426.6, -2.87095], [426.7, -2.76403], [426.8, -2.65373], [426.9, -2.53993], [427, -2.42249], [427.1, -2.30127], [427.2, -2.17615], [427.3, -2.04696], [427.4, -1.91356], [427.5, -1.77577], [427.6, -1.63343], [427.7, -1.48636], [427.8, -1.33437], [427.9, -1.17726], [428, -1.01482], [428.1, -0.846831], [428.2, -0.673069], [428.3, -0.493288], [428.4, -0.307233], [428.5, -0.114636], [428.6, 0.0847891], [428.7, 0.29134], [428.8, 0.505334], [428.9, 0.727106], [429, 0.95701], [429.1, 1.19542], [429.2, 1.44273], [429.3, 1.69937], [429.4, 1.96578], [429.5, 2.24244], [429.6, 2.52985], [429.7, 2.82855], [429.8, 3.13912], [429.9, 3.46216], [430, 3.79833], [430.1, 4.14833], [430.2, 4.5129], [430.3, 4.89285], [430.4, 5.28902], [430.5, 5.70236], [430.6, 6.13384], [430.7, 6.58454], [430.8, 7.05562], [430.9, 7.5483], [431, 8.06395], [431.1, 8.60402], [431.2, 9.17009], [431.3, 9.7639], [431.4, 10.3873], [431.5, 11.0424], [431.6, 11.7313], [431.7, 12.4566], [431.8, 13.2209], [431.9, 14.0272], [432, 14.8788], [432.1, 15.7792], [432.2, 16.7325], [432.3, 17.7432], [432.4, 18.8161], [432.5, 19.9568], [432.6, -5], [432.6, -5], [432.6, -5], [432.6, -5], [432.6, -5], [432.6, -5], [432.6, -5], [432.6, -5], [432.6, -5], [432.6, -5], [432.6, -5], [432.6, -5], [432.6, -5], [432.6, -5], [432.6, -5], [432.6, -5], [432.6, -5], [432.6, -5], [432.6, -5], [432.6, -5], [432.6, -5], [432.6, -5], [432.6, -5], [432.6, -5], [432.6, -5], [432.6, -5], [432.6, -5], [432.6, -5], [432.6, -5], [432.6, -5], [432.6, -5], [432.6, -5], [432.6, -5], [432.6, -5], [432.6, -5], [432.6, -5], [432.6, -5], [432.6, -5], [432.6, -5], [432.6, -5], [432.6, -5], [432.6, -5], [432.6, -5], [432.6, -5], [432.6, -5], [432.6, -5], [432.6, -5], [432.6, -5], [432.6, -5], [432.6, -5], [432.6, -5], [432.6, -5], [432.7, -4.9569], [432.8, -4.91258], [432.9, -4.867], [433, -4.82011], [433.1, -4.77188], [433.2, -4.72226], [433.3, -4.67121], [433.4, -4.61869], [433.5, -4.56465], [433.6, -4.50905], [433.7, -4.45182], [433.8, -4.39292], [433.9, -4.3323], [434, -4.26991], [434.1, -4.20567], [434.2, -4.13954], [434.3, -4.07144], [434.4, -4.00133], [434.5, -3.92912], [434.6, -3.85475], [434.7, -3.77814], [434.8, -3.69923], [434.9, -3.61793], [435, -3.53415], [435.1, -3.44782], [435.2, -3.35885], [435.3, -3.26714], [435.4, -3.1726], [435.5, -3.07513], [435.6, -2.97461], [435.7, -2.87095], [435.8, -2.76403], [435.9, -2.65373], [436, -2.53993], [436.1, -2.42249], [436.2, -2.30127], [436.3, -2.17615], [436.4, -2.04696], [436.5, -1.91356], [436.6, -1.77577], [436.7, -1.63343], [436.8, -1.48636], [436.9, -1.33437], [437, -1.17726], [437.1, -1.01482], [437.2, -0.846831], [437.3, -0.673069], [437.4, -0.493288], [437.5, -0.307233], [437.6, -0.114636], [437.7, 0.0847891], [437.8, 0.29134], [437.9, 0.505334], [438, 0.727106], [438.1, 0.95701], [438.2, 1.19542], [438.3, 1.44273], [438.4, 1.69937], [438.5, 1.96578], [438.6, 2.24244], [438.7, 2.52985], [438.8, 2.82855], [438.9, 3.13912], [439, 3.46216], [439.1, 3.79833], [439.2, 4.14833], [439.3, 4.5129], [439.4, 4.89285], [439.5, 5.28902], [439.6, 5.70236], [439.7, 6.13384], [439.8, 6.58454], [439.9, 7.05562], [440, 7.5483], [440.1, 8.06395], [440.2, 8.60402], [440.3, 9.17009], [440.4, 9.7639], [440.5, 10.3873], [440.6, 11.0424], [440.7, 11.7313], [440.8, 12.4566], [440.9, 13.2209], [441, 14.0272], [441.1, 14.8788], [441.2, 15.7792], [441.3, 16.7325], [441.4, 17.7432], [441.5, 18.8161], [441.6, 19.9568], [441.7, -5], [441.7, -5], [441.7, -5], [441.7, -5], [441.7, -5], [441.7, -5], [441.7, -5], [441.7, -5], [441.7, -5], [441.7, -5], [441.7, -5], [441.7, -5], [441.7, -5], [441.7, -5], [441.7, -5], [441.7, -5], [441.7, -5], [441.7, -5], [441.7, -5], [441.7, -5], [441.7, -5], [441.7, -5], [441.7, -5], [441.7, -5], [441.7, -5], [441.7, -5], [441.7, -5], [441.7, -5], [441.7, -5], [441.7, -5], [441.7, -5], [441.7, -5], [441.7, -5], [441.7, -5], [441.7, -5], [441.7, -5], [441.7, -5], [441.7, -5], [441.7, -5], [441.7, -5], [441.7, -5], [441.7, -5], [441.7, -5], [441.7, -5], [441.7, -5], [441.7, -5], [441.7, -5], [441.7, -5], [441.7, -5], [441.7, -5], [441.7, -5], [441.7, -5], [441.8, -4.9569], [441.9, -4.91258], [442, -4.867], [442.1, -4.82011], [442.2, -4.77188], [442.3, -4.72226], [442.4, -4.67121], [442.5, -4.61869], [442.6, -4.56465], [442.7, -4.50905], [442.8, -4.45182], [442.9, -4.39292], [443, -4.3323], [443.1, -4.26991], [443.2, -4.20567], [443.3, -4.13954], [443.4, -4.07144], [443.5, -4.00133], [443.6, -3.92912], [443.7, -3.85475], [443.8, -3.77814], [443.9, -3.69923], [444, -3.61793], [444.1, -3.53415], [444.2, -3.44782], [444.3, -3.35885], [444.4, -3.26714], [444.5, -3.1726], [444.6, -3.07513], [444.7, -2.97461], [444.8, -2.87095], [444.9, -2.76403], [445, -2.65373], [445.1, -2.53993], [445.2, -2.42249], [445.3, -2.30127], [445.4, -2.17615], [445.5, -2.04696], [445.6, -1.91356], [445.7, -1.77577], [445.8, -1.63343], [445.9, -1.48636], [446, -1.33437], [446.1, -1.17726], [446.2, -1.01482], [446.3, -0.846831], [446.4, -0.673069], [446.5, -0.493288], [446.6, -0.307233], [446.7, -0.114636], [446.8, 0.0847891], [446.9, 0.29134], [447, 0.505334], [447.1, 0.727106], [447.2, 0.95701], [447.3, 1.19542], [447.4, 1.44273], [447.5, 1.69937], [447.6, 1.96578], [447.7, 2.24244], [447.8, 2.52985], [447.9, 2.82855], [448, 3.13912], [448.1, 3.46216], [448.2, 3.79833], [448.3, 4.14833], [448.4, 4.5129], [448.5, 4.89285], [448.6, 5.28902], [448.7, 5.70236], [448.8, 6.13384], [448.9, 6.58454], [449, 7.05562], [449.1, 7.5483], [449.2, 8.06395], [449.3, 8.60402], [449.4, 9.17009], [449.5, 9.7639], [449.6, 10.3873], [449.7, 11.0424], [449.8, 11.7313], [449.9, 12.4566], [450, 13.2209], [450.1, 14.0272], [450.2, 14.8788], [450.3, 15.7792], [450.4, 16.7325], [450.5, 17.7432], [450.6, 18.8161], [450.7, 19.9568], [450.8, -5], [450.8, -5], [450.8, -5], [450.8, -5], [450.8, -5], [450.8, -5], [450.8, -5], [450.8, -5], [450.8, -5], [450.8, -5], [450.8, -5], [450.8, -5], [450.8, -5], [450.8, -5], [450.8, -5], [450.8, -5], [450.8, -5], [450.8, -5], [450.8, -5], [450.8, -5], [450.8, -5], [450.8, -5], [450.8, -5], [450.8, -5], [450.8, -5], [450.8, -5], [450.8, -5], [450.8, -5], [450.8, -5], [450.8, -5], [450.8, -5], [450.8, -5], [450.8, -5], [450.8, -5], [450.8, -5], [450.8, -5], [450.8, -5], [450.8, -5], [450.8, -5], [450.8, -5], [450.8, -5], [450.8, -5], [450.8, -5], [450.8, -5], [450.8, -5], [450.8, -5], [450.8, -5], [450.8, -5], [450.8, -5], [450.8, -5], [450.8, -5], [450.8, -5], [450.9, -4.9569], [451, -4.91258], [451.1, -4.867], [451.2, -4.82011], [451.3, -4.77188], [451.4, -4.72226], [451.5, -4.67121], [451.6, -4.61869], [451.7, -4.56465], [451.8, -4.50905], [451.9, -4.45182], [452, -4.39292], [452.1, -4.3323], [452.2, -4.26991], [452.3, -4.20567], [452.4, -4.13954], [452.5, -4.07144], [452.6, -4.00133], [452.7, -3.92912], [452.8, -3.85475], [452.9, -3.77814], [453, -3.69923], [453.1, -3.61793], [453.2, -3.53415], [453.3, -3.44782], [453.4, -3.35885], [453.5, -3.26714], [453.6, -3.1726], [453.7, -3.07513], [453.8, -2.97461], [453.9, -2.87095], [454, -2.76403], [454.1, -2.65373], [454.2, -2.53993], [454.3, -2.42249], [454.4, -2.30127], [454.5, -2.17615], [454.6, -2.04696], [454.7, -1.91356], [454.8, -1.77577], [454.9, -1.63343], [455, -1.48636], [455.1, -1.33437], [455.2, -1.17726], [455.3, -1.01482], [455.4, -0.846831], [455.5, -0.673069], [455.6, -0.493288], [455.7, -0.307233], [455.8, -0.114636], [455.9, 0.0847891], [456, 0.29134], [456.1, 0.505334], [456.2, 0.727106], [456.3, 0.95701], [456.4, 1.19542], [456.5, 1.44273], [456.6, 1.69937], [456.7, 1.96578], [456.8, 2.24244], [456.9, 2.52985], [457, 2.82855], [457.1, 3.13912], [457.2, 3.46216], [457.3, 3.79833], [457.4, 4.14833], [457.5, 4.5129], [457.6, 4.89285], [457.7, 5.28902], [457.8, 5.70236], [457.9, 6.13384], [458, 6.58454], [458.1, 7.05562], [458.2, 7.5483], [458.3, 8.06395], [458.4, 8.60402], [458.5, 9.17009], [458.6, 9.7639], [458.7, 10.3873], [458.8, 11.0424], [458.9, 11.7313], [459, 12.4566], [459.1, 13.2209], [459.2, 14.0272], [459.3, 14.8788], [459.4, 15.7792], [459.5, 16.7325], [459.6, 17.7432], [459.7, 18.8161], [459.8, 19.9568], [459.9, -5], [459.9, -5], [459.9, -5], [459.9, -5], [459.9, -5], [459.9, -5], [459.9, -5], [459.9, -5], [459.9, -5], [459.9, -5], [459.9, -5], [459.9, -5], [459.9, -5], [459.9, -5], [459.9, -5], [459.9, -5], [459.9, -5], [459.9, -5], [459.9, -5], [459.9, -5], [459.9, -5], [459.9, -5], [459.9, -5], [459.9, -5], [459.9, -5], [459.9, -5], [459.9, -5], [459.9, -5], [459.9, -5], [459.9, -5], [459.9, -5], [459.9, -5], [459.9, -5], [459.9, -5], [459.9, -5], [459.9, -5], [459.9, -5], [459.9, -5], [459.9, -5], [459.9, -5], [459.9, -5], [459.9, -5], [459.9, -5], [459.9, -5], [459.9, -5], [459.9, -5], [459.9, -5], [459.9, -5], [459.9, -5], [459.9, -5], [459.9, -5], [459.9, -5], [460, -4.9569], [460.1, -4.91258], [460.2, -4.867], [460.3, -4.82011], [460.4, -4.77188], [460.5, -4.72226], [460.6, -4.67121], [460.7, -4.61869], [460.8, -4.56465], [460.9, -4.50905], [461, -4.45182], [461.1, -4.39292], [461.2, -4.3323], [461.3, -4.26991], [461.4, -4.20567], [461.5, -4.13954], [461.6, -4.07144], [461.7, -4.00133], [461.8, -3.92912], [461.9, -3.85475], [462, -3.77814], [462.1, -3.69923], [462.2, -3.61793], [462.3, -3.53415], [462.4, -3.44782], [462.5, -3.35885], [462.6, -3.26714], [462.7, -3.1726], [462.8, -3.07513], [462.9, -2.97461], [463, -2.87095], [463.1, -2.76403], [463.2, -2.65373], [463.3, -2.53993], [463.4, -2.42249], [463.5, -2.30127], [463.6, -2.17615], [463.7, -2.04696], [463.8, -1.91356], [463.9, -1.77577], [464, -1.63343], [464.1, -1.48636], [464.2, -1.33437], [464.3, -1.17726], [464.4, -1.01482], [464.5, -0.846831], [464.6, -0.673069], [464.7, -0.493288], [464.8, -0.307233], [464.9, -0.114636], [465, 0.0847891], [465.1, 0.29134], [465.2, 0.505334], [465.3, 0.727106], [465.4, 0.95701], [465.5, 1.19542], [465.6, 1.44273], [465.7, 1.69937], [465.8, 1.96578], [465.9, 2.24244], [466, 2.52985], [466.1, 2.82855], [466.2, 3.13912], [466.3, 3.46216], [466.4, 3.79833], [466.5, 4.14833], [466.6, 4.5129], [466.7, 4.89285], [466.8, 5.28902], [466.9, 5.70236], [467, 6.13384], [467.1, 6.58454], [467.2, 7.05562], [467.3, 7.5483], [467.4, 8.06395], [467.5, 8.60402], [467.6, 9.17009], [467.7, 9.7639], [467.8, 10.3873], [467.9, 11.0424], [468, 11.7313], [468.1, 12.4566], [468.2, 13.2209], [468.3, 14.0272], [468.4, 14.8788], [468.5, 15.7792], [468.6, 16.7325], [468.7, 17.7432], [468.8, 18.8161], [468.9, 19.9568], [469, -5], [469, -5], [469, -5], [469, -5], [469, -5], [469, -5], [469, -5], [469, -5], [469, -5], [469, -5], [469, -5], [469, -5], [469, -5], [469, -5], [469, -5], [469, -5], [469, -5], [469, -5], [469, -5], [469, -5], [469, -5], [469, -5], [469, -5], [469, -5], [469, -5], [469, -5], [469, -5], [469, -5], [469, -5], [469, -5], [469, -5], [469, -5], [469, -5], [469, -5], [469, -5], [469, -5], [469, -5], [469, -5], [469, -5], [469, -5], [469, -5], [469, -5], [469, -5], [469, -5], [469, -5], [469, -5], [469, -5], [469, -5], [469, -5], [469, -5], [469, -5], [469, -5], [469.1, -4.9569], [469.2, -4.91258], [469.3, -4.867], [469.4, -4.82011], [469.5, -4.77188], [469.6, -4.72226], [469.7, -4.67121], [469.8, -4.61869], [469.9, -4.56465], [470, -4.50905], [470.1, -4.45182], [470.2, -4.39292], [470.3, -4.3323], [470.4, -4.26991], [470.5, -4.20567], [470.6, -4.13954], [470.7, -4.07144], [470.8, -4.00133], [470.9, -3.92912], [471, -3.85475], [471.1, -3.77814], [471.2, -3.69923], [471.3, -3.61793], [471.4, -3.53415], [471.5, -3.44782], [471.6, -3.35885], [471.7, -3.26714], [471.8, -3.1726], [471.9, -3.07513], [472, -2.97461], [472.1, -2.87095], [472.2, -2.76403], [472.3, -2.65373], [472.4, -2.53993], [472.5, -2.42249], [472.6, -2.30127], [472.7, -2.17615], [472.8, -2.04696], [472.9, -1.91356], [473, -1.77577], [473.1, -1.63343], [473.2, -1.48636], [473.3, -1.33437], [473.4, -1.17726], [473.5, -1.01482], [473.6, -0.846831], [473.7, -0.673069], [473.8, -0.493288], [473.9, -0.307233], [474, -0.114636], [474.1, 0.0847891], [474.2, 0.29134], [474.3, 0.505334], [474.4, 0.727106], [474.5, 0.95701], [474.6, 1.19542], [474.7, 1.44273], [474.8, 1.69937], [474.9, 1.96578], [475, 2.24244], [475.1, 2.52985], [475.2, 2.82855], [475.3, 3.13912], [475.4, 3.46216], [475.5, 3.79833], [475.6, 4.14833], [475.7, 4.5129], [475.8, 4.89285], [475.9, 5.28902], [476, 5.70236], [476.1, 6.13384], [476.2, 6.58454], [476.3, 7.05562], [476.4, 7.5483], [476.5, 8.06395], [476.6, 8.60402], [476.7, 9.17009], [476.8, 9.7639], [476.9, 10.3873], [477, 11.0424], [477.1, 11.7313], [477.2, 12.4566], [477.3, 13.2209], [477.4, 14.0272], [477.5, 14.8788], [477.6, 15.7792], [477.7, 16.7325], [477.8, 17.7432], [477.9, 18.8161], [478, 19.9568], [478.1, -5], [478.1, -5], [478.1, -5], [478.1, -5], [478.1, -5], [478.1, -5], [478.1, -5], [478.1, -5], [478.1, -5], [478.1, -5], [478.1, -5], [478.1, -5], [478.1, -5], [478.1, -5], [478.1, -5], [478.1, -5], [478.1, -5], [478.1, -5], [478.1, -5], [478.1, -5], [478.1, -5], [478.1, -5], [478.1, -5], [478.1, -5], [478.1, -5], [478.1, -5], [478.1, -5], [478.1, -5], [478.1, -5], [478.1, -5], [478.1, -5], [478.1, -5], [478.1, -5], [478.1, -5], [478.1, -5], [478.1, -5], [478.1, -5], [478.1, -5], [478.1, -5], [478.1, -5], [478.1, -5], [478.1, -5], [478.1, -5], [478.1, -5], [478.1, -5], [478.1, -5], [478.1, -5], [478.1, -5], [478.1, -5], [478.1, -5], [478.1, -5], [478.1, -5], [478.2, -4.9569], [478.3, -4.91258], [478.4, -4.867], [478.5, -4.82011], [478.6, -4.77188], [478.7, -4.72226], [478.8, -4.67121], [478.9, -4.61869], [479, -4.56465], [479.1, -4.50905], [479.2, -4.45182], [479.3, -4.39292], [479.4, -4.3323], [479.5, -4.26991], [479.6, -4.20567], [479.7, -4.13954], [479.8, -4.07144], [479.9, -4.00133], [480, -3.92912], [480.1, -3.85475], [480.2, -3.77814], [480.3, -3.69923], [480.4, -3.61793], [480.5, -3.53415], [480.6, -3.44782], [480.7, -3.35885], [480.8, -3.26714], [480.9, -3.1726], [481, -3.07513], [481.1, -2.97461], [481.2, -2.87095], [481.3, -2.76403], [481.4, -2.65373], [481.5, -2.53993], [481.6, -2.42249], [481.7, -2.30127], [481.8, -2.17615], [481.9, -2.04696], [482, -1.91356], [482.1, -1.77577], [482.2, -1.63343], [482.3, -1.48636], [482.4, -1.33437], [482.5, -1.17726], [482.6, -1.01482], [482.7, -0.846831], [482.8, -0.673069], [482.9, -0.493288], [483, -0.307233], [483.1, -0.114636], [483.2, 0.0847891], [483.3, 0.29134], [483.4, 0.505334], [483.5, 0.727106], [483.6, 0.95701], [483.7, 1.19542], [483.8, 1.44273], [483.9, 1.69937], [484, 1.96578], [484.1, 2.24244], [484.2, 2.52985], [484.3, 2.82855], [484.4, 3.13912], [484.5, 3.46216], [484.6, 3.79833], [484.7, 4.14833], [484.8, 4.5129], [484.9, 4.89285], [485, 5.28902], [485.1, 5.70236], [485.2, 6.13384], [485.3, 6.58454], [485.4, 7.05562], [485.5, 7.5483], [485.6, 8.06395], [485.7, 8.60402], [485.8, 9.17009], [485.9, 9.7639], [486, 10.3873], [486.1, 11.0424], [486.2, 11.7313], [486.3, 12.4566], [486.4, 13.2209], [486.5, 14.0272], [486.6, 14.8788], [486.7, 15.7792], [486.8, 16.7325], [486.9, 17.7432], [487, 18.8161], [487.1, 19.9568], [487.2, -5], [487.2, -5], [487.2, -5], [487.2, -5], [487.2, -5], [487.2, -5], [487.2, -5], [487.2, -5], [487.2, -5], [487.2, -5], [487.2, -5], [487.2, -5], [487.2, -5], [487.2, -5], [487.2, -5], [487.2, -5], [487.2, -5], [487.2, -5], [487.2, -5], [487.2, -5], [487.2, -5], [487.2, -5], [487.2, -5], [487.2, -5], [487.2, -5], [487.2, -5], [487.2, -5], [487.2, -5], [487.2, -5], [487.2, -5], [487.2, -5], [487.2, -5], [487.2, -5], [487.2, -5], [487.2, -5], [487.2, -5], [487.2, -5], [487.2, -5], [487.2, -5], [487.2, -5], [487.2, -5], [487.2, -5], [487.2, -5], [487.2, -5], [487.2, -5], [487.2, -5], [487.2, -5], [487.2, -5], [487.2, -5], [487.2, -5], [487.2, -5], [487.2, -5], [487.3, -4.9569], [487.4, -4.91258], [487.5, -4.867], [487.6, -4.82011], [487.7, -4.77188], [487.8, -4.72226], [487.9, -4.67121], [488, -4.61869], [488.1, -4.56465], [488.2, -4.50905], [488.3, -4.45182], [488.4, -4.39292], [488.5, -4.3323], [488.6, -4.26991], [488.7, -4.20567], [488.8, -4.13954], [488.9, -4.07144], [489, -4.00133], [489.1, -3.92912], [489.2, -3.85475], [489.3, -3.77814], [489.4, -3.69923], [489.5, -3.61793], [489.6, -3.53415], [489.7, -3.44782], [489.8, -3.35885], [489.9, -3.26714], [490, -3.1726], [490.1, -3.07513], [490.2, -2.97461], [490.3, -2.87095], [490.4, -2.76403], [490.5, -2.65373], [490.6, -2.53993], [490.7, -2.42249], [490.8, -2.30127], [490.9, -2.17615], [491, -2.04696], [491.1, -1.91356], [491.2, -1.77577], [491.3, -1.63343], [491.4, -1.48636], [491.5, -1.33437], [491.6, -1.17726], [491.7, -1.01482], [491.8, -0.846831], [491.9, -0.673069], [492, -0.493288], [492.1, -0.307233], [492.2, -0.114636], [492.3, 0.0847891], [492.4, 0.29134], [492.5, 0.505334], [492.6, 0.727106], [492.7, 0.95701], [492.8, 1.19542], [492.9, 1.44273], [493, 1.69937], [493.1, 1.96578], [493.2, 2.24244], [493.3, 2.52985], [493.4, 2.82855], [493.5, 3.13912], [493.6, 3.46216], [493.7, 3.79833], [493.8, 4.14833], [493.9, 4.5129], [494, 4.89285], [494.1, 5.28902], [494.2, 5.70236], [494.3, 6.13384], [494.4, 6.58454], [494.5, 7.05562], [494.6, 7.5483], [494.7, 8.06395], [494.8, 8.60402], [494.9, 9.17009], [495, 9.7639], [495.1, 10.3873], [495.2, 11.0424], [495.3, 11.7313], [495.4, 12.4566], [495.5, 13.2209], [495.6, 14.0272], [495.7, 14.8788], [495.8, 15.7792], [495.9, 16.7325], [496, 17.7432], [496.1, 18.8161], [496.2, 19.9568], [496.3, -5], [496.3, -5], [496.3, -5], [496.3, -5], [496.3, -5], [496.3, -5], [496.3, -5], [496.3, -5], [496.3, -5], [496.3, -5], [496.3, -5], [496.3, -5], [496.3, -5], [496.3, -5], [496.3, -5], [496.3, -5], [496.3, -5], [496.3, -5], [496.3, -5], [496.3, -5], [496.3, -5], [496.3, -5], [496.3, -5], [496.3, -5], [496.3, -5], [496.3, -5], [496.3, -5], [496.3, -5], [496.3, -5], [496.3, -5], [496.3, -5], [496.3, -5], [496.3, -5], [496.3, -5], [496.3, -5], [496.3, -5], [496.3, -5], [496.3, -5], [496.3, -5], [496.3, -5], [496.3, -5], [496.3, -5], [496.3, -5], [496.3, -5], [496.3, -5], [496.3, -5], [496.3, -5], [496.3, -5], [496.3, -5], [496.3, -5], [496.3, -5], [496.3, -5], [496.4, -4.9569], [496.5, -4.91258], [496.6, -4.867], [496.7, -4.82011], [496.8, -4.77188], [496.9, -4.72226], [497, -4.67121], [497.1, -4.61869], [497.2, -4.56465], [497.3, -4.50905], [497.4, -4.45182], [497.5, -4.39292], [497.6, -4.3323], [497.7, -4.26991], [497.8, -4.20567], [497.9, -4.13954], [498, -4.07144], [498.1, -4.00133], [498.2, -3.92912], [498.3, -3.85475], [498.4, -3.77814], [498.5, -3.69923], [498.6, -3.61793], [498.7, -3.53415], [498.8, -3.44782], [498.9, -3.35885], [499, -3.26714], [499.1, -3.1726], [499.2, -3.07513], [499.3, -2.97461], [499.4, -2.87095], [499.5, -2.76403], [499.6, -2.65373], [499.7, -2.53993], [499.8, -2.42249], [499.9, -2.30127], [500, -2.17615]])
+
+plt.figure()
+plt.plot(data.T[0,:], data.T[1,:])
+plt.xlabel('ms')
+plt.ylabel('mV')
+plt.title('Quadratic Integrate and Fire Neuron')
+plt.show()